@@ -4,6 +4,26 @@
 
 #include <algorithm>
 
+namespace {
+uint8_t findKernClass(const EpdKernClassEntry* entries, const int count, const uint32_t cp) {
+  int left = 0;
+  int right = count - 1;
+
+  while (left <= right) {
+    const int mid = left + (right - left) / 2;
+    if (cp < entries[mid].codePoint) {
+      right = mid - 1;
+    } else if (cp > entries[mid].codePoint) {
+      left = mid + 1;
+    } else {
+      return entries[mid].kernClass;
+    }
+  }
+
+  return 0;
+}
+}  // namespace
+
 void EpdFont::getTextBounds(const char* string, const int startX, const int startY, int* minX, int* minY, int* maxX,
                             int* maxY) const {
   *minX = startX;
@@ -18,7 +38,9 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
   int cursorX = startX;
   const int cursorY = startY;
   uint32_t cp;
+  uint32_t prevCp = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&string)))) {
+    cp = applyLigatures(cp, &string);
     const EpdGlyph* glyph = getGlyph(cp);
 
     if (!glyph) {
@@ -31,6 +53,11 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
       continue;
     }
 
+    if (prevCp) {
+      cursorX += getKerning(prevCp, cp);
+    }
+    prevCp = cp;
+
     *minX = std::min(*minX, cursorX + glyph->left);
     *maxX = std::max(*maxX, cursorX + glyph->left + glyph->width);
     *minY = std::min(*minY, cursorY + glyph->top - glyph->height);
@@ -83,3 +110,55 @@ const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
 
   return nullptr;
 }
+
+int EpdFont::getKerning(const uint32_t leftCp, const uint32_t rightCp) const {
+  if (!data->kernMatrix) {
+    return 0;
+  }
+
+  const uint8_t leftClass = findKernClass(data->kernLeftClasses, data->kernLeftCount, leftCp);
+  if (leftClass == 0) {
+    return 0;
+  }
+  const uint8_t rightClass = findKernClass(data->kernRightClasses, data->kernRightCount, rightCp);
+  if (rightClass == 0) {
+    return 0;
+  }
+
+  return data->kernMatrix[(leftClass - 1) * data->kernRightClassCount + (rightClass - 1)];
+}
+
+uint32_t EpdFont::applyLigatures(uint32_t cp, const char** string) const {
+  if (!data->ligatures) {
+    return cp;
+  }
+
+  while (true) {
+    // Advanced through a pointer of its own type, writing a const char* through a const uint8_t** is undefined
+    // behaviour that the optimiser does exploit here
+    auto next = reinterpret_cast<const uint8_t*>(*string);
+    const uint32_t nextCp = utf8NextCodepoint(&next);
+    if (!nextCp) {
+      return cp;
+    }
+
+    // Pairs are sorted by (first, second), so the scan can stop as soon as it passes `cp`
+    uint32_t ligature = 0;
+    for (int i = 0; i < data->ligatureCount; i++) {
+      const EpdLigaturePair& pair = data->ligatures[i];
+      if (pair.first > cp || (pair.first == cp && pair.second > nextCp)) {
+        break;
+      }
+      if (pair.first == cp && pair.second == nextCp) {
+        ligature = pair.ligature;
+        break;
+      }
+    }
+
+    if (!ligature) {
+      return cp;
+    }
+    cp = ligature;
+    *string = reinterpret_cast<const char*>(next);
+  }
+}
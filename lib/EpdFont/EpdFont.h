@@ -12,4 +12,8 @@ class EpdFont {
   bool hasPrintableChars(const char* string) const;
 
   const EpdGlyph* getGlyph(uint32_t cp) const;
+  // Pair adjustment in pixels to apply between two consecutive code points
+  int getKerning(uint32_t leftCp, uint32_t rightCp) const;
+  // Folds following code points from `string` into `cp` while they form a ligature, advancing `string` past them
+  uint32_t applyLigatures(uint32_t cp, const char** string) const;
 };
@@ -22,6 +22,19 @@ typedef struct {
   uint32_t offset;  ///< Index of the first code point into the glyph array
 } EpdUnicodeInterval;
 
+/// Kerning class assignment for a single code point
+typedef struct {
+  uint32_t codePoint;  ///< Unicode code point, entries are sorted ascending
+  uint8_t kernClass;   ///< 1-based kerning class (row or column of the kerning matrix)
+} EpdKernClassEntry;
+
+/// Ligature substitution for a pair of code points
+typedef struct {
+  uint32_t first;     ///< Leading code point, entries are sorted by first then second
+  uint32_t second;    ///< Trailing code point
+  uint32_t ligature;  ///< Code point of the glyph replacing the pair
+} EpdLigaturePair;
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
@@ -32,4 +45,13 @@ typedef struct {
   int ascender;                         ///< Maximal height of a glyph above the base line
   int descender;                        ///< Maximal height of a glyph below the base line
   bool is2Bit;
+  const EpdKernClassEntry* kernLeftClasses;   ///< Left-hand kerning classes, nullptr if the font has no kerning
+  uint16_t kernLeftCount;                     ///< Number of left-hand class entries
+  const EpdKernClassEntry* kernRightClasses;  ///< Right-hand kerning classes
+  uint16_t kernRightCount;                    ///< Number of right-hand class entries
+  const int8_t* kernMatrix;                   ///< Pair adjustments in pixels, kernLeftClassCount rows
+  uint8_t kernLeftClassCount;                 ///< Number of distinct left-hand classes
+  uint8_t kernRightClassCount;                ///< Number of distinct right-hand classes (matrix row length)
+  const EpdLigaturePair* ligatures;           ///< Ligature substitutions, nullptr if the font has none
+  uint8_t ligatureCount;                      ///< Number of ligature substitutions
 } EpdFontData;
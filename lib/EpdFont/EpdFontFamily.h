@@ -13,6 +13,8 @@ class EpdFontFamily {
   bool hasPrintableChars(const char* string, Style style = REGULAR) const;
   const EpdFontData* getData(Style style = REGULAR) const;
   const EpdGlyph* getGlyph(uint32_t cp, Style style = REGULAR) const;
+  int getKerning(uint32_t leftCp, uint32_t rightCp, Style style = REGULAR) const;
+  uint32_t applyLigatures(uint32_t cp, const char** string, Style style = REGULAR) const;
 
  private:
   const EpdFont* regular;
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_boldBitmaps[51217] = {
+static const uint8_t bookerly_12_boldBitmaps[51767] = {
     0x0A, 0x83, 0xFC, 0x3F, 0x87, 0xF4, 0x7F, 0x43, 0xF4, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
     0x03, 0xF0, 0x2F, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0, 0x50, 0x7E, 0x1F,
     0x7F, 0x8F, 0xDF, 0xD3, 0xF3, 0xF4, 0xFC, 0xFD, 0x3F, 0x2F, 0x0F, 0xCB, 0xC3, 0xF2, 0xE0, 0xF8,
@@ -3209,7 +3209,41 @@ static const uint8_t bookerly_12_boldBitmaps[51217] = {
     0x2F, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0x47, 0xFC, 0x7F,
     0xC3, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x0B, 0xD0, 0xFF, 0x40, 0xBF, 0x80, 0x7F, 0xC3,
     0xFD, 0x02, 0xFE, 0x01, 0xFF, 0x0B, 0xE0, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0xBF, 0xF9, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xD0, 0x0F, 0xF5, 0x7F, 0xF0, 0xBD, 0x02, 0xFC, 0x01, 0xFD, 0x02, 0x40, 0x3F, 0xC0, 0x1F,
+    0xC0, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x05, 0xBF, 0xD5, 0x7F, 0xD5, 0x00, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80,
+    0x2F, 0xC0, 0x00, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x00, 0x07, 0xF8,
+    0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x00, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x7F,
+    0x80, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0x0B, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x69, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xF4, 0x2F,
+    0xD0, 0x02, 0xFC, 0x00, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFF,
+    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x05, 0xBF, 0xD5, 0x7F, 0xC0, 0x07, 0xF8, 0x02, 0xFC,
+    0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x07, 0xF8,
+    0x02, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xC0,
+    0x2F, 0xFF, 0x0B, 0xFF, 0xC3, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x00, 0x69, 0x44, 0x00, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00,
+    0x3F, 0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x02, 0xFF, 0xFC, 0x2F, 0xC0, 0xBF, 0xFF, 0xC2,
+    0xFC, 0x05, 0xBF, 0xD4, 0x2F, 0xC0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x07,
+    0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x2F,
+    0xC0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x2F, 0xFF, 0x0B, 0xFF, 0xC3, 0xFF,
+    0xF0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0xBF, 0xF8, 0x7F, 0xFF, 0xC0,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF4, 0x7F, 0xF8, 0x1F, 0xF0, 0x02, 0xFC, 0x00,
+    0xFE, 0x00, 0x7D, 0x00, 0x3F, 0xC0, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00,
+    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xBF, 0xD5,
+    0x7F, 0xD5, 0x6F, 0xE0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0F,
+    0xE0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x07, 0xF8,
+    0x02, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x07, 0xF8, 0x02, 0xFC, 0x00,
+    0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x2F, 0xFF, 0x1F, 0xFF, 0x47, 0xFF, 0xD3, 0xFF,
+    0xF2, 0xFF, 0xF8, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x44, 0x00, 0x00, 0xBF, 0xF8, 0x7F,
+    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF4, 0x7F, 0xF8, 0x1F, 0xE0, 0x02,
+    0xFC, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F, 0xE0, 0x03, 0xF8, 0x02, 0xFC,
+    0x00, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x05,
+    0xBF, 0xD5, 0x7F, 0xD4, 0x0F, 0xE0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x2F,
+    0xC0, 0x0F, 0xE0, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0,
+    0x07, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x07, 0xF8, 0x02,
+    0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x2F, 0xFF, 0x1F, 0xFF, 0x47, 0xFF,
+    0xD3, 0xFF, 0xF2, 0xFF, 0xF8, 0xBF, 0xFE,
 };
 
 static const EpdGlyph bookerly_12_boldGlyphs[] = {
@@ -3941,6 +3975,11 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 15, 18, 25, 5, 18, 68, 51112 }, // ⊥
     { 6, 5, 16, 5, 9, 8, 51180 }, // ⋅
     { 23, 5, 25, 1, 9, 29, 51188 }, // ⋯
+    { 22, 20, 19, 0, 20, 110, 51217 }, // ﬀ
+    { 18, 20, 17, 0, 20, 90, 51327 }, // ﬁ
+    { 18, 20, 18, 0, 20, 90, 51417 }, // ﬂ
+    { 26, 20, 26, 0, 20, 130, 51507 }, // ﬃ
+    { 26, 20, 26, 0, 20, 130, 51637 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_12_boldIntervals[] = {
@@ -4004,15 +4043,619 @@ static const EpdUnicodeInterval bookerly_12_boldIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_12_boldKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x2F, 6 }, // /
+    { 0x41, 7 }, // A
+    { 0x42, 8 }, // B
+    { 0x43, 9 }, // C
+    { 0x44, 10 }, // D
+    { 0x46, 11 }, // F
+    { 0x4A, 12 }, // J
+    { 0x4B, 13 }, // K
+    { 0x4C, 14 }, // L
+    { 0x4D, 15 }, // M
+    { 0x4E, 16 }, // N
+    { 0x4F, 10 }, // O
+    { 0x50, 17 }, // P
+    { 0x51, 18 }, // Q
+    { 0x52, 19 }, // R
+    { 0x53, 20 }, // S
+    { 0x54, 21 }, // T
+    { 0x55, 22 }, // U
+    { 0x56, 23 }, // V
+    { 0x57, 23 }, // W
+    { 0x58, 24 }, // X
+    { 0x59, 25 }, // Y
+    { 0x5A, 26 }, // Z
+    { 0x5B, 27 }, // [
+    { 0x5C, 28 }, // <backslash>
+    { 0x61, 29 }, // a
+    { 0x62, 30 }, // b
+    { 0x63, 31 }, // c
+    { 0x65, 32 }, // e
+    { 0x66, 33 }, // f
+    { 0x67, 34 }, // g
+    { 0x68, 35 }, // h
+    { 0x6B, 36 }, // k
+    { 0x6C, 37 }, // l
+    { 0x6D, 35 }, // m
+    { 0x6E, 35 }, // n
+    { 0x6F, 30 }, // o
+    { 0x70, 30 }, // p
+    { 0x71, 38 }, // q
+    { 0x72, 39 }, // r
+    { 0x73, 40 }, // s
+    { 0x74, 40 }, // t
+    { 0x75, 41 }, // u
+    { 0x76, 42 }, // v
+    { 0x77, 42 }, // w
+    { 0x78, 43 }, // x
+    { 0x79, 42 }, // y
+    { 0x7A, 40 }, // z
+    { 0x7B, 44 }, // {
+    { 0xA1, 45 }, // ¡
+    { 0xAB, 46 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 47 }, // »
+    { 0xBF, 48 }, // ¿
+    { 0xC0, 7 }, // À
+    { 0xC1, 7 }, // Á
+    { 0xC2, 7 }, // Â
+    { 0xC3, 7 }, // Ã
+    { 0xC4, 7 }, // Ä
+    { 0xC5, 7 }, // Å
+    { 0xC7, 9 }, // Ç
+    { 0xD0, 10 }, // Ð
+    { 0xD1, 16 }, // Ñ
+    { 0xD2, 10 }, // Ò
+    { 0xD3, 10 }, // Ó
+    { 0xD4, 10 }, // Ô
+    { 0xD5, 10 }, // Õ
+    { 0xD6, 10 }, // Ö
+    { 0xD8, 49 }, // Ø
+    { 0xD9, 22 }, // Ù
+    { 0xDA, 22 }, // Ú
+    { 0xDB, 22 }, // Û
+    { 0xDC, 22 }, // Ü
+    { 0xDD, 25 }, // Ý
+    { 0xDE, 50 }, // Þ
+    { 0xDF, 51 }, // ß
+    { 0xE0, 29 }, // à
+    { 0xE1, 29 }, // á
+    { 0xE2, 29 }, // â
+    { 0xE3, 29 }, // ã
+    { 0xE4, 29 }, // ä
+    { 0xE5, 29 }, // å
+    { 0xE6, 32 }, // æ
+    { 0xE7, 31 }, // ç
+    { 0xE8, 32 }, // è
+    { 0xE9, 32 }, // é
+    { 0xEA, 32 }, // ê
+    { 0xEB, 32 }, // ë
+    { 0xEE, 52 }, // î
+    { 0xEF, 52 }, // ï
+    { 0xF0, 30 }, // ð
+    { 0xF1, 35 }, // ñ
+    { 0xF2, 30 }, // ò
+    { 0xF3, 30 }, // ó
+    { 0xF4, 30 }, // ô
+    { 0xF5, 30 }, // õ
+    { 0xF6, 30 }, // ö
+    { 0xF8, 30 }, // ø
+    { 0xF9, 41 }, // ù
+    { 0xFA, 41 }, // ú
+    { 0xFB, 41 }, // û
+    { 0xFC, 41 }, // ü
+    { 0xFD, 42 }, // ý
+    { 0xFE, 30 }, // þ
+    { 0xFF, 42 }, // ÿ
+    { 0x100, 7 }, // Ā
+    { 0x101, 29 }, // ā
+    { 0x102, 7 }, // Ă
+    { 0x103, 29 }, // ă
+    { 0x104, 53 }, // Ą
+    { 0x105, 54 }, // ą
+    { 0x106, 9 }, // Ć
+    { 0x107, 31 }, // ć
+    { 0x108, 9 }, // Ĉ
+    { 0x109, 31 }, // ĉ
+    { 0x10A, 9 }, // Ċ
+    { 0x10B, 31 }, // ċ
+    { 0x10C, 9 }, // Č
+    { 0x10D, 31 }, // č
+    { 0x10E, 10 }, // Ď
+    { 0x10F, 55 }, // ď
+    { 0x110, 10 }, // Đ
+    { 0x113, 32 }, // ē
+    { 0x115, 32 }, // ĕ
+    { 0x117, 32 }, // ė
+    { 0x119, 56 }, // ę
+    { 0x11B, 32 }, // ě
+    { 0x11D, 34 }, // ĝ
+    { 0x11F, 34 }, // ğ
+    { 0x121, 34 }, // ġ
+    { 0x123, 34 }, // ģ
+    { 0x125, 35 }, // ĥ
+    { 0x127, 35 }, // ħ
+    { 0x129, 52 }, // ĩ
+    { 0x12B, 52 }, // ī
+    { 0x12D, 52 }, // ĭ
+    { 0x12F, 57 }, // į
+    { 0x132, 12 }, // Ĳ
+    { 0x134, 12 }, // Ĵ
+    { 0x135, 58 }, // ĵ
+    { 0x136, 13 }, // Ķ
+    { 0x137, 36 }, // ķ
+    { 0x138, 36 }, // ĸ
+    { 0x139, 14 }, // Ĺ
+    { 0x13A, 37 }, // ĺ
+    { 0x13B, 14 }, // Ļ
+    { 0x13C, 37 }, // ļ
+    { 0x13E, 55 }, // ľ
+    { 0x141, 14 }, // Ł
+    { 0x142, 59 }, // ł
+    { 0x143, 16 }, // Ń
+    { 0x144, 35 }, // ń
+    { 0x145, 16 }, // Ņ
+    { 0x146, 35 }, // ņ
+    { 0x147, 16 }, // Ň
+    { 0x148, 35 }, // ň
+    { 0x149, 35 }, // ŉ
+    { 0x14A, 16 }, // Ŋ
+    { 0x14B, 35 }, // ŋ
+    { 0x14C, 10 }, // Ō
+    { 0x14D, 30 }, // ō
+    { 0x14E, 10 }, // Ŏ
+    { 0x14F, 30 }, // ŏ
+    { 0x150, 10 }, // Ő
+    { 0x151, 30 }, // ő
+    { 0x153, 32 }, // œ
+    { 0x154, 19 }, // Ŕ
+    { 0x155, 39 }, // ŕ
+    { 0x156, 19 }, // Ŗ
+    { 0x157, 39 }, // ŗ
+    { 0x158, 19 }, // Ř
+    { 0x159, 39 }, // ř
+    { 0x15A, 20 }, // Ś
+    { 0x15B, 40 }, // ś
+    { 0x15C, 20 }, // Ŝ
+    { 0x15D, 40 }, // ŝ
+    { 0x15E, 20 }, // Ş
+    { 0x15F, 40 }, // ş
+    { 0x160, 20 }, // Š
+    { 0x161, 40 }, // š
+    { 0x162, 21 }, // Ţ
+    { 0x163, 60 }, // ţ
+    { 0x164, 21 }, // Ť
+    { 0x166, 21 }, // Ŧ
+    { 0x167, 40 }, // ŧ
+    { 0x168, 22 }, // Ũ
+    { 0x169, 41 }, // ũ
+    { 0x16A, 22 }, // Ū
+    { 0x16B, 41 }, // ū
+    { 0x16C, 22 }, // Ŭ
+    { 0x16D, 41 }, // ŭ
+    { 0x16E, 22 }, // Ů
+    { 0x16F, 41 }, // ů
+    { 0x170, 22 }, // Ű
+    { 0x171, 41 }, // ű
+    { 0x172, 22 }, // Ų
+    { 0x173, 61 }, // ų
+    { 0x174, 23 }, // Ŵ
+    { 0x175, 42 }, // ŵ
+    { 0x176, 25 }, // Ŷ
+    { 0x177, 42 }, // ŷ
+    { 0x178, 25 }, // Ÿ
+    { 0x179, 26 }, // Ź
+    { 0x17A, 40 }, // ź
+    { 0x17B, 26 }, // Ż
+    { 0x17C, 40 }, // ż
+    { 0x17D, 26 }, // Ž
+    { 0x17E, 40 }, // ž
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 62 }, // ‘
+    { 0x2019, 63 }, // ’
+    { 0x201A, 64 }, // ‚
+    { 0x201B, 62 }, // ‛
+    { 0x201C, 62 }, // “
+    { 0x201D, 63 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x201F, 62 }, // ‟
+    { 0x2025, 4 }, // ‥
+    { 0x2026, 4 }, // …
+    { 0x2039, 46 }, // ‹
+    { 0x203A, 47 }, // ›
+    { 0xFB00, 33 }, // ﬀ
+    { 0xFB02, 37 }, // ﬂ
+    { 0xFB04, 37 }, // ﬄ
+};
+
+static const EpdKernClassEntry bookerly_12_boldKernRightClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x29, 2 }, // )
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x3F, 10 }, // ?
+    { 0x41, 11 }, // A
+    { 0x42, 12 }, // B
+    { 0x43, 13 }, // C
+    { 0x44, 12 }, // D
+    { 0x45, 12 }, // E
+    { 0x46, 12 }, // F
+    { 0x47, 13 }, // G
+    { 0x48, 12 }, // H
+    { 0x49, 12 }, // I
+    { 0x4A, 14 }, // J
+    { 0x4B, 12 }, // K
+    { 0x4C, 12 }, // L
+    { 0x4D, 15 }, // M
+    { 0x4E, 12 }, // N
+    { 0x4F, 13 }, // O
+    { 0x50, 12 }, // P
+    { 0x51, 13 }, // Q
+    { 0x52, 12 }, // R
+    { 0x53, 16 }, // S
+    { 0x54, 17 }, // T
+    { 0x55, 18 }, // U
+    { 0x56, 19 }, // V
+    { 0x57, 19 }, // W
+    { 0x58, 20 }, // X
+    { 0x59, 21 }, // Y
+    { 0x5C, 22 }, // <backslash>
+    { 0x5D, 23 }, // ]
+    { 0x61, 24 }, // a
+    { 0x62, 25 }, // b
+    { 0x63, 26 }, // c
+    { 0x64, 26 }, // d
+    { 0x65, 26 }, // e
+    { 0x66, 27 }, // f
+    { 0x67, 28 }, // g
+    { 0x68, 25 }, // h
+    { 0x69, 29 }, // i
+    { 0x6A, 30 }, // j
+    { 0x6B, 25 }, // k
+    { 0x6C, 25 }, // l
+    { 0x6D, 31 }, // m
+    { 0x6E, 31 }, // n
+    { 0x6F, 26 }, // o
+    { 0x70, 32 }, // p
+    { 0x71, 26 }, // q
+    { 0x72, 31 }, // r
+    { 0x73, 33 }, // s
+    { 0x74, 34 }, // t
+    { 0x75, 35 }, // u
+    { 0x76, 36 }, // v
+    { 0x77, 36 }, // w
+    { 0x78, 37 }, // x
+    { 0x79, 38 }, // y
+    { 0x7A, 39 }, // z
+    { 0x7D, 40 }, // }
+    { 0xAB, 41 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 42 }, // »
+    { 0xBF, 43 }, // ¿
+    { 0xC0, 11 }, // À
+    { 0xC1, 11 }, // Á
+    { 0xC2, 11 }, // Â
+    { 0xC3, 11 }, // Ã
+    { 0xC4, 11 }, // Ä
+    { 0xC5, 11 }, // Å
+    { 0xC6, 44 }, // Æ
+    { 0xC7, 13 }, // Ç
+    { 0xC8, 12 }, // È
+    { 0xC9, 12 }, // É
+    { 0xCA, 12 }, // Ê
+    { 0xCB, 12 }, // Ë
+    { 0xCC, 12 }, // Ì
+    { 0xCD, 12 }, // Í
+    { 0xCE, 12 }, // Î
+    { 0xCF, 12 }, // Ï
+    { 0xD0, 12 }, // Ð
+    { 0xD1, 12 }, // Ñ
+    { 0xD2, 13 }, // Ò
+    { 0xD3, 13 }, // Ó
+    { 0xD4, 13 }, // Ô
+    { 0xD5, 13 }, // Õ
+    { 0xD6, 13 }, // Ö
+    { 0xD8, 45 }, // Ø
+    { 0xD9, 18 }, // Ù
+    { 0xDA, 18 }, // Ú
+    { 0xDB, 18 }, // Û
+    { 0xDC, 18 }, // Ü
+    { 0xDD, 21 }, // Ý
+    { 0xDE, 12 }, // Þ
+    { 0xDF, 46 }, // ß
+    { 0xE0, 24 }, // à
+    { 0xE1, 24 }, // á
+    { 0xE2, 24 }, // â
+    { 0xE3, 47 }, // ã
+    { 0xE4, 48 }, // ä
+    { 0xE5, 24 }, // å
+    { 0xE6, 24 }, // æ
+    { 0xE7, 26 }, // ç
+    { 0xE8, 26 }, // è
+    { 0xE9, 26 }, // é
+    { 0xEA, 26 }, // ê
+    { 0xEB, 49 }, // ë
+    { 0xEC, 50 }, // ì
+    { 0xED, 29 }, // í
+    { 0xEE, 51 }, // î
+    { 0xEF, 52 }, // ï
+    { 0xF0, 26 }, // ð
+    { 0xF1, 31 }, // ñ
+    { 0xF2, 26 }, // ò
+    { 0xF3, 26 }, // ó
+    { 0xF4, 26 }, // ô
+    { 0xF5, 26 }, // õ
+    { 0xF6, 26 }, // ö
+    { 0xF8, 53 }, // ø
+    { 0xF9, 35 }, // ù
+    { 0xFA, 35 }, // ú
+    { 0xFB, 35 }, // û
+    { 0xFC, 35 }, // ü
+    { 0xFD, 38 }, // ý
+    { 0xFE, 54 }, // þ
+    { 0xFF, 38 }, // ÿ
+    { 0x100, 11 }, // Ā
+    { 0x101, 55 }, // ā
+    { 0x102, 11 }, // Ă
+    { 0x103, 56 }, // ă
+    { 0x104, 11 }, // Ą
+    { 0x105, 24 }, // ą
+    { 0x106, 13 }, // Ć
+    { 0x107, 26 }, // ć
+    { 0x108, 13 }, // Ĉ
+    { 0x109, 26 }, // ĉ
+    { 0x10A, 13 }, // Ċ
+    { 0x10B, 26 }, // ċ
+    { 0x10C, 13 }, // Č
+    { 0x10D, 26 }, // č
+    { 0x10E, 12 }, // Ď
+    { 0x10F, 26 }, // ď
+    { 0x110, 12 }, // Đ
+    { 0x111, 26 }, // đ
+    { 0x112, 12 }, // Ē
+    { 0x113, 26 }, // ē
+    { 0x114, 12 }, // Ĕ
+    { 0x115, 26 }, // ĕ
+    { 0x116, 12 }, // Ė
+    { 0x117, 26 }, // ė
+    { 0x118, 12 }, // Ę
+    { 0x119, 26 }, // ę
+    { 0x11A, 12 }, // Ě
+    { 0x11B, 26 }, // ě
+    { 0x11C, 13 }, // Ĝ
+    { 0x11D, 28 }, // ĝ
+    { 0x11E, 13 }, // Ğ
+    { 0x11F, 57 }, // ğ
+    { 0x120, 13 }, // Ġ
+    { 0x121, 28 }, // ġ
+    { 0x122, 13 }, // Ģ
+    { 0x123, 28 }, // ģ
+    { 0x124, 12 }, // Ĥ
+    { 0x125, 25 }, // ĥ
+    { 0x126, 12 }, // Ħ
+    { 0x127, 58 }, // ħ
+    { 0x128, 12 }, // Ĩ
+    { 0x129, 52 }, // ĩ
+    { 0x12A, 12 }, // Ī
+    { 0x12B, 52 }, // ī
+    { 0x12C, 12 }, // Ĭ
+    { 0x12D, 52 }, // ĭ
+    { 0x12E, 12 }, // Į
+    { 0x12F, 29 }, // į
+    { 0x130, 12 }, // İ
+    { 0x131, 29 }, // ı
+    { 0x132, 12 }, // Ĳ
+    { 0x133, 29 }, // ĳ
+    { 0x134, 14 }, // Ĵ
+    { 0x135, 59 }, // ĵ
+    { 0x136, 12 }, // Ķ
+    { 0x137, 25 }, // ķ
+    { 0x138, 31 }, // ĸ
+    { 0x139, 12 }, // Ĺ
+    { 0x13A, 25 }, // ĺ
+    { 0x13B, 12 }, // Ļ
+    { 0x13C, 25 }, // ļ
+    { 0x13D, 12 }, // Ľ
+    { 0x13E, 25 }, // ľ
+    { 0x13F, 12 }, // Ŀ
+    { 0x140, 25 }, // ŀ
+    { 0x141, 12 }, // Ł
+    { 0x142, 60 }, // ł
+    { 0x143, 12 }, // Ń
+    { 0x144, 31 }, // ń
+    { 0x145, 12 }, // Ņ
+    { 0x146, 31 }, // ņ
+    { 0x147, 12 }, // Ň
+    { 0x148, 31 }, // ň
+    { 0x149, 31 }, // ŉ
+    { 0x14A, 12 }, // Ŋ
+    { 0x14B, 31 }, // ŋ
+    { 0x14C, 13 }, // Ō
+    { 0x14D, 26 }, // ō
+    { 0x14E, 13 }, // Ŏ
+    { 0x14F, 26 }, // ŏ
+    { 0x150, 13 }, // Ő
+    { 0x151, 26 }, // ő
+    { 0x152, 13 }, // Œ
+    { 0x153, 26 }, // œ
+    { 0x154, 12 }, // Ŕ
+    { 0x155, 31 }, // ŕ
+    { 0x156, 12 }, // Ŗ
+    { 0x157, 31 }, // ŗ
+    { 0x158, 12 }, // Ř
+    { 0x159, 61 }, // ř
+    { 0x15A, 16 }, // Ś
+    { 0x15B, 33 }, // ś
+    { 0x15C, 16 }, // Ŝ
+    { 0x15D, 33 }, // ŝ
+    { 0x15E, 16 }, // Ş
+    { 0x15F, 33 }, // ş
+    { 0x160, 16 }, // Š
+    { 0x161, 62 }, // š
+    { 0x162, 17 }, // Ţ
+    { 0x163, 34 }, // ţ
+    { 0x164, 17 }, // Ť
+    { 0x165, 34 }, // ť
+    { 0x166, 17 }, // Ŧ
+    { 0x167, 34 }, // ŧ
+    { 0x168, 18 }, // Ũ
+    { 0x169, 35 }, // ũ
+    { 0x16A, 18 }, // Ū
+    { 0x16B, 35 }, // ū
+    { 0x16C, 18 }, // Ŭ
+    { 0x16D, 35 }, // ŭ
+    { 0x16E, 18 }, // Ů
+    { 0x16F, 35 }, // ů
+    { 0x170, 18 }, // Ű
+    { 0x171, 35 }, // ű
+    { 0x172, 18 }, // Ų
+    { 0x173, 35 }, // ų
+    { 0x174, 19 }, // Ŵ
+    { 0x175, 36 }, // ŵ
+    { 0x176, 21 }, // Ŷ
+    { 0x177, 38 }, // ŷ
+    { 0x178, 21 }, // Ÿ
+    { 0x17A, 39 }, // ź
+    { 0x17C, 39 }, // ż
+    { 0x17E, 63 }, // ž
+    { 0x17F, 46 }, // ſ
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 64 }, // ‘
+    { 0x2019, 65 }, // ’
+    { 0x201A, 6 }, // ‚
+    { 0x201B, 64 }, // ‛
+    { 0x201C, 64 }, // “
+    { 0x201D, 65 }, // ”
+    { 0x201E, 6 }, // „
+    { 0x201F, 64 }, // ‟
+    { 0x2025, 6 }, // ‥
+    { 0x2026, 6 }, // …
+    { 0x2039, 41 }, // ‹
+    { 0x203A, 42 }, // ›
+    { 0xFB00, 27 }, // ﬀ
+    { 0xFB01, 27 }, // ﬁ
+    { 0xFB02, 27 }, // ﬂ
+    { 0xFB03, 27 }, // ﬃ
+    { 0xFB04, 27 }, // ﬄ
+};
+
+static const int8_t bookerly_12_boldKernMatrix[4160] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, -1, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, -1, -1, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -4, -1, 0, -2, -2, -2, 0, 0, 0, -2, 0, -2, -2, -2, 0, 0, 0, -1, -2, -1, 0, 0,
+    -1, 0, -2, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -3, -2, -3, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -2, 0, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, -1, 0, 0, 1, 1, 0, 0, -1, -1, -1, 0, 1, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 1, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 2, 2, 0, 0, -1, -1, -1, 0, 2, 0, 0, -1, 0, 0, 0,
+    0, 0, 1, -2, 0, -2, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 1, 0, 1, 0, -1, -1, 0, 1, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, -2, -1, -2, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -3, 0, 0, 0, -3, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, -1, -2, 0, 1, 1, -2, 0, -1, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 1, -3, -1, -3, -3, 0, 0, 0, -4, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 1, -2, 0, -2, 0, 0, -1, 0, -2, 0, -1, -1, -1, -1, -1, 1, -1, -1, 0, -4, -1, 0, -1, -1, -2, 0, 2, 2, -2, 1, -1, -1, -1, 1, 2, 1, -1, -2, -1, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, -2, -3, -1, -1, 0, -3, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -2, 0, 0, -1, -1, -2, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -2, -2, 0, -2, -1, -2, 0, 2, 2, -2, 0, -1, -1, -2, 0, 1, 0, -1, -2, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    3, 2, 2, -1, 0, -1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 0, 0, 1, 0, 0, 3, 2, 0, 1, 1, 1, 2, 2,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 1, -1, 0, -1, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, -1, -2, 0, -2, 0, 0, -1, -1, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0,
+    0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, -2, -3, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -2, -2, -2, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1,
+    -1, 0, -2, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -3, -2, -3, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -3, -2,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, -1,
+    0, 2, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 3, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 0, 0, 3, 2, 3, 1, 1, 1, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 1, 1, 1, 0, 0, 0, 0, -3, -3, 0, 0, 0, 0, -1, 0, 1, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -1, 0, -1, -1, -2, 0, 1, 1, -2, 0, -1, -1, -2, 1, 1, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, -1, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+};
+
+static const EpdLigaturePair bookerly_12_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_12_bold = {
     bookerly_12_boldBitmaps,
     bookerly_12_boldGlyphs,
     bookerly_12_boldIntervals,
-    60,
+    61,
     33,
     27,
     -7,
     true,
+    bookerly_12_boldKernLeftClasses,
+    235,
+    bookerly_12_boldKernRightClasses,
+    278,
+    bookerly_12_boldKernMatrix,
+    64,
+    65,
+    bookerly_12_boldLigatures,
+    5,
 };
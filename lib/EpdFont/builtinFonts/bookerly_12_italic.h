@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_italicBitmaps[48812] = {
+static const uint8_t bookerly_12_italicBitmaps[49652] = {
     0x00, 0x14, 0x03, 0xD0, 0x1F, 0x00, 0xF8, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x02, 0xD0, 0x0B, 0x00,
     0x3C, 0x00, 0xE0, 0x03, 0x80, 0x1D, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0xF8, 0x07,
     0xC0, 0x04, 0x00, 0x0A, 0x07, 0x0B, 0x87, 0xC3, 0xD2, 0xE0, 0xF0, 0xB4, 0x38, 0x3C, 0x0D, 0x0E,
@@ -3058,7 +3058,60 @@ static const uint8_t bookerly_12_italicBitmaps[48812] = {
     0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00,
     0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x05, 0x56, 0xE5, 0x54, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF,
     0xFF, 0xFF, 0xE0, 0x10, 0xBD, 0xFE, 0xBC, 0x04, 0x00, 0x04, 0x00, 0x05, 0x1F, 0xC0, 0x0F, 0xC0,
-    0x0B, 0xDB, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0xF4, 0x00, 0xF8, 0x00, 0x7C,
+    0x0B, 0xDB, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0x00, 0xB4, 0x07, 0xF4, 0x14, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00,
+    0x3D, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xB4, 0x00, 0xB8, 0x00, 0x00,
+    0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x0B, 0x80,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
+    0xB4, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x07, 0xF9, 0x1B, 0x80, 0x00, 0x00, 0x3F, 0xFD,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xEB, 0xF4, 0x00, 0x00, 0x0B, 0x80,
+    0x3D, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0x40, 0x0F,
+    0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0xF4,
+    0x00, 0x00, 0x2E, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0x80,
+    0x00, 0x01, 0xF0, 0x03, 0xD1, 0x00, 0x00, 0x7C, 0x00, 0xF6, 0xC0, 0x00, 0x2E, 0x00, 0x7F, 0xD0,
+    0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0x00, 0x00, 0x00, 0xB0, 0x7C, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD,
+    0x00, 0x00, 0x00, 0xBE, 0xBF, 0xD0, 0x00, 0x00, 0x2D, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x07,
+    0xC0, 0x00, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xFF, 0xD0,
+    0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00,
+    0x3D, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80,
+    0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0,
+    0x00, 0xF0, 0x40, 0x00, 0x1F, 0x00, 0x1F, 0x3C, 0x00, 0x02, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0x3D,
+    0x00, 0x1F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0x00, 0x02, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9,
+    0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xE7, 0xEB, 0xF8, 0x00, 0x00, 0x0B, 0x40, 0x7F, 0x80,
+    0x2D, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x01, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0x40, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x03, 0xC0,
+    0x03, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x3C,
+    0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x0F,
+    0x00, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0xF0, 0x03, 0xE1, 0x00,
+    0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF6, 0xC0, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x3F, 0xD0, 0x00, 0x0F,
+    0x40, 0x0B, 0x40, 0x0F, 0xD0, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xB0, 0x7F, 0x91, 0xB8, 0x00,
+    0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x05, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0xBF, 0xEE,
+    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x7E, 0xBF, 0xD0, 0x00, 0x00, 0x2D, 0x01, 0xFE, 0x00, 0x3C, 0x00,
+    0x00, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x00,
+    0x0F, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0xF4, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00,
+    0x3D, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x3C,
+    0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0xB8, 0x00,
+    0xB8, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF4,
+    0x40, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0F, 0x3C, 0x00, 0x02, 0xE0, 0x02, 0xE0, 0x01, 0xFF, 0x40,
+    0x00, 0x3D, 0x00, 0x2D, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x40, 0x00, 0x00, 0x02, 0xC1, 0xFE,
+    0x46, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x01, 0x54,
+    0x00, 0x00, 0x00, 0x00,
 };
 
 static const EpdGlyph bookerly_12_italicGlyphs[] = {
@@ -3790,6 +3843,11 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 15, 18, 25, 5, 18, 68, 48719 }, // ⊥
     { 4, 4, 16, 6, 9, 4, 48787 }, // ⋅
     { 21, 4, 25, 2, 9, 21, 48791 }, // ⋯
+    { 27, 26, 18, -5, 20, 176, 48812 }, // ﬀ
+    { 21, 26, 16, -5, 20, 137, 48988 }, // ﬁ
+    { 22, 26, 17, -5, 20, 143, 49125 }, // ﬂ
+    { 29, 26, 24, -5, 20, 189, 49268 }, // ﬃ
+    { 30, 26, 25, -5, 20, 195, 49457 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_12_italicIntervals[] = {
@@ -3853,15 +3911,638 @@ static const EpdUnicodeInterval bookerly_12_italicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_12_italicKernLeftClasses[] = {
+    { 0x28, 1 }, // (
+    { 0x2A, 2 }, // *
+    { 0x2C, 3 }, // ,
+    { 0x2D, 4 }, // -
+    { 0x2E, 3 }, // .
+    { 0x2F, 5 }, // /
+    { 0x41, 6 }, // A
+    { 0x42, 7 }, // B
+    { 0x44, 8 }, // D
+    { 0x45, 9 }, // E
+    { 0x46, 10 }, // F
+    { 0x47, 11 }, // G
+    { 0x48, 12 }, // H
+    { 0x49, 12 }, // I
+    { 0x4A, 13 }, // J
+    { 0x4B, 14 }, // K
+    { 0x4C, 15 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 17 }, // N
+    { 0x4F, 8 }, // O
+    { 0x50, 18 }, // P
+    { 0x51, 19 }, // Q
+    { 0x52, 20 }, // R
+    { 0x53, 21 }, // S
+    { 0x54, 22 }, // T
+    { 0x55, 23 }, // U
+    { 0x56, 24 }, // V
+    { 0x57, 24 }, // W
+    { 0x58, 25 }, // X
+    { 0x59, 26 }, // Y
+    { 0x5A, 27 }, // Z
+    { 0x5B, 28 }, // [
+    { 0x5C, 29 }, // <backslash>
+    { 0x61, 30 }, // a
+    { 0x62, 31 }, // b
+    { 0x63, 32 }, // c
+    { 0x65, 33 }, // e
+    { 0x66, 34 }, // f
+    { 0x67, 35 }, // g
+    { 0x68, 30 }, // h
+    { 0x6A, 36 }, // j
+    { 0x6B, 37 }, // k
+    { 0x6D, 30 }, // m
+    { 0x6E, 30 }, // n
+    { 0x6F, 31 }, // o
+    { 0x70, 31 }, // p
+    { 0x71, 38 }, // q
+    { 0x72, 39 }, // r
+    { 0x73, 32 }, // s
+    { 0x74, 32 }, // t
+    { 0x75, 30 }, // u
+    { 0x76, 40 }, // v
+    { 0x77, 40 }, // w
+    { 0x78, 41 }, // x
+    { 0x79, 40 }, // y
+    { 0x7A, 42 }, // z
+    { 0x7B, 43 }, // {
+    { 0xA1, 44 }, // ¡
+    { 0xAD, 4 }, // ­
+    { 0xBB, 45 }, // »
+    { 0xBF, 46 }, // ¿
+    { 0xC0, 6 }, // À
+    { 0xC1, 6 }, // Á
+    { 0xC2, 6 }, // Â
+    { 0xC3, 6 }, // Ã
+    { 0xC4, 6 }, // Ä
+    { 0xC5, 6 }, // Å
+    { 0xC6, 9 }, // Æ
+    { 0xC8, 9 }, // È
+    { 0xC9, 9 }, // É
+    { 0xCA, 9 }, // Ê
+    { 0xCB, 9 }, // Ë
+    { 0xCC, 12 }, // Ì
+    { 0xCD, 12 }, // Í
+    { 0xCE, 12 }, // Î
+    { 0xCF, 12 }, // Ï
+    { 0xD0, 8 }, // Ð
+    { 0xD1, 17 }, // Ñ
+    { 0xD2, 8 }, // Ò
+    { 0xD3, 8 }, // Ó
+    { 0xD4, 8 }, // Ô
+    { 0xD5, 8 }, // Õ
+    { 0xD6, 8 }, // Ö
+    { 0xD8, 8 }, // Ø
+    { 0xD9, 23 }, // Ù
+    { 0xDA, 23 }, // Ú
+    { 0xDB, 23 }, // Û
+    { 0xDC, 23 }, // Ü
+    { 0xDD, 26 }, // Ý
+    { 0xDE, 47 }, // Þ
+    { 0xDF, 48 }, // ß
+    { 0xE0, 30 }, // à
+    { 0xE1, 30 }, // á
+    { 0xE2, 30 }, // â
+    { 0xE3, 30 }, // ã
+    { 0xE4, 30 }, // ä
+    { 0xE5, 30 }, // å
+    { 0xE6, 33 }, // æ
+    { 0xE7, 49 }, // ç
+    { 0xE8, 33 }, // è
+    { 0xE9, 33 }, // é
+    { 0xEA, 33 }, // ê
+    { 0xEB, 33 }, // ë
+    { 0xEE, 50 }, // î
+    { 0xEF, 50 }, // ï
+    { 0xF0, 31 }, // ð
+    { 0xF1, 30 }, // ñ
+    { 0xF2, 31 }, // ò
+    { 0xF3, 31 }, // ó
+    { 0xF4, 31 }, // ô
+    { 0xF5, 31 }, // õ
+    { 0xF6, 31 }, // ö
+    { 0xF8, 51 }, // ø
+    { 0xF9, 30 }, // ù
+    { 0xFA, 30 }, // ú
+    { 0xFB, 30 }, // û
+    { 0xFC, 30 }, // ü
+    { 0xFD, 40 }, // ý
+    { 0xFE, 31 }, // þ
+    { 0xFF, 40 }, // ÿ
+    { 0x100, 6 }, // Ā
+    { 0x101, 30 }, // ā
+    { 0x102, 6 }, // Ă
+    { 0x103, 30 }, // ă
+    { 0x104, 52 }, // Ą
+    { 0x105, 53 }, // ą
+    { 0x107, 32 }, // ć
+    { 0x109, 32 }, // ĉ
+    { 0x10B, 32 }, // ċ
+    { 0x10D, 32 }, // č
+    { 0x10E, 8 }, // Ď
+    { 0x10F, 54 }, // ď
+    { 0x110, 8 }, // Đ
+    { 0x112, 9 }, // Ē
+    { 0x113, 33 }, // ē
+    { 0x114, 9 }, // Ĕ
+    { 0x115, 33 }, // ĕ
+    { 0x116, 9 }, // Ė
+    { 0x117, 33 }, // ė
+    { 0x118, 55 }, // Ę
+    { 0x119, 56 }, // ę
+    { 0x11A, 9 }, // Ě
+    { 0x11B, 33 }, // ě
+    { 0x11C, 11 }, // Ĝ
+    { 0x11D, 35 }, // ĝ
+    { 0x11E, 11 }, // Ğ
+    { 0x11F, 35 }, // ğ
+    { 0x120, 11 }, // Ġ
+    { 0x121, 35 }, // ġ
+    { 0x122, 11 }, // Ģ
+    { 0x123, 35 }, // ģ
+    { 0x124, 12 }, // Ĥ
+    { 0x125, 30 }, // ĥ
+    { 0x126, 12 }, // Ħ
+    { 0x127, 30 }, // ħ
+    { 0x128, 12 }, // Ĩ
+    { 0x129, 57 }, // ĩ
+    { 0x12A, 12 }, // Ī
+    { 0x12B, 50 }, // ī
+    { 0x12C, 12 }, // Ĭ
+    { 0x12D, 50 }, // ĭ
+    { 0x12E, 58 }, // Į
+    { 0x12F, 59 }, // į
+    { 0x130, 12 }, // İ
+    { 0x131, 30 }, // ı
+    { 0x132, 13 }, // Ĳ
+    { 0x133, 36 }, // ĳ
+    { 0x134, 13 }, // Ĵ
+    { 0x135, 60 }, // ĵ
+    { 0x136, 14 }, // Ķ
+    { 0x137, 37 }, // ķ
+    { 0x138, 32 }, // ĸ
+    { 0x139, 15 }, // Ĺ
+    { 0x13B, 15 }, // Ļ
+    { 0x13C, 61 }, // ļ
+    { 0x13E, 54 }, // ľ
+    { 0x141, 15 }, // Ł
+    { 0x142, 62 }, // ł
+    { 0x143, 17 }, // Ń
+    { 0x144, 30 }, // ń
+    { 0x145, 17 }, // Ņ
+    { 0x146, 30 }, // ņ
+    { 0x147, 17 }, // Ň
+    { 0x148, 30 }, // ň
+    { 0x149, 30 }, // ŉ
+    { 0x14A, 17 }, // Ŋ
+    { 0x14B, 63 }, // ŋ
+    { 0x14C, 8 }, // Ō
+    { 0x14D, 31 }, // ō
+    { 0x14E, 8 }, // Ŏ
+    { 0x14F, 31 }, // ŏ
+    { 0x150, 8 }, // Ő
+    { 0x151, 31 }, // ő
+    { 0x152, 9 }, // Œ
+    { 0x153, 33 }, // œ
+    { 0x154, 20 }, // Ŕ
+    { 0x155, 39 }, // ŕ
+    { 0x156, 20 }, // Ŗ
+    { 0x157, 39 }, // ŗ
+    { 0x158, 20 }, // Ř
+    { 0x159, 39 }, // ř
+    { 0x15A, 21 }, // Ś
+    { 0x15B, 32 }, // ś
+    { 0x15C, 21 }, // Ŝ
+    { 0x15D, 32 }, // ŝ
+    { 0x15E, 21 }, // Ş
+    { 0x15F, 49 }, // ş
+    { 0x160, 21 }, // Š
+    { 0x161, 32 }, // š
+    { 0x162, 22 }, // Ţ
+    { 0x163, 49 }, // ţ
+    { 0x164, 22 }, // Ť
+    { 0x166, 22 }, // Ŧ
+    { 0x167, 32 }, // ŧ
+    { 0x168, 23 }, // Ũ
+    { 0x169, 30 }, // ũ
+    { 0x16A, 23 }, // Ū
+    { 0x16B, 30 }, // ū
+    { 0x16C, 23 }, // Ŭ
+    { 0x16D, 30 }, // ŭ
+    { 0x16E, 23 }, // Ů
+    { 0x16F, 30 }, // ů
+    { 0x170, 23 }, // Ű
+    { 0x171, 30 }, // ű
+    { 0x172, 23 }, // Ų
+    { 0x173, 64 }, // ų
+    { 0x174, 24 }, // Ŵ
+    { 0x175, 40 }, // ŵ
+    { 0x176, 26 }, // Ŷ
+    { 0x177, 40 }, // ŷ
+    { 0x178, 26 }, // Ÿ
+    { 0x179, 27 }, // Ź
+    { 0x17A, 42 }, // ź
+    { 0x17B, 27 }, // Ż
+    { 0x17C, 42 }, // ż
+    { 0x17D, 27 }, // Ž
+    { 0x17E, 42 }, // ž
+    { 0x2010, 4 }, // ‐
+    { 0x2011, 4 }, // ‑
+    { 0x2013, 4 }, // –
+    { 0x2014, 4 }, // —
+    { 0x2015, 4 }, // ―
+    { 0x2018, 65 }, // ‘
+    { 0x2019, 66 }, // ’
+    { 0x201A, 67 }, // ‚
+    { 0x201B, 65 }, // ‛
+    { 0x201C, 65 }, // “
+    { 0x201D, 66 }, // ”
+    { 0x201E, 3 }, // „
+    { 0x2025, 3 }, // ‥
+    { 0x2026, 3 }, // …
+    { 0x203A, 45 }, // ›
+    { 0xFB00, 34 }, // ﬀ
+};
+
+static const EpdKernClassEntry bookerly_12_italicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x29, 2 }, // )
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x3F, 10 }, // ?
+    { 0x41, 11 }, // A
+    { 0x42, 12 }, // B
+    { 0x43, 13 }, // C
+    { 0x44, 12 }, // D
+    { 0x45, 14 }, // E
+    { 0x46, 14 }, // F
+    { 0x47, 13 }, // G
+    { 0x48, 14 }, // H
+    { 0x49, 14 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 14 }, // K
+    { 0x4C, 14 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 14 }, // N
+    { 0x4F, 13 }, // O
+    { 0x50, 12 }, // P
+    { 0x51, 13 }, // Q
+    { 0x52, 12 }, // R
+    { 0x53, 17 }, // S
+    { 0x54, 18 }, // T
+    { 0x55, 19 }, // U
+    { 0x56, 20 }, // V
+    { 0x57, 20 }, // W
+    { 0x58, 21 }, // X
+    { 0x59, 22 }, // Y
+    { 0x5C, 23 }, // <backslash>
+    { 0x5D, 24 }, // ]
+    { 0x61, 25 }, // a
+    { 0x62, 26 }, // b
+    { 0x63, 25 }, // c
+    { 0x64, 25 }, // d
+    { 0x65, 25 }, // e
+    { 0x66, 27 }, // f
+    { 0x67, 28 }, // g
+    { 0x68, 26 }, // h
+    { 0x69, 29 }, // i
+    { 0x6A, 30 }, // j
+    { 0x6B, 26 }, // k
+    { 0x6C, 26 }, // l
+    { 0x6D, 31 }, // m
+    { 0x6E, 31 }, // n
+    { 0x6F, 25 }, // o
+    { 0x70, 32 }, // p
+    { 0x71, 25 }, // q
+    { 0x72, 31 }, // r
+    { 0x73, 33 }, // s
+    { 0x74, 34 }, // t
+    { 0x75, 35 }, // u
+    { 0x76, 36 }, // v
+    { 0x77, 36 }, // w
+    { 0x78, 37 }, // x
+    { 0x79, 38 }, // y
+    { 0x7A, 39 }, // z
+    { 0x7D, 40 }, // }
+    { 0xAB, 41 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 42 }, // »
+    { 0xBF, 43 }, // ¿
+    { 0xC0, 11 }, // À
+    { 0xC1, 11 }, // Á
+    { 0xC2, 11 }, // Â
+    { 0xC3, 11 }, // Ã
+    { 0xC4, 11 }, // Ä
+    { 0xC5, 11 }, // Å
+    { 0xC6, 44 }, // Æ
+    { 0xC7, 13 }, // Ç
+    { 0xC8, 14 }, // È
+    { 0xC9, 14 }, // É
+    { 0xCA, 14 }, // Ê
+    { 0xCB, 14 }, // Ë
+    { 0xCC, 14 }, // Ì
+    { 0xCD, 14 }, // Í
+    { 0xCE, 14 }, // Î
+    { 0xCF, 14 }, // Ï
+    { 0xD0, 12 }, // Ð
+    { 0xD1, 14 }, // Ñ
+    { 0xD2, 13 }, // Ò
+    { 0xD3, 13 }, // Ó
+    { 0xD4, 13 }, // Ô
+    { 0xD5, 13 }, // Õ
+    { 0xD6, 13 }, // Ö
+    { 0xD8, 13 }, // Ø
+    { 0xD9, 19 }, // Ù
+    { 0xDA, 19 }, // Ú
+    { 0xDB, 19 }, // Û
+    { 0xDC, 19 }, // Ü
+    { 0xDD, 22 }, // Ý
+    { 0xDE, 14 }, // Þ
+    { 0xDF, 45 }, // ß
+    { 0xE0, 25 }, // à
+    { 0xE1, 25 }, // á
+    { 0xE2, 25 }, // â
+    { 0xE3, 25 }, // ã
+    { 0xE4, 25 }, // ä
+    { 0xE5, 25 }, // å
+    { 0xE6, 25 }, // æ
+    { 0xE7, 25 }, // ç
+    { 0xE8, 25 }, // è
+    { 0xE9, 25 }, // é
+    { 0xEA, 25 }, // ê
+    { 0xEB, 25 }, // ë
+    { 0xEC, 46 }, // ì
+    { 0xED, 29 }, // í
+    { 0xEE, 47 }, // î
+    { 0xEF, 47 }, // ï
+    { 0xF0, 25 }, // ð
+    { 0xF1, 31 }, // ñ
+    { 0xF2, 25 }, // ò
+    { 0xF3, 25 }, // ó
+    { 0xF4, 25 }, // ô
+    { 0xF5, 25 }, // õ
+    { 0xF6, 25 }, // ö
+    { 0xF8, 48 }, // ø
+    { 0xF9, 35 }, // ù
+    { 0xFA, 35 }, // ú
+    { 0xFB, 35 }, // û
+    { 0xFC, 35 }, // ü
+    { 0xFD, 36 }, // ý
+    { 0xFE, 49 }, // þ
+    { 0xFF, 36 }, // ÿ
+    { 0x100, 11 }, // Ā
+    { 0x101, 25 }, // ā
+    { 0x102, 11 }, // Ă
+    { 0x103, 25 }, // ă
+    { 0x104, 11 }, // Ą
+    { 0x105, 25 }, // ą
+    { 0x106, 13 }, // Ć
+    { 0x107, 25 }, // ć
+    { 0x108, 13 }, // Ĉ
+    { 0x109, 25 }, // ĉ
+    { 0x10A, 13 }, // Ċ
+    { 0x10B, 25 }, // ċ
+    { 0x10C, 13 }, // Č
+    { 0x10D, 50 }, // č
+    { 0x10E, 12 }, // Ď
+    { 0x10F, 25 }, // ď
+    { 0x110, 12 }, // Đ
+    { 0x111, 25 }, // đ
+    { 0x112, 14 }, // Ē
+    { 0x113, 25 }, // ē
+    { 0x114, 14 }, // Ĕ
+    { 0x115, 25 }, // ĕ
+    { 0x116, 14 }, // Ė
+    { 0x117, 25 }, // ė
+    { 0x118, 14 }, // Ę
+    { 0x119, 25 }, // ę
+    { 0x11A, 14 }, // Ě
+    { 0x11B, 25 }, // ě
+    { 0x11C, 13 }, // Ĝ
+    { 0x11D, 28 }, // ĝ
+    { 0x11E, 13 }, // Ğ
+    { 0x11F, 28 }, // ğ
+    { 0x120, 13 }, // Ġ
+    { 0x121, 28 }, // ġ
+    { 0x122, 13 }, // Ģ
+    { 0x123, 28 }, // ģ
+    { 0x124, 14 }, // Ĥ
+    { 0x125, 26 }, // ĥ
+    { 0x126, 14 }, // Ħ
+    { 0x127, 51 }, // ħ
+    { 0x128, 14 }, // Ĩ
+    { 0x129, 52 }, // ĩ
+    { 0x12A, 14 }, // Ī
+    { 0x12B, 47 }, // ī
+    { 0x12C, 14 }, // Ĭ
+    { 0x12D, 47 }, // ĭ
+    { 0x12E, 14 }, // Į
+    { 0x12F, 29 }, // į
+    { 0x130, 14 }, // İ
+    { 0x131, 31 }, // ı
+    { 0x132, 14 }, // Ĳ
+    { 0x133, 29 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 53 }, // ĵ
+    { 0x136, 14 }, // Ķ
+    { 0x137, 26 }, // ķ
+    { 0x138, 31 }, // ĸ
+    { 0x139, 14 }, // Ĺ
+    { 0x13A, 26 }, // ĺ
+    { 0x13B, 14 }, // Ļ
+    { 0x13C, 26 }, // ļ
+    { 0x13D, 14 }, // Ľ
+    { 0x13E, 26 }, // ľ
+    { 0x13F, 14 }, // Ŀ
+    { 0x140, 26 }, // ŀ
+    { 0x141, 14 }, // Ł
+    { 0x142, 26 }, // ł
+    { 0x143, 14 }, // Ń
+    { 0x144, 31 }, // ń
+    { 0x145, 14 }, // Ņ
+    { 0x146, 31 }, // ņ
+    { 0x147, 14 }, // Ň
+    { 0x148, 31 }, // ň
+    { 0x149, 31 }, // ŉ
+    { 0x14A, 14 }, // Ŋ
+    { 0x14B, 31 }, // ŋ
+    { 0x14C, 13 }, // Ō
+    { 0x14D, 25 }, // ō
+    { 0x14E, 13 }, // Ŏ
+    { 0x14F, 25 }, // ŏ
+    { 0x150, 13 }, // Ő
+    { 0x151, 25 }, // ő
+    { 0x152, 13 }, // Œ
+    { 0x153, 25 }, // œ
+    { 0x154, 12 }, // Ŕ
+    { 0x155, 31 }, // ŕ
+    { 0x156, 12 }, // Ŗ
+    { 0x157, 31 }, // ŗ
+    { 0x158, 12 }, // Ř
+    { 0x159, 31 }, // ř
+    { 0x15A, 17 }, // Ś
+    { 0x15B, 33 }, // ś
+    { 0x15C, 17 }, // Ŝ
+    { 0x15D, 33 }, // ŝ
+    { 0x15E, 17 }, // Ş
+    { 0x15F, 33 }, // ş
+    { 0x160, 17 }, // Š
+    { 0x161, 54 }, // š
+    { 0x162, 18 }, // Ţ
+    { 0x163, 34 }, // ţ
+    { 0x164, 18 }, // Ť
+    { 0x165, 34 }, // ť
+    { 0x166, 18 }, // Ŧ
+    { 0x167, 34 }, // ŧ
+    { 0x168, 19 }, // Ũ
+    { 0x169, 35 }, // ũ
+    { 0x16A, 19 }, // Ū
+    { 0x16B, 35 }, // ū
+    { 0x16C, 19 }, // Ŭ
+    { 0x16D, 35 }, // ŭ
+    { 0x16E, 19 }, // Ů
+    { 0x16F, 35 }, // ů
+    { 0x170, 19 }, // Ű
+    { 0x171, 35 }, // ű
+    { 0x172, 19 }, // Ų
+    { 0x173, 35 }, // ų
+    { 0x174, 20 }, // Ŵ
+    { 0x175, 36 }, // ŵ
+    { 0x176, 22 }, // Ŷ
+    { 0x177, 36 }, // ŷ
+    { 0x178, 22 }, // Ÿ
+    { 0x17A, 39 }, // ź
+    { 0x17C, 39 }, // ż
+    { 0x17E, 39 }, // ž
+    { 0x17F, 45 }, // ſ
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 55 }, // ‘
+    { 0x2019, 56 }, // ’
+    { 0x201A, 6 }, // ‚
+    { 0x201B, 55 }, // ‛
+    { 0x201C, 55 }, // “
+    { 0x201D, 56 }, // ”
+    { 0x201E, 6 }, // „
+    { 0x2025, 6 }, // ‥
+    { 0x2026, 6 }, // …
+    { 0x2039, 41 }, // ‹
+    { 0x203A, 42 }, // ›
+    { 0xFB00, 27 }, // ﬀ
+    { 0xFB01, 27 }, // ﬁ
+    { 0xFB02, 27 }, // ﬂ
+    { 0xFB03, 27 }, // ﬃ
+    { 0xFB04, 27 }, // ﬄ
+};
+
+static const int8_t bookerly_12_italicKernMatrix[3752] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 2, 4, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, -1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 2, 0, 0, -1, -2, -2, 1, -2, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, -2, -1, -1, 0, -1, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, -2, 0, 0, 0, -2, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, 0, -2, -2, -3, 1, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -2, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 1,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -3, -2, -2, -2, 0, -2, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 6, 0, 5, 0, -2, 0, -1, 5, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -1, -1, 6, 0, 0, 1, 2, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, -2, -1, -2, 2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, -2, 0, -2, -2, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 1, 1,
+    0, 0, 0, -2, 0, -2, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0,
+    0, 0, 1, -3, -1, -3, -2, -2, -2, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -3, 0, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -2, -1, -2, -2, -1, -1, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -2, 0, 0, 1, -2, 0, -2, 1, 1, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, -2, 2, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, -2, 0, -2, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 2, 1, 0, 1, 2,
+    0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 1, 0, 2, 1, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 2, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, -3, -2, 0, 0, 0, -2, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 2, 1, 0, 0, 0, 1,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 3, 0, 0, -2, -2, -3, 1, -2, -4, 0, 0, 0, 3, 1, 0, 3, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 3, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 3, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 3, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 3, 1, 3, 0, 0, 1, 2, 2,
+    0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 1, 0, 0, 0, 1,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 3, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    -1, 0, 0, -2, 0, -2, 0, 0, 0, 0, -3, -1, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -3, 0, 0, 0, -2, 0, -2, 0, 0, 0, -2, 0, 0,
+    -2, 0, 0, -4, 0, -4, 0, 0, 0, -1, -4, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, -2, 0, -2, -3, -1, 0, 0, 0, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -4, 0, -1, 0, -2, 0, -2, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 2, 0, 0, -1, -2, -2, 1, -2, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+};
+
+static const EpdLigaturePair bookerly_12_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_12_italic = {
     bookerly_12_italicBitmaps,
     bookerly_12_italicGlyphs,
     bookerly_12_italicIntervals,
-    60,
+    61,
     33,
     27,
     -7,
     true,
+    bookerly_12_italicKernLeftClasses,
+    253,
+    bookerly_12_italicKernRightClasses,
+    276,
+    bookerly_12_italicKernMatrix,
+    67,
+    56,
+    bookerly_12_italicLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_regularBitmaps[47071] = {
+static const uint8_t bookerly_12_regularBitmaps[47596] = {
     0x28, 0xBC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF4, 0xF4, 0xF4, 0xF4, 0xB4, 0xB4, 0x74, 0x74, 0x00, 0x00,
     0x78, 0xFD, 0xFC, 0x10, 0x28, 0x2E, 0xE1, 0xFB, 0x47, 0xED, 0x1E, 0xB4, 0x7A, 0xD1, 0xEB, 0x03,
     0x94, 0x04, 0x00, 0x0E, 0x02, 0xC0, 0x00, 0x0D, 0x03, 0x80, 0x00, 0x1D, 0x03, 0x40, 0x00, 0x2C,
@@ -2949,7 +2949,40 @@ static const uint8_t bookerly_12_regularBitmaps[47071] = {
     0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
     0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x05, 0x56, 0xE5, 0x54, 0xBF, 0xFF,
     0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xE0, 0x10, 0xBD, 0xFE, 0xBC, 0x04, 0x00, 0x04, 0x00, 0x05, 0x1F,
-    0xC0, 0x0F, 0xC0, 0x0B, 0xDB, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0xF4, 0x00, 0xF8, 0x00, 0x7C,
+    0xC0, 0x0F, 0xC0, 0x0B, 0xDB, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0xBF, 0x93, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xE6, 0xF4, 0x02,
+    0xF0, 0x0B, 0xE0, 0x18, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x00, 0x3E,
+    0x00, 0x2F, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF8,
+    0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x03, 0xE0,
+    0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80,
+    0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0x80,
+    0x7F, 0xA4, 0x00, 0xFF, 0xF8, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xF0,
+    0x00, 0x07, 0xE5, 0xBF, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x02, 0xF0, 0x00, 0x80, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xF8,
+    0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00,
+    0xF8, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xE0, 0x02, 0xF0,
+    0x00, 0xF8, 0x00, 0xBC, 0x00, 0xBF, 0x80, 0x7F, 0xA0, 0xFF, 0xF8, 0xBF, 0xFC, 0x00, 0x00, 0x55,
+    0x10, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x03, 0xF5, 0xBF, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x01, 0xF0,
+    0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x6F, 0xFF, 0x0B, 0xC0, 0x7F,
+    0xFF, 0xC2, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0,
+    0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B,
+    0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xBF, 0x80, 0x7F, 0xA0, 0xFF, 0xF8,
+    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0x92, 0xFF, 0xF8, 0x00, 0x02,
+    0xFF, 0xFF, 0xF5, 0xBF, 0x00, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xF4, 0x00,
+    0x50, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3D,
+    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x02,
+    0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40,
+    0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xBC,
+    0x00, 0x3D, 0x00, 0xBF, 0x80, 0x7F, 0x90, 0x2F, 0xE4, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x10, 0x00, 0x01, 0xBF, 0x91, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF9,
+    0x6F, 0x40, 0x02, 0xF0, 0x0B, 0xF4, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0xB8,
+    0x00, 0x7C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x6F, 0xFF, 0xFF, 0xFF, 0x43,
+    0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E, 0x00,
+    0x2F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF4,
+    0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B,
+    0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0x00,
+    0xBF, 0x80, 0x7F, 0x90, 0x2F, 0xE4, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F, 0xFE,
 };
 
 static const EpdGlyph bookerly_12_regularGlyphs[] = {
@@ -3681,6 +3714,11 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 15, 18, 25, 5, 18, 68, 46978 }, // ⊥
     { 4, 4, 16, 6, 9, 4, 47046 }, // ⋅
     { 21, 4, 25, 2, 9, 21, 47050 }, // ⋯
+    { 21, 20, 19, 0, 20, 105, 47071 }, // ﬀ
+    { 17, 20, 17, 0, 20, 85, 47176 }, // ﬁ
+    { 17, 20, 17, 0, 20, 85, 47261 }, // ﬂ
+    { 25, 20, 25, 0, 20, 125, 47346 }, // ﬃ
+    { 25, 20, 25, 0, 20, 125, 47471 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_12_regularIntervals[] = {
@@ -3744,15 +3782,641 @@ static const EpdUnicodeInterval bookerly_12_regularIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_12_regularKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x2F, 6 }, // /
+    { 0x41, 7 }, // A
+    { 0x42, 8 }, // B
+    { 0x43, 9 }, // C
+    { 0x44, 10 }, // D
+    { 0x46, 11 }, // F
+    { 0x48, 12 }, // H
+    { 0x49, 12 }, // I
+    { 0x4A, 13 }, // J
+    { 0x4B, 14 }, // K
+    { 0x4C, 15 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 17 }, // N
+    { 0x4F, 10 }, // O
+    { 0x50, 18 }, // P
+    { 0x51, 19 }, // Q
+    { 0x52, 20 }, // R
+    { 0x53, 21 }, // S
+    { 0x54, 22 }, // T
+    { 0x55, 23 }, // U
+    { 0x56, 24 }, // V
+    { 0x57, 24 }, // W
+    { 0x58, 25 }, // X
+    { 0x59, 26 }, // Y
+    { 0x5A, 27 }, // Z
+    { 0x5B, 28 }, // [
+    { 0x5C, 29 }, // <backslash>
+    { 0x61, 30 }, // a
+    { 0x62, 31 }, // b
+    { 0x63, 32 }, // c
+    { 0x64, 12 }, // d
+    { 0x65, 33 }, // e
+    { 0x66, 34 }, // f
+    { 0x67, 35 }, // g
+    { 0x68, 36 }, // h
+    { 0x69, 37 }, // i
+    { 0x6C, 38 }, // l
+    { 0x6D, 36 }, // m
+    { 0x6E, 36 }, // n
+    { 0x6F, 31 }, // o
+    { 0x70, 31 }, // p
+    { 0x71, 39 }, // q
+    { 0x72, 40 }, // r
+    { 0x73, 41 }, // s
+    { 0x74, 42 }, // t
+    { 0x75, 43 }, // u
+    { 0x76, 44 }, // v
+    { 0x77, 44 }, // w
+    { 0x78, 45 }, // x
+    { 0x79, 44 }, // y
+    { 0x7A, 42 }, // z
+    { 0x7B, 46 }, // {
+    { 0xA1, 47 }, // ¡
+    { 0xAB, 48 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 5 }, // »
+    { 0xBF, 49 }, // ¿
+    { 0xC0, 7 }, // À
+    { 0xC1, 7 }, // Á
+    { 0xC2, 7 }, // Â
+    { 0xC3, 7 }, // Ã
+    { 0xC4, 7 }, // Ä
+    { 0xC5, 7 }, // Å
+    { 0xC7, 9 }, // Ç
+    { 0xCC, 12 }, // Ì
+    { 0xCD, 12 }, // Í
+    { 0xCE, 12 }, // Î
+    { 0xCF, 12 }, // Ï
+    { 0xD0, 10 }, // Ð
+    { 0xD1, 17 }, // Ñ
+    { 0xD2, 10 }, // Ò
+    { 0xD3, 10 }, // Ó
+    { 0xD4, 10 }, // Ô
+    { 0xD5, 10 }, // Õ
+    { 0xD6, 10 }, // Ö
+    { 0xD8, 50 }, // Ø
+    { 0xD9, 23 }, // Ù
+    { 0xDA, 23 }, // Ú
+    { 0xDB, 23 }, // Û
+    { 0xDC, 23 }, // Ü
+    { 0xDD, 26 }, // Ý
+    { 0xDE, 51 }, // Þ
+    { 0xDF, 52 }, // ß
+    { 0xE0, 30 }, // à
+    { 0xE1, 30 }, // á
+    { 0xE2, 30 }, // â
+    { 0xE3, 30 }, // ã
+    { 0xE4, 30 }, // ä
+    { 0xE5, 30 }, // å
+    { 0xE6, 33 }, // æ
+    { 0xE7, 32 }, // ç
+    { 0xE8, 33 }, // è
+    { 0xE9, 33 }, // é
+    { 0xEA, 33 }, // ê
+    { 0xEB, 33 }, // ë
+    { 0xEC, 37 }, // ì
+    { 0xED, 37 }, // í
+    { 0xEE, 53 }, // î
+    { 0xEF, 53 }, // ï
+    { 0xF0, 54 }, // ð
+    { 0xF1, 36 }, // ñ
+    { 0xF2, 31 }, // ò
+    { 0xF3, 31 }, // ó
+    { 0xF4, 31 }, // ô
+    { 0xF5, 31 }, // õ
+    { 0xF6, 31 }, // ö
+    { 0xF8, 31 }, // ø
+    { 0xF9, 43 }, // ù
+    { 0xFA, 43 }, // ú
+    { 0xFB, 43 }, // û
+    { 0xFC, 43 }, // ü
+    { 0xFD, 44 }, // ý
+    { 0xFE, 31 }, // þ
+    { 0xFF, 44 }, // ÿ
+    { 0x100, 7 }, // Ā
+    { 0x101, 30 }, // ā
+    { 0x102, 7 }, // Ă
+    { 0x103, 30 }, // ă
+    { 0x104, 55 }, // Ą
+    { 0x105, 56 }, // ą
+    { 0x106, 9 }, // Ć
+    { 0x107, 32 }, // ć
+    { 0x108, 9 }, // Ĉ
+    { 0x109, 32 }, // ĉ
+    { 0x10A, 9 }, // Ċ
+    { 0x10B, 32 }, // ċ
+    { 0x10C, 9 }, // Č
+    { 0x10D, 32 }, // č
+    { 0x10E, 10 }, // Ď
+    { 0x10F, 57 }, // ď
+    { 0x110, 10 }, // Đ
+    { 0x111, 12 }, // đ
+    { 0x113, 33 }, // ē
+    { 0x115, 33 }, // ĕ
+    { 0x117, 33 }, // ė
+    { 0x118, 58 }, // Ę
+    { 0x119, 59 }, // ę
+    { 0x11B, 33 }, // ě
+    { 0x11D, 35 }, // ĝ
+    { 0x11F, 35 }, // ğ
+    { 0x121, 35 }, // ġ
+    { 0x123, 35 }, // ģ
+    { 0x124, 12 }, // Ĥ
+    { 0x125, 36 }, // ĥ
+    { 0x126, 12 }, // Ħ
+    { 0x127, 36 }, // ħ
+    { 0x128, 12 }, // Ĩ
+    { 0x129, 53 }, // ĩ
+    { 0x12A, 12 }, // Ī
+    { 0x12B, 53 }, // ī
+    { 0x12C, 12 }, // Ĭ
+    { 0x12D, 53 }, // ĭ
+    { 0x12E, 60 }, // Į
+    { 0x12F, 61 }, // į
+    { 0x130, 12 }, // İ
+    { 0x131, 37 }, // ı
+    { 0x132, 13 }, // Ĳ
+    { 0x134, 13 }, // Ĵ
+    { 0x135, 62 }, // ĵ
+    { 0x136, 14 }, // Ķ
+    { 0x139, 15 }, // Ĺ
+    { 0x13A, 38 }, // ĺ
+    { 0x13B, 15 }, // Ļ
+    { 0x13C, 38 }, // ļ
+    { 0x13E, 57 }, // ľ
+    { 0x141, 15 }, // Ł
+    { 0x142, 63 }, // ł
+    { 0x143, 17 }, // Ń
+    { 0x144, 36 }, // ń
+    { 0x145, 17 }, // Ņ
+    { 0x146, 36 }, // ņ
+    { 0x147, 17 }, // Ň
+    { 0x148, 36 }, // ň
+    { 0x149, 36 }, // ŉ
+    { 0x14A, 17 }, // Ŋ
+    { 0x14B, 36 }, // ŋ
+    { 0x14C, 10 }, // Ō
+    { 0x14D, 31 }, // ō
+    { 0x14E, 10 }, // Ŏ
+    { 0x14F, 31 }, // ŏ
+    { 0x150, 10 }, // Ő
+    { 0x151, 31 }, // ő
+    { 0x153, 33 }, // œ
+    { 0x154, 20 }, // Ŕ
+    { 0x155, 40 }, // ŕ
+    { 0x156, 20 }, // Ŗ
+    { 0x157, 40 }, // ŗ
+    { 0x158, 20 }, // Ř
+    { 0x159, 40 }, // ř
+    { 0x15A, 21 }, // Ś
+    { 0x15B, 41 }, // ś
+    { 0x15C, 21 }, // Ŝ
+    { 0x15D, 41 }, // ŝ
+    { 0x15E, 21 }, // Ş
+    { 0x15F, 41 }, // ş
+    { 0x160, 21 }, // Š
+    { 0x161, 41 }, // š
+    { 0x162, 22 }, // Ţ
+    { 0x163, 42 }, // ţ
+    { 0x164, 22 }, // Ť
+    { 0x166, 22 }, // Ŧ
+    { 0x167, 42 }, // ŧ
+    { 0x168, 23 }, // Ũ
+    { 0x169, 43 }, // ũ
+    { 0x16A, 23 }, // Ū
+    { 0x16B, 43 }, // ū
+    { 0x16C, 23 }, // Ŭ
+    { 0x16D, 43 }, // ŭ
+    { 0x16E, 23 }, // Ů
+    { 0x16F, 43 }, // ů
+    { 0x170, 23 }, // Ű
+    { 0x171, 43 }, // ű
+    { 0x172, 23 }, // Ų
+    { 0x173, 64 }, // ų
+    { 0x174, 24 }, // Ŵ
+    { 0x175, 44 }, // ŵ
+    { 0x176, 26 }, // Ŷ
+    { 0x177, 44 }, // ŷ
+    { 0x178, 26 }, // Ÿ
+    { 0x179, 27 }, // Ź
+    { 0x17A, 42 }, // ź
+    { 0x17B, 27 }, // Ż
+    { 0x17C, 42 }, // ż
+    { 0x17D, 27 }, // Ž
+    { 0x17E, 42 }, // ž
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 65 }, // ‘
+    { 0x2019, 66 }, // ’
+    { 0x201A, 4 }, // ‚
+    { 0x201B, 65 }, // ‛
+    { 0x201C, 65 }, // “
+    { 0x201D, 66 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x201F, 65 }, // ‟
+    { 0x2025, 4 }, // ‥
+    { 0x2026, 4 }, // …
+    { 0x2039, 48 }, // ‹
+    { 0x203A, 5 }, // ›
+    { 0xFB00, 34 }, // ﬀ
+    { 0xFB01, 37 }, // ﬁ
+    { 0xFB02, 38 }, // ﬂ
+    { 0xFB03, 37 }, // ﬃ
+    { 0xFB04, 38 }, // ﬄ
+};
+
+static const EpdKernClassEntry bookerly_12_regularKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x27, 2 }, // '
+    { 0x29, 3 }, // )
+    { 0x2A, 4 }, // *
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 7 }, // .
+    { 0x2F, 8 }, // /
+    { 0x3A, 9 }, // :
+    { 0x3B, 10 }, // ;
+    { 0x3F, 11 }, // ?
+    { 0x41, 12 }, // A
+    { 0x42, 13 }, // B
+    { 0x43, 14 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 13 }, // E
+    { 0x46, 13 }, // F
+    { 0x47, 14 }, // G
+    { 0x48, 13 }, // H
+    { 0x49, 13 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 13 }, // K
+    { 0x4C, 13 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 13 }, // N
+    { 0x4F, 14 }, // O
+    { 0x50, 13 }, // P
+    { 0x51, 14 }, // Q
+    { 0x52, 13 }, // R
+    { 0x53, 17 }, // S
+    { 0x54, 18 }, // T
+    { 0x55, 19 }, // U
+    { 0x56, 20 }, // V
+    { 0x57, 20 }, // W
+    { 0x58, 21 }, // X
+    { 0x59, 22 }, // Y
+    { 0x5C, 23 }, // <backslash>
+    { 0x5D, 24 }, // ]
+    { 0x61, 25 }, // a
+    { 0x62, 26 }, // b
+    { 0x63, 27 }, // c
+    { 0x64, 27 }, // d
+    { 0x65, 27 }, // e
+    { 0x66, 28 }, // f
+    { 0x67, 29 }, // g
+    { 0x68, 26 }, // h
+    { 0x69, 30 }, // i
+    { 0x6A, 31 }, // j
+    { 0x6B, 26 }, // k
+    { 0x6C, 26 }, // l
+    { 0x6D, 32 }, // m
+    { 0x6E, 32 }, // n
+    { 0x6F, 27 }, // o
+    { 0x70, 33 }, // p
+    { 0x71, 27 }, // q
+    { 0x72, 32 }, // r
+    { 0x73, 34 }, // s
+    { 0x74, 35 }, // t
+    { 0x75, 36 }, // u
+    { 0x76, 37 }, // v
+    { 0x77, 37 }, // w
+    { 0x78, 38 }, // x
+    { 0x79, 39 }, // y
+    { 0x7A, 40 }, // z
+    { 0x7D, 41 }, // }
+    { 0xAB, 42 }, // «
+    { 0xAD, 6 }, // ­
+    { 0xBB, 43 }, // »
+    { 0xBF, 44 }, // ¿
+    { 0xC0, 12 }, // À
+    { 0xC1, 12 }, // Á
+    { 0xC2, 12 }, // Â
+    { 0xC3, 12 }, // Ã
+    { 0xC4, 12 }, // Ä
+    { 0xC5, 12 }, // Å
+    { 0xC6, 45 }, // Æ
+    { 0xC7, 14 }, // Ç
+    { 0xC8, 13 }, // È
+    { 0xC9, 13 }, // É
+    { 0xCA, 13 }, // Ê
+    { 0xCB, 13 }, // Ë
+    { 0xCC, 13 }, // Ì
+    { 0xCD, 13 }, // Í
+    { 0xCE, 13 }, // Î
+    { 0xCF, 13 }, // Ï
+    { 0xD0, 13 }, // Ð
+    { 0xD1, 13 }, // Ñ
+    { 0xD2, 14 }, // Ò
+    { 0xD3, 14 }, // Ó
+    { 0xD4, 14 }, // Ô
+    { 0xD5, 14 }, // Õ
+    { 0xD6, 14 }, // Ö
+    { 0xD8, 46 }, // Ø
+    { 0xD9, 19 }, // Ù
+    { 0xDA, 19 }, // Ú
+    { 0xDB, 19 }, // Û
+    { 0xDC, 19 }, // Ü
+    { 0xDD, 22 }, // Ý
+    { 0xDE, 13 }, // Þ
+    { 0xDF, 47 }, // ß
+    { 0xE0, 25 }, // à
+    { 0xE1, 25 }, // á
+    { 0xE2, 25 }, // â
+    { 0xE3, 48 }, // ã
+    { 0xE4, 49 }, // ä
+    { 0xE5, 25 }, // å
+    { 0xE6, 25 }, // æ
+    { 0xE7, 27 }, // ç
+    { 0xE8, 27 }, // è
+    { 0xE9, 27 }, // é
+    { 0xEA, 27 }, // ê
+    { 0xEB, 50 }, // ë
+    { 0xEC, 51 }, // ì
+    { 0xED, 30 }, // í
+    { 0xEE, 52 }, // î
+    { 0xEF, 53 }, // ï
+    { 0xF0, 27 }, // ð
+    { 0xF1, 32 }, // ñ
+    { 0xF2, 27 }, // ò
+    { 0xF3, 27 }, // ó
+    { 0xF4, 27 }, // ô
+    { 0xF5, 27 }, // õ
+    { 0xF6, 27 }, // ö
+    { 0xF8, 27 }, // ø
+    { 0xF9, 36 }, // ù
+    { 0xFA, 36 }, // ú
+    { 0xFB, 36 }, // û
+    { 0xFC, 36 }, // ü
+    { 0xFD, 39 }, // ý
+    { 0xFE, 26 }, // þ
+    { 0xFF, 39 }, // ÿ
+    { 0x100, 12 }, // Ā
+    { 0x101, 54 }, // ā
+    { 0x102, 12 }, // Ă
+    { 0x103, 55 }, // ă
+    { 0x104, 12 }, // Ą
+    { 0x105, 25 }, // ą
+    { 0x106, 14 }, // Ć
+    { 0x107, 27 }, // ć
+    { 0x108, 14 }, // Ĉ
+    { 0x109, 27 }, // ĉ
+    { 0x10A, 14 }, // Ċ
+    { 0x10B, 27 }, // ċ
+    { 0x10C, 14 }, // Č
+    { 0x10D, 27 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 27 }, // ď
+    { 0x110, 13 }, // Đ
+    { 0x111, 27 }, // đ
+    { 0x112, 13 }, // Ē
+    { 0x113, 27 }, // ē
+    { 0x114, 13 }, // Ĕ
+    { 0x115, 27 }, // ĕ
+    { 0x116, 13 }, // Ė
+    { 0x117, 27 }, // ė
+    { 0x118, 13 }, // Ę
+    { 0x119, 27 }, // ę
+    { 0x11A, 13 }, // Ě
+    { 0x11B, 27 }, // ě
+    { 0x11C, 14 }, // Ĝ
+    { 0x11D, 29 }, // ĝ
+    { 0x11E, 14 }, // Ğ
+    { 0x11F, 29 }, // ğ
+    { 0x120, 14 }, // Ġ
+    { 0x121, 29 }, // ġ
+    { 0x122, 14 }, // Ģ
+    { 0x123, 29 }, // ģ
+    { 0x124, 13 }, // Ĥ
+    { 0x125, 26 }, // ĥ
+    { 0x126, 13 }, // Ħ
+    { 0x127, 56 }, // ħ
+    { 0x128, 13 }, // Ĩ
+    { 0x129, 53 }, // ĩ
+    { 0x12A, 13 }, // Ī
+    { 0x12B, 53 }, // ī
+    { 0x12C, 13 }, // Ĭ
+    { 0x12D, 53 }, // ĭ
+    { 0x12E, 13 }, // Į
+    { 0x12F, 30 }, // į
+    { 0x130, 13 }, // İ
+    { 0x131, 30 }, // ı
+    { 0x132, 13 }, // Ĳ
+    { 0x133, 30 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 57 }, // ĵ
+    { 0x136, 13 }, // Ķ
+    { 0x137, 26 }, // ķ
+    { 0x138, 32 }, // ĸ
+    { 0x139, 13 }, // Ĺ
+    { 0x13A, 26 }, // ĺ
+    { 0x13B, 13 }, // Ļ
+    { 0x13C, 26 }, // ļ
+    { 0x13D, 13 }, // Ľ
+    { 0x13E, 26 }, // ľ
+    { 0x13F, 13 }, // Ŀ
+    { 0x140, 26 }, // ŀ
+    { 0x141, 13 }, // Ł
+    { 0x142, 58 }, // ł
+    { 0x143, 13 }, // Ń
+    { 0x144, 32 }, // ń
+    { 0x145, 13 }, // Ņ
+    { 0x146, 32 }, // ņ
+    { 0x147, 13 }, // Ň
+    { 0x148, 32 }, // ň
+    { 0x149, 32 }, // ŉ
+    { 0x14A, 13 }, // Ŋ
+    { 0x14B, 32 }, // ŋ
+    { 0x14C, 14 }, // Ō
+    { 0x14D, 27 }, // ō
+    { 0x14E, 14 }, // Ŏ
+    { 0x14F, 27 }, // ŏ
+    { 0x150, 14 }, // Ő
+    { 0x151, 27 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x153, 27 }, // œ
+    { 0x154, 13 }, // Ŕ
+    { 0x155, 32 }, // ŕ
+    { 0x156, 13 }, // Ŗ
+    { 0x157, 32 }, // ŗ
+    { 0x158, 13 }, // Ř
+    { 0x159, 59 }, // ř
+    { 0x15A, 17 }, // Ś
+    { 0x15B, 34 }, // ś
+    { 0x15C, 17 }, // Ŝ
+    { 0x15D, 34 }, // ŝ
+    { 0x15E, 17 }, // Ş
+    { 0x15F, 34 }, // ş
+    { 0x160, 17 }, // Š
+    { 0x161, 60 }, // š
+    { 0x162, 18 }, // Ţ
+    { 0x163, 35 }, // ţ
+    { 0x164, 18 }, // Ť
+    { 0x165, 35 }, // ť
+    { 0x166, 18 }, // Ŧ
+    { 0x167, 35 }, // ŧ
+    { 0x168, 19 }, // Ũ
+    { 0x169, 36 }, // ũ
+    { 0x16A, 19 }, // Ū
+    { 0x16B, 36 }, // ū
+    { 0x16C, 19 }, // Ŭ
+    { 0x16D, 36 }, // ŭ
+    { 0x16E, 19 }, // Ů
+    { 0x16F, 36 }, // ů
+    { 0x170, 19 }, // Ű
+    { 0x171, 36 }, // ű
+    { 0x172, 19 }, // Ų
+    { 0x173, 36 }, // ų
+    { 0x174, 20 }, // Ŵ
+    { 0x175, 37 }, // ŵ
+    { 0x176, 22 }, // Ŷ
+    { 0x177, 39 }, // ŷ
+    { 0x178, 22 }, // Ÿ
+    { 0x17A, 40 }, // ź
+    { 0x17C, 40 }, // ż
+    { 0x17E, 61 }, // ž
+    { 0x17F, 47 }, // ſ
+    { 0x2010, 6 }, // ‐
+    { 0x2011, 6 }, // ‑
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 62 }, // ‘
+    { 0x2019, 63 }, // ’
+    { 0x201A, 7 }, // ‚
+    { 0x201B, 62 }, // ‛
+    { 0x201C, 62 }, // “
+    { 0x201D, 63 }, // ”
+    { 0x201E, 7 }, // „
+    { 0x201F, 62 }, // ‟
+    { 0x2025, 7 }, // ‥
+    { 0x2026, 7 }, // …
+    { 0x2039, 42 }, // ‹
+    { 0x203A, 43 }, // ›
+    { 0xFB00, 28 }, // ﬀ
+    { 0xFB01, 28 }, // ﬁ
+    { 0xFB02, 28 }, // ﬂ
+    { 0xFB03, 28 }, // ﬃ
+    { 0xFB04, 28 }, // ﬄ
+};
+
+static const int8_t bookerly_12_regularKernMatrix[4158] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, -1, -1, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -4, -1, 0, -2, -2, -2, 0, 1, 1, -2, -2, 0, 0, 0, -1, -2, -1, 0, 0,
+    0, -1, 0, -2, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -2, -2, -3, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, -2, 0, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, -1, 0, 0, 1, 1, -1, -1, 0, 1, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 1, 1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 1, 1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 1, -2, 0, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+    0, 0, 1, 0, 1, 0, -1, -1, 0, 1, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 1, 0, -1, -1, -2, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -1, -2, -3, -1, -1, 0, -3, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, -1, -2, 0, 1, 1, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 1, -2, -1, -2, -3, 0, 0, 0, -3, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, -2, 1, -2, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -4, -1, 0, -1, -1, -2, 0, 2, 2, -1, -2, 1, 2, 1, -1, -2, -1, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -1, -2, -3, -1, -1, 0, -3, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, -2, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -3, -1, 0, -2, -1, -2, 0, 1, 2, -1, -1, 0, 1, 0, -1, -2, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    2, 3, 2, 2, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 1, 0, 2, 2, 0, 1, 1, 1, 2, 2,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 1, 0, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, -1, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0,
+    0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -2, 0, -2, -2, 0, 0, 0, -2, -1, 0, -1, -1, 0, -1, -1, -2, -2, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0,
+    0, -1, 0, -2, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -2, -2, -3, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, -2,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, -1,
+    1, 0, 2, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 3, 0, 1, 0, 1, 2, 0, 0, 0, 1, 1, 1, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 3, 2, 3, 1, 1, 1, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 1, 0, 0, -2, 0, 0, 0,
+};
+
+static const EpdLigaturePair bookerly_12_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_12_regular = {
     bookerly_12_regularBitmaps,
     bookerly_12_regularGlyphs,
     bookerly_12_regularIntervals,
-    60,
+    61,
     33,
     27,
     -7,
     true,
+    bookerly_12_regularKernLeftClasses,
+    254,
+    bookerly_12_regularKernRightClasses,
+    279,
+    bookerly_12_regularKernMatrix,
+    66,
+    63,
+    bookerly_12_regularLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_boldBitmaps[67020] = {
+static const uint8_t bookerly_14_boldBitmaps[67740] = {
     0x1A, 0x4B, 0xF8, 0xFF, 0x8F, 0xF4, 0xFF, 0x4F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xBF,
     0x0B, 0xF0, 0x7F, 0x07, 0xF0, 0x3F, 0x03, 0xF0, 0x10, 0x00, 0x00, 0x2F, 0x4B, 0xFC, 0xBF, 0xC7,
     0xFC, 0x15, 0x00, 0x2F, 0x42, 0xE7, 0xF4, 0xFF, 0xBF, 0x0F, 0xEB, 0xF0, 0xFE, 0xBF, 0x0F, 0xEB,
@@ -4196,7 +4196,52 @@ static const uint8_t bookerly_14_boldBitmaps[67020] = {
     0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x03, 0xFC,
     0xBF, 0xEB, 0xFE, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x04, 0x0F, 0xF0, 0x02, 0xFE,
     0x00, 0x3F, 0xDB, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFE, 0x7F,
-    0xC0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0xA4, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0xFF, 0xEB, 0xFF, 0xF6, 0xFF, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x0F, 0x40, 0x3F, 0xC0, 0x07, 0xF8,
+    0x00, 0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x06, 0xBF, 0xFA, 0xAB, 0xFF, 0xA9,
+    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80,
+    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00,
+    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x03,
+    0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x0B,
+    0xFF, 0xF4, 0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFD, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1A, 0xA4,
+    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xE5, 0xBF, 0xF0,
+    0x00, 0xBF, 0x80, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x0B, 0x80, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02,
+    0xFE, 0x00, 0x01, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x6B, 0xFF,
+    0xAA, 0xBF, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
+    0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
+    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
+    0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x2F, 0xFF, 0xD1, 0xFF, 0xFE, 0x3F, 0xFF, 0xD2, 0xFF, 0xFE, 0x00,
+    0x00, 0x1A, 0xA5, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
+    0xF5, 0xBF, 0xE0, 0x00, 0xBF, 0x80, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00,
+    0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xF8, 0x3F, 0xE0, 0xBF, 0xFF, 0xF8, 0x3F,
+    0xE0, 0x6B, 0xFF, 0xA0, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
+    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
+    0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE,
+    0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x2F, 0xFF, 0xD1, 0xFF, 0xFE, 0x3F, 0xFF, 0xD2,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x82, 0xFF, 0xFF,
+    0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xAF, 0xFF, 0xE5, 0xBF, 0xE0,
+    0x00, 0xBF, 0x80, 0x1F, 0xF8, 0x01, 0xFD, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x0B, 0x40, 0x01,
+    0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x01, 0x40, 0x2F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x6B, 0xFF, 0xAA,
+    0xBF, 0xFA, 0xAB, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x3F,
+    0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
+    0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
+    0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD,
+    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFE, 0x42,
+    0xFF, 0xFD, 0x3F, 0xFF, 0xC1, 0xFF, 0xFE, 0x3F, 0xFF, 0xD3, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xAA, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0x83, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xAF, 0xFF, 0xE5, 0xBF, 0xD0, 0x00, 0xBF, 0x80,
+    0x1F, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x2F,
+    0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x83, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xD0, 0x6B, 0xFF, 0xAA, 0xBF, 0xFA, 0x03,
+    0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD,
+    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00,
+    0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x3F,
+    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xE0,
+    0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xFE, 0x42, 0xFF, 0xFD, 0x3F,
+    0xFF, 0xC1, 0xFF, 0xFE, 0x3F, 0xFF, 0xD3, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0,
 };
 
 static const EpdGlyph bookerly_14_boldGlyphs[] = {
@@ -4928,6 +4973,11 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 17, 21, 29, 6, 21, 90, 66883 }, // ⊥
     { 6, 6, 18, 6, 11, 9, 66973 }, // ⋅
     { 25, 6, 29, 2, 11, 38, 66982 }, // ⋯
+    { 25, 23, 22, 0, 23, 144, 67020 }, // ﬀ
+    { 20, 23, 20, 0, 23, 115, 67164 }, // ﬁ
+    { 20, 23, 20, 0, 23, 115, 67279 }, // ﬂ
+    { 30, 23, 30, 0, 23, 173, 67394 }, // ﬃ
+    { 30, 23, 30, 0, 23, 173, 67567 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
@@ -4991,15 +5041,675 @@ static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_14_boldKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x2F, 6 }, // /
+    { 0x40, 7 }, // @
+    { 0x41, 8 }, // A
+    { 0x42, 9 }, // B
+    { 0x43, 10 }, // C
+    { 0x44, 11 }, // D
+    { 0x45, 12 }, // E
+    { 0x46, 13 }, // F
+    { 0x47, 14 }, // G
+    { 0x48, 15 }, // H
+    { 0x49, 15 }, // I
+    { 0x4A, 16 }, // J
+    { 0x4B, 17 }, // K
+    { 0x4C, 18 }, // L
+    { 0x4D, 19 }, // M
+    { 0x4E, 20 }, // N
+    { 0x4F, 11 }, // O
+    { 0x50, 21 }, // P
+    { 0x51, 22 }, // Q
+    { 0x52, 23 }, // R
+    { 0x53, 24 }, // S
+    { 0x54, 25 }, // T
+    { 0x55, 26 }, // U
+    { 0x56, 27 }, // V
+    { 0x57, 27 }, // W
+    { 0x58, 28 }, // X
+    { 0x59, 29 }, // Y
+    { 0x5A, 30 }, // Z
+    { 0x5B, 31 }, // [
+    { 0x5C, 32 }, // <backslash>
+    { 0x61, 33 }, // a
+    { 0x62, 34 }, // b
+    { 0x63, 35 }, // c
+    { 0x64, 36 }, // d
+    { 0x65, 37 }, // e
+    { 0x66, 38 }, // f
+    { 0x67, 39 }, // g
+    { 0x68, 40 }, // h
+    { 0x69, 36 }, // i
+    { 0x6A, 41 }, // j
+    { 0x6B, 42 }, // k
+    { 0x6C, 43 }, // l
+    { 0x6D, 40 }, // m
+    { 0x6E, 40 }, // n
+    { 0x6F, 34 }, // o
+    { 0x70, 34 }, // p
+    { 0x71, 44 }, // q
+    { 0x72, 45 }, // r
+    { 0x73, 46 }, // s
+    { 0x74, 47 }, // t
+    { 0x75, 48 }, // u
+    { 0x76, 49 }, // v
+    { 0x77, 49 }, // w
+    { 0x78, 50 }, // x
+    { 0x79, 49 }, // y
+    { 0x7A, 51 }, // z
+    { 0x7B, 52 }, // {
+    { 0xA1, 53 }, // ¡
+    { 0xAB, 54 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 55 }, // »
+    { 0xBF, 56 }, // ¿
+    { 0xC0, 8 }, // À
+    { 0xC1, 8 }, // Á
+    { 0xC2, 8 }, // Â
+    { 0xC3, 8 }, // Ã
+    { 0xC4, 8 }, // Ä
+    { 0xC5, 8 }, // Å
+    { 0xC6, 12 }, // Æ
+    { 0xC7, 10 }, // Ç
+    { 0xC8, 12 }, // È
+    { 0xC9, 12 }, // É
+    { 0xCA, 12 }, // Ê
+    { 0xCB, 12 }, // Ë
+    { 0xCC, 15 }, // Ì
+    { 0xCD, 15 }, // Í
+    { 0xCE, 15 }, // Î
+    { 0xCF, 15 }, // Ï
+    { 0xD0, 11 }, // Ð
+    { 0xD1, 20 }, // Ñ
+    { 0xD2, 11 }, // Ò
+    { 0xD3, 11 }, // Ó
+    { 0xD4, 11 }, // Ô
+    { 0xD5, 11 }, // Õ
+    { 0xD6, 11 }, // Ö
+    { 0xD8, 57 }, // Ø
+    { 0xD9, 26 }, // Ù
+    { 0xDA, 26 }, // Ú
+    { 0xDB, 26 }, // Û
+    { 0xDC, 26 }, // Ü
+    { 0xDD, 29 }, // Ý
+    { 0xDE, 58 }, // Þ
+    { 0xDF, 59 }, // ß
+    { 0xE0, 33 }, // à
+    { 0xE1, 33 }, // á
+    { 0xE2, 33 }, // â
+    { 0xE3, 33 }, // ã
+    { 0xE4, 33 }, // ä
+    { 0xE5, 33 }, // å
+    { 0xE6, 37 }, // æ
+    { 0xE7, 35 }, // ç
+    { 0xE8, 37 }, // è
+    { 0xE9, 37 }, // é
+    { 0xEA, 37 }, // ê
+    { 0xEB, 37 }, // ë
+    { 0xEC, 36 }, // ì
+    { 0xED, 36 }, // í
+    { 0xEE, 60 }, // î
+    { 0xEF, 60 }, // ï
+    { 0xF0, 34 }, // ð
+    { 0xF1, 40 }, // ñ
+    { 0xF2, 34 }, // ò
+    { 0xF3, 34 }, // ó
+    { 0xF4, 34 }, // ô
+    { 0xF5, 34 }, // õ
+    { 0xF6, 34 }, // ö
+    { 0xF8, 34 }, // ø
+    { 0xF9, 48 }, // ù
+    { 0xFA, 48 }, // ú
+    { 0xFB, 48 }, // û
+    { 0xFC, 48 }, // ü
+    { 0xFD, 49 }, // ý
+    { 0xFE, 34 }, // þ
+    { 0xFF, 49 }, // ÿ
+    { 0x100, 8 }, // Ā
+    { 0x101, 33 }, // ā
+    { 0x102, 8 }, // Ă
+    { 0x103, 33 }, // ă
+    { 0x104, 61 }, // Ą
+    { 0x105, 62 }, // ą
+    { 0x106, 10 }, // Ć
+    { 0x107, 35 }, // ć
+    { 0x108, 10 }, // Ĉ
+    { 0x109, 35 }, // ĉ
+    { 0x10A, 10 }, // Ċ
+    { 0x10B, 35 }, // ċ
+    { 0x10C, 10 }, // Č
+    { 0x10D, 35 }, // č
+    { 0x10E, 11 }, // Ď
+    { 0x10F, 63 }, // ď
+    { 0x110, 11 }, // Đ
+    { 0x111, 64 }, // đ
+    { 0x112, 12 }, // Ē
+    { 0x113, 37 }, // ē
+    { 0x114, 12 }, // Ĕ
+    { 0x115, 37 }, // ĕ
+    { 0x116, 12 }, // Ė
+    { 0x117, 37 }, // ė
+    { 0x118, 65 }, // Ę
+    { 0x119, 66 }, // ę
+    { 0x11A, 12 }, // Ě
+    { 0x11B, 37 }, // ě
+    { 0x11C, 14 }, // Ĝ
+    { 0x11D, 39 }, // ĝ
+    { 0x11E, 14 }, // Ğ
+    { 0x11F, 39 }, // ğ
+    { 0x120, 14 }, // Ġ
+    { 0x121, 39 }, // ġ
+    { 0x122, 14 }, // Ģ
+    { 0x123, 39 }, // ģ
+    { 0x124, 15 }, // Ĥ
+    { 0x125, 40 }, // ĥ
+    { 0x126, 15 }, // Ħ
+    { 0x127, 40 }, // ħ
+    { 0x128, 15 }, // Ĩ
+    { 0x129, 60 }, // ĩ
+    { 0x12A, 15 }, // Ī
+    { 0x12B, 60 }, // ī
+    { 0x12C, 15 }, // Ĭ
+    { 0x12D, 60 }, // ĭ
+    { 0x12E, 15 }, // Į
+    { 0x12F, 67 }, // į
+    { 0x130, 15 }, // İ
+    { 0x131, 36 }, // ı
+    { 0x132, 16 }, // Ĳ
+    { 0x133, 41 }, // ĳ
+    { 0x134, 16 }, // Ĵ
+    { 0x135, 68 }, // ĵ
+    { 0x136, 17 }, // Ķ
+    { 0x137, 42 }, // ķ
+    { 0x138, 42 }, // ĸ
+    { 0x139, 18 }, // Ĺ
+    { 0x13A, 43 }, // ĺ
+    { 0x13B, 18 }, // Ļ
+    { 0x13C, 43 }, // ļ
+    { 0x13E, 63 }, // ľ
+    { 0x141, 18 }, // Ł
+    { 0x142, 69 }, // ł
+    { 0x143, 20 }, // Ń
+    { 0x144, 40 }, // ń
+    { 0x145, 20 }, // Ņ
+    { 0x146, 40 }, // ņ
+    { 0x147, 20 }, // Ň
+    { 0x148, 40 }, // ň
+    { 0x149, 40 }, // ŉ
+    { 0x14A, 20 }, // Ŋ
+    { 0x14B, 40 }, // ŋ
+    { 0x14C, 11 }, // Ō
+    { 0x14D, 34 }, // ō
+    { 0x14E, 11 }, // Ŏ
+    { 0x14F, 34 }, // ŏ
+    { 0x150, 11 }, // Ő
+    { 0x151, 34 }, // ő
+    { 0x152, 12 }, // Œ
+    { 0x153, 37 }, // œ
+    { 0x154, 23 }, // Ŕ
+    { 0x155, 45 }, // ŕ
+    { 0x156, 23 }, // Ŗ
+    { 0x157, 45 }, // ŗ
+    { 0x158, 23 }, // Ř
+    { 0x159, 45 }, // ř
+    { 0x15A, 24 }, // Ś
+    { 0x15B, 46 }, // ś
+    { 0x15C, 24 }, // Ŝ
+    { 0x15D, 46 }, // ŝ
+    { 0x15E, 24 }, // Ş
+    { 0x15F, 46 }, // ş
+    { 0x160, 24 }, // Š
+    { 0x161, 46 }, // š
+    { 0x162, 25 }, // Ţ
+    { 0x163, 47 }, // ţ
+    { 0x164, 25 }, // Ť
+    { 0x165, 70 }, // ť
+    { 0x166, 25 }, // Ŧ
+    { 0x167, 47 }, // ŧ
+    { 0x168, 26 }, // Ũ
+    { 0x169, 48 }, // ũ
+    { 0x16A, 26 }, // Ū
+    { 0x16B, 48 }, // ū
+    { 0x16C, 26 }, // Ŭ
+    { 0x16D, 48 }, // ŭ
+    { 0x16E, 26 }, // Ů
+    { 0x16F, 48 }, // ů
+    { 0x170, 26 }, // Ű
+    { 0x171, 48 }, // ű
+    { 0x172, 26 }, // Ų
+    { 0x173, 71 }, // ų
+    { 0x174, 27 }, // Ŵ
+    { 0x175, 49 }, // ŵ
+    { 0x176, 29 }, // Ŷ
+    { 0x177, 49 }, // ŷ
+    { 0x178, 29 }, // Ÿ
+    { 0x179, 30 }, // Ź
+    { 0x17A, 51 }, // ź
+    { 0x17B, 30 }, // Ż
+    { 0x17C, 51 }, // ż
+    { 0x17D, 30 }, // Ž
+    { 0x17E, 51 }, // ž
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 72 }, // ‘
+    { 0x2019, 73 }, // ’
+    { 0x201A, 74 }, // ‚
+    { 0x201B, 72 }, // ‛
+    { 0x201C, 72 }, // “
+    { 0x201D, 73 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x201F, 72 }, // ‟
+    { 0x2025, 4 }, // ‥
+    { 0x2026, 4 }, // …
+    { 0x2039, 54 }, // ‹
+    { 0x203A, 55 }, // ›
+    { 0xFB00, 38 }, // ﬀ
+    { 0xFB01, 36 }, // ﬁ
+    { 0xFB02, 43 }, // ﬂ
+    { 0xFB03, 36 }, // ﬃ
+    { 0xFB04, 43 }, // ﬄ
+};
+
+static const EpdKernClassEntry bookerly_14_boldKernRightClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x29, 2 }, // )
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x3F, 10 }, // ?
+    { 0x41, 11 }, // A
+    { 0x42, 12 }, // B
+    { 0x43, 13 }, // C
+    { 0x44, 12 }, // D
+    { 0x45, 12 }, // E
+    { 0x46, 12 }, // F
+    { 0x47, 13 }, // G
+    { 0x48, 12 }, // H
+    { 0x49, 12 }, // I
+    { 0x4A, 14 }, // J
+    { 0x4B, 12 }, // K
+    { 0x4C, 12 }, // L
+    { 0x4D, 15 }, // M
+    { 0x4E, 12 }, // N
+    { 0x4F, 13 }, // O
+    { 0x50, 12 }, // P
+    { 0x51, 13 }, // Q
+    { 0x52, 12 }, // R
+    { 0x53, 16 }, // S
+    { 0x54, 17 }, // T
+    { 0x55, 18 }, // U
+    { 0x56, 19 }, // V
+    { 0x57, 19 }, // W
+    { 0x58, 20 }, // X
+    { 0x59, 21 }, // Y
+    { 0x5A, 22 }, // Z
+    { 0x5C, 23 }, // <backslash>
+    { 0x5D, 24 }, // ]
+    { 0x61, 25 }, // a
+    { 0x62, 26 }, // b
+    { 0x63, 27 }, // c
+    { 0x64, 27 }, // d
+    { 0x65, 27 }, // e
+    { 0x66, 28 }, // f
+    { 0x67, 29 }, // g
+    { 0x68, 30 }, // h
+    { 0x69, 31 }, // i
+    { 0x6A, 32 }, // j
+    { 0x6B, 30 }, // k
+    { 0x6C, 30 }, // l
+    { 0x6D, 33 }, // m
+    { 0x6E, 33 }, // n
+    { 0x6F, 27 }, // o
+    { 0x70, 34 }, // p
+    { 0x71, 27 }, // q
+    { 0x72, 33 }, // r
+    { 0x73, 35 }, // s
+    { 0x74, 36 }, // t
+    { 0x75, 37 }, // u
+    { 0x76, 38 }, // v
+    { 0x77, 38 }, // w
+    { 0x78, 39 }, // x
+    { 0x79, 40 }, // y
+    { 0x7A, 41 }, // z
+    { 0x7D, 42 }, // }
+    { 0xAB, 43 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 44 }, // »
+    { 0xBF, 45 }, // ¿
+    { 0xC0, 11 }, // À
+    { 0xC1, 11 }, // Á
+    { 0xC2, 11 }, // Â
+    { 0xC3, 11 }, // Ã
+    { 0xC4, 11 }, // Ä
+    { 0xC5, 11 }, // Å
+    { 0xC6, 46 }, // Æ
+    { 0xC7, 13 }, // Ç
+    { 0xC8, 12 }, // È
+    { 0xC9, 12 }, // É
+    { 0xCA, 12 }, // Ê
+    { 0xCB, 12 }, // Ë
+    { 0xCC, 12 }, // Ì
+    { 0xCD, 12 }, // Í
+    { 0xCE, 12 }, // Î
+    { 0xCF, 12 }, // Ï
+    { 0xD0, 12 }, // Ð
+    { 0xD1, 12 }, // Ñ
+    { 0xD2, 13 }, // Ò
+    { 0xD3, 13 }, // Ó
+    { 0xD4, 13 }, // Ô
+    { 0xD5, 13 }, // Õ
+    { 0xD6, 13 }, // Ö
+    { 0xD8, 47 }, // Ø
+    { 0xD9, 18 }, // Ù
+    { 0xDA, 18 }, // Ú
+    { 0xDB, 18 }, // Û
+    { 0xDC, 18 }, // Ü
+    { 0xDD, 21 }, // Ý
+    { 0xDE, 12 }, // Þ
+    { 0xDF, 48 }, // ß
+    { 0xE0, 25 }, // à
+    { 0xE1, 25 }, // á
+    { 0xE2, 25 }, // â
+    { 0xE3, 49 }, // ã
+    { 0xE4, 50 }, // ä
+    { 0xE5, 25 }, // å
+    { 0xE6, 25 }, // æ
+    { 0xE7, 27 }, // ç
+    { 0xE8, 27 }, // è
+    { 0xE9, 27 }, // é
+    { 0xEA, 27 }, // ê
+    { 0xEB, 51 }, // ë
+    { 0xEC, 52 }, // ì
+    { 0xED, 31 }, // í
+    { 0xEE, 53 }, // î
+    { 0xEF, 54 }, // ï
+    { 0xF0, 27 }, // ð
+    { 0xF1, 33 }, // ñ
+    { 0xF2, 27 }, // ò
+    { 0xF3, 27 }, // ó
+    { 0xF4, 27 }, // ô
+    { 0xF5, 27 }, // õ
+    { 0xF6, 27 }, // ö
+    { 0xF8, 55 }, // ø
+    { 0xF9, 37 }, // ù
+    { 0xFA, 37 }, // ú
+    { 0xFB, 37 }, // û
+    { 0xFC, 37 }, // ü
+    { 0xFD, 40 }, // ý
+    { 0xFE, 56 }, // þ
+    { 0xFF, 40 }, // ÿ
+    { 0x100, 11 }, // Ā
+    { 0x101, 57 }, // ā
+    { 0x102, 11 }, // Ă
+    { 0x103, 58 }, // ă
+    { 0x104, 11 }, // Ą
+    { 0x105, 25 }, // ą
+    { 0x106, 13 }, // Ć
+    { 0x107, 27 }, // ć
+    { 0x108, 13 }, // Ĉ
+    { 0x109, 27 }, // ĉ
+    { 0x10A, 13 }, // Ċ
+    { 0x10B, 27 }, // ċ
+    { 0x10C, 13 }, // Č
+    { 0x10D, 27 }, // č
+    { 0x10E, 12 }, // Ď
+    { 0x10F, 27 }, // ď
+    { 0x110, 12 }, // Đ
+    { 0x111, 27 }, // đ
+    { 0x112, 12 }, // Ē
+    { 0x113, 27 }, // ē
+    { 0x114, 12 }, // Ĕ
+    { 0x115, 27 }, // ĕ
+    { 0x116, 12 }, // Ė
+    { 0x117, 27 }, // ė
+    { 0x118, 12 }, // Ę
+    { 0x119, 27 }, // ę
+    { 0x11A, 12 }, // Ě
+    { 0x11B, 27 }, // ě
+    { 0x11C, 13 }, // Ĝ
+    { 0x11D, 29 }, // ĝ
+    { 0x11E, 13 }, // Ğ
+    { 0x11F, 59 }, // ğ
+    { 0x120, 13 }, // Ġ
+    { 0x121, 29 }, // ġ
+    { 0x122, 13 }, // Ģ
+    { 0x123, 29 }, // ģ
+    { 0x124, 12 }, // Ĥ
+    { 0x125, 30 }, // ĥ
+    { 0x126, 12 }, // Ħ
+    { 0x127, 60 }, // ħ
+    { 0x128, 12 }, // Ĩ
+    { 0x129, 54 }, // ĩ
+    { 0x12A, 12 }, // Ī
+    { 0x12B, 54 }, // ī
+    { 0x12C, 12 }, // Ĭ
+    { 0x12D, 54 }, // ĭ
+    { 0x12E, 12 }, // Į
+    { 0x12F, 31 }, // į
+    { 0x130, 12 }, // İ
+    { 0x131, 31 }, // ı
+    { 0x132, 12 }, // Ĳ
+    { 0x133, 31 }, // ĳ
+    { 0x134, 14 }, // Ĵ
+    { 0x135, 61 }, // ĵ
+    { 0x136, 12 }, // Ķ
+    { 0x137, 30 }, // ķ
+    { 0x138, 33 }, // ĸ
+    { 0x139, 12 }, // Ĺ
+    { 0x13A, 30 }, // ĺ
+    { 0x13B, 12 }, // Ļ
+    { 0x13C, 30 }, // ļ
+    { 0x13D, 12 }, // Ľ
+    { 0x13E, 30 }, // ľ
+    { 0x13F, 12 }, // Ŀ
+    { 0x140, 30 }, // ŀ
+    { 0x141, 12 }, // Ł
+    { 0x142, 62 }, // ł
+    { 0x143, 12 }, // Ń
+    { 0x144, 33 }, // ń
+    { 0x145, 12 }, // Ņ
+    { 0x146, 33 }, // ņ
+    { 0x147, 12 }, // Ň
+    { 0x148, 33 }, // ň
+    { 0x149, 33 }, // ŉ
+    { 0x14A, 12 }, // Ŋ
+    { 0x14B, 33 }, // ŋ
+    { 0x14C, 13 }, // Ō
+    { 0x14D, 27 }, // ō
+    { 0x14E, 13 }, // Ŏ
+    { 0x14F, 27 }, // ŏ
+    { 0x150, 13 }, // Ő
+    { 0x151, 27 }, // ő
+    { 0x152, 13 }, // Œ
+    { 0x153, 27 }, // œ
+    { 0x154, 12 }, // Ŕ
+    { 0x155, 33 }, // ŕ
+    { 0x156, 12 }, // Ŗ
+    { 0x157, 33 }, // ŗ
+    { 0x158, 12 }, // Ř
+    { 0x159, 63 }, // ř
+    { 0x15A, 16 }, // Ś
+    { 0x15B, 35 }, // ś
+    { 0x15C, 16 }, // Ŝ
+    { 0x15D, 64 }, // ŝ
+    { 0x15E, 16 }, // Ş
+    { 0x15F, 35 }, // ş
+    { 0x160, 16 }, // Š
+    { 0x161, 65 }, // š
+    { 0x162, 17 }, // Ţ
+    { 0x163, 36 }, // ţ
+    { 0x164, 17 }, // Ť
+    { 0x165, 36 }, // ť
+    { 0x166, 17 }, // Ŧ
+    { 0x167, 36 }, // ŧ
+    { 0x168, 18 }, // Ũ
+    { 0x169, 37 }, // ũ
+    { 0x16A, 18 }, // Ū
+    { 0x16B, 37 }, // ū
+    { 0x16C, 18 }, // Ŭ
+    { 0x16D, 37 }, // ŭ
+    { 0x16E, 18 }, // Ů
+    { 0x16F, 37 }, // ů
+    { 0x170, 18 }, // Ű
+    { 0x171, 37 }, // ű
+    { 0x172, 18 }, // Ų
+    { 0x173, 37 }, // ų
+    { 0x174, 19 }, // Ŵ
+    { 0x175, 38 }, // ŵ
+    { 0x176, 21 }, // Ŷ
+    { 0x177, 40 }, // ŷ
+    { 0x178, 21 }, // Ÿ
+    { 0x179, 22 }, // Ź
+    { 0x17A, 41 }, // ź
+    { 0x17B, 22 }, // Ż
+    { 0x17C, 41 }, // ż
+    { 0x17D, 22 }, // Ž
+    { 0x17E, 66 }, // ž
+    { 0x17F, 48 }, // ſ
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 67 }, // ‘
+    { 0x2019, 68 }, // ’
+    { 0x201A, 6 }, // ‚
+    { 0x201B, 67 }, // ‛
+    { 0x201C, 67 }, // “
+    { 0x201D, 68 }, // ”
+    { 0x201E, 6 }, // „
+    { 0x201F, 67 }, // ‟
+    { 0x2025, 6 }, // ‥
+    { 0x2026, 6 }, // …
+    { 0x2039, 43 }, // ‹
+    { 0x203A, 44 }, // ›
+    { 0xFB00, 28 }, // ﬀ
+    { 0xFB01, 28 }, // ﬁ
+    { 0xFB02, 28 }, // ﬂ
+    { 0xFB03, 28 }, // ﬃ
+    { 0xFB04, 28 }, // ﬄ
+};
+
+static const int8_t bookerly_14_boldKernMatrix[5032] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 1, 1, -1, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, -1, -4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -3, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -3, -1, -3, 0, 0, 0, -1, -1, -3, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -4, -1, 0, -3, -3, -3, 0, 1, 1, -3, 0, -3, -3, -3, 0, 0, 0, -1, -3, -3, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -3, 0, -1, 0, 1, 0, 0, -2, 1, 0, 0, 0, 0, 0, -3, -2, -3, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 1, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 1, -2, 0, -2, -2, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, -1, -1, -1, 0, 1, 1, -1, 0, -1, -1, -1, 0, 1, 0, 0, -1, -1, -1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 1, 1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, -1, -2, 1, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 2, 2, 0, 1, -1, -1, -1, 1, 2, 1, 0, -1, -1, 0, 0, 0,
+    1, 0, 2, -3, 0, -3, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, -1, 0, 1, 1,
+    0, 1, 0, 1, 0, -1, -1, 0, 1, 0, -1, 0, 0, 3, 0, 0, 0, 0, -1, -1, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 1, 0, 2, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 1, 0, -2, -1, -2, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 1, -1, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -1, -3, -4, -1, -1, 0, -4, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -3, -1, 0, -2, -2, -2, 0, 1, 1, -2, 0, -2, -2, -2, 0, 0, 0, 0, -2, -2, -1, 1, 1,
+    0, 0, 0, -1, 0, -1, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, -2, 0, -1, -1, -1, 0, 0, 1, 1, 0, 0, -1, -1, -1, 0, 1, 0, 0, -1, -1, -1, 0, 0,
+    0, 0, 1, -4, -1, -4, -4, -1, -1, 0, -4, 0, -1, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, -2, 1, -2, -1, -2, 1, 0, 0, -1, -1, -2, 0, -1, -1, -1, -1, -1, 1, -1, -1, 0, -4, -1, 0, -2, -1, -2, 0, 2, 2, -2, 1, -1, -2, -2, 1, 2, 1, -1, -2, -2, -1, 0, 1,
+    0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -3, -1, -3, -3, -1, -1, 0, -3, 0, -2, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -2, 1, -2, 0, -3, 1, 0, 0, -1, -1, -2, 0, -1, -1, -1, -1, -1, 1, -1, -1, 0, -3, -2, 0, -2, -1, -2, 0, 2, 2, -2, 1, -1, -1, -3, 1, 1, 1, -1, -2, -2, -1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -3, 0, -2, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0,
+    3, 3, 3, -1, 0, -1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 1, 1, 3, 3, 4, 0, 0, 1, 1, 0, 3, 3, 0, 1, 1, 1, 1, 2, 3,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 1, -2, -1, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 1, -3, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 1, 0, 1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 1, -1, 0, -1, -1, 0, 1, 1,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0,
+    0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, -2, -3, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, -2, -2, -2, 0, -2, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 2, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 1, 1,
+    -1, 0, -3, 0, -1, 0, 1, 0, 0, -2, 1, 0, 0, 1, 0, 0, -3, -2, -3, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -2, 1, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -3, -2,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, -1,
+    0, 3, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 3, 0, 1, 0, 3, 1, 1, 0, 0, 0, 1, 0, 1, 1, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 0, 0, 3, 3, 3, 1, 0, 1, 1, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, -1, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 1, 1, 1, 0, 0, 0, 0, -3, -4, 0, 0, 0, 0, -1, 0, 1, 1, -1, 1, 0, 0, -1, 1, 1, 1, 0, -1, -1, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -4, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, -1, 1, -2, 0, -2, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -5, -1, 0, -1, -1, -2, 0, 1, 1, -2, 1, -1, -1, -2, 1, 1, 1, 0, -2, -2, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, -1, -4, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -3, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1,
+};
+
+static const EpdLigaturePair bookerly_14_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_14_bold = {
     bookerly_14_boldBitmaps,
     bookerly_14_boldGlyphs,
     bookerly_14_boldIntervals,
-    60,
+    61,
     38,
     31,
     -8,
     true,
+    bookerly_14_boldKernLeftClasses,
+    277,
+    bookerly_14_boldKernRightClasses,
+    282,
+    bookerly_14_boldKernMatrix,
+    74,
+    68,
+    bookerly_14_boldLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_italicBitmaps[64856] = {
+static const uint8_t bookerly_14_italicBitmaps[65952] = {
     0x00, 0x05, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x00,
     0x0F, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x02, 0xC0, 0x00,
     0xF0, 0x00, 0x3C, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x0F,
@@ -4061,7 +4061,75 @@ static const uint8_t bookerly_14_italicBitmaps[64856] = {
     0xFC, 0x00, 0x06, 0xAA, 0xBF, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80,
     0x0A, 0x43, 0xFC, 0x3F, 0xC2, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xA0, 0x00, 0x29, 0x0F, 0xF0,
     0x01, 0xFD, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0xFD, 0x00, 0x0F, 0xC0, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1B, 0xE4, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0xD0, 0x00,
+    0x00, 0x07, 0xD0, 0x6F, 0xF0, 0x2C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7D,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x3D, 0x00,
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x00,
+    0x00, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0xBC, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0,
+    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
+    0xBC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x20, 0x0F, 0xE0, 0x02, 0xF0,
+    0x00, 0x00, 0x0B, 0xE6, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x7F, 0xFE, 0x00, 0x00,
+    0x00, 0x02, 0xB9, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x01,
+    0xFC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x34, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x03,
+    0xD0, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E,
+    0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0xBC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7C,
+    0x34, 0x00, 0x00, 0xF4, 0x00, 0xBD, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xF0,
+    0x00, 0xBF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x01, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBC,
+    0x00, 0x1F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x6F, 0xFF, 0xC0, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x00,
+    0x0B, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B,
+    0xC0, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x34, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x7C,
+    0x00, 0x00, 0x7C, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
+    0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x2F,
+    0xFF, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x1B, 0xFE, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7F,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x0B,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x00,
+    0x03, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0,
+    0x00, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D,
+    0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x0B,
+    0xC0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x3E, 0x1C, 0x00, 0x00,
+    0xF4, 0x00, 0x2F, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x07, 0xFF, 0x00, 0x00,
+    0x2F, 0x00, 0x03, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0xFE, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xBF, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFC, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xE4, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x02,
+    0xFF, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF2, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x6F,
+    0xF8, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00,
+    0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7D,
+    0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00,
+    0x00, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00,
+    0x00, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8,
+    0x00, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x01,
+    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0x40,
+    0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x2C, 0x00, 0x00, 0xF4, 0x00, 0x2F,
+    0x00, 0x07, 0xEB, 0x80, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xF0, 0x00,
+    0x3D, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
+    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x20, 0x0F,
+    0xE0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE6, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0xFC, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xB9, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
 static const EpdGlyph bookerly_14_italicGlyphs[] = {
@@ -4793,6 +4861,11 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 17, 21, 29, 6, 21, 90, 64726 }, // ⊥
     { 6, 5, 18, 6, 10, 8, 64816 }, // ⋅
     { 25, 5, 29, 2, 10, 32, 64824 }, // ⋯
+    { 30, 30, 21, -5, 23, 225, 64856 }, // ﬀ
+    { 24, 30, 19, -5, 23, 180, 65081 }, // ﬁ
+    { 25, 30, 20, -5, 23, 188, 65261 }, // ﬂ
+    { 33, 30, 28, -5, 23, 248, 65449 }, // ﬃ
+    { 34, 30, 29, -5, 23, 255, 65697 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_14_italicIntervals[] = {
@@ -4856,15 +4929,658 @@ static const EpdUnicodeInterval bookerly_14_italicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_14_italicKernLeftClasses[] = {
+    { 0x28, 1 }, // (
+    { 0x2A, 2 }, // *
+    { 0x2C, 3 }, // ,
+    { 0x2D, 4 }, // -
+    { 0x2E, 3 }, // .
+    { 0x2F, 5 }, // /
+    { 0x41, 6 }, // A
+    { 0x42, 7 }, // B
+    { 0x43, 8 }, // C
+    { 0x44, 9 }, // D
+    { 0x45, 10 }, // E
+    { 0x46, 11 }, // F
+    { 0x47, 12 }, // G
+    { 0x48, 13 }, // H
+    { 0x49, 13 }, // I
+    { 0x4A, 14 }, // J
+    { 0x4B, 15 }, // K
+    { 0x4C, 16 }, // L
+    { 0x4D, 17 }, // M
+    { 0x4E, 18 }, // N
+    { 0x4F, 9 }, // O
+    { 0x50, 19 }, // P
+    { 0x51, 20 }, // Q
+    { 0x52, 21 }, // R
+    { 0x53, 22 }, // S
+    { 0x54, 23 }, // T
+    { 0x55, 24 }, // U
+    { 0x56, 25 }, // V
+    { 0x57, 25 }, // W
+    { 0x58, 26 }, // X
+    { 0x59, 27 }, // Y
+    { 0x5A, 28 }, // Z
+    { 0x5B, 29 }, // [
+    { 0x5C, 30 }, // <backslash>
+    { 0x61, 31 }, // a
+    { 0x62, 32 }, // b
+    { 0x63, 33 }, // c
+    { 0x65, 34 }, // e
+    { 0x66, 35 }, // f
+    { 0x67, 36 }, // g
+    { 0x68, 37 }, // h
+    { 0x6A, 38 }, // j
+    { 0x6B, 39 }, // k
+    { 0x6D, 37 }, // m
+    { 0x6E, 37 }, // n
+    { 0x6F, 32 }, // o
+    { 0x70, 32 }, // p
+    { 0x71, 40 }, // q
+    { 0x72, 41 }, // r
+    { 0x73, 42 }, // s
+    { 0x74, 43 }, // t
+    { 0x75, 31 }, // u
+    { 0x76, 44 }, // v
+    { 0x77, 44 }, // w
+    { 0x78, 45 }, // x
+    { 0x79, 44 }, // y
+    { 0x7A, 46 }, // z
+    { 0x7B, 47 }, // {
+    { 0xA1, 48 }, // ¡
+    { 0xAB, 49 }, // «
+    { 0xAD, 4 }, // ­
+    { 0xBB, 50 }, // »
+    { 0xBF, 51 }, // ¿
+    { 0xC0, 6 }, // À
+    { 0xC1, 6 }, // Á
+    { 0xC2, 6 }, // Â
+    { 0xC3, 6 }, // Ã
+    { 0xC4, 6 }, // Ä
+    { 0xC5, 6 }, // Å
+    { 0xC6, 10 }, // Æ
+    { 0xC7, 8 }, // Ç
+    { 0xC8, 10 }, // È
+    { 0xC9, 10 }, // É
+    { 0xCA, 10 }, // Ê
+    { 0xCB, 10 }, // Ë
+    { 0xCC, 13 }, // Ì
+    { 0xCD, 13 }, // Í
+    { 0xCE, 13 }, // Î
+    { 0xCF, 13 }, // Ï
+    { 0xD0, 9 }, // Ð
+    { 0xD1, 18 }, // Ñ
+    { 0xD2, 9 }, // Ò
+    { 0xD3, 9 }, // Ó
+    { 0xD4, 9 }, // Ô
+    { 0xD5, 9 }, // Õ
+    { 0xD6, 9 }, // Ö
+    { 0xD8, 9 }, // Ø
+    { 0xD9, 24 }, // Ù
+    { 0xDA, 24 }, // Ú
+    { 0xDB, 24 }, // Û
+    { 0xDC, 24 }, // Ü
+    { 0xDD, 27 }, // Ý
+    { 0xDE, 52 }, // Þ
+    { 0xDF, 53 }, // ß
+    { 0xE0, 31 }, // à
+    { 0xE1, 31 }, // á
+    { 0xE2, 31 }, // â
+    { 0xE3, 31 }, // ã
+    { 0xE4, 31 }, // ä
+    { 0xE5, 31 }, // å
+    { 0xE6, 34 }, // æ
+    { 0xE7, 54 }, // ç
+    { 0xE8, 34 }, // è
+    { 0xE9, 34 }, // é
+    { 0xEA, 34 }, // ê
+    { 0xEB, 34 }, // ë
+    { 0xEE, 55 }, // î
+    { 0xEF, 55 }, // ï
+    { 0xF0, 32 }, // ð
+    { 0xF1, 37 }, // ñ
+    { 0xF2, 32 }, // ò
+    { 0xF3, 32 }, // ó
+    { 0xF4, 32 }, // ô
+    { 0xF5, 32 }, // õ
+    { 0xF6, 32 }, // ö
+    { 0xF8, 56 }, // ø
+    { 0xF9, 31 }, // ù
+    { 0xFA, 31 }, // ú
+    { 0xFB, 31 }, // û
+    { 0xFC, 31 }, // ü
+    { 0xFD, 44 }, // ý
+    { 0xFE, 32 }, // þ
+    { 0xFF, 44 }, // ÿ
+    { 0x100, 6 }, // Ā
+    { 0x101, 31 }, // ā
+    { 0x102, 6 }, // Ă
+    { 0x103, 31 }, // ă
+    { 0x104, 57 }, // Ą
+    { 0x105, 58 }, // ą
+    { 0x106, 8 }, // Ć
+    { 0x107, 33 }, // ć
+    { 0x108, 8 }, // Ĉ
+    { 0x109, 33 }, // ĉ
+    { 0x10A, 8 }, // Ċ
+    { 0x10B, 33 }, // ċ
+    { 0x10C, 8 }, // Č
+    { 0x10D, 33 }, // č
+    { 0x10E, 9 }, // Ď
+    { 0x10F, 59 }, // ď
+    { 0x110, 9 }, // Đ
+    { 0x112, 10 }, // Ē
+    { 0x113, 34 }, // ē
+    { 0x114, 10 }, // Ĕ
+    { 0x115, 34 }, // ĕ
+    { 0x116, 10 }, // Ė
+    { 0x117, 34 }, // ė
+    { 0x118, 60 }, // Ę
+    { 0x119, 61 }, // ę
+    { 0x11A, 10 }, // Ě
+    { 0x11B, 34 }, // ě
+    { 0x11C, 12 }, // Ĝ
+    { 0x11D, 36 }, // ĝ
+    { 0x11E, 12 }, // Ğ
+    { 0x11F, 36 }, // ğ
+    { 0x120, 12 }, // Ġ
+    { 0x121, 36 }, // ġ
+    { 0x122, 12 }, // Ģ
+    { 0x123, 36 }, // ģ
+    { 0x124, 13 }, // Ĥ
+    { 0x125, 37 }, // ĥ
+    { 0x126, 13 }, // Ħ
+    { 0x127, 37 }, // ħ
+    { 0x128, 13 }, // Ĩ
+    { 0x129, 62 }, // ĩ
+    { 0x12A, 13 }, // Ī
+    { 0x12B, 55 }, // ī
+    { 0x12C, 13 }, // Ĭ
+    { 0x12D, 55 }, // ĭ
+    { 0x12E, 63 }, // Į
+    { 0x12F, 64 }, // į
+    { 0x130, 13 }, // İ
+    { 0x131, 31 }, // ı
+    { 0x132, 14 }, // Ĳ
+    { 0x133, 38 }, // ĳ
+    { 0x134, 14 }, // Ĵ
+    { 0x135, 65 }, // ĵ
+    { 0x136, 15 }, // Ķ
+    { 0x137, 39 }, // ķ
+    { 0x138, 66 }, // ĸ
+    { 0x139, 16 }, // Ĺ
+    { 0x13B, 16 }, // Ļ
+    { 0x13C, 67 }, // ļ
+    { 0x13E, 59 }, // ľ
+    { 0x141, 16 }, // Ł
+    { 0x142, 68 }, // ł
+    { 0x143, 18 }, // Ń
+    { 0x144, 37 }, // ń
+    { 0x145, 18 }, // Ņ
+    { 0x146, 37 }, // ņ
+    { 0x147, 18 }, // Ň
+    { 0x148, 37 }, // ň
+    { 0x149, 37 }, // ŉ
+    { 0x14A, 18 }, // Ŋ
+    { 0x14B, 69 }, // ŋ
+    { 0x14C, 9 }, // Ō
+    { 0x14D, 32 }, // ō
+    { 0x14E, 9 }, // Ŏ
+    { 0x14F, 32 }, // ŏ
+    { 0x150, 9 }, // Ő
+    { 0x151, 32 }, // ő
+    { 0x152, 10 }, // Œ
+    { 0x153, 34 }, // œ
+    { 0x154, 21 }, // Ŕ
+    { 0x155, 41 }, // ŕ
+    { 0x156, 21 }, // Ŗ
+    { 0x157, 41 }, // ŗ
+    { 0x158, 21 }, // Ř
+    { 0x159, 41 }, // ř
+    { 0x15A, 22 }, // Ś
+    { 0x15B, 42 }, // ś
+    { 0x15C, 22 }, // Ŝ
+    { 0x15D, 42 }, // ŝ
+    { 0x15E, 22 }, // Ş
+    { 0x15F, 70 }, // ş
+    { 0x160, 22 }, // Š
+    { 0x161, 42 }, // š
+    { 0x162, 23 }, // Ţ
+    { 0x163, 71 }, // ţ
+    { 0x164, 23 }, // Ť
+    { 0x166, 23 }, // Ŧ
+    { 0x167, 43 }, // ŧ
+    { 0x168, 24 }, // Ũ
+    { 0x169, 31 }, // ũ
+    { 0x16A, 24 }, // Ū
+    { 0x16B, 31 }, // ū
+    { 0x16C, 24 }, // Ŭ
+    { 0x16D, 31 }, // ŭ
+    { 0x16E, 24 }, // Ů
+    { 0x16F, 31 }, // ů
+    { 0x170, 24 }, // Ű
+    { 0x171, 31 }, // ű
+    { 0x172, 24 }, // Ų
+    { 0x173, 72 }, // ų
+    { 0x174, 25 }, // Ŵ
+    { 0x175, 44 }, // ŵ
+    { 0x176, 27 }, // Ŷ
+    { 0x177, 44 }, // ŷ
+    { 0x178, 27 }, // Ÿ
+    { 0x179, 28 }, // Ź
+    { 0x17A, 46 }, // ź
+    { 0x17B, 28 }, // Ż
+    { 0x17C, 46 }, // ż
+    { 0x17D, 28 }, // Ž
+    { 0x17E, 46 }, // ž
+    { 0x2010, 4 }, // ‐
+    { 0x2011, 4 }, // ‑
+    { 0x2013, 4 }, // –
+    { 0x2014, 4 }, // —
+    { 0x2015, 4 }, // ―
+    { 0x2018, 73 }, // ‘
+    { 0x2019, 74 }, // ’
+    { 0x201A, 75 }, // ‚
+    { 0x201B, 73 }, // ‛
+    { 0x201C, 73 }, // “
+    { 0x201D, 74 }, // ”
+    { 0x201E, 3 }, // „
+    { 0x2025, 3 }, // ‥
+    { 0x2026, 3 }, // …
+    { 0x2039, 49 }, // ‹
+    { 0x203A, 50 }, // ›
+    { 0xFB00, 35 }, // ﬀ
+};
+
+static const EpdKernClassEntry bookerly_14_italicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x29, 2 }, // )
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x3F, 10 }, // ?
+    { 0x41, 11 }, // A
+    { 0x42, 12 }, // B
+    { 0x43, 13 }, // C
+    { 0x44, 12 }, // D
+    { 0x45, 12 }, // E
+    { 0x46, 12 }, // F
+    { 0x47, 13 }, // G
+    { 0x48, 12 }, // H
+    { 0x49, 12 }, // I
+    { 0x4A, 14 }, // J
+    { 0x4B, 12 }, // K
+    { 0x4C, 12 }, // L
+    { 0x4D, 15 }, // M
+    { 0x4E, 12 }, // N
+    { 0x4F, 13 }, // O
+    { 0x50, 12 }, // P
+    { 0x51, 13 }, // Q
+    { 0x52, 12 }, // R
+    { 0x53, 16 }, // S
+    { 0x54, 17 }, // T
+    { 0x55, 18 }, // U
+    { 0x56, 19 }, // V
+    { 0x57, 19 }, // W
+    { 0x58, 20 }, // X
+    { 0x59, 21 }, // Y
+    { 0x5A, 22 }, // Z
+    { 0x5C, 23 }, // <backslash>
+    { 0x5D, 24 }, // ]
+    { 0x61, 25 }, // a
+    { 0x62, 26 }, // b
+    { 0x63, 25 }, // c
+    { 0x64, 25 }, // d
+    { 0x65, 25 }, // e
+    { 0x66, 27 }, // f
+    { 0x67, 28 }, // g
+    { 0x68, 26 }, // h
+    { 0x69, 29 }, // i
+    { 0x6A, 30 }, // j
+    { 0x6B, 26 }, // k
+    { 0x6C, 26 }, // l
+    { 0x6D, 31 }, // m
+    { 0x6E, 31 }, // n
+    { 0x6F, 25 }, // o
+    { 0x70, 32 }, // p
+    { 0x71, 25 }, // q
+    { 0x72, 31 }, // r
+    { 0x73, 33 }, // s
+    { 0x74, 34 }, // t
+    { 0x75, 35 }, // u
+    { 0x76, 36 }, // v
+    { 0x77, 36 }, // w
+    { 0x78, 37 }, // x
+    { 0x79, 38 }, // y
+    { 0x7A, 39 }, // z
+    { 0x7D, 24 }, // }
+    { 0xAB, 40 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 41 }, // »
+    { 0xBF, 42 }, // ¿
+    { 0xC0, 11 }, // À
+    { 0xC1, 11 }, // Á
+    { 0xC2, 11 }, // Â
+    { 0xC3, 11 }, // Ã
+    { 0xC4, 11 }, // Ä
+    { 0xC5, 11 }, // Å
+    { 0xC6, 43 }, // Æ
+    { 0xC7, 13 }, // Ç
+    { 0xC8, 12 }, // È
+    { 0xC9, 12 }, // É
+    { 0xCA, 12 }, // Ê
+    { 0xCB, 12 }, // Ë
+    { 0xCC, 12 }, // Ì
+    { 0xCD, 12 }, // Í
+    { 0xCE, 12 }, // Î
+    { 0xCF, 12 }, // Ï
+    { 0xD0, 12 }, // Ð
+    { 0xD1, 12 }, // Ñ
+    { 0xD2, 13 }, // Ò
+    { 0xD3, 13 }, // Ó
+    { 0xD4, 13 }, // Ô
+    { 0xD5, 13 }, // Õ
+    { 0xD6, 13 }, // Ö
+    { 0xD8, 13 }, // Ø
+    { 0xD9, 18 }, // Ù
+    { 0xDA, 18 }, // Ú
+    { 0xDB, 18 }, // Û
+    { 0xDC, 18 }, // Ü
+    { 0xDD, 21 }, // Ý
+    { 0xDE, 12 }, // Þ
+    { 0xDF, 44 }, // ß
+    { 0xE0, 25 }, // à
+    { 0xE1, 25 }, // á
+    { 0xE2, 25 }, // â
+    { 0xE3, 25 }, // ã
+    { 0xE4, 45 }, // ä
+    { 0xE5, 25 }, // å
+    { 0xE6, 25 }, // æ
+    { 0xE7, 25 }, // ç
+    { 0xE8, 25 }, // è
+    { 0xE9, 25 }, // é
+    { 0xEA, 25 }, // ê
+    { 0xEB, 25 }, // ë
+    { 0xEC, 46 }, // ì
+    { 0xED, 29 }, // í
+    { 0xEE, 47 }, // î
+    { 0xEF, 47 }, // ï
+    { 0xF0, 25 }, // ð
+    { 0xF1, 31 }, // ñ
+    { 0xF2, 25 }, // ò
+    { 0xF3, 25 }, // ó
+    { 0xF4, 25 }, // ô
+    { 0xF5, 25 }, // õ
+    { 0xF6, 25 }, // ö
+    { 0xF8, 48 }, // ø
+    { 0xF9, 35 }, // ù
+    { 0xFA, 35 }, // ú
+    { 0xFB, 35 }, // û
+    { 0xFC, 35 }, // ü
+    { 0xFD, 36 }, // ý
+    { 0xFE, 49 }, // þ
+    { 0xFF, 36 }, // ÿ
+    { 0x100, 11 }, // Ā
+    { 0x101, 25 }, // ā
+    { 0x102, 11 }, // Ă
+    { 0x103, 25 }, // ă
+    { 0x104, 11 }, // Ą
+    { 0x105, 25 }, // ą
+    { 0x106, 13 }, // Ć
+    { 0x107, 25 }, // ć
+    { 0x108, 13 }, // Ĉ
+    { 0x109, 25 }, // ĉ
+    { 0x10A, 13 }, // Ċ
+    { 0x10B, 25 }, // ċ
+    { 0x10C, 13 }, // Č
+    { 0x10D, 45 }, // č
+    { 0x10E, 12 }, // Ď
+    { 0x10F, 25 }, // ď
+    { 0x110, 12 }, // Đ
+    { 0x111, 25 }, // đ
+    { 0x112, 12 }, // Ē
+    { 0x113, 25 }, // ē
+    { 0x114, 12 }, // Ĕ
+    { 0x115, 25 }, // ĕ
+    { 0x116, 12 }, // Ė
+    { 0x117, 25 }, // ė
+    { 0x118, 12 }, // Ę
+    { 0x119, 25 }, // ę
+    { 0x11A, 12 }, // Ě
+    { 0x11B, 25 }, // ě
+    { 0x11C, 13 }, // Ĝ
+    { 0x11D, 28 }, // ĝ
+    { 0x11E, 13 }, // Ğ
+    { 0x11F, 28 }, // ğ
+    { 0x120, 13 }, // Ġ
+    { 0x121, 28 }, // ġ
+    { 0x122, 13 }, // Ģ
+    { 0x123, 28 }, // ģ
+    { 0x124, 12 }, // Ĥ
+    { 0x125, 26 }, // ĥ
+    { 0x126, 12 }, // Ħ
+    { 0x127, 50 }, // ħ
+    { 0x128, 12 }, // Ĩ
+    { 0x129, 51 }, // ĩ
+    { 0x12A, 12 }, // Ī
+    { 0x12B, 47 }, // ī
+    { 0x12C, 12 }, // Ĭ
+    { 0x12D, 47 }, // ĭ
+    { 0x12E, 12 }, // Į
+    { 0x12F, 29 }, // į
+    { 0x130, 12 }, // İ
+    { 0x131, 31 }, // ı
+    { 0x132, 12 }, // Ĳ
+    { 0x133, 29 }, // ĳ
+    { 0x134, 14 }, // Ĵ
+    { 0x135, 52 }, // ĵ
+    { 0x136, 12 }, // Ķ
+    { 0x137, 26 }, // ķ
+    { 0x138, 31 }, // ĸ
+    { 0x139, 12 }, // Ĺ
+    { 0x13A, 26 }, // ĺ
+    { 0x13B, 12 }, // Ļ
+    { 0x13C, 26 }, // ļ
+    { 0x13D, 12 }, // Ľ
+    { 0x13E, 26 }, // ľ
+    { 0x13F, 12 }, // Ŀ
+    { 0x140, 26 }, // ŀ
+    { 0x141, 12 }, // Ł
+    { 0x142, 53 }, // ł
+    { 0x143, 12 }, // Ń
+    { 0x144, 31 }, // ń
+    { 0x145, 12 }, // Ņ
+    { 0x146, 31 }, // ņ
+    { 0x147, 12 }, // Ň
+    { 0x148, 31 }, // ň
+    { 0x149, 31 }, // ŉ
+    { 0x14A, 12 }, // Ŋ
+    { 0x14B, 31 }, // ŋ
+    { 0x14C, 13 }, // Ō
+    { 0x14D, 25 }, // ō
+    { 0x14E, 13 }, // Ŏ
+    { 0x14F, 25 }, // ŏ
+    { 0x150, 13 }, // Ő
+    { 0x151, 25 }, // ő
+    { 0x152, 13 }, // Œ
+    { 0x153, 25 }, // œ
+    { 0x154, 12 }, // Ŕ
+    { 0x155, 31 }, // ŕ
+    { 0x156, 12 }, // Ŗ
+    { 0x157, 31 }, // ŗ
+    { 0x158, 12 }, // Ř
+    { 0x159, 31 }, // ř
+    { 0x15A, 16 }, // Ś
+    { 0x15B, 33 }, // ś
+    { 0x15C, 16 }, // Ŝ
+    { 0x15D, 33 }, // ŝ
+    { 0x15E, 16 }, // Ş
+    { 0x15F, 33 }, // ş
+    { 0x160, 16 }, // Š
+    { 0x161, 54 }, // š
+    { 0x162, 17 }, // Ţ
+    { 0x163, 34 }, // ţ
+    { 0x164, 17 }, // Ť
+    { 0x165, 34 }, // ť
+    { 0x166, 17 }, // Ŧ
+    { 0x167, 34 }, // ŧ
+    { 0x168, 18 }, // Ũ
+    { 0x169, 35 }, // ũ
+    { 0x16A, 18 }, // Ū
+    { 0x16B, 35 }, // ū
+    { 0x16C, 18 }, // Ŭ
+    { 0x16D, 35 }, // ŭ
+    { 0x16E, 18 }, // Ů
+    { 0x16F, 35 }, // ů
+    { 0x170, 18 }, // Ű
+    { 0x171, 35 }, // ű
+    { 0x172, 18 }, // Ų
+    { 0x173, 35 }, // ų
+    { 0x174, 19 }, // Ŵ
+    { 0x175, 36 }, // ŵ
+    { 0x176, 21 }, // Ŷ
+    { 0x177, 36 }, // ŷ
+    { 0x178, 21 }, // Ÿ
+    { 0x179, 22 }, // Ź
+    { 0x17A, 39 }, // ź
+    { 0x17B, 22 }, // Ż
+    { 0x17C, 39 }, // ż
+    { 0x17D, 22 }, // Ž
+    { 0x17E, 39 }, // ž
+    { 0x17F, 44 }, // ſ
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 55 }, // ‘
+    { 0x2019, 56 }, // ’
+    { 0x201A, 6 }, // ‚
+    { 0x201B, 55 }, // ‛
+    { 0x201C, 55 }, // “
+    { 0x201D, 56 }, // ”
+    { 0x201E, 6 }, // „
+    { 0x2025, 6 }, // ‥
+    { 0x2026, 6 }, // …
+    { 0x2039, 40 }, // ‹
+    { 0x203A, 41 }, // ›
+    { 0xFB00, 27 }, // ﬀ
+    { 0xFB01, 27 }, // ﬁ
+    { 0xFB02, 27 }, // ﬂ
+    { 0xFB03, 27 }, // ﬃ
+    { 0xFB04, 27 }, // ﬄ
+};
+
+static const int8_t bookerly_14_italicKernMatrix[4200] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 2, 4, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 2, 2, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 2, 0, 0, -1, -2, -3, 1, -2, 0, 0, 0, -1, 0, 1, 1, 0, 2, -1, -1, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, -3,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, -3, 0, 0, -1, -1, -3, -1, -1, 0, -1, 0, -2, 0, 0, 0, -4, 0, -3, 0, 0, -3, 0, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, -3, 0, -1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, -2, -2, -4, 1, -3, 0, -5, 0, -1, 0, 0, 1, -1, 0, -1, -1, 0, -1, -1, -2, 0, -2, 0, -1, 0, 0, 1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -3, -2,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -3, -2, -2, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -1, 0, 1, -1, 0, 0, 1, 0, 0, -1, 0, 1,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 1, -2, 0, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, 0, 0, -1, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 1, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, -4, 0, -4, -2, -2, -2, 0, -3, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 7, 0, 5, 0, -2, -1, -1, 5, 0, 0, 0, 0, 3, 0, 0, -1, 0, -1, 0, -1, 0, -1, 6, 0, 0, 1, 2, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, -2, -2, -2, 2, -3, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, -3, 0, -3, -2, -2, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -1, 0, 0, -1, 0, 1, 0, 0, 0, -1, 1, 1,
+    0, 0, 0, -2, -1, -2, -2, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 1, -4, -1, -4, -3, -2, -2, 0, -3, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -4, 0, -2, 0, 1, -2, 0, 0, 1, 0, 0, -1, 0, 1,
+    0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, -3, -1, -3, -3, -1, -1, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -2, 0, -1, -1, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, -1, -1, -1, 0, -3, 0, -2, 0, 1, -2, 0, 1, 1, 0, 0, -2, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, -2, -1, -3, 2, -3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0,
+    0, 1, 2, -2, 0, -2, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 1, 1, -1, 1, 1, 2, 1, 1, 0, 1, 2,
+    0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 1, 0, 3, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+    0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 2, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 2, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0,
+    0, -2, 0, -3, 0, -3, -2, 0, 0, 0, -2, -1, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 2, 1, 0, 2, 0, 0, 1,
+    0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0,
+    0, 0, -3, 0, -1, 0, 0, 0, 0, -1, 1, 0, -1, 4, 0, 0, -2, -2, -4, 1, -3, 0, -5, 0, -1, 0, 3, 1, -1, 4, -1, -1, 0, -1, -1, -2, 0, -2, 0, -1, 0, 0, 1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -3, -2,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 4, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 3, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 3, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 3, 3, 0, 0, 3, 1, 2, 3,
+    0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 0, 0, 1,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, 2, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 3, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    -1, 0, 0, -3, 0, -3, 0, 0, 0, 0, -3, -1, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, 0, -3, -3, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0,
+    -2, 0, 0, -4, 0, -4, 0, 0, 0, -1, -4, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, -3, -1, -2, -3, -1, 0, -1, -1, -3, 0, -1, 0, -1, 0, -1, 0, 0, 0, -4, 0, -3, -1, 0, -3, -1, -1, 0, 0, -1, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 2, 0, 0, -1, -2, -3, 1, -2, 0, 0, 0, -1, 0, 2, 1, 0, 2, -1, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, -3,
+};
+
+static const EpdLigaturePair bookerly_14_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_14_italic = {
     bookerly_14_italicBitmaps,
     bookerly_14_italicGlyphs,
     bookerly_14_italicIntervals,
-    60,
+    61,
     38,
     31,
     -8,
     true,
+    bookerly_14_italicKernLeftClasses,
+    261,
+    bookerly_14_italicKernRightClasses,
+    280,
+    bookerly_14_italicKernMatrix,
+    75,
+    56,
+    bookerly_14_italicLigatures,
+    5,
 };
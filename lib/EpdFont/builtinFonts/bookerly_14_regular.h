@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_regularBitmaps[62675] = {
+static const uint8_t bookerly_14_regularBitmaps[63367] = {
     0x1A, 0x1F, 0xCB, 0xE2, 0xF4, 0xBD, 0x2F, 0x4B, 0xC2, 0xF0, 0xBC, 0x2F, 0x07, 0xC1, 0xF0, 0x7C,
     0x0F, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xBF, 0x5F, 0xC1, 0x40, 0x18, 0x06, 0x1F,
     0x07, 0xCB, 0xC2, 0xF1, 0xF0, 0xBC, 0x7C, 0x1F, 0x1F, 0x07, 0xC7, 0xC1, 0xF1, 0xF0, 0x7C, 0x34,
@@ -3925,7 +3925,50 @@ static const uint8_t bookerly_14_regularBitmaps[62675] = {
     0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0x43, 0xFC, 0x3F, 0xC2,
     0xF8, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xA0, 0x00, 0x29, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x2F, 0xC3,
     0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0xBF, 0xE4, 0xBF, 0xFC, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFA, 0xFE, 0x00, 0x2F, 0x80, 0x7F, 0xC0, 0x2D, 0x00, 0x7D, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00,
+    0x2F, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x16,
+    0xF9, 0x55, 0x7F, 0x95, 0x40, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00,
+    0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00,
+    0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x01,
+    0xF4, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00,
+    0x00, 0x1B, 0xFF, 0x41, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1A,
+    0x50, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x01, 0xFE, 0xAF, 0xF0, 0x00, 0x0F, 0x80, 0x0F, 0xC0,
+    0x00, 0xBC, 0x00, 0x0E, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBD,
+    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0x6F, 0x95, 0x57,
+    0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00,
+    0x1F, 0x40, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x07, 0xD0,
+    0x00, 0xBC, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x2F,
+    0x00, 0x6F, 0xFD, 0x07, 0xFF, 0xE3, 0xFF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0x95, 0x00,
+    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAF, 0xF0, 0x00, 0x0F, 0xD0, 0x0B, 0xC0, 0x00, 0xBD,
+    0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x1F, 0x80, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x0B,
+    0xC0, 0x1B, 0xFF, 0xF4, 0x2F, 0x01, 0xFF, 0xFF, 0xE0, 0xBC, 0x01, 0x6F, 0x95, 0x02, 0xF0, 0x00,
+    0x7D, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x1F, 0x40,
+    0x02, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xBC,
+    0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x6F,
+    0xFD, 0x07, 0xFF, 0xE3, 0xFF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00,
+    0x00, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEA, 0xFE, 0x00, 0x00,
+    0xBE, 0x01, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x01, 0xD0, 0x00, 0x3F, 0x00,
+    0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBC,
+    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x01, 0x6F, 0x95, 0x57, 0xF9, 0x55, 0x7F, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0,
+    0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x1F,
+    0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00,
+    0x2F, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x02, 0xF0,
+    0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03,
+    0xF0, 0x06, 0xFF, 0xD0, 0x7F, 0xFD, 0x07, 0xFF, 0xD3, 0xFF, 0xF8, 0x3F, 0xFF, 0x83, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xA5, 0x50, 0x00, 0x00, 0x2F, 0xF9, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
+    0xBF, 0xFF, 0xEF, 0xEA, 0xFF, 0x00, 0x00, 0xBE, 0x02, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x7D, 0x00,
+    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xF4,
+    0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0x43,
+    0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFC, 0x01, 0x6F, 0x95, 0x57, 0xF9, 0x50, 0x3F, 0x00,
+    0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x7D,
+    0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00,
+    0xBC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0,
+    0x00, 0xFC, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F,
+    0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x06, 0xFF, 0xD0, 0x7F, 0xFD, 0x07, 0xFF, 0xD3,
+    0xFF, 0xF8, 0x3F, 0xFF, 0x83, 0xFF, 0xF8,
 };
 
 static const EpdGlyph bookerly_14_regularGlyphs[] = {
@@ -4657,6 +4700,11 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 17, 21, 29, 6, 21, 90, 62545 }, // ⊥
     { 6, 5, 18, 6, 10, 8, 62635 }, // ⋅
     { 25, 5, 29, 2, 10, 32, 62643 }, // ⋯
+    { 24, 23, 22, 0, 23, 138, 62675 }, // ﬀ
+    { 19, 23, 19, 0, 23, 110, 62813 }, // ﬁ
+    { 19, 23, 19, 0, 23, 110, 62923 }, // ﬂ
+    { 29, 23, 29, 0, 23, 167, 63033 }, // ﬃ
+    { 29, 23, 29, 0, 23, 167, 63200 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_14_regularIntervals[] = {
@@ -4720,15 +4768,663 @@ static const EpdUnicodeInterval bookerly_14_regularIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_14_regularKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x2F, 6 }, // /
+    { 0x40, 7 }, // @
+    { 0x41, 8 }, // A
+    { 0x42, 9 }, // B
+    { 0x43, 10 }, // C
+    { 0x44, 11 }, // D
+    { 0x46, 12 }, // F
+    { 0x47, 13 }, // G
+    { 0x48, 14 }, // H
+    { 0x49, 14 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 16 }, // K
+    { 0x4C, 17 }, // L
+    { 0x4D, 18 }, // M
+    { 0x4E, 19 }, // N
+    { 0x4F, 11 }, // O
+    { 0x50, 20 }, // P
+    { 0x51, 21 }, // Q
+    { 0x52, 22 }, // R
+    { 0x53, 23 }, // S
+    { 0x54, 24 }, // T
+    { 0x55, 25 }, // U
+    { 0x56, 26 }, // V
+    { 0x57, 26 }, // W
+    { 0x58, 27 }, // X
+    { 0x59, 28 }, // Y
+    { 0x5A, 29 }, // Z
+    { 0x5B, 30 }, // [
+    { 0x5C, 31 }, // <backslash>
+    { 0x61, 32 }, // a
+    { 0x62, 33 }, // b
+    { 0x63, 34 }, // c
+    { 0x64, 35 }, // d
+    { 0x65, 36 }, // e
+    { 0x66, 37 }, // f
+    { 0x67, 38 }, // g
+    { 0x68, 39 }, // h
+    { 0x69, 35 }, // i
+    { 0x6A, 40 }, // j
+    { 0x6B, 41 }, // k
+    { 0x6C, 42 }, // l
+    { 0x6D, 39 }, // m
+    { 0x6E, 39 }, // n
+    { 0x6F, 33 }, // o
+    { 0x70, 33 }, // p
+    { 0x71, 43 }, // q
+    { 0x72, 44 }, // r
+    { 0x73, 45 }, // s
+    { 0x74, 46 }, // t
+    { 0x75, 47 }, // u
+    { 0x76, 48 }, // v
+    { 0x77, 48 }, // w
+    { 0x78, 49 }, // x
+    { 0x79, 48 }, // y
+    { 0x7A, 50 }, // z
+    { 0x7B, 51 }, // {
+    { 0xA1, 52 }, // ¡
+    { 0xAB, 53 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 54 }, // »
+    { 0xBF, 55 }, // ¿
+    { 0xC0, 8 }, // À
+    { 0xC1, 8 }, // Á
+    { 0xC2, 8 }, // Â
+    { 0xC3, 8 }, // Ã
+    { 0xC4, 8 }, // Ä
+    { 0xC5, 8 }, // Å
+    { 0xC7, 10 }, // Ç
+    { 0xCC, 14 }, // Ì
+    { 0xCD, 14 }, // Í
+    { 0xCE, 14 }, // Î
+    { 0xCF, 14 }, // Ï
+    { 0xD0, 11 }, // Ð
+    { 0xD1, 19 }, // Ñ
+    { 0xD2, 11 }, // Ò
+    { 0xD3, 11 }, // Ó
+    { 0xD4, 11 }, // Ô
+    { 0xD5, 11 }, // Õ
+    { 0xD6, 11 }, // Ö
+    { 0xD8, 56 }, // Ø
+    { 0xD9, 25 }, // Ù
+    { 0xDA, 25 }, // Ú
+    { 0xDB, 25 }, // Û
+    { 0xDC, 25 }, // Ü
+    { 0xDD, 28 }, // Ý
+    { 0xDE, 57 }, // Þ
+    { 0xDF, 58 }, // ß
+    { 0xE0, 32 }, // à
+    { 0xE1, 32 }, // á
+    { 0xE2, 32 }, // â
+    { 0xE3, 32 }, // ã
+    { 0xE4, 32 }, // ä
+    { 0xE5, 32 }, // å
+    { 0xE6, 36 }, // æ
+    { 0xE7, 34 }, // ç
+    { 0xE8, 36 }, // è
+    { 0xE9, 36 }, // é
+    { 0xEA, 36 }, // ê
+    { 0xEB, 36 }, // ë
+    { 0xEC, 35 }, // ì
+    { 0xED, 35 }, // í
+    { 0xEE, 59 }, // î
+    { 0xEF, 59 }, // ï
+    { 0xF0, 60 }, // ð
+    { 0xF1, 39 }, // ñ
+    { 0xF2, 33 }, // ò
+    { 0xF3, 33 }, // ó
+    { 0xF4, 33 }, // ô
+    { 0xF5, 33 }, // õ
+    { 0xF6, 33 }, // ö
+    { 0xF8, 33 }, // ø
+    { 0xF9, 47 }, // ù
+    { 0xFA, 47 }, // ú
+    { 0xFB, 47 }, // û
+    { 0xFC, 47 }, // ü
+    { 0xFD, 48 }, // ý
+    { 0xFE, 33 }, // þ
+    { 0xFF, 48 }, // ÿ
+    { 0x100, 8 }, // Ā
+    { 0x101, 32 }, // ā
+    { 0x102, 8 }, // Ă
+    { 0x103, 32 }, // ă
+    { 0x104, 61 }, // Ą
+    { 0x105, 62 }, // ą
+    { 0x106, 10 }, // Ć
+    { 0x107, 34 }, // ć
+    { 0x108, 10 }, // Ĉ
+    { 0x109, 34 }, // ĉ
+    { 0x10A, 10 }, // Ċ
+    { 0x10B, 34 }, // ċ
+    { 0x10C, 10 }, // Č
+    { 0x10D, 34 }, // č
+    { 0x10E, 11 }, // Ď
+    { 0x10F, 63 }, // ď
+    { 0x110, 11 }, // Đ
+    { 0x111, 35 }, // đ
+    { 0x113, 36 }, // ē
+    { 0x115, 36 }, // ĕ
+    { 0x117, 36 }, // ė
+    { 0x118, 64 }, // Ę
+    { 0x119, 65 }, // ę
+    { 0x11B, 36 }, // ě
+    { 0x11C, 13 }, // Ĝ
+    { 0x11D, 38 }, // ĝ
+    { 0x11E, 13 }, // Ğ
+    { 0x11F, 38 }, // ğ
+    { 0x120, 13 }, // Ġ
+    { 0x121, 38 }, // ġ
+    { 0x122, 13 }, // Ģ
+    { 0x123, 38 }, // ģ
+    { 0x124, 14 }, // Ĥ
+    { 0x125, 39 }, // ĥ
+    { 0x126, 14 }, // Ħ
+    { 0x127, 39 }, // ħ
+    { 0x128, 14 }, // Ĩ
+    { 0x129, 59 }, // ĩ
+    { 0x12A, 14 }, // Ī
+    { 0x12B, 59 }, // ī
+    { 0x12C, 14 }, // Ĭ
+    { 0x12D, 59 }, // ĭ
+    { 0x12E, 66 }, // Į
+    { 0x12F, 67 }, // į
+    { 0x130, 14 }, // İ
+    { 0x131, 35 }, // ı
+    { 0x132, 15 }, // Ĳ
+    { 0x133, 40 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 68 }, // ĵ
+    { 0x136, 16 }, // Ķ
+    { 0x137, 41 }, // ķ
+    { 0x138, 41 }, // ĸ
+    { 0x139, 17 }, // Ĺ
+    { 0x13A, 42 }, // ĺ
+    { 0x13B, 17 }, // Ļ
+    { 0x13C, 42 }, // ļ
+    { 0x13E, 63 }, // ľ
+    { 0x141, 17 }, // Ł
+    { 0x142, 69 }, // ł
+    { 0x143, 19 }, // Ń
+    { 0x144, 39 }, // ń
+    { 0x145, 19 }, // Ņ
+    { 0x146, 39 }, // ņ
+    { 0x147, 19 }, // Ň
+    { 0x148, 39 }, // ň
+    { 0x149, 39 }, // ŉ
+    { 0x14A, 19 }, // Ŋ
+    { 0x14B, 39 }, // ŋ
+    { 0x14C, 11 }, // Ō
+    { 0x14D, 33 }, // ō
+    { 0x14E, 11 }, // Ŏ
+    { 0x14F, 33 }, // ŏ
+    { 0x150, 11 }, // Ő
+    { 0x151, 33 }, // ő
+    { 0x153, 36 }, // œ
+    { 0x154, 22 }, // Ŕ
+    { 0x155, 44 }, // ŕ
+    { 0x156, 22 }, // Ŗ
+    { 0x157, 44 }, // ŗ
+    { 0x158, 22 }, // Ř
+    { 0x159, 44 }, // ř
+    { 0x15A, 23 }, // Ś
+    { 0x15B, 45 }, // ś
+    { 0x15C, 23 }, // Ŝ
+    { 0x15D, 45 }, // ŝ
+    { 0x15E, 23 }, // Ş
+    { 0x15F, 45 }, // ş
+    { 0x160, 23 }, // Š
+    { 0x161, 45 }, // š
+    { 0x162, 24 }, // Ţ
+    { 0x163, 70 }, // ţ
+    { 0x164, 24 }, // Ť
+    { 0x166, 24 }, // Ŧ
+    { 0x167, 46 }, // ŧ
+    { 0x168, 25 }, // Ũ
+    { 0x169, 47 }, // ũ
+    { 0x16A, 25 }, // Ū
+    { 0x16B, 47 }, // ū
+    { 0x16C, 25 }, // Ŭ
+    { 0x16D, 47 }, // ŭ
+    { 0x16E, 25 }, // Ů
+    { 0x16F, 47 }, // ů
+    { 0x170, 25 }, // Ű
+    { 0x171, 47 }, // ű
+    { 0x172, 25 }, // Ų
+    { 0x173, 71 }, // ų
+    { 0x174, 26 }, // Ŵ
+    { 0x175, 48 }, // ŵ
+    { 0x176, 28 }, // Ŷ
+    { 0x177, 48 }, // ŷ
+    { 0x178, 28 }, // Ÿ
+    { 0x179, 29 }, // Ź
+    { 0x17A, 50 }, // ź
+    { 0x17B, 29 }, // Ż
+    { 0x17C, 50 }, // ż
+    { 0x17D, 29 }, // Ž
+    { 0x17E, 50 }, // ž
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 72 }, // ‘
+    { 0x2019, 73 }, // ’
+    { 0x201A, 4 }, // ‚
+    { 0x201B, 72 }, // ‛
+    { 0x201C, 72 }, // “
+    { 0x201D, 73 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x201F, 72 }, // ‟
+    { 0x2025, 4 }, // ‥
+    { 0x2026, 4 }, // …
+    { 0x2039, 53 }, // ‹
+    { 0x203A, 54 }, // ›
+    { 0xFB00, 37 }, // ﬀ
+    { 0xFB01, 35 }, // ﬁ
+    { 0xFB02, 42 }, // ﬂ
+    { 0xFB03, 35 }, // ﬃ
+    { 0xFB04, 42 }, // ﬄ
+};
+
+static const EpdKernClassEntry bookerly_14_regularKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x27, 2 }, // '
+    { 0x29, 3 }, // )
+    { 0x2A, 4 }, // *
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 7 }, // .
+    { 0x2F, 8 }, // /
+    { 0x3A, 9 }, // :
+    { 0x3B, 10 }, // ;
+    { 0x3F, 11 }, // ?
+    { 0x41, 12 }, // A
+    { 0x42, 13 }, // B
+    { 0x43, 14 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 13 }, // E
+    { 0x46, 13 }, // F
+    { 0x47, 14 }, // G
+    { 0x48, 13 }, // H
+    { 0x49, 13 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 13 }, // K
+    { 0x4C, 13 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 13 }, // N
+    { 0x4F, 14 }, // O
+    { 0x50, 13 }, // P
+    { 0x51, 14 }, // Q
+    { 0x52, 13 }, // R
+    { 0x53, 17 }, // S
+    { 0x54, 18 }, // T
+    { 0x55, 19 }, // U
+    { 0x56, 20 }, // V
+    { 0x57, 20 }, // W
+    { 0x58, 21 }, // X
+    { 0x59, 22 }, // Y
+    { 0x5A, 23 }, // Z
+    { 0x5C, 24 }, // <backslash>
+    { 0x5D, 25 }, // ]
+    { 0x61, 26 }, // a
+    { 0x62, 27 }, // b
+    { 0x63, 28 }, // c
+    { 0x64, 28 }, // d
+    { 0x65, 28 }, // e
+    { 0x66, 29 }, // f
+    { 0x67, 30 }, // g
+    { 0x68, 31 }, // h
+    { 0x69, 32 }, // i
+    { 0x6A, 33 }, // j
+    { 0x6B, 31 }, // k
+    { 0x6C, 31 }, // l
+    { 0x6D, 34 }, // m
+    { 0x6E, 34 }, // n
+    { 0x6F, 28 }, // o
+    { 0x70, 35 }, // p
+    { 0x71, 28 }, // q
+    { 0x72, 34 }, // r
+    { 0x73, 36 }, // s
+    { 0x74, 37 }, // t
+    { 0x75, 38 }, // u
+    { 0x76, 39 }, // v
+    { 0x77, 39 }, // w
+    { 0x78, 40 }, // x
+    { 0x79, 41 }, // y
+    { 0x7A, 42 }, // z
+    { 0x7D, 43 }, // }
+    { 0xAB, 44 }, // «
+    { 0xAD, 6 }, // ­
+    { 0xBB, 45 }, // »
+    { 0xBF, 46 }, // ¿
+    { 0xC0, 12 }, // À
+    { 0xC1, 12 }, // Á
+    { 0xC2, 12 }, // Â
+    { 0xC3, 12 }, // Ã
+    { 0xC4, 12 }, // Ä
+    { 0xC5, 12 }, // Å
+    { 0xC6, 47 }, // Æ
+    { 0xC7, 14 }, // Ç
+    { 0xC8, 13 }, // È
+    { 0xC9, 13 }, // É
+    { 0xCA, 13 }, // Ê
+    { 0xCB, 13 }, // Ë
+    { 0xCC, 13 }, // Ì
+    { 0xCD, 13 }, // Í
+    { 0xCE, 13 }, // Î
+    { 0xCF, 13 }, // Ï
+    { 0xD0, 13 }, // Ð
+    { 0xD1, 13 }, // Ñ
+    { 0xD2, 14 }, // Ò
+    { 0xD3, 14 }, // Ó
+    { 0xD4, 14 }, // Ô
+    { 0xD5, 14 }, // Õ
+    { 0xD6, 14 }, // Ö
+    { 0xD8, 48 }, // Ø
+    { 0xD9, 19 }, // Ù
+    { 0xDA, 19 }, // Ú
+    { 0xDB, 19 }, // Û
+    { 0xDC, 19 }, // Ü
+    { 0xDD, 22 }, // Ý
+    { 0xDE, 13 }, // Þ
+    { 0xDF, 49 }, // ß
+    { 0xE0, 26 }, // à
+    { 0xE1, 26 }, // á
+    { 0xE2, 26 }, // â
+    { 0xE3, 50 }, // ã
+    { 0xE4, 51 }, // ä
+    { 0xE5, 26 }, // å
+    { 0xE6, 26 }, // æ
+    { 0xE7, 28 }, // ç
+    { 0xE8, 28 }, // è
+    { 0xE9, 28 }, // é
+    { 0xEA, 28 }, // ê
+    { 0xEB, 52 }, // ë
+    { 0xEC, 53 }, // ì
+    { 0xED, 32 }, // í
+    { 0xEE, 54 }, // î
+    { 0xEF, 55 }, // ï
+    { 0xF0, 28 }, // ð
+    { 0xF1, 34 }, // ñ
+    { 0xF2, 28 }, // ò
+    { 0xF3, 28 }, // ó
+    { 0xF4, 28 }, // ô
+    { 0xF5, 28 }, // õ
+    { 0xF6, 28 }, // ö
+    { 0xF8, 56 }, // ø
+    { 0xF9, 38 }, // ù
+    { 0xFA, 38 }, // ú
+    { 0xFB, 38 }, // û
+    { 0xFC, 38 }, // ü
+    { 0xFD, 41 }, // ý
+    { 0xFE, 31 }, // þ
+    { 0xFF, 41 }, // ÿ
+    { 0x100, 12 }, // Ā
+    { 0x101, 57 }, // ā
+    { 0x102, 12 }, // Ă
+    { 0x103, 58 }, // ă
+    { 0x104, 12 }, // Ą
+    { 0x105, 26 }, // ą
+    { 0x106, 14 }, // Ć
+    { 0x107, 28 }, // ć
+    { 0x108, 14 }, // Ĉ
+    { 0x109, 28 }, // ĉ
+    { 0x10A, 14 }, // Ċ
+    { 0x10B, 28 }, // ċ
+    { 0x10C, 14 }, // Č
+    { 0x10D, 28 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 28 }, // ď
+    { 0x110, 13 }, // Đ
+    { 0x111, 28 }, // đ
+    { 0x112, 13 }, // Ē
+    { 0x113, 28 }, // ē
+    { 0x114, 13 }, // Ĕ
+    { 0x115, 28 }, // ĕ
+    { 0x116, 13 }, // Ė
+    { 0x117, 28 }, // ė
+    { 0x118, 13 }, // Ę
+    { 0x119, 28 }, // ę
+    { 0x11A, 13 }, // Ě
+    { 0x11B, 28 }, // ě
+    { 0x11C, 14 }, // Ĝ
+    { 0x11D, 30 }, // ĝ
+    { 0x11E, 14 }, // Ğ
+    { 0x11F, 30 }, // ğ
+    { 0x120, 14 }, // Ġ
+    { 0x121, 30 }, // ġ
+    { 0x122, 14 }, // Ģ
+    { 0x123, 30 }, // ģ
+    { 0x124, 13 }, // Ĥ
+    { 0x125, 31 }, // ĥ
+    { 0x126, 13 }, // Ħ
+    { 0x127, 59 }, // ħ
+    { 0x128, 13 }, // Ĩ
+    { 0x129, 55 }, // ĩ
+    { 0x12A, 13 }, // Ī
+    { 0x12B, 55 }, // ī
+    { 0x12C, 13 }, // Ĭ
+    { 0x12D, 55 }, // ĭ
+    { 0x12E, 13 }, // Į
+    { 0x12F, 32 }, // į
+    { 0x130, 13 }, // İ
+    { 0x131, 32 }, // ı
+    { 0x132, 13 }, // Ĳ
+    { 0x133, 32 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 60 }, // ĵ
+    { 0x136, 13 }, // Ķ
+    { 0x137, 31 }, // ķ
+    { 0x138, 34 }, // ĸ
+    { 0x139, 13 }, // Ĺ
+    { 0x13A, 31 }, // ĺ
+    { 0x13B, 13 }, // Ļ
+    { 0x13C, 31 }, // ļ
+    { 0x13D, 13 }, // Ľ
+    { 0x13E, 31 }, // ľ
+    { 0x13F, 13 }, // Ŀ
+    { 0x140, 31 }, // ŀ
+    { 0x141, 13 }, // Ł
+    { 0x142, 61 }, // ł
+    { 0x143, 13 }, // Ń
+    { 0x144, 34 }, // ń
+    { 0x145, 13 }, // Ņ
+    { 0x146, 34 }, // ņ
+    { 0x147, 13 }, // Ň
+    { 0x148, 34 }, // ň
+    { 0x149, 34 }, // ŉ
+    { 0x14A, 13 }, // Ŋ
+    { 0x14B, 34 }, // ŋ
+    { 0x14C, 14 }, // Ō
+    { 0x14D, 28 }, // ō
+    { 0x14E, 14 }, // Ŏ
+    { 0x14F, 28 }, // ŏ
+    { 0x150, 14 }, // Ő
+    { 0x151, 28 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x153, 28 }, // œ
+    { 0x154, 13 }, // Ŕ
+    { 0x155, 34 }, // ŕ
+    { 0x156, 13 }, // Ŗ
+    { 0x157, 34 }, // ŗ
+    { 0x158, 13 }, // Ř
+    { 0x159, 62 }, // ř
+    { 0x15A, 17 }, // Ś
+    { 0x15B, 36 }, // ś
+    { 0x15C, 17 }, // Ŝ
+    { 0x15D, 36 }, // ŝ
+    { 0x15E, 17 }, // Ş
+    { 0x15F, 36 }, // ş
+    { 0x160, 17 }, // Š
+    { 0x161, 63 }, // š
+    { 0x162, 18 }, // Ţ
+    { 0x163, 37 }, // ţ
+    { 0x164, 18 }, // Ť
+    { 0x165, 37 }, // ť
+    { 0x166, 18 }, // Ŧ
+    { 0x167, 37 }, // ŧ
+    { 0x168, 19 }, // Ũ
+    { 0x169, 38 }, // ũ
+    { 0x16A, 19 }, // Ū
+    { 0x16B, 38 }, // ū
+    { 0x16C, 19 }, // Ŭ
+    { 0x16D, 38 }, // ŭ
+    { 0x16E, 19 }, // Ů
+    { 0x16F, 38 }, // ů
+    { 0x170, 19 }, // Ű
+    { 0x171, 38 }, // ű
+    { 0x172, 19 }, // Ų
+    { 0x173, 38 }, // ų
+    { 0x174, 20 }, // Ŵ
+    { 0x175, 39 }, // ŵ
+    { 0x176, 22 }, // Ŷ
+    { 0x177, 41 }, // ŷ
+    { 0x178, 22 }, // Ÿ
+    { 0x179, 23 }, // Ź
+    { 0x17A, 42 }, // ź
+    { 0x17B, 23 }, // Ż
+    { 0x17C, 42 }, // ż
+    { 0x17D, 23 }, // Ž
+    { 0x17E, 64 }, // ž
+    { 0x17F, 49 }, // ſ
+    { 0x2010, 6 }, // ‐
+    { 0x2011, 6 }, // ‑
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 65 }, // ‘
+    { 0x2019, 66 }, // ’
+    { 0x201A, 7 }, // ‚
+    { 0x201B, 65 }, // ‛
+    { 0x201C, 65 }, // “
+    { 0x201D, 66 }, // ”
+    { 0x201E, 7 }, // „
+    { 0x201F, 65 }, // ‟
+    { 0x2025, 7 }, // ‥
+    { 0x2026, 7 }, // …
+    { 0x2039, 44 }, // ‹
+    { 0x203A, 45 }, // ›
+    { 0xFB00, 29 }, // ﬀ
+    { 0xFB01, 29 }, // ﬁ
+    { 0xFB02, 29 }, // ﬂ
+    { 0xFB03, 29 }, // ﬃ
+    { 0xFB04, 29 }, // ﬄ
+};
+
+static const int8_t bookerly_14_regularKernMatrix[4818] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 1, 1, -1, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, -1, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -3, -1, -2, 0, 0, 0, -1, -1, -3, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -4, -1, 0, -3, -3, -3, 0, 1, 1, -3, -3, -3, 0, 0, 0, -1, -3, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, -1, 0, 1, 0, 0, -2, 1, 0, -1, 0, 1, 0, -3, -2, -3, 1, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 1, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, -3, 0, -3, -2, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, -1, -1, -1, 0, 1, 1, -1, -1, -1, 0, 1, 0, 0, -1, -1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 1, 1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 1, 0, 1, -3, 0, -3, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, -1, 0, 1, 1,
+    0, 0, 1, 0, 1, 0, -1, -1, 0, 1, 0, -1, 0, 0, 3, 0, 0, 0, 0, -1, -1, -1, 0, -1, 1, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 2, 0, 2, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 1, 0, -1, -1, -2, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, -1, -3, -4, -1, -1, 0, -3, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -3, -1, 0, -2, -2, -2, 0, 1, 1, -2, -2, -2, 0, 0, 0, 0, -2, -1, 1, 1,
+    0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, 0, -1, -1, -1, 0, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0,
+    0, 0, 0, 1, -3, -1, -3, -4, -1, -1, 0, -3, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, -2, 1, -2, -1, -3, 1, 0, 0, -1, -1, -2, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -4, -1, 0, -1, -1, -2, 0, 2, 2, -2, -1, -2, 1, 2, 1, -1, -2, -1, 0, 1,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -1, -2, -3, -1, -1, 0, -3, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, -2, 1, -2, -1, -2, 1, 0, 0, -1, -1, -2, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -3, -1, 0, -2, -1, -2, 0, 1, 2, -2, -1, -1, 1, 1, 1, -1, -2, -1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -3, 0, -2, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0,
+    2, 3, 3, 3, -1, 0, -1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 1, 1, 1, 3, 2, 4, 0, 1, 0, 3, 3, 0, 1, 1, 1, 2, 3,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 1, -2, -1, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 1, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, -1, 0, 1, 0, 1, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 1, -1, 0, -1, 0, 1, 1,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0,
+    0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -2, 0, -2, -3, 0, 0, -1, -3, -1, 0, -1, -1, -1, -1, -1, -2, -2, -2, 0, -2, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1,
+    0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1,
+    0, -1, 0, -2, 0, -1, 0, 1, 0, 0, -2, 1, 0, -1, 1, 1, 0, -3, -2, -3, 1, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -2, 1, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -3, -2,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -1, -1,
+    1, 0, 3, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 3, 0, 1, 0, 3, 1, 2, 0, 0, 0, 1, 1, 1, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 3, 3, 3, 1, 1, 1, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, -1, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4, 0, 0, 0, 0, -1, 0, 1, 1, -1, 0, 0, 1, 1, 1, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -3, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -5, -1, 0, -1, -1, -1, 0, 1, 1, -1, -1, -1, 0, 1, 0, 0, -2, -1, 0, 0,
+};
+
+static const EpdLigaturePair bookerly_14_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_14_regular = {
     bookerly_14_regularBitmaps,
     bookerly_14_regularGlyphs,
     bookerly_14_regularIntervals,
-    60,
+    61,
     38,
     31,
     -8,
     true,
+    bookerly_14_regularKernLeftClasses,
+    265,
+    bookerly_14_regularKernRightClasses,
+    283,
+    bookerly_14_regularKernMatrix,
+    73,
+    66,
+    bookerly_14_regularLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_bolditalicBitmaps[88512] = {
+static const uint8_t bookerly_16_bolditalicBitmaps[89933] = {
     0x00, 0x06, 0xA0, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFD,
     0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
     0x00, 0x07, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
@@ -5540,6 +5540,95 @@ static const uint8_t bookerly_16_bolditalicBitmaps[88512] = {
     0x7F, 0xE0, 0x15, 0x00, 0x0A, 0x90, 0x00, 0x2A, 0x40, 0x00, 0xA9, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
     0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x7F, 0xF5, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x1F,
     0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBA, 0x40, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x7F,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xFF,
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
+    0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
+    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
+    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x1F,
+    0xFD, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x5F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0x90, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9,
+    0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x03, 0xFF, 0x9B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x03, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x16, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00,
+    0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
+    0x00, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xE1, 0xC0, 0x00,
+    0x07, 0xFC, 0x00, 0xFF, 0xEF, 0x40, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80,
+    0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F,
+    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0xBE, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F,
+    0xF0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07,
+    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
+    0x00, 0x6F, 0xFF, 0xFE, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x1F, 0xF0, 0x00, 0x03, 0xFF,
+    0xFF, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
+    0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0,
+    0x00, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00,
+    0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0,
+    0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x03, 0xFE, 0x18, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFF,
+    0xBC, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00,
+    0x00, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x2F, 0xFF,
+    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+    0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F,
+    0xF8, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFD,
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF,
+    0x40, 0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00,
+    0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40,
+    0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0,
+    0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x24, 0x00,
+    0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x7F, 0xEF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xD0, 0x0B,
+    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00,
+    0xBF, 0xC0, 0x03, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+    0x00, 0x03, 0xC0, 0x7F, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x5F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xBF,
+    0xF9, 0x0B, 0xFF, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0x80,
+    0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8,
+    0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00,
+    0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC2, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFC,
+    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F,
+    0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF0,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x7F,
+    0xC0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01,
+    0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x7F, 0xC3, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xFF,
+    0xBE, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x07,
+    0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+    0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0xFD, 0x02,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x5F, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x90, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
 static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
@@ -6271,6 +6360,11 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 19, 23, 33, 7, 23, 110, 88347 }, // ⊥
     { 7, 6, 21, 7, 12, 11, 88457 }, // ⋅
     { 29, 6, 33, 2, 12, 44, 88468 }, // ⋯
+    { 35, 34, 24, -6, 26, 298, 88512 }, // ﬀ
+    { 27, 34, 21, -6, 26, 230, 88810 }, // ﬁ
+    { 28, 34, 22, -6, 26, 238, 89040 }, // ﬂ
+    { 38, 34, 32, -6, 26, 323, 89278 }, // ﬃ
+    { 39, 34, 33, -6, 26, 332, 89601 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_16_bolditalicIntervals[] = {
@@ -6334,15 +6428,673 @@ static const EpdUnicodeInterval bookerly_16_bolditalicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_16_bolditalicKernLeftClasses[] = {
+    { 0x28, 1 }, // (
+    { 0x2A, 2 }, // *
+    { 0x2C, 3 }, // ,
+    { 0x2D, 4 }, // -
+    { 0x2E, 3 }, // .
+    { 0x2F, 5 }, // /
+    { 0x3A, 6 }, // :
+    { 0x3B, 6 }, // ;
+    { 0x41, 7 }, // A
+    { 0x42, 8 }, // B
+    { 0x43, 9 }, // C
+    { 0x44, 10 }, // D
+    { 0x45, 11 }, // E
+    { 0x46, 12 }, // F
+    { 0x47, 13 }, // G
+    { 0x48, 14 }, // H
+    { 0x49, 14 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 16 }, // K
+    { 0x4C, 17 }, // L
+    { 0x4D, 18 }, // M
+    { 0x4E, 19 }, // N
+    { 0x4F, 10 }, // O
+    { 0x50, 20 }, // P
+    { 0x51, 21 }, // Q
+    { 0x52, 22 }, // R
+    { 0x53, 23 }, // S
+    { 0x54, 24 }, // T
+    { 0x55, 25 }, // U
+    { 0x56, 26 }, // V
+    { 0x57, 26 }, // W
+    { 0x58, 27 }, // X
+    { 0x59, 28 }, // Y
+    { 0x5A, 29 }, // Z
+    { 0x5B, 30 }, // [
+    { 0x5C, 31 }, // <backslash>
+    { 0x61, 32 }, // a
+    { 0x62, 33 }, // b
+    { 0x63, 34 }, // c
+    { 0x64, 35 }, // d
+    { 0x65, 36 }, // e
+    { 0x66, 37 }, // f
+    { 0x67, 38 }, // g
+    { 0x68, 39 }, // h
+    { 0x69, 35 }, // i
+    { 0x6A, 40 }, // j
+    { 0x6B, 41 }, // k
+    { 0x6C, 42 }, // l
+    { 0x6D, 39 }, // m
+    { 0x6E, 39 }, // n
+    { 0x6F, 33 }, // o
+    { 0x70, 33 }, // p
+    { 0x71, 43 }, // q
+    { 0x72, 44 }, // r
+    { 0x73, 45 }, // s
+    { 0x74, 46 }, // t
+    { 0x75, 32 }, // u
+    { 0x76, 47 }, // v
+    { 0x77, 47 }, // w
+    { 0x78, 48 }, // x
+    { 0x79, 47 }, // y
+    { 0x7A, 49 }, // z
+    { 0x7B, 50 }, // {
+    { 0xA1, 51 }, // ¡
+    { 0xAD, 4 }, // ­
+    { 0xBB, 52 }, // »
+    { 0xBF, 53 }, // ¿
+    { 0xC0, 7 }, // À
+    { 0xC1, 7 }, // Á
+    { 0xC2, 7 }, // Â
+    { 0xC3, 7 }, // Ã
+    { 0xC4, 7 }, // Ä
+    { 0xC5, 7 }, // Å
+    { 0xC6, 11 }, // Æ
+    { 0xC7, 9 }, // Ç
+    { 0xC8, 11 }, // È
+    { 0xC9, 11 }, // É
+    { 0xCA, 11 }, // Ê
+    { 0xCB, 11 }, // Ë
+    { 0xCC, 14 }, // Ì
+    { 0xCD, 14 }, // Í
+    { 0xCE, 14 }, // Î
+    { 0xCF, 14 }, // Ï
+    { 0xD0, 10 }, // Ð
+    { 0xD1, 19 }, // Ñ
+    { 0xD2, 10 }, // Ò
+    { 0xD3, 10 }, // Ó
+    { 0xD4, 10 }, // Ô
+    { 0xD5, 10 }, // Õ
+    { 0xD6, 10 }, // Ö
+    { 0xD8, 10 }, // Ø
+    { 0xD9, 25 }, // Ù
+    { 0xDA, 25 }, // Ú
+    { 0xDB, 25 }, // Û
+    { 0xDC, 25 }, // Ü
+    { 0xDD, 28 }, // Ý
+    { 0xDE, 54 }, // Þ
+    { 0xDF, 55 }, // ß
+    { 0xE0, 32 }, // à
+    { 0xE1, 32 }, // á
+    { 0xE2, 32 }, // â
+    { 0xE3, 32 }, // ã
+    { 0xE4, 32 }, // ä
+    { 0xE5, 32 }, // å
+    { 0xE6, 36 }, // æ
+    { 0xE7, 56 }, // ç
+    { 0xE8, 36 }, // è
+    { 0xE9, 36 }, // é
+    { 0xEA, 36 }, // ê
+    { 0xEB, 36 }, // ë
+    { 0xEC, 35 }, // ì
+    { 0xED, 57 }, // í
+    { 0xEE, 58 }, // î
+    { 0xEF, 58 }, // ï
+    { 0xF0, 33 }, // ð
+    { 0xF1, 39 }, // ñ
+    { 0xF2, 33 }, // ò
+    { 0xF3, 33 }, // ó
+    { 0xF4, 33 }, // ô
+    { 0xF5, 33 }, // õ
+    { 0xF6, 33 }, // ö
+    { 0xF8, 59 }, // ø
+    { 0xF9, 32 }, // ù
+    { 0xFA, 32 }, // ú
+    { 0xFB, 32 }, // û
+    { 0xFC, 32 }, // ü
+    { 0xFD, 47 }, // ý
+    { 0xFE, 33 }, // þ
+    { 0xFF, 47 }, // ÿ
+    { 0x100, 7 }, // Ā
+    { 0x101, 32 }, // ā
+    { 0x102, 7 }, // Ă
+    { 0x103, 32 }, // ă
+    { 0x104, 60 }, // Ą
+    { 0x105, 61 }, // ą
+    { 0x106, 9 }, // Ć
+    { 0x107, 34 }, // ć
+    { 0x108, 9 }, // Ĉ
+    { 0x109, 34 }, // ĉ
+    { 0x10A, 9 }, // Ċ
+    { 0x10B, 34 }, // ċ
+    { 0x10C, 9 }, // Č
+    { 0x10D, 34 }, // č
+    { 0x10E, 10 }, // Ď
+    { 0x10F, 62 }, // ď
+    { 0x110, 10 }, // Đ
+    { 0x111, 35 }, // đ
+    { 0x112, 11 }, // Ē
+    { 0x113, 36 }, // ē
+    { 0x114, 11 }, // Ĕ
+    { 0x115, 36 }, // ĕ
+    { 0x116, 11 }, // Ė
+    { 0x117, 36 }, // ė
+    { 0x118, 63 }, // Ę
+    { 0x119, 64 }, // ę
+    { 0x11A, 11 }, // Ě
+    { 0x11B, 36 }, // ě
+    { 0x11C, 13 }, // Ĝ
+    { 0x11D, 38 }, // ĝ
+    { 0x11E, 13 }, // Ğ
+    { 0x11F, 38 }, // ğ
+    { 0x120, 13 }, // Ġ
+    { 0x121, 38 }, // ġ
+    { 0x122, 13 }, // Ģ
+    { 0x123, 38 }, // ģ
+    { 0x124, 14 }, // Ĥ
+    { 0x125, 39 }, // ĥ
+    { 0x126, 65 }, // Ħ
+    { 0x127, 39 }, // ħ
+    { 0x128, 14 }, // Ĩ
+    { 0x129, 58 }, // ĩ
+    { 0x12A, 14 }, // Ī
+    { 0x12B, 58 }, // ī
+    { 0x12C, 14 }, // Ĭ
+    { 0x12D, 58 }, // ĭ
+    { 0x12E, 66 }, // Į
+    { 0x12F, 67 }, // į
+    { 0x130, 14 }, // İ
+    { 0x131, 32 }, // ı
+    { 0x132, 15 }, // Ĳ
+    { 0x133, 40 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 68 }, // ĵ
+    { 0x136, 16 }, // Ķ
+    { 0x137, 41 }, // ķ
+    { 0x138, 69 }, // ĸ
+    { 0x139, 17 }, // Ĺ
+    { 0x13A, 42 }, // ĺ
+    { 0x13B, 17 }, // Ļ
+    { 0x13C, 70 }, // ļ
+    { 0x13E, 62 }, // ľ
+    { 0x141, 17 }, // Ł
+    { 0x142, 71 }, // ł
+    { 0x143, 19 }, // Ń
+    { 0x144, 39 }, // ń
+    { 0x145, 19 }, // Ņ
+    { 0x146, 39 }, // ņ
+    { 0x147, 19 }, // Ň
+    { 0x148, 39 }, // ň
+    { 0x149, 39 }, // ŉ
+    { 0x14A, 19 }, // Ŋ
+    { 0x14B, 40 }, // ŋ
+    { 0x14C, 10 }, // Ō
+    { 0x14D, 33 }, // ō
+    { 0x14E, 10 }, // Ŏ
+    { 0x14F, 33 }, // ŏ
+    { 0x150, 10 }, // Ő
+    { 0x151, 33 }, // ő
+    { 0x152, 11 }, // Œ
+    { 0x153, 36 }, // œ
+    { 0x154, 22 }, // Ŕ
+    { 0x155, 44 }, // ŕ
+    { 0x156, 22 }, // Ŗ
+    { 0x157, 44 }, // ŗ
+    { 0x158, 22 }, // Ř
+    { 0x159, 44 }, // ř
+    { 0x15A, 23 }, // Ś
+    { 0x15B, 45 }, // ś
+    { 0x15C, 23 }, // Ŝ
+    { 0x15D, 45 }, // ŝ
+    { 0x15E, 23 }, // Ş
+    { 0x15F, 72 }, // ş
+    { 0x160, 23 }, // Š
+    { 0x161, 45 }, // š
+    { 0x162, 24 }, // Ţ
+    { 0x163, 73 }, // ţ
+    { 0x164, 24 }, // Ť
+    { 0x166, 24 }, // Ŧ
+    { 0x167, 46 }, // ŧ
+    { 0x168, 25 }, // Ũ
+    { 0x169, 32 }, // ũ
+    { 0x16A, 25 }, // Ū
+    { 0x16B, 32 }, // ū
+    { 0x16C, 25 }, // Ŭ
+    { 0x16D, 32 }, // ŭ
+    { 0x16E, 25 }, // Ů
+    { 0x16F, 32 }, // ů
+    { 0x170, 25 }, // Ű
+    { 0x171, 32 }, // ű
+    { 0x172, 25 }, // Ų
+    { 0x173, 61 }, // ų
+    { 0x174, 26 }, // Ŵ
+    { 0x175, 47 }, // ŵ
+    { 0x176, 28 }, // Ŷ
+    { 0x177, 47 }, // ŷ
+    { 0x178, 28 }, // Ÿ
+    { 0x179, 29 }, // Ź
+    { 0x17A, 49 }, // ź
+    { 0x17B, 29 }, // Ż
+    { 0x17C, 49 }, // ż
+    { 0x17D, 29 }, // Ž
+    { 0x17E, 49 }, // ž
+    { 0x2010, 4 }, // ‐
+    { 0x2011, 4 }, // ‑
+    { 0x2013, 4 }, // –
+    { 0x2014, 4 }, // —
+    { 0x2015, 4 }, // ―
+    { 0x2018, 74 }, // ‘
+    { 0x2019, 75 }, // ’
+    { 0x201A, 76 }, // ‚
+    { 0x201B, 74 }, // ‛
+    { 0x201C, 74 }, // “
+    { 0x201D, 75 }, // ”
+    { 0x201E, 3 }, // „
+    { 0x2025, 3 }, // ‥
+    { 0x2026, 3 }, // …
+    { 0x203A, 52 }, // ›
+    { 0xFB00, 37 }, // ﬀ
+    { 0xFB01, 35 }, // ﬁ
+    { 0xFB02, 42 }, // ﬂ
+    { 0xFB03, 35 }, // ﬃ
+    { 0xFB04, 42 }, // ﬄ
+};
+
+static const EpdKernClassEntry bookerly_16_bolditalicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x27, 2 }, // '
+    { 0x29, 3 }, // )
+    { 0x2A, 4 }, // *
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 7 }, // .
+    { 0x2F, 8 }, // /
+    { 0x3A, 9 }, // :
+    { 0x3B, 10 }, // ;
+    { 0x3F, 11 }, // ?
+    { 0x41, 12 }, // A
+    { 0x42, 13 }, // B
+    { 0x43, 14 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 15 }, // E
+    { 0x46, 15 }, // F
+    { 0x47, 14 }, // G
+    { 0x48, 15 }, // H
+    { 0x49, 15 }, // I
+    { 0x4A, 16 }, // J
+    { 0x4B, 15 }, // K
+    { 0x4C, 15 }, // L
+    { 0x4D, 17 }, // M
+    { 0x4E, 15 }, // N
+    { 0x4F, 14 }, // O
+    { 0x50, 13 }, // P
+    { 0x51, 14 }, // Q
+    { 0x52, 13 }, // R
+    { 0x53, 1 }, // S
+    { 0x54, 18 }, // T
+    { 0x55, 19 }, // U
+    { 0x56, 20 }, // V
+    { 0x57, 20 }, // W
+    { 0x58, 21 }, // X
+    { 0x59, 22 }, // Y
+    { 0x5A, 23 }, // Z
+    { 0x5C, 24 }, // <backslash>
+    { 0x5D, 25 }, // ]
+    { 0x61, 26 }, // a
+    { 0x62, 27 }, // b
+    { 0x63, 26 }, // c
+    { 0x64, 26 }, // d
+    { 0x65, 26 }, // e
+    { 0x66, 28 }, // f
+    { 0x67, 29 }, // g
+    { 0x68, 27 }, // h
+    { 0x69, 30 }, // i
+    { 0x6A, 31 }, // j
+    { 0x6B, 27 }, // k
+    { 0x6C, 27 }, // l
+    { 0x6D, 32 }, // m
+    { 0x6E, 32 }, // n
+    { 0x6F, 26 }, // o
+    { 0x70, 32 }, // p
+    { 0x71, 26 }, // q
+    { 0x72, 32 }, // r
+    { 0x73, 33 }, // s
+    { 0x74, 34 }, // t
+    { 0x75, 35 }, // u
+    { 0x76, 36 }, // v
+    { 0x77, 36 }, // w
+    { 0x78, 37 }, // x
+    { 0x79, 38 }, // y
+    { 0x7A, 39 }, // z
+    { 0x7D, 40 }, // }
+    { 0xA1, 41 }, // ¡
+    { 0xAB, 42 }, // «
+    { 0xAD, 6 }, // ­
+    { 0xBB, 43 }, // »
+    { 0xBF, 44 }, // ¿
+    { 0xC0, 12 }, // À
+    { 0xC1, 12 }, // Á
+    { 0xC2, 12 }, // Â
+    { 0xC3, 12 }, // Ã
+    { 0xC4, 12 }, // Ä
+    { 0xC5, 12 }, // Å
+    { 0xC6, 45 }, // Æ
+    { 0xC7, 14 }, // Ç
+    { 0xC8, 15 }, // È
+    { 0xC9, 15 }, // É
+    { 0xCA, 15 }, // Ê
+    { 0xCB, 15 }, // Ë
+    { 0xCC, 15 }, // Ì
+    { 0xCD, 15 }, // Í
+    { 0xCE, 15 }, // Î
+    { 0xCF, 15 }, // Ï
+    { 0xD0, 13 }, // Ð
+    { 0xD1, 15 }, // Ñ
+    { 0xD2, 14 }, // Ò
+    { 0xD3, 14 }, // Ó
+    { 0xD4, 14 }, // Ô
+    { 0xD5, 14 }, // Õ
+    { 0xD6, 14 }, // Ö
+    { 0xD8, 14 }, // Ø
+    { 0xD9, 19 }, // Ù
+    { 0xDA, 19 }, // Ú
+    { 0xDB, 19 }, // Û
+    { 0xDC, 19 }, // Ü
+    { 0xDD, 22 }, // Ý
+    { 0xDE, 15 }, // Þ
+    { 0xDF, 46 }, // ß
+    { 0xE0, 26 }, // à
+    { 0xE1, 26 }, // á
+    { 0xE2, 26 }, // â
+    { 0xE3, 26 }, // ã
+    { 0xE4, 47 }, // ä
+    { 0xE5, 26 }, // å
+    { 0xE6, 26 }, // æ
+    { 0xE7, 26 }, // ç
+    { 0xE8, 26 }, // è
+    { 0xE9, 26 }, // é
+    { 0xEA, 26 }, // ê
+    { 0xEB, 26 }, // ë
+    { 0xEC, 48 }, // ì
+    { 0xED, 30 }, // í
+    { 0xEE, 49 }, // î
+    { 0xEF, 49 }, // ï
+    { 0xF0, 26 }, // ð
+    { 0xF1, 32 }, // ñ
+    { 0xF2, 26 }, // ò
+    { 0xF3, 26 }, // ó
+    { 0xF4, 26 }, // ô
+    { 0xF5, 26 }, // õ
+    { 0xF6, 26 }, // ö
+    { 0xF8, 50 }, // ø
+    { 0xF9, 35 }, // ù
+    { 0xFA, 35 }, // ú
+    { 0xFB, 35 }, // û
+    { 0xFC, 35 }, // ü
+    { 0xFD, 36 }, // ý
+    { 0xFE, 51 }, // þ
+    { 0xFF, 36 }, // ÿ
+    { 0x100, 12 }, // Ā
+    { 0x101, 26 }, // ā
+    { 0x102, 12 }, // Ă
+    { 0x103, 26 }, // ă
+    { 0x104, 12 }, // Ą
+    { 0x105, 26 }, // ą
+    { 0x106, 14 }, // Ć
+    { 0x107, 26 }, // ć
+    { 0x108, 14 }, // Ĉ
+    { 0x109, 26 }, // ĉ
+    { 0x10A, 14 }, // Ċ
+    { 0x10B, 26 }, // ċ
+    { 0x10C, 14 }, // Č
+    { 0x10D, 47 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 26 }, // ď
+    { 0x110, 13 }, // Đ
+    { 0x111, 26 }, // đ
+    { 0x112, 15 }, // Ē
+    { 0x113, 26 }, // ē
+    { 0x114, 15 }, // Ĕ
+    { 0x115, 26 }, // ĕ
+    { 0x116, 15 }, // Ė
+    { 0x117, 26 }, // ė
+    { 0x118, 15 }, // Ę
+    { 0x119, 26 }, // ę
+    { 0x11A, 15 }, // Ě
+    { 0x11B, 26 }, // ě
+    { 0x11C, 14 }, // Ĝ
+    { 0x11D, 29 }, // ĝ
+    { 0x11E, 14 }, // Ğ
+    { 0x11F, 29 }, // ğ
+    { 0x120, 14 }, // Ġ
+    { 0x121, 29 }, // ġ
+    { 0x122, 14 }, // Ģ
+    { 0x123, 29 }, // ģ
+    { 0x124, 15 }, // Ĥ
+    { 0x125, 27 }, // ĥ
+    { 0x126, 15 }, // Ħ
+    { 0x127, 27 }, // ħ
+    { 0x128, 15 }, // Ĩ
+    { 0x129, 49 }, // ĩ
+    { 0x12A, 15 }, // Ī
+    { 0x12B, 49 }, // ī
+    { 0x12C, 15 }, // Ĭ
+    { 0x12D, 49 }, // ĭ
+    { 0x12E, 15 }, // Į
+    { 0x12F, 30 }, // į
+    { 0x130, 15 }, // İ
+    { 0x131, 32 }, // ı
+    { 0x132, 15 }, // Ĳ
+    { 0x133, 30 }, // ĳ
+    { 0x134, 16 }, // Ĵ
+    { 0x135, 52 }, // ĵ
+    { 0x136, 15 }, // Ķ
+    { 0x137, 27 }, // ķ
+    { 0x138, 32 }, // ĸ
+    { 0x139, 15 }, // Ĺ
+    { 0x13A, 27 }, // ĺ
+    { 0x13B, 15 }, // Ļ
+    { 0x13C, 27 }, // ļ
+    { 0x13D, 15 }, // Ľ
+    { 0x13E, 27 }, // ľ
+    { 0x13F, 15 }, // Ŀ
+    { 0x140, 27 }, // ŀ
+    { 0x141, 15 }, // Ł
+    { 0x142, 53 }, // ł
+    { 0x143, 15 }, // Ń
+    { 0x144, 32 }, // ń
+    { 0x145, 15 }, // Ņ
+    { 0x146, 32 }, // ņ
+    { 0x147, 15 }, // Ň
+    { 0x148, 32 }, // ň
+    { 0x149, 32 }, // ŉ
+    { 0x14A, 15 }, // Ŋ
+    { 0x14B, 32 }, // ŋ
+    { 0x14C, 14 }, // Ō
+    { 0x14D, 26 }, // ō
+    { 0x14E, 14 }, // Ŏ
+    { 0x14F, 26 }, // ŏ
+    { 0x150, 14 }, // Ő
+    { 0x151, 26 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x153, 26 }, // œ
+    { 0x154, 13 }, // Ŕ
+    { 0x155, 32 }, // ŕ
+    { 0x156, 13 }, // Ŗ
+    { 0x157, 32 }, // ŗ
+    { 0x158, 13 }, // Ř
+    { 0x159, 32 }, // ř
+    { 0x15A, 1 }, // Ś
+    { 0x15B, 33 }, // ś
+    { 0x15C, 1 }, // Ŝ
+    { 0x15D, 33 }, // ŝ
+    { 0x15E, 1 }, // Ş
+    { 0x15F, 33 }, // ş
+    { 0x160, 1 }, // Š
+    { 0x161, 54 }, // š
+    { 0x162, 18 }, // Ţ
+    { 0x163, 34 }, // ţ
+    { 0x164, 18 }, // Ť
+    { 0x165, 34 }, // ť
+    { 0x166, 18 }, // Ŧ
+    { 0x167, 34 }, // ŧ
+    { 0x168, 19 }, // Ũ
+    { 0x169, 35 }, // ũ
+    { 0x16A, 19 }, // Ū
+    { 0x16B, 35 }, // ū
+    { 0x16C, 19 }, // Ŭ
+    { 0x16D, 35 }, // ŭ
+    { 0x16E, 19 }, // Ů
+    { 0x16F, 35 }, // ů
+    { 0x170, 19 }, // Ű
+    { 0x171, 35 }, // ű
+    { 0x172, 19 }, // Ų
+    { 0x173, 35 }, // ų
+    { 0x174, 20 }, // Ŵ
+    { 0x175, 36 }, // ŵ
+    { 0x176, 22 }, // Ŷ
+    { 0x177, 36 }, // ŷ
+    { 0x178, 22 }, // Ÿ
+    { 0x179, 23 }, // Ź
+    { 0x17A, 39 }, // ź
+    { 0x17B, 23 }, // Ż
+    { 0x17C, 39 }, // ż
+    { 0x17D, 23 }, // Ž
+    { 0x17E, 55 }, // ž
+    { 0x17F, 46 }, // ſ
+    { 0x2010, 6 }, // ‐
+    { 0x2011, 6 }, // ‑
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 56 }, // ‘
+    { 0x2019, 57 }, // ’
+    { 0x201A, 7 }, // ‚
+    { 0x201B, 56 }, // ‛
+    { 0x201C, 56 }, // “
+    { 0x201D, 57 }, // ”
+    { 0x201E, 7 }, // „
+    { 0x2025, 7 }, // ‥
+    { 0x2026, 7 }, // …
+    { 0x2039, 42 }, // ‹
+    { 0x203A, 43 }, // ›
+    { 0xFB00, 28 }, // ﬀ
+    { 0xFB01, 28 }, // ﬁ
+    { 0xFB02, 28 }, // ﬂ
+    { 0xFB03, 28 }, // ﬃ
+    { 0xFB04, 28 }, // ﬄ
+};
+
+static const int8_t bookerly_16_bolditalicKernMatrix[4332] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 5, 0, 0, 5, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 2, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 1, 4, 0, -2, -1, -3, 1, -2, 0, 0, 0, 0, 0, 1, 1, -1, 4, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 1, -2, -3, 0, 0, -1, -3, -1, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, -4, 0, -3, 0, 0, -3, 1, 0, 1, -3, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 1, 0, 1, -2, -2, -4, 2, -2, 0, -5, 0, 0, 0, 0, 1, -1, 0, -1, 0, -1, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 2, 0, 0, -1, -1, 1, 0, 0, 0, 0, 0, -3, -3,
+    0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -2, -1, -1, -1, 0, -1, 0, 1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, -3, -2, -2, -2, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -1, 0, 1, -1, 1, 0, 1, -1, 0, 0, 2,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 2, -2, 0, -2, -1, -2, -2, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, -1, 1, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, 0, 2, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, -1, 1, 0, 1, -1, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, 1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, -1, -1, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, -1, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 1, 0, 1, -1, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, -3, -2, -2, -2, 0, -4, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -5, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 6, 0, 6, 0, -2, -1, -1, 6, 0, -1, 0, 1, 0, 3, -1, -1, -1, -1, 0, -1, 0, -2, 7, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 2, 1, -1, 1, 0, 1, -2, -2, -2, 2, -2, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, -3, 0, -3, -2, -2, -2, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, -3, 0, -1, 0, 0, -1, 1, 0, 1, -1, 0, 1, 1,
+    0, 0, 0, 0, -3, 0, -3, -2, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, -2, -1, 0, 0, -1, 1, 0, 1, -1, 0, 0, 0,
+    0, 0, 0, 1, -4, -1, -4, -3, -2, -2, 0, -4, 1, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0, 2, 0, -2, 2, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -5, 0, -2, 0, 1, -2, 2, 1, 2, -2, 0, 0, 0,
+    0, 0, 0, 1, -1, 0, -1, 0, -1, -1, 0, 1, 1, -1, 0, 0, 1, 0, 0, 0, 2, 1, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 1, 0, 2, -3, -1, -3, -2, -2, -2, 0, -3, 1, -1, 0, 0, 0, 1, 0, 1, 2, 1, 0, 2, 0, -1, 2, -1, -2, 0, 0, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, -3, 0, -1, 0, 2, -1, 2, 0, 2, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, -1, 1, 4, 1, -2, -2, -3, 2, -3, 0, 0, 0, 0, 1, 2, 3, 0, 1, 0, 0, 0, 0, -2, 1, -2, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, -1, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 3, -2, 0, -2, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, -1, 3, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, -1, 2, 3, -1, 3, 1, 3, 0, 0, 1, 2,
+    0, 1, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 1, 4, 1, 0, 1, 2, 2, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 2, 2,
+    0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 3, 1, 0, 4, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, -1, 0, -1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, -2, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 2, 0, 0, 4, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 2, 0, 2, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 4, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0,
+    0, 0, -2, 0, -3, 0, -3, -1, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0,
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 3, 0, 0, 0, 1,
+    0, 0, 0, -1, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 1, 5, 1, -2, -2, -4, 2, -2, 0, -5, 0, 0, 0, 4, 2, -1, 5, -1, 0, -1, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 2, 0, 0, -1, -1, 1, 0, 0, 0, 0, 0, -3, -3,
+    0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 5, 1, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 3, 4, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 4, 1, 1, 2, 2, 2, 0, 1, 1, 2, 1, 2, 1, 3, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 4, 0, 4, 1, 2, 2, 3,
+    0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 3, -1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 2, 0, 2, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 4, 0, 0, 4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 4, 1, 0, 4, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 2,
+    0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    -1, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, -4, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -3, 0, -1, -3, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, -3, -4, 0, -3, 0, 0, -3, 0, 0, 0, -2, -1, 0, 0,
+    -1, 0, 0, 0, -6, 0, -6, 0, 0, 0, -1, -5, 0, -2, -2, -1, -2, -1, -2, -1, -1, -1, -1, 0, 0, -3, -1, -2, -4, -1, 0, -1, -3, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -5, 0, -3, -1, 0, -3, -1, 0, -1, -3, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 1, 4, 0, -2, -1, -3, 1, -2, 0, 0, 0, 0, 0, 2, 1, -1, 4, 0, 0, -1, -1, -2, 0, 1, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, -3,
+};
+
+static const EpdLigaturePair bookerly_16_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_16_bolditalic = {
     bookerly_16_bolditalicBitmaps,
     bookerly_16_bolditalicGlyphs,
     bookerly_16_bolditalicIntervals,
-    60,
+    61,
     44,
     36,
     -9,
     true,
+    bookerly_16_bolditalicKernLeftClasses,
+    272,
+    bookerly_16_bolditalicKernRightClasses,
+    283,
+    bookerly_16_bolditalicKernMatrix,
+    76,
+    57,
+    bookerly_16_bolditalicLigatures,
+    5,
 };
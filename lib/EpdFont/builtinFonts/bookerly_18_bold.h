@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_18_boldBitmaps[112410] = {
+static const uint8_t bookerly_18_boldBitmaps[113634] = {
     0x01, 0x54, 0x1F, 0xFC, 0x3F, 0xF8, 0x3F, 0xF8, 0x7F, 0xF4, 0x7F, 0xF4, 0x7F, 0xF0, 0x7F, 0xF0,
     0x7F, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0,
     0x2F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -7033,7 +7033,84 @@ static const uint8_t bookerly_18_boldBitmaps[112410] = {
     0x00, 0x00, 0x54, 0x00, 0x00, 0x54, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xF4, 0x3F,
     0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x0B, 0xFF, 0xC3, 0xFF, 0xF0, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFC,
     0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x0B, 0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
-    0xF4, 0x01, 0x50, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00,
+    0xF4, 0x01, 0x50, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xAA, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xEA, 0xFF,
+    0xFF, 0x96, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0xC0, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x00,
+    0xFF, 0xD0, 0x01, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
+    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0,
+    0x00, 0x2F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x95,
+    0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xF4, 0x00,
+    0x03, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
+    0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
+    0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
+    0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF2, 0xFF,
+    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x14, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x07, 0xFF, 0xD5, 0xBF, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00,
+    0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFC, 0x00,
+    0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x06, 0xFF, 0xFF, 0xE0, 0x3F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
+    0x03, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x07, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xC0,
+    0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
+    0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
+    0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
+    0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0x43, 0xFF,
+    0xFF, 0xF2, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9,
+    0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x1B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xFA, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x0B, 0xFF, 0xEA, 0xFF, 0xFF, 0xE5, 0x6F, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xFD, 0x00,
+    0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xFD, 0x00,
+    0x03, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
+    0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
+    0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
+    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
+    0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+    0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x02,
+    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xD0,
+    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0xA9, 0x05, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xEA, 0xFF, 0xFF, 0xF5, 0x6F, 0xFF, 0x00, 0x00, 0x3F,
+    0xF8, 0x00, 0xBF, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0xFF,
+    0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x1F,
+    0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x6F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xD0, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00,
+    0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
+    0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
+    0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
+    0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC,
+    0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
+    0xC0, 0x00, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFD, 0x2F, 0xFF,
+    0xFF, 0x4B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x03, 0xFF,
+    0xFF, 0xE0,
 };
 
 static const EpdGlyph bookerly_18_boldGlyphs[] = {
@@ -7765,6 +7842,11 @@ static const EpdGlyph bookerly_18_boldGlyphs[] = {
     { 22, 27, 38, 8, 27, 149, 112187 }, // ⊥
     { 8, 7, 24, 8, 14, 14, 112336 }, // ⋅
     { 34, 7, 38, 2, 14, 60, 112350 }, // ⋯
+    { 33, 30, 29, 0, 30, 248, 112410 }, // ﬀ
+    { 26, 30, 27, 0, 30, 195, 112658 }, // ﬁ
+    { 26, 30, 27, 0, 30, 195, 112853 }, // ﬂ
+    { 39, 30, 40, 0, 30, 293, 113048 }, // ﬃ
+    { 39, 30, 40, 0, 30, 293, 113341 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_18_boldIntervals[] = {
@@ -7828,15 +7910,680 @@ static const EpdUnicodeInterval bookerly_18_boldIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_18_boldKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x2F, 6 }, // /
+    { 0x3A, 7 }, // :
+    { 0x3B, 7 }, // ;
+    { 0x40, 8 }, // @
+    { 0x41, 9 }, // A
+    { 0x42, 10 }, // B
+    { 0x43, 11 }, // C
+    { 0x44, 12 }, // D
+    { 0x45, 13 }, // E
+    { 0x46, 14 }, // F
+    { 0x47, 15 }, // G
+    { 0x48, 16 }, // H
+    { 0x49, 16 }, // I
+    { 0x4A, 17 }, // J
+    { 0x4B, 18 }, // K
+    { 0x4C, 19 }, // L
+    { 0x4D, 20 }, // M
+    { 0x4E, 21 }, // N
+    { 0x4F, 12 }, // O
+    { 0x50, 22 }, // P
+    { 0x51, 23 }, // Q
+    { 0x52, 24 }, // R
+    { 0x53, 25 }, // S
+    { 0x54, 26 }, // T
+    { 0x55, 27 }, // U
+    { 0x56, 28 }, // V
+    { 0x57, 28 }, // W
+    { 0x58, 29 }, // X
+    { 0x59, 30 }, // Y
+    { 0x5A, 31 }, // Z
+    { 0x5B, 32 }, // [
+    { 0x5C, 33 }, // <backslash>
+    { 0x61, 34 }, // a
+    { 0x62, 35 }, // b
+    { 0x63, 36 }, // c
+    { 0x64, 37 }, // d
+    { 0x65, 38 }, // e
+    { 0x66, 39 }, // f
+    { 0x67, 40 }, // g
+    { 0x68, 41 }, // h
+    { 0x69, 42 }, // i
+    { 0x6A, 43 }, // j
+    { 0x6B, 44 }, // k
+    { 0x6C, 45 }, // l
+    { 0x6D, 41 }, // m
+    { 0x6E, 41 }, // n
+    { 0x6F, 35 }, // o
+    { 0x70, 35 }, // p
+    { 0x71, 46 }, // q
+    { 0x72, 47 }, // r
+    { 0x73, 48 }, // s
+    { 0x74, 49 }, // t
+    { 0x75, 50 }, // u
+    { 0x76, 51 }, // v
+    { 0x77, 51 }, // w
+    { 0x78, 52 }, // x
+    { 0x79, 51 }, // y
+    { 0x7A, 53 }, // z
+    { 0x7B, 54 }, // {
+    { 0xA1, 55 }, // ¡
+    { 0xAB, 56 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 57 }, // »
+    { 0xBF, 58 }, // ¿
+    { 0xC0, 9 }, // À
+    { 0xC1, 9 }, // Á
+    { 0xC2, 9 }, // Â
+    { 0xC3, 9 }, // Ã
+    { 0xC4, 9 }, // Ä
+    { 0xC5, 9 }, // Å
+    { 0xC6, 13 }, // Æ
+    { 0xC7, 11 }, // Ç
+    { 0xC8, 13 }, // È
+    { 0xC9, 13 }, // É
+    { 0xCA, 13 }, // Ê
+    { 0xCB, 13 }, // Ë
+    { 0xCC, 16 }, // Ì
+    { 0xCD, 16 }, // Í
+    { 0xCE, 16 }, // Î
+    { 0xCF, 16 }, // Ï
+    { 0xD0, 12 }, // Ð
+    { 0xD1, 21 }, // Ñ
+    { 0xD2, 12 }, // Ò
+    { 0xD3, 12 }, // Ó
+    { 0xD4, 12 }, // Ô
+    { 0xD5, 12 }, // Õ
+    { 0xD6, 12 }, // Ö
+    { 0xD8, 59 }, // Ø
+    { 0xD9, 27 }, // Ù
+    { 0xDA, 27 }, // Ú
+    { 0xDB, 27 }, // Û
+    { 0xDC, 27 }, // Ü
+    { 0xDD, 30 }, // Ý
+    { 0xDE, 60 }, // Þ
+    { 0xDF, 61 }, // ß
+    { 0xE0, 34 }, // à
+    { 0xE1, 34 }, // á
+    { 0xE2, 34 }, // â
+    { 0xE3, 34 }, // ã
+    { 0xE4, 34 }, // ä
+    { 0xE5, 34 }, // å
+    { 0xE6, 38 }, // æ
+    { 0xE7, 36 }, // ç
+    { 0xE8, 38 }, // è
+    { 0xE9, 38 }, // é
+    { 0xEA, 38 }, // ê
+    { 0xEB, 38 }, // ë
+    { 0xEC, 42 }, // ì
+    { 0xED, 42 }, // í
+    { 0xEE, 62 }, // î
+    { 0xEF, 62 }, // ï
+    { 0xF0, 35 }, // ð
+    { 0xF1, 41 }, // ñ
+    { 0xF2, 35 }, // ò
+    { 0xF3, 35 }, // ó
+    { 0xF4, 35 }, // ô
+    { 0xF5, 35 }, // õ
+    { 0xF6, 35 }, // ö
+    { 0xF8, 35 }, // ø
+    { 0xF9, 50 }, // ù
+    { 0xFA, 50 }, // ú
+    { 0xFB, 50 }, // û
+    { 0xFC, 50 }, // ü
+    { 0xFD, 51 }, // ý
+    { 0xFE, 35 }, // þ
+    { 0xFF, 51 }, // ÿ
+    { 0x100, 9 }, // Ā
+    { 0x101, 34 }, // ā
+    { 0x102, 9 }, // Ă
+    { 0x103, 34 }, // ă
+    { 0x104, 63 }, // Ą
+    { 0x105, 64 }, // ą
+    { 0x106, 11 }, // Ć
+    { 0x107, 36 }, // ć
+    { 0x108, 11 }, // Ĉ
+    { 0x109, 36 }, // ĉ
+    { 0x10A, 11 }, // Ċ
+    { 0x10B, 36 }, // ċ
+    { 0x10C, 11 }, // Č
+    { 0x10D, 36 }, // č
+    { 0x10E, 12 }, // Ď
+    { 0x10F, 65 }, // ď
+    { 0x110, 12 }, // Đ
+    { 0x111, 66 }, // đ
+    { 0x112, 13 }, // Ē
+    { 0x113, 38 }, // ē
+    { 0x114, 13 }, // Ĕ
+    { 0x115, 38 }, // ĕ
+    { 0x116, 13 }, // Ė
+    { 0x117, 38 }, // ė
+    { 0x118, 67 }, // Ę
+    { 0x119, 68 }, // ę
+    { 0x11A, 13 }, // Ě
+    { 0x11B, 38 }, // ě
+    { 0x11C, 15 }, // Ĝ
+    { 0x11D, 40 }, // ĝ
+    { 0x11E, 15 }, // Ğ
+    { 0x11F, 40 }, // ğ
+    { 0x120, 15 }, // Ġ
+    { 0x121, 40 }, // ġ
+    { 0x122, 15 }, // Ģ
+    { 0x123, 40 }, // ģ
+    { 0x124, 16 }, // Ĥ
+    { 0x125, 41 }, // ĥ
+    { 0x126, 16 }, // Ħ
+    { 0x127, 41 }, // ħ
+    { 0x128, 16 }, // Ĩ
+    { 0x129, 62 }, // ĩ
+    { 0x12A, 16 }, // Ī
+    { 0x12B, 62 }, // ī
+    { 0x12C, 16 }, // Ĭ
+    { 0x12D, 62 }, // ĭ
+    { 0x12E, 16 }, // Į
+    { 0x12F, 69 }, // į
+    { 0x130, 16 }, // İ
+    { 0x131, 42 }, // ı
+    { 0x132, 17 }, // Ĳ
+    { 0x133, 43 }, // ĳ
+    { 0x134, 17 }, // Ĵ
+    { 0x135, 70 }, // ĵ
+    { 0x136, 18 }, // Ķ
+    { 0x137, 44 }, // ķ
+    { 0x138, 44 }, // ĸ
+    { 0x139, 19 }, // Ĺ
+    { 0x13A, 45 }, // ĺ
+    { 0x13B, 19 }, // Ļ
+    { 0x13C, 45 }, // ļ
+    { 0x13E, 65 }, // ľ
+    { 0x141, 19 }, // Ł
+    { 0x142, 71 }, // ł
+    { 0x143, 21 }, // Ń
+    { 0x144, 41 }, // ń
+    { 0x145, 21 }, // Ņ
+    { 0x146, 41 }, // ņ
+    { 0x147, 21 }, // Ň
+    { 0x148, 41 }, // ň
+    { 0x149, 41 }, // ŉ
+    { 0x14A, 21 }, // Ŋ
+    { 0x14B, 41 }, // ŋ
+    { 0x14C, 12 }, // Ō
+    { 0x14D, 35 }, // ō
+    { 0x14E, 12 }, // Ŏ
+    { 0x14F, 35 }, // ŏ
+    { 0x150, 12 }, // Ő
+    { 0x151, 35 }, // ő
+    { 0x152, 13 }, // Œ
+    { 0x153, 38 }, // œ
+    { 0x154, 24 }, // Ŕ
+    { 0x155, 47 }, // ŕ
+    { 0x156, 24 }, // Ŗ
+    { 0x157, 47 }, // ŗ
+    { 0x158, 24 }, // Ř
+    { 0x159, 47 }, // ř
+    { 0x15A, 25 }, // Ś
+    { 0x15B, 48 }, // ś
+    { 0x15C, 25 }, // Ŝ
+    { 0x15D, 48 }, // ŝ
+    { 0x15E, 25 }, // Ş
+    { 0x15F, 48 }, // ş
+    { 0x160, 25 }, // Š
+    { 0x161, 48 }, // š
+    { 0x162, 26 }, // Ţ
+    { 0x163, 72 }, // ţ
+    { 0x164, 26 }, // Ť
+    { 0x165, 73 }, // ť
+    { 0x166, 26 }, // Ŧ
+    { 0x167, 49 }, // ŧ
+    { 0x168, 27 }, // Ũ
+    { 0x169, 50 }, // ũ
+    { 0x16A, 27 }, // Ū
+    { 0x16B, 50 }, // ū
+    { 0x16C, 27 }, // Ŭ
+    { 0x16D, 50 }, // ŭ
+    { 0x16E, 27 }, // Ů
+    { 0x16F, 50 }, // ů
+    { 0x170, 27 }, // Ű
+    { 0x171, 50 }, // ű
+    { 0x172, 27 }, // Ų
+    { 0x173, 74 }, // ų
+    { 0x174, 28 }, // Ŵ
+    { 0x175, 51 }, // ŵ
+    { 0x176, 30 }, // Ŷ
+    { 0x177, 51 }, // ŷ
+    { 0x178, 30 }, // Ÿ
+    { 0x179, 31 }, // Ź
+    { 0x17A, 53 }, // ź
+    { 0x17B, 31 }, // Ż
+    { 0x17C, 53 }, // ż
+    { 0x17D, 31 }, // Ž
+    { 0x17E, 53 }, // ž
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 75 }, // ‘
+    { 0x2019, 76 }, // ’
+    { 0x201A, 77 }, // ‚
+    { 0x201B, 75 }, // ‛
+    { 0x201C, 75 }, // “
+    { 0x201D, 76 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x201F, 75 }, // ‟
+    { 0x2025, 4 }, // ‥
+    { 0x2026, 4 }, // …
+    { 0x2039, 56 }, // ‹
+    { 0x203A, 57 }, // ›
+    { 0xFB00, 39 }, // ﬀ
+    { 0xFB01, 42 }, // ﬁ
+    { 0xFB02, 45 }, // ﬂ
+    { 0xFB03, 42 }, // ﬃ
+    { 0xFB04, 45 }, // ﬄ
+};
+
+static const EpdKernClassEntry bookerly_18_boldKernRightClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x29, 2 }, // )
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x3F, 10 }, // ?
+    { 0x41, 11 }, // A
+    { 0x42, 12 }, // B
+    { 0x43, 13 }, // C
+    { 0x44, 12 }, // D
+    { 0x45, 12 }, // E
+    { 0x46, 12 }, // F
+    { 0x47, 13 }, // G
+    { 0x48, 12 }, // H
+    { 0x49, 12 }, // I
+    { 0x4A, 14 }, // J
+    { 0x4B, 12 }, // K
+    { 0x4C, 12 }, // L
+    { 0x4D, 15 }, // M
+    { 0x4E, 12 }, // N
+    { 0x4F, 13 }, // O
+    { 0x50, 12 }, // P
+    { 0x51, 13 }, // Q
+    { 0x52, 12 }, // R
+    { 0x53, 16 }, // S
+    { 0x54, 17 }, // T
+    { 0x55, 18 }, // U
+    { 0x56, 19 }, // V
+    { 0x57, 19 }, // W
+    { 0x58, 20 }, // X
+    { 0x59, 21 }, // Y
+    { 0x5A, 22 }, // Z
+    { 0x5C, 23 }, // <backslash>
+    { 0x5D, 24 }, // ]
+    { 0x61, 25 }, // a
+    { 0x62, 26 }, // b
+    { 0x63, 27 }, // c
+    { 0x64, 27 }, // d
+    { 0x65, 27 }, // e
+    { 0x66, 28 }, // f
+    { 0x67, 29 }, // g
+    { 0x68, 30 }, // h
+    { 0x69, 31 }, // i
+    { 0x6A, 32 }, // j
+    { 0x6B, 30 }, // k
+    { 0x6C, 30 }, // l
+    { 0x6D, 33 }, // m
+    { 0x6E, 33 }, // n
+    { 0x6F, 27 }, // o
+    { 0x70, 34 }, // p
+    { 0x71, 27 }, // q
+    { 0x72, 33 }, // r
+    { 0x73, 35 }, // s
+    { 0x74, 36 }, // t
+    { 0x75, 37 }, // u
+    { 0x76, 38 }, // v
+    { 0x77, 38 }, // w
+    { 0x78, 39 }, // x
+    { 0x79, 40 }, // y
+    { 0x7A, 41 }, // z
+    { 0x7D, 42 }, // }
+    { 0xAB, 43 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 44 }, // »
+    { 0xBF, 45 }, // ¿
+    { 0xC0, 11 }, // À
+    { 0xC1, 11 }, // Á
+    { 0xC2, 11 }, // Â
+    { 0xC3, 11 }, // Ã
+    { 0xC4, 11 }, // Ä
+    { 0xC5, 11 }, // Å
+    { 0xC6, 46 }, // Æ
+    { 0xC7, 13 }, // Ç
+    { 0xC8, 12 }, // È
+    { 0xC9, 12 }, // É
+    { 0xCA, 12 }, // Ê
+    { 0xCB, 12 }, // Ë
+    { 0xCC, 12 }, // Ì
+    { 0xCD, 12 }, // Í
+    { 0xCE, 12 }, // Î
+    { 0xCF, 12 }, // Ï
+    { 0xD0, 12 }, // Ð
+    { 0xD1, 12 }, // Ñ
+    { 0xD2, 13 }, // Ò
+    { 0xD3, 13 }, // Ó
+    { 0xD4, 13 }, // Ô
+    { 0xD5, 13 }, // Õ
+    { 0xD6, 13 }, // Ö
+    { 0xD8, 47 }, // Ø
+    { 0xD9, 18 }, // Ù
+    { 0xDA, 18 }, // Ú
+    { 0xDB, 18 }, // Û
+    { 0xDC, 18 }, // Ü
+    { 0xDD, 21 }, // Ý
+    { 0xDE, 12 }, // Þ
+    { 0xDF, 48 }, // ß
+    { 0xE0, 25 }, // à
+    { 0xE1, 25 }, // á
+    { 0xE2, 25 }, // â
+    { 0xE3, 49 }, // ã
+    { 0xE4, 50 }, // ä
+    { 0xE5, 25 }, // å
+    { 0xE6, 25 }, // æ
+    { 0xE7, 27 }, // ç
+    { 0xE8, 27 }, // è
+    { 0xE9, 27 }, // é
+    { 0xEA, 27 }, // ê
+    { 0xEB, 51 }, // ë
+    { 0xEC, 52 }, // ì
+    { 0xED, 31 }, // í
+    { 0xEE, 53 }, // î
+    { 0xEF, 54 }, // ï
+    { 0xF0, 27 }, // ð
+    { 0xF1, 33 }, // ñ
+    { 0xF2, 27 }, // ò
+    { 0xF3, 27 }, // ó
+    { 0xF4, 27 }, // ô
+    { 0xF5, 27 }, // õ
+    { 0xF6, 55 }, // ö
+    { 0xF8, 56 }, // ø
+    { 0xF9, 37 }, // ù
+    { 0xFA, 37 }, // ú
+    { 0xFB, 37 }, // û
+    { 0xFC, 37 }, // ü
+    { 0xFD, 40 }, // ý
+    { 0xFE, 57 }, // þ
+    { 0xFF, 40 }, // ÿ
+    { 0x100, 11 }, // Ā
+    { 0x101, 58 }, // ā
+    { 0x102, 11 }, // Ă
+    { 0x103, 58 }, // ă
+    { 0x104, 11 }, // Ą
+    { 0x105, 25 }, // ą
+    { 0x106, 13 }, // Ć
+    { 0x107, 27 }, // ć
+    { 0x108, 13 }, // Ĉ
+    { 0x109, 55 }, // ĉ
+    { 0x10A, 13 }, // Ċ
+    { 0x10B, 27 }, // ċ
+    { 0x10C, 13 }, // Č
+    { 0x10D, 55 }, // č
+    { 0x10E, 12 }, // Ď
+    { 0x10F, 27 }, // ď
+    { 0x110, 12 }, // Đ
+    { 0x111, 27 }, // đ
+    { 0x112, 12 }, // Ē
+    { 0x113, 59 }, // ē
+    { 0x114, 12 }, // Ĕ
+    { 0x115, 55 }, // ĕ
+    { 0x116, 12 }, // Ė
+    { 0x117, 27 }, // ė
+    { 0x118, 12 }, // Ę
+    { 0x119, 27 }, // ę
+    { 0x11A, 12 }, // Ě
+    { 0x11B, 55 }, // ě
+    { 0x11C, 13 }, // Ĝ
+    { 0x11D, 29 }, // ĝ
+    { 0x11E, 13 }, // Ğ
+    { 0x11F, 60 }, // ğ
+    { 0x120, 13 }, // Ġ
+    { 0x121, 29 }, // ġ
+    { 0x122, 13 }, // Ģ
+    { 0x123, 29 }, // ģ
+    { 0x124, 12 }, // Ĥ
+    { 0x125, 30 }, // ĥ
+    { 0x126, 12 }, // Ħ
+    { 0x127, 61 }, // ħ
+    { 0x128, 12 }, // Ĩ
+    { 0x129, 54 }, // ĩ
+    { 0x12A, 12 }, // Ī
+    { 0x12B, 54 }, // ī
+    { 0x12C, 12 }, // Ĭ
+    { 0x12D, 54 }, // ĭ
+    { 0x12E, 12 }, // Į
+    { 0x12F, 31 }, // į
+    { 0x130, 12 }, // İ
+    { 0x131, 31 }, // ı
+    { 0x132, 12 }, // Ĳ
+    { 0x133, 31 }, // ĳ
+    { 0x134, 14 }, // Ĵ
+    { 0x135, 62 }, // ĵ
+    { 0x136, 12 }, // Ķ
+    { 0x137, 30 }, // ķ
+    { 0x138, 33 }, // ĸ
+    { 0x139, 12 }, // Ĺ
+    { 0x13A, 30 }, // ĺ
+    { 0x13B, 12 }, // Ļ
+    { 0x13C, 30 }, // ļ
+    { 0x13D, 12 }, // Ľ
+    { 0x13E, 30 }, // ľ
+    { 0x13F, 12 }, // Ŀ
+    { 0x140, 30 }, // ŀ
+    { 0x141, 12 }, // Ł
+    { 0x142, 63 }, // ł
+    { 0x143, 12 }, // Ń
+    { 0x144, 33 }, // ń
+    { 0x145, 12 }, // Ņ
+    { 0x146, 33 }, // ņ
+    { 0x147, 12 }, // Ň
+    { 0x148, 33 }, // ň
+    { 0x149, 33 }, // ŉ
+    { 0x14A, 12 }, // Ŋ
+    { 0x14B, 33 }, // ŋ
+    { 0x14C, 13 }, // Ō
+    { 0x14D, 27 }, // ō
+    { 0x14E, 13 }, // Ŏ
+    { 0x14F, 55 }, // ŏ
+    { 0x150, 13 }, // Ő
+    { 0x151, 27 }, // ő
+    { 0x152, 13 }, // Œ
+    { 0x153, 27 }, // œ
+    { 0x154, 12 }, // Ŕ
+    { 0x155, 33 }, // ŕ
+    { 0x156, 12 }, // Ŗ
+    { 0x157, 33 }, // ŗ
+    { 0x158, 12 }, // Ř
+    { 0x159, 64 }, // ř
+    { 0x15A, 16 }, // Ś
+    { 0x15B, 35 }, // ś
+    { 0x15C, 16 }, // Ŝ
+    { 0x15D, 65 }, // ŝ
+    { 0x15E, 16 }, // Ş
+    { 0x15F, 35 }, // ş
+    { 0x160, 16 }, // Š
+    { 0x161, 66 }, // š
+    { 0x162, 17 }, // Ţ
+    { 0x163, 36 }, // ţ
+    { 0x164, 17 }, // Ť
+    { 0x165, 36 }, // ť
+    { 0x166, 17 }, // Ŧ
+    { 0x167, 36 }, // ŧ
+    { 0x168, 18 }, // Ũ
+    { 0x169, 37 }, // ũ
+    { 0x16A, 18 }, // Ū
+    { 0x16B, 37 }, // ū
+    { 0x16C, 18 }, // Ŭ
+    { 0x16D, 37 }, // ŭ
+    { 0x16E, 18 }, // Ů
+    { 0x16F, 37 }, // ů
+    { 0x170, 18 }, // Ű
+    { 0x171, 37 }, // ű
+    { 0x172, 18 }, // Ų
+    { 0x173, 37 }, // ų
+    { 0x174, 19 }, // Ŵ
+    { 0x175, 38 }, // ŵ
+    { 0x176, 21 }, // Ŷ
+    { 0x177, 40 }, // ŷ
+    { 0x178, 21 }, // Ÿ
+    { 0x179, 22 }, // Ź
+    { 0x17A, 41 }, // ź
+    { 0x17B, 22 }, // Ż
+    { 0x17C, 41 }, // ż
+    { 0x17D, 22 }, // Ž
+    { 0x17E, 67 }, // ž
+    { 0x17F, 48 }, // ſ
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 68 }, // ‘
+    { 0x2019, 69 }, // ’
+    { 0x201A, 6 }, // ‚
+    { 0x201B, 68 }, // ‛
+    { 0x201C, 68 }, // “
+    { 0x201D, 69 }, // ”
+    { 0x201E, 6 }, // „
+    { 0x201F, 68 }, // ‟
+    { 0x2025, 6 }, // ‥
+    { 0x2026, 6 }, // …
+    { 0x2039, 43 }, // ‹
+    { 0x203A, 44 }, // ›
+    { 0xFB00, 28 }, // ﬀ
+    { 0xFB01, 28 }, // ﬁ
+    { 0xFB02, 28 }, // ﬂ
+    { 0xFB03, 28 }, // ﬃ
+    { 0xFB04, 28 }, // ﬄ
+};
+
+static const int8_t bookerly_18_boldKernMatrix[5313] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 1, 1, -1, -1, 0, -1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 1, 0, 0, -3, -2, -5, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -3, 0, -3, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -3, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -3, -2, -3, 0, 0, 0, -2, -2, -3, 0, -1, -1, -2, -1, -2, 0, 0, 0, 0, -5, -2, 0, -4, -4, -3, 0, 1, 1, -3, -3, 0, -4, -3, -3, 0, 0, 0, -2, -3, -3, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, -3, 0, -1, 0, 1, 0, 0, -2, 1, 0, -1, 0, 0, 0, -4, -2, -4, 0, -4, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -3, 1, -3, 0, 0, -1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -3,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0,
+    0, -1, 0, -2, 0, -2, -2, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 2, -3, 0, -3, -3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -4, 0, 0, -1, -1, -1, 0, 2, 2, -1, -1, 0, -1, -1, -2, 0, 2, 0, 0, -1, -1, -1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, -2, -1, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -2, -1, 0, -1, -1, -1, 0, 1, 1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, 0, 1, 1, -1, -1, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, -1, -3, 1, -3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 2, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, -1, 1, -1, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, -1, -1, -1, 0, 2, 2, -1, -1, 1, -1, -1, -1, 1, 2, 1, 0, -1, -1, 0, 0, 0,
+    1, 0, 2, -4, 0, -4, -4, 0, 0, 0, -4, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 1, 0, 0, -1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, -5, 0, 0, -1, -1, -1, 0, 1, 1, -1, -1, 0, -1, -1, -1, 0, 1, 0, 0, -1, -1, 0, 1, 1,
+    0, 2, 0, 1, 0, -2, -2, 0, 1, 0, -1, -1, 0, 3, 0, 0, 0, -1, -1, -1, -1, 0, -1, 2, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 1, 0, 2, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 1, 0, -2, -2, -2, 1, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 1, -1, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -1, -4, -5, -1, -1, 0, -4, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -4, -1, 0, -2, -2, -2, 0, 1, 1, -2, -2, 0, -2, -2, -2, 0, 0, 0, 0, -3, -3, -1, 1, 1,
+    0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -2, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, -3, -1, -1, -1, -1, -1, 0, 1, 1, -1, -1, 0, -1, -1, -2, 0, 1, 0, 0, -1, -1, -1, 0, 0,
+    0, 0, 1, -5, -2, -5, -5, -1, -1, 0, -5, 0, -2, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, -3, 1, -3, -1, -3, 1, 0, 0, -1, -1, -3, 0, -1, -1, -1, -1, -1, 1, -2, -1, 0, -5, -2, 0, -2, -2, -3, 0, 2, 2, -3, -3, 1, -2, -3, -2, 1, 2, 1, -1, -3, -3, -1, 0, 1,
+    0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 2, 2, 0, 0, 1, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -3, -2, -3, -4, -1, -1, 0, -4, 0, -2, 0, -1, -2, 0, 0, 0, 0, 1, 0, 0, 0, -3, 1, -3, -1, -4, 1, 0, 0, -2, -2, -3, 0, -1, -1, -2, -1, -2, 1, -2, -2, 0, -4, -2, 0, -3, -2, -3, 0, 2, 2, -3, -3, 1, -1, -3, -4, 1, 2, 1, -2, -3, -3, -2, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, -2, -4, 0, -3, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, -1, -1, -1, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0,
+    4, 4, 4, -1, 0, -1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, -1, 0, -1, 0, 1, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 1, 2, 2, 3, 3, 5, 0, -1, 0, 1, 1, 1, 4, 4, 0, 1, 1, 1, 2, 3, 3,
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 2,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 1, -3, -1, -3, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 1, 1,
+    0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 1, -3, -1, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 1, -2, -1, 0, 1, 0, 1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -2, -1, 2, -1, 0, -1, -1, 0, 2, 2,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, -2, -1, -3, 0, -2, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 1, -1, 0, -2, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -2, -1, 0, 0,
+    0, -1, 0, -2, 0, -2, -2, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, -3, -4, 0, 0, -1, -3, -2, 0, -2, -2, -1, -1, -1, -3, -3, -3, 0, -2, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 1, 1,
+    -2, 0, -3, 0, -1, 0, 1, 0, 0, -2, 1, 0, -1, 1, 0, 0, -4, -2, -4, 0, -4, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, -1, -3, 1, -3, 0, 0, -1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -4, -3,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -2, -1,
+    0, 3, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 4, 0, 2, 0, 4, 2, 2, 0, 0, 0, 1, 0, 1, 1, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 4, 0, 0, 0, 4, 3, 4, 1, 0, 1, 1, 2, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 2, 0, 2, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, -3, 0, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0, 1, 0, 0, 0, 0, 1, -1, 0, -2, 1, 0, 0, 0, 0, -1, 0, 0, 2, 2, 2, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, -1, 0, 1, 1, -1, -1, 1, 0, -1, -2, 1, 1, 1, 0, -1, -1, 0, 0, 0,
+    0, 0, 0, -3, 0, -3, 0, 0, 0, 0, -4, 0, -2, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, -2, 1, -3, 0, -3, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -6, -2, 0, -2, -2, -3, 0, 1, 1, -3, -3, 1, -2, -3, -3, 1, 1, 1, 0, -3, -3, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 1, 0, 0, -3, -2, -5, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -3, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -3, -2,
+};
+
+static const EpdLigaturePair bookerly_18_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_18_bold = {
     bookerly_18_boldBitmaps,
     bookerly_18_boldGlyphs,
     bookerly_18_boldIntervals,
-    60,
+    61,
     49,
     40,
     -10,
     true,
+    bookerly_18_boldKernLeftClasses,
+    279,
+    bookerly_18_boldKernRightClasses,
+    282,
+    bookerly_18_boldKernMatrix,
+    77,
+    69,
+    bookerly_18_boldLigatures,
+    5,
 };
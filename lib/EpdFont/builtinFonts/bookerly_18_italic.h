@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_18_italicBitmaps[108017] = {
+static const uint8_t bookerly_18_italicBitmaps[109871] = {
     0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00,
     0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x03, 0xF0,
     0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00,
@@ -6759,7 +6759,122 @@ static const uint8_t bookerly_18_italicBitmaps[108017] = {
     0x50, 0x0A, 0x80, 0x00, 0x02, 0x90, 0x00, 0x01, 0xA0, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x0B,
     0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x0F,
     0xFD, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x40,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x90, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x47, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x1F,
+    0xFF, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
+    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x55, 0x5B, 0xF5, 0x54, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
+    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
+    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
+    0x2F, 0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0xFF, 0xFD, 0x46, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
+    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAB, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x00,
+    0x00, 0x07, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xD5, 0x55, 0xA9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBE,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0,
+    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
+    0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
+    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F,
+    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFC,
+    0x04, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x5F,
+    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xFF, 0xC0,
+    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
+    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x40, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFD, 0x00, 0x00,
+    0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00,
+    0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00,
+    0x00, 0x1F, 0xF5, 0x54, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00,
+    0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+    0x00, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
+    0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x03, 0xF8, 0x00, 0x01, 0xFC, 0x04, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x3C, 0x00, 0x00,
+    0x03, 0xF0, 0x00, 0x03, 0xF9, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
+    0x0B, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
+    0x0F, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90, 0x00, 0x1B, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xE7, 0xFE, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0x80,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x55, 0x5B,
+    0xF5, 0x55, 0x5A, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
+    0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40,
+    0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBE,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
+    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00,
+    0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x10, 0x00, 0x00,
+    0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0xB4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8,
+    0x00, 0x0B, 0xF2, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
+    0x00, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07,
+    0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0x40, 0x00,
+    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
+    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0xFD,
+    0x46, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
+    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x02, 0xFF, 0xDB, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0x9F, 0xFA, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0x80, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F,
+    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00,
+    0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x55, 0x55, 0xBF,
+    0x55, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xD0, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
+    0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
+    0x40, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00,
+    0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
+    0x02, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
+    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
+    0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD,
+    0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x07, 0x40, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xCB, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00,
+    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
+    0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBE,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
+    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0x03, 0xFF, 0xF5, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
 static const EpdGlyph bookerly_18_italicGlyphs[] = {
@@ -7491,6 +7606,11 @@ static const EpdGlyph bookerly_18_italicGlyphs[] = {
     { 22, 27, 38, 8, 27, 149, 107811 }, // ⊥
     { 6, 6, 24, 9, 13, 9, 107960 }, // ⋅
     { 32, 6, 38, 3, 13, 48, 107969 }, // ⋯
+    { 40, 39, 28, -7, 30, 390, 108017 }, // ﬀ
+    { 31, 38, 25, -7, 29, 295, 108407 }, // ﬁ
+    { 32, 39, 26, -7, 30, 312, 108702 }, // ﬂ
+    { 44, 38, 37, -7, 29, 418, 109014 }, // ﬃ
+    { 45, 39, 38, -7, 30, 439, 109432 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_18_italicIntervals[] = {
@@ -7554,15 +7674,655 @@ static const EpdUnicodeInterval bookerly_18_italicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_18_italicKernLeftClasses[] = {
+    { 0x28, 1 }, // (
+    { 0x2A, 2 }, // *
+    { 0x2C, 3 }, // ,
+    { 0x2D, 4 }, // -
+    { 0x2E, 3 }, // .
+    { 0x2F, 5 }, // /
+    { 0x41, 6 }, // A
+    { 0x42, 7 }, // B
+    { 0x43, 8 }, // C
+    { 0x44, 9 }, // D
+    { 0x45, 10 }, // E
+    { 0x46, 11 }, // F
+    { 0x47, 12 }, // G
+    { 0x48, 13 }, // H
+    { 0x49, 13 }, // I
+    { 0x4A, 14 }, // J
+    { 0x4B, 15 }, // K
+    { 0x4C, 16 }, // L
+    { 0x4D, 17 }, // M
+    { 0x4E, 18 }, // N
+    { 0x4F, 9 }, // O
+    { 0x50, 19 }, // P
+    { 0x51, 20 }, // Q
+    { 0x52, 21 }, // R
+    { 0x53, 22 }, // S
+    { 0x54, 23 }, // T
+    { 0x55, 24 }, // U
+    { 0x56, 25 }, // V
+    { 0x57, 25 }, // W
+    { 0x58, 26 }, // X
+    { 0x59, 27 }, // Y
+    { 0x5A, 28 }, // Z
+    { 0x5B, 29 }, // [
+    { 0x5C, 30 }, // <backslash>
+    { 0x61, 31 }, // a
+    { 0x62, 32 }, // b
+    { 0x63, 33 }, // c
+    { 0x65, 34 }, // e
+    { 0x66, 35 }, // f
+    { 0x67, 36 }, // g
+    { 0x68, 37 }, // h
+    { 0x6A, 38 }, // j
+    { 0x6B, 39 }, // k
+    { 0x6D, 37 }, // m
+    { 0x6E, 37 }, // n
+    { 0x6F, 32 }, // o
+    { 0x70, 32 }, // p
+    { 0x71, 40 }, // q
+    { 0x72, 41 }, // r
+    { 0x73, 42 }, // s
+    { 0x74, 43 }, // t
+    { 0x75, 31 }, // u
+    { 0x76, 44 }, // v
+    { 0x77, 44 }, // w
+    { 0x78, 45 }, // x
+    { 0x79, 44 }, // y
+    { 0x7A, 46 }, // z
+    { 0x7B, 47 }, // {
+    { 0xA1, 48 }, // ¡
+    { 0xAB, 49 }, // «
+    { 0xAD, 4 }, // ­
+    { 0xBB, 50 }, // »
+    { 0xBF, 51 }, // ¿
+    { 0xC0, 6 }, // À
+    { 0xC1, 6 }, // Á
+    { 0xC2, 6 }, // Â
+    { 0xC3, 6 }, // Ã
+    { 0xC4, 6 }, // Ä
+    { 0xC5, 6 }, // Å
+    { 0xC6, 10 }, // Æ
+    { 0xC7, 8 }, // Ç
+    { 0xC8, 10 }, // È
+    { 0xC9, 10 }, // É
+    { 0xCA, 10 }, // Ê
+    { 0xCB, 10 }, // Ë
+    { 0xCC, 13 }, // Ì
+    { 0xCD, 13 }, // Í
+    { 0xCE, 13 }, // Î
+    { 0xCF, 13 }, // Ï
+    { 0xD0, 9 }, // Ð
+    { 0xD1, 18 }, // Ñ
+    { 0xD2, 9 }, // Ò
+    { 0xD3, 9 }, // Ó
+    { 0xD4, 9 }, // Ô
+    { 0xD5, 9 }, // Õ
+    { 0xD6, 9 }, // Ö
+    { 0xD8, 9 }, // Ø
+    { 0xD9, 24 }, // Ù
+    { 0xDA, 24 }, // Ú
+    { 0xDB, 24 }, // Û
+    { 0xDC, 24 }, // Ü
+    { 0xDD, 27 }, // Ý
+    { 0xDE, 52 }, // Þ
+    { 0xDF, 53 }, // ß
+    { 0xE0, 31 }, // à
+    { 0xE1, 31 }, // á
+    { 0xE2, 31 }, // â
+    { 0xE3, 31 }, // ã
+    { 0xE4, 31 }, // ä
+    { 0xE5, 31 }, // å
+    { 0xE6, 34 }, // æ
+    { 0xE7, 54 }, // ç
+    { 0xE8, 34 }, // è
+    { 0xE9, 34 }, // é
+    { 0xEA, 34 }, // ê
+    { 0xEB, 34 }, // ë
+    { 0xEE, 55 }, // î
+    { 0xEF, 55 }, // ï
+    { 0xF0, 32 }, // ð
+    { 0xF1, 37 }, // ñ
+    { 0xF2, 32 }, // ò
+    { 0xF3, 32 }, // ó
+    { 0xF4, 32 }, // ô
+    { 0xF5, 32 }, // õ
+    { 0xF6, 32 }, // ö
+    { 0xF8, 56 }, // ø
+    { 0xF9, 31 }, // ù
+    { 0xFA, 31 }, // ú
+    { 0xFB, 31 }, // û
+    { 0xFC, 31 }, // ü
+    { 0xFD, 44 }, // ý
+    { 0xFE, 32 }, // þ
+    { 0xFF, 44 }, // ÿ
+    { 0x100, 6 }, // Ā
+    { 0x101, 31 }, // ā
+    { 0x102, 6 }, // Ă
+    { 0x103, 31 }, // ă
+    { 0x104, 57 }, // Ą
+    { 0x105, 58 }, // ą
+    { 0x106, 8 }, // Ć
+    { 0x107, 33 }, // ć
+    { 0x108, 8 }, // Ĉ
+    { 0x109, 33 }, // ĉ
+    { 0x10A, 8 }, // Ċ
+    { 0x10B, 33 }, // ċ
+    { 0x10C, 8 }, // Č
+    { 0x10D, 33 }, // č
+    { 0x10E, 9 }, // Ď
+    { 0x10F, 59 }, // ď
+    { 0x110, 9 }, // Đ
+    { 0x112, 10 }, // Ē
+    { 0x113, 34 }, // ē
+    { 0x114, 10 }, // Ĕ
+    { 0x115, 34 }, // ĕ
+    { 0x116, 10 }, // Ė
+    { 0x117, 34 }, // ė
+    { 0x118, 60 }, // Ę
+    { 0x119, 61 }, // ę
+    { 0x11A, 10 }, // Ě
+    { 0x11B, 34 }, // ě
+    { 0x11C, 12 }, // Ĝ
+    { 0x11D, 36 }, // ĝ
+    { 0x11E, 12 }, // Ğ
+    { 0x11F, 36 }, // ğ
+    { 0x120, 12 }, // Ġ
+    { 0x121, 36 }, // ġ
+    { 0x122, 12 }, // Ģ
+    { 0x123, 36 }, // ģ
+    { 0x124, 13 }, // Ĥ
+    { 0x125, 37 }, // ĥ
+    { 0x126, 13 }, // Ħ
+    { 0x127, 37 }, // ħ
+    { 0x128, 13 }, // Ĩ
+    { 0x129, 55 }, // ĩ
+    { 0x12A, 13 }, // Ī
+    { 0x12B, 55 }, // ī
+    { 0x12C, 13 }, // Ĭ
+    { 0x12D, 55 }, // ĭ
+    { 0x12E, 62 }, // Į
+    { 0x12F, 63 }, // į
+    { 0x130, 13 }, // İ
+    { 0x131, 31 }, // ı
+    { 0x132, 14 }, // Ĳ
+    { 0x133, 38 }, // ĳ
+    { 0x134, 14 }, // Ĵ
+    { 0x135, 64 }, // ĵ
+    { 0x136, 15 }, // Ķ
+    { 0x137, 39 }, // ķ
+    { 0x138, 33 }, // ĸ
+    { 0x139, 16 }, // Ĺ
+    { 0x13B, 16 }, // Ļ
+    { 0x13C, 65 }, // ļ
+    { 0x13E, 59 }, // ľ
+    { 0x141, 16 }, // Ł
+    { 0x142, 66 }, // ł
+    { 0x143, 18 }, // Ń
+    { 0x144, 37 }, // ń
+    { 0x145, 18 }, // Ņ
+    { 0x146, 37 }, // ņ
+    { 0x147, 18 }, // Ň
+    { 0x148, 37 }, // ň
+    { 0x149, 37 }, // ŉ
+    { 0x14A, 18 }, // Ŋ
+    { 0x14B, 67 }, // ŋ
+    { 0x14C, 9 }, // Ō
+    { 0x14D, 32 }, // ō
+    { 0x14E, 9 }, // Ŏ
+    { 0x14F, 32 }, // ŏ
+    { 0x150, 9 }, // Ő
+    { 0x151, 32 }, // ő
+    { 0x152, 10 }, // Œ
+    { 0x153, 34 }, // œ
+    { 0x154, 21 }, // Ŕ
+    { 0x155, 41 }, // ŕ
+    { 0x156, 21 }, // Ŗ
+    { 0x157, 41 }, // ŗ
+    { 0x158, 21 }, // Ř
+    { 0x159, 41 }, // ř
+    { 0x15A, 22 }, // Ś
+    { 0x15B, 42 }, // ś
+    { 0x15C, 22 }, // Ŝ
+    { 0x15D, 42 }, // ŝ
+    { 0x15E, 22 }, // Ş
+    { 0x15F, 68 }, // ş
+    { 0x160, 22 }, // Š
+    { 0x161, 42 }, // š
+    { 0x162, 23 }, // Ţ
+    { 0x163, 69 }, // ţ
+    { 0x164, 23 }, // Ť
+    { 0x166, 23 }, // Ŧ
+    { 0x167, 43 }, // ŧ
+    { 0x168, 24 }, // Ũ
+    { 0x169, 31 }, // ũ
+    { 0x16A, 24 }, // Ū
+    { 0x16B, 31 }, // ū
+    { 0x16C, 24 }, // Ŭ
+    { 0x16D, 31 }, // ŭ
+    { 0x16E, 24 }, // Ů
+    { 0x16F, 31 }, // ů
+    { 0x170, 24 }, // Ű
+    { 0x171, 31 }, // ű
+    { 0x172, 24 }, // Ų
+    { 0x173, 58 }, // ų
+    { 0x174, 25 }, // Ŵ
+    { 0x175, 44 }, // ŵ
+    { 0x176, 27 }, // Ŷ
+    { 0x177, 44 }, // ŷ
+    { 0x178, 27 }, // Ÿ
+    { 0x179, 28 }, // Ź
+    { 0x17A, 46 }, // ź
+    { 0x17B, 28 }, // Ż
+    { 0x17C, 46 }, // ż
+    { 0x17D, 28 }, // Ž
+    { 0x17E, 46 }, // ž
+    { 0x2010, 4 }, // ‐
+    { 0x2011, 4 }, // ‑
+    { 0x2013, 4 }, // –
+    { 0x2014, 4 }, // —
+    { 0x2015, 4 }, // ―
+    { 0x2018, 70 }, // ‘
+    { 0x2019, 71 }, // ’
+    { 0x201A, 72 }, // ‚
+    { 0x201B, 70 }, // ‛
+    { 0x201C, 70 }, // “
+    { 0x201D, 71 }, // ”
+    { 0x201E, 3 }, // „
+    { 0x2025, 3 }, // ‥
+    { 0x2026, 3 }, // …
+    { 0x2039, 49 }, // ‹
+    { 0x203A, 50 }, // ›
+    { 0xFB00, 35 }, // ﬀ
+};
+
+static const EpdKernClassEntry bookerly_18_italicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x29, 2 }, // )
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x3F, 10 }, // ?
+    { 0x41, 11 }, // A
+    { 0x42, 12 }, // B
+    { 0x43, 13 }, // C
+    { 0x44, 12 }, // D
+    { 0x45, 14 }, // E
+    { 0x46, 14 }, // F
+    { 0x47, 13 }, // G
+    { 0x48, 14 }, // H
+    { 0x49, 14 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 14 }, // K
+    { 0x4C, 14 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 14 }, // N
+    { 0x4F, 13 }, // O
+    { 0x50, 12 }, // P
+    { 0x51, 13 }, // Q
+    { 0x52, 12 }, // R
+    { 0x53, 17 }, // S
+    { 0x54, 18 }, // T
+    { 0x55, 19 }, // U
+    { 0x56, 20 }, // V
+    { 0x57, 20 }, // W
+    { 0x58, 21 }, // X
+    { 0x59, 22 }, // Y
+    { 0x5A, 23 }, // Z
+    { 0x5C, 24 }, // <backslash>
+    { 0x5D, 25 }, // ]
+    { 0x61, 26 }, // a
+    { 0x62, 27 }, // b
+    { 0x63, 26 }, // c
+    { 0x64, 26 }, // d
+    { 0x65, 26 }, // e
+    { 0x66, 28 }, // f
+    { 0x67, 29 }, // g
+    { 0x68, 27 }, // h
+    { 0x69, 30 }, // i
+    { 0x6A, 31 }, // j
+    { 0x6B, 27 }, // k
+    { 0x6C, 27 }, // l
+    { 0x6D, 32 }, // m
+    { 0x6E, 32 }, // n
+    { 0x6F, 26 }, // o
+    { 0x70, 33 }, // p
+    { 0x71, 26 }, // q
+    { 0x72, 32 }, // r
+    { 0x73, 34 }, // s
+    { 0x74, 35 }, // t
+    { 0x75, 36 }, // u
+    { 0x76, 37 }, // v
+    { 0x77, 37 }, // w
+    { 0x78, 38 }, // x
+    { 0x79, 39 }, // y
+    { 0x7A, 40 }, // z
+    { 0x7D, 25 }, // }
+    { 0xAB, 41 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 42 }, // »
+    { 0xBF, 43 }, // ¿
+    { 0xC0, 11 }, // À
+    { 0xC1, 11 }, // Á
+    { 0xC2, 11 }, // Â
+    { 0xC3, 11 }, // Ã
+    { 0xC4, 11 }, // Ä
+    { 0xC5, 11 }, // Å
+    { 0xC6, 44 }, // Æ
+    { 0xC7, 13 }, // Ç
+    { 0xC8, 14 }, // È
+    { 0xC9, 14 }, // É
+    { 0xCA, 14 }, // Ê
+    { 0xCB, 14 }, // Ë
+    { 0xCC, 14 }, // Ì
+    { 0xCD, 14 }, // Í
+    { 0xCE, 14 }, // Î
+    { 0xCF, 14 }, // Ï
+    { 0xD0, 12 }, // Ð
+    { 0xD1, 14 }, // Ñ
+    { 0xD2, 13 }, // Ò
+    { 0xD3, 13 }, // Ó
+    { 0xD4, 13 }, // Ô
+    { 0xD5, 13 }, // Õ
+    { 0xD6, 13 }, // Ö
+    { 0xD8, 13 }, // Ø
+    { 0xD9, 19 }, // Ù
+    { 0xDA, 19 }, // Ú
+    { 0xDB, 19 }, // Û
+    { 0xDC, 19 }, // Ü
+    { 0xDD, 22 }, // Ý
+    { 0xDE, 14 }, // Þ
+    { 0xDF, 45 }, // ß
+    { 0xE0, 26 }, // à
+    { 0xE1, 26 }, // á
+    { 0xE2, 26 }, // â
+    { 0xE3, 26 }, // ã
+    { 0xE4, 46 }, // ä
+    { 0xE5, 26 }, // å
+    { 0xE6, 26 }, // æ
+    { 0xE7, 26 }, // ç
+    { 0xE8, 26 }, // è
+    { 0xE9, 26 }, // é
+    { 0xEA, 26 }, // ê
+    { 0xEB, 26 }, // ë
+    { 0xEC, 47 }, // ì
+    { 0xED, 30 }, // í
+    { 0xEE, 48 }, // î
+    { 0xEF, 48 }, // ï
+    { 0xF0, 26 }, // ð
+    { 0xF1, 32 }, // ñ
+    { 0xF2, 26 }, // ò
+    { 0xF3, 26 }, // ó
+    { 0xF4, 26 }, // ô
+    { 0xF5, 26 }, // õ
+    { 0xF6, 26 }, // ö
+    { 0xF8, 49 }, // ø
+    { 0xF9, 36 }, // ù
+    { 0xFA, 36 }, // ú
+    { 0xFB, 36 }, // û
+    { 0xFC, 36 }, // ü
+    { 0xFD, 37 }, // ý
+    { 0xFE, 50 }, // þ
+    { 0xFF, 37 }, // ÿ
+    { 0x100, 11 }, // Ā
+    { 0x101, 26 }, // ā
+    { 0x102, 11 }, // Ă
+    { 0x103, 26 }, // ă
+    { 0x104, 11 }, // Ą
+    { 0x105, 26 }, // ą
+    { 0x106, 13 }, // Ć
+    { 0x107, 26 }, // ć
+    { 0x108, 13 }, // Ĉ
+    { 0x109, 26 }, // ĉ
+    { 0x10A, 13 }, // Ċ
+    { 0x10B, 26 }, // ċ
+    { 0x10C, 13 }, // Č
+    { 0x10D, 51 }, // č
+    { 0x10E, 12 }, // Ď
+    { 0x10F, 26 }, // ď
+    { 0x110, 12 }, // Đ
+    { 0x111, 26 }, // đ
+    { 0x112, 14 }, // Ē
+    { 0x113, 26 }, // ē
+    { 0x114, 14 }, // Ĕ
+    { 0x115, 26 }, // ĕ
+    { 0x116, 14 }, // Ė
+    { 0x117, 26 }, // ė
+    { 0x118, 14 }, // Ę
+    { 0x119, 26 }, // ę
+    { 0x11A, 14 }, // Ě
+    { 0x11B, 26 }, // ě
+    { 0x11C, 13 }, // Ĝ
+    { 0x11D, 29 }, // ĝ
+    { 0x11E, 13 }, // Ğ
+    { 0x11F, 29 }, // ğ
+    { 0x120, 13 }, // Ġ
+    { 0x121, 29 }, // ġ
+    { 0x122, 13 }, // Ģ
+    { 0x123, 29 }, // ģ
+    { 0x124, 14 }, // Ĥ
+    { 0x125, 27 }, // ĥ
+    { 0x126, 14 }, // Ħ
+    { 0x127, 52 }, // ħ
+    { 0x128, 14 }, // Ĩ
+    { 0x129, 48 }, // ĩ
+    { 0x12A, 14 }, // Ī
+    { 0x12B, 48 }, // ī
+    { 0x12C, 14 }, // Ĭ
+    { 0x12D, 48 }, // ĭ
+    { 0x12E, 14 }, // Į
+    { 0x12F, 30 }, // į
+    { 0x130, 14 }, // İ
+    { 0x131, 32 }, // ı
+    { 0x132, 14 }, // Ĳ
+    { 0x133, 30 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 53 }, // ĵ
+    { 0x136, 14 }, // Ķ
+    { 0x137, 27 }, // ķ
+    { 0x138, 32 }, // ĸ
+    { 0x139, 14 }, // Ĺ
+    { 0x13A, 27 }, // ĺ
+    { 0x13B, 14 }, // Ļ
+    { 0x13C, 27 }, // ļ
+    { 0x13D, 14 }, // Ľ
+    { 0x13E, 27 }, // ľ
+    { 0x13F, 14 }, // Ŀ
+    { 0x140, 27 }, // ŀ
+    { 0x141, 14 }, // Ł
+    { 0x142, 54 }, // ł
+    { 0x143, 14 }, // Ń
+    { 0x144, 32 }, // ń
+    { 0x145, 14 }, // Ņ
+    { 0x146, 32 }, // ņ
+    { 0x147, 14 }, // Ň
+    { 0x148, 32 }, // ň
+    { 0x149, 32 }, // ŉ
+    { 0x14A, 14 }, // Ŋ
+    { 0x14B, 32 }, // ŋ
+    { 0x14C, 13 }, // Ō
+    { 0x14D, 26 }, // ō
+    { 0x14E, 13 }, // Ŏ
+    { 0x14F, 26 }, // ŏ
+    { 0x150, 13 }, // Ő
+    { 0x151, 26 }, // ő
+    { 0x152, 13 }, // Œ
+    { 0x153, 26 }, // œ
+    { 0x154, 12 }, // Ŕ
+    { 0x155, 32 }, // ŕ
+    { 0x156, 12 }, // Ŗ
+    { 0x157, 32 }, // ŗ
+    { 0x158, 12 }, // Ř
+    { 0x159, 32 }, // ř
+    { 0x15A, 17 }, // Ś
+    { 0x15B, 34 }, // ś
+    { 0x15C, 17 }, // Ŝ
+    { 0x15D, 34 }, // ŝ
+    { 0x15E, 17 }, // Ş
+    { 0x15F, 34 }, // ş
+    { 0x160, 17 }, // Š
+    { 0x161, 55 }, // š
+    { 0x162, 18 }, // Ţ
+    { 0x163, 35 }, // ţ
+    { 0x164, 18 }, // Ť
+    { 0x165, 35 }, // ť
+    { 0x166, 18 }, // Ŧ
+    { 0x167, 35 }, // ŧ
+    { 0x168, 19 }, // Ũ
+    { 0x169, 36 }, // ũ
+    { 0x16A, 19 }, // Ū
+    { 0x16B, 36 }, // ū
+    { 0x16C, 19 }, // Ŭ
+    { 0x16D, 36 }, // ŭ
+    { 0x16E, 19 }, // Ů
+    { 0x16F, 36 }, // ů
+    { 0x170, 19 }, // Ű
+    { 0x171, 36 }, // ű
+    { 0x172, 19 }, // Ų
+    { 0x173, 36 }, // ų
+    { 0x174, 20 }, // Ŵ
+    { 0x175, 37 }, // ŵ
+    { 0x176, 22 }, // Ŷ
+    { 0x177, 37 }, // ŷ
+    { 0x178, 22 }, // Ÿ
+    { 0x179, 23 }, // Ź
+    { 0x17A, 40 }, // ź
+    { 0x17B, 23 }, // Ż
+    { 0x17C, 40 }, // ż
+    { 0x17D, 23 }, // Ž
+    { 0x17E, 56 }, // ž
+    { 0x17F, 45 }, // ſ
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 57 }, // ‘
+    { 0x2019, 58 }, // ’
+    { 0x201A, 6 }, // ‚
+    { 0x201B, 57 }, // ‛
+    { 0x201C, 57 }, // “
+    { 0x201D, 58 }, // ”
+    { 0x201E, 6 }, // „
+    { 0x2025, 6 }, // ‥
+    { 0x2026, 6 }, // …
+    { 0x2039, 41 }, // ‹
+    { 0x203A, 42 }, // ›
+    { 0xFB00, 28 }, // ﬀ
+    { 0xFB01, 28 }, // ﬁ
+    { 0xFB02, 28 }, // ﬂ
+    { 0xFB03, 28 }, // ﬃ
+    { 0xFB04, 28 }, // ﬄ
+};
+
+static const int8_t bookerly_18_italicKernMatrix[4176] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 2, 6, 2, 0, 6, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 2, -2, 2, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 3, 0, 0, -2, -2, -4, 2, -2, 0, 0, 0, -1, 0, 1, 1, 0, 3, -1, -1, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -4, -4,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, -4, 0, 0, -1, -1, -3, -1, -2, 0, -2, 0, -2, 0, 0, 0, -5, 0, -4, 0, 0, -4, 0, -4, 0, 0, 0, -3, -2, 0, 0,
+    0, 0, -3, 0, -1, 0, 0, 0, 0, -1, 1, 0, -2, 0, 0, 0, 0, -2, -3, -4, 1, -4, 0, -6, 0, -1, 0, 0, 1, -1, 0, -1, -1, 0, -1, -1, -2, 0, -2, 0, -1, 0, 0, 1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -4, -3,
+    0, 0, 0, -2, 0, -2, 0, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, -2, -1, -2, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -1, -2, -2, 0, -1, 0, 1, 0, -1, -1, 0, -1, -1, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -3, -3, -2, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -1, 0, 1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 1,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, -2, 0, -2, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0,
+    0, 0, 1, -2, 0, -2, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, 0, 0, -1, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, -2, 0, 0, 1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -3, 1, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, -3, 0, -3, -2, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -2, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0,
+    0, 0, 0, -4, 0, -4, -3, -3, -3, 0, -4, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, -2, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0,
+    0, 9, 0, 7, 0, -2, -1, -2, 7, 0, 0, 0, 1, 0, 4, -1, 0, -1, -1, -1, 0, -1, 0, -2, 8, 0, 0, 2, 3, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 1, 0, -2, -2, -3, 2, -3, 0, -4, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, 0, 0, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, -4, 0, -4, -3, -2, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -2, 0, 0, -2, 0, -2, 1, 0, 0, -1, 0, 1, 2,
+    0, 0, 0, -3, -1, -3, -3, -2, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 1, -5, -1, -5, -3, -3, -3, 0, -4, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, -2, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, 0, -5, 0, -2, 0, 1, -2, 0, -2, 0, 0, 0, -2, 0, 0, 1,
+    0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 1, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, -4, -2, -4, -4, -2, -2, 0, -4, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -2, 0, -1, -2, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, -1, -1, -1, 0, -4, 0, -2, 0, 1, -2, 0, -2, 2, 0, 0, -2, -1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, -2, -2, -4, 2, -3, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, -2, 1, -2, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, -1, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0,
+    0, 2, 3, -2, 0, -2, -2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, -1, 2, 0, -1, 0, 0, -1, -1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 1, 2, -1, 2, -1, 2, 1, 2, 0, 0, 1, 2,
+    0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 1, 0, 4, 1, 1, 0, 2, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+    0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 3, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -3, 0, -3, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 2, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, -1, -2, 0, -2, 0, 0, 0, -1, -1, 3, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0,
+    0, -2, 0, -4, 0, -4, -2, 0, 0, 0, -2, -1, 0, -1, -1, -1, 0, -2, -1, -2, -2, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 0, 0, 1,
+    0, 0, -1, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0,
+    0, 0, -3, 0, -1, 0, 0, 0, 0, -1, 1, 0, -2, 0, 4, 0, 0, -2, -3, -4, 1, -4, 0, -6, 0, -1, 0, 4, 2, -1, 5, -1, -1, 0, -1, -1, -2, 0, -2, 0, -1, 0, 0, 1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -4, -3,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 4, 2, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 4, 4, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 4, 1, 0, 2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 1, 0, 0, 0, 0, 0, 1, 2, 0, 0, 4, 2, 4, 0, 4, 2, 2, 2, 4,
+    0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, -2, -2, 0, 0, 0, -1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 3, 0, 0, 3, 0, 0, -1, -1, -1, 0, -1, 0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    -1, 0, 0, -4, 0, -4, 0, 0, 0, 0, -4, -1, -1, -2, 0, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, -3, 0, -1, -3, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, -1, 0, 0, -4, -4, 0, -3, 0, 0, -3, 0, -3, 0, 0, 0, -3, -1, 0, 0,
+    -3, 0, 0, -5, 0, -5, 0, 0, 0, -2, -6, -2, -2, -2, -2, -2, -2, -1, -2, -1, -1, -1, -1, 0, 0, -4, -1, -2, -4, -1, 0, -1, -1, -3, 0, -1, 0, -2, 0, -1, 0, 0, 0, -6, 0, -4, -1, 0, -4, -1, -4, -1, 0, -1, -3, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 3, 0, 0, -2, -2, -4, 2, -2, 0, 0, 0, -1, 0, 3, 1, 0, 3, -1, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -4, -4,
+};
+
+static const EpdLigaturePair bookerly_18_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_18_italic = {
     bookerly_18_italicBitmaps,
     bookerly_18_italicGlyphs,
     bookerly_18_italicIntervals,
-    60,
+    61,
     49,
     40,
     -10,
     true,
+    bookerly_18_italicKernLeftClasses,
+    261,
+    bookerly_18_italicKernRightClasses,
+    280,
+    bookerly_18_italicKernMatrix,
+    72,
+    58,
+    bookerly_18_italicLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_18_regularBitmaps[105210] = {
+static const uint8_t bookerly_18_regularBitmaps[106396] = {
     0x05, 0x43, 0xF8, 0xBF, 0x4F, 0xF4, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFE,
     0x0F, 0xE0, 0xBE, 0x0B, 0xE0, 0xBE, 0x0B, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x03, 0xE0, 0x3E, 0x01,
     0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xFC, 0xBF, 0xCF, 0xFC, 0xBF, 0xC1, 0x90, 0x00, 0x00, 0x00,
@@ -6583,7 +6583,81 @@ static const uint8_t bookerly_18_regularBitmaps[105210] = {
     0xF0, 0x1A, 0x47, 0xFC, 0xFF, 0xDF, 0xFD, 0x7F, 0xC0, 0x50, 0x0A, 0x80, 0x00, 0x02, 0x90, 0x00,
     0x01, 0xA0, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x0B, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF8, 0x00,
     0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFD, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0x07, 0xF8, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x40,
+    0x07, 0xF8, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x69, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0xBF,
+    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xF4,
+    0x00, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x10, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
+    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x95, 0x55, 0x7F, 0xE5,
+    0x54, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x15, 0xBF, 0x95, 0x55, 0x7F, 0xE5, 0x54, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00, 0x7F, 0xE9, 0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF,
+    0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF4,
+    0x17, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xE0, 0x00,
+    0x02, 0xFC, 0x00, 0x00, 0x60, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x55, 0x56, 0xBC, 0x00, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x05, 0x6F, 0xE5, 0x55, 0x5F,
+    0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC,
+    0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0,
+    0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
+    0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00,
+    0x02, 0xFC, 0x00, 0x07, 0xFF, 0x50, 0x01, 0xFF, 0xA4, 0x1F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0x8F,
+    0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x40, 0x00, 0x00, 0x02, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x06, 0xFF, 0x00, 0x00,
+    0x07, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x02,
+    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x1F,
+    0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF9, 0x54, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF,
+    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x2F, 0xC0, 0x05, 0x6F, 0xE5, 0x50, 0x0B, 0xF0, 0x00, 0x07, 0xF4,
+    0x00, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00,
+    0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00,
+    0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00,
+    0x2F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x07,
+    0xFF, 0x50, 0x01, 0xFF, 0xA4, 0x1F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x42, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9,
+    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x1B, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x0F,
+    0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
+    0xE0, 0x00, 0x02, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0x95, 0x55, 0x7F, 0xE5, 0x55, 0x5A, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x5B, 0xF9,
+    0x55, 0x57, 0xFE, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0,
+    0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40,
+    0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
+    0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00,
+    0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00,
+    0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
+    0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00,
+    0x0B, 0xF0, 0x00, 0x1F, 0xFD, 0x40, 0x07, 0xFE, 0x50, 0x01, 0xFF, 0xA4, 0x1F, 0xFF, 0xFD, 0x07,
+    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x94, 0x10, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x3F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x06, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x0B,
+    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
+    0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
+    0x95, 0x55, 0x7F, 0xE5, 0x50, 0x0B, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xF0, 0x01, 0x5B, 0xF9, 0x55, 0x57, 0xFE,
+    0x55, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4,
+    0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0,
+    0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0,
+    0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40,
+    0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
+    0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00,
+    0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00,
+    0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
+    0x1F, 0xFD, 0x40, 0x07, 0xFE, 0x50, 0x01, 0xFF, 0x94, 0x1F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0x41,
+    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE,
 };
 
 static const EpdGlyph bookerly_18_regularGlyphs[] = {
@@ -7315,6 +7389,11 @@ static const EpdGlyph bookerly_18_regularGlyphs[] = {
     { 22, 27, 38, 8, 27, 149, 105004 }, // ⊥
     { 6, 6, 24, 9, 13, 9, 105153 }, // ⋅
     { 32, 6, 38, 3, 13, 48, 105162 }, // ⋯
+    { 32, 30, 28, 0, 30, 240, 105210 }, // ﬀ
+    { 25, 30, 25, 0, 30, 188, 105450 }, // ﬁ
+    { 25, 30, 26, 0, 30, 188, 105638 }, // ﬂ
+    { 38, 30, 38, 0, 30, 285, 105826 }, // ﬃ
+    { 38, 30, 38, 0, 30, 285, 106111 }, // ﬄ
 };
 
 static const EpdUnicodeInterval bookerly_18_regularIntervals[] = {
@@ -7378,15 +7457,666 @@ static const EpdUnicodeInterval bookerly_18_regularIntervals[] = {
     { 0x22A5, 0x22A5, 0x2D5 },
     { 0x22C5, 0x22C5, 0x2D6 },
     { 0x22EF, 0x22EF, 0x2D7 },
+    { 0xFB00, 0xFB04, 0x2D8 },
+};
+
+static const EpdKernClassEntry bookerly_18_regularKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x2A, 3 }, // *
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x2F, 6 }, // /
+    { 0x3A, 7 }, // :
+    { 0x3B, 7 }, // ;
+    { 0x40, 8 }, // @
+    { 0x41, 9 }, // A
+    { 0x42, 10 }, // B
+    { 0x43, 11 }, // C
+    { 0x44, 12 }, // D
+    { 0x46, 13 }, // F
+    { 0x47, 14 }, // G
+    { 0x48, 15 }, // H
+    { 0x49, 15 }, // I
+    { 0x4A, 16 }, // J
+    { 0x4B, 17 }, // K
+    { 0x4C, 18 }, // L
+    { 0x4D, 19 }, // M
+    { 0x4E, 20 }, // N
+    { 0x4F, 12 }, // O
+    { 0x50, 21 }, // P
+    { 0x51, 22 }, // Q
+    { 0x52, 23 }, // R
+    { 0x53, 24 }, // S
+    { 0x54, 25 }, // T
+    { 0x55, 26 }, // U
+    { 0x56, 27 }, // V
+    { 0x57, 27 }, // W
+    { 0x58, 28 }, // X
+    { 0x59, 29 }, // Y
+    { 0x5A, 30 }, // Z
+    { 0x5B, 31 }, // [
+    { 0x5C, 32 }, // <backslash>
+    { 0x61, 33 }, // a
+    { 0x62, 34 }, // b
+    { 0x63, 35 }, // c
+    { 0x64, 36 }, // d
+    { 0x65, 37 }, // e
+    { 0x66, 38 }, // f
+    { 0x67, 39 }, // g
+    { 0x68, 40 }, // h
+    { 0x69, 36 }, // i
+    { 0x6A, 41 }, // j
+    { 0x6B, 42 }, // k
+    { 0x6C, 43 }, // l
+    { 0x6D, 40 }, // m
+    { 0x6E, 40 }, // n
+    { 0x6F, 34 }, // o
+    { 0x70, 34 }, // p
+    { 0x71, 44 }, // q
+    { 0x72, 45 }, // r
+    { 0x73, 46 }, // s
+    { 0x74, 47 }, // t
+    { 0x75, 48 }, // u
+    { 0x76, 49 }, // v
+    { 0x77, 49 }, // w
+    { 0x78, 50 }, // x
+    { 0x79, 49 }, // y
+    { 0x7A, 51 }, // z
+    { 0x7B, 52 }, // {
+    { 0xA1, 53 }, // ¡
+    { 0xAB, 54 }, // «
+    { 0xAD, 5 }, // ­
+    { 0xBB, 55 }, // »
+    { 0xBF, 56 }, // ¿
+    { 0xC0, 9 }, // À
+    { 0xC1, 9 }, // Á
+    { 0xC2, 9 }, // Â
+    { 0xC3, 9 }, // Ã
+    { 0xC4, 9 }, // Ä
+    { 0xC5, 9 }, // Å
+    { 0xC7, 11 }, // Ç
+    { 0xCC, 15 }, // Ì
+    { 0xCD, 15 }, // Í
+    { 0xCE, 15 }, // Î
+    { 0xCF, 15 }, // Ï
+    { 0xD0, 12 }, // Ð
+    { 0xD1, 20 }, // Ñ
+    { 0xD2, 12 }, // Ò
+    { 0xD3, 12 }, // Ó
+    { 0xD4, 12 }, // Ô
+    { 0xD5, 12 }, // Õ
+    { 0xD6, 12 }, // Ö
+    { 0xD8, 57 }, // Ø
+    { 0xD9, 26 }, // Ù
+    { 0xDA, 26 }, // Ú
+    { 0xDB, 26 }, // Û
+    { 0xDC, 26 }, // Ü
+    { 0xDD, 29 }, // Ý
+    { 0xDE, 58 }, // Þ
+    { 0xDF, 59 }, // ß
+    { 0xE0, 33 }, // à
+    { 0xE1, 33 }, // á
+    { 0xE2, 33 }, // â
+    { 0xE3, 33 }, // ã
+    { 0xE4, 33 }, // ä
+    { 0xE5, 33 }, // å
+    { 0xE6, 37 }, // æ
+    { 0xE7, 35 }, // ç
+    { 0xE8, 37 }, // è
+    { 0xE9, 37 }, // é
+    { 0xEA, 37 }, // ê
+    { 0xEB, 37 }, // ë
+    { 0xEC, 36 }, // ì
+    { 0xED, 36 }, // í
+    { 0xEE, 60 }, // î
+    { 0xEF, 60 }, // ï
+    { 0xF0, 61 }, // ð
+    { 0xF1, 40 }, // ñ
+    { 0xF2, 34 }, // ò
+    { 0xF3, 34 }, // ó
+    { 0xF4, 34 }, // ô
+    { 0xF5, 34 }, // õ
+    { 0xF6, 34 }, // ö
+    { 0xF8, 34 }, // ø
+    { 0xF9, 48 }, // ù
+    { 0xFA, 48 }, // ú
+    { 0xFB, 48 }, // û
+    { 0xFC, 48 }, // ü
+    { 0xFD, 49 }, // ý
+    { 0xFE, 34 }, // þ
+    { 0xFF, 49 }, // ÿ
+    { 0x100, 9 }, // Ā
+    { 0x101, 33 }, // ā
+    { 0x102, 9 }, // Ă
+    { 0x103, 33 }, // ă
+    { 0x104, 62 }, // Ą
+    { 0x105, 63 }, // ą
+    { 0x106, 11 }, // Ć
+    { 0x107, 35 }, // ć
+    { 0x108, 11 }, // Ĉ
+    { 0x109, 35 }, // ĉ
+    { 0x10A, 11 }, // Ċ
+    { 0x10B, 35 }, // ċ
+    { 0x10C, 11 }, // Č
+    { 0x10D, 35 }, // č
+    { 0x10E, 12 }, // Ď
+    { 0x10F, 64 }, // ď
+    { 0x110, 12 }, // Đ
+    { 0x111, 36 }, // đ
+    { 0x113, 37 }, // ē
+    { 0x115, 37 }, // ĕ
+    { 0x117, 37 }, // ė
+    { 0x118, 65 }, // Ę
+    { 0x119, 66 }, // ę
+    { 0x11B, 37 }, // ě
+    { 0x11C, 14 }, // Ĝ
+    { 0x11D, 39 }, // ĝ
+    { 0x11E, 14 }, // Ğ
+    { 0x11F, 39 }, // ğ
+    { 0x120, 14 }, // Ġ
+    { 0x121, 39 }, // ġ
+    { 0x122, 14 }, // Ģ
+    { 0x123, 39 }, // ģ
+    { 0x124, 15 }, // Ĥ
+    { 0x125, 40 }, // ĥ
+    { 0x126, 15 }, // Ħ
+    { 0x127, 40 }, // ħ
+    { 0x128, 15 }, // Ĩ
+    { 0x129, 60 }, // ĩ
+    { 0x12A, 15 }, // Ī
+    { 0x12B, 60 }, // ī
+    { 0x12C, 15 }, // Ĭ
+    { 0x12D, 60 }, // ĭ
+    { 0x12E, 67 }, // Į
+    { 0x12F, 68 }, // į
+    { 0x130, 15 }, // İ
+    { 0x131, 36 }, // ı
+    { 0x132, 16 }, // Ĳ
+    { 0x133, 41 }, // ĳ
+    { 0x134, 16 }, // Ĵ
+    { 0x135, 69 }, // ĵ
+    { 0x136, 17 }, // Ķ
+    { 0x137, 42 }, // ķ
+    { 0x138, 42 }, // ĸ
+    { 0x139, 18 }, // Ĺ
+    { 0x13A, 43 }, // ĺ
+    { 0x13B, 18 }, // Ļ
+    { 0x13C, 43 }, // ļ
+    { 0x13E, 64 }, // ľ
+    { 0x141, 18 }, // Ł
+    { 0x142, 70 }, // ł
+    { 0x143, 20 }, // Ń
+    { 0x144, 40 }, // ń
+    { 0x145, 20 }, // Ņ
+    { 0x146, 40 }, // ņ
+    { 0x147, 20 }, // Ň
+    { 0x148, 40 }, // ň
+    { 0x149, 40 }, // ŉ
+    { 0x14A, 20 }, // Ŋ
+    { 0x14B, 40 }, // ŋ
+    { 0x14C, 12 }, // Ō
+    { 0x14D, 34 }, // ō
+    { 0x14E, 12 }, // Ŏ
+    { 0x14F, 34 }, // ŏ
+    { 0x150, 12 }, // Ő
+    { 0x151, 34 }, // ő
+    { 0x153, 37 }, // œ
+    { 0x154, 23 }, // Ŕ
+    { 0x155, 45 }, // ŕ
+    { 0x156, 23 }, // Ŗ
+    { 0x157, 45 }, // ŗ
+    { 0x158, 23 }, // Ř
+    { 0x159, 45 }, // ř
+    { 0x15A, 24 }, // Ś
+    { 0x15B, 46 }, // ś
+    { 0x15C, 24 }, // Ŝ
+    { 0x15D, 46 }, // ŝ
+    { 0x15E, 24 }, // Ş
+    { 0x15F, 46 }, // ş
+    { 0x160, 24 }, // Š
+    { 0x161, 46 }, // š
+    { 0x162, 25 }, // Ţ
+    { 0x163, 71 }, // ţ
+    { 0x164, 25 }, // Ť
+    { 0x166, 25 }, // Ŧ
+    { 0x167, 47 }, // ŧ
+    { 0x168, 26 }, // Ũ
+    { 0x169, 48 }, // ũ
+    { 0x16A, 26 }, // Ū
+    { 0x16B, 48 }, // ū
+    { 0x16C, 26 }, // Ŭ
+    { 0x16D, 48 }, // ŭ
+    { 0x16E, 26 }, // Ů
+    { 0x16F, 48 }, // ů
+    { 0x170, 26 }, // Ű
+    { 0x171, 48 }, // ű
+    { 0x172, 26 }, // Ų
+    { 0x173, 72 }, // ų
+    { 0x174, 27 }, // Ŵ
+    { 0x175, 49 }, // ŵ
+    { 0x176, 29 }, // Ŷ
+    { 0x177, 49 }, // ŷ
+    { 0x178, 29 }, // Ÿ
+    { 0x179, 30 }, // Ź
+    { 0x17A, 51 }, // ź
+    { 0x17B, 30 }, // Ż
+    { 0x17C, 51 }, // ż
+    { 0x17D, 30 }, // Ž
+    { 0x17E, 51 }, // ž
+    { 0x2010, 5 }, // ‐
+    { 0x2011, 5 }, // ‑
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 73 }, // ‘
+    { 0x2019, 74 }, // ’
+    { 0x201A, 4 }, // ‚
+    { 0x201B, 73 }, // ‛
+    { 0x201C, 73 }, // “
+    { 0x201D, 74 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x201F, 73 }, // ‟
+    { 0x2025, 4 }, // ‥
+    { 0x2026, 4 }, // …
+    { 0x2039, 54 }, // ‹
+    { 0x203A, 55 }, // ›
+    { 0xFB00, 38 }, // ﬀ
+    { 0xFB01, 36 }, // ﬁ
+    { 0xFB02, 43 }, // ﬂ
+    { 0xFB03, 36 }, // ﬃ
+    { 0xFB04, 43 }, // ﬄ
+};
+
+static const EpdKernClassEntry bookerly_18_regularKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x27, 2 }, // '
+    { 0x29, 3 }, // )
+    { 0x2A, 4 }, // *
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 7 }, // .
+    { 0x2F, 8 }, // /
+    { 0x3A, 9 }, // :
+    { 0x3B, 10 }, // ;
+    { 0x3F, 11 }, // ?
+    { 0x41, 12 }, // A
+    { 0x42, 13 }, // B
+    { 0x43, 14 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 13 }, // E
+    { 0x46, 13 }, // F
+    { 0x47, 14 }, // G
+    { 0x48, 13 }, // H
+    { 0x49, 13 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 13 }, // K
+    { 0x4C, 13 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 13 }, // N
+    { 0x4F, 14 }, // O
+    { 0x50, 13 }, // P
+    { 0x51, 14 }, // Q
+    { 0x52, 13 }, // R
+    { 0x53, 17 }, // S
+    { 0x54, 18 }, // T
+    { 0x55, 19 }, // U
+    { 0x56, 20 }, // V
+    { 0x57, 20 }, // W
+    { 0x58, 21 }, // X
+    { 0x59, 22 }, // Y
+    { 0x5A, 23 }, // Z
+    { 0x5C, 24 }, // <backslash>
+    { 0x5D, 25 }, // ]
+    { 0x61, 26 }, // a
+    { 0x62, 27 }, // b
+    { 0x63, 28 }, // c
+    { 0x64, 28 }, // d
+    { 0x65, 28 }, // e
+    { 0x66, 29 }, // f
+    { 0x67, 30 }, // g
+    { 0x68, 31 }, // h
+    { 0x69, 32 }, // i
+    { 0x6A, 33 }, // j
+    { 0x6B, 31 }, // k
+    { 0x6C, 31 }, // l
+    { 0x6D, 34 }, // m
+    { 0x6E, 34 }, // n
+    { 0x6F, 28 }, // o
+    { 0x70, 35 }, // p
+    { 0x71, 28 }, // q
+    { 0x72, 34 }, // r
+    { 0x73, 36 }, // s
+    { 0x74, 37 }, // t
+    { 0x75, 38 }, // u
+    { 0x76, 39 }, // v
+    { 0x77, 39 }, // w
+    { 0x78, 40 }, // x
+    { 0x79, 41 }, // y
+    { 0x7A, 42 }, // z
+    { 0x7D, 43 }, // }
+    { 0xAB, 44 }, // «
+    { 0xAD, 6 }, // ­
+    { 0xBB, 45 }, // »
+    { 0xBF, 46 }, // ¿
+    { 0xC0, 12 }, // À
+    { 0xC1, 12 }, // Á
+    { 0xC2, 12 }, // Â
+    { 0xC3, 12 }, // Ã
+    { 0xC4, 12 }, // Ä
+    { 0xC5, 12 }, // Å
+    { 0xC6, 47 }, // Æ
+    { 0xC7, 14 }, // Ç
+    { 0xC8, 13 }, // È
+    { 0xC9, 13 }, // É
+    { 0xCA, 13 }, // Ê
+    { 0xCB, 13 }, // Ë
+    { 0xCC, 13 }, // Ì
+    { 0xCD, 13 }, // Í
+    { 0xCE, 13 }, // Î
+    { 0xCF, 13 }, // Ï
+    { 0xD0, 13 }, // Ð
+    { 0xD1, 13 }, // Ñ
+    { 0xD2, 14 }, // Ò
+    { 0xD3, 14 }, // Ó
+    { 0xD4, 14 }, // Ô
+    { 0xD5, 14 }, // Õ
+    { 0xD6, 14 }, // Ö
+    { 0xD8, 48 }, // Ø
+    { 0xD9, 19 }, // Ù
+    { 0xDA, 19 }, // Ú
+    { 0xDB, 19 }, // Û
+    { 0xDC, 19 }, // Ü
+    { 0xDD, 22 }, // Ý
+    { 0xDE, 13 }, // Þ
+    { 0xDF, 49 }, // ß
+    { 0xE0, 26 }, // à
+    { 0xE1, 26 }, // á
+    { 0xE2, 26 }, // â
+    { 0xE3, 50 }, // ã
+    { 0xE4, 51 }, // ä
+    { 0xE5, 26 }, // å
+    { 0xE6, 26 }, // æ
+    { 0xE7, 28 }, // ç
+    { 0xE8, 28 }, // è
+    { 0xE9, 28 }, // é
+    { 0xEA, 28 }, // ê
+    { 0xEB, 52 }, // ë
+    { 0xEC, 53 }, // ì
+    { 0xED, 32 }, // í
+    { 0xEE, 54 }, // î
+    { 0xEF, 55 }, // ï
+    { 0xF0, 28 }, // ð
+    { 0xF1, 34 }, // ñ
+    { 0xF2, 28 }, // ò
+    { 0xF3, 28 }, // ó
+    { 0xF4, 28 }, // ô
+    { 0xF5, 28 }, // õ
+    { 0xF6, 28 }, // ö
+    { 0xF8, 56 }, // ø
+    { 0xF9, 38 }, // ù
+    { 0xFA, 38 }, // ú
+    { 0xFB, 38 }, // û
+    { 0xFC, 38 }, // ü
+    { 0xFD, 41 }, // ý
+    { 0xFE, 31 }, // þ
+    { 0xFF, 41 }, // ÿ
+    { 0x100, 12 }, // Ā
+    { 0x101, 57 }, // ā
+    { 0x102, 12 }, // Ă
+    { 0x103, 57 }, // ă
+    { 0x104, 12 }, // Ą
+    { 0x105, 26 }, // ą
+    { 0x106, 14 }, // Ć
+    { 0x107, 28 }, // ć
+    { 0x108, 14 }, // Ĉ
+    { 0x109, 28 }, // ĉ
+    { 0x10A, 14 }, // Ċ
+    { 0x10B, 28 }, // ċ
+    { 0x10C, 14 }, // Č
+    { 0x10D, 28 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 28 }, // ď
+    { 0x110, 13 }, // Đ
+    { 0x111, 28 }, // đ
+    { 0x112, 13 }, // Ē
+    { 0x113, 58 }, // ē
+    { 0x114, 13 }, // Ĕ
+    { 0x115, 58 }, // ĕ
+    { 0x116, 13 }, // Ė
+    { 0x117, 28 }, // ė
+    { 0x118, 13 }, // Ę
+    { 0x119, 28 }, // ę
+    { 0x11A, 13 }, // Ě
+    { 0x11B, 28 }, // ě
+    { 0x11C, 14 }, // Ĝ
+    { 0x11D, 30 }, // ĝ
+    { 0x11E, 14 }, // Ğ
+    { 0x11F, 30 }, // ğ
+    { 0x120, 14 }, // Ġ
+    { 0x121, 30 }, // ġ
+    { 0x122, 14 }, // Ģ
+    { 0x123, 30 }, // ģ
+    { 0x124, 13 }, // Ĥ
+    { 0x125, 31 }, // ĥ
+    { 0x126, 13 }, // Ħ
+    { 0x127, 59 }, // ħ
+    { 0x128, 13 }, // Ĩ
+    { 0x129, 55 }, // ĩ
+    { 0x12A, 13 }, // Ī
+    { 0x12B, 55 }, // ī
+    { 0x12C, 13 }, // Ĭ
+    { 0x12D, 55 }, // ĭ
+    { 0x12E, 13 }, // Į
+    { 0x12F, 32 }, // į
+    { 0x130, 13 }, // İ
+    { 0x131, 32 }, // ı
+    { 0x132, 13 }, // Ĳ
+    { 0x133, 32 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 60 }, // ĵ
+    { 0x136, 13 }, // Ķ
+    { 0x137, 31 }, // ķ
+    { 0x138, 34 }, // ĸ
+    { 0x139, 13 }, // Ĺ
+    { 0x13A, 31 }, // ĺ
+    { 0x13B, 13 }, // Ļ
+    { 0x13C, 31 }, // ļ
+    { 0x13D, 13 }, // Ľ
+    { 0x13E, 31 }, // ľ
+    { 0x13F, 13 }, // Ŀ
+    { 0x140, 31 }, // ŀ
+    { 0x141, 13 }, // Ł
+    { 0x142, 61 }, // ł
+    { 0x143, 13 }, // Ń
+    { 0x144, 34 }, // ń
+    { 0x145, 13 }, // Ņ
+    { 0x146, 34 }, // ņ
+    { 0x147, 13 }, // Ň
+    { 0x148, 34 }, // ň
+    { 0x149, 34 }, // ŉ
+    { 0x14A, 13 }, // Ŋ
+    { 0x14B, 34 }, // ŋ
+    { 0x14C, 14 }, // Ō
+    { 0x14D, 28 }, // ō
+    { 0x14E, 14 }, // Ŏ
+    { 0x14F, 28 }, // ŏ
+    { 0x150, 14 }, // Ő
+    { 0x151, 28 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x153, 28 }, // œ
+    { 0x154, 13 }, // Ŕ
+    { 0x155, 34 }, // ŕ
+    { 0x156, 13 }, // Ŗ
+    { 0x157, 34 }, // ŗ
+    { 0x158, 13 }, // Ř
+    { 0x159, 62 }, // ř
+    { 0x15A, 17 }, // Ś
+    { 0x15B, 36 }, // ś
+    { 0x15C, 17 }, // Ŝ
+    { 0x15D, 36 }, // ŝ
+    { 0x15E, 17 }, // Ş
+    { 0x15F, 36 }, // ş
+    { 0x160, 17 }, // Š
+    { 0x161, 63 }, // š
+    { 0x162, 18 }, // Ţ
+    { 0x163, 37 }, // ţ
+    { 0x164, 18 }, // Ť
+    { 0x165, 37 }, // ť
+    { 0x166, 18 }, // Ŧ
+    { 0x167, 37 }, // ŧ
+    { 0x168, 19 }, // Ũ
+    { 0x169, 38 }, // ũ
+    { 0x16A, 19 }, // Ū
+    { 0x16B, 38 }, // ū
+    { 0x16C, 19 }, // Ŭ
+    { 0x16D, 38 }, // ŭ
+    { 0x16E, 19 }, // Ů
+    { 0x16F, 38 }, // ů
+    { 0x170, 19 }, // Ű
+    { 0x171, 38 }, // ű
+    { 0x172, 19 }, // Ų
+    { 0x173, 38 }, // ų
+    { 0x174, 20 }, // Ŵ
+    { 0x175, 39 }, // ŵ
+    { 0x176, 22 }, // Ŷ
+    { 0x177, 41 }, // ŷ
+    { 0x178, 22 }, // Ÿ
+    { 0x179, 23 }, // Ź
+    { 0x17A, 42 }, // ź
+    { 0x17B, 23 }, // Ż
+    { 0x17C, 42 }, // ż
+    { 0x17D, 23 }, // Ž
+    { 0x17E, 64 }, // ž
+    { 0x17F, 49 }, // ſ
+    { 0x2010, 6 }, // ‐
+    { 0x2011, 6 }, // ‑
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 65 }, // ‘
+    { 0x2019, 66 }, // ’
+    { 0x201A, 7 }, // ‚
+    { 0x201B, 65 }, // ‛
+    { 0x201C, 65 }, // “
+    { 0x201D, 66 }, // ”
+    { 0x201E, 7 }, // „
+    { 0x201F, 65 }, // ‟
+    { 0x2025, 7 }, // ‥
+    { 0x2026, 7 }, // …
+    { 0x2039, 44 }, // ‹
+    { 0x203A, 45 }, // ›
+    { 0xFB00, 29 }, // ﬀ
+    { 0xFB01, 29 }, // ﬁ
+    { 0xFB02, 29 }, // ﬂ
+    { 0xFB03, 29 }, // ﬃ
+    { 0xFB04, 29 }, // ﬄ
+};
+
+static const int8_t bookerly_18_regularKernMatrix[4884] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 1, 1, -1, -1, -1, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 1, 0, 0, -3, -2, -3, 0, -3, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -3, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -3, -2, -3, 0, 0, 0, -2, -2, -3, 0, -1, -1, -2, -1, -2, 0, 0, 0, 0, -5, -2, 0, -4, -4, -3, 0, 2, 2, -3, -4, -3, 0, 0, 0, -2, -3, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -3, 0, -1, 0, 1, 0, 0, -2, 1, 0, -1, 0, 1, 0, -4, -2, -4, 1, -4, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 1, -2, 0, 0, -1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -1, 0, -2, 0, -2, -2, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, -3, 0, -3, -3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -4, 0, 0, -1, -1, -1, 0, 2, 2, -1, -1, -1, 0, 2, 0, 0, -1, -1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 1, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -1, -2, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -2, 0, 0, -1, -1, -1, 0, 1, 1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, 0, 1, 1, -1, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -2, -1, -3, 0, -3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, -1, -1, -1, 0, 2, 2, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 1, 0, 1, -4, 0, -4, -4, 0, 0, 0, -4, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 1, 0, 0, -1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, -5, 0, 0, -1, -1, -1, 0, 1, 1, -1, -1, -1, 0, 2, 0, 0, -1, 0, 1, 1,
+    0, 0, 2, 0, 1, 0, -2, -2, 0, 1, 0, -1, -1, 0, 4, 0, 0, 0, -1, -1, -1, -2, 0, -1, 2, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 2, 0, 3, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 2, 0, -1, 0, 1, 0, -2, -1, -2, 1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2,
+    0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, -2, -3, -5, -2, -2, 0, -4, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -4, -1, 0, -2, -2, -2, 0, 2, 2, -2, -2, -2, 0, 0, 0, 0, -3, -1, 1, 1,
+    0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -3, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -3, -1, -1, -1, -1, -1, 0, 2, 2, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0,
+    0, 0, 0, 2, -4, -2, -4, -5, -1, -1, 0, -4, 0, -2, 0, -1, -1, 0, 0, 1, 0, 1, 0, 0, 0, -2, 1, -3, -1, -3, 1, 0, 0, -1, -1, -2, 0, -1, -1, -1, -1, -1, 0, -2, -1, 0, -5, -2, 0, -2, -1, -3, 0, 2, 2, -3, -2, -3, 1, 2, 1, -1, -2, -1, 0, 1,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -2, 1, -2, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, -2, -3, -4, -1, -1, 0, -4, 0, -2, 0, -1, -1, 0, 0, 1, 0, 1, 0, 0, 0, -2, 1, -3, -1, -2, 1, 0, 0, -1, -1, -3, 0, -1, -1, -1, -1, -1, 0, -2, -2, 0, -4, -2, 0, -2, -1, -3, 0, 2, 3, -3, -1, -3, 1, 2, 1, -1, -3, -1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, -2, -4, 0, -3, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, -1, -1, -1, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0,
+    2, 4, 4, 4, -1, 0, -1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, -1, 0, 0, 0, 1, 1, 0, 0, -1, 0, 0, 1, 0, 1, 0, 4, 0, 0, 0, 0, 0, 0, 1, 2, 1, 4, 3, 5, -1, 1, 0, 4, 4, 0, 2, 1, 1, 3, 4,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 1, 2,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 1, -2, -1, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 1, 1,
+    0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 2, -3, -1, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, -2, -1, 0, 1, 0, 1, -1, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 2, -1, 0, -1, 0, 2, 2,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, -2, -1, -3, 0, -2, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -2, -1, 0, 0,
+    0, 0, -1, 0, -2, 0, -2, -2, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -3, 0, -3, -4, 0, 0, -1, -4, -2, 0, -2, -2, -1, -1, -1, -2, -3, -3, 0, -3, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 1,
+    0, 0, -1, -1, -1, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, -1,
+    0, -2, 0, -3, 0, -1, 0, 1, 0, 0, -2, 1, 0, -1, 1, 1, 0, -4, -2, -4, 1, -4, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, -1, -2, 1, -2, 0, 0, -1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -3, -3,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -2, -1,
+    1, 0, 3, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 4, 0, 2, 0, 4, 2, 2, 0, 0, 0, 2, 1, 1, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 4, 3, 4, 2, 2, 1, 2, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 1, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 2, 0, 1, 0, 1, 0, 0, 0, 0, 1, -1, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, -1, 0, 2, 2, -1, 0, -1, 1, 2, 1, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, -4, 0, -2, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, -2, 0, -2, 0, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -6, -2, 0, -2, -2, -2, 0, 1, 1, -2, -2, -2, 0, 2, 0, 0, -3, -1, 0, 0,
+};
+
+static const EpdLigaturePair bookerly_18_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData bookerly_18_regular = {
     bookerly_18_regularBitmaps,
     bookerly_18_regularGlyphs,
     bookerly_18_regularIntervals,
-    60,
+    61,
     49,
     40,
     -10,
     true,
+    bookerly_18_regularKernLeftClasses,
+    267,
+    bookerly_18_regularKernRightClasses,
+    283,
+    bookerly_18_regularKernMatrix,
+    74,
+    66,
+    bookerly_18_regularLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_boldBitmaps[49639] = {
+static const uint8_t notosans_12_boldBitmaps[50159] = {
     0x7F, 0xAF, 0xE7, 0xF9, 0xFD, 0x7F, 0x5F, 0xD7, 0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x00,
     0x00, 0x02, 0xE2, 0xFE, 0xBF, 0x9F, 0xD0, 0x40, 0x7F, 0x0F, 0xD7, 0xF0, 0xFD, 0x7F, 0x0F, 0xC3,
     0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xE0, 0xBC, 0x29, 0x06, 0x80, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x1F,
@@ -3110,7 +3110,39 @@ static const uint8_t notosans_12_boldBitmaps[49639] = {
     0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F,
     0xC0, 0x14, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xF5, 0xAA, 0xAA, 0xA8,
+    0xDF, 0xFF, 0xFF, 0xF5, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x02,
+    0xFF, 0xC0, 0x2F, 0xFF, 0x43, 0xFF, 0xF0, 0x0F, 0xFF, 0xC2, 0xFF, 0xF8, 0x07, 0xF8, 0x00, 0xBF,
+    0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xE9, 0x1F, 0xFA, 0x81, 0xFF, 0xFF, 0xAF, 0xFF,
+    0xF0, 0xBF, 0xFF, 0xEF, 0xFF, 0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x0F, 0xF0,
+    0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0,
+    0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00,
+    0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0xFC, 0x02, 0xFF, 0xF6, 0xFD, 0x03, 0xFF, 0xF2, 0xFD,
+    0x07, 0xF8, 0x00, 0x64, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x91, 0xA8, 0x7F, 0xFF, 0xE2, 0xFD,
+    0xBF, 0xFF, 0xE2, 0xFD, 0x0B, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD,
+    0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD,
+    0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0xFD, 0x02, 0xFF, 0xF6, 0xFD, 0x03, 0xFF, 0xF2, 0xFD,
+    0x07, 0xF8, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x0B, 0xFE, 0x92, 0xFD, 0x7F, 0xFF, 0xE2, 0xFD,
+    0xBF, 0xFF, 0xE2, 0xFD, 0x0B, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD,
+    0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD,
+    0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD, 0x07, 0xF4, 0x02, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0xBF, 0xF1, 0xF8, 0x02, 0xFF, 0xF4,
+    0x3F, 0xFF, 0x3F, 0xC0, 0x3F, 0xFF, 0x0B, 0xFF, 0xE3, 0xFC, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x0A,
+    0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x91, 0xFF, 0xA8, 0x2A, 0x87, 0xFF, 0xFE,
+    0xBF, 0xFF, 0xC3, 0xFC, 0xBF, 0xFF, 0xEF, 0xFF, 0xFC, 0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0x03,
+    0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4,
+    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x00,
+    0x3F, 0xC0, 0x7F, 0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F,
+    0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x0F, 0xF0,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x02, 0xFF, 0xCF, 0xF0, 0x2F,
+    0xFF, 0x43, 0xFF, 0xF3, 0xFC, 0x0F, 0xFF, 0xC2, 0xFF, 0xFC, 0xFF, 0x07, 0xF8, 0x00, 0xBF, 0x00,
+    0x3F, 0xC1, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0xBF, 0xE9, 0x1F, 0xFA, 0x83, 0xFD, 0xFF, 0xFF,
+    0xAF, 0xFF, 0xF0, 0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFC, 0x3F, 0xC2, 0xFD, 0x00, 0x3F, 0xC0, 0x0F,
+    0xF0, 0x7F, 0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x07, 0xF4, 0x00,
+    0xFF, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x7F, 0x40, 0x0F, 0xF0, 0x03, 0xFC,
+    0x1F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x3F,
+    0xC0, 0x0F, 0xF0, 0x7F, 0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0xFF,
 };
 
 static const EpdGlyph notosans_12_boldGlyphs[] = {
@@ -3948,6 +3980,11 @@ static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 12, 24, 14, 2, 21, 72, 49497 }, // ₿
     { 12, 19, 13, 1, 14, 57, 49569 }, // ⃀
     { 13, 4, 15, 1, 11, 13, 49626 }, // −
+    { 21, 20, 19, 0, 20, 105, 49639 }, // ﬀ
+    { 16, 20, 17, 0, 20, 80, 49744 }, // ﬁ
+    { 16, 20, 17, 0, 20, 80, 49824 }, // ﬂ
+    { 26, 20, 27, 0, 20, 130, 49904 }, // ﬃ
+    { 25, 20, 27, 0, 20, 125, 50034 }, // ﬄ
 };
 
 static const EpdUnicodeInterval notosans_12_boldIntervals[] = {
@@ -3962,15 +3999,332 @@ static const EpdUnicodeInterval notosans_12_boldIntervals[] = {
     { 0x2066, 0x206F, 0x316 },
     { 0x20A0, 0x20C0, 0x320 },
     { 0x2212, 0x2212, 0x341 },
+    { 0xFB00, 0xFB04, 0x342 },
+};
+
+static const EpdKernClassEntry notosans_12_boldKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x41, 6 }, // A
+    { 0x44, 7 }, // D
+    { 0x45, 8 }, // E
+    { 0x46, 9 }, // F
+    { 0x4C, 10 }, // L
+    { 0x4F, 7 }, // O
+    { 0x50, 11 }, // P
+    { 0x51, 7 }, // Q
+    { 0x54, 12 }, // T
+    { 0x56, 13 }, // V
+    { 0x57, 13 }, // W
+    { 0x59, 14 }, // Y
+    { 0x5B, 3 }, // [
+    { 0x5F, 8 }, // _
+    { 0x66, 15 }, // f
+    { 0x72, 16 }, // r
+    { 0x76, 17 }, // v
+    { 0x77, 17 }, // w
+    { 0x79, 17 }, // y
+    { 0x7B, 3 }, // {
+    { 0xA1, 18 }, // ¡
+    { 0xAB, 19 }, // «
+    { 0xBB, 20 }, // »
+    { 0xBF, 21 }, // ¿
+    { 0xC0, 6 }, // À
+    { 0xC1, 6 }, // Á
+    { 0xC2, 6 }, // Â
+    { 0xC3, 6 }, // Ã
+    { 0xC4, 6 }, // Ä
+    { 0xC5, 6 }, // Å
+    { 0xC6, 8 }, // Æ
+    { 0xC8, 8 }, // È
+    { 0xC9, 8 }, // É
+    { 0xCA, 8 }, // Ê
+    { 0xCB, 8 }, // Ë
+    { 0xD0, 7 }, // Ð
+    { 0xD2, 7 }, // Ò
+    { 0xD3, 7 }, // Ó
+    { 0xD4, 7 }, // Ô
+    { 0xD5, 7 }, // Õ
+    { 0xD6, 7 }, // Ö
+    { 0xD8, 7 }, // Ø
+    { 0xDD, 14 }, // Ý
+    { 0xDE, 11 }, // Þ
+    { 0xEE, 22 }, // î
+    { 0xEF, 22 }, // ï
+    { 0xFD, 17 }, // ý
+    { 0xFF, 17 }, // ÿ
+    { 0x100, 6 }, // Ā
+    { 0x102, 6 }, // Ă
+    { 0x104, 23 }, // Ą
+    { 0x10E, 7 }, // Ď
+    { 0x10F, 24 }, // ď
+    { 0x110, 7 }, // Đ
+    { 0x112, 8 }, // Ē
+    { 0x114, 8 }, // Ĕ
+    { 0x116, 8 }, // Ė
+    { 0x118, 8 }, // Ę
+    { 0x11A, 8 }, // Ě
+    { 0x129, 25 }, // ĩ
+    { 0x12B, 22 }, // ī
+    { 0x12E, 26 }, // Į
+    { 0x139, 10 }, // Ĺ
+    { 0x13B, 10 }, // Ļ
+    { 0x13D, 10 }, // Ľ
+    { 0x13E, 24 }, // ľ
+    { 0x13F, 10 }, // Ŀ
+    { 0x141, 10 }, // Ł
+    { 0x14C, 7 }, // Ō
+    { 0x14E, 7 }, // Ŏ
+    { 0x150, 7 }, // Ő
+    { 0x152, 8 }, // Œ
+    { 0x155, 16 }, // ŕ
+    { 0x157, 16 }, // ŗ
+    { 0x159, 16 }, // ř
+    { 0x162, 12 }, // Ţ
+    { 0x164, 12 }, // Ť
+    { 0x165, 27 }, // ť
+    { 0x166, 12 }, // Ŧ
+    { 0x174, 13 }, // Ŵ
+    { 0x175, 17 }, // ŵ
+    { 0x176, 14 }, // Ŷ
+    { 0x177, 17 }, // ŷ
+    { 0x178, 14 }, // Ÿ
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 4 }, // ‚
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x2039, 19 }, // ‹
+    { 0x203A, 20 }, // ›
+    { 0xFB00, 15 }, // ﬀ
+};
+
+static const EpdKernClassEntry notosans_12_boldKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x26, 3 }, // &
+    { 0x27, 2 }, // '
+    { 0x29, 4 }, // )
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x3F, 7 }, // ?
+    { 0x41, 8 }, // A
+    { 0x43, 9 }, // C
+    { 0x47, 9 }, // G
+    { 0x4A, 10 }, // J
+    { 0x4F, 9 }, // O
+    { 0x51, 9 }, // Q
+    { 0x54, 11 }, // T
+    { 0x56, 12 }, // V
+    { 0x57, 12 }, // W
+    { 0x59, 13 }, // Y
+    { 0x5D, 4 }, // ]
+    { 0x61, 14 }, // a
+    { 0x62, 15 }, // b
+    { 0x63, 16 }, // c
+    { 0x64, 16 }, // d
+    { 0x65, 16 }, // e
+    { 0x67, 14 }, // g
+    { 0x68, 15 }, // h
+    { 0x6A, 17 }, // j
+    { 0x6B, 15 }, // k
+    { 0x6C, 15 }, // l
+    { 0x6D, 18 }, // m
+    { 0x6E, 18 }, // n
+    { 0x6F, 16 }, // o
+    { 0x70, 18 }, // p
+    { 0x71, 16 }, // q
+    { 0x72, 18 }, // r
+    { 0x73, 14 }, // s
+    { 0x75, 18 }, // u
+    { 0x7A, 6 }, // z
+    { 0x7D, 4 }, // }
+    { 0xAB, 19 }, // «
+    { 0xBB, 20 }, // »
+    { 0xC0, 8 }, // À
+    { 0xC1, 8 }, // Á
+    { 0xC2, 8 }, // Â
+    { 0xC3, 8 }, // Ã
+    { 0xC4, 8 }, // Ä
+    { 0xC5, 8 }, // Å
+    { 0xC6, 21 }, // Æ
+    { 0xC7, 9 }, // Ç
+    { 0xD2, 9 }, // Ò
+    { 0xD3, 9 }, // Ó
+    { 0xD4, 9 }, // Ô
+    { 0xD5, 9 }, // Õ
+    { 0xD6, 9 }, // Ö
+    { 0xD8, 9 }, // Ø
+    { 0xDD, 13 }, // Ý
+    { 0xE0, 16 }, // à
+    { 0xE1, 14 }, // á
+    { 0xE2, 14 }, // â
+    { 0xE3, 14 }, // ã
+    { 0xE4, 14 }, // ä
+    { 0xE5, 14 }, // å
+    { 0xE6, 14 }, // æ
+    { 0xE7, 16 }, // ç
+    { 0xE8, 16 }, // è
+    { 0xE9, 16 }, // é
+    { 0xEA, 16 }, // ê
+    { 0xEB, 16 }, // ë
+    { 0xF2, 16 }, // ò
+    { 0xF3, 16 }, // ó
+    { 0xF4, 16 }, // ô
+    { 0xF5, 16 }, // õ
+    { 0xF6, 16 }, // ö
+    { 0xF8, 16 }, // ø
+    { 0xF9, 18 }, // ù
+    { 0xFA, 18 }, // ú
+    { 0xFB, 18 }, // û
+    { 0xFC, 18 }, // ü
+    { 0xFE, 15 }, // þ
+    { 0x100, 8 }, // Ā
+    { 0x101, 14 }, // ā
+    { 0x102, 8 }, // Ă
+    { 0x103, 14 }, // ă
+    { 0x104, 8 }, // Ą
+    { 0x105, 14 }, // ą
+    { 0x106, 9 }, // Ć
+    { 0x107, 16 }, // ć
+    { 0x108, 9 }, // Ĉ
+    { 0x109, 16 }, // ĉ
+    { 0x10A, 9 }, // Ċ
+    { 0x10B, 16 }, // ċ
+    { 0x10C, 9 }, // Č
+    { 0x10D, 16 }, // č
+    { 0x10F, 16 }, // ď
+    { 0x111, 16 }, // đ
+    { 0x113, 16 }, // ē
+    { 0x115, 16 }, // ĕ
+    { 0x117, 16 }, // ė
+    { 0x119, 16 }, // ę
+    { 0x11B, 16 }, // ě
+    { 0x11C, 9 }, // Ĝ
+    { 0x11D, 14 }, // ĝ
+    { 0x11E, 9 }, // Ğ
+    { 0x11F, 14 }, // ğ
+    { 0x120, 9 }, // Ġ
+    { 0x121, 14 }, // ġ
+    { 0x122, 9 }, // Ģ
+    { 0x123, 14 }, // ģ
+    { 0x125, 15 }, // ĥ
+    { 0x127, 22 }, // ħ
+    { 0x129, 23 }, // ĩ
+    { 0x137, 15 }, // ķ
+    { 0x138, 18 }, // ĸ
+    { 0x13A, 15 }, // ĺ
+    { 0x13C, 15 }, // ļ
+    { 0x13E, 15 }, // ľ
+    { 0x140, 15 }, // ŀ
+    { 0x144, 18 }, // ń
+    { 0x146, 18 }, // ņ
+    { 0x14B, 18 }, // ŋ
+    { 0x14C, 9 }, // Ō
+    { 0x14D, 16 }, // ō
+    { 0x14E, 9 }, // Ŏ
+    { 0x14F, 16 }, // ŏ
+    { 0x150, 9 }, // Ő
+    { 0x151, 16 }, // ő
+    { 0x152, 9 }, // Œ
+    { 0x153, 16 }, // œ
+    { 0x155, 18 }, // ŕ
+    { 0x157, 18 }, // ŗ
+    { 0x15B, 14 }, // ś
+    { 0x15F, 14 }, // ş
+    { 0x162, 11 }, // Ţ
+    { 0x164, 11 }, // Ť
+    { 0x166, 11 }, // Ŧ
+    { 0x169, 18 }, // ũ
+    { 0x16B, 18 }, // ū
+    { 0x16D, 18 }, // ŭ
+    { 0x16F, 18 }, // ů
+    { 0x171, 18 }, // ű
+    { 0x173, 18 }, // ų
+    { 0x174, 12 }, // Ŵ
+    { 0x176, 13 }, // Ŷ
+    { 0x178, 13 }, // Ÿ
+    { 0x17A, 6 }, // ź
+    { 0x17C, 6 }, // ż
+    { 0x17E, 6 }, // ž
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 24 }, // ‘
+    { 0x2019, 2 }, // ’
+    { 0x201A, 5 }, // ‚
+    { 0x201C, 24 }, // “
+    { 0x201D, 2 }, // ”
+    { 0x201E, 5 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 19 }, // ‹
+    { 0x203A, 20 }, // ›
+};
+
+static const int8_t notosans_12_boldKernMatrix[648] = {
+    0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, 0, 0, -2, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 1, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, -2, 0, -2, 0, -1, -2, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -2, -1, 0, 0, 0, 0,
+    0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 3, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 4, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 2,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 0, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+};
+
+static const EpdLigaturePair notosans_12_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData notosans_12_bold = {
     notosans_12_boldBitmaps,
     notosans_12_boldGlyphs,
     notosans_12_boldIntervals,
-    11,
+    12,
     34,
     27,
     -8,
     true,
+    notosans_12_boldKernLeftClasses,
+    103,
+    notosans_12_boldKernRightClasses,
+    160,
+    notosans_12_boldKernMatrix,
+    27,
+    24,
+    notosans_12_boldLigatures,
+    5,
 };
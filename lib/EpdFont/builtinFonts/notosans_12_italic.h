@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_italicBitmaps[48397] = {
+static const uint8_t notosans_12_italicBitmaps[49119] = {
     0x00, 0xB8, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0F, 0x80, 0x3D, 0x00, 0xF0, 0x07, 0xC0,
     0x1E, 0x00, 0xB4, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x7E, 0x01, 0xF4, 0x01,
     0x00, 0x00, 0x1E, 0x0F, 0x0B, 0x87, 0xC2, 0xD1, 0xE0, 0xF0, 0xB4, 0x38, 0x2C, 0x0D, 0x0E, 0x02,
@@ -3032,7 +3032,52 @@ static const uint8_t notosans_12_italicBitmaps[48397] = {
     0x0F, 0x00, 0x2E, 0x07, 0xC0, 0x0B, 0x82, 0xE0, 0x07, 0xC0, 0xF9, 0x5B, 0xD0, 0x3F, 0xFF, 0x80,
     0x0F, 0xAB, 0xF4, 0x07, 0xC0, 0x1F, 0x02, 0xE0, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x3C, 0x00, 0x3D,
     0x0F, 0x00, 0x1F, 0x07, 0xC0, 0x1F, 0x82, 0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x40, 0x03, 0x8B, 0x00,
-    0x00, 0xD3, 0x80, 0x00, 0x10, 0x40, 0x00, 0x2A, 0xA8, 0xFF, 0xE1, 0x55, 0x00,
+    0x00, 0xD3, 0x80, 0x00, 0x10, 0x40, 0x00, 0x2A, 0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x00, 0x0B, 0xEE, 0x0F, 0xEE, 0x00, 0x00,
+    0x7C, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x00,
+    0x00, 0x7D, 0x55, 0x7D, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xD5, 0x5B, 0x94,
+    0x00, 0x00, 0x2D, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x03,
+    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0,
+    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x01,
+    0xF0, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x00,
+    0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x2E, 0x00,
+    0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x02, 0xF8, 0x02, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x04, 0x00, 0x00, 0xBE, 0xE3,
+    0xE0, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07,
+    0xD5, 0x01, 0x40, 0x07, 0xFF, 0xF0, 0xB8, 0x00, 0x1B, 0xD4, 0x0F, 0x40, 0x00, 0xB4, 0x00, 0xF0,
+    0x00, 0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x02, 0xE0,
+    0x03, 0xC0, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0xB8, 0x00,
+    0x07, 0xC0, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x1F, 0x00, 0x00, 0xBE, 0xE2, 0xE0, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x03, 0xC0, 0x00,
+    0x3D, 0x00, 0x7C, 0x00, 0x07, 0xD5, 0x0B, 0x80, 0x07, 0xFF, 0xF0, 0xB4, 0x00, 0x1B, 0xD4, 0x0F,
+    0x40, 0x00, 0xB4, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x1F,
+    0x00, 0x3D, 0x00, 0x02, 0xE0, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x07, 0xC0,
+    0x00, 0x3C, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0xF0, 0x00, 0x0F, 0x40,
+    0x1F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
+    0x3D, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x02, 0xFF, 0x04, 0x00, 0x00, 0xBE, 0xE0, 0xFE, 0xE2,
+    0xE0, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x02, 0xE0, 0x00, 0x40, 0x00, 0x3D,
+    0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xD5, 0x57, 0xD5, 0x01, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xF0,
+    0xB8, 0x00, 0x1B, 0xD5, 0x5B, 0x94, 0x0F, 0x40, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xF0, 0x00, 0x0F,
+    0x40, 0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+    0x2D, 0x00, 0x02, 0xE0, 0x02, 0xE0, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x03,
+    0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x07, 0xC0,
+    0x0F, 0x40, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x0F, 0x00, 0x00,
+    0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x02, 0xE0,
+    0x00, 0x00, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
+    0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0x02, 0xFF, 0x1F, 0x00, 0x00, 0xBE, 0xE0, 0xFE, 0xE2, 0xE0, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x3D,
+    0x00, 0x02, 0xE0, 0x02, 0xE0, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x07, 0xD5,
+    0x57, 0xD5, 0x07, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0xB4, 0x00, 0x1B, 0xD5, 0x5B, 0x94, 0x0F,
+    0x40, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF0,
+    0x00, 0xF0, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x02, 0xE0, 0x03,
+    0xC0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x3C,
+    0x00, 0x3C, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0xB8, 0x00,
+    0xF0, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x3D, 0x00,
+    0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00,
 };
 
 static const EpdGlyph notosans_12_italicGlyphs[] = {
@@ -3869,6 +3914,11 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 17, 21, 15, -1, 21, 90, 48223 }, // ₾
     { 13, 24, 14, 1, 21, 78, 48313 }, // ₿
     { 7, 3, 8, 0, 8, 6, 48391 }, // −
+    { 23, 26, 16, -3, 20, 150, 48397 }, // ﬀ
+    { 18, 26, 14, -3, 20, 117, 48547 }, // ﬁ
+    { 18, 26, 14, -3, 20, 117, 48664 }, // ﬂ
+    { 26, 26, 22, -3, 20, 169, 48781 }, // ﬃ
+    { 26, 26, 22, -3, 20, 169, 48950 }, // ﬄ
 };
 
 static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
@@ -3883,15 +3933,324 @@ static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
     { 0x2066, 0x206F, 0x316 },
     { 0x20A0, 0x20BF, 0x320 },
     { 0x2212, 0x2212, 0x340 },
+    { 0xFB00, 0xFB04, 0x341 },
+};
+
+static const EpdKernClassEntry notosans_12_italicKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x41, 6 }, // A
+    { 0x44, 7 }, // D
+    { 0x45, 8 }, // E
+    { 0x46, 9 }, // F
+    { 0x4C, 10 }, // L
+    { 0x4F, 7 }, // O
+    { 0x50, 11 }, // P
+    { 0x51, 7 }, // Q
+    { 0x54, 12 }, // T
+    { 0x56, 13 }, // V
+    { 0x57, 13 }, // W
+    { 0x59, 14 }, // Y
+    { 0x5B, 3 }, // [
+    { 0x5F, 8 }, // _
+    { 0x66, 15 }, // f
+    { 0x72, 16 }, // r
+    { 0x76, 17 }, // v
+    { 0x77, 17 }, // w
+    { 0x79, 17 }, // y
+    { 0x7B, 3 }, // {
+    { 0xA1, 8 }, // ¡
+    { 0xAB, 18 }, // «
+    { 0xBB, 19 }, // »
+    { 0xBF, 20 }, // ¿
+    { 0xC0, 6 }, // À
+    { 0xC1, 6 }, // Á
+    { 0xC2, 6 }, // Â
+    { 0xC3, 6 }, // Ã
+    { 0xC4, 6 }, // Ä
+    { 0xC5, 6 }, // Å
+    { 0xC6, 8 }, // Æ
+    { 0xC8, 8 }, // È
+    { 0xC9, 8 }, // É
+    { 0xCA, 8 }, // Ê
+    { 0xCB, 8 }, // Ë
+    { 0xD0, 7 }, // Ð
+    { 0xD2, 7 }, // Ò
+    { 0xD3, 7 }, // Ó
+    { 0xD4, 7 }, // Ô
+    { 0xD5, 7 }, // Õ
+    { 0xD6, 7 }, // Ö
+    { 0xD8, 7 }, // Ø
+    { 0xDD, 14 }, // Ý
+    { 0xDE, 11 }, // Þ
+    { 0xEF, 21 }, // ï
+    { 0xFD, 17 }, // ý
+    { 0xFF, 17 }, // ÿ
+    { 0x100, 6 }, // Ā
+    { 0x102, 6 }, // Ă
+    { 0x104, 6 }, // Ą
+    { 0x10E, 7 }, // Ď
+    { 0x10F, 22 }, // ď
+    { 0x110, 7 }, // Đ
+    { 0x112, 8 }, // Ē
+    { 0x114, 8 }, // Ĕ
+    { 0x116, 8 }, // Ė
+    { 0x118, 8 }, // Ę
+    { 0x11A, 8 }, // Ě
+    { 0x129, 23 }, // ĩ
+    { 0x12B, 21 }, // ī
+    { 0x12E, 24 }, // Į
+    { 0x139, 10 }, // Ĺ
+    { 0x13B, 10 }, // Ļ
+    { 0x13D, 10 }, // Ľ
+    { 0x13E, 22 }, // ľ
+    { 0x13F, 10 }, // Ŀ
+    { 0x141, 10 }, // Ł
+    { 0x14C, 7 }, // Ō
+    { 0x14E, 7 }, // Ŏ
+    { 0x150, 7 }, // Ő
+    { 0x152, 8 }, // Œ
+    { 0x155, 16 }, // ŕ
+    { 0x157, 16 }, // ŗ
+    { 0x159, 16 }, // ř
+    { 0x162, 12 }, // Ţ
+    { 0x164, 12 }, // Ť
+    { 0x165, 21 }, // ť
+    { 0x166, 12 }, // Ŧ
+    { 0x174, 13 }, // Ŵ
+    { 0x175, 17 }, // ŵ
+    { 0x176, 14 }, // Ŷ
+    { 0x177, 17 }, // ŷ
+    { 0x178, 14 }, // Ÿ
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 4 }, // ‚
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x2039, 18 }, // ‹
+    { 0x203A, 19 }, // ›
+    { 0xFB00, 15 }, // ﬀ
+};
+
+static const EpdKernClassEntry notosans_12_italicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x26, 3 }, // &
+    { 0x27, 2 }, // '
+    { 0x29, 4 }, // )
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x3F, 1 }, // ?
+    { 0x41, 7 }, // A
+    { 0x43, 8 }, // C
+    { 0x47, 8 }, // G
+    { 0x4A, 9 }, // J
+    { 0x4F, 8 }, // O
+    { 0x51, 8 }, // Q
+    { 0x54, 10 }, // T
+    { 0x56, 11 }, // V
+    { 0x57, 11 }, // W
+    { 0x59, 12 }, // Y
+    { 0x5D, 4 }, // ]
+    { 0x61, 13 }, // a
+    { 0x63, 14 }, // c
+    { 0x64, 14 }, // d
+    { 0x65, 14 }, // e
+    { 0x66, 15 }, // f
+    { 0x67, 16 }, // g
+    { 0x6A, 15 }, // j
+    { 0x6D, 17 }, // m
+    { 0x6E, 17 }, // n
+    { 0x6F, 14 }, // o
+    { 0x70, 17 }, // p
+    { 0x71, 14 }, // q
+    { 0x72, 17 }, // r
+    { 0x73, 13 }, // s
+    { 0x75, 17 }, // u
+    { 0x7A, 6 }, // z
+    { 0x7D, 4 }, // }
+    { 0xAB, 18 }, // «
+    { 0xBB, 19 }, // »
+    { 0xC0, 7 }, // À
+    { 0xC1, 7 }, // Á
+    { 0xC2, 7 }, // Â
+    { 0xC3, 7 }, // Ã
+    { 0xC4, 7 }, // Ä
+    { 0xC5, 7 }, // Å
+    { 0xC7, 8 }, // Ç
+    { 0xD2, 8 }, // Ò
+    { 0xD3, 8 }, // Ó
+    { 0xD4, 8 }, // Ô
+    { 0xD5, 8 }, // Õ
+    { 0xD6, 8 }, // Ö
+    { 0xD8, 8 }, // Ø
+    { 0xDD, 12 }, // Ý
+    { 0xDF, 15 }, // ß
+    { 0xE0, 14 }, // à
+    { 0xE1, 13 }, // á
+    { 0xE2, 13 }, // â
+    { 0xE3, 13 }, // ã
+    { 0xE4, 13 }, // ä
+    { 0xE5, 13 }, // å
+    { 0xE6, 13 }, // æ
+    { 0xE7, 14 }, // ç
+    { 0xE8, 14 }, // è
+    { 0xE9, 14 }, // é
+    { 0xEA, 14 }, // ê
+    { 0xEB, 14 }, // ë
+    { 0xF1, 17 }, // ñ
+    { 0xF2, 14 }, // ò
+    { 0xF3, 14 }, // ó
+    { 0xF4, 14 }, // ô
+    { 0xF5, 14 }, // õ
+    { 0xF6, 14 }, // ö
+    { 0xF8, 14 }, // ø
+    { 0xF9, 17 }, // ù
+    { 0xFA, 17 }, // ú
+    { 0xFB, 17 }, // û
+    { 0xFC, 17 }, // ü
+    { 0x100, 7 }, // Ā
+    { 0x101, 13 }, // ā
+    { 0x102, 7 }, // Ă
+    { 0x103, 13 }, // ă
+    { 0x104, 7 }, // Ą
+    { 0x105, 13 }, // ą
+    { 0x106, 8 }, // Ć
+    { 0x107, 14 }, // ć
+    { 0x108, 8 }, // Ĉ
+    { 0x109, 14 }, // ĉ
+    { 0x10A, 8 }, // Ċ
+    { 0x10B, 14 }, // ċ
+    { 0x10C, 8 }, // Č
+    { 0x10D, 14 }, // č
+    { 0x10F, 14 }, // ď
+    { 0x111, 14 }, // đ
+    { 0x113, 14 }, // ē
+    { 0x115, 14 }, // ĕ
+    { 0x117, 14 }, // ė
+    { 0x119, 14 }, // ę
+    { 0x11B, 14 }, // ě
+    { 0x11C, 8 }, // Ĝ
+    { 0x11D, 16 }, // ĝ
+    { 0x11E, 8 }, // Ğ
+    { 0x11F, 16 }, // ğ
+    { 0x120, 8 }, // Ġ
+    { 0x121, 16 }, // ġ
+    { 0x122, 8 }, // Ģ
+    { 0x123, 16 }, // ģ
+    { 0x127, 1 }, // ħ
+    { 0x129, 20 }, // ĩ
+    { 0x135, 15 }, // ĵ
+    { 0x138, 17 }, // ĸ
+    { 0x144, 17 }, // ń
+    { 0x146, 17 }, // ņ
+    { 0x148, 17 }, // ň
+    { 0x14B, 17 }, // ŋ
+    { 0x14C, 8 }, // Ō
+    { 0x14D, 14 }, // ō
+    { 0x14E, 8 }, // Ŏ
+    { 0x14F, 14 }, // ŏ
+    { 0x150, 8 }, // Ő
+    { 0x151, 14 }, // ő
+    { 0x152, 8 }, // Œ
+    { 0x153, 14 }, // œ
+    { 0x155, 17 }, // ŕ
+    { 0x157, 17 }, // ŗ
+    { 0x15B, 13 }, // ś
+    { 0x15D, 13 }, // ŝ
+    { 0x15F, 13 }, // ş
+    { 0x161, 13 }, // š
+    { 0x162, 10 }, // Ţ
+    { 0x164, 10 }, // Ť
+    { 0x166, 10 }, // Ŧ
+    { 0x169, 17 }, // ũ
+    { 0x16B, 17 }, // ū
+    { 0x16D, 17 }, // ŭ
+    { 0x16F, 17 }, // ů
+    { 0x171, 17 }, // ű
+    { 0x173, 17 }, // ų
+    { 0x174, 11 }, // Ŵ
+    { 0x176, 12 }, // Ŷ
+    { 0x178, 12 }, // Ÿ
+    { 0x17A, 6 }, // ź
+    { 0x17C, 6 }, // ż
+    { 0x17E, 6 }, // ž
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 21 }, // ‘
+    { 0x2019, 2 }, // ’
+    { 0x201A, 5 }, // ‚
+    { 0x201C, 21 }, // “
+    { 0x201D, 2 }, // ”
+    { 0x201E, 5 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 18 }, // ‹
+    { 0x203A, 19 }, // ›
+    { 0xFB00, 15 }, // ﬀ
+};
+
+static const int8_t notosans_12_italicKernMatrix[504] = {
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, -2, -2, 0, -2, -1, -2, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0,
+    0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_12_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData notosans_12_italic = {
     notosans_12_italicBitmaps,
     notosans_12_italicGlyphs,
     notosans_12_italicIntervals,
-    11,
+    12,
     34,
     27,
     -8,
     true,
+    notosans_12_italicKernLeftClasses,
+    102,
+    notosans_12_italicKernRightClasses,
+    156,
+    notosans_12_italicKernMatrix,
+    24,
+    21,
+    notosans_12_italicLigatures,
+    5,
 };
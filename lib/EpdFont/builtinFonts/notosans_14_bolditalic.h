@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_bolditalicBitmaps[71405] = {
+static const uint8_t notosans_14_bolditalicBitmaps[72509] = {
     0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x02,
     0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xF0,
     0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xD0, 0x0B,
@@ -4470,7 +4470,76 @@ static const uint8_t notosans_14_bolditalicBitmaps[71405] = {
     0x00, 0x1F, 0xE0, 0x7F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF8, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x00,
     0xFF, 0x80, 0x7F, 0xC0, 0xBF, 0xD0, 0x1F, 0xFA, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
     0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
-    0x38, 0x38, 0x00, 0x00, 0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF, 0xFC,
+    0x38, 0x38, 0x00, 0x00, 0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x2F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
+    0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xD1, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x43, 0xFF, 0x04,
+    0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xD0, 0x00, 0x05, 0xFF, 0x55, 0x6F, 0xF5, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
+    0x00, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00,
+    0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC,
+    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xFF,
+    0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x00,
+    0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F,
+    0xD0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B,
+    0xFC, 0x00, 0x00, 0x2B, 0xFF, 0x82, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x03, 0xFF, 0xF0, 0x00,
+    0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xFE,
+    0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x40, 0xFD, 0x00, 0x00,
+    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x1F,
+    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x0B, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x5F,
+    0xF5, 0x40, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0,
+    0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
+    0x00, 0xFF, 0x80, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00,
+    0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x00,
+    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
+    0x00, 0x02, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x1F, 0xF0, 0x00, 0x00,
+    0x7F, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x42, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xFF,
+    0x40, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0x0F, 0xFF,
+    0xFF, 0x0B, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x5F, 0xF5, 0x40, 0xFF, 0x40,
+    0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80,
+    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x00,
+    0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x0B,
+    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x07,
+    0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xFF, 0x02, 0xFF, 0xE1, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0xFF, 0xFE, 0x3F,
+    0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x1F, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x43, 0xFF, 0x04,
+    0x1F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0xFF, 0x55,
+    0x6F, 0xF5, 0x41, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFE,
+    0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x03,
+    0xFD, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
+    0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xFF, 0x40,
+    0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+    0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x02,
+    0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0xBF,
+    0xC0, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x82, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x3F,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
+    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xC0, 0xBF, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFE, 0x0F, 0xFF, 0xE2, 0xFE,
+    0x00, 0x00, 0x07, 0xFF, 0xF4, 0x7F, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x43, 0xFF, 0x04,
+    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F,
+    0xC0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x5F,
+    0xF5, 0x56, 0xFF, 0x54, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x00,
+    0x02, 0xFE, 0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF4,
+    0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01,
+    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFE,
+    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00,
+    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
+    0xC0, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x00,
+    0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xF8, 0x2B, 0xFF, 0x40, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x03, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
 static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
@@ -5307,6 +5376,11 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 20, 24, 18, -1, 24, 120, 71161 }, // ₾
     { 17, 27, 16, 0, 24, 115, 71281 }, // ₿
     { 9, 4, 9, 0, 10, 9, 71396 }, // −
+    { 28, 30, 21, -4, 23, 210, 71405 }, // ﬀ
+    { 25, 30, 20, -4, 23, 188, 71615 }, // ﬁ
+    { 25, 30, 20, -4, 23, 188, 71803 }, // ﬂ
+    { 34, 30, 29, -4, 23, 255, 71991 }, // ﬃ
+    { 35, 30, 29, -4, 23, 263, 72246 }, // ﬄ
 };
 
 static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
@@ -5321,15 +5395,413 @@ static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
     { 0x2066, 0x206F, 0x316 },
     { 0x20A0, 0x20BF, 0x320 },
     { 0x2212, 0x2212, 0x340 },
+    { 0xFB00, 0xFB04, 0x341 },
+};
+
+static const EpdKernClassEntry notosans_14_bolditalicKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x41, 6 }, // A
+    { 0x42, 7 }, // B
+    { 0x43, 8 }, // C
+    { 0x44, 9 }, // D
+    { 0x45, 10 }, // E
+    { 0x46, 11 }, // F
+    { 0x4B, 8 }, // K
+    { 0x4C, 12 }, // L
+    { 0x4F, 9 }, // O
+    { 0x50, 13 }, // P
+    { 0x51, 9 }, // Q
+    { 0x54, 14 }, // T
+    { 0x55, 7 }, // U
+    { 0x56, 15 }, // V
+    { 0x57, 15 }, // W
+    { 0x58, 8 }, // X
+    { 0x59, 16 }, // Y
+    { 0x5A, 17 }, // Z
+    { 0x5B, 3 }, // [
+    { 0x5F, 18 }, // _
+    { 0x62, 19 }, // b
+    { 0x63, 20 }, // c
+    { 0x65, 19 }, // e
+    { 0x66, 21 }, // f
+    { 0x6B, 22 }, // k
+    { 0x6F, 19 }, // o
+    { 0x70, 19 }, // p
+    { 0x72, 23 }, // r
+    { 0x74, 24 }, // t
+    { 0x76, 25 }, // v
+    { 0x77, 25 }, // w
+    { 0x78, 22 }, // x
+    { 0x79, 25 }, // y
+    { 0x7B, 3 }, // {
+    { 0xA1, 26 }, // ¡
+    { 0xAB, 27 }, // «
+    { 0xBB, 28 }, // »
+    { 0xBF, 29 }, // ¿
+    { 0xC0, 6 }, // À
+    { 0xC1, 6 }, // Á
+    { 0xC2, 6 }, // Â
+    { 0xC3, 6 }, // Ã
+    { 0xC4, 6 }, // Ä
+    { 0xC5, 6 }, // Å
+    { 0xC6, 10 }, // Æ
+    { 0xC7, 8 }, // Ç
+    { 0xC8, 10 }, // È
+    { 0xC9, 10 }, // É
+    { 0xCA, 10 }, // Ê
+    { 0xCB, 10 }, // Ë
+    { 0xD0, 9 }, // Ð
+    { 0xD2, 9 }, // Ò
+    { 0xD3, 9 }, // Ó
+    { 0xD4, 9 }, // Ô
+    { 0xD5, 9 }, // Õ
+    { 0xD6, 9 }, // Ö
+    { 0xD8, 9 }, // Ø
+    { 0xD9, 7 }, // Ù
+    { 0xDA, 7 }, // Ú
+    { 0xDB, 7 }, // Û
+    { 0xDC, 7 }, // Ü
+    { 0xDD, 16 }, // Ý
+    { 0xDE, 13 }, // Þ
+    { 0xE6, 19 }, // æ
+    { 0xE8, 19 }, // è
+    { 0xE9, 19 }, // é
+    { 0xEA, 19 }, // ê
+    { 0xEB, 19 }, // ë
+    { 0xEF, 30 }, // ï
+    { 0xF0, 19 }, // ð
+    { 0xF2, 19 }, // ò
+    { 0xF3, 19 }, // ó
+    { 0xF4, 19 }, // ô
+    { 0xF5, 19 }, // õ
+    { 0xF6, 19 }, // ö
+    { 0xF8, 19 }, // ø
+    { 0xFD, 25 }, // ý
+    { 0xFE, 19 }, // þ
+    { 0xFF, 25 }, // ÿ
+    { 0x100, 6 }, // Ā
+    { 0x102, 6 }, // Ă
+    { 0x104, 6 }, // Ą
+    { 0x106, 8 }, // Ć
+    { 0x108, 8 }, // Ĉ
+    { 0x10A, 8 }, // Ċ
+    { 0x10C, 8 }, // Č
+    { 0x10E, 9 }, // Ď
+    { 0x10F, 31 }, // ď
+    { 0x110, 9 }, // Đ
+    { 0x112, 10 }, // Ē
+    { 0x113, 19 }, // ē
+    { 0x114, 10 }, // Ĕ
+    { 0x115, 19 }, // ĕ
+    { 0x116, 10 }, // Ė
+    { 0x117, 19 }, // ė
+    { 0x118, 10 }, // Ę
+    { 0x119, 19 }, // ę
+    { 0x11A, 10 }, // Ě
+    { 0x11B, 19 }, // ě
+    { 0x129, 32 }, // ĩ
+    { 0x12B, 30 }, // ī
+    { 0x12E, 33 }, // Į
+    { 0x136, 8 }, // Ķ
+    { 0x137, 22 }, // ķ
+    { 0x138, 22 }, // ĸ
+    { 0x139, 12 }, // Ĺ
+    { 0x13B, 12 }, // Ļ
+    { 0x13D, 12 }, // Ľ
+    { 0x13E, 31 }, // ľ
+    { 0x13F, 12 }, // Ŀ
+    { 0x141, 12 }, // Ł
+    { 0x14C, 9 }, // Ō
+    { 0x14D, 19 }, // ō
+    { 0x14E, 9 }, // Ŏ
+    { 0x14F, 19 }, // ŏ
+    { 0x150, 9 }, // Ő
+    { 0x151, 19 }, // ő
+    { 0x152, 10 }, // Œ
+    { 0x153, 19 }, // œ
+    { 0x155, 23 }, // ŕ
+    { 0x157, 23 }, // ŗ
+    { 0x159, 23 }, // ř
+    { 0x162, 14 }, // Ţ
+    { 0x163, 24 }, // ţ
+    { 0x164, 14 }, // Ť
+    { 0x165, 34 }, // ť
+    { 0x166, 14 }, // Ŧ
+    { 0x167, 24 }, // ŧ
+    { 0x168, 7 }, // Ũ
+    { 0x16A, 7 }, // Ū
+    { 0x16C, 7 }, // Ŭ
+    { 0x16E, 7 }, // Ů
+    { 0x170, 7 }, // Ű
+    { 0x172, 7 }, // Ų
+    { 0x174, 15 }, // Ŵ
+    { 0x175, 25 }, // ŵ
+    { 0x176, 16 }, // Ŷ
+    { 0x177, 25 }, // ŷ
+    { 0x178, 16 }, // Ÿ
+    { 0x179, 17 }, // Ź
+    { 0x17B, 17 }, // Ż
+    { 0x17D, 17 }, // Ž
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 4 }, // ‚
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x2039, 27 }, // ‹
+    { 0x203A, 28 }, // ›
+    { 0xFB00, 21 }, // ﬀ
+};
+
+static const EpdKernClassEntry notosans_14_bolditalicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x26, 3 }, // &
+    { 0x27, 2 }, // '
+    { 0x29, 4 }, // )
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x3F, 7 }, // ?
+    { 0x41, 8 }, // A
+    { 0x43, 9 }, // C
+    { 0x47, 9 }, // G
+    { 0x4A, 10 }, // J
+    { 0x4F, 9 }, // O
+    { 0x51, 9 }, // Q
+    { 0x54, 11 }, // T
+    { 0x55, 12 }, // U
+    { 0x56, 13 }, // V
+    { 0x57, 13 }, // W
+    { 0x58, 14 }, // X
+    { 0x59, 15 }, // Y
+    { 0x5D, 4 }, // ]
+    { 0x61, 16 }, // a
+    { 0x63, 17 }, // c
+    { 0x64, 17 }, // d
+    { 0x65, 17 }, // e
+    { 0x66, 18 }, // f
+    { 0x67, 19 }, // g
+    { 0x6A, 18 }, // j
+    { 0x6D, 20 }, // m
+    { 0x6E, 20 }, // n
+    { 0x6F, 17 }, // o
+    { 0x70, 20 }, // p
+    { 0x71, 17 }, // q
+    { 0x72, 20 }, // r
+    { 0x73, 19 }, // s
+    { 0x75, 20 }, // u
+    { 0x76, 21 }, // v
+    { 0x77, 21 }, // w
+    { 0x79, 21 }, // y
+    { 0x7A, 22 }, // z
+    { 0x7D, 4 }, // }
+    { 0xAB, 23 }, // «
+    { 0xBB, 24 }, // »
+    { 0xC0, 8 }, // À
+    { 0xC1, 8 }, // Á
+    { 0xC2, 8 }, // Â
+    { 0xC3, 8 }, // Ã
+    { 0xC4, 8 }, // Ä
+    { 0xC5, 8 }, // Å
+    { 0xC6, 25 }, // Æ
+    { 0xC7, 9 }, // Ç
+    { 0xD2, 9 }, // Ò
+    { 0xD3, 9 }, // Ó
+    { 0xD4, 9 }, // Ô
+    { 0xD5, 9 }, // Õ
+    { 0xD6, 9 }, // Ö
+    { 0xD8, 9 }, // Ø
+    { 0xD9, 12 }, // Ù
+    { 0xDA, 12 }, // Ú
+    { 0xDB, 12 }, // Û
+    { 0xDC, 12 }, // Ü
+    { 0xDD, 15 }, // Ý
+    { 0xDF, 18 }, // ß
+    { 0xE0, 17 }, // à
+    { 0xE1, 16 }, // á
+    { 0xE2, 16 }, // â
+    { 0xE3, 16 }, // ã
+    { 0xE4, 16 }, // ä
+    { 0xE5, 16 }, // å
+    { 0xE6, 16 }, // æ
+    { 0xE7, 17 }, // ç
+    { 0xE8, 17 }, // è
+    { 0xE9, 17 }, // é
+    { 0xEA, 17 }, // ê
+    { 0xEB, 17 }, // ë
+    { 0xF1, 20 }, // ñ
+    { 0xF2, 17 }, // ò
+    { 0xF3, 17 }, // ó
+    { 0xF4, 17 }, // ô
+    { 0xF5, 17 }, // õ
+    { 0xF6, 17 }, // ö
+    { 0xF8, 17 }, // ø
+    { 0xF9, 20 }, // ù
+    { 0xFA, 20 }, // ú
+    { 0xFB, 20 }, // û
+    { 0xFC, 20 }, // ü
+    { 0xFD, 21 }, // ý
+    { 0xFF, 21 }, // ÿ
+    { 0x100, 8 }, // Ā
+    { 0x101, 16 }, // ā
+    { 0x102, 8 }, // Ă
+    { 0x103, 16 }, // ă
+    { 0x104, 8 }, // Ą
+    { 0x105, 16 }, // ą
+    { 0x106, 9 }, // Ć
+    { 0x107, 17 }, // ć
+    { 0x108, 9 }, // Ĉ
+    { 0x109, 17 }, // ĉ
+    { 0x10A, 9 }, // Ċ
+    { 0x10B, 17 }, // ċ
+    { 0x10C, 9 }, // Č
+    { 0x10D, 17 }, // č
+    { 0x10F, 17 }, // ď
+    { 0x111, 17 }, // đ
+    { 0x113, 17 }, // ē
+    { 0x115, 17 }, // ĕ
+    { 0x117, 17 }, // ė
+    { 0x119, 17 }, // ę
+    { 0x11B, 17 }, // ě
+    { 0x11C, 9 }, // Ĝ
+    { 0x11D, 19 }, // ĝ
+    { 0x11E, 9 }, // Ğ
+    { 0x11F, 19 }, // ğ
+    { 0x120, 9 }, // Ġ
+    { 0x121, 19 }, // ġ
+    { 0x122, 9 }, // Ģ
+    { 0x123, 19 }, // ģ
+    { 0x127, 26 }, // ħ
+    { 0x129, 27 }, // ĩ
+    { 0x135, 18 }, // ĵ
+    { 0x138, 20 }, // ĸ
+    { 0x144, 20 }, // ń
+    { 0x146, 20 }, // ņ
+    { 0x148, 20 }, // ň
+    { 0x14B, 20 }, // ŋ
+    { 0x14C, 9 }, // Ō
+    { 0x14D, 17 }, // ō
+    { 0x14E, 9 }, // Ŏ
+    { 0x14F, 17 }, // ŏ
+    { 0x150, 9 }, // Ő
+    { 0x151, 17 }, // ő
+    { 0x152, 9 }, // Œ
+    { 0x153, 17 }, // œ
+    { 0x155, 20 }, // ŕ
+    { 0x157, 20 }, // ŗ
+    { 0x15B, 19 }, // ś
+    { 0x15D, 19 }, // ŝ
+    { 0x15F, 19 }, // ş
+    { 0x161, 19 }, // š
+    { 0x162, 11 }, // Ţ
+    { 0x164, 11 }, // Ť
+    { 0x166, 11 }, // Ŧ
+    { 0x168, 12 }, // Ũ
+    { 0x169, 20 }, // ũ
+    { 0x16A, 12 }, // Ū
+    { 0x16B, 20 }, // ū
+    { 0x16C, 12 }, // Ŭ
+    { 0x16D, 20 }, // ŭ
+    { 0x16E, 12 }, // Ů
+    { 0x16F, 20 }, // ů
+    { 0x170, 12 }, // Ű
+    { 0x171, 20 }, // ű
+    { 0x172, 12 }, // Ų
+    { 0x173, 20 }, // ų
+    { 0x174, 13 }, // Ŵ
+    { 0x175, 21 }, // ŵ
+    { 0x176, 15 }, // Ŷ
+    { 0x177, 21 }, // ŷ
+    { 0x178, 15 }, // Ÿ
+    { 0x17A, 22 }, // ź
+    { 0x17C, 22 }, // ż
+    { 0x17E, 22 }, // ž
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 28 }, // ‘
+    { 0x2019, 2 }, // ’
+    { 0x201A, 5 }, // ‚
+    { 0x201C, 28 }, // “
+    { 0x201D, 2 }, // ”
+    { 0x201E, 5 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 23 }, // ‹
+    { 0x203A, 24 }, // ›
+    { 0xFB00, 18 }, // ﬀ
+};
+
+static const int8_t notosans_14_bolditalicKernMatrix[952] = {
+    0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 1, 0, 0, -1, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, -1, 2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -2, -1, 1, -1, -1, 0, 0, 0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, -2, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0,
+    0, 0, -1, 0, -2, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+static const EpdLigaturePair notosans_14_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData notosans_14_bolditalic = {
     notosans_14_bolditalicBitmaps,
     notosans_14_bolditalicGlyphs,
     notosans_14_bolditalicIntervals,
-    11,
+    12,
     40,
     32,
     -9,
     true,
+    notosans_14_bolditalicKernLeftClasses,
+    161,
+    notosans_14_bolditalicKernRightClasses,
+    176,
+    notosans_14_bolditalicKernMatrix,
+    34,
+    28,
+    notosans_14_bolditalicLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_boldBitmaps[108125] = {
+static const uint8_t notosans_18_boldBitmaps[109243] = {
     0xBF, 0xF7, 0xFF, 0xDF, 0xFF, 0x6F, 0xFD, 0xBF, 0xF2, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC, 0x7F, 0xF1,
     0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0x7F, 0xF0, 0xFF, 0xC3, 0xFE, 0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x81,
     0x54, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x0B, 0xFF, 0x3F, 0xFD, 0xFF, 0xF7, 0xFF, 0xD7, 0xFE, 0x01,
@@ -6765,7 +6765,77 @@ static const uint8_t notosans_18_boldBitmaps[108125] = {
     0xF8, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
     0xC2, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A,
+    0xA4, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+    0xE0, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC,
+    0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
+    0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xE5, 0x50, 0x0F,
+    0xFF, 0x55, 0x40, 0x7F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
+    0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xE0, 0x2B, 0xFF, 0xFA, 0xA2, 0xAF, 0xFF,
+    0xAA, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0,
+    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00,
+    0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00,
+    0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
+    0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03,
+    0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x3F,
+    0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x6A, 0xA4, 0x01, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x3F, 0xFC,
+    0x00, 0xBF, 0xFF, 0xFD, 0x3F, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x2F, 0xFC, 0x00, 0xFF, 0xF0, 0x00,
+    0x0B, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xE5, 0x50, 0x15, 0x54, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFC,
+    0x7F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFC, 0x2B, 0xFF, 0xFA, 0xA0, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00,
+    0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
+    0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC,
+    0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00,
+    0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
+    0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC,
+    0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x6A, 0xA4,
+    0x1A, 0xA4, 0x00, 0x2F, 0xFF, 0xFC, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE3, 0xFF, 0xC0, 0x2F, 0xFF,
+    0xFF, 0x4F, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x0F,
+    0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xE5, 0x50, 0x3F, 0xFC,
+    0x7F, 0xFF, 0xFF, 0xD0, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xDF, 0xFF, 0xFF, 0xFD, 0x0F,
+    0xFF, 0x2B, 0xFF, 0xFA, 0xA0, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x0F, 0xFD, 0x00,
+    0x03, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x03, 0xFF,
+    0x40, 0x00, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0x00,
+    0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x03, 0xFF,
+    0xC0, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00,
+    0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xD0,
+    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x06, 0xAA, 0x40, 0x19, 0x00, 0x00, 0xBF, 0xFF,
+    0xF0, 0x07, 0xFF, 0xFF, 0x8F, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF1, 0xFF, 0xE0,
+    0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x1F, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
+    0xE1, 0xFF, 0xD0, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0xE0, 0x00,
+    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xE5, 0x50, 0x0F, 0xFF, 0x55, 0x40, 0x55, 0x41, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xF8,
+    0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xFF, 0xFF, 0xF8, 0x1F, 0xFD, 0x2B, 0xFF, 0xFA, 0xA2, 0xAF, 0xFF, 0xAA, 0x81, 0xFF, 0xD0, 0x0F,
+    0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x01,
+    0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B,
+    0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0xFF,
+    0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F,
+    0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF,
+    0xF0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x0F, 0xFD,
+    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF,
+    0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF,
+    0x00, 0x01, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xD0,
+    0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x06, 0xAA, 0x40, 0xAA,
+    0x80, 0x00, 0xBF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x8F, 0xFD, 0x00, 0x3F, 0xFF, 0xFE, 0x01, 0xFF,
+    0xFF, 0xF4, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x0F, 0xFD, 0x00, 0xFF, 0xFF,
+    0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0xD0, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xFD,
+    0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0,
+    0x00, 0x0F, 0xFD, 0x01, 0xFF, 0xE5, 0x50, 0x0F, 0xFF, 0x55, 0x40, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF,
+    0x4B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xD7,
+    0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x2B, 0xFF, 0xFA, 0xA2, 0xAF, 0xFF, 0xAA,
+    0x80, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x00,
+    0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFD, 0x00,
+    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00,
+    0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00,
+    0xBF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x0F,
+    0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00,
+    0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B,
+    0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xFF,
+    0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F,
+    0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
 };
 
 static const EpdGlyph notosans_18_boldGlyphs[] = {
@@ -7603,6 +7673,11 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 18, 35, 21, 3, 31, 158, 107817 }, // ₿
     { 18, 28, 20, 1, 21, 126, 107975 }, // ⃀
     { 19, 5, 22, 1, 16, 24, 108101 }, // −
+    { 31, 29, 29, 0, 29, 225, 108125 }, // ﬀ
+    { 24, 29, 26, 0, 29, 174, 108350 }, // ﬁ
+    { 23, 29, 26, 0, 29, 167, 108524 }, // ﬂ
+    { 38, 29, 40, 0, 29, 276, 108691 }, // ﬃ
+    { 38, 29, 40, 0, 29, 276, 108967 }, // ﬄ
 };
 
 static const EpdUnicodeInterval notosans_18_boldIntervals[] = {
@@ -7617,15 +7692,414 @@ static const EpdUnicodeInterval notosans_18_boldIntervals[] = {
     { 0x2066, 0x206F, 0x316 },
     { 0x20A0, 0x20C0, 0x320 },
     { 0x2212, 0x2212, 0x341 },
+    { 0xFB00, 0xFB04, 0x342 },
+};
+
+static const EpdKernClassEntry notosans_18_boldKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x41, 6 }, // A
+    { 0x43, 7 }, // C
+    { 0x44, 8 }, // D
+    { 0x45, 9 }, // E
+    { 0x46, 10 }, // F
+    { 0x4B, 7 }, // K
+    { 0x4C, 11 }, // L
+    { 0x4F, 8 }, // O
+    { 0x50, 12 }, // P
+    { 0x51, 8 }, // Q
+    { 0x54, 13 }, // T
+    { 0x55, 14 }, // U
+    { 0x56, 15 }, // V
+    { 0x57, 15 }, // W
+    { 0x58, 7 }, // X
+    { 0x59, 16 }, // Y
+    { 0x5A, 17 }, // Z
+    { 0x5B, 3 }, // [
+    { 0x5F, 18 }, // _
+    { 0x62, 19 }, // b
+    { 0x63, 20 }, // c
+    { 0x65, 19 }, // e
+    { 0x66, 21 }, // f
+    { 0x6F, 19 }, // o
+    { 0x70, 19 }, // p
+    { 0x72, 22 }, // r
+    { 0x74, 20 }, // t
+    { 0x76, 23 }, // v
+    { 0x77, 23 }, // w
+    { 0x78, 24 }, // x
+    { 0x79, 23 }, // y
+    { 0x7B, 3 }, // {
+    { 0xA1, 25 }, // ¡
+    { 0xAB, 26 }, // «
+    { 0xBB, 27 }, // »
+    { 0xBF, 28 }, // ¿
+    { 0xC0, 6 }, // À
+    { 0xC1, 6 }, // Á
+    { 0xC2, 6 }, // Â
+    { 0xC3, 6 }, // Ã
+    { 0xC4, 6 }, // Ä
+    { 0xC5, 6 }, // Å
+    { 0xC6, 9 }, // Æ
+    { 0xC7, 7 }, // Ç
+    { 0xC8, 9 }, // È
+    { 0xC9, 9 }, // É
+    { 0xCA, 9 }, // Ê
+    { 0xCB, 9 }, // Ë
+    { 0xD0, 8 }, // Ð
+    { 0xD2, 8 }, // Ò
+    { 0xD3, 8 }, // Ó
+    { 0xD4, 8 }, // Ô
+    { 0xD5, 8 }, // Õ
+    { 0xD6, 8 }, // Ö
+    { 0xD8, 8 }, // Ø
+    { 0xD9, 14 }, // Ù
+    { 0xDA, 14 }, // Ú
+    { 0xDB, 14 }, // Û
+    { 0xDC, 14 }, // Ü
+    { 0xDD, 16 }, // Ý
+    { 0xDE, 12 }, // Þ
+    { 0xE6, 19 }, // æ
+    { 0xE8, 19 }, // è
+    { 0xE9, 19 }, // é
+    { 0xEA, 19 }, // ê
+    { 0xEB, 19 }, // ë
+    { 0xEE, 29 }, // î
+    { 0xEF, 29 }, // ï
+    { 0xF0, 19 }, // ð
+    { 0xF2, 19 }, // ò
+    { 0xF3, 19 }, // ó
+    { 0xF4, 19 }, // ô
+    { 0xF5, 19 }, // õ
+    { 0xF6, 19 }, // ö
+    { 0xF8, 19 }, // ø
+    { 0xFD, 23 }, // ý
+    { 0xFE, 19 }, // þ
+    { 0xFF, 23 }, // ÿ
+    { 0x100, 6 }, // Ā
+    { 0x102, 6 }, // Ă
+    { 0x104, 30 }, // Ą
+    { 0x106, 7 }, // Ć
+    { 0x108, 7 }, // Ĉ
+    { 0x10A, 7 }, // Ċ
+    { 0x10C, 7 }, // Č
+    { 0x10E, 8 }, // Ď
+    { 0x10F, 31 }, // ď
+    { 0x110, 8 }, // Đ
+    { 0x112, 9 }, // Ē
+    { 0x113, 19 }, // ē
+    { 0x114, 9 }, // Ĕ
+    { 0x115, 19 }, // ĕ
+    { 0x116, 9 }, // Ė
+    { 0x117, 19 }, // ė
+    { 0x118, 9 }, // Ę
+    { 0x119, 19 }, // ę
+    { 0x11A, 9 }, // Ě
+    { 0x11B, 19 }, // ě
+    { 0x129, 32 }, // ĩ
+    { 0x12B, 29 }, // ī
+    { 0x12E, 9 }, // Į
+    { 0x136, 7 }, // Ķ
+    { 0x138, 24 }, // ĸ
+    { 0x139, 11 }, // Ĺ
+    { 0x13B, 11 }, // Ļ
+    { 0x13D, 11 }, // Ľ
+    { 0x13E, 31 }, // ľ
+    { 0x13F, 11 }, // Ŀ
+    { 0x141, 11 }, // Ł
+    { 0x14C, 8 }, // Ō
+    { 0x14D, 19 }, // ō
+    { 0x14E, 8 }, // Ŏ
+    { 0x14F, 19 }, // ŏ
+    { 0x150, 8 }, // Ő
+    { 0x151, 19 }, // ő
+    { 0x152, 9 }, // Œ
+    { 0x153, 19 }, // œ
+    { 0x155, 22 }, // ŕ
+    { 0x157, 22 }, // ŗ
+    { 0x159, 22 }, // ř
+    { 0x162, 13 }, // Ţ
+    { 0x163, 20 }, // ţ
+    { 0x164, 13 }, // Ť
+    { 0x165, 33 }, // ť
+    { 0x166, 13 }, // Ŧ
+    { 0x167, 20 }, // ŧ
+    { 0x168, 14 }, // Ũ
+    { 0x16A, 14 }, // Ū
+    { 0x16C, 14 }, // Ŭ
+    { 0x16E, 14 }, // Ů
+    { 0x170, 14 }, // Ű
+    { 0x172, 14 }, // Ų
+    { 0x174, 15 }, // Ŵ
+    { 0x175, 23 }, // ŵ
+    { 0x176, 16 }, // Ŷ
+    { 0x177, 23 }, // ŷ
+    { 0x178, 16 }, // Ÿ
+    { 0x179, 17 }, // Ź
+    { 0x17B, 17 }, // Ż
+    { 0x17D, 17 }, // Ž
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 4 }, // ‚
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x2039, 26 }, // ‹
+    { 0x203A, 27 }, // ›
+    { 0xFB00, 21 }, // ﬀ
+};
+
+static const EpdKernClassEntry notosans_18_boldKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x26, 3 }, // &
+    { 0x27, 2 }, // '
+    { 0x29, 4 }, // )
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x3F, 7 }, // ?
+    { 0x41, 8 }, // A
+    { 0x43, 9 }, // C
+    { 0x47, 9 }, // G
+    { 0x4A, 10 }, // J
+    { 0x4F, 9 }, // O
+    { 0x51, 9 }, // Q
+    { 0x54, 11 }, // T
+    { 0x55, 12 }, // U
+    { 0x56, 13 }, // V
+    { 0x57, 13 }, // W
+    { 0x58, 14 }, // X
+    { 0x59, 15 }, // Y
+    { 0x5D, 4 }, // ]
+    { 0x61, 16 }, // a
+    { 0x62, 17 }, // b
+    { 0x63, 18 }, // c
+    { 0x64, 18 }, // d
+    { 0x65, 18 }, // e
+    { 0x67, 19 }, // g
+    { 0x68, 17 }, // h
+    { 0x6A, 20 }, // j
+    { 0x6B, 17 }, // k
+    { 0x6C, 17 }, // l
+    { 0x6D, 21 }, // m
+    { 0x6E, 21 }, // n
+    { 0x6F, 18 }, // o
+    { 0x70, 21 }, // p
+    { 0x71, 18 }, // q
+    { 0x72, 21 }, // r
+    { 0x73, 22 }, // s
+    { 0x75, 21 }, // u
+    { 0x76, 23 }, // v
+    { 0x77, 23 }, // w
+    { 0x78, 23 }, // x
+    { 0x79, 23 }, // y
+    { 0x7A, 24 }, // z
+    { 0x7D, 4 }, // }
+    { 0xAB, 25 }, // «
+    { 0xBB, 3 }, // »
+    { 0xC0, 8 }, // À
+    { 0xC1, 8 }, // Á
+    { 0xC2, 8 }, // Â
+    { 0xC3, 8 }, // Ã
+    { 0xC4, 8 }, // Ä
+    { 0xC5, 8 }, // Å
+    { 0xC6, 26 }, // Æ
+    { 0xC7, 9 }, // Ç
+    { 0xD2, 9 }, // Ò
+    { 0xD3, 9 }, // Ó
+    { 0xD4, 9 }, // Ô
+    { 0xD5, 9 }, // Õ
+    { 0xD6, 9 }, // Ö
+    { 0xD8, 9 }, // Ø
+    { 0xD9, 12 }, // Ù
+    { 0xDA, 12 }, // Ú
+    { 0xDB, 12 }, // Û
+    { 0xDC, 12 }, // Ü
+    { 0xDD, 15 }, // Ý
+    { 0xE0, 18 }, // à
+    { 0xE1, 16 }, // á
+    { 0xE2, 16 }, // â
+    { 0xE3, 16 }, // ã
+    { 0xE4, 16 }, // ä
+    { 0xE5, 16 }, // å
+    { 0xE6, 16 }, // æ
+    { 0xE7, 18 }, // ç
+    { 0xE8, 18 }, // è
+    { 0xE9, 18 }, // é
+    { 0xEA, 18 }, // ê
+    { 0xEB, 18 }, // ë
+    { 0xF2, 18 }, // ò
+    { 0xF3, 18 }, // ó
+    { 0xF4, 18 }, // ô
+    { 0xF5, 18 }, // õ
+    { 0xF6, 18 }, // ö
+    { 0xF8, 18 }, // ø
+    { 0xF9, 21 }, // ù
+    { 0xFA, 21 }, // ú
+    { 0xFB, 21 }, // û
+    { 0xFC, 21 }, // ü
+    { 0xFD, 23 }, // ý
+    { 0xFE, 17 }, // þ
+    { 0xFF, 23 }, // ÿ
+    { 0x100, 8 }, // Ā
+    { 0x101, 16 }, // ā
+    { 0x102, 8 }, // Ă
+    { 0x103, 16 }, // ă
+    { 0x104, 8 }, // Ą
+    { 0x105, 16 }, // ą
+    { 0x106, 9 }, // Ć
+    { 0x107, 18 }, // ć
+    { 0x108, 9 }, // Ĉ
+    { 0x109, 18 }, // ĉ
+    { 0x10A, 9 }, // Ċ
+    { 0x10B, 18 }, // ċ
+    { 0x10C, 9 }, // Č
+    { 0x10D, 18 }, // č
+    { 0x10F, 18 }, // ď
+    { 0x111, 18 }, // đ
+    { 0x113, 18 }, // ē
+    { 0x115, 18 }, // ĕ
+    { 0x117, 18 }, // ė
+    { 0x119, 18 }, // ę
+    { 0x11B, 18 }, // ě
+    { 0x11C, 9 }, // Ĝ
+    { 0x11D, 19 }, // ĝ
+    { 0x11E, 9 }, // Ğ
+    { 0x11F, 19 }, // ğ
+    { 0x120, 9 }, // Ġ
+    { 0x121, 19 }, // ġ
+    { 0x122, 9 }, // Ģ
+    { 0x123, 19 }, // ģ
+    { 0x125, 17 }, // ĥ
+    { 0x127, 27 }, // ħ
+    { 0x129, 28 }, // ĩ
+    { 0x137, 17 }, // ķ
+    { 0x138, 21 }, // ĸ
+    { 0x13A, 17 }, // ĺ
+    { 0x13C, 17 }, // ļ
+    { 0x13E, 17 }, // ľ
+    { 0x140, 17 }, // ŀ
+    { 0x144, 21 }, // ń
+    { 0x146, 21 }, // ņ
+    { 0x14B, 21 }, // ŋ
+    { 0x14C, 9 }, // Ō
+    { 0x14D, 18 }, // ō
+    { 0x14E, 9 }, // Ŏ
+    { 0x14F, 18 }, // ŏ
+    { 0x150, 9 }, // Ő
+    { 0x151, 18 }, // ő
+    { 0x152, 9 }, // Œ
+    { 0x153, 18 }, // œ
+    { 0x155, 21 }, // ŕ
+    { 0x157, 21 }, // ŗ
+    { 0x15B, 22 }, // ś
+    { 0x15F, 22 }, // ş
+    { 0x162, 11 }, // Ţ
+    { 0x164, 11 }, // Ť
+    { 0x166, 11 }, // Ŧ
+    { 0x168, 12 }, // Ũ
+    { 0x169, 21 }, // ũ
+    { 0x16A, 12 }, // Ū
+    { 0x16B, 21 }, // ū
+    { 0x16C, 12 }, // Ŭ
+    { 0x16D, 21 }, // ŭ
+    { 0x16E, 12 }, // Ů
+    { 0x16F, 21 }, // ů
+    { 0x170, 12 }, // Ű
+    { 0x171, 21 }, // ű
+    { 0x172, 12 }, // Ų
+    { 0x173, 21 }, // ų
+    { 0x174, 13 }, // Ŵ
+    { 0x175, 23 }, // ŵ
+    { 0x176, 15 }, // Ŷ
+    { 0x177, 23 }, // ŷ
+    { 0x178, 15 }, // Ÿ
+    { 0x17A, 24 }, // ź
+    { 0x17C, 24 }, // ż
+    { 0x17E, 24 }, // ž
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 29 }, // ‘
+    { 0x2019, 2 }, // ’
+    { 0x201A, 5 }, // ‚
+    { 0x201C, 29 }, // “
+    { 0x201D, 2 }, // ”
+    { 0x201E, 5 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 25 }, // ‹
+    { 0x203A, 3 }, // ›
+};
+
+static const int8_t notosans_18_boldKernMatrix[957] = {
+    0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 1, 0, 1, 0, 0, -2, 0, -2, -1, 0, -1, -1, 0, 0, 0, -3, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0, -1, 2, -3, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, -2, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
+    0, 0, -1, 0, -2, -2, 1, -3, -1, 0, 1, 0, 0, 0, 0, -3, 0, -3, -3, 0, -2, -2, -1, -2, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -1, 0, -2, 0, 1, -2, -1, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, -1, -2, 0, -1, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0, -1, 4, -3, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 0, 5, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    5, 4, 0, 6, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+};
+
+static const EpdLigaturePair notosans_18_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData notosans_18_bold = {
     notosans_18_boldBitmaps,
     notosans_18_boldGlyphs,
     notosans_18_boldIntervals,
-    11,
+    12,
     51,
     41,
     -11,
     true,
+    notosans_18_boldKernLeftClasses,
+    159,
+    notosans_18_boldKernRightClasses,
+    180,
+    notosans_18_boldKernMatrix,
+    33,
+    29,
+    notosans_18_boldLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_8_regularBitmaps[10949] = {
+static const uint8_t notosans_8_regularBitmaps[11051] = {
     0xDB, 0x6D, 0xB6, 0xC3, 0xF4, 0xDE, 0xF7, 0xBD, 0x80, 0x0D, 0x83, 0x30, 0x66, 0x3F, 0xF7, 0xFE,
     0x36, 0x04, 0xC7, 0xFE, 0xFF, 0xC6, 0x40, 0xD8, 0x1B, 0x00, 0x18, 0x18, 0xFE, 0xFE, 0xD8, 0xF8,
     0xFC, 0x3E, 0x1F, 0x1B, 0xFF, 0xFE, 0x38, 0x18, 0x00, 0x01, 0xE1, 0x86, 0xCC, 0x13, 0x30, 0xCD,
@@ -692,7 +692,13 @@ static const uint8_t notosans_8_regularBitmaps[10949] = {
     0x07, 0x01, 0xC0, 0x1B, 0x03, 0xE1, 0xFF, 0x3D, 0xED, 0xBF, 0xB6, 0xF6, 0xDE, 0x53, 0xC0, 0x1C,
     0x01, 0x80, 0x3F, 0xE7, 0xFC, 0x3C, 0x3C, 0xFE, 0xFF, 0xE3, 0xE3, 0xE7, 0xFE, 0xFF, 0xE3, 0xE3,
     0xE3, 0xFF, 0xFE, 0x3C, 0x3C, 0x00, 0x3F, 0x7E, 0x60, 0x60, 0xE0, 0xE0, 0x60, 0x7E, 0x3F, 0x0C,
-    0x7F, 0x7E, 0x7F, 0xFF, 0xC0,
+    0x7F, 0x7E, 0x7F, 0xFF, 0xC0, 0x1E, 0xF1, 0xF7, 0x8C, 0x70, 0xE3, 0x0F, 0xFF, 0x7D, 0xF1, 0xC6,
+    0x0E, 0x30, 0x71, 0x83, 0x8C, 0x1C, 0x60, 0xE3, 0x07, 0x18, 0x00, 0x1F, 0x1F, 0xCC, 0x6E, 0x0F,
+    0xDF, 0xCD, 0xC6, 0xE3, 0x71, 0xB8, 0xDC, 0x6E, 0x37, 0x18, 0x1F, 0x9F, 0xCC, 0x6E, 0x3F, 0xDF,
+    0xCD, 0xC6, 0xE3, 0x71, 0xB8, 0xDC, 0x6E, 0x37, 0x18, 0x1E, 0xF4, 0x7D, 0xFC, 0xC7, 0x1B, 0x8C,
+    0x0F, 0xFF, 0x7F, 0x7C, 0xDC, 0x61, 0xB8, 0xC3, 0x71, 0x86, 0xE3, 0x0D, 0xC6, 0x1B, 0x8C, 0x37,
+    0x18, 0x60, 0x1E, 0xFE, 0x7D, 0xEC, 0xC7, 0x1B, 0x8C, 0x3F, 0xFF, 0x7F, 0x7C, 0xDC, 0x61, 0xB8,
+    0xC3, 0x71, 0x86, 0xE3, 0x0D, 0xC6, 0x1B, 0x8C, 0x37, 0x18, 0x60,
 };
 
 static const EpdGlyph notosans_8_regularGlyphs[] = {
@@ -1530,6 +1536,11 @@ static const EpdGlyph notosans_8_regularGlyphs[] = {
     { 8, 16, 10, 1, 14, 16, 10917 }, // ₿
     { 8, 13, 8, 0, 10, 13, 10933 }, // ⃀
     { 9, 2, 10, 0, 7, 3, 10946 }, // −
+    { 13, 13, 11, 0, 13, 22, 10949 }, // ﬀ
+    { 9, 13, 10, 0, 13, 15, 10971 }, // ﬁ
+    { 9, 13, 10, 0, 13, 15, 10986 }, // ﬂ
+    { 15, 13, 16, 0, 13, 25, 11001 }, // ﬃ
+    { 15, 13, 16, 0, 13, 25, 11026 }, // ﬄ
 };
 
 static const EpdUnicodeInterval notosans_8_regularIntervals[] = {
@@ -1544,15 +1555,331 @@ static const EpdUnicodeInterval notosans_8_regularIntervals[] = {
     { 0x2066, 0x206F, 0x316 },
     { 0x20A0, 0x20C0, 0x320 },
     { 0x2212, 0x2212, 0x341 },
+    { 0xFB00, 0xFB04, 0x342 },
+};
+
+static const EpdKernClassEntry notosans_8_regularKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x2C, 4 }, // ,
+    { 0x2D, 5 }, // -
+    { 0x2E, 4 }, // .
+    { 0x41, 6 }, // A
+    { 0x44, 7 }, // D
+    { 0x45, 8 }, // E
+    { 0x46, 9 }, // F
+    { 0x4C, 10 }, // L
+    { 0x4F, 7 }, // O
+    { 0x50, 11 }, // P
+    { 0x51, 7 }, // Q
+    { 0x54, 12 }, // T
+    { 0x56, 13 }, // V
+    { 0x57, 13 }, // W
+    { 0x59, 14 }, // Y
+    { 0x5B, 3 }, // [
+    { 0x5F, 15 }, // _
+    { 0x66, 16 }, // f
+    { 0x72, 17 }, // r
+    { 0x76, 18 }, // v
+    { 0x77, 18 }, // w
+    { 0x79, 18 }, // y
+    { 0x7B, 3 }, // {
+    { 0xA1, 19 }, // ¡
+    { 0xAB, 2 }, // «
+    { 0xBB, 20 }, // »
+    { 0xBF, 21 }, // ¿
+    { 0xC0, 6 }, // À
+    { 0xC1, 6 }, // Á
+    { 0xC2, 6 }, // Â
+    { 0xC3, 6 }, // Ã
+    { 0xC4, 6 }, // Ä
+    { 0xC5, 6 }, // Å
+    { 0xC6, 8 }, // Æ
+    { 0xC8, 8 }, // È
+    { 0xC9, 8 }, // É
+    { 0xCA, 8 }, // Ê
+    { 0xCB, 8 }, // Ë
+    { 0xD0, 7 }, // Ð
+    { 0xD2, 7 }, // Ò
+    { 0xD3, 7 }, // Ó
+    { 0xD4, 7 }, // Ô
+    { 0xD5, 7 }, // Õ
+    { 0xD6, 7 }, // Ö
+    { 0xD8, 7 }, // Ø
+    { 0xDD, 14 }, // Ý
+    { 0xDE, 11 }, // Þ
+    { 0xEE, 22 }, // î
+    { 0xEF, 22 }, // ï
+    { 0xFD, 18 }, // ý
+    { 0xFF, 18 }, // ÿ
+    { 0x100, 6 }, // Ā
+    { 0x102, 6 }, // Ă
+    { 0x104, 23 }, // Ą
+    { 0x10E, 7 }, // Ď
+    { 0x10F, 24 }, // ď
+    { 0x110, 7 }, // Đ
+    { 0x112, 8 }, // Ē
+    { 0x114, 8 }, // Ĕ
+    { 0x116, 8 }, // Ė
+    { 0x118, 8 }, // Ę
+    { 0x11A, 8 }, // Ě
+    { 0x129, 25 }, // ĩ
+    { 0x12B, 22 }, // ī
+    { 0x12E, 8 }, // Į
+    { 0x139, 10 }, // Ĺ
+    { 0x13B, 10 }, // Ļ
+    { 0x13D, 10 }, // Ľ
+    { 0x13E, 24 }, // ľ
+    { 0x13F, 10 }, // Ŀ
+    { 0x141, 10 }, // Ł
+    { 0x14C, 7 }, // Ō
+    { 0x14E, 7 }, // Ŏ
+    { 0x150, 7 }, // Ő
+    { 0x152, 8 }, // Œ
+    { 0x155, 17 }, // ŕ
+    { 0x157, 17 }, // ŗ
+    { 0x159, 17 }, // ř
+    { 0x162, 12 }, // Ţ
+    { 0x164, 12 }, // Ť
+    { 0x165, 26 }, // ť
+    { 0x166, 12 }, // Ŧ
+    { 0x174, 13 }, // Ŵ
+    { 0x175, 18 }, // ŵ
+    { 0x176, 14 }, // Ŷ
+    { 0x177, 18 }, // ŷ
+    { 0x178, 14 }, // Ÿ
+    { 0x2013, 5 }, // –
+    { 0x2014, 5 }, // —
+    { 0x2015, 5 }, // ―
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 4 }, // ‚
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 4 }, // „
+    { 0x2039, 2 }, // ‹
+    { 0x203A, 20 }, // ›
+    { 0xFB00, 16 }, // ﬀ
+};
+
+static const EpdKernClassEntry notosans_8_regularKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x26, 3 }, // &
+    { 0x27, 2 }, // '
+    { 0x29, 4 }, // )
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x3F, 7 }, // ?
+    { 0x41, 8 }, // A
+    { 0x43, 9 }, // C
+    { 0x47, 9 }, // G
+    { 0x4A, 10 }, // J
+    { 0x4F, 9 }, // O
+    { 0x51, 9 }, // Q
+    { 0x54, 11 }, // T
+    { 0x56, 12 }, // V
+    { 0x57, 12 }, // W
+    { 0x59, 13 }, // Y
+    { 0x5D, 4 }, // ]
+    { 0x61, 14 }, // a
+    { 0x62, 15 }, // b
+    { 0x63, 14 }, // c
+    { 0x64, 14 }, // d
+    { 0x65, 14 }, // e
+    { 0x67, 14 }, // g
+    { 0x68, 15 }, // h
+    { 0x6A, 16 }, // j
+    { 0x6B, 15 }, // k
+    { 0x6C, 15 }, // l
+    { 0x6D, 14 }, // m
+    { 0x6E, 14 }, // n
+    { 0x6F, 14 }, // o
+    { 0x70, 14 }, // p
+    { 0x71, 14 }, // q
+    { 0x72, 14 }, // r
+    { 0x73, 14 }, // s
+    { 0x75, 14 }, // u
+    { 0x7A, 6 }, // z
+    { 0x7D, 4 }, // }
+    { 0xAB, 17 }, // «
+    { 0xBB, 18 }, // »
+    { 0xC0, 8 }, // À
+    { 0xC1, 8 }, // Á
+    { 0xC2, 8 }, // Â
+    { 0xC3, 8 }, // Ã
+    { 0xC4, 8 }, // Ä
+    { 0xC5, 8 }, // Å
+    { 0xC6, 19 }, // Æ
+    { 0xC7, 9 }, // Ç
+    { 0xD2, 9 }, // Ò
+    { 0xD3, 9 }, // Ó
+    { 0xD4, 9 }, // Ô
+    { 0xD5, 9 }, // Õ
+    { 0xD6, 9 }, // Ö
+    { 0xD8, 9 }, // Ø
+    { 0xDD, 13 }, // Ý
+    { 0xE0, 14 }, // à
+    { 0xE1, 14 }, // á
+    { 0xE2, 14 }, // â
+    { 0xE3, 14 }, // ã
+    { 0xE4, 14 }, // ä
+    { 0xE5, 14 }, // å
+    { 0xE6, 14 }, // æ
+    { 0xE7, 14 }, // ç
+    { 0xE8, 14 }, // è
+    { 0xE9, 14 }, // é
+    { 0xEA, 14 }, // ê
+    { 0xEB, 14 }, // ë
+    { 0xF2, 14 }, // ò
+    { 0xF3, 14 }, // ó
+    { 0xF4, 14 }, // ô
+    { 0xF5, 14 }, // õ
+    { 0xF6, 14 }, // ö
+    { 0xF8, 14 }, // ø
+    { 0xF9, 14 }, // ù
+    { 0xFA, 14 }, // ú
+    { 0xFB, 14 }, // û
+    { 0xFC, 14 }, // ü
+    { 0xFE, 15 }, // þ
+    { 0x100, 8 }, // Ā
+    { 0x101, 14 }, // ā
+    { 0x102, 8 }, // Ă
+    { 0x103, 14 }, // ă
+    { 0x104, 8 }, // Ą
+    { 0x105, 14 }, // ą
+    { 0x106, 9 }, // Ć
+    { 0x107, 14 }, // ć
+    { 0x108, 9 }, // Ĉ
+    { 0x109, 14 }, // ĉ
+    { 0x10A, 9 }, // Ċ
+    { 0x10B, 14 }, // ċ
+    { 0x10C, 9 }, // Č
+    { 0x10D, 14 }, // č
+    { 0x10F, 14 }, // ď
+    { 0x111, 14 }, // đ
+    { 0x113, 14 }, // ē
+    { 0x115, 14 }, // ĕ
+    { 0x117, 14 }, // ė
+    { 0x119, 14 }, // ę
+    { 0x11B, 14 }, // ě
+    { 0x11C, 9 }, // Ĝ
+    { 0x11D, 14 }, // ĝ
+    { 0x11E, 9 }, // Ğ
+    { 0x11F, 14 }, // ğ
+    { 0x120, 9 }, // Ġ
+    { 0x121, 14 }, // ġ
+    { 0x122, 9 }, // Ģ
+    { 0x123, 14 }, // ģ
+    { 0x125, 15 }, // ĥ
+    { 0x127, 15 }, // ħ
+    { 0x129, 20 }, // ĩ
+    { 0x137, 15 }, // ķ
+    { 0x138, 14 }, // ĸ
+    { 0x13A, 15 }, // ĺ
+    { 0x13C, 15 }, // ļ
+    { 0x13E, 15 }, // ľ
+    { 0x140, 15 }, // ŀ
+    { 0x144, 14 }, // ń
+    { 0x146, 14 }, // ņ
+    { 0x14B, 14 }, // ŋ
+    { 0x14C, 9 }, // Ō
+    { 0x14D, 14 }, // ō
+    { 0x14E, 9 }, // Ŏ
+    { 0x14F, 14 }, // ŏ
+    { 0x150, 9 }, // Ő
+    { 0x151, 14 }, // ő
+    { 0x152, 9 }, // Œ
+    { 0x153, 14 }, // œ
+    { 0x155, 14 }, // ŕ
+    { 0x157, 14 }, // ŗ
+    { 0x15B, 14 }, // ś
+    { 0x15F, 14 }, // ş
+    { 0x162, 11 }, // Ţ
+    { 0x164, 11 }, // Ť
+    { 0x166, 11 }, // Ŧ
+    { 0x169, 14 }, // ũ
+    { 0x16B, 14 }, // ū
+    { 0x16D, 14 }, // ŭ
+    { 0x16F, 14 }, // ů
+    { 0x171, 14 }, // ű
+    { 0x173, 14 }, // ų
+    { 0x174, 12 }, // Ŵ
+    { 0x176, 13 }, // Ŷ
+    { 0x178, 13 }, // Ÿ
+    { 0x17A, 6 }, // ź
+    { 0x17C, 6 }, // ż
+    { 0x17E, 6 }, // ž
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2015, 6 }, // ―
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 2 }, // ’
+    { 0x201A, 5 }, // ‚
+    { 0x201C, 1 }, // “
+    { 0x201D, 2 }, // ”
+    { 0x201E, 5 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 17 }, // ‹
+    { 0x203A, 18 }, // ›
+};
+
+static const int8_t notosans_8_regularKernMatrix[520] = {
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    1, 2, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_8_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData notosans_8_regular = {
     notosans_8_regularBitmaps,
     notosans_8_regularGlyphs,
     notosans_8_regularIntervals,
-    11,
+    12,
     23,
     18,
     -5,
     false,
+    notosans_8_regularKernLeftClasses,
+    103,
+    notosans_8_regularKernRightClasses,
+    160,
+    notosans_8_regularKernMatrix,
+    26,
+    20,
+    notosans_8_regularLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_boldBitmaps[42878] = {
+static const uint8_t opendyslexic_10_boldBitmaps[43331] = {
     0x00, 0x00, 0x14, 0x00, 0x74, 0x01, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0,
     0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0x7F, 0x00, 0xFC, 0x00, 0xB0, 0x00, 0x40, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x03, 0xFD, 0x0F, 0xF8, 0x3F, 0xE1, 0xFF, 0xCB, 0xFF, 0x00,
@@ -2687,7 +2687,36 @@ static const uint8_t opendyslexic_10_boldBitmaps[42878] = {
     0xBF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
     0xFC, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x01, 0xBF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF,
     0xFF, 0x90, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x01, 0x50, 0x00, 0x5A, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xEA, 0x50, 0x02, 0x50, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xEA, 0x50, 0x02, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0xBF, 0x41, 0xFF, 0xC0, 0xFF, 0xD0, 0xFE, 0xA0, 0x7F, 0xA4, 0x3E, 0x00, 0x1F, 0x40, 0x0F,
+    0x80, 0x0B, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x0F, 0xC0, 0x0B, 0xE0, 0x07, 0xF0, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x3F,
+    0x80, 0x1F, 0xC0, 0x0F, 0xF0, 0x07, 0xF0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x7F, 0x40,
+    0x3F, 0xC0, 0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x1F,
+    0xF0, 0xFE, 0x01, 0xFF, 0xC7, 0xFC, 0x0F, 0xFA, 0x1A, 0xA0, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00,
+    0x00, 0x3F, 0xFF, 0xC1, 0xA0, 0xFF, 0xFF, 0x0B, 0xC3, 0xFF, 0xFC, 0x2F, 0x00, 0xFC, 0x00, 0xBC,
+    0x07, 0xF0, 0x02, 0xF0, 0x1F, 0xC0, 0x0B, 0xC0, 0x7F, 0x00, 0x2F, 0x01, 0xFC, 0x00, 0xBD, 0x07,
+    0xF0, 0x03, 0xF4, 0x1F, 0xD0, 0x0F, 0xD0, 0x7F, 0x40, 0x3F, 0x82, 0xFD, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0x01, 0x50, 0x00, 0x7F, 0xC0, 0xBC, 0x00, 0x7F, 0xF0, 0x3F, 0x00, 0x3F, 0xE8, 0x0F, 0xC0,
+    0x0F, 0x80, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F, 0x03, 0xFF, 0xFC, 0x0F,
+    0xC0, 0xFF, 0xFF, 0x03, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x7F, 0x00,
+    0x1F, 0x80, 0x1F, 0xC0, 0x07, 0xE0, 0x07, 0xF0, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x7F,
+    0x40, 0x2F, 0xFC, 0x1F, 0xD0, 0x0B, 0xFF, 0x0B, 0xF4, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x40, 0x7F, 0xC3, 0xF8, 0x03, 0xFF,
+    0x41, 0xFF, 0xC7, 0xFC, 0x07, 0xFA, 0x03, 0xFE, 0x86, 0xA8, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00,
+    0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC1, 0xA0, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xC2, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xC2, 0xF4, 0x0F, 0xE0, 0x03, 0xF0, 0x02, 0xF4, 0x0F, 0xE0,
+    0x03, 0xF0, 0x02, 0xF0, 0x0F, 0xE0, 0x07, 0xF0, 0x02, 0xF0, 0x0F, 0xE0, 0x07, 0xF0, 0x02, 0xF4,
+    0x0F, 0xE0, 0x07, 0xF0, 0x02, 0xF4, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xF4, 0x0F, 0xE0, 0x07, 0xF4,
+    0x03, 0xF8, 0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x0F, 0xF0, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x54, 0x00, 0x1F, 0xF0, 0x0B, 0xF4, 0x0F, 0xC0, 0x07, 0xFF, 0x03, 0xFF, 0x40,
+    0xF8, 0x00, 0xFE, 0xA0, 0x7F, 0xA4, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0xF8,
+    0x00, 0xBC, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x2F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xF4, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x1F,
+    0xC0, 0x0B, 0xE0, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0F, 0xE0,
+    0x03, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0F, 0xF0, 0x03, 0xF0, 0x01,
+    0xFD, 0x00, 0xFF, 0x00, 0x3F, 0xF8, 0x1F, 0xD0, 0x0F, 0xF0, 0x03, 0xFF, 0xC2, 0xFD, 0x00, 0xFF,
+    0x00, 0x3F, 0xFC,
 };
 
 static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
@@ -3396,6 +3425,11 @@ static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
     { 16, 19, 26, 5, 17, 76, 42640 }, // ≠
     { 18, 18, 17, -1, 16, 81, 42716 }, // ≤
     { 18, 18, 18, 0, 16, 81, 42797 }, // ≥
+    { 17, 17, 23, 3, 17, 73, 42878 }, // ﬀ
+    { 15, 19, 20, 3, 19, 72, 42951 }, // ﬁ
+    { 17, 18, 23, 3, 18, 77, 43023 }, // ﬂ
+    { 24, 19, 28, 3, 19, 114, 43100 }, // ﬃ
+    { 26, 18, 31, 3, 18, 117, 43214 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_10_boldIntervals[] = {
@@ -3451,15 +3485,94 @@ static const EpdUnicodeInterval opendyslexic_10_boldIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_10_boldKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 1 }, // "
+    { 0x23, 1 }, // #
+    { 0x27, 1 }, // '
+    { 0x28, 1 }, // (
+    { 0x29, 1 }, // )
+    { 0x2A, 1 }, // *
+    { 0x2C, 1 }, // ,
+    { 0x2D, 1 }, // -
+    { 0x2E, 1 }, // .
+    { 0x2F, 1 }, // /
+    { 0x3A, 1 }, // :
+    { 0x3B, 1 }, // ;
+    { 0x3F, 1 }, // ?
+    { 0x5B, 1 }, // [
+    { 0x5C, 1 }, // <backslash>
+    { 0x5D, 1 }, // ]
+    { 0x5F, 1 }, // _
+    { 0x7B, 1 }, // {
+    { 0x7D, 1 }, // }
+    { 0xA1, 1 }, // ¡
+    { 0xAB, 1 }, // «
+    { 0xAD, 1 }, // ­
+    { 0xB7, 1 }, // ·
+    { 0xBB, 1 }, // »
+    { 0xBF, 1 }, // ¿
+    { 0x2010, 1 }, // ‐
+    { 0x2011, 1 }, // ‑
+    { 0x2012, 1 }, // ‒
+    { 0x2013, 1 }, // –
+    { 0x2014, 1 }, // —
+    { 0x2015, 1 }, // ―
+    { 0x2016, 1 }, // ‖
+    { 0x2017, 1 }, // ‗
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 1 }, // ‚
+    { 0x201B, 1 }, // ‛
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 1 }, // „
+    { 0x201F, 1 }, // ‟
+    { 0x2022, 1 }, // •
+    { 0x2023, 1 }, // ‣
+    { 0x2024, 1 }, // ․
+    { 0x2025, 1 }, // ‥
+    { 0x2026, 1 }, // …
+    { 0x2027, 1 }, // ‧
+    { 0x2039, 1 }, // ‹
+    { 0x203A, 1 }, // ›
+};
+
+static const EpdKernClassEntry opendyslexic_10_boldKernRightClasses[] = {
+    { 0x20, 1 }, //  
+};
+
+static const int8_t opendyslexic_10_boldKernMatrix[1] = {
+    3,
+};
+
+static const EpdLigaturePair opendyslexic_10_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_10_bold = {
     opendyslexic_10_boldBitmaps,
     opendyslexic_10_boldGlyphs,
     opendyslexic_10_boldIntervals,
-    52,
+    53,
     38,
     28,
     -11,
     true,
+    opendyslexic_10_boldKernLeftClasses,
+    50,
+    opendyslexic_10_boldKernRightClasses,
+    1,
+    opendyslexic_10_boldKernMatrix,
+    1,
+    1,
+    opendyslexic_10_boldLigatures,
+    5,
 };
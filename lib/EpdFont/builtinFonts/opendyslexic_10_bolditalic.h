@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_bolditalicBitmaps[51938] = {
+static const uint8_t opendyslexic_10_bolditalicBitmaps[52446] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00,
     0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0B,
     0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0x00,
@@ -3254,7 +3254,38 @@ static const uint8_t opendyslexic_10_bolditalicBitmaps[51938] = {
     0x00, 0x00, 0x01, 0xBF, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x02,
     0xFF, 0xFE, 0x40, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x03, 0x90, 0x00, 0x16, 0x00, 0x00, 0x56,
     0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xE9, 0x50, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xC0, 0x02, 0xFE, 0x80,
+    0xFE, 0x90, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xF8, 0x00, 0xFD,
+    0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x0F, 0xE0,
+    0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00,
+    0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x03, 0xFF, 0x47, 0xFC, 0x00,
+    0x2F, 0xE8, 0x1A, 0xA0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFD,
+    0x2E, 0x00, 0x0B, 0xFF, 0xF0, 0xFC, 0x00, 0x3F, 0xFF, 0xC7, 0xE0, 0x00, 0x2F, 0x80, 0x2F, 0x00,
+    0x00, 0xFD, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x2F, 0xC0, 0x1F, 0x40, 0x00, 0xFF,
+    0x00, 0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x1F, 0xD0, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0xFE,
+    0x00, 0x03, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xF8, 0x0F,
+    0xC0, 0x00, 0xFF, 0xD0, 0x7E, 0x00, 0x0B, 0xFA, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01,
+    0xF4, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0x42, 0xF4, 0x02, 0xFF, 0xFC, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0,
+    0x7E, 0x00, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x7F, 0x00,
+    0x0B, 0xF0, 0x02, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x07, 0xF4,
+    0x01, 0xFE, 0xC0, 0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xC0, 0x2F, 0xE7, 0xF4,
+    0x00, 0xBF, 0xF0, 0x3F, 0xF7, 0xFD, 0x00, 0x3F, 0xA4, 0x2F, 0xE9, 0xAA, 0x00, 0x2F, 0x40, 0x0F,
+    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x80,
+    0xF8, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x7D, 0x00, 0x0B, 0xE0, 0x03, 0xF4, 0x2F, 0x00, 0x03, 0xF4,
+    0x01, 0xFC, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0x3F, 0x82, 0xF4,
+    0x00, 0x3F, 0x80, 0x1F, 0xD0, 0xFD, 0x00, 0x1F, 0xE0, 0x0B, 0xF0, 0x7F, 0x00, 0x0B, 0xF4, 0x03,
+    0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x0B, 0xF8, 0x07, 0xFC,
+    0x07, 0xE0, 0x00, 0xFF, 0xD0, 0x7F, 0xF0, 0x3F, 0x00, 0x0B, 0xFA, 0x03, 0xFA, 0x40, 0xFC, 0x00,
+    0x3F, 0x00, 0x1F, 0x40, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F,
+    0x00, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0xFC,
+    0x00, 0xBF, 0x00, 0x2F, 0x40, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xD0,
+    0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x2F, 0x40, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0xE0,
+    0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xFF, 0x80, 0xFF, 0x00, 0x7F, 0x40, 0x1F, 0xFD, 0x00,
 };
 
 static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
@@ -3963,6 +3994,11 @@ static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
     { 20, 19, 27, 4, 17, 95, 51663 }, // ≠
     { 20, 18, 17, -3, 16, 90, 51758 }, // ≤
     { 20, 18, 18, 0, 16, 90, 51848 }, // ≥
+    { 21, 17, 23, 2, 17, 90, 51938 }, // ﬀ
+    { 19, 19, 20, 2, 19, 91, 52028 }, // ﬁ
+    { 19, 18, 23, 2, 18, 86, 52119 }, // ﬂ
+    { 25, 19, 28, 3, 19, 119, 52205 }, // ﬃ
+    { 27, 18, 31, 2, 18, 122, 52324 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_10_bolditalicIntervals[] = {
@@ -4018,15 +4054,413 @@ static const EpdUnicodeInterval opendyslexic_10_bolditalicIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_10_bolditalicKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x24, 3 }, // $
+    { 0x26, 4 }, // &
+    { 0x27, 5 }, // '
+    { 0x28, 6 }, // (
+    { 0x29, 7 }, // )
+    { 0x2A, 8 }, // *
+    { 0x2C, 9 }, // ,
+    { 0x2E, 10 }, // .
+    { 0x30, 11 }, // 0
+    { 0x31, 12 }, // 1
+    { 0x32, 13 }, // 2
+    { 0x33, 14 }, // 3
+    { 0x34, 15 }, // 4
+    { 0x35, 16 }, // 5
+    { 0x36, 17 }, // 6
+    { 0x37, 18 }, // 7
+    { 0x38, 19 }, // 8
+    { 0x39, 20 }, // 9
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 25 }, // D
+    { 0x45, 26 }, // E
+    { 0x46, 27 }, // F
+    { 0x47, 28 }, // G
+    { 0x48, 29 }, // H
+    { 0x49, 30 }, // I
+    { 0x4A, 31 }, // J
+    { 0x4B, 32 }, // K
+    { 0x4C, 33 }, // L
+    { 0x4D, 29 }, // M
+    { 0x4E, 34 }, // N
+    { 0x4F, 35 }, // O
+    { 0x50, 36 }, // P
+    { 0x51, 37 }, // Q
+    { 0x52, 38 }, // R
+    { 0x53, 39 }, // S
+    { 0x54, 40 }, // T
+    { 0x55, 41 }, // U
+    { 0x56, 42 }, // V
+    { 0x57, 43 }, // W
+    { 0x58, 44 }, // X
+    { 0x59, 45 }, // Y
+    { 0x5A, 46 }, // Z
+    { 0x5B, 47 }, // [
+    { 0x5D, 48 }, // ]
+    { 0x61, 49 }, // a
+    { 0x62, 50 }, // b
+    { 0x63, 51 }, // c
+    { 0x64, 52 }, // d
+    { 0x65, 53 }, // e
+    { 0x66, 54 }, // f
+    { 0x67, 55 }, // g
+    { 0x68, 56 }, // h
+    { 0x69, 57 }, // i
+    { 0x6A, 58 }, // j
+    { 0x6B, 59 }, // k
+    { 0x6C, 60 }, // l
+    { 0x6D, 61 }, // m
+    { 0x6E, 62 }, // n
+    { 0x6F, 63 }, // o
+    { 0x70, 64 }, // p
+    { 0x71, 65 }, // q
+    { 0x72, 66 }, // r
+    { 0x73, 67 }, // s
+    { 0x74, 68 }, // t
+    { 0x75, 69 }, // u
+    { 0x76, 70 }, // v
+    { 0x77, 71 }, // w
+    { 0x78, 72 }, // x
+    { 0x79, 73 }, // y
+    { 0x7A, 74 }, // z
+    { 0x7B, 75 }, // {
+    { 0x7D, 76 }, // }
+    { 0xA1, 77 }, // ¡
+    { 0xA2, 78 }, // ¢
+    { 0xA3, 79 }, // £
+    { 0xA5, 80 }, // ¥
+    { 0xBF, 81 }, // ¿
+    { 0xC1, 82 }, // Á
+    { 0xC4, 82 }, // Ä
+    { 0xC5, 82 }, // Å
+    { 0xC6, 83 }, // Æ
+    { 0xC7, 84 }, // Ç
+    { 0xCC, 85 }, // Ì
+    { 0xCD, 86 }, // Í
+    { 0xCE, 87 }, // Î
+    { 0xCF, 88 }, // Ï
+    { 0xD3, 89 }, // Ó
+    { 0xD6, 89 }, // Ö
+    { 0xD8, 90 }, // Ø
+    { 0xD9, 91 }, // Ù
+    { 0xDB, 91 }, // Û
+    { 0xDC, 92 }, // Ü
+    { 0xDE, 93 }, // Þ
+    { 0xDF, 94 }, // ß
+    { 0xE4, 95 }, // ä
+    { 0xE5, 96 }, // å
+    { 0xE6, 97 }, // æ
+    { 0xE7, 98 }, // ç
+    { 0xEC, 99 }, // ì
+    { 0xED, 100 }, // í
+    { 0xEE, 101 }, // î
+    { 0xEF, 102 }, // ï
+    { 0xF0, 103 }, // ð
+    { 0xF6, 104 }, // ö
+    { 0xF8, 105 }, // ø
+    { 0xFC, 106 }, // ü
+    { 0x128, 87 }, // Ĩ
+    { 0x129, 107 }, // ĩ
+    { 0x12A, 87 }, // Ī
+    { 0x12B, 108 }, // ī
+    { 0x12F, 109 }, // į
+    { 0x130, 87 }, // İ
+    { 0x131, 110 }, // ı
+    { 0x152, 111 }, // Œ
+    { 0x153, 112 }, // œ
+    { 0x2018, 113 }, // ‘
+    { 0x2019, 114 }, // ’
+    { 0x201A, 115 }, // ‚
+    { 0x201C, 116 }, // “
+    { 0x201D, 117 }, // ”
+    { 0x201E, 115 }, // „
+    { 0xFB01, 118 }, // ﬁ
+    { 0xFB02, 119 }, // ﬂ
+};
+
+static const EpdKernClassEntry opendyslexic_10_bolditalicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x24, 3 }, // $
+    { 0x26, 4 }, // &
+    { 0x27, 5 }, // '
+    { 0x28, 6 }, // (
+    { 0x29, 7 }, // )
+    { 0x2A, 8 }, // *
+    { 0x2C, 9 }, // ,
+    { 0x2E, 10 }, // .
+    { 0x30, 11 }, // 0
+    { 0x31, 12 }, // 1
+    { 0x32, 13 }, // 2
+    { 0x33, 14 }, // 3
+    { 0x34, 15 }, // 4
+    { 0x35, 16 }, // 5
+    { 0x36, 17 }, // 6
+    { 0x37, 18 }, // 7
+    { 0x38, 19 }, // 8
+    { 0x39, 20 }, // 9
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 23 }, // D
+    { 0x45, 25 }, // E
+    { 0x46, 26 }, // F
+    { 0x47, 27 }, // G
+    { 0x48, 28 }, // H
+    { 0x49, 29 }, // I
+    { 0x4A, 30 }, // J
+    { 0x4B, 31 }, // K
+    { 0x4C, 32 }, // L
+    { 0x4D, 25 }, // M
+    { 0x4E, 33 }, // N
+    { 0x4F, 34 }, // O
+    { 0x50, 35 }, // P
+    { 0x51, 36 }, // Q
+    { 0x52, 37 }, // R
+    { 0x53, 38 }, // S
+    { 0x54, 39 }, // T
+    { 0x55, 40 }, // U
+    { 0x56, 41 }, // V
+    { 0x57, 42 }, // W
+    { 0x58, 43 }, // X
+    { 0x59, 44 }, // Y
+    { 0x5A, 45 }, // Z
+    { 0x5B, 46 }, // [
+    { 0x5D, 47 }, // ]
+    { 0x61, 48 }, // a
+    { 0x62, 49 }, // b
+    { 0x63, 50 }, // c
+    { 0x64, 51 }, // d
+    { 0x65, 52 }, // e
+    { 0x66, 53 }, // f
+    { 0x67, 54 }, // g
+    { 0x68, 55 }, // h
+    { 0x69, 56 }, // i
+    { 0x6A, 57 }, // j
+    { 0x6B, 58 }, // k
+    { 0x6C, 59 }, // l
+    { 0x6D, 60 }, // m
+    { 0x6E, 61 }, // n
+    { 0x6F, 62 }, // o
+    { 0x70, 63 }, // p
+    { 0x71, 64 }, // q
+    { 0x72, 65 }, // r
+    { 0x73, 66 }, // s
+    { 0x74, 67 }, // t
+    { 0x75, 68 }, // u
+    { 0x76, 69 }, // v
+    { 0x77, 70 }, // w
+    { 0x78, 71 }, // x
+    { 0x79, 72 }, // y
+    { 0x7A, 73 }, // z
+    { 0x7B, 74 }, // {
+    { 0x7D, 75 }, // }
+    { 0xA1, 76 }, // ¡
+    { 0xA2, 77 }, // ¢
+    { 0xA3, 78 }, // £
+    { 0xA5, 79 }, // ¥
+    { 0xBF, 80 }, // ¿
+    { 0xC1, 81 }, // Á
+    { 0xC4, 81 }, // Ä
+    { 0xC5, 81 }, // Å
+    { 0xC6, 82 }, // Æ
+    { 0xC7, 83 }, // Ç
+    { 0xCC, 84 }, // Ì
+    { 0xCD, 85 }, // Í
+    { 0xCF, 86 }, // Ï
+    { 0xD3, 87 }, // Ó
+    { 0xD6, 87 }, // Ö
+    { 0xD8, 88 }, // Ø
+    { 0xD9, 89 }, // Ù
+    { 0xDB, 90 }, // Û
+    { 0xDC, 89 }, // Ü
+    { 0xDE, 91 }, // Þ
+    { 0xDF, 92 }, // ß
+    { 0xE4, 93 }, // ä
+    { 0xE5, 94 }, // å
+    { 0xE6, 95 }, // æ
+    { 0xE7, 96 }, // ç
+    { 0xEC, 97 }, // ì
+    { 0xED, 98 }, // í
+    { 0xEE, 99 }, // î
+    { 0xEF, 100 }, // ï
+    { 0xF0, 101 }, // ð
+    { 0xF6, 102 }, // ö
+    { 0xF8, 103 }, // ø
+    { 0xFC, 104 }, // ü
+    { 0x129, 105 }, // ĩ
+    { 0x12B, 106 }, // ī
+    { 0x12F, 107 }, // į
+    { 0x131, 108 }, // ı
+    { 0x152, 87 }, // Œ
+    { 0x153, 109 }, // œ
+    { 0x2018, 110 }, // ‘
+    { 0x2019, 111 }, // ’
+    { 0x201A, 112 }, // ‚
+    { 0x201C, 113 }, // “
+    { 0x201D, 114 }, // ”
+    { 0x201E, 112 }, // „
+    { 0xFB01, 115 }, // ﬁ
+    { 0xFB02, 115 }, // ﬂ
+};
+
+static const int8_t opendyslexic_10_bolditalicKernMatrix[13685] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, -1, -2, -2, -2, -1, -2, -2, -7, -3, -2, -2, -2, -2, -2, -2, -3, -1, -1, -2, -1, -3, -2, -3, -3, -2, -4, -2, -3, -3, -4, -2, -3, -3, -2, -5, -3, -2, -4, -3, -4, -4, -3, -3, -4, -2, -2, -2, -2, -4, -2, -4, -5, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -2, -2, 0,
+    0, 0, -5, -1, 0, 0, 0, -3, 0, 0, -1, -1, -1, -1, -1, -1, -1, -4, -1, -2, -6, -3, -3, -3, -3, -3, -3, -3, -3, -6, -3, -3, -3, -3, -3, -3, -3, -4, -5, -3, -6, -6, -5, -6, -3, 0, 0, -3, -4, -3, -3, -3, -4, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -4, -5, -3, -6, -5, -5, -6, -4, 0, 0, -6, -3, -1, -2, -6, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -3,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -4, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, -1, -1, 0, -1, 0, -1, -1, -5, -1, -4, -2, -2, -5, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, 0, 0, 0, -1, 0, -1, -1, -3, 0, -2, -1, -2, -2, -1, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -5, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, -2, 0, -1, -1, -2, 0, -1, -1, 0, -3, -1, -1, -2, -1, -1, -2, -1, -1, -2, 0, -1, 0, 0, -2, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 2, 0, 0, 0, -1, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 1, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -4, -2, 0, 0, 0, 0, 0, 0, 0, -8, -1, 0, -1, 0, -1, 0, -1, -2, -1, 0, -2, -2, -3, -2, -3, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, -3, -1, -2, 0, 0, -2, -1, 0, 0, -4, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -3, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, -2, 0, -3, -1, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -1, -1, 0, 0, -1, -3, -1, -1, -1, 0, -1, 0, -1, -2, -2, -1, -3, -2, -3, -4, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -4, -1, 0, -1, -1, 0, -2, 0, -1, -2, 0, 0, -1, -1, -2, -1, -1, 1, 0, -3, 0, 0, 0, -3, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 1, -2, 1, 0, -1, 0, 0, -4, 1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -4, -1, -4, -3, 0, -5, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, -1, -1, 0, 0, 0, -3, -1, -4, -2, 0, -4, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -1, 1, 0, 0, 0, 0, -4, 1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -2, -1, -2, -2, 0, -3, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 1, 0, -3, 1, 0, 1, 1, -1, -1, -1, 1, 0, -1, 0, -1, -1, 1, 0, 1, 0, 0, -3, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 2, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, -1, -1, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -1, -1, 0, 0, 0, -2, 0, -1, 1, 0, -3, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, 0, -1, 0, -1, -2, -2, -1, -3, -2, -2, -4, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -2, -2, 0, -2, -1, -2, -2, -1, 1, 0, -3, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, -1, -1, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -1, -3, -1, -3, -2, -2, -3, -1, 1, 0, -3, 0, 0, 0, -3, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, -1, -1, 0, -1, -3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -2, -2, -1, -3, -2, -2, -3, -1, 1, 0, -2, 0, 0, 0, -3, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -5, -1, 0, -1, -1, -1, -1, -1, 0, -3, -2, -1, -1, -1, -1, -1, -1, -2, 0, 0, -1, -1, -2, -1, -2, 0, 1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -3, -1, -1, -2, -1, -1, -2, -1, -2, -2, -1, -1, -1, -1, -2, -1, -2, 0, 1, -1, -1, 0, 1, -3, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, -1, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -3, -2, -2, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, 0, -3, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -1, -1, 0, 0, -1, -3, -1, -1, -1, 0, -1, 0, -1, -2, -2, -1, -3, -2, -3, -3, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -4, -1, 0, -1, -1, 0, -2, 0, -1, -2, 0, 0, -1, -1, -2, -1, -1, 1, 0, -3, 0, 0, 0, -3, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -5, 0, -1, 0, -1, -1, -3, -4, -2, -4, -2, -3, -3, -2, -2, -7, -3, -3, -3, -3, -3, -3, -3, -4, -2, -2, -2, -2, -3, -2, -3, 0, 0, -6, -2, -6, -6, -6, -3, -6, -3, -2, -5, -3, -2, -4, -4, -5, -4, -6, -4, -6, -4, -3, -3, -3, -4, -3, -5, 0, 0, -3, -6, -1, 0, -6, -4, -4, -4, -2, -2, -2, -3, -3, -2, -2, 0, -1, -1, -4, -6, -6, 0, 0, 0, 0, -1, -3, -5, -2, 0, 0, 0, -1, -5, 0, 0, 0, 0, 0, -2,
+    1, 0, -2, 0, -3, 0, 0, -2, 1, 2, 0, 1, 1, 1, -1, 1, 0, -2, 0, 1, -4, 1, -1, -3, -1, -1, -3, -1, -1, -5, -1, -1, -1, -3, -1, -3, -1, -1, -6, -3, -6, -5, -1, -6, -1, 1, -1, -2, -3, -2, -2, -2, -2, -2, -1, -1, -4, -1, -1, -1, -1, -2, -2, -2, -1, -1, -4, -2, -5, -4, -1, -5, -1, 0, 0, -4, -2, 0, 0, -1, 0, 0, -3, -1, -1, -1, -3, -1, -3, -3, 0, 1, -2, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, 0, -2, -1, 0, 1, -1, 0, -1,
+    0, 1, -4, 0, -1, 1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -2, 0, -1, -6, -2, -2, -3, -3, -3, -3, -3, -3, -5, -3, -3, -3, -3, -3, -3, -3, -4, -4, -3, -5, -5, -5, -6, -3, 0, 0, -2, -3, -2, -2, -2, -4, -2, -3, -3, -6, -3, -2, -3, -3, -2, -4, -2, -3, -4, -4, -3, -4, -4, -5, -4, -3, 1, 0, -5, -2, 0, -1, -5, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, -1, -2, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -3, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -3,
+    0, 2, -3, -1, 0, 0, 1, -2, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -6, -1, -2, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -4, -3, -3, -2, -2, -3, -3, -3, -3, -3, 0, 1, -3, -2, -3, -3, -3, -4, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -3, -6, -3, -6, -5, -3, -6, -3, 1, 1, -4, -3, -1, 0, -3, -1, -1, -3, -3, -3, -3, -3, -3, -2, -2, -1, -1, -2, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, -1, -3, 1, 0, 0, 1, 0, -3,
+    0, 3, -5, -1, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -6, -3, -2, -2, -3, -3, -2, -3, -3, -7, -3, -3, -3, -2, -3, -2, -3, -5, -4, -3, -5, -4, -6, -5, -3, 0, 1, -3, -3, -2, -2, -2, -2, -2, -3, -3, -6, -3, -3, -3, -3, -2, -4, -2, -4, -4, -2, -2, -3, -3, -4, -3, -4, 1, 0, -5, -2, 0, -2, -6, -3, -4, -2, -3, -3, -3, -2, -2, -3, -3, 0, -1, -3, -3, -3, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 0, 1, 0, 0, 1, -1,
+    0, 2, -3, -1, 0, 0, 1, -3, 0, 0, -2, 0, 0, 0, -2, 0, -1, -1, -1, -1, -5, -1, -2, -4, -2, -2, -4, -2, -2, -3, -2, -2, -2, -4, -2, -4, -2, -3, -3, -3, -3, -3, -2, -3, -2, 1, 0, -3, -3, -4, -4, -4, -4, -4, -2, -2, -6, -2, -2, -2, -2, -4, -3, -4, -2, -3, -5, -4, -6, -5, -2, -6, -2, 0, 1, -4, -4, 0, -1, -3, -1, -1, -4, -2, -2, -2, -4, -2, -3, -3, 0, 0, -3, -3, -3, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3,
+    -1, 3, -6, -2, 0, 0, 1, -1, -7, -6, -1, -2, -1, -1, -4, -1, -1, 0, -2, -1, -4, -5, -2, -4, -3, -3, -4, -3, -3, -10, -4, -3, -4, -4, -4, -4, -4, -5, -2, -2, -2, -2, -3, -2, -4, 0, 1, -4, -2, -4, -4, -4, -4, -4, -4, -3, -6, -3, -3, -5, -4, -4, -5, -4, -5, -5, -4, -4, -4, -4, -5, -4, -5, 0, 1, -4, -4, -1, 0, -7, -5, -8, -4, -3, -3, -3, -4, -4, -2, -2, 0, -2, -2, -4, -4, -4, 0, 0, 0, 0, -1, -4, -4, -3, 0, 0, 0, -2, -4, 1, 0, -4, 0, 0, -2,
+    -1, 1, -4, 0, -2, 1, 0, -1, -2, -1, 0, -2, -2, -2, -1, -1, 0, -3, 0, -1, -6, -3, -2, -3, -3, -3, -3, -3, -3, -6, -3, -3, -3, -3, -3, -3, -3, -4, -5, -3, -6, -5, -5, -6, -4, 1, 0, -2, -3, -2, -2, -2, -4, -2, -3, -3, -6, -3, -2, -3, -3, -2, -4, -2, -3, -4, -5, -3, -5, -4, -5, -5, -4, 1, 0, -5, -2, 0, -1, -5, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, -1, -2, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -3, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -3,
+    0, 3, -3, 0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, -5, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -3, -3, -3, -3, -3, -2, -3, -2, 1, 1, -2, -3, -3, -3, -3, -3, -3, -2, -2, -6, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 1, 1, -4, -3, 0, 0, -3, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -2, -2, -2, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, 0, -3, 1, 1, 0, 1, 1, -2,
+    0, 2, -3, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -5, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -3, -3, -3, -3, -3, -2, -3, -2, 1, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -6, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -5, -3, 0, 0, -3, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    -1, 4, -5, -1, 0, 1, 2, -1, 0, 0, -1, -2, -1, -1, -2, -1, -1, -1, -2, -1, -7, -3, -2, -4, -3, -4, -3, -3, -3, -5, -4, -4, -4, -4, -4, -4, -4, -4, -2, -2, -2, -2, -3, -3, -4, 0, 2, -4, -2, -4, -4, -4, -3, -4, -4, -3, -6, -4, -3, -4, -4, -4, -4, -4, -4, -4, -3, -3, -3, -3, -4, -3, -4, 1, 2, -4, -4, -1, 0, -5, -3, -3, -4, -3, -3, -3, -4, -4, -2, -2, -1, -1, -2, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -3, 0, 0, 0, -1, -4, 2, 1, 0, 2, 1, -2,
+    0, 0, -4, -3, -2, 1, 0, -6, 0, 0, -3, 0, 0, -1, -5, 0, -3, -4, -2, -1, -6, -1, -2, -7, -2, -2, -7, -2, -2, -3, -2, -2, -2, -6, -2, -7, -3, -4, -5, -5, -5, -5, -2, -5, -2, 2, 0, -5, -5, -5, -5, -5, -4, -5, -2, -2, -6, -2, -2, -2, -2, -6, -3, -5, -2, -4, -6, -5, -7, -5, -2, -8, -2, 0, 0, -6, -5, 0, -2, -3, -1, -1, -7, -2, -2, -2, -6, -2, -5, -5, 0, 0, -5, -5, -5, -5, 0, 0, 0, 0, -1, -6, -5, -5, 0, 0, 0, 0, -6, 0, 0, 1, 0, 0, -3,
+    0, -3, -3, 0, -8, 1, 0, -8, 0, 0, -1, 0, 0, 0, -1, 0, 0, -4, 0, -1, -6, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -8, -3, -7, -5, -2, -8, -2, 1, -1, -2, -3, -2, -2, -2, -4, -2, -2, -2, -6, -2, -2, -2, -2, -2, -3, -2, -2, -2, -5, -3, -6, -4, -2, -6, -2, 0, 0, -6, -2, 0, -1, -3, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -3, 0, 0, 0, 0, -2, -4, -4, 0, -4, -4, -3,
+    0, 3, -4, -1, 0, 1, 1, 0, -1, 0, -1, -1, -1, -1, -2, -1, -1, 0, -1, -1, -6, -2, -2, -3, -3, -4, -3, -3, -3, -4, -4, -4, -4, -3, -4, -3, -4, -4, -2, -2, -2, -2, -3, -2, -3, 0, 1, -3, -2, -3, -3, -3, -3, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 1, 1, -4, -3, -1, 0, -4, -2, -2, -3, -3, -3, -3, -3, -3, -2, -2, 0, -1, -2, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, -1, -3, 1, 1, 0, 1, 1, -2,
+    0, 3, -5, -1, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -6, -3, -2, -2, -3, -3, -2, -3, -3, -6, -3, -3, -3, -2, -3, -2, -3, -5, -4, -3, -5, -4, -5, -6, -3, 1, 1, -3, -3, -2, -2, -2, -2, -2, -3, -3, -6, -3, -3, -3, -3, -2, -4, -2, -4, -4, -2, -2, -3, -3, -4, -3, -4, 1, 0, -5, -2, 0, -2, -6, -3, -4, -2, -3, -3, -3, -2, -2, -3, -3, 0, -1, -3, -3, -3, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 0, 2, 0, 0, 2, -1,
+    -1, 3, -5, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -4, -1, -1, 0, -1, 0, -7, -5, -2, -3, -3, -3, -3, -3, -3, -10, -4, -3, -4, -3, -3, -3, -3, -4, -3, -3, -4, -4, -6, -5, -6, 0, 1, -4, -3, -4, -4, -4, -2, -4, -3, -3, -6, -3, -3, -4, -3, -4, -4, -4, -4, -5, -3, -2, -2, -2, -4, -2, -4, 0, 0, -4, -4, -1, -1, -6, -5, -8, -3, -3, -3, -3, -3, -3, -3, -3, 0, -1, -3, -4, -4, -4, 0, 0, 0, 0, -1, -4, -4, -2, 0, 0, 0, -1, -4, 0, 1, -5, 1, 0, -1,
+    -2, 2, -6, -2, 0, 0, 0, -2, 0, 0, -2, -3, -2, -3, -3, -2, -2, -3, -2, -2, -8, -3, -4, -4, -5, -5, -4, -4, -5, -3, -5, -5, -5, -4, -5, -4, -5, -6, -5, -5, -6, -6, -5, -7, -5, 2, 1, -4, -5, -4, -4, -4, -4, -3, -5, -4, -3, -5, -4, -5, -5, -4, -3, -4, -5, -6, -4, -4, -4, -4, -5, -4, -5, 0, 1, -6, -4, -2, -3, -2, -3, -4, -4, -5, -5, -5, -4, -1, -5, -5, -2, -2, -4, -4, -4, -4, 0, 0, 0, 0, -1, -4, -4, -4, 0, 0, 0, -2, -4, 0, 1, 2, 0, 1, -3,
+    0, 1, -3, -1, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -2, 0, -2, -2, -1, -1, -6, -1, -2, -5, -2, -2, -5, -2, -2, -3, -2, -2, -2, -4, -2, -5, -2, -3, -5, -4, -6, -5, -3, -6, -2, 1, 0, -4, -4, -4, -4, -4, -4, -4, -2, -2, -6, -2, -2, -2, -2, -4, -3, -4, -2, -3, -5, -4, -4, -4, -2, -4, -2, 0, 0, -6, -4, 0, -1, -3, -1, -1, -5, -2, -2, -2, -4, -2, -4, -4, 0, 0, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3,
+    0, 0, -5, 0, -3, 1, 0, -2, 0, 0, 0, 0, -1, -1, -1, -1, 0, -4, 0, -1, -6, -2, -2, -3, -3, -3, -3, -3, -3, -6, -3, -3, -3, -3, -3, -3, -3, -4, -5, -3, -5, -5, -5, -5, -3, 1, 0, -2, -3, -2, -2, -2, -4, -2, -3, -3, -6, -3, -2, -3, -3, -2, -4, -2, -3, -4, -5, -3, -5, -4, -5, -5, -3, 1, 0, -6, -2, 0, -1, -6, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, -1, -2, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -3, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -3,
+    -1, 3, -5, -1, 0, 0, 1, -1, -6, -5, -2, -1, -1, -1, -7, -1, -2, 0, -2, -1, -3, -6, -2, -4, -3, -3, -4, -3, -3, -9, -4, -3, -4, -4, -3, -4, -4, -4, -2, -2, -2, -2, -3, -2, -4, 0, 1, -8, -2, -8, -8, -8, -4, -8, -3, -3, -6, -3, -3, -8, -8, -8, -9, -8, -8, -8, -6, -8, -8, -8, -8, -8, -8, 0, 1, -4, -7, -1, 0, -8, -6, -6, -4, -3, -3, -3, -4, -4, -2, -2, 0, -1, -2, -5, -8, -8, 0, 0, 0, 0, -4, -4, -8, -3, 0, 0, 0, -6, -8, 1, 0, -3, 1, 0, -3,
+    0, 3, -5, -1, 0, 1, 1, 0, 0, 0, -1, -1, -1, -1, -2, -1, -1, 0, -1, -1, -4, -3, -2, -3, -3, -4, -3, -3, -3, -5, -4, -4, -4, -3, -4, -3, -4, -4, -2, -2, -2, -2, -3, -2, -3, 0, 1, -3, -2, -3, -3, -3, -3, -3, -3, -3, -6, -3, -3, -4, -3, -3, -4, -3, -4, -4, -3, -3, -3, -3, -4, -3, -4, 1, 1, -4, -3, 0, 0, -5, -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, 0, -1, -2, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, -1, -3, 1, 1, 0, 1, 1, -1,
+    -1, 2, -6, -2, 0, 0, 2, -2, 0, 0, -3, -2, -2, -2, -5, -2, -3, -1, -3, -2, -4, -7, -2, -5, -3, -4, -5, -3, -3, -9, -5, -4, -4, -5, -4, -5, -4, -6, -2, -2, -2, -3, -3, -2, -4, 0, 1, -6, -2, -6, -6, -6, -4, -6, -4, -3, -6, -4, -3, -6, -5, -6, -6, -6, -5, -7, -5, -4, -4, -4, -6, -4, -6, 0, 1, -4, -6, -3, 0, -8, -7, -7, -5, -3, -3, -3, -5, -5, -2, -2, -1, -2, -2, -5, -6, -6, 0, 0, 0, 0, -3, -4, -6, -3, 0, 0, 0, -3, -6, 1, 0, -2, 1, 0, -3,
+    -1, 3, -6, -2, 0, 0, 2, -1, 0, 0, -2, -2, -1, -2, -4, -1, -2, -1, -2, -2, 0, -5, -2, -5, -3, -4, -4, -3, -3, -8, -4, -4, -4, -4, -4, -4, -4, -5, -2, -2, -3, -2, -3, -3, -4, 0, 1, -5, -2, -5, -5, -5, -4, -5, -4, -3, -6, -4, -3, -5, -5, -5, -5, -5, -5, -6, -4, -4, -4, -4, -5, -4, -6, 0, 1, -4, -5, -2, 0, -7, -5, -5, -5, -3, -3, -3, -4, -4, -2, -2, -1, -2, -2, -5, -5, -5, 0, 0, 0, 0, -2, -4, -5, -3, 0, 0, 0, -2, -5, 1, 0, -1, 1, 0, -3,
+    0, 2, -4, -2, -1, 1, 1, -4, 0, 0, -3, 0, 0, -1, -4, 0, -3, -2, -2, -1, -5, -1, -2, -6, -2, -2, -6, -2, -2, -3, -2, -2, -2, -5, -2, -6, -3, -4, -3, -3, -3, -3, -2, -3, -2, 1, 0, -4, -3, -5, -5, -5, -4, -5, -2, -2, -6, -2, -2, -2, -2, -5, -3, -5, -2, -3, -6, -5, -6, -5, -2, -7, -2, 0, 0, -4, -5, 0, -2, -3, -1, -1, -6, -2, -2, -2, -5, -2, -3, -3, 0, 0, -3, -4, -4, -5, 0, 0, 0, 0, -1, -4, -5, -4, 0, 0, 0, 0, -5, 0, 0, 1, 0, 0, -3,
+    -1, 2, -7, -3, 0, 0, 2, -3, 0, 0, -4, -3, -2, -2, -7, -2, -4, -1, -4, -3, -4, -6, -2, -6, -3, -4, -5, -3, -3, -9, -5, -4, -4, -6, -4, -6, -4, -6, -2, -2, -2, -3, -3, -2, -4, 0, 0, -7, -2, -7, -7, -7, -5, -7, -4, -4, -6, -4, -3, -7, -6, -7, -7, -7, -6, -8, -6, -5, -5, -5, -7, -5, -7, -1, 1, -4, -7, -3, -1, -8, -6, -6, -6, -3, -3, -3, -6, -6, -2, -2, -1, -3, -2, -5, -7, -7, 0, 0, 0, 0, -4, -4, -7, -3, 0, 0, 0, -4, -7, 1, 0, -2, 0, 0, -4,
+    0, 3, -4, -2, 0, 0, 1, -2, 0, 0, -2, -1, 0, -1, -3, 0, -2, 0, -2, -1, -4, -1, -2, -5, -3, -3, -4, -3, -3, -4, -3, -3, -3, -4, -3, -4, -3, -3, -2, -2, -2, -2, -3, -2, -3, 1, 1, -4, -2, -4, -4, -4, -4, -4, -3, -3, -6, -3, -3, -3, -3, -4, -4, -4, -3, -3, -6, -4, -4, -4, -3, -5, -3, 0, 1, -4, -4, -1, 0, -3, -1, -1, -5, -3, -3, -3, -4, -3, -2, -2, 0, -1, -2, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -3, 0, 0, 0, -1, -4, 1, 0, 0, 1, 0, -3,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, -1, 1, 0, 1, 0, 1, 1, 0, 2, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    1, 1, -3, -1, -1, 0, 0, -1, 0, 1, -1, 0, 1, 1, -1, 1, -1, -4, -1, 0, -6, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -8, -3, -6, -5, -2, -6, -2, 0, -1, -3, -4, -3, -3, -3, -3, -3, -2, -2, -5, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -4, -4, -2, -4, -2, 0, -1, -6, -3, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, -3, 1, 1, 1, 2, 1, -3, -3, -3, 1, 1, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    1, 1, -4, 0, -1, 1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -5, 0, -1, -6, -2, -2, -2, -2, -3, -3, -2, -3, -5, -3, -3, -3, -2, -3, -3, -3, -4, -8, -3, -6, -5, -5, -7, -2, 0, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -6, -2, -2, -3, -2, -2, -4, -2, -3, -4, -3, -3, -4, -4, -5, -4, -3, 1, -1, -5, -2, 0, -1, -5, -2, -3, -2, -3, -3, -3, -2, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 1, 1, -2, -2, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 1, -3, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -5, 0, -1, -4, -1, -1, -6, -1, -2, -4, -2, -2, -4, -2, -2, -3, -2, -2, -2, -4, -2, -4, -2, -3, -8, -4, -5, -5, -3, -6, -2, 0, -2, -4, -4, -4, -4, -4, -3, -4, -2, -2, -5, -2, -2, -2, -2, -4, -3, -4, -2, -2, -3, -3, -4, -4, -3, -3, -2, 0, -1, -6, -4, 0, -1, -3, -1, -1, -4, -2, -2, -2, -4, -3, -4, -4, 0, 0, -4, -4, -4, -4, 0, 0, 0, 2, 0, -4, -4, -3, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 2, -3, -1, 0, 0, 1, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -4, -1, -2, -3, -3, -3, -3, -3, -2, -4, -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 1, -3, -2, -3, -3, -3, -2, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -2, -2, -2, -3, -2, -3, 0, 1, -4, -3, 0, 0, -3, -1, -1, -3, -2, -2, -2, -3, -2, -2, -2, 0, -1, -2, -3, -3, -3, 4, 1, 4, 3, 1, -3, -3, -2, 2, 5, 1, 0, -3, 1, 0, 0, 1, 0, -1,
+    0, 1, -3, 0, -1, 1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -1, -6, -1, -2, -2, -3, -3, -2, -2, -3, -3, -3, -3, -3, -2, -3, -3, -3, -3, -8, -3, -6, -5, -3, -7, -3, 0, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -6, -2, -2, -2, -2, -2, -4, -2, -3, -2, -3, -2, -4, -4, -3, -4, -3, 1, -1, -5, -2, 0, -1, -3, -1, -1, -2, -3, -3, -3, -2, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 1, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    -1, 2, -4, -1, 0, 0, 1, 0, -3, -2, 0, -1, 0, -1, -3, 0, 0, 0, -1, 0, -6, -3, -2, -2, -3, -3, -2, -3, -3, -6, -3, -3, -3, -2, -3, -2, -3, -4, -2, -2, -3, -3, -4, -3, -4, 0, 0, -3, -2, -3, -3, -3, -2, -3, -3, -3, -6, -3, -2, -3, -3, -3, -4, -3, -3, -4, -2, -2, -2, -2, -4, -2, -4, 0, 0, -4, -3, -1, 0, -5, -3, -3, -2, -3, -3, -3, -2, -2, -2, -2, 0, -1, -2, -3, -3, -3, 3, 1, 3, 3, 1, -3, -3, -2, 2, 4, 0, 0, -3, 0, 1, -1, 0, 1, -1,
+    0, 2, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -4, 0, 0, -6, -1, -2, -2, -3, -3, -2, -3, -3, -4, -3, -3, -3, -2, -3, -2, -3, -3, -8, -2, -4, -4, -3, -5, -3, 0, 0, -2, -3, -2, -2, -2, -2, -2, -3, -3, -4, -3, -3, -3, -3, -2, -4, -2, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 0, -5, -2, 0, -1, -3, -1, -1, -2, -3, -3, -3, -2, -2, -2, -2, 0, -1, -2, -2, -2, -2, 0, 0, 0, 3, 1, -2, -2, -2, 0, 0, 1, -1, -2, 0, 1, 0, 0, 1, -1,
+    1, 2, -3, 0, -1, 0, 0, -1, 0, 1, -1, 0, 1, 1, -1, 1, -1, -4, 0, 0, -6, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -8, -3, -6, -5, -2, -7, -2, 0, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -5, -2, -2, -2, -2, -3, -3, -2, -2, -2, -3, -3, -4, -4, -2, -4, -2, 0, -1, -6, -2, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -2, -2, -2, -2, 1, 1, 1, 1, 1, -3, -3, -3, 1, 1, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    1, 2, -3, -1, 0, 0, 0, -1, 0, 1, -1, 0, 1, 1, -1, 1, -1, -1, -1, 0, -6, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -3, -3, -4, -4, -2, -4, -2, 0, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -5, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -4, -3, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, -3, 2, 1, 4, 3, 1, -3, -3, -3, 2, 4, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 2, -3, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, -3, -1, -2, -3, -3, -3, -2, -2, -2, -4, -3, -3, -3, -2, -3, -2, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 1, -2, -2, -2, -2, -2, -2, -2, -3, -2, -4, -3, -2, -3, -3, -2, -4, -2, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 1, -3, -2, 0, 0, -3, -1, -1, -3, -2, -2, -2, -2, -1, -2, -2, 0, -1, -2, -2, -2, -2, 2, 1, 4, 3, 1, -2, -2, -2, 3, 5, 1, 0, -2, 1, 1, 0, 1, 1, -1,
+    1, 0, -4, -3, -2, 0, 0, -5, 0, 0, -3, 0, 1, -1, -5, 1, -3, -4, -2, -1, 0, -1, -2, -6, -2, -2, -6, -2, -2, -3, -2, -2, -2, -6, -2, -6, -2, -4, -8, -5, -8, -6, -2, -8, -2, 1, -1, -5, -5, -5, -5, -5, -4, -5, -2, -2, -5, -2, -2, -2, -2, -5, -3, -5, -2, -4, -6, -5, -6, -5, -2, -6, -2, 0, 0, -6, -5, 0, -2, -2, -1, -1, -6, -2, -2, -2, -6, -2, -5, -5, 0, 0, -5, -5, -5, -5, 1, 1, 1, 1, -1, -5, -5, -5, 1, 1, 1, 0, -5, -1, 0, 0, 0, 0, -2,
+    0, 0, -3, -1, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, -4, 0, -1, -2, -1, 0, -6, -1, -2, -4, -2, -2, -4, -2, -2, -3, -2, -2, -2, -4, -2, -4, -2, -3, -5, -4, -5, -5, -2, -5, -2, 0, 0, -3, -4, -3, -3, -3, -4, -3, -2, -2, -5, -2, -2, -2, -2, -3, -3, -3, -2, -2, -5, -3, -5, -5, -2, -5, -2, 0, 0, -6, -3, 0, -1, -2, -1, -1, -4, -2, -2, -2, -4, -2, -4, -4, 0, 0, -3, -3, -3, -3, 2, 1, 2, 1, 1, -3, -3, -3, 1, 2, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 2, -3, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 1, -1, 1, 0, -4, 0, 0, -6, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -8, -3, -6, -5, -2, -7, -2, 0, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -2, -2, -3, -3, -4, -4, -2, -4, -2, 0, -1, -5, -2, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -2, -2, -2, -2, 1, 1, 1, 1, 1, -2, -2, -3, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -2,
+    1, 1, -3, 0, -1, 0, 0, -1, 0, 1, -1, 0, 1, 1, -1, 1, -1, -4, 0, 0, -6, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -8, -3, -6, -5, -2, -7, -2, 0, -2, -2, -3, -2, -3, -2, -3, -3, -2, -2, -5, -2, -2, -2, -2, -3, -3, -2, -2, -2, -3, -3, -4, -4, -2, -4, -2, 0, -1, -6, -2, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -2, -2, -2, -2, 1, 1, 1, 1, 1, -3, -3, -3, 1, 1, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 1, -4, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, -5, 0, -1, -6, -2, -2, -2, -3, -3, -2, -2, -3, -5, -3, -3, -3, -2, -3, -2, -3, -4, -8, -3, -6, -5, -5, -7, -3, 0, -1, -2, -3, -2, -2, -2, -3, -2, -3, -2, -6, -3, -2, -3, -3, -2, -4, -2, -3, -4, -3, -2, -4, -3, -5, -4, -4, 1, -1, -5, -2, 0, -1, -5, -2, -3, -2, -3, -3, -3, -2, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 1, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 1, -4, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -5, 0, -1, -6, -2, -2, -2, -2, -3, -2, -2, -3, -5, -3, -3, -3, -2, -3, -2, -3, -4, -8, -3, -6, -5, -5, -7, -2, 0, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -6, -2, -2, -3, -3, -2, -4, -2, -3, -4, -3, -2, -4, -4, -5, -4, -3, 1, -1, -5, -2, 0, -1, -5, -2, -3, -2, -3, -3, -3, -2, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 1, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    1, 0, -5, -2, -2, 0, 0, -2, 1, 1, -2, 0, 1, -1, -4, 1, -3, -4, -2, 0, -6, -1, -2, -5, -2, -2, -5, -2, -2, -3, -2, -2, -2, -5, -2, -5, -2, -5, -8, -5, -6, -6, -2, -7, -2, 0, 0, -4, -5, -5, -5, -5, -4, -3, -2, -2, -3, -2, -2, -2, -2, -5, -3, -4, -2, -3, -5, -4, -4, -4, -2, -3, -2, 0, 0, -6, -5, 0, -4, -2, -1, -1, -5, -2, -2, -2, -5, -1, -5, -5, 0, 0, -4, -4, -4, -5, 1, 1, 1, 1, -1, -5, -4, -4, 1, 1, 2, 0, -5, 0, 0, 1, 0, 0, -2,
+    -1, 2, -5, -1, 0, 0, 0, 0, -4, -3, 0, -1, -1, -3, -3, 0, 0, -6, -1, 0, -6, -4, -2, -2, -3, -3, -2, -3, -3, -7, -3, -3, -3, -2, -3, -2, -3, -4, -8, -3, -5, -4, -6, -5, -6, 0, -1, -3, -3, -3, -3, -3, -2, -3, -3, -3, -6, -3, -2, -3, -3, -2, -4, -3, -3, -4, -2, -2, -3, -3, -4, -3, -4, 0, 0, -5, -3, -2, -3, -6, -4, -4, -2, -3, -3, -3, -2, -2, -3, -3, 0, -1, -3, -3, -3, -3, 0, 0, 0, 3, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 1, -2, 0, 1, -1,
+    1, 1, -4, 0, -1, 1, 0, -3, 0, 1, -1, 0, -1, -1, -1, -1, 0, -5, 0, -1, -6, -2, -2, -3, -2, -2, -3, -2, -3, -5, -3, -2, -3, -3, -2, -3, -3, -3, -8, -3, -6, -5, -4, -7, -2, 0, -1, -2, -3, -2, -2, -2, -4, -2, -2, -2, -6, -2, -2, -3, -2, -2, -4, -2, -3, -3, -5, -3, -4, -4, -4, -4, -3, 1, 0, -5, -2, 0, -2, -5, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -2, -2, -2, -2, 1, 1, 1, 2, 1, -2, -2, -3, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 2, -3, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -3, 0, 0, -4, -1, 0, -6, -1, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -3, -6, -3, -5, -4, -2, -6, -2, 0, -1, -3, -3, -3, -3, -3, -2, -3, -2, -2, -6, -2, -2, -2, -2, -3, -3, -3, -2, -2, -2, -2, -3, -3, -2, -3, -2, 0, -1, -5, -3, 0, -1, -3, -1, -1, -2, -2, -2, -2, -2, -2, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 2, 0, -3, -3, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1,
+    1, 2, -3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, -1, 1, 0, -4, 0, 0, -6, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -8, -3, -5, -4, -2, -6, -2, 0, -1, -2, -3, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -3, -3, -3, -2, -3, -2, 0, -1, -5, -2, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -2, -2, -2, -2, 1, 1, 1, 3, 1, -2, -2, -3, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -1,
+    -1, 3, -4, -1, 0, 0, 0, 0, -4, -3, -1, -1, 0, -4, -4, -1, -1, -7, -1, 0, 0, -5, -2, -3, -3, -3, -3, -3, -3, -8, -4, -3, -3, -3, -3, -3, -3, -4, -8, -2, -4, -4, -7, -5, -6, 0, 0, -4, -3, -4, -4, -4, -2, -4, -3, -3, -6, -3, -3, -4, -3, -4, -4, -4, -3, -5, -3, -2, -2, -2, -4, -2, -4, 0, 0, -6, -4, -1, -2, -6, -5, -5, -3, -3, -3, -3, -3, -3, -2, -2, 0, -1, -4, -4, -4, -4, 0, 0, 0, 4, -1, -4, -4, -2, 0, 0, 0, -1, -4, 0, 0, -2, 0, 0, -1,
+    -1, 3, -4, -1, 0, 0, 0, 0, -3, -1, -1, -1, 0, -3, -2, -1, -1, -7, -1, 0, 0, -4, -2, -3, -3, -3, -3, -3, -3, -6, -4, -3, -3, -3, -3, -3, -3, -4, -8, -2, -4, -4, -5, -5, -4, 0, -1, -4, -3, -4, -4, -4, -2, -4, -3, -3, -6, -3, -3, -4, -3, -3, -4, -4, -3, -4, -3, -2, -2, -2, -4, -2, -4, 0, 0, -5, -4, -1, -2, -6, -4, -4, -3, -3, -3, -3, -3, -3, -2, -2, 0, -1, -4, -4, -4, -4, 0, 0, 0, 4, 0, -3, -3, -2, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -1,
+    0, 1, -4, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -4, 0, -1, -4, -2, 0, -6, -1, -2, -4, -2, -2, -3, -2, -2, -3, -2, -2, -2, -4, -2, -3, -2, -3, -8, -3, -5, -4, -2, -6, -2, 0, -2, -4, -3, -5, -5, -5, -3, -5, -2, -2, -5, -2, -2, -2, -2, -5, -3, -5, -2, -3, -4, -3, -3, -3, -2, -3, -2, 0, -1, -6, -5, 0, -1, -2, -1, -1, -4, -2, -2, -2, -4, -2, -3, -3, 0, 0, -4, -4, -4, -5, 0, 0, 0, 2, -1, -5, -5, -3, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, -2,
+    -1, 3, -4, -1, 0, 0, 0, -1, -3, -2, -1, -1, 0, -4, -3, -1, -1, -7, -1, 0, 0, -4, -2, -3, -3, -3, -3, -3, -3, -7, -4, -3, -3, -3, -3, -3, -3, -4, -8, -3, -4, -4, -6, -5, -5, 0, -1, -4, -3, -4, -4, -4, -2, -4, -3, -3, -6, -3, -3, -4, -3, -4, -4, -4, -3, -4, -3, -2, -2, -2, -4, -2, -4, 0, 0, -5, -4, -1, -2, -6, -4, -4, -3, -3, -3, -3, -3, -3, -3, -3, 0, -1, -4, -4, -4, -4, 0, 0, 0, 4, 0, -4, -4, -2, 0, 0, 0, -1, -4, 0, 0, -1, 0, 0, -1,
+    1, 2, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -4, 1, 0, -4, -1, 0, -6, -1, -2, -3, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -3, -8, -3, -5, -4, -2, -6, -2, 0, -1, -4, -3, -3, -4, -4, -2, -3, -2, -2, -5, -2, -2, -2, -2, -3, -3, -3, -2, -3, -2, -2, -3, -3, -2, -3, -2, 0, 0, -5, -3, 0, -1, -2, -1, -1, -3, -2, -2, -2, -2, -2, -3, -3, 0, 0, -4, -4, -4, -3, 1, 1, 1, 3, 0, -3, -3, -2, 1, 1, 1, 0, -3, 0, 1, 0, 0, 0, -1,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 0, 1, 0, 0, 0, -1, 1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, -6, -3, 0, 0, 0, -3, 0, 0, -3, -3, -2, -3, -4, -3, -3, -2, -3, -3, -4, -4, -5, -5, -5, -5, -5, -5, -5, -6, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, -5, -4, -5, -5, -5, -5, -5, -5, -5, -7, -5, -5, -5, -5, -5, -6, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, 0, 0, -6, -5, -3, -2, -5, -4, -4, -5, -5, -5, -5, -5, -5, -5, -5, 0, -3, -4, -5, -5, -5, 0, 0, 0, 0, 0, -5, -5, -5, 0, 0, 0, -3, -5, 0, 0, 0, 0, 0, -4,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -4, 0, -1, -3, -1, -1, -6, -1, -2, -4, -2, -2, -4, -2, -2, -3, -2, -2, -2, -4, -2, -4, -2, -3, -6, -4, -5, -5, -3, -6, -2, 0, 0, -4, -4, -4, -4, -4, -3, -4, -2, -2, -5, -2, -2, -2, -2, -4, -3, -4, -2, -2, -3, -3, -4, -4, -3, -3, -2, 0, 0, -6, -4, 0, -1, -3, -1, -1, -4, -2, -2, -2, -4, -3, -4, -4, 0, 0, -4, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -3, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -4, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -1, -1, -1, -2, -2, 0, -3, 0, 0, 0, -2, -1, -2, -2, -2, -1, -2, 0, 0, -3, 0, 0, 0, 0, -2, 0, -2, 0, -1, -3, -2, -4, -3, 0, -4, 0, 0, 0, -2, -2, 1, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, -1, -1, 0, 1, -1, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -5, -1, 0, -2, 0, -1, -2, 0, 0, -3, -1, -1, -1, -2, -1, -2, -1, -2, 0, 0, 0, 0, -2, -1, -2, 0, 0, -2, 0, -2, -2, -2, -2, -2, -1, 0, -3, -1, 0, -2, -2, -2, -3, -2, -2, -2, -4, -2, -2, -2, -3, -2, -2, 0, 0, -1, -2, 0, 1, -3, -1, -1, -2, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    -4, 0, -7, -4, 0, 0, 0, -3, 0, 0, -4, -4, -4, -5, -5, -4, -4, -9, -4, -4, -10, -6, -6, -6, -6, -6, -6, -6, -6, -8, -6, -6, -6, -6, -6, -6, -6, -7, -11, -6, -8, -7, -8, -8, -7, 0, 0, -6, -6, -6, -6, -6, -6, -6, -6, -6, -9, -6, -6, -6, -6, -6, -7, -6, -7, -7, -6, -6, -6, -6, -7, -5, -7, 0, 0, -8, -6, -3, -5, -3, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, 0, -4, -6, -6, -6, -6, 0, 0, 0, 0, 0, -6, -6, -6, 0, 0, 0, -4, -6, 0, 0, 0, 0, 0, -4,
+    0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -4, 0, -1, -3, -1, -1, -3, -1, -1, -1, -1, -1, -1, -3, -1, -3, -1, -1, -6, -3, -6, -5, -1, -6, -1, 0, 0, -2, -3, -2, -2, -2, -2, -2, -1, -1, -4, -1, -1, -1, -1, -2, -2, -2, -1, -1, -4, -2, -5, -4, -1, -5, -1, 0, 0, -4, -2, 0, 0, -1, 0, 0, -3, -1, -1, -1, -3, -1, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, -2, -1, -1, -2, -1, -1, -5, -1, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -2, -2, -2, -2, -2, -1, -1, -4, -1, -1, -1, -1, -2, -2, -2, -1, -1, -4, -2, -4, -4, -1, -4, -1, 0, 0, -2, -2, 0, 0, -1, 0, 0, -2, -1, -1, -1, -2, -1, -1, -1, 0, 0, -1, -1, -1, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -3, -1, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -6, -1, -2, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -4, -3, -3, -2, -2, -3, -3, -3, -3, -3, 0, 0, -3, -2, -3, -3, -3, -4, -3, -3, -3, -5, -3, -3, -3, -3, -3, -4, -3, -3, -3, -6, -3, -6, -5, -3, -6, -3, 0, 0, -4, -3, -1, 0, -3, -1, -1, -3, -3, -3, -3, -3, -3, -2, -2, 0, -1, -2, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -3,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -3, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -3, -3, -3, -3, -3, -2, -3, -2, 0, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -6, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -5, -3, 0, 0, -3, -1, -1, -3, -2, -2, 0, -3, -2, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -5, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -3, -3, -3, -3, -3, -2, -3, -2, 0, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -6, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -5, -3, 0, 0, -3, -1, -1, -3, 0, -2, 0, -3, -2, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -3, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -3, -3, -3, -3, -3, -2, -3, -2, 0, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -6, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -5, -3, 0, 0, -3, -1, -1, -3, 1, 0, 1, -3, -2, -2, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -5, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -6, -3, -2, -2, -3, -3, -2, -3, -3, -6, -3, -3, -3, -2, -3, -2, -3, -5, -4, -3, -5, -4, -5, -6, -3, 0, 0, -3, -3, -2, -2, -2, -2, -2, -3, -3, -6, -3, -3, -3, -3, -2, -4, -2, -4, -4, -2, -2, -3, -3, -4, -3, -4, 0, 0, -5, -2, 0, -2, -6, -3, -4, -2, -3, -3, -3, -2, -2, -3, -3, 0, -1, -3, -3, -3, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1,
+    5, 0, 0, 4, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 3, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 2, 1, 2, 2, 3, 2, 0, 1, 2, 1, 1, 0, 1, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 1, 2, 2, 1, 2, 1, 1, 2, 2, 2, 2, 0, 2, 1, 0, 0, 1, 2, 5, 3, 0, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 4, 2, 2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 3,
+    0, 0, -5, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -1, -1, 0, -1, -1, -4, -3, -2, -3, -3, -4, -3, -3, -3, -5, -4, -4, -4, -3, -4, -3, -4, -4, -2, -2, -2, -2, -3, -2, -3, 0, 0, -3, -2, -3, -3, -3, -3, -3, -3, -3, -6, -3, -3, -4, -3, -3, -4, -3, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 0, -4, -3, 0, 0, -5, -3, -3, -3, -3, -3, -3, -3, -3, -2, -2, 0, -1, -2, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -1,
+    0, 0, -5, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -1, -1, 0, -1, -1, -4, -3, -2, -3, -3, -4, -3, -3, -3, -5, -4, -4, -4, -3, -4, -3, -4, -4, -2, -2, -2, -2, -3, -2, -3, 0, 0, -3, -2, -3, -3, -3, -3, -3, -3, -3, -6, -3, -3, -4, -3, -3, -4, -3, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 0, -4, -3, 0, 0, -5, -3, -3, -3, -2, -3, -2, -3, -3, -2, -2, 0, -1, -2, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -1,
+    0, 2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -3, -1, 0, 0, -1, -1, 0, -1, -1, -7, -1, -1, -1, 0, -1, 0, -1, -3, -6, -1, -3, -2, -5, -5, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -4, -1, 0, -1, -1, 0, -2, 0, -1, -2, 0, 0, -2, -1, -4, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    1, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, -1, 0, -1, -2, -1, 0, -1, -1, 0, -1, 0, -1, -2, -1, -3, -3, -2, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, 0, -3, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 2, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -4, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -4, -3, -4, -4, -2, -4, -2, 0, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -5, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -4, -4, -2, -4, -2, 0, 0, -5, -3, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -4, -1, 0, -6, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -6, -3, -6, -5, -2, -6, -2, 0, 0, -3, -4, -3, -3, -3, -3, -3, -2, -2, -5, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -4, -4, -2, -4, -2, 0, 0, -6, -3, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -1, -6, -1, -2, -2, -3, -3, -2, -2, -3, -3, -3, -3, -3, -2, -3, -3, -3, -3, -8, -3, -6, -5, -3, -7, -3, 0, 0, -2, -3, -2, -2, -2, -3, -2, -2, -2, -6, -2, -2, -2, -2, -2, -4, -2, -3, -2, -3, -2, -4, -4, -3, -4, -3, 0, 0, -5, -2, 0, -1, -3, -1, -1, -2, -3, -3, -3, -2, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -5, 0, -1, -4, -1, -1, -6, -1, -2, -4, -2, -2, -4, -2, -2, -3, -2, -2, -2, -4, -2, -4, -2, -3, -8, -4, -5, -5, -3, -6, -2, 0, 0, -4, -4, -4, -4, -4, -3, -4, -2, -2, -4, -2, -2, -2, -2, -4, -3, -4, -2, -2, -3, -3, -4, -4, -3, -3, -2, 0, 0, -6, -4, 0, -1, -3, -1, -1, -4, -2, -2, -2, -4, -2, -4, -4, 0, 0, -4, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -3, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 1, 0, 1, 1, 2, 0, 1, 1, 0, 1, 0, 1, 0, 2, 2, 1, 1, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 2, 0, 1, 2, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, 1, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 3, 3, 1, 3, 3, 2, 2, 3, 2, 1, 3, 1, 2, 2, 3, 3, 3, 3, 2, 3, 1, 0, 0, 0, 4, 0, 0, 0, 2, 0, 3, 4, 1, 3, 4, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 2, 1, 2, 2, 2, 1, 2, 1, 1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 3, 1, 0, 0, 0, 3, 1, 1, 1, 3, 1, 2, 3, 0, 2, 3, 2, 2, 1, 2, 1, 2, 1, 3, 3, 4, 3, 2, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, -3, -2, 2, 1, 1, 1, 2, 1, 1, -5, 1, 1, 1, 1, 1, 2, 1, 0, -2, 2, 0, 1, -1, 0, -3, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 1, 1, 3, 4, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 1, -1, 1, 1, 0,
+    0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -3, -2, -2, -2, -3, -3, -2, -2, -3, -5, -3, -3, -3, -2, -3, -2, -3, -4, -3, -3, -3, -3, -3, -3, -3, 0, 0, -2, -2, -2, -2, -2, -3, -2, -3, -2, -6, -3, -2, -3, -3, -2, -4, -2, -3, -4, -3, -2, -4, -3, -5, -4, -4, 0, 0, -4, -2, 0, 0, -5, -2, -3, -2, -3, -3, -3, -2, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -2, 0, -1, -6, -2, -2, -2, -3, -3, -2, -2, -3, -5, -3, -3, -3, -2, -3, -2, -3, -4, -4, -3, -4, -4, -5, -5, -3, 0, 0, -2, -3, -2, -2, -2, -3, -2, -3, -2, -6, -3, -2, -3, -3, -2, -4, -2, -3, -4, -3, -2, -4, -3, -5, -4, -4, 0, 0, -5, -2, 0, -1, -5, -2, -3, -2, -3, -3, -3, -2, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -3, -1, -2, -3, -2, -2, -3, -2, -2, -3, -2, -2, -2, -3, -2, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -2, -3, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -3, -3, -3, -2, -3, -2, 0, 0, -4, -2, 0, 0, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 1, 0, 1, 2, 2, 0, 1, 0, 0, 1, 0, 1, 0, 2, 2, 2, 1, 1, 2, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 2, 0, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 3, 0, 3, 3, 2, 2, 3, 2, 0, 3, 0, 2, 1, 3, 3, 3, 3, 3, 3, 2, 0, 0, 0, 4, 0, 0, 0, 1, 0, 3, 3, 0, 3, 3, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -6, -1, -3, -2, 0, -4, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -3, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    4, 0, 1, 3, 0, 0, 0, 1, 0, 0, 2, 4, 4, 4, 2, 4, 2, 3, 3, 3, 0, 3, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 4, 3, 1, 3, 3, 0, 1, 1, 1, 0, 2, 1, 1, 0, 4, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 1,
+    3, 0, 0, 2, 0, 0, 0, 1, 0, 0, 2, 2, 2, 2, 1, 2, 2, 0, 2, 2, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 1, 1, -1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, 0, 1, 1, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 1, 1, 2, 1, 1, 1, 0, 1, 0, 1, 1, -2, 0, -1, 0, 1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 1, 1, -1, 0, 1, 1, 2, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, 0, 1, 1, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, -1, -2, -1, -1, -2, -1, -1, -2, -1, -1, -1, -2, -1, -2, -1, -1, -2, -2, -3, -2, -1, -3, -1, 0, 0, -2, -2, -2, -2, -2, -2, -2, -1, -1, -4, -1, -1, -1, -1, -2, -2, -2, -1, -1, -2, -2, -2, -2, -1, -2, -1, 0, 0, -3, -2, 0, 0, -1, 0, 0, -2, -1, -1, -1, -2, -1, -2, -2, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -1, 1, 0, 0, 0, 1, -3, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, -2, 0, 0, 0, -3, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair opendyslexic_10_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_10_bolditalic = {
     opendyslexic_10_bolditalicBitmaps,
     opendyslexic_10_bolditalicGlyphs,
     opendyslexic_10_bolditalicIntervals,
-    52,
+    53,
     38,
     28,
     -11,
     true,
+    opendyslexic_10_bolditalicKernLeftClasses,
+    128,
+    opendyslexic_10_bolditalicKernRightClasses,
+    124,
+    opendyslexic_10_bolditalicKernMatrix,
+    119,
+    115,
+    opendyslexic_10_bolditalicLigatures,
+    5,
 };
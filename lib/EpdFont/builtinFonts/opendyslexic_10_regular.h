@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_regularBitmaps[37668] = {
+static const uint8_t opendyslexic_10_regularBitmaps[38043] = {
     0x00, 0x40, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x0B,
     0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0F, 0xC0, 0x04, 0x00, 0x01, 0xF8, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0,
     0x2F, 0x87, 0xF0, 0xFD, 0x1F, 0xC3, 0xF4, 0x7F, 0x0F, 0xC1, 0xF4, 0x3F, 0x07, 0xE0, 0xFC, 0x2F,
@@ -2362,7 +2362,30 @@ static const uint8_t opendyslexic_10_regularBitmaps[37668] = {
     0x00, 0x6F, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x02, 0xFC,
     0x00, 0x00, 0x1B, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x06, 0xFF, 0xF9, 0x00, 0x0F, 0xFE, 0x40, 0x00,
     0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xF4, 0x1A, 0xFF, 0xFF, 0xE4,
-    0x3E, 0xA5, 0x00, 0x00,
+    0x3E, 0xA5, 0x00, 0x00, 0x00, 0x64, 0x01, 0xA0, 0x1F, 0xE0, 0x2F, 0xD0, 0xF0, 0x00, 0xE0, 0x03,
+    0x80, 0x07, 0x40, 0x0E, 0x00, 0x2C, 0x00, 0x38, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0xC0,
+    0x0B, 0xFD, 0x0F, 0x00, 0x2E, 0x00, 0x7C, 0x00, 0xB8, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0xC0, 0x0B,
+    0x80, 0x1F, 0x00, 0x2E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0xC0,
+    0x1F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x19, 0x0F, 0x80, 0x7F, 0x83, 0xF0, 0x3C, 0x00,
+    0x54, 0x0E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x70, 0xFF, 0xF8,
+    0x2C, 0x03, 0xC0, 0x0B, 0x01, 0xF0, 0x02, 0xC0, 0x7C, 0x00, 0xB0, 0x1F, 0x00, 0x2C, 0x07, 0xC0,
+    0x0F, 0x01, 0xF0, 0x03, 0xD0, 0x7C, 0x00, 0xF4, 0x1F, 0x00, 0x3E, 0x07, 0xC0, 0x0F, 0x80, 0x00,
+    0x64, 0x07, 0x40, 0x1F, 0xE0, 0x2D, 0x00, 0xF0, 0x00, 0xF0, 0x03, 0x80, 0x03, 0xC0, 0x0E, 0x00,
+    0x0F, 0x00, 0x38, 0x00, 0x3C, 0x0F, 0xFF, 0xC0, 0xF0, 0x3F, 0xFE, 0x03, 0xC0, 0x0F, 0x00, 0x1F,
+    0x00, 0x7C, 0x00, 0x7C, 0x01, 0xF0, 0x01, 0xF0, 0x07, 0xC0, 0x07, 0xC0, 0x1F, 0x00, 0x1F, 0x00,
+    0x7C, 0x00, 0x7C, 0x01, 0xF0, 0x01, 0xF5, 0x07, 0xC0, 0x07, 0xFD, 0x1F, 0x00, 0x1F, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0x64, 0x01, 0xA0, 0x7D, 0x07, 0xF8, 0x0B, 0xF4, 0xBE, 0x0F, 0x00,
+    0x0E, 0x00, 0x55, 0x0E, 0x00, 0x1D, 0x00, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x00, 0x0E, 0x00, 0x2C,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x3C, 0xFF, 0x00, 0x2F, 0xF4, 0x3C, 0x0F, 0x00, 0x2E, 0x00,
+    0x3C, 0x1F, 0x00, 0x2E, 0x00, 0x3C, 0x1F, 0x00, 0x2E, 0x00, 0x3C, 0x1F, 0x00, 0x2E, 0x00, 0x3C,
+    0x1F, 0x00, 0x2E, 0x00, 0x3C, 0x1F, 0x00, 0x3E, 0x00, 0x3C, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x1F,
+    0x00, 0x3F, 0x00, 0x7C, 0x1F, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x64, 0x01, 0xA0, 0x0B, 0x00, 0x1F,
+    0xE0, 0x2F, 0xD0, 0x3C, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xF0, 0x03, 0x80, 0x07, 0x40, 0x03, 0xC0,
+    0x0E, 0x00, 0x2C, 0x00, 0x1E, 0x00, 0x38, 0x00, 0xB0, 0x00, 0x78, 0x0F, 0xFF, 0xFF, 0xFF, 0x42,
+    0xE0, 0x3F, 0xC0, 0x0B, 0xFD, 0x0B, 0x40, 0x0F, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x7C, 0x00, 0xB8,
+    0x00, 0xB4, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x1F, 0x00,
+    0x3E, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xE5, 0x07,
+    0xC0, 0x0F, 0xC0, 0x0F, 0xFC, 0x1F, 0x00, 0x3F, 0x00, 0x3F, 0xF0,
 };
 
 static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
@@ -3071,6 +3094,11 @@ static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
     { 14, 18, 23, 5, 16, 63, 37477 }, // ≠
     { 16, 16, 18, 1, 15, 64, 37540 }, // ≤
     { 16, 16, 18, 1, 15, 64, 37604 }, // ≥
+    { 15, 17, 21, 3, 17, 64, 37668 }, // ﬀ
+    { 13, 18, 18, 3, 18, 59, 37732 }, // ﬁ
+    { 15, 17, 21, 3, 17, 64, 37791 }, // ﬂ
+    { 20, 18, 27, 3, 18, 90, 37855 }, // ﬃ
+    { 23, 17, 28, 3, 17, 98, 37945 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_10_regularIntervals[] = {
@@ -3126,15 +3154,94 @@ static const EpdUnicodeInterval opendyslexic_10_regularIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_10_regularKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 1 }, // "
+    { 0x23, 1 }, // #
+    { 0x27, 1 }, // '
+    { 0x28, 1 }, // (
+    { 0x29, 1 }, // )
+    { 0x2A, 1 }, // *
+    { 0x2C, 1 }, // ,
+    { 0x2D, 1 }, // -
+    { 0x2E, 1 }, // .
+    { 0x2F, 1 }, // /
+    { 0x3A, 1 }, // :
+    { 0x3B, 1 }, // ;
+    { 0x3F, 1 }, // ?
+    { 0x5B, 1 }, // [
+    { 0x5C, 1 }, // <backslash>
+    { 0x5D, 1 }, // ]
+    { 0x5F, 1 }, // _
+    { 0x7B, 1 }, // {
+    { 0x7D, 1 }, // }
+    { 0xA1, 1 }, // ¡
+    { 0xAB, 1 }, // «
+    { 0xAD, 1 }, // ­
+    { 0xB7, 1 }, // ·
+    { 0xBB, 1 }, // »
+    { 0xBF, 1 }, // ¿
+    { 0x2010, 1 }, // ‐
+    { 0x2011, 1 }, // ‑
+    { 0x2012, 1 }, // ‒
+    { 0x2013, 1 }, // –
+    { 0x2014, 1 }, // —
+    { 0x2015, 1 }, // ―
+    { 0x2016, 1 }, // ‖
+    { 0x2017, 1 }, // ‗
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 1 }, // ‚
+    { 0x201B, 1 }, // ‛
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 1 }, // „
+    { 0x201F, 1 }, // ‟
+    { 0x2022, 1 }, // •
+    { 0x2023, 1 }, // ‣
+    { 0x2024, 1 }, // ․
+    { 0x2025, 1 }, // ‥
+    { 0x2026, 1 }, // …
+    { 0x2027, 1 }, // ‧
+    { 0x2039, 1 }, // ‹
+    { 0x203A, 1 }, // ›
+};
+
+static const EpdKernClassEntry opendyslexic_10_regularKernRightClasses[] = {
+    { 0x20, 1 }, //  
+};
+
+static const int8_t opendyslexic_10_regularKernMatrix[1] = {
+    3,
+};
+
+static const EpdLigaturePair opendyslexic_10_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_10_regular = {
     opendyslexic_10_regularBitmaps,
     opendyslexic_10_regularGlyphs,
     opendyslexic_10_regularIntervals,
-    52,
+    53,
     38,
     28,
     -11,
     true,
+    opendyslexic_10_regularKernLeftClasses,
+    50,
+    opendyslexic_10_regularKernRightClasses,
+    1,
+    opendyslexic_10_regularKernMatrix,
+    1,
+    1,
+    opendyslexic_10_regularLigatures,
+    5,
 };
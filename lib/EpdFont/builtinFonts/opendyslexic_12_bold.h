@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_boldBitmaps[61397] = {
+static const uint8_t opendyslexic_12_boldBitmaps[62076] = {
     0x00, 0x00, 0x02, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF0,
     0x07, 0xF0, 0x07, 0xF0, 0x0B, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
     0x0F, 0xF0, 0x03, 0xF0, 0x00, 0xB0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3845,7 +3845,49 @@ static const uint8_t opendyslexic_12_boldBitmaps[61397] = {
     0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
     0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0xC0, 0x05,
     0xAF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE9, 0x40, 0x03,
-    0xE9, 0x50, 0x00, 0x00, 0x00,
+    0xE9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0,
+    0x1F, 0xFF, 0x00, 0xFF, 0xF4, 0x0B, 0xFF, 0xC0, 0x7F, 0xFD, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00,
+    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xBF, 0xEA, 0xAB, 0xFE, 0xA4, 0x1F,
+    0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
+    0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
+    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x0B, 0xFC,
+    0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0x0B, 0xFC, 0x01, 0xFF, 0xF0, 0xFF, 0xC0,
+    0x2F, 0xFF, 0x0F, 0xFD, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x3F, 0x87, 0xFF, 0xFF, 0x03, 0xF4, 0x2B,
+    0xFE, 0xA0, 0x3F, 0x40, 0x7F, 0x80, 0x03, 0xF4, 0x07, 0xF8, 0x00, 0x3F, 0x40, 0x7F, 0x80, 0x03,
+    0xF4, 0x07, 0xFC, 0x00, 0x3F, 0x40, 0x7F, 0xC0, 0x03, 0xF4, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x7F,
+    0xC0, 0x03, 0xF8, 0x0B, 0xFC, 0x00, 0x3F, 0x80, 0xBF, 0xC0, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0x7F,
+    0xC0, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0xFC, 0x03, 0xF8, 0x00,
+    0x1F, 0xFF, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0x40, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
+    0xFC, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x01, 0xFD, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0x7F,
+    0xFF, 0xF0, 0x1F, 0xC0, 0x1F, 0xFF, 0xFC, 0x07, 0xF0, 0x02, 0xBF, 0xEA, 0x01, 0xFC, 0x00, 0x1F,
+    0xE0, 0x00, 0xBF, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F,
+    0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xC0, 0x01, 0xFF,
+    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x50, 0x2F, 0xF0, 0x00, 0xFF, 0xFC, 0x0B, 0xFC,
+    0x00, 0x3F, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0xBF,
+    0xE0, 0x07, 0xFF, 0x0F, 0xFC, 0x02, 0xFF, 0xE0, 0x1F, 0xFF, 0x0F, 0xFC, 0x03, 0xFF, 0xE0, 0x3F,
+    0xFF, 0x0F, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00,
+    0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF4, 0x6F, 0xFA, 0xAA,
+    0xFF, 0xEA, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x7F, 0x80, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0x7F, 0x80,
+    0x03, 0xF4, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xF4, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xF4,
+    0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xF4, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xF4, 0x0F, 0xF4,
+    0x00, 0xBF, 0x80, 0x07, 0xF4, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x07, 0xF8, 0x0F, 0xF4, 0x00, 0xBF,
+    0xC0, 0x07, 0xF8, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFD, 0x02, 0xFC,
+    0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF4, 0x0B, 0xF0, 0x00, 0xBF, 0xFC, 0x07, 0xFF, 0xD0, 0x2F, 0x80,
+    0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00,
+    0x3F, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xF4, 0x02, 0xBF,
+    0xEA, 0xAB, 0xFE, 0xA4, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x07, 0xF8,
+    0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0xC0,
+    0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xFC, 0x00,
+    0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0xC0, 0x03,
+    0xFC, 0x00, 0x1F, 0xE5, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xFC, 0x0B, 0xFC, 0x00, 0x7F,
+    0xD0, 0x02, 0xFF, 0xF4, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xFF, 0xE0,
 };
 
 static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
@@ -4554,6 +4596,11 @@ static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
     { 19, 22, 31, 6, 20, 105, 61060 }, // ≠
     { 21, 21, 20, -1, 18, 111, 61165 }, // ≤
     { 22, 22, 22, 0, 19, 121, 61276 }, // ≥
+    { 21, 22, 27, 3, 22, 116, 61397 }, // ﬀ
+    { 18, 24, 24, 3, 24, 108, 61513 }, // ﬁ
+    { 21, 22, 27, 3, 22, 116, 61621 }, // ﬂ
+    { 28, 24, 33, 4, 24, 168, 61737 }, // ﬃ
+    { 31, 22, 37, 3, 22, 171, 61905 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_12_boldIntervals[] = {
@@ -4609,15 +4656,94 @@ static const EpdUnicodeInterval opendyslexic_12_boldIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_12_boldKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 1 }, // "
+    { 0x23, 1 }, // #
+    { 0x27, 1 }, // '
+    { 0x28, 1 }, // (
+    { 0x29, 1 }, // )
+    { 0x2A, 1 }, // *
+    { 0x2C, 1 }, // ,
+    { 0x2D, 1 }, // -
+    { 0x2E, 1 }, // .
+    { 0x2F, 1 }, // /
+    { 0x3A, 1 }, // :
+    { 0x3B, 1 }, // ;
+    { 0x3F, 1 }, // ?
+    { 0x5B, 1 }, // [
+    { 0x5C, 1 }, // <backslash>
+    { 0x5D, 1 }, // ]
+    { 0x5F, 1 }, // _
+    { 0x7B, 1 }, // {
+    { 0x7D, 1 }, // }
+    { 0xA1, 1 }, // ¡
+    { 0xAB, 1 }, // «
+    { 0xAD, 1 }, // ­
+    { 0xB7, 1 }, // ·
+    { 0xBB, 1 }, // »
+    { 0xBF, 1 }, // ¿
+    { 0x2010, 1 }, // ‐
+    { 0x2011, 1 }, // ‑
+    { 0x2012, 1 }, // ‒
+    { 0x2013, 1 }, // –
+    { 0x2014, 1 }, // —
+    { 0x2015, 1 }, // ―
+    { 0x2016, 1 }, // ‖
+    { 0x2017, 1 }, // ‗
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 1 }, // ‚
+    { 0x201B, 1 }, // ‛
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 1 }, // „
+    { 0x201F, 1 }, // ‟
+    { 0x2022, 1 }, // •
+    { 0x2023, 1 }, // ‣
+    { 0x2024, 1 }, // ․
+    { 0x2025, 1 }, // ‥
+    { 0x2026, 1 }, // …
+    { 0x2027, 1 }, // ‧
+    { 0x2039, 1 }, // ‹
+    { 0x203A, 1 }, // ›
+};
+
+static const EpdKernClassEntry opendyslexic_12_boldKernRightClasses[] = {
+    { 0x20, 1 }, //  
+};
+
+static const int8_t opendyslexic_12_boldKernMatrix[1] = {
+    4,
+};
+
+static const EpdLigaturePair opendyslexic_12_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_12_bold = {
     opendyslexic_12_boldBitmaps,
     opendyslexic_12_boldGlyphs,
     opendyslexic_12_boldIntervals,
-    52,
+    53,
     46,
     33,
     -13,
     true,
+    opendyslexic_12_boldKernLeftClasses,
+    50,
+    opendyslexic_12_boldKernRightClasses,
+    1,
+    opendyslexic_12_boldKernMatrix,
+    1,
+    1,
+    opendyslexic_12_boldLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_bolditalicBitmaps[74335] = {
+static const uint8_t opendyslexic_12_bolditalicBitmaps[75077] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00,
     0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40,
     0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
@@ -4653,7 +4653,54 @@ static const uint8_t opendyslexic_12_bolditalicBitmaps[74335] = {
     0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00,
     0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x04,
     0x00, 0x00, 0x00, 0x05, 0xAF, 0xFD, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xA9, 0x40, 0x00, 0x7A, 0x94, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xA9, 0x40, 0x00, 0x7A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0xC0, 0xBF,
+    0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x00,
+    0x03, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF5, 0xB0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0A, 0xFF, 0xAA, 0xAF, 0xFA, 0x90, 0x02, 0xFD, 0x00, 0x1F, 0xE0,
+    0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x00,
+    0x3F, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0x1F,
+    0xF0, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00,
+    0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F,
+    0xFD, 0x0B, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x2F, 0xF8, 0x00, 0x1F,
+    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F,
+    0xF1, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x0F, 0x90, 0x00, 0xFF, 0xFF, 0xD0, 0xFC, 0x00, 0x0A,
+    0xFF, 0xA8, 0x1F, 0xC0, 0x00, 0x2F, 0xD0, 0x02, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x00,
+    0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xE0, 0x00,
+    0x0F, 0xF4, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xF0, 0x03, 0xFC, 0x00,
+    0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80,
+    0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xFD,
+    0x02, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x2F, 0xD0,
+    0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x5B, 0x01, 0xFC, 0x00, 0xBF, 0xFF,
+    0xE0, 0x3F, 0xC0, 0x0F, 0xFF, 0xFD, 0x03, 0xF8, 0x00, 0xAF, 0xFA, 0x80, 0x7F, 0x00, 0x02, 0xFD,
+    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x7F,
+    0x80, 0x02, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F,
+    0xF0, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF5, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0xF8, 0x03,
+    0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x7F, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x1F, 0xFF,
+    0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0x40, 0xFF, 0xFA, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x0B, 0xF4, 0x00,
+    0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF1, 0xA0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0x00, 0x06, 0xFF, 0xAA, 0xAF, 0xFA, 0xAB, 0xF0, 0x00,
+    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00,
+    0xBF, 0x40, 0x07, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0x80, 0x00, 0x0F,
+    0xF0, 0x00, 0xFF, 0x40, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x03, 0xFE,
+    0x00, 0x1F, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
+    0x03, 0xFD, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x00,
+    0xBF, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFE, 0x01, 0xFD, 0x00, 0x07, 0xFF,
+    0xC0, 0x3F, 0xFD, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x03, 0xF8, 0x00, 0x2F, 0xC0,
+    0x01, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xFF,
+    0xFF, 0xF9, 0xB0, 0x0F, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xC0, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xC0, 0x0A, 0xFF, 0xAA, 0xAF, 0xFA, 0x90, 0x3F, 0x40, 0x02, 0xFD, 0x00,
+    0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
+    0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x0B, 0xF4, 0x00,
+    0x7F, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x00,
+    0xFF, 0x40, 0x07, 0xF4, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x0B, 0xF5, 0x40, 0x3F, 0xE0, 0x02,
+    0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xC0, 0x03,
+    0xFD, 0x00, 0x1F, 0xFF, 0x80,
 };
 
 static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
@@ -5362,6 +5409,11 @@ static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
     { 23, 22, 32, 5, 20, 127, 73950 }, // ≠
     { 24, 21, 20, -3, 18, 126, 74077 }, // ≤
     { 24, 22, 22, 0, 19, 132, 74203 }, // ≥
+    { 24, 21, 27, 3, 21, 126, 74335 }, // ﬀ
+    { 22, 25, 24, 3, 24, 138, 74461 }, // ﬁ
+    { 22, 21, 27, 3, 21, 116, 74599 }, // ﬂ
+    { 31, 25, 33, 3, 24, 194, 74715 }, // ﬃ
+    { 32, 21, 37, 3, 21, 168, 74909 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_12_bolditalicIntervals[] = {
@@ -5417,15 +5469,414 @@ static const EpdUnicodeInterval opendyslexic_12_bolditalicIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_12_bolditalicKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x24, 3 }, // $
+    { 0x26, 4 }, // &
+    { 0x27, 5 }, // '
+    { 0x28, 6 }, // (
+    { 0x29, 7 }, // )
+    { 0x2A, 8 }, // *
+    { 0x2C, 9 }, // ,
+    { 0x2E, 10 }, // .
+    { 0x30, 11 }, // 0
+    { 0x31, 12 }, // 1
+    { 0x32, 13 }, // 2
+    { 0x33, 14 }, // 3
+    { 0x34, 15 }, // 4
+    { 0x35, 16 }, // 5
+    { 0x36, 17 }, // 6
+    { 0x37, 18 }, // 7
+    { 0x38, 19 }, // 8
+    { 0x39, 11 }, // 9
+    { 0x3F, 20 }, // ?
+    { 0x41, 21 }, // A
+    { 0x42, 22 }, // B
+    { 0x43, 23 }, // C
+    { 0x44, 24 }, // D
+    { 0x45, 25 }, // E
+    { 0x46, 26 }, // F
+    { 0x47, 27 }, // G
+    { 0x48, 28 }, // H
+    { 0x49, 29 }, // I
+    { 0x4A, 30 }, // J
+    { 0x4B, 31 }, // K
+    { 0x4C, 32 }, // L
+    { 0x4D, 33 }, // M
+    { 0x4E, 34 }, // N
+    { 0x4F, 35 }, // O
+    { 0x50, 36 }, // P
+    { 0x51, 37 }, // Q
+    { 0x52, 38 }, // R
+    { 0x53, 39 }, // S
+    { 0x54, 40 }, // T
+    { 0x55, 41 }, // U
+    { 0x56, 42 }, // V
+    { 0x57, 43 }, // W
+    { 0x58, 44 }, // X
+    { 0x59, 45 }, // Y
+    { 0x5A, 46 }, // Z
+    { 0x5B, 47 }, // [
+    { 0x5D, 48 }, // ]
+    { 0x61, 49 }, // a
+    { 0x62, 50 }, // b
+    { 0x63, 51 }, // c
+    { 0x64, 52 }, // d
+    { 0x65, 53 }, // e
+    { 0x66, 54 }, // f
+    { 0x67, 55 }, // g
+    { 0x68, 56 }, // h
+    { 0x69, 57 }, // i
+    { 0x6A, 58 }, // j
+    { 0x6B, 59 }, // k
+    { 0x6C, 60 }, // l
+    { 0x6D, 61 }, // m
+    { 0x6E, 62 }, // n
+    { 0x6F, 63 }, // o
+    { 0x70, 64 }, // p
+    { 0x71, 65 }, // q
+    { 0x72, 66 }, // r
+    { 0x73, 67 }, // s
+    { 0x74, 68 }, // t
+    { 0x75, 69 }, // u
+    { 0x76, 70 }, // v
+    { 0x77, 71 }, // w
+    { 0x78, 72 }, // x
+    { 0x79, 73 }, // y
+    { 0x7A, 74 }, // z
+    { 0x7B, 75 }, // {
+    { 0x7D, 76 }, // }
+    { 0xA1, 77 }, // ¡
+    { 0xA2, 78 }, // ¢
+    { 0xA3, 79 }, // £
+    { 0xA5, 80 }, // ¥
+    { 0xBF, 81 }, // ¿
+    { 0xC1, 82 }, // Á
+    { 0xC4, 82 }, // Ä
+    { 0xC5, 82 }, // Å
+    { 0xC6, 83 }, // Æ
+    { 0xC7, 84 }, // Ç
+    { 0xCC, 85 }, // Ì
+    { 0xCD, 86 }, // Í
+    { 0xCE, 87 }, // Î
+    { 0xCF, 88 }, // Ï
+    { 0xD3, 89 }, // Ó
+    { 0xD6, 90 }, // Ö
+    { 0xD8, 91 }, // Ø
+    { 0xD9, 92 }, // Ù
+    { 0xDB, 92 }, // Û
+    { 0xDC, 93 }, // Ü
+    { 0xDE, 94 }, // Þ
+    { 0xDF, 95 }, // ß
+    { 0xE4, 96 }, // ä
+    { 0xE5, 97 }, // å
+    { 0xE6, 98 }, // æ
+    { 0xE7, 99 }, // ç
+    { 0xEC, 100 }, // ì
+    { 0xED, 101 }, // í
+    { 0xEE, 102 }, // î
+    { 0xEF, 103 }, // ï
+    { 0xF0, 104 }, // ð
+    { 0xF6, 105 }, // ö
+    { 0xF8, 106 }, // ø
+    { 0xFC, 107 }, // ü
+    { 0x128, 87 }, // Ĩ
+    { 0x129, 108 }, // ĩ
+    { 0x12A, 87 }, // Ī
+    { 0x12B, 109 }, // ī
+    { 0x12F, 110 }, // į
+    { 0x130, 87 }, // İ
+    { 0x131, 111 }, // ı
+    { 0x152, 112 }, // Œ
+    { 0x153, 113 }, // œ
+    { 0x2018, 114 }, // ‘
+    { 0x2019, 115 }, // ’
+    { 0x201A, 116 }, // ‚
+    { 0x201C, 117 }, // “
+    { 0x201D, 118 }, // ”
+    { 0x201E, 116 }, // „
+    { 0xFB01, 119 }, // ﬁ
+    { 0xFB02, 120 }, // ﬂ
+};
+
+static const EpdKernClassEntry opendyslexic_12_bolditalicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x24, 3 }, // $
+    { 0x26, 4 }, // &
+    { 0x27, 5 }, // '
+    { 0x28, 6 }, // (
+    { 0x29, 7 }, // )
+    { 0x2A, 8 }, // *
+    { 0x2C, 9 }, // ,
+    { 0x2E, 10 }, // .
+    { 0x30, 11 }, // 0
+    { 0x31, 12 }, // 1
+    { 0x32, 13 }, // 2
+    { 0x33, 14 }, // 3
+    { 0x34, 15 }, // 4
+    { 0x35, 16 }, // 5
+    { 0x36, 17 }, // 6
+    { 0x37, 18 }, // 7
+    { 0x38, 19 }, // 8
+    { 0x39, 20 }, // 9
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 25 }, // D
+    { 0x45, 26 }, // E
+    { 0x46, 27 }, // F
+    { 0x47, 28 }, // G
+    { 0x48, 29 }, // H
+    { 0x49, 30 }, // I
+    { 0x4A, 31 }, // J
+    { 0x4B, 32 }, // K
+    { 0x4C, 33 }, // L
+    { 0x4D, 34 }, // M
+    { 0x4E, 35 }, // N
+    { 0x4F, 36 }, // O
+    { 0x50, 37 }, // P
+    { 0x51, 38 }, // Q
+    { 0x52, 39 }, // R
+    { 0x53, 40 }, // S
+    { 0x54, 41 }, // T
+    { 0x55, 42 }, // U
+    { 0x56, 43 }, // V
+    { 0x57, 44 }, // W
+    { 0x58, 45 }, // X
+    { 0x59, 46 }, // Y
+    { 0x5A, 47 }, // Z
+    { 0x5B, 48 }, // [
+    { 0x5D, 49 }, // ]
+    { 0x61, 50 }, // a
+    { 0x62, 51 }, // b
+    { 0x63, 52 }, // c
+    { 0x64, 53 }, // d
+    { 0x65, 54 }, // e
+    { 0x66, 55 }, // f
+    { 0x67, 56 }, // g
+    { 0x68, 57 }, // h
+    { 0x69, 58 }, // i
+    { 0x6A, 59 }, // j
+    { 0x6B, 60 }, // k
+    { 0x6C, 61 }, // l
+    { 0x6D, 62 }, // m
+    { 0x6E, 63 }, // n
+    { 0x6F, 64 }, // o
+    { 0x70, 65 }, // p
+    { 0x71, 66 }, // q
+    { 0x72, 67 }, // r
+    { 0x73, 68 }, // s
+    { 0x74, 69 }, // t
+    { 0x75, 70 }, // u
+    { 0x76, 71 }, // v
+    { 0x77, 72 }, // w
+    { 0x78, 73 }, // x
+    { 0x79, 74 }, // y
+    { 0x7A, 75 }, // z
+    { 0x7B, 76 }, // {
+    { 0x7D, 77 }, // }
+    { 0xA1, 78 }, // ¡
+    { 0xA2, 79 }, // ¢
+    { 0xA3, 80 }, // £
+    { 0xA5, 81 }, // ¥
+    { 0xBF, 82 }, // ¿
+    { 0xC1, 83 }, // Á
+    { 0xC4, 83 }, // Ä
+    { 0xC5, 83 }, // Å
+    { 0xC6, 84 }, // Æ
+    { 0xC7, 85 }, // Ç
+    { 0xCC, 86 }, // Ì
+    { 0xCD, 87 }, // Í
+    { 0xCF, 88 }, // Ï
+    { 0xD3, 89 }, // Ó
+    { 0xD6, 89 }, // Ö
+    { 0xD8, 90 }, // Ø
+    { 0xD9, 91 }, // Ù
+    { 0xDB, 92 }, // Û
+    { 0xDC, 91 }, // Ü
+    { 0xDE, 93 }, // Þ
+    { 0xDF, 94 }, // ß
+    { 0xE4, 95 }, // ä
+    { 0xE5, 96 }, // å
+    { 0xE6, 97 }, // æ
+    { 0xE7, 98 }, // ç
+    { 0xEC, 99 }, // ì
+    { 0xED, 100 }, // í
+    { 0xEE, 101 }, // î
+    { 0xEF, 102 }, // ï
+    { 0xF0, 103 }, // ð
+    { 0xF6, 104 }, // ö
+    { 0xF8, 105 }, // ø
+    { 0xFC, 106 }, // ü
+    { 0x129, 107 }, // ĩ
+    { 0x12B, 108 }, // ī
+    { 0x12F, 109 }, // į
+    { 0x131, 110 }, // ı
+    { 0x152, 89 }, // Œ
+    { 0x153, 111 }, // œ
+    { 0x2018, 112 }, // ‘
+    { 0x2019, 113 }, // ’
+    { 0x201A, 114 }, // ‚
+    { 0x201C, 115 }, // “
+    { 0x201D, 116 }, // ”
+    { 0x201E, 114 }, // „
+    { 0xFB01, 117 }, // ﬁ
+    { 0xFB02, 117 }, // ﬂ
+};
+
+static const int8_t opendyslexic_12_bolditalicKernMatrix[14040] = {
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -6, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, -2, -2, -2, -2, -3, -2, -2, -2, -8, -3, -3, -2, -3, -2, -3, -2, -3, -4, -2, -2, -2, -1, -3, -2, -4, -4, -2, -4, -2, -4, -4, -4, -3, -4, -4, -3, -6, -4, -3, -4, -4, -4, -4, -4, -4, -4, -2, -3, -3, -3, -5, -2, -5, -6, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, -2, -3, 0,
+    0, 0, -6, -1, 0, 0, 0, -4, 0, 0, -1, -1, -2, -2, -2, -2, -1, -4, -1, -2, -7, -3, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -4, -4, -4, -5, -6, -4, -7, -7, -6, -8, -4, 0, 0, -3, -4, -3, -3, -3, -5, -3, -4, -4, -7, -4, -3, -4, -4, -3, -5, -3, -4, -5, -6, -4, -7, -6, -6, -7, -4, 0, 0, -7, -3, -1, -2, -7, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -4,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -4, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, -1, -1, -1, 0, -1, 0, -1, -1, -6, -1, -4, -3, -2, -6, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2, 0, -1, -1, -4, 0, -3, -2, -2, -3, -1, 0, 0, -4, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -6, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, -2, 0, -2, 0, -2, -2, -2, 0, -2, -1, 0, -4, -1, -1, -2, -1, -2, -2, -2, -2, -2, 0, -1, 0, 0, -2, 0, -3, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -1, -1, 2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 1, 0, 0, 1, 1, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2, 3, 1, 2, 0, 0, 0, -1, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 2, 2, 1, 1, 2, 1, 0, 2, 1, 1, 1, 1, 2, 1, 2, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -5, -2, 0, 0, 0, 0, 0, 0, 0, 0, -9, -1, 0, 0, -1, 0, -1, 0, -1, -3, -1, 0, -2, -2, -4, -3, -4, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -4, 0, 0, -1, 0, 0, -2, -1, -1, -2, 0, 0, -1, 0, -4, -1, -2, 0, 0, -3, -1, 0, 0, -4, -2, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -4, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, -3, 0, -3, -2, 0, -4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -1, -1, 0, 0, -1, -4, -1, -1, -1, -1, 0, -1, 0, -1, -2, -2, -1, -3, -2, -3, -4, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -4, -1, 0, -1, -1, 0, -2, 0, -1, -2, 0, 0, -1, -1, -2, -1, -2, 1, 0, -4, 0, 0, 0, -4, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 1, -3, 1, 0, -2, 0, 0, -4, 2, 0, -2, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, -4, -1, -5, -4, 0, -6, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, 0, 0, -1, -1, 0, 0, 0, -4, -1, -4, -3, 0, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -1, 1, 0, 0, 0, 0, -4, 2, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, -1, -3, -2, 0, -4, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 1, 0, -4, 1, 0, 1, 1, -1, -1, -1, 1, 0, -1, 0, -1, -1, 1, 0, 1, 0, 0, -4, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 2, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, -1, -1, 0, -1, -3, -1, -1, 0, -1, -1, -1, -1, -1, -2, -2, -1, -3, -2, -3, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -2, -1, 0, 0, 0, -2, 0, -1, 1, 0, -4, 0, 0, 0, -3, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, -1, 0, 0, -1, 0, -1, 0, -1, -2, -3, -1, -4, -3, -2, -4, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -2, -2, 0, -3, -2, -2, -3, -2, 1, 0, -4, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, -1, -1, 0, -1, -3, -1, -1, 0, -1, -1, -1, -1, -1, -2, -2, -1, -2, -2, -3, -3, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -2, -4, -1, -4, -2, -3, -4, -1, 1, 0, -3, 0, 0, 0, -3, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, -1, -1, 0, -1, -4, -1, -1, 0, -1, -1, -1, -1, -1, -2, -2, -1, -2, -2, -3, -2, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -2, -2, -1, -3, -2, -3, -3, -1, 1, 0, -3, 0, 0, 0, -4, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -6, -1, 0, -2, 0, -1, -1, -1, -1, 0, -4, -2, -1, -1, -2, -1, -1, -1, -2, -3, 0, 0, -1, -1, -3, -2, -2, 0, 1, -2, 0, -2, -2, -2, -1, -2, -1, -1, -4, -1, -1, -2, -2, -2, -2, -2, -2, -3, -1, -1, -1, -1, -2, -1, -3, 0, 1, -2, -2, 0, 1, -4, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, 0, -1, 0, -1, -3, -1, -1, 0, -1, -1, -1, -1, -1, -2, -2, -1, -3, -3, -2, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, -1, 0, 0, -2, 0, -1, -2, -2, -1, -1, -1, -2, -1, -1, 0, 0, -4, 0, 0, 0, -3, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -6, 0, -2, 0, -2, -1, -3, -5, -2, -4, -2, -3, -3, -4, -3, -2, -8, -4, -3, -3, -4, -4, -3, -4, -3, -4, -2, -2, -2, -2, -3, -2, -4, 0, 0, -7, -2, -7, -7, -7, -3, -7, -3, -2, -6, -3, -3, -5, -4, -6, -5, -7, -5, -7, -5, -3, -3, -3, -5, -4, -6, 0, 0, -4, -7, -1, 0, -8, -5, -5, -4, -2, -2, -2, -4, -4, -2, -2, 0, -1, -2, -5, -7, -7, 0, 0, 0, 0, -1, -3, -6, -3, 0, 0, 0, -2, -6, 0, 0, 0, 0, 0, -2,
+    2, 0, -2, 0, -4, 0, 0, -3, 1, 2, 0, 2, 2, 2, -1, 2, 0, -3, 0, 1, -5, 1, -1, -4, -1, -1, -1, -4, -1, -1, -6, -1, -1, -1, -1, -4, -1, -4, -1, -2, -8, -3, -8, -6, -1, -7, -1, 2, -1, -2, -3, -3, -3, -3, -2, -3, -1, -1, -4, -1, -1, -1, -1, -3, -2, -3, -1, -1, -5, -3, -6, -4, -1, -6, -1, 0, 0, -5, -3, 0, 0, -1, 0, 0, -4, -1, -1, -1, -4, -1, -3, -3, 0, 2, -2, -2, -2, -3, 0, 0, 0, 0, 2, -3, -3, -3, 0, 0, 0, 0, -3, -2, 0, 1, -1, 0, -1,
+    0, 2, -5, 0, -1, 1, 0, -2, 0, 0, 0, 0, -1, -2, -1, -1, 0, -2, 0, -2, -7, -3, -3, -3, -3, -3, -4, -4, -3, -4, -6, -4, -4, -3, -4, -3, -4, -4, -4, -4, -5, -4, -6, -6, -6, -7, -3, 0, 0, -3, -4, -3, -3, -3, -5, -3, -3, -3, -7, -3, -3, -4, -3, -3, -5, -3, -4, -5, -5, -4, -5, -5, -6, -5, -4, 2, 0, -6, -3, 0, -2, -6, -3, -4, -3, -4, -4, -4, -3, -3, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 2, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -3,
+    0, 3, -4, -1, 0, 0, 2, -2, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -7, -2, -3, -4, -3, -4, -4, -4, -4, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 1, -4, -3, -4, -4, -4, -5, -4, -3, -3, -7, -3, -3, -3, -3, -4, -4, -4, -3, -3, -7, -4, -7, -6, -3, -7, -3, 1, 1, -4, -4, -1, 0, -4, -2, -2, -4, -3, -3, -3, -4, -3, -3, -3, -1, -1, -3, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, -1, -4, 1, 0, 0, 1, 0, -4,
+    0, 4, -6, -1, 0, 1, 0, 0, 0, 0, 0, -2, -1, -1, -2, -1, 0, -1, -1, 0, -8, -4, -3, -3, -3, -4, -4, -3, -4, -4, -8, -4, -4, -4, -4, -3, -4, -3, -4, -6, -4, -4, -6, -5, -7, -6, -4, 0, 1, -3, -4, -3, -3, -3, -3, -3, -4, -4, -7, -4, -3, -4, -4, -3, -5, -3, -4, -5, -3, -3, -3, -3, -5, -3, -5, 1, 0, -6, -3, 0, -2, -7, -4, -5, -3, -4, -4, -4, -3, -3, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, -1, -3, 0, 2, 0, 0, 2, -2,
+    0, 2, -4, -2, 0, 0, 1, -4, 0, 0, -2, 0, 0, 0, -2, 0, -2, -2, -1, -1, -6, -1, -3, -5, -3, -3, -3, -5, -3, -3, -4, -3, -3, -3, -3, -5, -3, -5, -3, -4, -4, -4, -4, -4, -3, -4, -3, 1, 0, -4, -3, -4, -4, -4, -4, -4, -3, -3, -7, -3, -3, -3, -3, -4, -4, -4, -3, -3, -6, -4, -7, -6, -3, -7, -3, 0, 1, -5, -4, 0, -1, -3, -1, -1, -5, -3, -3, -3, -5, -3, -4, -4, 0, 0, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3,
+    -2, 4, -7, -2, 0, 0, 2, -2, -9, -8, -2, -2, -2, -2, -5, -1, -2, 0, -2, -2, -5, -6, -3, -4, -3, -4, -4, -4, -4, -3, -12, -5, -4, -4, -4, -4, -4, -4, -4, -6, -3, -3, -3, -3, -4, -3, -4, 0, 1, -5, -3, -4, -5, -5, -4, -4, -4, -4, -7, -4, -4, -6, -5, -4, -6, -4, -6, -6, -4, -4, -4, -4, -6, -4, -6, 0, 1, -4, -4, -1, 0, -8, -6, -9, -4, -3, -3, -3, -4, -4, -3, -3, 0, -2, -3, -5, -5, -4, 0, 0, 0, 0, -1, -4, -4, -4, 0, 0, 0, -2, -4, 1, 0, -5, 0, 0, -3,
+    -1, 1, -5, 0, -2, 2, 0, -2, -2, -1, 0, -2, -2, -2, -1, -1, 0, -3, 0, -1, -8, -4, -3, -4, -3, -3, -4, -4, -3, -4, -7, -4, -4, -3, -4, -4, -4, -4, -4, -5, -6, -4, -7, -6, -6, -7, -4, 1, 0, -3, -4, -3, -3, -3, -5, -3, -3, -3, -7, -3, -3, -4, -3, -3, -5, -3, -4, -5, -6, -4, -6, -5, -6, -6, -5, 2, 0, -6, -3, 0, -2, -6, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 2, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -4,
+    0, 3, -4, 0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, 0, -1, -6, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 1, 1, -3, -4, -3, -3, -3, -3, -3, -3, -3, -7, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -4, -4, -4, -3, -4, -3, 1, 1, -5, -3, 0, 0, -3, -1, -1, -4, -3, -3, -3, -4, -3, -4, -4, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -4, 0, 0, 0, 0, -3, 1, 1, 0, 1, 1, -2,
+    0, 2, -4, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -1, -1, -6, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 1, 0, -3, -4, -4, -4, -4, -4, -4, -3, -3, -7, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -6, -4, 0, 0, -3, -1, -1, -4, -3, -3, -3, -4, -3, -4, -4, 0, 0, -3, -3, -3, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    -1, 4, -6, -2, 0, 1, 3, -1, 0, 0, -2, -2, -1, -1, -3, -1, -2, -1, -2, -1, -8, -4, -3, -4, -3, -4, -4, -4, -4, -3, -6, -5, -4, -4, -5, -4, -4, -4, -4, -5, -3, -3, -3, -3, -4, -3, -4, 0, 2, -4, -3, -4, -4, -4, -4, -4, -4, -4, -7, -4, -4, -5, -5, -4, -5, -4, -5, -5, -4, -4, -4, -4, -5, -4, -5, 1, 2, -4, -4, -1, 0, -6, -4, -4, -4, -3, -3, -3, -4, -4, -3, -3, -1, -2, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -2, -4, 2, 2, 0, 2, 2, -2,
+    0, 0, -5, -3, -3, 1, 0, -7, 0, 0, -4, 0, 0, -1, -6, 0, -4, -5, -3, -1, -7, -1, -3, -8, -3, -3, -3, -8, -3, -3, -4, -3, -3, -3, -3, -8, -3, -8, -3, -5, -6, -6, -6, -6, -3, -6, -3, 2, 0, -6, -6, -6, -6, -6, -4, -6, -3, -3, -7, -3, -3, -3, -3, -7, -4, -6, -3, -4, -7, -6, -8, -6, -3, -10, -3, 0, 0, -7, -6, 0, -2, -3, -1, -1, -8, -3, -3, -3, -8, -3, -6, -6, 0, 0, -6, -6, -6, -6, 0, 0, 0, 0, -2, -7, -6, -6, 0, 0, 0, 0, -7, 0, 0, 1, 0, 0, -3,
+    0, -3, -4, 0, -9, 1, 0, -10, 0, 0, -1, 0, 0, 0, -1, 0, 0, -5, 0, -1, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -10, -4, -8, -6, -3, -9, -3, 1, -1, -3, -4, -3, -3, -3, -4, -3, -3, -3, -7, -3, -3, -3, -3, -3, -4, -3, -3, -3, -6, -4, -7, -5, -3, -7, -3, 0, 0, -7, -3, 0, -2, -3, -1, -1, -4, -3, -3, -3, -4, -3, -4, -4, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -4, 0, 0, 0, 0, -3, -5, -5, 0, -5, -5, -3,
+    0, 4, -4, 0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, 0, -1, -6, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 1, 1, -3, -4, -3, -3, -3, -3, -3, -3, -3, -7, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -4, -4, -4, -3, -4, -3, 1, 1, -5, -3, 0, 0, -3, -1, -1, -4, -3, -3, -3, -4, -3, -4, -4, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -4, 0, 0, 0, 0, -3, 1, 1, 0, 1, 1, -2,
+    0, 4, -4, -1, 0, 1, 2, 0, -2, 0, -1, -1, -1, -1, -2, -1, -1, 0, -1, -1, -8, -2, -3, -4, -3, -4, -4, -4, -4, -3, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 1, -4, -3, -4, -4, -4, -3, -4, -4, -4, -7, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -3, -3, -3, -4, -3, -4, 1, 2, -4, -4, -1, 0, -4, -2, -2, -4, -3, -3, -3, -4, -4, -3, -3, 0, -2, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -3, 0, 0, 0, -1, -4, 2, 1, 0, 2, 1, -2,
+    0, 4, -6, -1, 0, 2, 0, 0, 0, 0, 0, -1, -1, -2, -2, -1, 0, -1, -1, 0, -8, -4, -3, -3, -3, -4, -4, -3, -4, -4, -7, -4, -4, -4, -4, -3, -4, -3, -4, -6, -4, -4, -6, -5, -6, -7, -4, 1, 1, -3, -4, -3, -3, -3, -3, -3, -4, -4, -7, -4, -3, -4, -4, -3, -5, -3, -4, -5, -3, -3, -4, -3, -5, -3, -5, 2, 0, -6, -3, 0, -2, -7, -4, -4, -3, -4, -4, -4, -3, -3, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, -1, -3, 0, 2, 0, 0, 2, -2,
+    -1, 4, -6, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -5, -1, -1, 0, -1, 0, -8, -6, -3, -4, -3, -4, -4, -3, -4, -4, -12, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -3, -5, -4, -7, -6, -7, 0, 1, -5, -3, -5, -5, -5, -3, -5, -4, -4, -7, -4, -4, -4, -4, -4, -4, -5, -4, -6, -4, -3, -3, -3, -5, -3, -5, 0, 0, -5, -5, -2, -2, -7, -6, -9, -4, -4, -4, -4, -4, -4, -3, -3, 0, -1, -4, -5, -5, -5, 0, 0, 0, 0, -2, -4, -4, -3, 0, 0, 0, -1, -4, 0, 1, -6, 1, 0, -2,
+    -2, 3, -8, -3, 0, 0, 0, -2, 0, 0, -2, -3, -3, -3, -4, -3, -2, -3, -3, -2, -10, -4, -5, -5, -5, -6, -6, -5, -5, -6, -3, -6, -6, -6, -6, -5, -6, -5, -6, -7, -6, -6, -8, -7, -6, -8, -6, 2, 1, -5, -6, -5, -5, -5, -5, -4, -6, -5, -4, -6, -5, -6, -6, -5, -3, -5, -6, -7, -5, -5, -5, -5, -6, -4, -6, 0, 1, -8, -5, -2, -4, -2, -4, -4, -5, -6, -6, -6, -5, -2, -6, -6, -2, -3, -5, -5, -5, -5, 0, 0, 0, 0, -1, -5, -4, -5, 0, 0, 0, -3, -5, 0, 1, 2, 0, 1, -4,
+    0, 2, -4, -2, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -3, 0, -2, -2, -2, -1, -7, -1, -3, -6, -3, -3, -3, -6, -3, -3, -4, -3, -3, -3, -3, -5, -3, -6, -3, -4, -6, -5, -7, -6, -3, -7, -3, 1, 0, -4, -5, -4, -4, -4, -4, -4, -3, -3, -7, -3, -3, -3, -3, -5, -4, -4, -3, -3, -6, -5, -5, -5, -3, -5, -3, 0, 0, -7, -4, 0, -2, -4, -1, -1, -6, -3, -3, -3, -5, -3, -5, -5, 0, 0, -4, -4, -4, -4, 0, 0, 0, 0, 2, -5, -5, -5, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, -3,
+    0, 0, -6, 0, -3, 2, 0, -3, 0, 0, 0, 0, -2, -2, -1, -1, 0, -4, 0, -2, -7, -3, -3, -4, -3, -3, -4, -4, -3, -4, -7, -4, -4, -3, -4, -4, -4, -4, -4, -5, -6, -4, -6, -6, -6, -6, -3, 1, 0, -3, -4, -3, -3, -3, -5, -3, -3, -3, -7, -3, -3, -4, -3, -3, -5, -3, -4, -5, -6, -4, -6, -5, -6, -6, -4, 2, 0, -7, -3, 0, -2, -7, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 2, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -3,
+    -2, 4, -6, -2, 0, 0, 2, -2, -7, -6, -2, -2, -1, -1, -8, -1, -3, 0, -2, -2, -3, -8, -3, -5, -3, -4, -4, -4, -4, -3, -10, -5, -4, -4, -4, -5, -4, -4, -4, -5, -3, -3, -3, -3, -4, -3, -4, 0, 1, -10, -3, -10, -10, -10, -5, -10, -4, -4, -7, -4, -4, -9, -9, -10, -10, -10, -9, -10, -7, -10, -10, -10, -9, -10, -9, 0, 2, -4, -9, -2, 0, -10, -8, -8, -5, -3, -3, -3, -5, -5, -3, -3, 0, -2, -3, -6, -10, -10, 0, 0, 0, 0, -5, -4, -10, -4, 0, 0, 0, -7, -10, 2, 0, -3, 2, 0, -4,
+    0, 4, -6, -1, 0, 1, 2, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, 0, -1, -1, -5, -4, -3, -4, -3, -4, -4, -4, -4, -3, -6, -4, -4, -4, -4, -4, -4, -4, -4, -5, -3, -3, -3, -3, -4, -3, -4, 0, 1, -4, -3, -4, -4, -4, -3, -4, -4, -4, -7, -4, -4, -4, -4, -4, -5, -4, -4, -5, -3, -3, -3, -3, -5, -3, -5, 1, 2, -4, -4, 0, 0, -6, -4, -4, -4, -3, -3, -3, -4, -4, -3, -3, 0, -2, -3, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -3, 0, 0, 0, -1, -4, 2, 1, 0, 2, 1, -2,
+    -2, 3, -8, -3, 0, 0, 2, -2, 0, 0, -3, -3, -2, -2, -6, -2, -4, -1, -4, -3, -5, -8, -3, -6, -3, -4, -4, -6, -4, -3, -11, -6, -4, -4, -5, -6, -4, -6, -4, -7, -3, -3, -3, -3, -4, -3, -4, 0, 1, -7, -3, -7, -7, -7, -5, -7, -4, -4, -7, -4, -4, -7, -6, -7, -7, -7, -6, -8, -6, -5, -5, -5, -7, -5, -8, 0, 1, -4, -7, -3, 0, -10, -8, -8, -6, -3, -3, -3, -6, -6, -3, -3, -2, -3, -3, -6, -7, -7, 0, 0, 0, 0, -3, -4, -7, -4, 0, 0, 0, -3, -7, 1, 0, -2, 1, 0, -4,
+    -2, 4, -7, -2, 0, 0, 2, -2, 0, 0, -3, -3, -2, -2, -5, -2, -3, -1, -3, -2, 0, -6, -3, -6, -3, -4, -4, -5, -4, -3, -9, -5, -4, -4, -5, -5, -4, -5, -4, -6, -3, -3, -3, -3, -4, -3, -4, 0, 1, -6, -3, -6, -6, -6, -4, -6, -4, -4, -7, -4, -4, -6, -6, -6, -6, -6, -6, -7, -5, -4, -4, -4, -6, -4, -7, 0, 2, -4, -6, -3, 0, -8, -6, -6, -6, -3, -3, -3, -5, -5, -3, -3, -1, -3, -3, -6, -6, -6, 0, 0, 0, 0, -2, -4, -6, -4, 0, 0, 0, -2, -6, 2, 0, -1, 1, 0, -3,
+    0, 2, -4, -3, -1, 1, 1, -5, 0, 0, -3, 0, 0, -1, -4, 0, -3, -3, -2, -1, -6, -1, -3, -7, -3, -3, -3, -7, -3, -3, -4, -3, -3, -3, -3, -6, -3, -7, -3, -4, -4, -4, -4, -4, -3, -4, -3, 2, 0, -5, -4, -6, -6, -6, -4, -6, -3, -3, -7, -3, -3, -3, -3, -6, -4, -6, -3, -4, -7, -6, -8, -6, -3, -8, -3, 0, 0, -5, -6, 0, -2, -3, -1, -1, -7, -3, -3, -3, -6, -3, -4, -4, 0, 0, -4, -5, -5, -6, 0, 0, 0, 0, -1, -5, -6, -4, 0, 0, 0, 0, -6, 0, 0, 1, 0, 0, -3,
+    -2, 3, -8, -4, 0, 0, 2, -3, 0, 0, -4, -4, -2, -3, -8, -2, -4, -2, -4, -4, -5, -8, -3, -7, -3, -4, -4, -6, -4, -3, -10, -6, -4, -4, -5, -7, -4, -7, -4, -7, -3, -3, -3, -3, -4, -3, -4, 0, 0, -9, -3, -8, -9, -9, -6, -8, -4, -4, -7, -4, -4, -8, -7, -8, -8, -8, -8, -9, -8, -6, -6, -6, -8, -6, -8, -1, 1, -4, -8, -4, -1, -10, -8, -8, -7, -3, -3, -3, -7, -7, -3, -3, -2, -4, -3, -6, -9, -8, 0, 0, 0, 0, -5, -4, -8, -4, 0, 0, 0, -4, -8, 1, 0, -3, 0, 0, -5,
+    0, 4, -4, -2, 0, 0, 2, -2, 0, 0, -3, -1, 0, -1, -3, 0, -2, 0, -2, -1, -5, -1, -3, -6, -3, -4, -4, -4, -4, -3, -4, -4, -4, -4, -4, -5, -4, -5, -4, -4, -3, -3, -3, -3, -4, -3, -4, 1, 2, -4, -3, -5, -5, -5, -5, -5, -3, -3, -7, -3, -3, -3, -3, -5, -4, -5, -3, -4, -7, -5, -5, -5, -3, -6, -3, 0, 2, -4, -5, -1, 0, -4, -1, -1, -6, -3, -3, -3, -5, -3, -3, -3, 0, -1, -3, -4, -4, -5, 0, 0, 0, 0, 0, -4, -5, -4, 0, 0, 0, -1, -5, 2, 0, 0, 2, 0, -4,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, -1, 1, 0, 1, 1, 0, 2, 1, 0, 3, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 1, 2, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, 0, -1, -2, -1, 0, -1, 0, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 1, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 0, 1, 2, 0, 0, 0, 0, 2, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    1, 2, -3, -1, -1, 0, 0, -2, 0, 1, -1, 0, 1, 1, -2, 1, -1, -4, -1, 0, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -10, -4, -7, -6, -3, -8, -3, 0, -2, -3, -4, -3, -3, -3, -4, -3, -3, -3, -6, -3, -3, -3, -3, -4, -4, -3, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, -1, -7, -3, 0, -2, -3, -1, -1, -4, -3, -3, -3, -4, -2, -4, -4, 0, 0, -3, -3, -3, -3, 1, 1, 1, 2, 1, -4, -4, -4, 1, 1, 1, 0, -4, 0, 0, 0, 0, 0, -2,
+    1, 2, -5, 0, -1, 1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -6, 0, -1, -7, -2, -3, -3, -3, -3, -3, -3, -3, -3, -6, -4, -3, -3, -3, -3, -3, -3, -3, -4, -10, -4, -7, -6, -6, -9, -3, 0, -1, -3, -4, -3, -3, -3, -4, -3, -3, -3, -7, -3, -3, -3, -3, -3, -5, -3, -4, -4, -4, -3, -5, -4, -6, -5, -4, 1, -1, -6, -3, 0, -1, -6, -2, -3, -3, -3, -3, -3, -3, -3, -4, -4, 0, 0, -3, -3, -3, -3, 0, 0, 0, 1, 2, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 1, -4, -2, -2, 0, 0, -2, -1, 0, -2, 0, 0, 0, -6, 0, -2, -5, -2, -1, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -10, -4, -6, -6, -4, -8, -3, 0, -2, -4, -4, -5, -5, -5, -4, -5, -3, -3, -6, -3, -3, -3, -3, -5, -4, -4, -3, -3, -4, -4, -4, -4, -4, -4, -3, 0, -2, -7, -5, 0, -2, -4, -1, -2, -4, -3, -3, -3, -4, -3, -4, -4, 0, 0, -4, -4, -4, -5, 0, 0, 0, 2, 0, -5, -5, -4, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, -3,
+    0, 3, -4, -1, 0, 0, 1, 0, -1, 0, -1, -1, 0, 0, -2, 0, -1, 0, -1, 0, -5, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -4, -3, -3, -3, -3, -3, -3, -3, 0, 1, -4, -3, -4, -4, -4, -3, -4, -3, -3, -7, -3, -3, -3, -3, -3, -4, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, 1, -4, -4, 0, 0, -4, -1, -1, -4, -3, -3, -3, -4, -3, -3, -3, 0, -1, -3, -4, -4, -4, 4, 1, 5, 4, 1, -3, -3, -3, 3, 6, 1, 0, -3, 1, 0, 0, 1, 0, -2,
+    0, 2, -4, 0, -1, 1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -5, 0, -1, -7, -2, -3, -3, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -10, -3, -7, -6, -4, -9, -3, 0, -1, -3, -4, -3, -3, -3, -4, -3, -3, -3, -7, -3, -3, -3, -3, -3, -4, -3, -3, -3, -4, -3, -5, -4, -4, -5, -3, 1, -1, -6, -3, 0, -2, -4, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 1, 2, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    -1, 3, -5, -1, 0, 0, 1, 0, -4, -2, 0, -1, 0, -1, -4, 0, 0, 0, -1, 0, -8, -4, -3, -3, -3, -3, -4, -3, -3, -3, -7, -4, -4, -3, -4, -3, -4, -3, -4, -5, -3, -3, -3, -3, -4, -4, -5, 0, 0, -4, -3, -4, -4, -4, -3, -3, -4, -3, -7, -4, -3, -4, -4, -3, -4, -4, -4, -4, -3, -3, -3, -3, -4, -3, -5, 0, 0, -4, -4, -2, 0, -6, -4, -4, -3, -3, -3, -3, -3, -3, -3, -3, 0, -1, -3, -4, -4, -4, 4, 1, 4, 4, 1, -3, -3, -3, 3, 5, 0, 0, -3, 0, 1, -1, 0, 1, -1,
+    0, 3, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, -5, 0, 0, -7, -2, -3, -3, -3, -3, -4, -3, -3, -4, -4, -4, -4, -4, -4, -3, -4, -3, -4, -4, -10, -3, -5, -4, -4, -6, -3, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -6, -3, 0, -2, -3, -2, -2, -3, -4, -4, -4, -3, -2, -3, -3, 0, -1, -3, -3, -3, -3, 0, 0, 0, 4, 1, -3, -3, -3, 0, 0, 1, -1, -3, 0, 1, 0, 0, 1, -1,
+    1, 2, -3, 0, -1, 0, 0, -1, 0, 1, -1, 0, 1, 1, -2, 1, -1, -4, 0, 0, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -10, -4, -7, -6, -3, -8, -3, 0, -2, -3, -4, -3, -3, -3, -4, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -3, -4, -4, -5, -4, -3, -5, -3, 0, -1, -7, -3, 0, -1, -3, -1, -1, -4, -3, -3, -3, -4, -2, -4, -4, 0, 0, -3, -3, -3, -3, 1, 1, 1, 2, 1, -3, -3, -4, 1, 1, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    1, 2, -4, -1, 0, 0, 0, -1, 0, 1, -1, 0, 1, 1, -2, 1, -1, -1, -1, 0, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -4, -4, -4, -4, -3, -5, -3, 0, 0, -3, -4, -3, -3, -3, -3, -3, -3, -3, -6, -3, -3, -3, -3, -4, -4, -3, -3, -3, -4, -3, -4, -4, -3, -3, -3, 0, 0, -5, -3, 0, -1, -3, -1, -1, -4, -3, -3, -3, -4, -2, -4, -4, 0, 0, -3, -3, -3, -3, 2, 1, 5, 4, 1, -4, -4, -3, 2, 5, 1, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 3, -4, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, -1, 0, -4, -2, -2, -3, -2, -3, -4, -3, -3, -3, -4, -4, -4, -3, -4, -3, -4, -3, -4, -4, -2, -2, -2, -2, -4, -2, -4, 0, 1, -3, -2, -3, -3, -3, -3, -3, -4, -3, -4, -4, -3, -4, -4, -3, -4, -3, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 1, -4, -3, 0, 0, -3, -2, -2, -3, -3, -3, -3, -3, -2, -2, -2, 0, -1, -2, -3, -3, -3, 3, 1, 5, 4, 1, -3, -3, -3, 3, 6, 2, 0, -3, 1, 1, 0, 1, 1, -1,
+    1, 0, -5, -3, -3, 0, 0, -6, 0, 0, -4, 0, 2, -1, -6, 2, -4, -5, -3, -1, 0, -1, -3, -8, -3, -3, -3, -7, -3, -3, -4, -3, -3, -3, -3, -7, -3, -7, -3, -5, -10, -6, -10, -8, -3, -9, -3, 1, -1, -6, -6, -6, -6, -6, -4, -6, -3, -3, -6, -3, -3, -3, -3, -6, -4, -6, -3, -4, -7, -6, -7, -6, -3, -7, -3, 0, 0, -7, -6, 0, -2, -3, -1, -1, -8, -3, -3, -3, -7, -2, -6, -6, 0, 0, -6, -6, -6, -6, 2, 2, 2, 2, -1, -6, -6, -6, 2, 2, 2, 0, -6, -1, 0, 0, 0, 0, -3,
+    0, 0, -4, -1, -3, 0, 0, -3, 0, 0, -2, 0, 0, 0, -4, 0, -2, -3, -1, 0, -7, -1, -3, -5, -3, -3, -3, -5, -3, -3, -4, -3, -3, -3, -3, -5, -3, -5, -3, -3, -6, -4, -6, -6, -3, -6, -3, 0, 0, -4, -4, -4, -4, -4, -4, -4, -3, -3, -6, -3, -3, -3, -3, -4, -4, -4, -3, -3, -6, -4, -6, -6, -3, -6, -3, 0, 0, -7, -4, 0, -2, -3, -1, -1, -5, -3, -3, -3, -5, -3, -4, -4, 0, 0, -4, -4, -4, -4, 2, 1, 2, 1, 1, -4, -4, -4, 1, 3, 1, 0, -4, 0, 0, 0, 0, 0, -3,
+    0, 2, -3, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 1, -1, 1, 0, -4, 0, 0, -7, -1, -3, -3, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -10, -4, -7, -6, -3, -8, -3, 0, -2, -3, -4, -3, -3, -3, -4, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -3, -4, -3, -5, -4, -3, -5, -3, 0, -1, -6, -3, 0, -1, -3, -1, -1, -3, -3, -3, -3, -3, -3, -4, -4, 0, 0, -3, -3, -3, -3, 1, 1, 1, 1, 2, -3, -3, -3, 1, 1, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    1, 2, -3, 0, -1, 0, 0, -1, 0, 1, -1, 0, 1, 1, -2, 1, -1, -4, 0, 0, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -10, -4, -7, -6, -3, -9, -3, 0, -2, -3, -4, -3, -3, -3, -4, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -3, -4, -4, -5, -4, -3, -5, -3, 0, -1, -7, -3, 0, -1, -3, -1, -1, -4, -3, -3, -3, -4, -3, -4, -4, 0, 0, -3, -3, -3, -3, 1, 1, 1, 2, 1, -3, -3, -4, 1, 1, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 2, -5, 0, -1, 0, -1, -1, -1, 0, 0, -1, -2, -2, -1, 0, 0, -6, 0, -1, -7, -3, -3, -3, -3, -3, -3, -3, -3, -4, -6, -4, -3, -3, -4, -3, -3, -3, -3, -5, -10, -3, -7, -6, -6, -8, -3, 0, -1, -3, -4, -3, -3, -3, -3, -3, -3, -3, -7, -3, -3, -4, -3, -3, -5, -3, -4, -5, -3, -3, -5, -4, -6, -5, -4, 1, -1, -6, -3, 0, -2, -6, -3, -4, -3, -4, -4, -4, -3, -3, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 1, 2, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 2, -5, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -6, 0, -1, -7, -3, -3, -3, -3, -3, -3, -3, -3, -3, -6, -4, -3, -3, -4, -3, -3, -3, -3, -4, -10, -3, -7, -6, -6, -8, -3, 0, -1, -3, -4, -3, -3, -3, -4, -3, -3, -3, -7, -3, -3, -4, -3, -3, -5, -3, -4, -4, -4, -3, -5, -4, -6, -5, -4, 1, -1, -6, -3, 0, -1, -6, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 1, 2, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    1, 0, -6, -3, -3, 0, 0, -2, 1, 1, -3, 0, 1, -1, -4, 1, -3, -5, -2, 0, -7, -1, -3, -6, -3, -3, -3, -6, -3, -3, -3, -3, -3, -3, -3, -6, -3, -6, -3, -6, -10, -6, -8, -7, -3, -9, -3, 0, 0, -5, -6, -6, -6, -6, -4, -4, -3, -3, -3, -3, -3, -3, -3, -6, -3, -5, -3, -4, -6, -5, -5, -5, -3, -4, -3, 0, 0, -7, -6, 0, -5, -2, -1, -1, -6, -3, -3, -3, -6, -1, -6, -6, 0, 0, -5, -5, -5, -6, 1, 1, 1, 1, -1, -6, -4, -5, 1, 1, 2, 0, -6, 0, 0, 1, 0, 0, -3,
+    -1, 3, -6, -1, 0, 0, 0, 0, -5, -4, 0, -1, -1, -3, -4, 0, 0, -8, -2, 0, -8, -5, -3, -3, -3, -3, -4, -3, -3, -4, -8, -4, -4, -3, -4, -3, -4, -3, -4, -5, -10, -3, -6, -5, -8, -6, -8, 0, -1, -4, -3, -3, -4, -4, -3, -3, -4, -3, -7, -3, -3, -4, -4, -3, -4, -3, -4, -4, -3, -3, -3, -3, -5, -3, -5, 0, 0, -6, -3, -2, -3, -7, -5, -5, -3, -4, -4, -4, -3, -3, -3, -3, 0, -1, -4, -4, -4, -3, 0, 0, 0, 4, 1, -3, -3, -3, 0, 0, 0, 0, -3, 0, 1, -2, 0, 1, -1,
+    1, 2, -4, 0, -2, 1, 0, -3, 0, 1, -1, 0, -1, -1, -1, -1, 0, -6, 0, -1, -7, -2, -3, -4, -3, -3, -3, -4, -3, -3, -6, -3, -3, -3, -3, -4, -3, -4, -3, -4, -10, -4, -7, -6, -5, -8, -3, 0, -1, -3, -4, -3, -3, -3, -4, -3, -3, -3, -7, -3, -3, -3, -3, -3, -4, -3, -4, -4, -6, -3, -5, -5, -5, -5, -4, 1, 0, -6, -3, 0, -2, -6, -2, -3, -4, -3, -3, -3, -4, -4, -4, -4, 0, 0, -3, -3, -3, -3, 1, 1, 1, 2, 2, -3, -3, -3, 1, 1, 1, 0, -3, 0, 0, 0, 0, 0, -3,
+    0, 2, -4, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -4, 0, 0, -5, -1, 0, -7, -1, -3, -3, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -7, -3, -6, -5, -3, -7, -3, 0, -1, -4, -3, -4, -4, -4, -3, -4, -3, -3, -7, -3, -3, -3, -3, -3, -4, -4, -3, -3, -3, -3, -4, -4, -3, -4, -3, 0, -1, -6, -4, 0, -2, -3, -1, -1, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -4, -4, -4, -4, 0, 0, 0, 3, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1,
+    1, 2, -3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, -1, 1, 0, -4, 0, 0, -7, -1, -3, -3, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -10, -4, -6, -5, -3, -7, -3, 0, -2, -3, -4, -3, -3, -3, -3, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, -1, -6, -3, 0, -1, -3, -1, -1, -3, -3, -3, -3, -3, -3, -4, -4, 0, 0, -3, -3, -3, -3, 1, 1, 1, 4, 2, -3, -3, -3, 1, 1, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    -1, 3, -5, -1, 0, 0, 0, 0, -5, -3, -1, -1, 0, -5, -4, -1, -1, -9, -1, 0, 0, -6, -3, -4, -3, -4, -4, -3, -3, -4, -9, -4, -4, -4, -4, -4, -4, -4, -4, -5, -10, -3, -5, -4, -8, -6, -7, 0, 0, -5, -3, -5, -5, -5, -3, -5, -4, -3, -8, -4, -3, -4, -4, -5, -4, -5, -4, -6, -4, -3, -3, -3, -4, -3, -5, 0, 0, -7, -5, -2, -3, -7, -6, -6, -4, -4, -4, -4, -4, -4, -3, -3, 0, -1, -5, -5, -5, -5, 0, 0, 0, 4, -1, -5, -5, -3, 0, 0, 0, -1, -5, 0, 0, -2, 0, 0, -1,
+    -1, 3, -5, -1, 0, 0, 0, 0, -3, -2, -1, -1, 0, -4, -3, -1, -1, -8, -1, 0, 0, -4, -3, -4, -3, -4, -4, -3, -3, -4, -7, -4, -4, -4, -4, -4, -4, -3, -4, -5, -10, -3, -5, -4, -6, -6, -5, 0, -1, -4, -3, -4, -4, -4, -3, -4, -4, -3, -7, -4, -3, -4, -4, -4, -4, -4, -4, -5, -4, -3, -3, -3, -4, -3, -5, 0, 0, -6, -4, -1, -3, -7, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, 0, -1, -4, -4, -4, -4, 0, 0, 0, 4, 0, -4, -4, -3, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -1,
+    0, 2, -4, -2, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -5, 0, -2, -4, -2, 0, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -4, -10, -4, -6, -5, -3, -7, -3, 0, -2, -5, -4, -6, -6, -6, -4, -6, -3, -3, -6, -3, -3, -3, -3, -6, -4, -6, -3, -4, -5, -4, -4, -4, -3, -4, -3, 0, -2, -7, -6, 0, -2, -3, -1, -1, -4, -3, -3, -3, -4, -3, -4, -4, 0, 0, -5, -5, -5, -6, 0, 0, 0, 3, -1, -6, -6, -4, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, -2,
+    -1, 3, -5, -1, 0, 0, 0, -1, -4, -2, -1, -1, 0, -4, -3, -1, -1, -9, -1, 0, 0, -5, -3, -4, -3, -3, -4, -3, -3, -4, -8, -4, -4, -4, -4, -3, -4, -3, -4, -5, -10, -3, -5, -4, -7, -6, -6, 0, -1, -4, -3, -4, -4, -4, -3, -4, -4, -3, -7, -4, -3, -4, -4, -4, -4, -4, -4, -5, -4, -3, -3, -3, -4, -3, -5, 0, 0, -6, -4, -1, -3, -7, -5, -5, -4, -4, -4, -4, -3, -3, -3, -3, 0, -1, -4, -4, -4, -4, 0, 0, 0, 4, 0, -4, -4, -3, 0, 0, 0, -1, -4, 0, 0, -1, 0, 0, -1,
+    1, 3, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -5, 1, 0, -4, -1, 0, -7, -1, -3, -3, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -4, -10, -3, -6, -5, -3, -7, -3, 0, -1, -4, -4, -4, -4, -4, -3, -4, -3, -3, -6, -3, -3, -3, -3, -4, -4, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -6, -4, 0, -2, -3, -1, -1, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -4, -4, -4, -4, 1, 1, 1, 4, 0, -4, -4, -3, 1, 1, 1, 0, -4, 0, 1, 0, 0, 0, -2,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 1, 0, 1, 1, 1, 3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 1, 2, 0, 1, 0, 0, 0, -1, 1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, -3, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 2, 2, 1, 1, 2, 1, 0, 1, 1, 1, 2, 1, 2, 1, 2, 1, 0, 0, 1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, -7, -4, 0, 0, 0, -4, 0, 0, -4, -4, -3, -4, -5, -3, -4, -3, -4, -4, -5, -4, -6, -6, -6, -6, -6, -6, -6, -6, -7, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, -6, -5, -6, -6, -6, -6, -6, -6, -6, -8, -6, -6, -6, -6, -6, -7, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, -7, -6, -4, -2, -6, -4, -4, -6, -6, -6, -6, -6, -6, -6, -6, 0, -4, -5, -6, -6, -6, 0, 0, 0, 0, 0, -6, -6, -6, 0, 0, 0, -4, -6, 0, 0, 0, 0, 0, -5,
+    0, 0, -4, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -5, 0, -2, -4, -2, -1, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -7, -4, -6, -6, -4, -8, -3, 0, 0, -4, -4, -5, -5, -5, -4, -5, -3, -3, -6, -3, -3, -3, -3, -5, -4, -4, -3, -3, -4, -4, -4, -4, -4, -4, -3, 0, 0, -7, -5, 0, -2, -4, -1, -2, -4, -3, -3, -3, -4, -3, -4, -4, 0, 0, -4, -4, -4, -5, 0, 0, 0, 0, 0, -5, -5, -4, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, -3,
+    2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -4, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, 0, -1, -1, -1, -3, -2, 0, -3, 0, 0, 0, -2, -1, -2, -2, -2, -2, -2, 0, 0, -3, 0, 0, 0, 0, -2, 0, -2, 0, -1, -4, -2, -4, -4, 0, -4, 0, 0, 0, -3, -2, 1, 0, 0, 0, 0, -3, 0, 0, 0, -3, 0, -1, -1, 0, 1, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -6, -1, 0, -3, 0, 0, -1, -2, 0, 0, -4, -2, -1, 0, -1, -3, -1, -3, -1, -3, 0, 0, 0, 0, -2, -1, -2, 0, 0, -2, 0, -2, -2, -2, -2, -2, -1, 0, -4, -1, 0, -2, -2, -2, -4, -2, -2, -2, -4, -3, -3, -3, -3, -3, -2, 0, 0, -1, -2, 0, 2, -4, -1, -1, -3, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    -4, 0, -8, -5, 0, 0, 0, -4, 0, 0, -4, -5, -4, -6, -6, -4, -4, -10, -5, -4, -12, -7, -7, -7, -7, -7, -8, -7, -7, -8, -10, -8, -8, -7, -8, -7, -8, -7, -8, -8, -14, -7, -9, -8, -9, -10, -8, 0, 0, -7, -7, -7, -7, -7, -7, -7, -7, -7, -11, -7, -7, -8, -7, -7, -8, -7, -8, -8, -7, -7, -7, -7, -8, -6, -8, 0, 0, -10, -7, -4, -6, -3, -7, -7, -7, -8, -8, -8, -7, -7, -7, -7, 0, -5, -7, -7, -7, -7, 0, 0, 0, 0, 0, -7, -7, -7, 0, 0, 0, -4, -7, 0, 0, 0, 0, 0, -5,
+    0, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, -5, 0, -1, -4, -1, -1, -1, -4, -1, -1, -2, -1, -1, -1, -1, -4, -1, -4, -1, -2, -8, -3, -8, -6, -1, -7, -1, 0, 0, -2, -3, -3, -3, -3, -2, -3, -1, -1, -4, -1, -1, -1, -1, -3, -2, -3, -1, -1, -5, -3, -6, -4, -1, -6, -1, 0, 0, -5, -3, 0, 0, -1, 0, 0, -4, -1, -1, -1, -4, -1, -3, -3, 0, 0, -2, -2, -2, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1,
+    0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, -3, -1, -1, -1, -3, -1, -1, -6, -1, -1, -1, -1, -3, -1, -3, -1, -2, -2, -2, -2, -2, -1, -2, -1, 0, 0, -2, -1, -2, -2, -2, -2, -2, -1, -1, -4, -1, -1, -1, -1, -2, -2, -2, -1, -1, -4, -2, -5, -4, -1, -5, -1, 0, 0, -3, -2, 0, 0, -1, 0, 0, -3, -1, -1, -1, -3, -1, -2, -2, 0, 0, -1, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -4, -1, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -7, -2, -3, -4, -3, -4, -4, -4, -4, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 0, -4, -3, -4, -4, -4, -5, -4, -3, -3, -6, -3, -3, -3, -3, -4, -4, -4, -3, -3, -7, -4, -7, -6, -3, -7, -3, 0, 0, -4, -4, -1, 0, -4, -2, -2, -4, -3, -3, -3, -4, -3, -3, -3, 0, -1, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -4,
+    0, 0, -4, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -1, -1, -3, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -3, -4, -4, -4, -4, -4, -4, -3, -3, -7, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -6, -4, 0, 0, -3, -1, -1, -4, -3, -3, 0, -4, -3, -4, -4, 0, 0, -3, -3, -3, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, -4, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -1, -1, -6, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -3, -4, -4, -4, -4, -4, -4, -3, -3, -7, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -6, -4, 0, 0, -3, -1, -1, -4, 0, -3, 0, -4, -3, -4, -4, 0, 0, -3, -3, -3, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -1, -1, -3, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -3, -4, -4, -4, -4, -4, -4, -3, -3, -7, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -6, -4, 0, 0, -3, -1, -1, -4, 1, 0, 2, -4, -3, -3, -4, 0, 0, -3, -3, -3, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, -6, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, -1, 0, -1, -1, 0, -8, -4, -3, -3, -3, -4, -4, -3, -4, -4, -7, -4, -4, -4, -4, -3, -4, -3, -4, -6, -4, -4, -6, -5, -6, -7, -4, 0, 0, -3, -4, -3, -3, -3, -3, -3, -4, -4, -7, -4, -3, -4, -4, -3, -5, -3, -4, -5, -3, -3, -4, -3, -5, -3, -5, 0, 0, -6, -3, 0, -2, -7, -4, -4, -3, -4, -4, -4, -3, -3, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -6, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, -1, 0, -1, -1, 0, -7, -4, -3, -3, -3, -4, -4, -3, -4, -4, -7, -4, -4, -4, -4, -3, -4, -3, -4, -6, -4, -4, -6, -5, -6, -7, -4, 0, 0, -3, -4, -3, -3, -3, -3, -3, -4, -4, -7, -4, -3, -4, -4, -3, -5, -3, -4, -5, -3, -3, -4, -3, -5, -3, -5, 0, 0, -6, -3, 0, -2, -7, -4, -4, -3, -4, -4, -4, -3, -3, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -2,
+    6, 0, 0, 5, 0, 0, 0, 5, 0, 0, 5, 4, 5, 4, 4, 5, 5, 4, 5, 5, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 3, 2, 0, 2, 2, 2, 2, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 3, 2, 2, 2, 0, 2, 2, 2, 2, 3, 1, 2, 2, 1, 3, 2, 2, 2, 0, 2, 1, 0, 0, 1, 2, 6, 4, 0, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 5, 3, 2, 2, 2, 0, 0, 0, 0, 0, 3, 3, 2, 0, 0, 0, 5, 3, 0, 0, 0, 0, 0, 4,
+    0, 0, -6, -1, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, 0, -1, -1, -5, -4, -3, -4, -3, -4, -4, -4, -4, -3, -6, -4, -4, -4, -4, -4, -4, -4, -4, -5, -3, -3, -3, -3, -4, -3, -4, 0, 0, -4, -3, -4, -4, -4, -3, -4, -4, -4, -7, -4, -4, -4, -4, -4, -5, -4, -4, -5, -3, -3, -3, -3, -5, -3, -5, 0, 0, -4, -4, 0, 0, -6, -4, -4, -4, -3, -3, -3, -4, -4, -3, -3, 0, -2, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -3, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, -6, -1, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, 0, -1, -1, -5, -4, -3, -4, -3, -4, -4, -4, -4, -3, -6, -4, -4, -4, -4, -4, -4, -4, -4, -5, -3, -3, -3, -3, -4, -3, -4, 0, 0, -4, -3, -4, -4, -4, -3, -4, -4, -4, -7, -4, -4, -4, -4, -4, -5, -4, -4, -5, -3, -3, -3, -3, -5, -3, -5, 0, 0, -4, -4, 0, 0, -6, -4, -4, -4, -2, -3, -2, -4, -4, -3, -3, 0, -2, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -3, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -2,
+    0, 2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -4, -2, 0, 0, 0, -1, -1, 0, -1, -1, -9, -1, -1, -1, -1, 0, -1, 0, -1, -4, -7, -1, -4, -3, -6, -6, -3, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -4, -1, 0, -1, -1, 0, -2, 0, -2, -2, 0, 0, -2, -1, -4, -2, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0,
+    1, 2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -1, 0, 0, -1, -1, 0, -2, 0, -1, -2, -1, -4, -3, -2, -5, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2, 0, -1, -1, -3, -1, -2, -2, -2, -2, -1, 0, 0, -4, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 2, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -2, 0, -1, -2, -1, 0, -5, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -3, -4, -3, -3, -3, -4, -3, -3, -3, -6, -3, -3, -3, -3, -4, -4, -3, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -6, -3, 0, -1, -3, -1, -1, -4, -3, -3, -3, -4, -2, -4, -4, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, -3, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -2, 0, -1, -4, -1, 0, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -8, -4, -7, -6, -3, -8, -3, 0, 0, -3, -4, -3, -3, -3, -4, -3, -3, -3, -6, -3, -3, -3, -3, -4, -4, -3, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -7, -3, 0, -2, -3, -1, -1, -4, -3, -3, -3, -4, -2, -4, -4, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -5, 0, -1, -7, -2, -3, -3, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -10, -3, -7, -6, -4, -9, -3, 0, 0, -3, -4, -3, -3, -3, -4, -3, -3, -3, -7, -3, -3, -3, -3, -3, -4, -3, -3, -3, -4, -3, -5, -4, -4, -5, -3, 0, 0, -6, -3, 0, -2, -4, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -4, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -6, 0, -2, -5, -2, -1, -7, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -3, -10, -4, -6, -6, -4, -8, -3, 0, 0, -4, -4, -5, -5, -5, -4, -5, -3, -3, -5, -3, -3, -3, -3, -5, -4, -4, -3, -3, -4, -4, -4, -4, -4, -4, -3, 0, 0, -7, -5, 0, -2, -4, -1, -2, -4, -3, -3, -3, -4, -2, -4, -4, 0, 0, -4, -4, -4, -5, 0, 0, 0, 0, 0, -5, -5, -4, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 1, 0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 0, 1, 0, 2, 2, 2, 1, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, 1, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 4, 4, 3, 2, 4, 4, 2, 3, 4, 4, 3, 2, 3, 1, 3, 2, 4, 4, 4, 4, 2, 3, 2, 0, 0, 0, 5, 0, 0, 0, 3, 0, 4, 4, 1, 4, 4, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 3, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 3, 3, 3, 3, 2, 3, 2, 0, 0, 0, 4, 1, 1, 1, 4, 1, 3, 4, 0, 3, 3, 2, 3, 1, 2, 1, 3, 1, 4, 4, 4, 4, 2, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 2, -3, -2, 2, 2, 2, 2, 1, 2, 2, 1, -6, 1, 1, 2, 1, 2, 1, 2, 1, 0, -2, 2, 0, 1, -2, 0, -4, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 1, 1, 3, 5, 0, 0, 0, 0, 1, 3, 1, 0, 0, 0, 2, -2, 1, 1, 0,
+    0, 0, -5, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -2, -1, 0, 0, 0, 0, -1, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -6, -4, -3, -3, -4, -3, -3, -3, -3, -5, -3, -3, -3, -3, -4, -3, -3, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, -3, -7, -3, -3, -4, -3, -3, -5, -3, -4, -5, -3, -3, -5, -4, -6, -5, -4, 0, 0, -5, -3, 0, 0, -6, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -5, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -2, -1, 0, 0, -2, 0, -1, -7, -3, -3, -3, -3, -3, -3, -3, -3, -4, -6, -4, -3, -3, -4, -3, -3, -3, -3, -5, -5, -3, -5, -5, -6, -6, -3, 0, 0, -3, -4, -3, -3, -3, -3, -3, -3, -3, -7, -3, -3, -4, -3, -3, -5, -3, -4, -5, -3, -3, -5, -4, -6, -5, -4, 0, 0, -6, -3, 0, -2, -6, -3, -4, -3, -4, -4, -4, -3, -3, -3, -3, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -4, -1, -3, -3, -3, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, -3, -6, -3, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, -5, -3, 0, 0, -3, -1, -1, -3, -3, -3, -3, -3, -3, -4, -4, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 1, 1, 0, 2, 2, 2, 0, 1, 1, 0, 0, 1, 0, 1, 0, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 2, 0, 2, 2, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 4, 3, 0, 4, 4, 2, 2, 4, 4, 3, 0, 3, 0, 3, 1, 4, 4, 4, 4, 4, 4, 2, 0, 0, 0, 4, 0, 0, 0, 2, 0, 3, 4, 0, 3, 4, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -4, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -7, -1, -3, -2, 0, -4, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -4, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -4, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    5, 0, 1, 3, 0, 0, 0, 1, 0, 0, 3, 4, 4, 4, 2, 4, 3, 3, 4, 4, 0, 4, 2, 0, 2, 2, 2, 0, 2, 2, 1, 2, 2, 2, 2, 0, 2, 0, 2, 1, 1, 1, 1, 1, 2, 1, 2, 0, 0, 1, 2, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2, 2, 2, 0, 1, 0, 2, 2, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 4, 4, 2, 4, 4, 0, 2, 2, 2, 0, 2, 1, 1, 0, 4, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 2,
+    4, 0, 0, 2, 0, 0, 0, 2, 0, 0, 3, 2, 2, 3, 2, 2, 3, 0, 2, 2, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 3, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 1, 2, 1, 1, -2, 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 2, 1, 0, 1, 1, 1, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 1, 2, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 2, 1, 1, 0, 2, 1, 3, 1, 1, 2, 1, 0, 1, 0, 1, 2, -2, 0, -1, 0, 1, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 1, 2, 1, 1, -2, 0, 1, 2, 1, 2, 1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 2, 1, 0, 1, 1, 1, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 1, 2, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -4, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -1, -1, -5, -1, -1, -1, -1, -2, -2, -2, -1, -2, -2, -2, -2, -2, -1, -2, -1, 0, 0, -4, -2, 0, 0, -2, 0, 0, -2, -2, -2, -2, -2, -1, -2, -2, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, -1, 2, 0, 0, 0, 1, -3, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, -2, 0, 0, 0, -4, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair opendyslexic_12_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_12_bolditalic = {
     opendyslexic_12_bolditalicBitmaps,
     opendyslexic_12_bolditalicGlyphs,
     opendyslexic_12_bolditalicIntervals,
-    52,
+    53,
     46,
     33,
     -13,
     true,
+    opendyslexic_12_bolditalicKernLeftClasses,
+    128,
+    opendyslexic_12_bolditalicKernRightClasses,
+    124,
+    opendyslexic_12_bolditalicKernMatrix,
+    120,
+    117,
+    opendyslexic_12_bolditalicLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_italicBitmaps[62824] = {
+static const uint8_t opendyslexic_12_italicBitmaps[63418] = {
     0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00,
     0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
     0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00,
@@ -3934,7 +3934,44 @@ static const uint8_t opendyslexic_12_italicBitmaps[62824] = {
     0xC0, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFE, 0x40,
     0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0xAB, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFE,
-    0xA5, 0x00, 0x3E, 0xA5, 0x00, 0x00, 0x00, 0x00,
+    0xA5, 0x00, 0x3E, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x7F,
+    0xF0, 0x0F, 0xFC, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x3D,
+    0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x05, 0xF9, 0x55, 0x7F, 0x54, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x02,
+    0xF0, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x00,
+    0x7D, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00,
+    0x1F, 0x80, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xD0, 0x00,
+    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
+    0xBF, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xFF, 0xFB, 0xC0, 0x0B, 0xFF, 0xFB, 0x80, 0x00, 0xF8,
+    0x0B, 0x40, 0x01, 0xF4, 0x0F, 0x00, 0x02, 0xF0, 0x0F, 0x00, 0x03, 0xF0, 0x2E, 0x00, 0x03, 0xE0,
+    0x3D, 0x00, 0x07, 0xD0, 0x3C, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x1F, 0x80,
+    0xF8, 0x00, 0x2F, 0x81, 0xF4, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x07, 0xFF, 0x00, 0xF8, 0x00, 0x0F, 0x80,
+    0x00, 0xF4, 0x00, 0x1E, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x07,
+    0xC0, 0x07, 0xFF, 0xF8, 0x0B, 0xC0, 0x0B, 0xFF, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+    0x01, 0xF4, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x03,
+    0xE0, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0x0F, 0xC0,
+    0x01, 0xF0, 0x00, 0x1F, 0x80, 0x02, 0xF0, 0x00, 0x2F, 0x80, 0x03, 0xFA, 0x80, 0x3F, 0x40, 0x03,
+    0xFF, 0x80, 0x3F, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xF0, 0x02, 0xFF, 0xF4, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0xFD,
+    0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00,
+    0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x5F, 0x95, 0x57, 0xF5, 0x6E, 0x00, 0x03, 0xD0, 0x00, 0xF8,
+    0x0B, 0x40, 0x02, 0xF0, 0x00, 0x7D, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0x3E,
+    0x00, 0x0F, 0xC0, 0xB4, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x3D, 0x00, 0x0B, 0xC0, 0x02, 0xF4, 0x1F,
+    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x0B, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xBE, 0x00,
+    0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x40, 0x0B, 0xD0, 0xBD, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x03, 0xC0,
+    0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1E,
+    0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x02, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xC0, 0x00,
+    0xF0, 0x00, 0x0F, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x03, 0xE0, 0x01, 0x7E, 0x55, 0x5F, 0xD5, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x7C,
+    0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x00,
+    0xF8, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0x02, 0xF0, 0x00, 0x2F, 0x00,
+    0x0B, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x00, 0xFC,
+    0x00, 0x2F, 0x00, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0xEA, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x03,
+    0xFF, 0xC0, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
 };
 
 static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
@@ -4643,6 +4680,11 @@ static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
     { 20, 22, 28, 6, 20, 110, 62509 }, // ≠
     { 21, 19, 22, -1, 18, 100, 62619 }, // ≤
     { 22, 19, 22, 1, 18, 105, 62719 }, // ≥
+    { 22, 20, 25, 2, 20, 110, 62824 }, // ﬀ
+    { 16, 22, 22, 2, 22, 88, 62934 }, // ﬁ
+    { 20, 21, 25, 2, 21, 105, 63022 }, // ﬂ
+    { 25, 22, 32, 2, 22, 138, 63127 }, // ﬃ
+    { 29, 21, 34, 2, 21, 153, 63265 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_12_italicIntervals[] = {
@@ -4698,15 +4740,340 @@ static const EpdUnicodeInterval opendyslexic_12_italicIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_12_italicKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x27, 2 }, // '
+    { 0x28, 3 }, // (
+    { 0x29, 4 }, // )
+    { 0x2A, 5 }, // *
+    { 0x2C, 6 }, // ,
+    { 0x2D, 7 }, // -
+    { 0x2E, 8 }, // .
+    { 0x30, 9 }, // 0
+    { 0x31, 10 }, // 1
+    { 0x32, 11 }, // 2
+    { 0x33, 12 }, // 3
+    { 0x34, 13 }, // 4
+    { 0x35, 14 }, // 5
+    { 0x36, 15 }, // 6
+    { 0x37, 16 }, // 7
+    { 0x38, 17 }, // 8
+    { 0x39, 18 }, // 9
+    { 0x3A, 19 }, // :
+    { 0x3F, 20 }, // ?
+    { 0x41, 21 }, // A
+    { 0x42, 22 }, // B
+    { 0x43, 23 }, // C
+    { 0x44, 24 }, // D
+    { 0x45, 25 }, // E
+    { 0x46, 26 }, // F
+    { 0x47, 27 }, // G
+    { 0x48, 28 }, // H
+    { 0x49, 29 }, // I
+    { 0x4A, 30 }, // J
+    { 0x4B, 31 }, // K
+    { 0x4C, 32 }, // L
+    { 0x4D, 33 }, // M
+    { 0x4E, 34 }, // N
+    { 0x4F, 35 }, // O
+    { 0x50, 36 }, // P
+    { 0x51, 37 }, // Q
+    { 0x52, 38 }, // R
+    { 0x53, 39 }, // S
+    { 0x54, 40 }, // T
+    { 0x55, 41 }, // U
+    { 0x56, 42 }, // V
+    { 0x57, 43 }, // W
+    { 0x58, 44 }, // X
+    { 0x59, 45 }, // Y
+    { 0x5A, 46 }, // Z
+    { 0x5B, 47 }, // [
+    { 0x5D, 48 }, // ]
+    { 0x5E, 49 }, // ^
+    { 0x61, 50 }, // a
+    { 0x62, 51 }, // b
+    { 0x63, 52 }, // c
+    { 0x64, 53 }, // d
+    { 0x65, 54 }, // e
+    { 0x66, 55 }, // f
+    { 0x67, 56 }, // g
+    { 0x68, 57 }, // h
+    { 0x69, 58 }, // i
+    { 0x6A, 59 }, // j
+    { 0x6B, 60 }, // k
+    { 0x6C, 61 }, // l
+    { 0x6D, 62 }, // m
+    { 0x6E, 57 }, // n
+    { 0x6F, 63 }, // o
+    { 0x70, 64 }, // p
+    { 0x71, 65 }, // q
+    { 0x72, 66 }, // r
+    { 0x73, 67 }, // s
+    { 0x74, 68 }, // t
+    { 0x75, 69 }, // u
+    { 0x76, 70 }, // v
+    { 0x77, 71 }, // w
+    { 0x78, 72 }, // x
+    { 0x79, 73 }, // y
+    { 0x7A, 74 }, // z
+    { 0x7B, 75 }, // {
+    { 0x7D, 76 }, // }
+    { 0xC6, 77 }, // Æ
+    { 0xC7, 78 }, // Ç
+    { 0xCC, 79 }, // Ì
+    { 0xCD, 79 }, // Í
+    { 0xCE, 80 }, // Î
+    { 0xCF, 79 }, // Ï
+    { 0xD8, 81 }, // Ø
+    { 0xDE, 82 }, // Þ
+    { 0xDF, 83 }, // ß
+    { 0xEC, 84 }, // ì
+    { 0xED, 85 }, // í
+    { 0xEE, 86 }, // î
+    { 0xEF, 87 }, // ï
+    { 0xF0, 88 }, // ð
+    { 0xFE, 89 }, // þ
+    { 0x104, 90 }, // Ą
+    { 0x128, 79 }, // Ĩ
+    { 0x129, 91 }, // ĩ
+    { 0x12A, 79 }, // Ī
+    { 0x12B, 92 }, // ī
+    { 0x12E, 93 }, // Į
+    { 0x12F, 94 }, // į
+    { 0x130, 79 }, // İ
+    { 0x152, 95 }, // Œ
+    { 0x201C, 96 }, // “
+    { 0x201D, 97 }, // ”
+    { 0x201E, 98 }, // „
+};
+
+static const EpdKernClassEntry opendyslexic_12_italicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x27, 3 }, // '
+    { 0x28, 4 }, // (
+    { 0x29, 5 }, // )
+    { 0x2A, 6 }, // *
+    { 0x2C, 7 }, // ,
+    { 0x2D, 8 }, // -
+    { 0x2E, 9 }, // .
+    { 0x30, 10 }, // 0
+    { 0x31, 11 }, // 1
+    { 0x32, 12 }, // 2
+    { 0x33, 13 }, // 3
+    { 0x34, 14 }, // 4
+    { 0x35, 15 }, // 5
+    { 0x36, 16 }, // 6
+    { 0x37, 17 }, // 7
+    { 0x38, 18 }, // 8
+    { 0x39, 19 }, // 9
+    { 0x3A, 20 }, // :
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 25 }, // D
+    { 0x45, 26 }, // E
+    { 0x46, 27 }, // F
+    { 0x47, 28 }, // G
+    { 0x48, 29 }, // H
+    { 0x49, 30 }, // I
+    { 0x4A, 31 }, // J
+    { 0x4B, 32 }, // K
+    { 0x4C, 33 }, // L
+    { 0x4D, 34 }, // M
+    { 0x4E, 35 }, // N
+    { 0x4F, 36 }, // O
+    { 0x50, 37 }, // P
+    { 0x51, 38 }, // Q
+    { 0x52, 39 }, // R
+    { 0x53, 40 }, // S
+    { 0x54, 41 }, // T
+    { 0x55, 42 }, // U
+    { 0x56, 43 }, // V
+    { 0x57, 44 }, // W
+    { 0x58, 45 }, // X
+    { 0x59, 46 }, // Y
+    { 0x5A, 47 }, // Z
+    { 0x5B, 48 }, // [
+    { 0x5D, 49 }, // ]
+    { 0x5E, 50 }, // ^
+    { 0x61, 51 }, // a
+    { 0x62, 52 }, // b
+    { 0x63, 53 }, // c
+    { 0x64, 54 }, // d
+    { 0x65, 55 }, // e
+    { 0x66, 56 }, // f
+    { 0x67, 57 }, // g
+    { 0x68, 58 }, // h
+    { 0x69, 59 }, // i
+    { 0x6A, 60 }, // j
+    { 0x6B, 61 }, // k
+    { 0x6C, 62 }, // l
+    { 0x6D, 63 }, // m
+    { 0x6E, 64 }, // n
+    { 0x6F, 65 }, // o
+    { 0x70, 66 }, // p
+    { 0x71, 67 }, // q
+    { 0x72, 68 }, // r
+    { 0x73, 69 }, // s
+    { 0x74, 70 }, // t
+    { 0x75, 71 }, // u
+    { 0x76, 72 }, // v
+    { 0x77, 73 }, // w
+    { 0x78, 74 }, // x
+    { 0x79, 75 }, // y
+    { 0x7A, 76 }, // z
+    { 0x7B, 77 }, // {
+    { 0x7D, 78 }, // }
+    { 0xC6, 79 }, // Æ
+    { 0xC7, 80 }, // Ç
+    { 0xD8, 81 }, // Ø
+    { 0xDE, 82 }, // Þ
+    { 0xDF, 83 }, // ß
+    { 0xEC, 84 }, // ì
+    { 0xED, 85 }, // í
+    { 0xEE, 86 }, // î
+    { 0xEF, 87 }, // ï
+    { 0xF0, 88 }, // ð
+    { 0x129, 89 }, // ĩ
+    { 0x12B, 90 }, // ī
+    { 0x12F, 91 }, // į
+    { 0x152, 92 }, // Œ
+    { 0x201C, 93 }, // “
+    { 0x201D, 94 }, // ”
+    { 0x201E, 95 }, // „
+};
+
+static const int8_t opendyslexic_12_italicKernMatrix[9310] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2, -1, -2, -4, -1, -3, 0, -3, -2, 0, 0, -2, 0, -3, 0, 0, -1, -2, 0, 0, -1, -2, -1, 0, -1, -3, -1, -3, -1, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -3, 0, -3, -2, -3, -2, -1, 0, 0, 0, 0, 0, -2, -2, -3, -1, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, -4, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -3, -2, 0, -4, 0, 0, -3, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, -2, 0, -3, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0,
+    0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -2, 0, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 1, 0, 2, 0, 0, 0, 0, 0, 3, 0, 3, 2, 2, 2, 2, 2, 0, 1, 2, 3, 2, 1, 2, 1, 2, 1, 3, 3, 4, 4, 2, 3, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, -1, -4, 0, 0, 0, 0, -4, -4, -7, -4, -4, -4, -7, -4, -3, -9, -4, -4, -4, -4, -7, -4, -5, -4, -5, -11, -7, -11, -9, -4, -10, -4, 0, -4, 0, -4, -5, -4, -4, -4, -4, -4, -2, -2, -3, -2, -2, 0, -2, -4, -3, -4, -2, -3, -6, -4, -8, -6, -2, -8, -2, 0, -4, -4, -7, -5, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -7, -5, -4, 0,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -6, -4, -4, -4, -5, -5, -5, -5, -4, -10, -5, -5, -5, -5, -5, -5, -2, -5, -6, -7, -5, -8, -7, -7, -8, -5, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -2, -1, 0, 0, -2, -7, -4, -5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -5, -4, -5, -4, -4, -4, -5, -4, -4, -9, -5, -4, -4, -4, -5, -4, -3, -4, -4, -4, -4, -5, -4, -5, -5, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -4, -2, 0, -4, 0, 0, 0, -5, -5, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -7, -4, -4, -4, -5, -5, -4, -5, -4, -10, -5, -5, -5, -5, -4, -5, -2, -5, -8, -8, -5, -8, -7, -9, -9, -6, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 1, -1, 1, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, -3, -8, -4, -4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -1, 0, 0, 0, 0, 0, -4, -4, -6, -4, -4, -4, -6, -4, -3, -9, -4, -4, -4, -4, -6, -4, -4, -4, -5, -5, -5, -5, -5, -4, -5, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, -2, 0, -4, 0, 0, 0, -4, -6, -5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, -1, 0,
+    -2, 0, 0, 0, 0, 0, -9, 0, -8, 0, -1, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, -10, -4, -6, -4, -5, -6, -6, -5, -4, -10, -6, -6, -6, -6, -6, -6, -4, -6, -8, -4, -4, -4, -4, -6, -4, -7, 0, 0, 0, -5, -2, -4, -5, -5, -4, -4, -4, -4, -3, -3, -4, -1, -4, -4, -5, -4, -5, -5, -4, -4, -4, -4, -6, -4, -6, 0, 0, -12, -6, -6, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, -6, 0, 0, -7,
+    -1, 0, 0, 0, -3, 0, -2, 0, -1, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, -7, -4, -4, -4, -5, -5, -5, -5, -4, -10, -5, -5, -5, -5, -5, -5, -2, -5, -6, -8, -5, -8, -8, -7, -8, -6, 0, -2, 0, -2, -3, -2, -2, -2, -4, -2, -3, -3, -3, -3, -2, 0, -3, -2, -4, -2, -3, -4, -5, -3, -4, -4, -5, -5, -4, 0, -2, -7, -4, -5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, -2, -3, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -5, -4, -4, -4, -5, -4, -3, -9, -4, -4, -4, -4, -5, -4, -3, -4, -4, -5, -5, -6, -6, -4, -6, -4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -5, -5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, -3, -4, -3, -3, -3, -4, -3, -2, -7, -3, -3, -3, -3, -4, -3, -1, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, -4, -5, -4, -5, -6, -5, -5, -4, -6, -6, -6, -6, -6, -5, -6, -3, -6, -6, -4, -4, -4, -4, -6, -4, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, -5, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, -1,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, -6, 0, -2, -2, -2, 0, 0, 0, -4, -4, -9, -4, -4, -4, -9, -4, -3, -9, -4, -4, -4, -4, -9, -4, -7, -4, -6, -7, -7, -7, -7, -4, -7, -4, 0, -2, 0, -2, -2, -2, -2, -2, -1, -2, 0, 0, -3, 0, 0, 0, 0, -2, 0, -2, 0, 0, -2, -2, -4, -2, 0, -4, 0, 0, -2, -4, -9, -5, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -9, -2, -3, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -7, 0, 0, -4, 0, 0, 0, 0, -4, -4, -5, -4, -4, -4, -5, -4, -3, -9, -4, -4, -4, -4, -6, -4, -3, -4, -4, -11, -5, -10, -8, -4, -10, -4, 0, -4, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -4, -2, 0, -4, 0, 0, -4, -4, -5, -5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, -8, -8, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -5, -4, -4, -4, -5, -4, -3, -9, -4, -4, -4, -4, -5, -4, -3, -4, -4, -6, -6, -6, -6, -4, -6, -4, 0, 0, 0, 1, 0, 1, 2, 1, 0, 1, 1, 1, -2, 2, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, -4, -5, -5, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, -4, -5, -4, -5, -6, -5, -5, -4, -10, -6, -6, -6, -6, -5, -6, -3, -6, -6, -4, -4, -4, -4, -6, -4, -6, 0, 0, 0, -3, -2, -3, -3, -3, -3, -3, -4, -3, -3, -4, -3, 0, -4, -3, -4, -3, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 0, -6, -5, -5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, -1,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -7, -4, -4, -4, -5, -5, -4, -5, -4, -10, -5, -5, -5, -5, -4, -5, -2, -5, -7, -6, -5, -7, -6, -8, -8, -6, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, -2, 0, -1, 0, -3, -8, -4, -4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1,
+    0, 3, 0, 0, -2, 0, -7, -6, -6, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -10, -4, -6, -4, -5, -5, -5, -5, -4, -10, -6, -5, -5, -6, -5, -5, -3, -6, -6, -5, -5, -6, -6, -8, -6, -8, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, -13, -6, -5, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -5, 0, 0, -8,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -2, -2, -1, 0, 0, -2, 0, 0, 0, 0, -5, -3, -4, -3, -4, -4, -3, -4, -2, -2, -4, -4, -4, -4, -3, -4, -1, -4, -6, -5, -4, -6, -5, -5, -7, -5, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -2, 0, -2, 0, 0, -5, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2, 0, 0,
+    0, 1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, -4, -4, -6, -4, -4, -4, -6, -4, -3, -9, -4, -4, -4, -4, -6, -4, -4, -4, -5, -7, -6, -8, -8, -4, -8, -4, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -3, -4, -6, -5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, -2, -1, 0,
+    0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -6, -4, -5, -4, -5, -5, -5, -5, -4, -10, -5, -5, -5, -5, -5, -5, -3, -5, -7, -8, -5, -8, -8, -8, -8, -5, 0, -2, 0, 2, 1, 1, 2, 2, -1, 1, 1, 1, -3, 1, 1, 0, 1, 2, 0, 2, 0, 0, -1, 1, -2, -1, -2, -2, 0, 0, -2, -7, -5, -5, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, -5, -2, -4, 0,
+    -2, 3, 0, 0, 0, -2, -8, -3, -6, -1, -4, 0, 0, -6, 0, -1, 0, 0, -1, -3, -3, -11, -4, -8, -4, -5, -6, -6, -5, -4, -10, -6, -5, -6, -6, -7, -6, -5, -6, -7, -4, -4, -4, -4, -6, -4, -7, 0, 0, -4, -9, -2, -9, -9, -9, -5, -9, -4, -3, -3, -3, -3, -5, -9, -9, -10, -9, -9, -9, -8, -10, -10, -10, -9, -10, -9, 0, 0, -11, -8, -7, 1, 0, 0, 0, 0, -2, -5, 0, 1, 0, -7, 0, 0, -6,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -7, -4, -5, -4, -5, -6, -5, -5, -4, -10, -6, -6, -6, -6, -5, -6, -3, -6, -7, -4, -4, -4, -4, -6, -4, -6, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -8, -5, -5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -4, 0, -1, 0, -1, 0, 0, -1, -12, -4, -8, -4, -5, -6, -7, -5, -4, -10, -6, -6, -6, -6, -7, -6, -5, -6, -8, -4, -4, -4, -4, -6, -4, -7, 0, 0, 0, -3, 1, -2, -2, -2, 0, -2, 0, 0, -3, 0, 0, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, -3, -1, -3, 0, 0, -12, -8, -7, 1, -1, 0, 0, 0, 0, -2, 0, 0, 0, -7, 0, 0, -5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -3, 0, -1, 0, -1, 0, 0, 0, -10, -4, -7, -4, -5, -6, -6, -5, -4, -10, -6, -6, -6, -6, -6, -6, -4, -6, -8, -4, -4, -4, -4, -6, -4, -7, 0, 0, 0, -2, 1, -2, -2, -2, 0, -2, 0, 0, -3, 0, 0, -2, -1, -2, -2, -2, -2, -2, 0, 0, 0, 0, -2, 0, -2, 0, 0, -10, -7, -6, 1, -1, 0, 0, 0, 0, -2, 0, 1, 0, -6, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -4, 0, -2, 0, -1, 0, 0, 0, -4, -4, -8, -4, -4, -4, -8, -4, -3, -9, -4, -4, -4, -4, -8, -4, -6, -4, -5, -5, -5, -5, -5, -4, -5, -4, 0, 0, 0, -1, 1, -2, -1, -2, -1, -2, 1, 1, -2, 1, 1, 1, 1, -2, 0, -2, 1, 0, -2, -1, -2, -2, 0, -2, 1, 0, 0, -4, -8, -5, 2, 1, 0, 0, 0, 0, -2, 0, 0, 0, -8, 0, -1, 0,
+    0, 2, 0, -2, 0, 0, -4, -2, -3, -2, -1, 0, 0, -6, 0, -2, 0, -2, -1, 0, -3, -11, -4, -9, -4, -6, -6, -8, -5, -4, -10, -6, -6, -6, -6, -8, -6, -6, -6, -9, -4, -4, -4, -4, -6, -4, -7, 0, 0, -2, -4, 1, -4, -4, -4, -2, -4, 0, 0, -3, 0, 0, -3, -2, -4, -3, -4, -3, -4, -2, -1, -2, -2, -4, -2, -4, 0, 0, -11, -9, -8, 0, -2, 0, 0, 0, 0, -4, 0, 0, 0, -8, 0, 0, -6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, 0, 0, -4, -4, -7, -4, -4, -4, -6, -4, -3, -9, -4, -4, -4, -4, -7, -4, -5, -4, -5, -5, -5, -5, -5, -5, -5, -4, 0, 0, 0, 0, 1, -1, -1, -1, -1, -1, 1, 1, -3, 1, 1, 1, 1, -1, 0, -1, 1, 0, -1, -1, -1, -1, 0, -1, 1, 0, -2, -4, -7, -5, 2, 1, 0, 0, 0, 0, -1, 0, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, -1, 0, 0, 0, 0, 0, -4, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -4, 0, -4, -3, -4, -1, -1, 0, 0, 0, 0, 0, -4, -4, -4, 0, -4, -4, -4, -2, -4, -4, -4, -5, -1, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -3, 0, 0, -4, 0, 0, 1, -2, 0, 0, 0, 0, 1, -9, 0, -2, -2, 1, -3, 0, 0, 0, 0, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, -2, -2, -2, -2, -2, -2, -3, -2, -3, -3, -2, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -4, 1, 2, 1, 1, -3, -2, 1, 0, -4, 0, 1, 2, -3, 1, 1, 1, 1, 0, -9, 1, -2, -1, -2, -4, 0, 0, 0, 0, -2, -2, -2, -2, -2, -3, -2, -2, -2, -3, -2, -2, 0, -2, -2, -3, -2, -2, -3, -3, -2, -4, -3, -5, -4, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1,
+    0, 1, 0, 0, -1, -2, 0, -5, 0, -1, 0, 0, 0, -5, 0, -1, -4, -1, 0, 0, 0, -2, 0, -1, 0, 0, -2, -4, 0, 0, -4, 0, 0, 1, -2, -1, 0, -1, 0, 1, -9, -1, -2, -2, 0, -3, 0, 0, 0, -2, -4, -4, -4, -4, -4, -3, -4, -2, -2, -3, -2, -2, 0, -2, -4, -2, -4, -2, -2, -3, -3, -3, -3, -2, -4, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, -3, 0, 0, -4, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, 0, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 2, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -3, 0, 1, 1, 0, -3, -2, 0, 0, -4, 0, 0, 1, -3, 1, 0, 1, 0, 1, -9, 0, -2, -1, 0, -4, 0, 0, 0, 0, -2, -2, -2, -2, -2, -3, -2, -2, -2, -3, -2, -2, 0, -2, -2, -3, -2, -2, -2, -3, -2, -4, -3, -3, -4, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 2, 0, 0, 0, 0, -3, 0, -2, 0, -2, -2, -1, -3, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0, 0, -3, -2, 0, 0, -4, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, -2, -2, -3, -3, -2, -2, -2, -2, -3, -2, -2, 0, -2, -3, -3, -3, -2, -3, -2, -2, -2, -2, -4, -2, -4, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -3,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -10, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -2, -2, 0, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -3, 0, 0, -4, 0, 0, 1, -2, 0, 0, 0, 0, 1, -9, 0, -2, -2, 1, -4, 0, 0, 0, 0, -2, -3, -2, -2, -2, -3, -2, -2, -2, -3, -2, -2, 0, -2, -2, -2, -2, -2, -2, -3, -2, -4, -3, -2, -4, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -3, 0, 0, -4, 0, 0, 1, -2, 0, 0, 0, 0, 1, -3, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 2, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -4, 0, -4, 0, -2, 0, 0, 0, -6, 0, -3, -4, -2, 0, 0, 0, -2, 0, -2, 0, 0, -2, -6, 0, 0, -4, 0, 0, 1, -2, -3, 0, -3, 0, 0, -9, -2, -4, -3, 1, -5, 0, 0, 0, -4, -4, -5, -5, -5, -5, -3, -5, -2, -2, -3, -2, -2, 0, -2, -5, -2, -5, -2, -3, -5, -4, -5, -5, -2, -5, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -4, -3, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -4, 0, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -4, 0, 0, -4, 0, 0, 1, -2, -1, 0, 0, 0, 1, -5, 0, -2, -2, 1, -2, 0, 0, 0, -1, -2, -3, -2, -3, -3, -3, -3, -2, -2, -3, -2, -2, 0, -2, -3, -2, -3, -2, -2, -4, -3, -4, -4, -2, -4, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 1, 0, 0, 0, 0, 0, 1, -5, 0, -2, -2, 1, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 1, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, -4, 0, 1, 0, 0, -3, -2, 0, 0, -4, 0, 0, 1, -3, 0, 0, 0, 0, 0, -9, 0, -2, -1, -2, -4, 0, 0, 0, 0, -2, -2, -2, -2, -2, -3, -2, -2, -2, -3, -2, -2, 0, -2, -2, -3, -2, -2, -3, -3, -2, -4, -3, -4, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1,
+    0, 1, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, -4, 0, 0, 0, 0, -3, -2, 0, 0, -4, 0, 0, 0, -3, 0, 0, 0, 0, 0, -9, 0, -2, -1, -2, -4, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, 0, -2, -2, -3, -2, -2, -3, -3, -2, -4, -3, -4, -4, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1,
+    -2, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -3, -2, -2, -7, -2, -1, 0, -2, -6, -2, -2, -2, -2, -6, -5, -2, -2, 0, -3, -2, -2, -6, -2, -2, -2, -2, -2, -12, -2, -3, -3, -2, -4, -3, 0, 0, 0, -5, -5, -5, -5, -5, -4, -3, -5, -4, 0, -5, -4, -3, -5, -5, -2, -5, -5, -5, -4, -4, -4, -4, -5, -3, -5, -2, 0, 0, 0, 0, -2, -2, -2, -2, -2, 0, -2, -2, -2, 0, 0, -2, -2, 0,
+    0, 2, 0, 0, -2, 0, -4, -2, -3, 0, -3, -3, -2, -2, 0, 0, -6, 0, 0, 0, 0, -6, 0, 0, 0, 0, -3, -2, 0, 0, -4, 0, 0, 0, -3, 0, 0, 0, 0, 0, -9, 0, -1, 0, -3, -2, -4, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, 0, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -4, -2, -4, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -4,
+    0, 2, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, -3, 0, 0, -4, 0, 0, 1, -2, 0, 0, 0, 0, 0, -9, 0, -2, -2, 0, -3, 0, 0, 0, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, 0, -2, -2, -3, -2, -2, -2, -3, -2, -2, -2, -3, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, -2, 0,
+    0, 2, 0, 0, -2, -2, 0, -2, 0, 0, 0, 0, 0, -4, 0, 0, -4, 0, 0, 0, -1, -2, 0, 0, 0, 0, -2, -2, 0, 0, -4, 0, 0, 0, -2, 0, 0, 0, 0, 0, -6, 0, -2, -1, 0, -2, 0, 0, 0, -1, -2, -2, -2, -2, -3, -2, -2, -2, -2, -3, -2, -2, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -3, 0, 0, -4, 0, 0, 1, -2, 0, 0, 0, 0, 1, -9, 0, -1, 0, 1, -2, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 2, 0, 0, -1, 0, -5, 0, -3, 0, -3, -4, -4, -3, 0, 0, -8, 0, 0, 0, 0, -7, 0, 0, 0, 0, -3, -2, 0, 0, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, -10, 0, 0, 0, -3, -2, -4, 0, 0, 0, -4, -2, -3, -4, -4, -2, -4, -2, -2, -4, -2, -2, -1, -2, -4, -3, -4, -2, -4, -2, -2, -2, -2, -4, -2, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 0, 0, -5,
+    -1, 2, 0, 0, -1, 0, -3, 0, -1, 0, -2, -2, -2, -2, 0, 0, -7, 0, 0, 0, 0, -6, 0, 0, 0, 0, -3, -2, 0, 0, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, -10, 0, 0, 0, -2, -2, -2, 0, 0, 0, -3, -2, -3, -3, -3, -2, -3, -2, -2, -3, -2, -2, -1, -2, -3, -3, -3, -2, -3, -2, -2, -2, -2, -4, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 0, 0, -3,
+    0, 1, 0, -1, -2, -1, 0, -2, 0, -1, 0, 0, 0, -5, 0, -1, -4, -1, 0, 0, -1, -2, 0, -2, 0, 0, -2, -3, 0, 0, -4, 0, 0, 0, -2, -1, 0, -1, 0, -1, -9, -1, -2, -2, 0, -3, 0, 0, 0, -2, -4, -2, -4, -4, -4, -2, -4, -2, -2, -4, -2, -2, 0, -2, -4, -2, -4, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, -1, -1,
+    -1, 2, 0, 0, -1, 0, -3, 0, -1, 0, -2, -2, -2, -2, 0, 0, -7, 0, 0, 0, 0, -6, 0, 0, 0, 0, -3, -2, 0, 0, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, -10, 0, 0, 0, -2, -1, -2, 0, 0, 0, -3, -2, -3, -3, -3, -2, -3, -2, -2, -4, -2, -2, -1, -2, -3, -3, -3, -3, -3, -2, -2, -2, -2, -3, -2, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 0, 0, -4,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -4, 0, 0, 1, -2, 0, 0, 0, 0, 0, -9, 0, -1, 0, 0, -2, 0, 0, 0, 0, -3, -2, -2, -3, -3, -2, -3, -2, -2, -3, -2, -2, 0, -2, -3, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -5, 0, -2, 0, -2, -1, 0, 0, -4, 0, -3, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -3, 0, -3, 0, -2, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -4, 0, -4, -3, -4, -2, -1, 0, 0, 0, 0, 0, -4, -4, -4, 0, -4, -4, -4, -2, -3, -3, -3, -4, -1, -4, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -6, -4, -4, -4, -6, -4, -3, -9, -4, -4, -4, -4, -6, -4, -4, -4, -5, -5, -5, -5, -5, -4, -5, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -6, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, -4, -5, -4, -4, -4, -5, -4, -4, -7, -5, -4, -4, -4, -5, -4, -3, -4, -4, -4, -4, -5, -4, -5, -5, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, -5, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2, -2, 0, 1, 1, 0, 1, 1, 4, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -3, -4, -2, -1, 0, 0, -6, 0, 0, 0, 0, -2, 1, 1, 1, 0, 0, 1, 0, 0, -4, 0, 0, 1, 0, 1, 0, 1, 0, -1, -5, 0, -2, -1, -4, -3, -3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -4, -1, -2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -8,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 4, 4, 0, 3, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 1, 1, -2, 1, 1, 0, 1, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 4, 4, 0, 3, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -4, 0, 0, -3, 0, 0, 0, 0, -4, 1, 1, 1, 0, 0, 1, 0, 0, -4, 0, 0, 1, 0, 1, 0, 1, 0, 0, -3, 0, 0, 0, -2, -1, -5, 0, 0, 0, -2, 0, -1, -1, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -4, 0, 0, 0, 0, 0, 0, -6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 0, 2, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 1, 4, 1, 0, 4, 5, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, -2, -2, -2, 0, -2, 0, 0, -3, 0, 0, -2, -1, -2, -2, -2, -1, -2, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, -4, -2, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -4, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair opendyslexic_12_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_12_italic = {
     opendyslexic_12_italicBitmaps,
     opendyslexic_12_italicGlyphs,
     opendyslexic_12_italicIntervals,
-    52,
+    53,
     46,
     33,
     -13,
     true,
+    opendyslexic_12_italicKernLeftClasses,
+    105,
+    opendyslexic_12_italicKernRightClasses,
+    95,
+    opendyslexic_12_italicKernMatrix,
+    98,
+    95,
+    opendyslexic_12_italicLigatures,
+    5,
 };
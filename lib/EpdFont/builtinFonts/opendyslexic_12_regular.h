@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_regularBitmaps[53300] = {
+static const uint8_t opendyslexic_12_regularBitmaps[53863] = {
     0x01, 0x80, 0x3C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xFC, 0x0F,
     0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x1F, 0xC1, 0xFC, 0x00, 0x40, 0x00, 0x3F, 0x83,
     0xF8, 0x7F, 0xCB, 0xFC, 0xFF, 0xC0, 0xBF, 0x83, 0xFC, 0xBF, 0x43, 0xFC, 0xBF, 0x03, 0xFC, 0xBF,
@@ -3339,7 +3339,42 @@ static const uint8_t opendyslexic_12_regularBitmaps[53300] = {
     0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x01, 0xBF, 0xFF, 0xE4, 0x01, 0xFF, 0xFF,
     0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x05, 0xAF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xA9, 0x42, 0xEA,
-    0x50, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x0B, 0xE0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xE0, 0x00,
+    0xB8, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0xE5, 0x55, 0xF8, 0x00, 0x7D, 0x00, 0x0F,
+    0x40, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x7D,
+    0x00, 0x1F, 0x80, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
+    0x00, 0xBE, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+    0x01, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x6F, 0x83, 0xFC, 0x01, 0xFF, 0x83, 0xFC, 0x03, 0xD0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
+    0xC0, 0xF0, 0x7F, 0xFF, 0xC0, 0xF0, 0x07, 0xD0, 0x00, 0xF0, 0x07, 0xD0, 0x00, 0xF0, 0x07, 0xD0,
+    0x00, 0xF0, 0x07, 0xD0, 0x00, 0xF0, 0x07, 0xD0, 0x00, 0xF0, 0x07, 0xD0, 0x01, 0xF0, 0x07, 0xD0,
+    0x01, 0xF0, 0x07, 0xD0, 0x01, 0xF0, 0x07, 0xE0, 0x01, 0xF4, 0x0B, 0xE0, 0x02, 0xF4, 0x0B, 0xE0,
+    0x02, 0xF4, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x00, 0xF8, 0x00,
+    0x1F, 0xF8, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x00,
+    0x01, 0xF0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xF0, 0x2F, 0x00, 0x7F, 0xFF, 0xC0, 0xBC,
+    0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x07,
+    0xD0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00,
+    0x3E, 0x00, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x0F, 0xFE,
+    0x02, 0xF8, 0x00, 0x3F, 0xFC, 0x0B, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x06, 0xF8, 0x00, 0xBE, 0x0B, 0xF0, 0x07, 0xFE, 0x01,
+    0xFF, 0xC3, 0xFC, 0x03, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x00,
+    0x3C, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x3C, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x01, 0x7E, 0x55, 0x5F, 0x80, 0x03, 0xC0, 0x1F,
+    0x40, 0x03, 0xD0, 0x00, 0xF0, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x3C, 0x01, 0xF4, 0x00, 0x3E, 0x00,
+    0x0F, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x1F, 0x40, 0x07, 0xE0, 0x00, 0xF0, 0x07, 0xD0,
+    0x01, 0xF8, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0x40, 0x7E, 0x00, 0x1F, 0x80, 0x07,
+    0xD0, 0x2F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x02, 0xF8, 0x00,
+    0x7F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x0B, 0xE0,
+    0x0B, 0x80, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xB8, 0x00, 0x0F, 0x40,
+    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x07, 0xC0,
+    0x00, 0xF0, 0x00, 0x1F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x1F, 0x00, 0x17, 0xE5, 0x55, 0xF8, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x2F,
+    0x00, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x07,
+    0xD0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x01,
+    0xF8, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00,
+    0x3F, 0x00, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0x3F, 0xF8, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0x3F, 0xFC,
+    0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x2F, 0xFC,
 };
 
 static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
@@ -4048,6 +4083,11 @@ static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
     { 16, 22, 28, 6, 20, 88, 53030 }, // ≠
     { 19, 19, 22, 1, 18, 91, 53118 }, // ≤
     { 19, 19, 22, 1, 18, 91, 53209 }, // ≥
+    { 18, 20, 25, 3, 20, 90, 53300 }, // ﬀ
+    { 16, 22, 22, 3, 22, 88, 53390 }, // ﬁ
+    { 19, 21, 25, 3, 21, 100, 53478 }, // ﬂ
+    { 25, 22, 32, 3, 22, 138, 53578 }, // ﬃ
+    { 28, 21, 34, 3, 21, 147, 53716 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_12_regularIntervals[] = {
@@ -4103,15 +4143,94 @@ static const EpdUnicodeInterval opendyslexic_12_regularIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_12_regularKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 1 }, // "
+    { 0x23, 1 }, // #
+    { 0x27, 1 }, // '
+    { 0x28, 1 }, // (
+    { 0x29, 1 }, // )
+    { 0x2A, 1 }, // *
+    { 0x2C, 1 }, // ,
+    { 0x2D, 1 }, // -
+    { 0x2E, 1 }, // .
+    { 0x2F, 1 }, // /
+    { 0x3A, 1 }, // :
+    { 0x3B, 1 }, // ;
+    { 0x3F, 1 }, // ?
+    { 0x5B, 1 }, // [
+    { 0x5C, 1 }, // <backslash>
+    { 0x5D, 1 }, // ]
+    { 0x5F, 1 }, // _
+    { 0x7B, 1 }, // {
+    { 0x7D, 1 }, // }
+    { 0xA1, 1 }, // ¡
+    { 0xAB, 1 }, // «
+    { 0xAD, 1 }, // ­
+    { 0xB7, 1 }, // ·
+    { 0xBB, 1 }, // »
+    { 0xBF, 1 }, // ¿
+    { 0x2010, 1 }, // ‐
+    { 0x2011, 1 }, // ‑
+    { 0x2012, 1 }, // ‒
+    { 0x2013, 1 }, // –
+    { 0x2014, 1 }, // —
+    { 0x2015, 1 }, // ―
+    { 0x2016, 1 }, // ‖
+    { 0x2017, 1 }, // ‗
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 1 }, // ‚
+    { 0x201B, 1 }, // ‛
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 1 }, // „
+    { 0x201F, 1 }, // ‟
+    { 0x2022, 1 }, // •
+    { 0x2023, 1 }, // ‣
+    { 0x2024, 1 }, // ․
+    { 0x2025, 1 }, // ‥
+    { 0x2026, 1 }, // …
+    { 0x2027, 1 }, // ‧
+    { 0x2039, 1 }, // ‹
+    { 0x203A, 1 }, // ›
+};
+
+static const EpdKernClassEntry opendyslexic_12_regularKernRightClasses[] = {
+    { 0x20, 1 }, //  
+};
+
+static const int8_t opendyslexic_12_regularKernMatrix[1] = {
+    4,
+};
+
+static const EpdLigaturePair opendyslexic_12_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_12_regular = {
     opendyslexic_12_regularBitmaps,
     opendyslexic_12_regularGlyphs,
     opendyslexic_12_regularIntervals,
-    52,
+    53,
     46,
     33,
     -13,
     true,
+    opendyslexic_12_regularKernLeftClasses,
+    50,
+    opendyslexic_12_regularKernRightClasses,
+    1,
+    opendyslexic_12_regularKernMatrix,
+    1,
+    1,
+    opendyslexic_12_regularLigatures,
+    5,
 };
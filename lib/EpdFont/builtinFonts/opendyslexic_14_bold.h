@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_boldBitmaps[83030] = {
+static const uint8_t opendyslexic_14_boldBitmaps[83900] = {
     0x00, 0x00, 0x00, 0x30, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xC0,
     0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x00,
     0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0xFC, 0x00,
@@ -5197,7 +5197,61 @@ static const uint8_t opendyslexic_14_boldBitmaps[83030] = {
     0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
     0x5A, 0x80, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xC0, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
     0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFE, 0x95, 0x00, 0xBF, 0xE9, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xFC, 0x00,
+    0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0xFC,
+    0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD,
+    0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00,
+    0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x07,
+    0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE,
+    0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00,
+    0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC,
+    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0xFC, 0x0F, 0xFE, 0x02,
+    0xFF, 0xFC, 0x1F, 0xFE, 0x03, 0xFF, 0xFC, 0x1F, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8,
+    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x02, 0xA4, 0xBF, 0xFF, 0xFD,
+    0x03, 0xFC, 0xBF, 0xFF, 0xFD, 0x03, 0xFC, 0xBF, 0xFF, 0xFD, 0x03, 0xF8, 0x07, 0xFD, 0x00, 0x03,
+    0xF8, 0x07, 0xFD, 0x00, 0x03, 0xF8, 0x07, 0xFD, 0x00, 0x03, 0xF8, 0x07, 0xFD, 0x00, 0x07, 0xF8,
+    0x07, 0xFD, 0x00, 0x07, 0xF8, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x0B, 0xFD, 0x00, 0x07, 0xFC, 0x0B,
+    0xFD, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x0B, 0xFC, 0x0B, 0xFE,
+    0x00, 0x0B, 0xFC, 0x0B, 0xFE, 0x00, 0x0B, 0xFD, 0x0B, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0xAA, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x02,
+    0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF,
+    0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0xBF, 0xFF, 0xFD,
+    0x02, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x02, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x02, 0xFE, 0x00, 0xBF,
+    0xFF, 0xFD, 0x02, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD,
+    0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00,
+    0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x0B,
+    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF,
+    0xF8, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x0B, 0xFE, 0x00,
+    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x2F,
+    0xFC, 0x1F, 0xFC, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x1F, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0xFF,
+    0xFC, 0x2F, 0xFD, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x2F, 0xFD, 0x07, 0xF8, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x06, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x0B, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x0B, 0xF4, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xF4, 0x0B, 0xFC, 0x00, 0x0B, 0xFC,
+    0x00, 0x0B, 0xF4, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
+    0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
+    0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
+    0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
+    0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x0F, 0xFD,
+    0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAA, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFC,
+    0x00, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x03,
+    0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF,
+    0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00,
+    0x01, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x02, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFE, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xFD, 0x00,
+    0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03,
+    0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD,
+    0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFD, 0x00,
+    0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x0B,
+    0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF,
+    0xF8, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00,
+    0x03, 0xFF, 0xFC, 0x0B, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xFC,
 };
 
 static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
@@ -5906,6 +5960,11 @@ static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
     { 22, 26, 36, 7, 23, 143, 82574 }, // ≠
     { 25, 25, 23, -1, 21, 157, 82717 }, // ≤
     { 24, 26, 25, 1, 22, 156, 82874 }, // ≥
+    { 24, 24, 32, 4, 24, 144, 83030 }, // ﬀ
+    { 20, 27, 28, 4, 27, 135, 83174 }, // ﬁ
+    { 24, 25, 32, 4, 25, 150, 83309 }, // ﬂ
+    { 32, 27, 39, 5, 27, 216, 83459 }, // ﬃ
+    { 36, 25, 44, 4, 25, 225, 83675 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_14_boldIntervals[] = {
@@ -5961,15 +6020,94 @@ static const EpdUnicodeInterval opendyslexic_14_boldIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_14_boldKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 1 }, // "
+    { 0x23, 1 }, // #
+    { 0x27, 1 }, // '
+    { 0x28, 1 }, // (
+    { 0x29, 1 }, // )
+    { 0x2A, 1 }, // *
+    { 0x2C, 1 }, // ,
+    { 0x2D, 1 }, // -
+    { 0x2E, 1 }, // .
+    { 0x2F, 1 }, // /
+    { 0x3A, 1 }, // :
+    { 0x3B, 1 }, // ;
+    { 0x3F, 1 }, // ?
+    { 0x5B, 1 }, // [
+    { 0x5C, 1 }, // <backslash>
+    { 0x5D, 1 }, // ]
+    { 0x5F, 1 }, // _
+    { 0x7B, 1 }, // {
+    { 0x7D, 1 }, // }
+    { 0xA1, 1 }, // ¡
+    { 0xAB, 1 }, // «
+    { 0xAD, 1 }, // ­
+    { 0xB7, 1 }, // ·
+    { 0xBB, 1 }, // »
+    { 0xBF, 1 }, // ¿
+    { 0x2010, 1 }, // ‐
+    { 0x2011, 1 }, // ‑
+    { 0x2012, 1 }, // ‒
+    { 0x2013, 1 }, // –
+    { 0x2014, 1 }, // —
+    { 0x2015, 1 }, // ―
+    { 0x2016, 1 }, // ‖
+    { 0x2017, 1 }, // ‗
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 1 }, // ‚
+    { 0x201B, 1 }, // ‛
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 1 }, // „
+    { 0x201F, 1 }, // ‟
+    { 0x2022, 1 }, // •
+    { 0x2023, 1 }, // ‣
+    { 0x2024, 1 }, // ․
+    { 0x2025, 1 }, // ‥
+    { 0x2026, 1 }, // …
+    { 0x2027, 1 }, // ‧
+    { 0x2039, 1 }, // ‹
+    { 0x203A, 1 }, // ›
+};
+
+static const EpdKernClassEntry opendyslexic_14_boldKernRightClasses[] = {
+    { 0x20, 1 }, //  
+};
+
+static const int8_t opendyslexic_14_boldKernMatrix[1] = {
+    5,
+};
+
+static const EpdLigaturePair opendyslexic_14_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_14_bold = {
     opendyslexic_14_boldBitmaps,
     opendyslexic_14_boldGlyphs,
     opendyslexic_14_boldIntervals,
-    52,
+    53,
     53,
     38,
     -16,
     true,
+    opendyslexic_14_boldKernLeftClasses,
+    50,
+    opendyslexic_14_boldKernRightClasses,
+    1,
+    opendyslexic_14_boldKernMatrix,
+    1,
+    1,
+    opendyslexic_14_boldLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_bolditalicBitmaps[99522] = {
+static const uint8_t opendyslexic_14_bolditalicBitmaps[100524] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBE,
     0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
     0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xE0,
@@ -6228,7 +6228,69 @@ static const uint8_t opendyslexic_14_bolditalicBitmaps[99522] = {
     0x00, 0x00, 0xE4, 0x00, 0x00, 0x15, 0xA8, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xFF, 0xFC, 0x00, 0x02,
     0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
     0xFF, 0xA5, 0x40, 0x00, 0x3F, 0xEA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF,
+    0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00,
+    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xD0, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00,
+    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07,
+    0xFD, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
+    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F,
+    0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00,
+    0x00, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x03, 0xFF,
+    0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x07, 0xFF, 0x40, 0x00, 0x3F,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xF1, 0xB4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x03, 0xE4, 0x00, 0x03, 0xFF,
+    0xFF, 0xF0, 0x7F, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xFF,
+    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x0F,
+    0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F,
+    0x80, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x0B,
+    0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
+    0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0xBF,
+    0xF0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xF4,
+    0x00, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF8,
+    0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xF1, 0xB4, 0x07, 0xF8,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0xFF,
+    0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFF,
+    0x40, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFE,
+    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
+    0xC0, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xC0, 0x06, 0xFF, 0xCF, 0xFD, 0x00, 0x00, 0xBF, 0xFE,
+    0x00, 0xBF, 0xFE, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x0B, 0xFF, 0xF7, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x3F, 0xFF, 0xCF, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x00,
+    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x1B, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xE8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x7F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
+    0x3F, 0xE0, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xFC,
+    0x00, 0x0B, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xF4, 0x00, 0x00,
+    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x00,
+    0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x3F,
+    0xD0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF8,
+    0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xBF, 0xF0, 0x03,
+    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x0F,
+    0xFF, 0xE0, 0x0B, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x3F,
+    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xFD,
+    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
+    0xB4, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x00,
+    0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00,
+    0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00,
+    0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00,
+    0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x02,
+    0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x0B,
+    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x40, 0x1F,
+    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0xFF,
+    0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
 };
 
 static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
@@ -6937,6 +6999,11 @@ static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
     { 27, 26, 38, 6, 23, 176, 98989 }, // ≠
     { 28, 25, 23, -4, 21, 175, 99165 }, // ≤
     { 28, 26, 25, 0, 22, 182, 99340 }, // ≥
+    { 29, 24, 32, 3, 24, 174, 99522 }, // ﬀ
+    { 26, 28, 28, 3, 27, 182, 99696 }, // ﬁ
+    { 26, 25, 32, 3, 25, 163, 99878 }, // ﬂ
+    { 35, 28, 39, 4, 27, 245, 100041 }, // ﬃ
+    { 38, 25, 44, 3, 25, 238, 100286 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_14_bolditalicIntervals[] = {
@@ -6992,15 +7059,414 @@ static const EpdUnicodeInterval opendyslexic_14_bolditalicIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_14_bolditalicKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x24, 3 }, // $
+    { 0x26, 4 }, // &
+    { 0x27, 5 }, // '
+    { 0x28, 6 }, // (
+    { 0x29, 7 }, // )
+    { 0x2A, 8 }, // *
+    { 0x2C, 9 }, // ,
+    { 0x2E, 10 }, // .
+    { 0x30, 11 }, // 0
+    { 0x31, 12 }, // 1
+    { 0x32, 13 }, // 2
+    { 0x33, 14 }, // 3
+    { 0x34, 15 }, // 4
+    { 0x35, 16 }, // 5
+    { 0x36, 17 }, // 6
+    { 0x37, 18 }, // 7
+    { 0x38, 19 }, // 8
+    { 0x39, 20 }, // 9
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 25 }, // D
+    { 0x45, 26 }, // E
+    { 0x46, 27 }, // F
+    { 0x47, 28 }, // G
+    { 0x48, 29 }, // H
+    { 0x49, 30 }, // I
+    { 0x4A, 31 }, // J
+    { 0x4B, 32 }, // K
+    { 0x4C, 33 }, // L
+    { 0x4D, 34 }, // M
+    { 0x4E, 35 }, // N
+    { 0x4F, 36 }, // O
+    { 0x50, 37 }, // P
+    { 0x51, 38 }, // Q
+    { 0x52, 39 }, // R
+    { 0x53, 40 }, // S
+    { 0x54, 41 }, // T
+    { 0x55, 42 }, // U
+    { 0x56, 43 }, // V
+    { 0x57, 44 }, // W
+    { 0x58, 45 }, // X
+    { 0x59, 46 }, // Y
+    { 0x5A, 47 }, // Z
+    { 0x5B, 48 }, // [
+    { 0x5D, 49 }, // ]
+    { 0x61, 50 }, // a
+    { 0x62, 51 }, // b
+    { 0x63, 52 }, // c
+    { 0x64, 53 }, // d
+    { 0x65, 54 }, // e
+    { 0x66, 55 }, // f
+    { 0x67, 56 }, // g
+    { 0x68, 57 }, // h
+    { 0x69, 58 }, // i
+    { 0x6A, 59 }, // j
+    { 0x6B, 60 }, // k
+    { 0x6C, 61 }, // l
+    { 0x6D, 62 }, // m
+    { 0x6E, 57 }, // n
+    { 0x6F, 63 }, // o
+    { 0x70, 64 }, // p
+    { 0x71, 65 }, // q
+    { 0x72, 66 }, // r
+    { 0x73, 67 }, // s
+    { 0x74, 68 }, // t
+    { 0x75, 69 }, // u
+    { 0x76, 70 }, // v
+    { 0x77, 71 }, // w
+    { 0x78, 72 }, // x
+    { 0x79, 73 }, // y
+    { 0x7A, 74 }, // z
+    { 0x7B, 75 }, // {
+    { 0x7D, 76 }, // }
+    { 0xA1, 77 }, // ¡
+    { 0xA2, 78 }, // ¢
+    { 0xA3, 79 }, // £
+    { 0xA5, 80 }, // ¥
+    { 0xBF, 81 }, // ¿
+    { 0xC1, 82 }, // Á
+    { 0xC4, 82 }, // Ä
+    { 0xC5, 82 }, // Å
+    { 0xC6, 83 }, // Æ
+    { 0xC7, 84 }, // Ç
+    { 0xCC, 85 }, // Ì
+    { 0xCD, 86 }, // Í
+    { 0xCE, 87 }, // Î
+    { 0xCF, 88 }, // Ï
+    { 0xD3, 89 }, // Ó
+    { 0xD6, 90 }, // Ö
+    { 0xD8, 91 }, // Ø
+    { 0xD9, 92 }, // Ù
+    { 0xDB, 92 }, // Û
+    { 0xDC, 93 }, // Ü
+    { 0xDE, 94 }, // Þ
+    { 0xDF, 95 }, // ß
+    { 0xE4, 96 }, // ä
+    { 0xE5, 97 }, // å
+    { 0xE6, 98 }, // æ
+    { 0xE7, 99 }, // ç
+    { 0xEC, 100 }, // ì
+    { 0xED, 101 }, // í
+    { 0xEE, 102 }, // î
+    { 0xEF, 103 }, // ï
+    { 0xF0, 104 }, // ð
+    { 0xF6, 105 }, // ö
+    { 0xF8, 106 }, // ø
+    { 0xFC, 107 }, // ü
+    { 0x128, 87 }, // Ĩ
+    { 0x129, 108 }, // ĩ
+    { 0x12A, 87 }, // Ī
+    { 0x12B, 109 }, // ī
+    { 0x12F, 110 }, // į
+    { 0x130, 87 }, // İ
+    { 0x131, 111 }, // ı
+    { 0x152, 112 }, // Œ
+    { 0x153, 113 }, // œ
+    { 0x2018, 114 }, // ‘
+    { 0x2019, 115 }, // ’
+    { 0x201A, 116 }, // ‚
+    { 0x201C, 117 }, // “
+    { 0x201D, 118 }, // ”
+    { 0x201E, 116 }, // „
+    { 0xFB01, 119 }, // ﬁ
+    { 0xFB02, 120 }, // ﬂ
+};
+
+static const EpdKernClassEntry opendyslexic_14_bolditalicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x24, 3 }, // $
+    { 0x26, 4 }, // &
+    { 0x27, 5 }, // '
+    { 0x28, 6 }, // (
+    { 0x29, 7 }, // )
+    { 0x2A, 8 }, // *
+    { 0x2C, 9 }, // ,
+    { 0x2E, 10 }, // .
+    { 0x30, 11 }, // 0
+    { 0x31, 12 }, // 1
+    { 0x32, 13 }, // 2
+    { 0x33, 14 }, // 3
+    { 0x34, 15 }, // 4
+    { 0x35, 16 }, // 5
+    { 0x36, 17 }, // 6
+    { 0x37, 18 }, // 7
+    { 0x38, 19 }, // 8
+    { 0x39, 20 }, // 9
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 25 }, // D
+    { 0x45, 26 }, // E
+    { 0x46, 27 }, // F
+    { 0x47, 28 }, // G
+    { 0x48, 29 }, // H
+    { 0x49, 30 }, // I
+    { 0x4A, 31 }, // J
+    { 0x4B, 32 }, // K
+    { 0x4C, 33 }, // L
+    { 0x4D, 34 }, // M
+    { 0x4E, 35 }, // N
+    { 0x4F, 36 }, // O
+    { 0x50, 37 }, // P
+    { 0x51, 38 }, // Q
+    { 0x52, 39 }, // R
+    { 0x53, 40 }, // S
+    { 0x54, 41 }, // T
+    { 0x55, 42 }, // U
+    { 0x56, 43 }, // V
+    { 0x57, 44 }, // W
+    { 0x58, 45 }, // X
+    { 0x59, 46 }, // Y
+    { 0x5A, 47 }, // Z
+    { 0x5B, 48 }, // [
+    { 0x5D, 49 }, // ]
+    { 0x61, 50 }, // a
+    { 0x62, 51 }, // b
+    { 0x63, 52 }, // c
+    { 0x64, 53 }, // d
+    { 0x65, 54 }, // e
+    { 0x66, 55 }, // f
+    { 0x67, 56 }, // g
+    { 0x68, 57 }, // h
+    { 0x69, 58 }, // i
+    { 0x6A, 59 }, // j
+    { 0x6B, 60 }, // k
+    { 0x6C, 61 }, // l
+    { 0x6D, 62 }, // m
+    { 0x6E, 63 }, // n
+    { 0x6F, 64 }, // o
+    { 0x70, 65 }, // p
+    { 0x71, 66 }, // q
+    { 0x72, 67 }, // r
+    { 0x73, 68 }, // s
+    { 0x74, 69 }, // t
+    { 0x75, 70 }, // u
+    { 0x76, 71 }, // v
+    { 0x77, 72 }, // w
+    { 0x78, 73 }, // x
+    { 0x79, 74 }, // y
+    { 0x7A, 75 }, // z
+    { 0x7B, 76 }, // {
+    { 0x7D, 77 }, // }
+    { 0xA1, 78 }, // ¡
+    { 0xA2, 79 }, // ¢
+    { 0xA3, 80 }, // £
+    { 0xA5, 81 }, // ¥
+    { 0xBF, 82 }, // ¿
+    { 0xC1, 83 }, // Á
+    { 0xC4, 83 }, // Ä
+    { 0xC5, 83 }, // Å
+    { 0xC6, 84 }, // Æ
+    { 0xC7, 85 }, // Ç
+    { 0xCC, 86 }, // Ì
+    { 0xCD, 87 }, // Í
+    { 0xCF, 88 }, // Ï
+    { 0xD3, 89 }, // Ó
+    { 0xD6, 89 }, // Ö
+    { 0xD8, 90 }, // Ø
+    { 0xD9, 91 }, // Ù
+    { 0xDB, 92 }, // Û
+    { 0xDC, 93 }, // Ü
+    { 0xDE, 94 }, // Þ
+    { 0xDF, 95 }, // ß
+    { 0xE4, 96 }, // ä
+    { 0xE5, 97 }, // å
+    { 0xE6, 98 }, // æ
+    { 0xE7, 99 }, // ç
+    { 0xEC, 100 }, // ì
+    { 0xED, 101 }, // í
+    { 0xEE, 102 }, // î
+    { 0xEF, 103 }, // ï
+    { 0xF0, 104 }, // ð
+    { 0xF6, 105 }, // ö
+    { 0xF8, 106 }, // ø
+    { 0xFC, 107 }, // ü
+    { 0x129, 108 }, // ĩ
+    { 0x12B, 109 }, // ī
+    { 0x12F, 110 }, // į
+    { 0x131, 111 }, // ı
+    { 0x152, 89 }, // Œ
+    { 0x153, 112 }, // œ
+    { 0x2018, 113 }, // ‘
+    { 0x2019, 114 }, // ’
+    { 0x201A, 115 }, // ‚
+    { 0x201C, 116 }, // “
+    { 0x201D, 117 }, // ”
+    { 0x201E, 115 }, // „
+    { 0xFB01, 118 }, // ﬁ
+    { 0xFB02, 118 }, // ﬂ
+};
+
+static const int8_t opendyslexic_14_bolditalicKernMatrix[14160] = {
+    2, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, -4, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7, -2, -3, -2, -3, -3, -2, -2, -3, -10, -4, -3, -2, -4, -2, -3, -2, -3, -4, -2, -2, -2, -1, -4, -3, -5, -5, -3, -5, -3, -5, -5, -5, -4, -5, -4, -3, -7, -4, -4, -5, -4, -5, -5, -5, -5, -5, -3, -4, -3, -3, -6, -3, -6, -7, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, -3, -4, 0,
+    0, 0, -7, -1, 0, 0, 0, -4, 0, 0, -1, -1, -2, -2, -2, -2, -1, -5, -1, -2, -8, -4, -4, -4, -4, -4, -4, -5, -4, -4, -9, -5, -4, -4, -4, -4, -4, -5, -4, -6, -8, -5, -8, -8, -7, -9, -4, 0, 0, -4, -5, -4, -4, -4, -6, -4, -4, -4, -8, -4, -4, -4, -4, -4, -6, -4, -5, -6, -8, -4, -8, -6, -8, -8, -5, 0, 0, -8, -4, -1, -2, -8, -4, -5, -4, -4, -4, -4, -4, -4, -5, -5, -5, 0, -1, -4, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -4,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -5, 0, 0, -1, 0, -1, -1, -1, -1, -1, -3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -8, -1, -5, -4, -2, -7, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -5, -1, 0, -1, -1, 0, -2, 0, -1, -1, -4, -1, -3, -2, -2, -3, -1, 0, 0, -4, 0, 1, 0, -3, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -4, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, -7, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, -2, 0, -2, 0, -2, -2, -2, -1, -2, -1, 0, -4, -1, -1, -2, -1, -2, -3, -2, -2, -2, 0, -1, 0, -1, -3, 0, -3, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 3, 0, 0, -1, -1, 2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 1, 1, 0, 1, 1, 3, 0, 1, 1, 0, 0, 1, 0, 1, 0, 2, 2, 2, 3, 1, 2, 0, 0, 0, -1, 1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, -1, 1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 1, 1, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, 1, -6, -3, 0, 0, 0, 0, -1, 0, 0, -1, -10, -1, -1, -1, -1, 0, -1, 0, -1, -3, -1, 0, -3, -2, -5, -3, -5, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -5, -1, 0, -1, -1, -1, -2, -1, -1, -2, 0, 0, -1, -1, -4, -1, -3, 0, 0, -3, -1, 0, 0, -5, -3, -6, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 1, 0, 0, 1, 0, -1, 0, 0, 0, -3, 0, -4, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 1, 0, 1, 0, 0, 1, 0, -1, 0, 1, 1, -3, 0, -4, -2, 1, -4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -3, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, -5, -1, -1, 0, -1, -1, -1, -1, -1, -1, -4, -1, -1, -1, -1, -1, -1, -1, -1, -3, -3, -1, -4, -3, -4, -5, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -5, -1, -1, -1, -1, 0, -2, 0, -1, -3, 0, -1, -1, -1, -3, -1, -2, 1, 0, -4, 0, 1, 0, -4, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 1, 1, 1, -3, 1, 0, -2, 1, 0, -5, 2, -1, -2, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -5, -1, -6, -5, -1, -6, -1, 0, -1, 0, -1, -1, -1, -1, -2, -1, 0, 0, -5, 0, 0, 0, 0, -1, -1, -1, 0, 0, -4, -1, -5, -3, 0, -5, 0, 0, -1, -5, -1, 0, 0, -1, 0, 0, -2, -1, -1, -1, -1, 0, -1, -1, -1, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 3, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -1, 1, 0, 0, 0, 0, -5, 2, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, -2, -1, -4, -3, 0, -5, 0, 1, 0, -1, -1, -1, -1, -1, -1, -1, 1, 0, -5, 1, 0, 1, 1, -1, -1, -1, 1, 0, -1, -1, -1, -1, 1, -1, 1, 0, 0, -4, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 1, 1, -1, -1, -1, -1, 0, 0, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, -5, 0, -1, -1, -1, -1, -1, -1, -1, -1, -4, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -3, -3, -3, -4, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -5, -1, 0, -1, -1, 0, -2, 0, -1, -2, -1, -1, -1, -1, -3, -1, -1, 1, 0, -4, 0, 0, 0, -4, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -3, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, -5, 0, -1, -1, -1, -1, -1, -1, -1, -1, -4, -1, -1, -1, -1, -1, -1, -1, -1, -3, -4, -1, -5, -4, -3, -5, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -5, -1, 0, -1, -1, 0, -2, 0, -1, -2, -3, -1, -3, -2, -2, -3, -2, 1, 0, -4, 0, 1, 0, -3, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, -5, 0, -1, -1, -1, -1, -1, -1, -1, -1, -4, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -3, -3, -3, -3, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -5, -1, 0, -1, -1, 0, -3, 0, -1, -2, -4, -1, -4, -3, -3, -4, -1, 1, 0, -4, 0, 0, 0, -4, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    1, 0, -3, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, -5, 0, -1, -1, -1, -1, -1, -1, -1, -1, -4, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -3, -2, -4, -3, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -5, -1, 0, -1, -1, 0, -3, 0, -1, -2, -3, -1, -4, -2, -4, -4, -1, 1, 0, -4, 0, 0, 0, -4, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -7, -1, 0, -2, 0, -1, -1, -1, -1, -1, -5, -3, -1, -1, -2, -1, -1, -1, -2, -3, 0, 0, -1, -1, -3, -2, -3, 0, 1, -2, 0, -2, -2, -2, -1, -2, -1, -1, -5, -1, -1, -3, -2, -2, -3, -2, -2, -3, -1, -1, -1, -1, -3, -1, -4, 0, 1, -2, -2, 0, 1, -4, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 1, 0, 0, -2, -2, -2, 0, 0, 0, 0, 1, -1, -2, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, -5, 0, 0, -1, 0, -1, -1, -1, -1, -1, -3, -1, -1, -1, -1, -1, -1, -1, -1, -2, -3, -1, -4, -3, -3, -5, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -5, -1, 0, -1, -1, 0, -2, 0, -1, -2, -2, -1, -1, -1, -3, -1, -1, 1, 0, -5, 0, 0, 0, -4, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -3, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, -5, -1, -1, 0, -1, -1, -1, -1, -1, -1, -4, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -4, -3, -4, -5, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -5, -1, 0, -1, -1, 0, -2, 0, -1, -3, 0, -1, -1, -1, -3, -1, -2, 1, 0, -4, 0, 1, 0, -4, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -6, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -6, 0, -2, 0, -2, -1, -4, -6, -2, -5, -2, -3, -4, -4, -3, -3, -9, -5, -4, -3, -4, -4, -4, -4, -4, -5, -2, -3, -3, -3, -4, -3, -4, 0, 0, -8, -2, -8, -8, -8, -4, -8, -4, -3, -7, -4, -3, -6, -5, -7, -6, -8, -6, -8, -6, -4, -4, -4, -6, -4, -7, 0, 0, -4, -8, -1, 0, -9, -6, -6, -5, -3, -3, -3, -4, -4, -3, -3, -3, 0, -1, -2, -6, -8, -8, 0, 0, 0, 0, -1, -4, -7, -3, 0, 0, 0, -2, -7, 0, 0, 0, 0, 0, -2,
+    2, 0, -2, 0, -4, 1, 0, -3, 1, 2, -1, 2, 2, 2, -1, 2, 0, -3, 0, 1, -6, 1, -1, -4, -1, -1, -1, -5, -1, -1, -6, -1, -1, -1, -1, -4, -1, -5, -1, -2, -9, -4, -9, -6, -1, -8, -1, 2, -1, -3, -4, -3, -3, -3, -3, -3, -1, -1, -5, -1, -1, -1, -1, -4, -2, -3, -1, -1, -6, -4, -8, -5, -1, -8, -1, 0, 0, -6, -3, 0, 0, -1, 0, 0, -4, -1, -1, -1, -4, -1, -4, -4, -4, 0, 2, -3, -3, -3, -3, 0, 0, 0, 0, 2, -4, -4, -4, 0, 0, 0, 0, -4, -2, 0, 1, -1, 0, -1,
+    0, 2, -6, -1, -1, 1, 0, -2, 0, 0, -1, -1, -1, -2, -1, -1, -1, -2, -1, -2, -8, -3, -4, -4, -4, -4, -4, -4, -4, -4, -7, -4, -4, -4, -4, -4, -4, -4, -4, -5, -6, -4, -7, -7, -7, -8, -4, 1, 0, -3, -4, -4, -4, -4, -6, -4, -4, -4, -8, -4, -4, -4, -4, -4, -6, -4, -4, -6, -6, -4, -6, -6, -7, -6, -5, 2, 0, -8, -4, 0, -2, -7, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -4, 0, 0, 0, 0, 2, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -4,
+    0, 4, -5, -1, 0, 1, 2, -2, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -8, -2, -4, -5, -4, -4, -4, -5, -4, -4, -5, -4, -4, -4, -4, -5, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 1, 1, -4, -4, -4, -4, -4, -6, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -8, -5, -8, -6, -4, -8, -4, 1, 1, -5, -4, -1, 0, -4, -2, -2, -5, -4, -4, -4, -5, -4, -4, -4, -4, -1, -1, -3, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, -1, -4, 1, 0, 0, 1, 0, -4,
+    0, 4, -7, -1, 0, 1, 0, -1, 0, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -9, -4, -4, -4, -4, -4, -4, -4, -4, -4, -9, -5, -4, -4, -5, -4, -4, -4, -4, -6, -5, -4, -7, -6, -8, -8, -4, 0, 1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -5, -4, -4, -6, -4, -5, -6, -4, -4, -4, -4, -6, -4, -6, 1, 0, -7, -4, 0, -2, -8, -4, -6, -4, -4, -4, -4, -4, -4, -4, -4, -4, -1, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, -1, -4, 0, 2, 0, 0, 2, -2,
+    0, 3, -4, -2, -1, 0, 1, -5, 0, 0, -2, -1, 0, 0, -3, 0, -2, -2, -1, -1, -6, -1, -4, -6, -4, -4, -4, -6, -4, -4, -5, -4, -4, -4, -4, -6, -4, -6, -4, -4, -4, -4, -4, -4, -4, -4, -4, 1, 0, -5, -4, -5, -5, -5, -5, -5, -4, -4, -8, -4, -4, -4, -4, -5, -5, -5, -4, -4, -8, -5, -8, -8, -4, -8, -4, 0, 1, -6, -5, -1, -1, -4, -1, -1, -6, -4, -4, -4, -6, -3, -4, -4, -4, -1, -1, -4, -5, -5, -5, 0, 0, 0, 0, 0, -5, -5, -5, 0, 0, 0, 0, -5, 1, 0, 0, 0, 0, -4,
+    -2, 4, -8, -3, 0, 0, 2, -2, -10, -9, -2, -3, -2, -2, -6, -1, -2, -1, -3, -2, -6, -7, -4, -5, -4, -4, -5, -5, -4, -4, -14, -6, -5, -4, -5, -5, -5, -5, -5, -7, -4, -4, -4, -4, -5, -4, -5, 0, 1, -6, -4, -5, -6, -6, -5, -5, -5, -4, -8, -5, -4, -6, -6, -5, -7, -5, -6, -7, -5, -5, -5, -5, -7, -5, -8, 0, 1, -5, -5, -1, 0, -10, -7, -10, -5, -4, -4, -4, -5, -5, -4, -4, -4, -1, -3, -3, -6, -6, -5, 0, 0, 0, 0, -1, -5, -5, -4, 0, 0, 0, -2, -5, 1, 0, -6, 0, 0, -3,
+    -1, 1, -6, -1, -2, 2, 0, -2, -3, -1, -1, -3, -3, -3, -1, -1, -1, -4, -1, -1, -9, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -4, -4, -4, -6, -7, -4, -8, -7, -7, -8, -5, 1, 0, -3, -4, -4, -4, -4, -6, -4, -4, -4, -8, -4, -4, -4, -4, -4, -6, -4, -5, -6, -7, -4, -6, -6, -7, -6, -6, 2, 0, -8, -4, 0, -2, -8, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -1, -1, -3, -3, -3, -4, 0, 0, 0, 0, 2, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -4,
+    0, 4, -4, -1, 0, 1, 1, -1, 0, 0, -1, -1, 0, 0, -2, 0, -1, -1, -1, -1, -7, -1, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -5, -5, -4, -5, -4, 1, 1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 1, 1, -6, -4, -1, -1, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, -1, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 1, 1, 0, 1, 1, -2,
+    0, 3, -4, -1, -1, 0, 1, -1, 0, 0, -1, -1, 0, 0, -2, 0, -1, -1, -1, -1, -7, -1, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -5, -4, -4, -5, -5, -5, -5, -4, -5, -4, 1, 0, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 1, 0, -6, -4, -1, -1, -4, -1, -1, -4, -4, -4, -4, -4, -3, -5, -5, -5, -1, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 1, -3,
+    -1, 5, -6, -2, 0, 1, 3, -1, 0, 0, -2, -2, -1, -1, -3, -1, -2, -1, -2, -1, -10, -4, -4, -5, -4, -4, -5, -5, -4, -4, -7, -6, -5, -5, -6, -5, -5, -5, -5, -6, -4, -4, -4, -4, -5, -4, -5, 0, 2, -5, -4, -5, -5, -5, -4, -5, -5, -4, -8, -5, -5, -6, -6, -5, -6, -5, -6, -6, -5, -4, -4, -4, -6, -4, -6, 1, 3, -5, -5, -1, 0, -6, -4, -4, -5, -4, -4, -4, -5, -5, -4, -4, -4, -1, -2, -3, -5, -5, -5, 0, 0, 0, 0, 0, -5, -5, -4, 0, 0, 0, -2, -5, 3, 2, 0, 3, 2, -3,
+    0, 0, -6, -4, -3, 1, 0, -8, 0, 0, -4, -1, 0, -1, -8, 0, -4, -6, -4, -1, -8, -1, -4, -9, -4, -4, -4, -10, -4, -4, -5, -4, -4, -4, -4, -9, -4, -10, -4, -6, -7, -7, -7, -7, -4, -7, -4, 2, 0, -6, -6, -8, -8, -8, -5, -7, -4, -4, -8, -4, -4, -4, -4, -8, -5, -7, -4, -5, -8, -7, -10, -8, -4, -11, -4, 0, 0, -8, -8, -1, -3, -4, -1, -1, -9, -4, -4, -4, -9, -4, -7, -7, -7, -1, -1, -6, -6, -6, -8, 0, 0, 0, 0, -2, -8, -7, -7, 0, 0, 0, 0, -8, 0, 0, 1, 0, -1, -4,
+    0, -4, -4, -1, -11, 1, 0, -11, 0, 0, -1, -1, 0, 0, -1, 0, -1, -6, 0, -1, -8, -1, -4, -4, -4, -4, -4, -5, -4, -4, -5, -4, -4, -4, -4, -4, -4, -5, -4, -4, -11, -4, -10, -8, -4, -11, -4, 1, -1, -4, -5, -4, -4, -4, -5, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -7, -4, -8, -6, -4, -8, -4, 0, -1, -8, -4, -1, -2, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, -1, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, -6, -6, 0, -6, -6, -4,
+    0, 4, -4, -1, 0, 1, 1, -1, 0, 0, -1, -1, 0, 0, -2, 0, -1, -1, -1, -1, -7, -1, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -5, -5, -4, -5, -4, 1, 1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 1, 1, -6, -4, -1, -1, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, -1, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 1, 1, 1, 1, 1, -2,
+    0, 4, -5, -1, 0, 1, 2, 0, -2, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -9, -3, -4, -4, -4, -4, -5, -4, -4, -4, -6, -5, -5, -4, -5, -4, -5, -4, -5, -5, -4, -4, -4, -4, -5, -4, -5, 0, 1, -4, -4, -4, -4, -4, -4, -4, -5, -4, -8, -5, -4, -5, -5, -4, -6, -4, -5, -5, -4, -4, -4, -4, -5, -4, -5, 1, 2, -5, -4, -1, 0, -5, -3, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -1, -2, -3, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, -1, -4, 2, 1, 0, 2, 1, -2,
+    0, 5, -7, -1, 0, 2, 0, -1, 0, 0, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -9, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -5, -4, -4, -5, -4, -4, -4, -4, -6, -5, -4, -7, -6, -8, -8, -4, 1, 1, -4, -4, -4, -4, -4, -3, -4, -4, -4, -8, -4, -4, -5, -4, -4, -6, -4, -5, -6, -4, -4, -4, -4, -6, -4, -6, 2, 0, -7, -4, 0, -2, -8, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, -1, -4, 0, 2, 0, 0, 2, -2,
+    -1, 4, -6, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -6, -1, -1, -1, -1, -1, -10, -7, -4, -4, -4, -4, -4, -4, -4, -4, -14, -5, -5, -4, -5, -4, -5, -4, -5, -6, -4, -4, -6, -5, -8, -6, -8, 0, 1, -6, -4, -6, -6, -6, -3, -6, -5, -4, -8, -4, -4, -5, -5, -5, -5, -6, -5, -6, -4, -3, -4, -3, -6, -4, -6, 0, 1, -6, -6, -2, -2, -8, -7, -11, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -4, -6, -6, -6, 0, 0, 0, 0, -2, -5, -5, -3, 0, 0, 0, -1, -5, 1, 1, -7, 1, 1, -2,
+    -2, 3, -9, -4, 0, 0, 0, -3, 0, 0, -3, -4, -3, -4, -4, -3, -3, -4, -4, -3, -11, -5, -6, -6, -6, -6, -6, -6, -6, -6, -4, -7, -6, -6, -7, -6, -7, -6, -7, -8, -7, -6, -9, -8, -7, -10, -7, 3, 1, -6, -6, -6, -6, -6, -6, -4, -6, -6, -4, -6, -6, -7, -6, -6, -4, -6, -7, -8, -6, -6, -6, -6, -7, -5, -7, 0, 1, -9, -6, -2, -5, -3, -5, -5, -6, -6, -6, -6, -6, -2, -6, -6, -6, -3, -3, -6, -6, -6, -6, 0, 0, 0, 0, -1, -6, -5, -6, 0, 0, 0, -3, -6, 0, 1, 3, 0, 1, -4,
+    0, 2, -4, -2, -1, 0, 0, -3, 0, 0, -3, -1, 0, -1, -3, 0, -2, -3, -2, -1, -8, -1, -4, -6, -4, -4, -4, -6, -4, -4, -5, -4, -4, -4, -4, -6, -4, -6, -4, -4, -6, -6, -8, -8, -4, -8, -4, 1, 0, -5, -6, -5, -5, -5, -5, -5, -4, -4, -8, -4, -4, -4, -4, -6, -5, -5, -4, -4, -7, -6, -6, -6, -4, -6, -4, 0, 0, -8, -5, -1, -2, -4, -1, -1, -6, -4, -4, -4, -6, -4, -6, -6, -6, -1, -1, -5, -5, -5, -5, 0, 0, 0, 0, 2, -6, -6, -6, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, -4,
+    0, 0, -6, -1, -4, 2, 0, -3, 0, 0, -1, -1, -2, -2, -1, -1, -1, -5, -1, -2, -8, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -4, -4, -4, -6, -7, -4, -7, -7, -7, -7, -4, 1, 0, -3, -5, -4, -4, -4, -6, -4, -4, -4, -8, -4, -4, -4, -4, -4, -6, -4, -4, -6, -7, -4, -7, -6, -7, -8, -5, 2, 0, -8, -4, -1, -2, -8, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -1, -1, -3, -3, -3, -4, 0, 0, 0, 0, 2, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -4,
+    -2, 4, -7, -2, 0, 0, 2, -2, -8, -7, -3, -2, -1, -1, -9, -1, -3, -1, -3, -2, -4, -9, -4, -6, -4, -4, -5, -5, -4, -4, -12, -6, -5, -4, -5, -6, -5, -5, -5, -6, -4, -4, -4, -4, -5, -4, -5, 0, 1, -11, -4, -11, -11, -11, -6, -11, -5, -4, -8, -5, -4, -11, -11, -11, -12, -11, -11, -11, -8, -11, -11, -11, -11, -11, -11, 0, 2, -5, -10, -2, 0, -11, -9, -9, -6, -4, -4, -4, -6, -6, -4, -4, -4, -1, -2, -3, -7, -11, -11, 0, 0, 0, 0, -6, -5, -11, -4, 0, 0, 0, -8, -11, 2, 0, -4, 2, 0, -4,
+    0, 4, -6, -1, 0, 1, 2, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -6, -4, -4, -4, -4, -4, -5, -4, -4, -4, -8, -5, -5, -5, -5, -4, -5, -4, -5, -6, -4, -4, -4, -4, -5, -4, -5, 0, 1, -4, -4, -4, -4, -4, -4, -4, -5, -4, -8, -5, -4, -5, -5, -4, -6, -4, -5, -6, -4, -4, -4, -4, -6, -4, -6, 1, 2, -5, -4, -1, 0, -8, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -1, -2, -3, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, -1, -4, 2, 1, 0, 2, 1, -2,
+    -2, 4, -9, -4, 0, 0, 2, -3, 0, 0, -4, -4, -2, -3, -7, -2, -4, -1, -4, -3, -6, -9, -4, -7, -4, -5, -5, -6, -4, -4, -13, -6, -5, -5, -6, -7, -5, -7, -5, -8, -4, -4, -4, -4, -5, -4, -5, 0, 1, -8, -4, -8, -8, -8, -6, -8, -5, -5, -8, -5, -5, -8, -7, -8, -8, -8, -8, -9, -7, -6, -6, -6, -8, -6, -9, 0, 1, -5, -8, -4, -1, -11, -9, -9, -7, -4, -4, -4, -7, -7, -4, -4, -4, -2, -4, -3, -7, -8, -8, 0, 0, 0, 0, -4, -5, -8, -4, 0, 0, 0, -4, -8, 1, 0, -3, 1, 0, -4,
+    -2, 4, -8, -3, 0, 0, 3, -2, 0, 0, -3, -3, -2, -3, -6, -2, -4, -1, -4, -3, 0, -7, -4, -6, -4, -5, -5, -6, -4, -4, -10, -6, -5, -5, -6, -6, -5, -6, -5, -7, -4, -4, -4, -4, -5, -4, -5, 0, 1, -7, -4, -7, -7, -7, -5, -7, -5, -5, -8, -5, -5, -7, -6, -7, -7, -7, -7, -8, -6, -5, -5, -5, -8, -5, -8, 0, 2, -5, -7, -3, 0, -10, -7, -7, -6, -4, -4, -4, -6, -6, -4, -4, -4, -1, -3, -3, -7, -7, -7, 0, 0, 0, 0, -2, -5, -7, -4, 0, 0, 0, -3, -7, 2, 0, -1, 1, 0, -4,
+    0, 2, -5, -3, -1, 1, 1, -6, 0, 0, -4, -1, 0, -1, -5, 0, -4, -3, -3, -1, -7, -1, -4, -8, -4, -4, -4, -8, -4, -4, -5, -4, -4, -4, -4, -8, -4, -8, -4, -5, -4, -4, -4, -5, -4, -4, -4, 2, 0, -6, -4, -7, -7, -7, -5, -6, -4, -4, -8, -4, -4, -4, -4, -7, -5, -6, -4, -4, -8, -6, -9, -8, -4, -9, -4, 0, 1, -6, -7, -1, -2, -4, -1, -1, -8, -4, -4, -4, -8, -3, -4, -4, -4, -1, -1, -4, -6, -6, -7, 0, 0, 0, 0, -1, -6, -7, -5, 0, 0, 0, 0, -7, 0, 0, 1, 0, 0, -4,
+    -2, 3, -10, -4, 0, 0, 2, -4, 0, 0, -5, -4, -3, -4, -9, -3, -5, -2, -5, -4, -6, -9, -4, -8, -4, -5, -5, -7, -4, -4, -12, -6, -5, -5, -6, -8, -5, -8, -5, -8, -4, -4, -4, -4, -5, -4, -5, 0, 0, -10, -4, -10, -10, -10, -7, -10, -5, -5, -8, -5, -5, -9, -8, -10, -9, -10, -9, -11, -9, -7, -7, -7, -9, -7, -10, -1, 1, -5, -10, -4, -1, -12, -9, -9, -8, -4, -4, -4, -8, -8, -4, -4, -4, -2, -4, -3, -7, -10, -10, 0, 0, 0, 0, -6, -5, -10, -4, 0, 0, 0, -5, -10, 1, 0, -4, 1, 0, -6,
+    0, 4, -5, -2, 0, 0, 2, -2, 0, 0, -3, -1, -1, -1, -4, -1, -3, -1, -2, -1, -6, -1, -4, -6, -4, -4, -4, -5, -4, -4, -5, -4, -4, -4, -4, -6, -4, -6, -4, -5, -4, -4, -4, -4, -4, -4, -4, 1, 2, -5, -4, -6, -6, -6, -6, -6, -4, -4, -8, -4, -4, -4, -4, -6, -5, -6, -4, -4, -8, -6, -6, -6, -4, -6, -4, 0, 2, -5, -6, -1, 0, -4, -1, -1, -6, -4, -4, -4, -6, -4, -4, -4, -4, -1, -1, -3, -5, -5, -6, 0, 0, 0, 0, 0, -5, -6, -4, 0, 0, 0, -1, -6, 2, 0, 0, 2, 0, -4,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 1, 0, 0, 0, -1, 1, 0, 1, 1, 1, 2, 1, 1, 4, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 1, 2, 0, 0, 0, 0, 1, -2, 1, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, 0, -1, -2, -1, 0, -1, -1, -1, -2, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 5, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0, 0, 2, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    1, 2, -4, -1, -1, 0, 0, -2, -1, 1, -1, 0, 1, 1, -2, 1, -1, -5, -1, -1, -8, -1, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -11, -5, -8, -7, -4, -9, -4, 1, -2, -4, -5, -4, -4, -4, -5, -4, -3, -3, -8, -3, -3, -3, -3, -4, -4, -4, -3, -3, -5, -4, -5, -5, -3, -5, -3, 0, -1, -8, -4, 0, -2, -4, -1, -1, -4, -4, -4, -4, -4, -3, -5, -5, -5, 0, 0, -4, -4, -4, -4, 1, 1, 1, 3, 1, -4, -4, -4, 1, 1, 1, 0, -4, 0, 0, 0, 0, 0, -3,
+    1, 2, -6, 0, -1, 1, 0, -1, -1, 1, 0, 0, -1, -1, -1, -1, 0, -7, 0, -1, -8, -3, -3, -4, -3, -4, -4, -4, -4, -4, -7, -4, -4, -4, -4, -4, -4, -4, -4, -5, -11, -4, -8, -7, -6, -10, -4, 0, -1, -3, -4, -3, -3, -3, -4, -3, -4, -4, -8, -4, -3, -4, -4, -3, -6, -3, -4, -5, -4, -4, -6, -5, -6, -6, -4, 1, -1, -7, -3, 0, -1, -7, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 1, 1, 1, 1, 2, -3, -3, -4, 1, 1, 1, -1, -3, 0, 0, 0, 0, 0, -3,
+    1, 1, -4, -2, -2, 0, 0, -2, -1, 1, -2, 0, 0, 0, -6, 0, -2, -6, -2, -1, -8, -1, -4, -5, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -5, -4, -5, -4, -4, -11, -5, -8, -7, -4, -9, -4, 0, -3, -5, -5, -6, -6, -6, -5, -6, -3, -3, -8, -3, -3, -3, -3, -6, -5, -5, -4, -3, -5, -5, -5, -5, -4, -5, -4, 0, -2, -8, -6, 0, -2, -5, -1, -2, -5, -4, -4, -4, -5, -4, -5, -5, -5, 0, 0, -5, -5, -5, -6, 0, 0, 0, 3, 1, -6, -6, -5, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, -3,
+    0, 4, -4, -1, 0, 0, 1, 0, -1, 0, -1, -1, -1, -1, -2, -1, -1, 0, -1, -1, -6, -1, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 1, -4, -3, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 1, -5, -4, -1, 0, -4, -1, -1, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -4, -4, -4, 5, 1, 6, 5, 1, -4, -4, -4, 4, 6, 1, -1, -4, 1, 1, 0, 1, 1, -2,
+    1, 2, -4, -1, -1, 1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -6, -1, -1, -8, -2, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -11, -4, -8, -7, -4, -10, -4, 0, -1, -3, -4, -3, -3, -3, -4, -3, -4, -4, -8, -4, -3, -4, -4, -3, -5, -3, -4, -4, -4, -4, -6, -5, -4, -6, -4, 1, -1, -7, -3, 0, -2, -5, -2, -2, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 1, 2, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -3,
+    -1, 4, -6, -1, 0, 0, 1, 0, -4, -3, 0, -1, 0, -1, -4, -1, 0, -1, -1, 0, -9, -5, -4, -4, -4, -4, -4, -4, -4, -4, -8, -5, -4, -4, -4, -4, -4, -4, -4, -6, -4, -4, -4, -4, -5, -4, -6, 0, 1, -4, -4, -4, -4, -4, -3, -4, -4, -4, -8, -4, -4, -5, -4, -4, -5, -4, -5, -5, -3, -3, -3, -3, -5, -3, -6, 0, 1, -5, -4, -2, 0, -7, -5, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -4, -4, -4, 4, 1, 5, 5, 1, -4, -4, -3, 4, 6, 1, -1, -4, 1, 1, -1, 1, 1, -1,
+    0, 4, -4, -1, 0, 1, 0, 0, -1, 0, 0, -1, -1, -1, -2, -1, -1, -6, -1, 0, -8, -2, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -11, -4, -6, -5, -4, -7, -4, 0, 0, -4, -4, -4, -4, -4, -3, -4, -4, -4, -5, -4, -4, -4, -4, -4, -5, -4, -4, -4, -3, -3, -3, -3, -4, -3, -4, 1, 0, -7, -4, 0, -2, -4, -2, -2, -4, -4, -4, -4, -4, -2, -4, -4, -4, 0, -1, -4, -4, -4, -4, 0, 0, 0, 5, 1, -4, -4, -3, 0, 0, 1, -1, -4, 0, 1, 0, 0, 1, -1,
+    1, 2, -4, -1, -1, 0, 0, -1, -1, 1, -1, 0, 1, 1, -2, 1, -1, -5, -1, -1, -8, -1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -11, -4, -8, -7, -4, -10, -4, 1, -2, -4, -5, -4, -4, -4, -4, -4, -3, -3, -8, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -6, -5, -3, -6, -3, 0, -1, -8, -4, 0, -1, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, 0, 0, -4, -4, -4, -4, 1, 1, 1, 2, 1, -4, -4, -4, 1, 1, 1, 0, -4, 0, 0, 0, 0, 0, -3,
+    1, 3, -4, -1, -1, 0, 0, -1, -1, 1, -1, 0, 1, 1, -2, 1, -1, -1, -1, -1, -8, -1, -3, -4, -3, -3, -3, -4, -3, -3, -4, -3, -3, -3, -3, -4, -3, -4, -3, -4, -4, -4, -5, -5, -3, -6, -3, 1, 0, -4, -4, -4, -4, -4, -4, -4, -3, -3, -8, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -6, -4, 0, -1, -4, -1, -1, -4, -3, -3, -3, -4, -3, -4, -4, -4, 0, 0, -4, -4, -4, -4, 3, 1, 6, 4, 1, -4, -4, -4, 3, 6, 1, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 4, -5, -1, 0, 0, 1, -1, 0, 0, -1, -1, -1, -1, -2, -1, -1, 0, -1, 0, -5, -2, -3, -4, -3, -4, -4, -4, -4, -3, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 1, -4, -3, -4, -4, -4, -3, -4, -4, -4, -5, -4, -4, -4, -4, -4, -5, -4, -4, -4, -3, -3, -4, -3, -4, -3, -4, 0, 1, -5, -4, 0, 0, -4, -2, -2, -4, -3, -3, -3, -4, -2, -3, -3, -3, 0, -1, -3, -4, -4, -4, 3, 1, 6, 5, 1, -4, -4, -3, 4, 6, 2, -1, -4, 1, 1, 0, 1, 1, -1,
+    1, 0, -6, -4, -4, 1, 0, -7, -1, 1, -4, 0, 2, -1, -8, 2, -4, -6, -3, -1, 0, -1, -4, -9, -4, -4, -4, -8, -4, -4, -4, -4, -4, -4, -4, -8, -4, -8, -4, -6, -11, -7, -11, -9, -4, -11, -4, 1, -1, -6, -7, -7, -7, -7, -5, -7, -3, -3, -8, -3, -3, -3, -3, -8, -4, -7, -3, -5, -8, -7, -8, -8, -3, -8, -3, 0, 0, -8, -7, 0, -2, -4, -1, -1, -9, -4, -4, -4, -8, -3, -7, -7, -7, 0, 0, -6, -6, -6, -7, 2, 2, 2, 2, -1, -8, -6, -7, 2, 2, 2, 0, -8, -1, 0, 1, -1, 0, -4,
+    0, 0, -4, -1, -4, 0, 0, -4, -1, 0, -2, 0, 0, 0, -5, 0, -2, -4, -1, -1, -8, -1, -4, -6, -4, -4, -4, -6, -4, -4, -4, -4, -4, -4, -4, -6, -4, -6, -4, -4, -6, -5, -6, -6, -4, -6, -4, 1, 0, -4, -5, -4, -5, -4, -5, -4, -3, -3, -8, -3, -3, -3, -3, -5, -4, -4, -3, -3, -7, -5, -7, -7, -3, -7, -3, 0, 0, -8, -4, 0, -2, -4, -1, -1, -6, -4, -4, -4, -6, -3, -5, -5, -5, 0, 0, -4, -4, -4, -4, 2, 1, 3, 1, 1, -5, -5, -5, 1, 3, 1, 0, -5, 0, 0, 0, 0, 0, -4,
+    0, 2, -4, 0, -1, 1, 0, -1, 0, 0, -1, 0, 1, 1, -1, 1, -1, -5, 0, -1, -8, -1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -11, -4, -8, -7, -4, -10, -4, 0, -2, -3, -4, -4, -4, -4, -4, -4, -3, -3, -8, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -6, -5, -3, -6, -3, 1, -1, -8, -4, 0, -1, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, 0, 0, -3, -3, -3, -4, 1, 1, 1, 1, 2, -4, -4, -4, 1, 1, 1, 0, -4, 0, 0, 0, 0, 0, -3,
+    0, 2, -6, 0, -1, 1, -1, -1, -1, 0, 0, -1, -2, -2, -1, -1, 0, -7, 0, -1, -8, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -4, -4, -4, -6, -11, -4, -8, -6, -7, -10, -4, 0, -1, -3, -4, -3, -3, -3, -4, -3, -4, -4, -8, -4, -3, -4, -4, -3, -6, -3, -4, -6, -4, -4, -6, -5, -7, -6, -5, 1, -1, -7, -3, 0, -2, -8, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 1, 2, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -2,
+    0, 2, -6, 0, -1, 1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, -7, 0, -1, -8, -3, -4, -4, -4, -4, -4, -4, -4, -4, -7, -4, -4, -4, -4, -4, -4, -4, -4, -5, -11, -4, -8, -7, -6, -10, -4, 0, -1, -3, -4, -3, -3, -3, -4, -3, -4, -4, -8, -4, -3, -4, -4, -3, -6, -3, -4, -5, -4, -4, -6, -5, -6, -6, -4, 1, -1, -7, -3, 0, -1, -7, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 1, 2, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -2,
+    1, 0, -7, -3, -3, 0, 0, -3, 1, 1, -4, 0, 1, -1, -5, 1, -4, -6, -3, -1, -8, -1, -4, -7, -4, -4, -4, -7, -4, -4, -4, -4, -4, -4, -4, -7, -4, -7, -4, -6, -11, -7, -9, -8, -4, -10, -4, 1, 0, -6, -6, -7, -7, -7, -5, -4, -3, -3, -4, -3, -3, -3, -3, -7, -4, -6, -3, -5, -7, -6, -6, -6, -3, -5, -3, 0, 0, -8, -7, 0, -6, -3, -1, -1, -7, -4, -4, -4, -7, -1, -7, -7, -7, 0, 0, -6, -6, -6, -7, 1, 1, 1, 1, -1, -7, -5, -6, 1, 1, 3, 0, -7, 0, 0, 1, 0, 0, -4,
+    -1, 4, -7, -1, 0, 1, 0, 0, -6, -4, 0, -1, -1, -4, -4, -1, 0, -9, -2, 0, -9, -6, -4, -4, -4, -4, -4, -4, -4, -4, -10, -5, -4, -4, -4, -4, -4, -4, -4, -6, -11, -4, -6, -6, -9, -8, -9, 0, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, -8, -4, -4, -5, -4, -4, -5, -4, -5, -5, -3, -4, -4, -4, -6, -4, -6, 0, -1, -7, -4, -3, -4, -8, -6, -6, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -4, -4, -4, -4, 0, 0, 0, 4, 1, -4, -4, -4, 0, 0, 0, -1, -4, 0, 1, -2, 0, 1, -1,
+    1, 2, -5, 0, -2, 1, 0, -4, -1, 1, -1, 0, -1, -1, -1, -1, -1, -7, 0, -1, -8, -3, -3, -4, -3, -4, -4, -4, -4, -4, -6, -4, -4, -4, -4, -4, -4, -5, -4, -5, -11, -4, -8, -7, -6, -10, -3, 1, -1, -3, -4, -4, -4, -4, -5, -4, -4, -4, -8, -4, -3, -4, -4, -4, -5, -4, -4, -5, -7, -4, -6, -6, -6, -6, -4, 1, -1, -8, -4, 0, -2, -6, -3, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, -3, -3, -3, -4, 1, 1, 1, 3, 2, -4, -4, -4, 1, 1, 1, -1, -4, 0, 0, 0, 0, 0, -4,
+    0, 3, -4, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -5, 0, 0, -6, -1, 0, -8, -1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -7, -6, -4, -8, -4, 0, -1, -4, -4, -4, -4, -4, -3, -4, -3, -4, -8, -3, -4, -3, -3, -4, -5, -4, -3, -4, -3, -3, -4, -4, -3, -4, -3, 0, -1, -7, -4, 0, -2, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, 0, 0, -4, -4, -4, -4, 0, 0, 0, 4, 1, -4, -4, -3, 0, 1, 0, 0, -4, 0, 0, 0, 0, 1, -1,
+    1, 3, -4, 0, -1, 1, 0, -1, -1, 1, -1, 0, 1, 1, -1, 1, -1, -5, 0, -1, -8, -1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -11, -4, -6, -6, -4, -8, -4, 0, -2, -3, -4, -4, -4, -4, -4, -4, -3, -3, -8, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 1, -1, -7, -4, 0, -1, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, 0, 0, -3, -3, -3, -4, 1, 1, 1, 4, 2, -4, -4, -4, 1, 1, 1, 0, -4, 0, 1, 0, 0, 1, -2,
+    -1, 4, -6, -1, 0, 0, 0, 0, -6, -4, -1, -1, -1, -6, -5, -1, -1, -10, -1, -1, 0, -7, -4, -4, -4, -4, -4, -4, -4, -4, -10, -5, -4, -4, -5, -4, -4, -4, -4, -6, -11, -4, -6, -5, -9, -7, -8, 0, -1, -6, -4, -6, -6, -6, -3, -6, -4, -4, -9, -4, -4, -5, -4, -6, -5, -6, -5, -7, -5, -3, -3, -3, -5, -3, -6, 0, 0, -8, -6, -2, -3, -8, -7, -7, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -6, -6, -6, -6, 0, 0, 0, 5, -1, -6, -6, -3, 0, 0, 0, -1, -6, 0, 0, -3, 0, 0, -1,
+    -1, 4, -6, -1, 0, 0, 0, 0, -4, -2, -1, -1, -1, -4, -4, -1, -1, -10, -1, -1, 0, -5, -4, -4, -4, -4, -4, -4, -4, -4, -8, -5, -4, -4, -5, -4, -4, -4, -4, -6, -11, -4, -6, -5, -8, -7, -6, 0, -1, -5, -4, -5, -5, -5, -3, -5, -4, -4, -8, -4, -4, -5, -4, -5, -5, -5, -5, -6, -4, -3, -3, -3, -5, -3, -6, 0, 0, -8, -5, -1, -3, -8, -5, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -5, -5, -5, -5, 0, 0, 0, 5, 0, -5, -5, -3, 0, 0, 0, -1, -5, 0, 0, 0, 0, 0, -1,
+    0, 2, -5, -2, -1, 0, 0, -2, -1, 0, -2, 0, 0, -1, -6, 0, -2, -5, -2, -1, -8, -1, -4, -5, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -5, -4, -5, -4, -5, -11, -5, -7, -6, -4, -8, -4, 0, -2, -6, -5, -7, -7, -7, -4, -6, -3, -3, -8, -3, -3, -3, -3, -7, -4, -6, -3, -4, -6, -4, -4, -4, -3, -4, -3, 0, -2, -8, -7, 0, -2, -4, -1, -1, -5, -4, -4, -4, -5, -3, -5, -5, -5, 0, 0, -6, -6, -6, -7, 0, 0, 0, 3, -1, -7, -6, -4, 0, 0, 0, 0, -7, 0, 0, 0, 0, 0, -2,
+    -1, 4, -6, -1, 0, 0, 0, -1, -4, -2, -1, -1, 0, -5, -4, -1, -1, -10, -1, 0, 0, -6, -4, -4, -4, -4, -4, -4, -4, -4, -9, -5, -4, -4, -5, -4, -4, -4, -4, -6, -11, -4, -6, -5, -8, -7, -7, 0, -1, -5, -4, -5, -5, -5, -3, -5, -4, -4, -8, -4, -4, -5, -4, -5, -5, -5, -5, -6, -4, -3, -3, -3, -5, -3, -6, 0, 0, -8, -5, -1, -4, -8, -6, -6, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -5, -5, -5, -5, 0, 0, 0, 5, -1, -5, -5, -3, 0, 0, 0, -1, -5, 0, 0, -1, 0, 0, -1,
+    1, 4, -5, -1, 0, 0, 0, -1, -1, 1, -1, 0, 1, -1, -6, 1, -1, -5, -1, 0, -8, -1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -11, -4, -6, -6, -4, -8, -4, 1, -1, -5, -4, -5, -5, -5, -3, -5, -3, -3, -8, -3, -3, -3, -3, -4, -4, -5, -3, -4, -4, -4, -4, -4, -3, -4, -3, 0, -1, -7, -5, 0, -2, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, 0, 0, -5, -5, -5, -5, 1, 1, 1, 4, -1, -4, -4, -4, 1, 1, 1, 0, -4, 0, 1, 0, 0, 1, -2,
+    0, 3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 2, 0, 2, 1, 0, 1, 1, 1, 4, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 1, 3, 0, 1, 0, 0, 1, -1, 1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, -4, 1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 2, 2, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 0, 0, 1, 0, 0, 0, -1, 1, 0, 0, 1, 0, 1, 1, 1, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, -8, -4, 0, 0, 0, -4, 0, 0, -4, -4, -4, -4, -6, -4, -4, -3, -4, -5, -6, -5, -6, -8, -6, -7, -7, -8, -7, -6, -8, -7, -7, -7, -7, -8, -7, -8, -7, -8, -6, -6, -6, -6, -7, -6, -7, 0, 0, -7, -6, -7, -7, -7, -8, -7, -7, -7, -9, -7, -7, -7, -7, -7, -8, -7, -7, -7, -8, -8, -8, -8, -7, -8, -7, 0, 0, -8, -7, -4, -2, -7, -5, -5, -8, -6, -6, -6, -8, -6, -6, -6, -6, 0, -4, -6, -7, -7, -7, 0, 0, 0, 0, 0, -7, -7, -7, 0, 0, 0, -4, -7, 0, 0, 0, 0, 0, -6,
+    0, 0, -4, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -6, 0, -2, -5, -2, -1, -8, -1, -4, -5, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -5, -4, -5, -4, -4, -8, -5, -8, -7, -4, -9, -4, 0, 0, -5, -5, -6, -6, -6, -5, -6, -3, -3, -8, -3, -3, -3, -3, -6, -5, -5, -4, -3, -5, -5, -5, -5, -4, -5, -4, 0, 0, -8, -6, 0, -2, -5, -1, -2, -5, -4, -4, -4, -5, -4, -5, -5, -5, 0, 0, -5, -5, -5, -6, 0, 0, 0, 0, 0, -6, -6, -5, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, -3,
+    2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, 1, 0, 0, 0, 0, -5, 0, 0, -3, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, -3, 0, -3, 0, -1, -1, -1, -3, -3, 0, -4, 0, 0, 0, -3, -1, -3, -3, -3, -2, -3, 0, 0, -4, 0, 0, 0, 0, -3, -1, -3, 0, -1, -5, -3, -5, -4, 0, -5, 0, 0, 0, -4, -3, 1, 0, 0, 0, 0, -3, 0, 0, 0, -3, 0, -1, -1, -1, 0, 1, -2, -3, -3, -3, 0, 0, 0, 0, 0, -3, -2, -3, 0, 0, 0, 1, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -7, -1, 0, -3, 0, 0, -1, -3, 0, 0, -4, -2, -1, -1, -1, -3, -1, -3, -1, -3, 0, 0, -1, 0, -2, -1, -3, 0, 0, -3, 0, -3, -3, -3, -3, -3, -1, 0, -4, -1, -1, -3, -3, -3, -4, -3, -3, -3, -5, -3, -4, -4, -4, -4, -3, 0, 0, -1, -3, 0, 2, -4, -1, -1, -3, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1,
+    -5, 0, -10, -6, 0, 0, 0, -4, 0, 0, -5, -6, -5, -6, -7, -5, -5, -12, -6, -5, -14, -8, -8, -8, -8, -8, -9, -8, -8, -9, -11, -9, -9, -8, -9, -8, -9, -8, -9, -10, -16, -8, -10, -10, -11, -12, -9, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8, -8, -13, -8, -8, -9, -8, -8, -10, -8, -9, -10, -8, -8, -8, -8, -10, -7, -10, 0, 0, -12, -8, -5, -7, -4, -8, -8, -8, -9, -9, -9, -8, -8, -8, -8, -8, 0, -6, -8, -8, -8, -8, 0, 0, 0, 0, 0, -8, -8, -8, 0, 0, 0, -5, -8, 0, 0, 0, 0, 0, -6,
+    1, 0, -2, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, -1, 0, 0, -3, 0, 0, -6, 0, -1, -4, -1, -1, -1, -5, -1, -1, -2, -1, -1, -1, -1, -4, -1, -5, -1, -2, -9, -4, -9, -6, -1, -8, -1, 0, 0, -3, -4, -3, -3, -3, -3, -3, -1, -1, -5, -1, -1, -1, -1, -4, -2, -3, -1, -1, -6, -4, -8, -5, -1, -8, -1, 0, 0, -6, -3, 0, 0, -1, 0, 0, -4, -1, -1, -1, -4, -1, -4, -4, -4, 0, 0, -3, -3, -3, -3, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -1,
+    1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -1, -3, -1, -1, -1, -4, -1, -1, -7, -1, -1, -1, -1, -3, -1, -4, -1, -2, -2, -2, -2, -2, -1, -2, -1, 0, 0, -2, -1, -2, -2, -2, -3, -2, -1, -1, -5, -1, -1, -1, -1, -3, -2, -2, -1, -1, -5, -3, -6, -5, -1, -6, -1, 0, 0, -4, -2, 0, 0, -1, 0, 0, -3, -1, -1, -1, -3, -1, -2, -2, -2, 0, 0, -1, -2, -2, -2, 0, 0, 0, 0, 0, -3, -3, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1,
+    0, 0, -5, -1, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -8, -2, -4, -5, -4, -4, -4, -5, -4, -4, -5, -4, -4, -4, -4, -5, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, -4, -4, -4, -4, -4, -6, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -8, -5, -8, -6, -4, -8, -4, 0, 0, -5, -4, -1, 0, -4, -2, -2, -5, -4, -4, -4, -5, -4, -4, -4, -4, 0, -1, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -4,
+    0, 0, -4, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -2, 0, -1, -1, -1, -1, -4, -1, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -5, -4, -4, -5, -5, -5, -5, -4, -5, -4, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, -6, -4, -1, -1, -4, -1, -1, -4, -4, -4, 0, -4, -3, -5, -5, -5, 0, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3,
+    0, 0, -4, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -2, 0, -1, -1, -1, -1, -7, -1, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -5, -4, -4, -5, -5, -5, -5, -4, -5, -4, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, -6, -4, -1, -1, -4, -1, -1, -4, 0, -4, 0, -4, -3, -5, -5, -5, 0, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -2, 0, -1, -1, -1, -1, -4, -1, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -5, -4, -4, -5, -5, -5, -5, -4, -5, -4, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, -6, -4, -1, -1, -4, -1, -1, -4, 1, 0, 2, -4, -3, -4, -5, -3, 0, -1, -4, -4, -4, -4, 0, 0, 0, 0, 1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3,
+    0, 0, -7, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -9, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -5, -4, -4, -5, -4, -4, -4, -4, -6, -5, -4, -7, -6, -8, -8, -4, 0, 0, -4, -4, -4, -4, -4, -3, -4, -4, -4, -8, -4, -4, -5, -4, -4, -6, -4, -5, -6, -4, -4, -4, -4, -6, -4, -6, 0, 0, -7, -4, 0, -2, -8, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -4, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, -7, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -8, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -5, -4, -4, -5, -4, -4, -4, -4, -6, -5, -4, -7, -6, -8, -8, -4, 0, 0, -4, -4, -4, -4, -4, -3, -4, -4, -4, -8, -4, -4, -5, -4, -4, -6, -4, -5, -6, -4, -4, -4, -4, -6, -4, -6, 0, 0, -7, -4, 0, -2, -8, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -4, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -2,
+    7, 0, 0, 6, 0, 0, 0, 6, 0, 0, 6, 5, 6, 5, 5, 6, 6, 5, 6, 6, 3, 2, 3, 3, 3, 3, 2, 3, 3, 2, 0, 2, 2, 3, 2, 3, 2, 4, 2, 0, 2, 3, 2, 2, 1, 2, 2, 0, 0, 3, 2, 3, 3, 3, 3, 3, 2, 3, 0, 2, 3, 2, 2, 3, 1, 3, 2, 1, 3, 3, 3, 3, 1, 3, 1, 0, 0, 1, 3, 6, 4, 0, 2, 1, 3, 2, 2, 2, 3, 3, 3, 3, 3, 0, 6, 4, 3, 3, 3, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 6, 3, 0, 0, 0, 0, 0, 5,
+    0, 0, -6, -1, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -6, -4, -4, -4, -4, -4, -5, -4, -4, -4, -8, -5, -5, -5, -5, -4, -5, -4, -5, -6, -4, -4, -4, -4, -5, -4, -5, 0, 0, -4, -4, -4, -4, -4, -4, -4, -5, -4, -8, -5, -4, -5, -5, -4, -6, -4, -5, -6, -4, -4, -4, -4, -6, -4, -6, 0, 0, -5, -4, -1, 0, -8, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -2, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, -6, -1, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -6, -4, -4, -4, -4, -4, -5, -4, -4, -4, -8, -5, -5, -5, -5, -4, -5, -4, -5, -6, -4, -4, -4, -4, -5, -4, -5, 0, 0, -4, -4, -4, -4, -4, -4, -4, -5, -4, -8, -5, -4, -5, -5, -4, -6, -4, -5, -6, -4, -4, -4, -4, -6, -4, -6, 0, 0, -5, -4, -1, 0, -8, -4, -5, -4, -3, -4, -3, -4, -4, -4, -4, -4, 0, -2, -3, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -2,
+    0, 3, 0, 0, -1, 1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, -4, 0, 0, -5, -2, -1, 0, -1, -1, -1, -1, -1, -1, -10, -1, -1, -1, -1, -1, -1, -1, -1, -5, -8, -1, -5, -3, -7, -6, -4, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -5, -1, -1, -1, -1, 0, -2, 0, -2, -3, -1, -1, -2, -1, -5, -2, -4, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 1, 0,
+    1, 2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -5, 1, -1, -1, -1, -1, -1, -1, -1, -1, -3, -1, -1, -1, -1, -1, -1, -2, -1, -1, -3, -1, -5, -4, -2, -6, -1, 0, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -5, -1, 0, -1, -1, -1, -2, -1, -1, -1, -3, -1, -2, -2, -2, -2, -1, 1, 0, -5, -1, 0, 0, -3, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 1, 0, 0, 0, -1, 0, 0, 4, 3, 3, -1, -1, -1, 1, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -2, 0, -1, -2, -1, -1, -6, -1, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -5, -5, -5, -5, -4, -5, -4, 0, 0, -4, -5, -4, -4, -4, -5, -4, -3, -3, -8, -3, -3, -3, -3, -4, -4, -4, -3, -3, -5, -4, -5, -5, -3, -5, -3, 0, 0, -7, -4, 0, -1, -4, -1, -1, -4, -4, -4, -4, -4, -3, -5, -5, -5, 0, 0, -4, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3,
+    0, 0, -4, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -2, 0, -1, -5, -1, -1, -8, -1, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -9, -5, -8, -7, -4, -9, -4, 0, 0, -4, -5, -4, -4, -4, -5, -4, -3, -3, -8, -3, -3, -3, -3, -4, -4, -4, -3, -3, -5, -4, -5, -5, -3, -5, -3, 0, 0, -8, -4, 0, -2, -4, -1, -1, -4, -4, -4, -4, -4, -3, -5, -5, -5, 0, 0, -4, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3,
+    0, 0, -4, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, -6, -1, -1, -8, -2, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -11, -4, -8, -7, -4, -10, -4, 0, 0, -3, -4, -3, -3, -3, -4, -3, -4, -4, -8, -4, -3, -4, -4, -3, -5, -3, -4, -4, -4, -4, -6, -5, -4, -6, -4, 0, 0, -7, -3, 0, -2, -5, -2, -2, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -3,
+    0, 0, -4, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -6, 0, -2, -6, -2, -1, -8, -1, -4, -5, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -5, -4, -5, -4, -4, -11, -5, -8, -7, -4, -9, -4, 0, 0, -5, -5, -6, -6, -6, -5, -6, -3, -3, -6, -3, -3, -3, -3, -6, -5, -5, -4, -3, -5, -5, -5, -5, -4, -5, -4, 0, 0, -8, -6, 0, -2, -4, -1, -2, -5, -4, -4, -4, -5, -3, -5, -5, -5, 0, 0, -5, -5, -5, -6, 0, 0, 0, 0, 0, -6, -6, -5, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 1, 0, 2, 2, 3, 1, 1, 1, 1, 0, 1, 0, 1, 0, 2, 2, 2, 1, 1, 1, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 2, 3, 0, 2, 2, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 1, 5, 4, 4, 2, 4, 4, 3, 3, 4, 4, 3, 2, 4, 1, 4, 2, 5, 5, 4, 4, 3, 4, 2, 0, 0, 0, 6, 0, 0, 0, 3, 0, 4, 5, 1, 4, 5, 1, 1, 0, 0, 0, 1, 1, 2, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 4, 3, 2, 2, 3, 3, 3, 2, 3, 3, 2, 2, 3, 1, 2, 2, 4, 4, 4, 3, 3, 4, 2, 0, 0, 1, 4, 1, 1, 1, 4, 1, 3, 4, 0, 4, 4, 3, 3, 1, 3, 1, 3, 1, 4, 4, 5, 5, 3, 5, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 0, 1, 2, -4, -2, 2, 2, 3, 2, 1, 2, 2, 1, -8, 1, 1, 2, 1, 2, 1, 2, 1, 0, -3, 2, 1, 1, -2, 0, -4, 0, 0, -1, 1, 0, -1, -1, 2, 0, 1, 1, -2, 1, 1, 0, 1, 0, 0, 0, 0, -1, 1, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 1, 1, 4, 6, 0, 0, 0, 0, 1, 4, 1, 0, 0, 1, 2, -2, 1, 1, 0,
+    0, 0, -6, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -2, -1, -1, 0, -1, 0, -1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -4, -4, -4, -6, -4, -4, -4, -4, -5, -4, -4, 0, 0, -3, -4, -3, -3, -3, -4, -3, -4, -4, -8, -4, -3, -4, -4, -3, -6, -3, -4, -6, -4, -4, -6, -5, -7, -6, -5, 0, 0, -6, -3, 0, 0, -8, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -6, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -2, -1, -1, 0, -3, 0, -1, -8, -4, -4, -4, -4, -4, -4, -4, -4, -4, -8, -4, -4, -4, -4, -4, -4, -4, -4, -6, -6, -4, -6, -6, -7, -6, -4, 0, 0, -3, -4, -3, -3, -3, -4, -3, -4, -4, -8, -4, -3, -4, -4, -3, -6, -3, -4, -6, -4, -4, -6, -5, -7, -6, -5, 0, 0, -7, -3, 0, -2, -8, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, -1, -3, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -4, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -4, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, -5, -1, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, -3, -4, -4, -4, -4, -4, -4, -3, -3, -8, -3, -3, -3, -3, -4, -4, -4, -3, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, -6, -4, 0, 0, -4, -1, -1, -4, -4, -4, -4, -4, -3, -4, -4, -4, 0, 0, -3, -3, -3, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 1, 1, 0, 2, 2, 3, 0, 1, 1, 1, 0, 1, 0, 1, 0, 2, 2, 3, 2, 2, 3, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 3, 0, 2, 2, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 4, 4, 0, 4, 5, 3, 3, 4, 4, 3, 0, 4, 0, 4, 1, 5, 5, 5, 4, 4, 5, 3, 0, 0, 0, 5, 0, 0, 0, 2, 0, 4, 5, 1, 4, 4, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, -2, 0, 0, -5, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, -8, -1, -4, -3, 0, -5, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -4, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -5, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0,
+    6, 0, 1, 4, 0, 0, 0, 1, 0, 0, 3, 5, 5, 5, 3, 5, 4, 4, 4, 5, 0, 4, 2, 0, 2, 2, 2, 0, 2, 2, 1, 2, 2, 2, 2, 0, 2, 0, 2, 1, 1, 1, 1, 1, 2, 1, 2, 0, 0, 1, 2, 1, 1, 1, 0, 1, 2, 2, 0, 2, 2, 2, 2, 1, 1, 1, 2, 2, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 1, 5, 5, 2, 4, 4, 0, 2, 2, 2, 0, 2, 1, 1, 1, 0, 5, 2, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 5, 1, 0, 0, 0, 0, 0, 2,
+    4, 0, 0, 3, 0, 0, 0, 2, 0, 0, 3, 3, 3, 3, 2, 3, 3, 0, 3, 2, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, -2, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 4, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1,
+    0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 1, 3, 1, 1, -2, 1, 1, 2, 1, 2, 1, 2, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 2, 1, 1, 1, 1, 1, -3, 0, 1, 1, 0, 0, 1, 0, 0, 0, 2, 2, 1, 2, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 2, 1, 1, 1, 2, 1, 3, 1, 1, 2, 1, 1, 1, 0, 1, 2, -2, 1, -1, 0, 1, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 1, 1, 3, 1, 1, -2, 1, 1, 2, 1, 2, 1, 2, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 2, 1, 1, 1, 1, 1, -3, 0, 1, 1, 0, 0, 1, 0, 1, 0, 2, 2, 1, 2, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -6, 0, -2, -3, -2, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2, -3, -2, -3, -2, -2, -3, -3, -4, -4, -2, -4, -2, 0, 0, -2, -3, -2, -2, -2, -2, -2, -1, -1, -6, -1, -1, -1, -1, -2, -3, -2, -1, -2, -2, -2, -3, -2, -1, -2, -1, 0, 0, -5, -2, 0, 0, -2, 0, 0, -3, -2, -2, -2, -3, -1, -3, -3, -3, 0, 0, -2, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, -1, 2, 0, 0, 1, 1, -4, 1, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, -1, -3, -3, 0, -3, 0, 0, 0, -4, 0, 1, 0, 0, 1, 1, -2, 0, 0, 0, -1, 0, -1, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair opendyslexic_14_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_14_bolditalic = {
     opendyslexic_14_bolditalicBitmaps,
     opendyslexic_14_bolditalicGlyphs,
     opendyslexic_14_bolditalicIntervals,
-    52,
+    53,
     53,
     38,
     -16,
     true,
+    opendyslexic_14_bolditalicKernLeftClasses,
+    128,
+    opendyslexic_14_bolditalicKernRightClasses,
+    124,
+    opendyslexic_14_bolditalicKernMatrix,
+    120,
+    118,
+    opendyslexic_14_bolditalicLigatures,
+    5,
 };
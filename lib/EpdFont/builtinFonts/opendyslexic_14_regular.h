@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_regularBitmaps[70319] = {
+static const uint8_t opendyslexic_14_regularBitmaps[71062] = {
     0x00, 0xA0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0,
     0x0F, 0xC0, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0,
     0xFF, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xE0, 0xFF, 0x83, 0xFF, 0x1F,
@@ -4402,7 +4402,54 @@ static const uint8_t opendyslexic_14_regularBitmaps[70319] = {
     0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x03,
     0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x04,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xE0, 0x1A,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x95, 0x00, 0x1A, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x95, 0x00, 0x1A, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xFE, 0x00, 0xBF, 0xF0, 0x0F,
+    0xC0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3C,
+    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xD6, 0xFF, 0xAA, 0xAB, 0xFA, 0xA4, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x07, 0xE0,
+    0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xC0,
+    0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00,
+    0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00,
+    0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x2F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xFE, 0x07, 0xFC, 0x01,
+    0xFF, 0xE0, 0xBF, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0x0B, 0xFF,
+    0xFF, 0x02, 0xF0, 0x6B, 0xFA, 0x90, 0x2F, 0x00, 0x7E, 0x00, 0x02, 0xF0, 0x07, 0xE0, 0x00, 0x2F,
+    0x00, 0x7E, 0x00, 0x02, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x07, 0xF0,
+    0x00, 0x3F, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x03, 0xF0,
+    0x0B, 0xF0, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0x40, 0xBF, 0x00,
+    0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0x1F, 0xFE, 0x00,
+    0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0xF0, 0x00, 0x02,
+    0xF0, 0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0xFF, 0xF0, 0x0F,
+    0xC0, 0x2F, 0xFF, 0xFC, 0x03, 0xF0, 0x06, 0xBF, 0xA9, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F,
+    0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xF8,
+    0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xE0,
+    0x00, 0xBF, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x7E, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xC0,
+    0x02, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0xBF, 0x00, 0x01, 0xFF, 0xF4, 0x2F, 0xC0, 0x00, 0x7F, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x03, 0xFE, 0x01, 0xFF, 0xE0, 0x0B,
+    0xFF, 0x03, 0xFE, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07,
+    0xC0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xF8, 0xBF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x40, 0xF4, 0x6F, 0xFA, 0xAA, 0xBF, 0xAA, 0x40, 0xF4, 0x07, 0xE0, 0x00, 0x2F, 0x40,
+    0x00, 0xF4, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xF4,
+    0x07, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0xF4, 0x07, 0xF0,
+    0x00, 0x3F, 0x80, 0x00, 0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x3F,
+    0x80, 0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xF8, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x01,
+    0xFC, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x0B,
+    0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F,
+    0xE0, 0x02, 0xFF, 0x00, 0x2F, 0x40, 0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0x00, 0x2F, 0x00, 0x03, 0xF0,
+    0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xC0,
+    0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xC0,
+    0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7E, 0x00, 0xBF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x40, 0x7E, 0x00, 0x6F, 0xFA, 0xAA, 0xBF, 0xAA, 0x40, 0x7D, 0x00, 0x07, 0xE0,
+    0x00, 0x2F, 0x40, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x07, 0xE0,
+    0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x07, 0xF0,
+    0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xBD, 0x00, 0x07, 0xF0,
+    0x00, 0x3F, 0x80, 0x00, 0xBD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0xF0,
+    0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xF0,
+    0x00, 0x3F, 0x80, 0x00, 0xFF, 0xFC, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xFC, 0x0B, 0xF0,
+    0x00, 0x3F, 0x80, 0x00, 0xBF, 0xFD,
 };
 
 static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
@@ -5111,6 +5158,11 @@ static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
     { 19, 24, 32, 7, 22, 114, 69973 }, // ≠
     { 21, 22, 25, 2, 20, 116, 70087 }, // ≤
     { 21, 22, 25, 2, 20, 116, 70203 }, // ≥
+    { 21, 24, 29, 4, 24, 126, 70319 }, // ﬀ
+    { 18, 26, 25, 4, 26, 117, 70445 }, // ﬁ
+    { 21, 24, 29, 4, 24, 126, 70562 }, // ﬂ
+    { 28, 26, 37, 4, 26, 182, 70688 }, // ﬃ
+    { 32, 24, 40, 4, 24, 192, 70870 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_14_regularIntervals[] = {
@@ -5166,15 +5218,94 @@ static const EpdUnicodeInterval opendyslexic_14_regularIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_14_regularKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 1 }, // "
+    { 0x23, 1 }, // #
+    { 0x27, 1 }, // '
+    { 0x28, 1 }, // (
+    { 0x29, 1 }, // )
+    { 0x2A, 1 }, // *
+    { 0x2C, 1 }, // ,
+    { 0x2D, 1 }, // -
+    { 0x2E, 1 }, // .
+    { 0x2F, 1 }, // /
+    { 0x3A, 1 }, // :
+    { 0x3B, 1 }, // ;
+    { 0x3F, 1 }, // ?
+    { 0x5B, 1 }, // [
+    { 0x5C, 1 }, // <backslash>
+    { 0x5D, 1 }, // ]
+    { 0x5F, 1 }, // _
+    { 0x7B, 1 }, // {
+    { 0x7D, 1 }, // }
+    { 0xA1, 1 }, // ¡
+    { 0xAB, 1 }, // «
+    { 0xAD, 1 }, // ­
+    { 0xB7, 1 }, // ·
+    { 0xBB, 1 }, // »
+    { 0xBF, 1 }, // ¿
+    { 0x2010, 1 }, // ‐
+    { 0x2011, 1 }, // ‑
+    { 0x2012, 1 }, // ‒
+    { 0x2013, 1 }, // –
+    { 0x2014, 1 }, // —
+    { 0x2015, 1 }, // ―
+    { 0x2016, 1 }, // ‖
+    { 0x2017, 1 }, // ‗
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 1 }, // ‚
+    { 0x201B, 1 }, // ‛
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 1 }, // „
+    { 0x201F, 1 }, // ‟
+    { 0x2022, 1 }, // •
+    { 0x2023, 1 }, // ‣
+    { 0x2024, 1 }, // ․
+    { 0x2025, 1 }, // ‥
+    { 0x2026, 1 }, // …
+    { 0x2027, 1 }, // ‧
+    { 0x2039, 1 }, // ‹
+    { 0x203A, 1 }, // ›
+};
+
+static const EpdKernClassEntry opendyslexic_14_regularKernRightClasses[] = {
+    { 0x20, 1 }, //  
+};
+
+static const int8_t opendyslexic_14_regularKernMatrix[1] = {
+    5,
+};
+
+static const EpdLigaturePair opendyslexic_14_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_14_regular = {
     opendyslexic_14_regularBitmaps,
     opendyslexic_14_regularGlyphs,
     opendyslexic_14_regularIntervals,
-    52,
+    53,
     53,
     38,
     -16,
     true,
+    opendyslexic_14_regularKernLeftClasses,
+    50,
+    opendyslexic_14_regularKernRightClasses,
+    1,
+    opendyslexic_14_regularKernMatrix,
+    1,
+    1,
+    opendyslexic_14_regularLigatures,
+    5,
 };
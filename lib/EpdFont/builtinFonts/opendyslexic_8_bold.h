@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_boldBitmaps[28196] = {
+static const uint8_t opendyslexic_8_boldBitmaps[28485] = {
     0x00, 0x03, 0x00, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xF0, 0x7C, 0x1F, 0x0B, 0xC2, 0xF0, 0x7C, 0x07,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF5, 0xFE, 0xBF, 0x9A, 0x90, 0x2A, 0x86, 0xA4, 0xFF,
     0x1F, 0xD3, 0xF4, 0x7F, 0x0F, 0xD1, 0xFC, 0x3F, 0x47, 0xF0, 0xFE, 0x2F, 0xC0, 0x00, 0x0B, 0x82,
@@ -1770,7 +1770,25 @@ static const uint8_t opendyslexic_8_boldBitmaps[28196] = {
     0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x1F,
     0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x6F, 0xFD, 0x01, 0xBF, 0xFF, 0xE4, 0x0F, 0xFF, 0x90,
     0x00, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x5A, 0xB8, 0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xFA, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFE, 0x0B, 0xF8, 0x3F, 0xE0, 0xF4,
+    0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xE2, 0xF9, 0x5B, 0xE5,
+    0x0F, 0x40, 0x7D, 0x01, 0xF8, 0x07, 0xD0, 0x1F, 0x80, 0x7D, 0x01, 0xF8, 0x07, 0xD0, 0x1F, 0x80,
+    0x7D, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x68, 0x00, 0x00, 0xBD, 0x03, 0xF8, 0xFD, 0x0B, 0xF8,
+    0xFE, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0xFC, 0x3C, 0x7F, 0xFC, 0x3C, 0x2F, 0x94, 0x7C,
+    0x0F, 0x40, 0x7C, 0x1F, 0x80, 0x7C, 0x1F, 0x80, 0x7C, 0x1F, 0x80, 0x7C, 0x1F, 0x80, 0x7D, 0x1F,
+    0x80, 0xBD, 0x00, 0x00, 0x19, 0x00, 0x3F, 0x82, 0xF0, 0x0B, 0xF8, 0x2E, 0x00, 0xF4, 0x02, 0xE0,
+    0x0F, 0x00, 0x3E, 0x07, 0xFF, 0xC3, 0xD0, 0x7F, 0xFC, 0x3D, 0x02, 0xF9, 0x43, 0xD0, 0x0F, 0x40,
+    0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x01, 0xF8, 0x03, 0xD4, 0x1F, 0x80, 0x3F, 0xD1,
+    0xF8, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0xC0, 0xBF,
+    0x2F, 0x81, 0xFF, 0x07, 0xFC, 0xBF, 0x0B, 0x80, 0x3E, 0x00, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0xFF, 0xFF, 0xFC, 0x3C, 0x1F, 0xD5, 0x7F, 0x50, 0xF0, 0x3F, 0x00,
+    0xF8, 0x03, 0xC0, 0xFC, 0x03, 0xE0, 0x0F, 0x03, 0xF0, 0x0F, 0xC0, 0x3D, 0x0F, 0xC0, 0x3F, 0x00,
+    0xF4, 0x3F, 0x00, 0xFC, 0x03, 0xE0, 0xFC, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x64,
+    0x00, 0xFE, 0x07, 0xF8, 0x2E, 0x00, 0xBF, 0x83, 0xFE, 0x0F, 0x80, 0x3D, 0x00, 0xF0, 0x03, 0xD0,
+    0x0F, 0x00, 0x3C, 0x00, 0xF4, 0x1F, 0xFF, 0xFF, 0xF8, 0x3D, 0x07, 0xFF, 0xFF, 0xFE, 0x0F, 0x40,
+    0xBE, 0x56, 0xF9, 0x43, 0xD0, 0x0F, 0x40, 0x7D, 0x00, 0xF0, 0x07, 0xE0, 0x1F, 0x40, 0x3C, 0x01,
+    0xF8, 0x07, 0xD0, 0x1F, 0x00, 0x7E, 0x01, 0xF4, 0x07, 0xD4, 0x1F, 0x80, 0x7D, 0x01, 0xFF, 0x07,
+    0xE0, 0x2F, 0x80, 0x7F, 0xD0,
 };
 
 static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
@@ -2479,6 +2497,11 @@ static const EpdGlyph opendyslexic_8_boldGlyphs[] = {
     { 13, 15, 21, 4, 14, 49, 28037 }, // ≠
     { 15, 15, 13, -1, 13, 57, 28086 }, // ≤
     { 15, 14, 14, 0, 12, 53, 28143 }, // ≥
+    { 14, 14, 18, 2, 14, 49, 28196 }, // ﬀ
+    { 12, 15, 16, 2, 15, 45, 28245 }, // ﬁ
+    { 14, 14, 18, 2, 14, 49, 28290 }, // ﬂ
+    { 19, 15, 22, 2, 15, 72, 28339 }, // ﬃ
+    { 21, 14, 25, 2, 14, 74, 28411 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_8_boldIntervals[] = {
@@ -2534,15 +2557,94 @@ static const EpdUnicodeInterval opendyslexic_8_boldIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_8_boldKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 1 }, // "
+    { 0x23, 1 }, // #
+    { 0x27, 1 }, // '
+    { 0x28, 1 }, // (
+    { 0x29, 1 }, // )
+    { 0x2A, 1 }, // *
+    { 0x2C, 1 }, // ,
+    { 0x2D, 1 }, // -
+    { 0x2E, 1 }, // .
+    { 0x2F, 1 }, // /
+    { 0x3A, 1 }, // :
+    { 0x3B, 1 }, // ;
+    { 0x3F, 1 }, // ?
+    { 0x5B, 1 }, // [
+    { 0x5C, 1 }, // <backslash>
+    { 0x5D, 1 }, // ]
+    { 0x5F, 1 }, // _
+    { 0x7B, 1 }, // {
+    { 0x7D, 1 }, // }
+    { 0xA1, 1 }, // ¡
+    { 0xAB, 1 }, // «
+    { 0xAD, 1 }, // ­
+    { 0xB7, 1 }, // ·
+    { 0xBB, 1 }, // »
+    { 0xBF, 1 }, // ¿
+    { 0x2010, 1 }, // ‐
+    { 0x2011, 1 }, // ‑
+    { 0x2012, 1 }, // ‒
+    { 0x2013, 1 }, // –
+    { 0x2014, 1 }, // —
+    { 0x2015, 1 }, // ―
+    { 0x2016, 1 }, // ‖
+    { 0x2017, 1 }, // ‗
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 1 }, // ‚
+    { 0x201B, 1 }, // ‛
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 1 }, // „
+    { 0x201F, 1 }, // ‟
+    { 0x2022, 1 }, // •
+    { 0x2023, 1 }, // ‣
+    { 0x2024, 1 }, // ․
+    { 0x2025, 1 }, // ‥
+    { 0x2026, 1 }, // …
+    { 0x2027, 1 }, // ‧
+    { 0x2039, 1 }, // ‹
+    { 0x203A, 1 }, // ›
+};
+
+static const EpdKernClassEntry opendyslexic_8_boldKernRightClasses[] = {
+    { 0x20, 1 }, //  
+};
+
+static const int8_t opendyslexic_8_boldKernMatrix[1] = {
+    3,
+};
+
+static const EpdLigaturePair opendyslexic_8_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_8_bold = {
     opendyslexic_8_boldBitmaps,
     opendyslexic_8_boldGlyphs,
     opendyslexic_8_boldIntervals,
-    52,
+    53,
     30,
     22,
     -9,
     true,
+    opendyslexic_8_boldKernLeftClasses,
+    50,
+    opendyslexic_8_boldKernRightClasses,
+    1,
+    opendyslexic_8_boldKernMatrix,
+    1,
+    1,
+    opendyslexic_8_boldLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_bolditalicBitmaps[33453] = {
+static const uint8_t opendyslexic_8_bolditalicBitmaps[33771] = {
     0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00,
     0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x28,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x02,
@@ -2098,7 +2098,27 @@ static const uint8_t opendyslexic_8_bolditalicBitmaps[33453] = {
     0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3F, 0xE0,
     0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x6F,
     0xFC, 0x01, 0x6F, 0xFF, 0xE8, 0x03, 0xFF, 0xE4, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x04, 0x05, 0x6B,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
+    0xBF, 0x00, 0xFF, 0x83, 0xFD, 0x01, 0xF4, 0x07, 0xC0, 0x02, 0xE0, 0x0F, 0x40, 0x1F, 0xFF, 0xFF,
+    0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x1F, 0xD5, 0x7F, 0x50, 0x0F, 0xC0, 0x3E, 0x00, 0x1F, 0x80, 0x7D,
+    0x00, 0x2F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0xBD, 0x02, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x3F, 0x00, 0x3F, 0xE2, 0xFC,
+    0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xFF, 0xF2, 0xD0, 0x0B, 0xFF, 0x8F, 0x40, 0x1F,
+    0xD4, 0x3C, 0x00, 0x3F, 0x01, 0xE0, 0x01, 0xF8, 0x0F, 0x40, 0x0B, 0xD0, 0x3D, 0x00, 0x3F, 0x01,
+    0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x0B, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xFF,
+    0x07, 0xC0, 0x0F, 0xF8, 0x3E, 0x00, 0x7C, 0x00, 0xF0, 0x02, 0xE0, 0x0B, 0xC0, 0x7F, 0xFC, 0x3E,
+    0x02, 0xFF, 0xE0, 0xF0, 0x07, 0xF5, 0x0B, 0xC0, 0x0F, 0xC0, 0x3E, 0x00, 0x7E, 0x00, 0xF4, 0x02,
+    0xF4, 0x07, 0xC0, 0x0F, 0xC0, 0x3E, 0x00, 0x3F, 0x00, 0xFF, 0x42, 0xF4, 0x07, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xFD, 0x0B, 0xF7, 0xF0, 0x01,
+    0xFF, 0x0B, 0xFE, 0xFC, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xE5, 0x6F, 0x9B, 0xC0, 0x02, 0xF0,
+    0x0B, 0xC2, 0xE0, 0x00, 0xFC, 0x03, 0xE0, 0xF4, 0x00, 0x3E, 0x01, 0xF4, 0x3C, 0x00, 0x2F, 0x40,
+    0xBC, 0x2F, 0x00, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0x83, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0xBC, 0x00, 0xFF, 0x83, 0xFD, 0x0F, 0x40, 0x1F,
+    0x00, 0x7C, 0x01, 0xF0, 0x02, 0xE0, 0x0F, 0x40, 0x2F, 0x01, 0xFF, 0xFF, 0xFF, 0xC3, 0xD0, 0x2F,
+    0xFF, 0xFF, 0xF8, 0x7C, 0x01, 0xFD, 0x57, 0xF5, 0x0B, 0xC0, 0x0F, 0xC0, 0x3E, 0x00, 0xF4, 0x01,
+    0xF8, 0x07, 0xD0, 0x1F, 0x00, 0x2F, 0x40, 0xBC, 0x02, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x3E, 0x00,
+    0x3F, 0x01, 0xF8, 0x03, 0xFD, 0x0B, 0xD0, 0x2F, 0x40, 0x7F, 0xC0,
 };
 
 static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
@@ -2807,6 +2827,11 @@ static const EpdGlyph opendyslexic_8_bolditalicGlyphs[] = {
     { 16, 15, 22, 3, 14, 60, 33277 }, // ≠
     { 16, 15, 13, -2, 13, 60, 33337 }, // ≤
     { 16, 14, 14, 0, 12, 56, 33397 }, // ≥
+    { 16, 13, 18, 2, 13, 52, 33453 }, // ﬀ
+    { 15, 15, 16, 2, 15, 57, 33505 }, // ﬁ
+    { 15, 14, 18, 2, 14, 53, 33562 }, // ﬂ
+    { 21, 15, 22, 2, 15, 79, 33615 }, // ﬃ
+    { 22, 14, 25, 2, 14, 77, 33694 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_8_bolditalicIntervals[] = {
@@ -2862,15 +2887,412 @@ static const EpdUnicodeInterval opendyslexic_8_bolditalicIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_8_bolditalicKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x24, 3 }, // $
+    { 0x26, 4 }, // &
+    { 0x27, 5 }, // '
+    { 0x28, 6 }, // (
+    { 0x29, 7 }, // )
+    { 0x2A, 8 }, // *
+    { 0x2C, 9 }, // ,
+    { 0x2E, 10 }, // .
+    { 0x30, 11 }, // 0
+    { 0x31, 12 }, // 1
+    { 0x32, 13 }, // 2
+    { 0x33, 14 }, // 3
+    { 0x34, 15 }, // 4
+    { 0x35, 16 }, // 5
+    { 0x36, 17 }, // 6
+    { 0x37, 18 }, // 7
+    { 0x38, 19 }, // 8
+    { 0x39, 20 }, // 9
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 25 }, // D
+    { 0x45, 26 }, // E
+    { 0x46, 27 }, // F
+    { 0x47, 28 }, // G
+    { 0x48, 29 }, // H
+    { 0x49, 30 }, // I
+    { 0x4A, 31 }, // J
+    { 0x4B, 32 }, // K
+    { 0x4C, 33 }, // L
+    { 0x4D, 29 }, // M
+    { 0x4E, 34 }, // N
+    { 0x4F, 35 }, // O
+    { 0x50, 36 }, // P
+    { 0x51, 37 }, // Q
+    { 0x52, 38 }, // R
+    { 0x53, 39 }, // S
+    { 0x54, 40 }, // T
+    { 0x55, 41 }, // U
+    { 0x56, 42 }, // V
+    { 0x57, 43 }, // W
+    { 0x58, 44 }, // X
+    { 0x59, 45 }, // Y
+    { 0x5A, 46 }, // Z
+    { 0x5B, 47 }, // [
+    { 0x5D, 48 }, // ]
+    { 0x61, 49 }, // a
+    { 0x62, 50 }, // b
+    { 0x63, 51 }, // c
+    { 0x64, 52 }, // d
+    { 0x65, 53 }, // e
+    { 0x66, 54 }, // f
+    { 0x67, 55 }, // g
+    { 0x68, 56 }, // h
+    { 0x69, 57 }, // i
+    { 0x6A, 58 }, // j
+    { 0x6B, 59 }, // k
+    { 0x6C, 60 }, // l
+    { 0x6D, 61 }, // m
+    { 0x6E, 62 }, // n
+    { 0x6F, 63 }, // o
+    { 0x70, 64 }, // p
+    { 0x71, 65 }, // q
+    { 0x72, 66 }, // r
+    { 0x73, 67 }, // s
+    { 0x74, 68 }, // t
+    { 0x75, 69 }, // u
+    { 0x76, 70 }, // v
+    { 0x77, 71 }, // w
+    { 0x78, 72 }, // x
+    { 0x79, 73 }, // y
+    { 0x7A, 74 }, // z
+    { 0x7B, 75 }, // {
+    { 0x7D, 76 }, // }
+    { 0xA1, 77 }, // ¡
+    { 0xA2, 78 }, // ¢
+    { 0xA3, 79 }, // £
+    { 0xA5, 80 }, // ¥
+    { 0xBF, 81 }, // ¿
+    { 0xC1, 82 }, // Á
+    { 0xC4, 82 }, // Ä
+    { 0xC5, 82 }, // Å
+    { 0xC6, 83 }, // Æ
+    { 0xC7, 84 }, // Ç
+    { 0xCC, 85 }, // Ì
+    { 0xCD, 86 }, // Í
+    { 0xCE, 87 }, // Î
+    { 0xCF, 88 }, // Ï
+    { 0xD3, 89 }, // Ó
+    { 0xD6, 89 }, // Ö
+    { 0xD8, 90 }, // Ø
+    { 0xD9, 91 }, // Ù
+    { 0xDB, 91 }, // Û
+    { 0xDC, 91 }, // Ü
+    { 0xDE, 92 }, // Þ
+    { 0xDF, 93 }, // ß
+    { 0xE4, 94 }, // ä
+    { 0xE5, 95 }, // å
+    { 0xE6, 96 }, // æ
+    { 0xE7, 97 }, // ç
+    { 0xEC, 98 }, // ì
+    { 0xED, 99 }, // í
+    { 0xEE, 100 }, // î
+    { 0xEF, 101 }, // ï
+    { 0xF0, 102 }, // ð
+    { 0xF6, 103 }, // ö
+    { 0xF8, 104 }, // ø
+    { 0xFC, 105 }, // ü
+    { 0x128, 87 }, // Ĩ
+    { 0x129, 106 }, // ĩ
+    { 0x12A, 87 }, // Ī
+    { 0x12B, 107 }, // ī
+    { 0x12F, 108 }, // į
+    { 0x130, 87 }, // İ
+    { 0x131, 109 }, // ı
+    { 0x152, 110 }, // Œ
+    { 0x153, 111 }, // œ
+    { 0x2018, 112 }, // ‘
+    { 0x2019, 113 }, // ’
+    { 0x201A, 114 }, // ‚
+    { 0x201C, 115 }, // “
+    { 0x201D, 116 }, // ”
+    { 0x201E, 114 }, // „
+    { 0xFB01, 117 }, // ﬁ
+    { 0xFB02, 118 }, // ﬂ
+};
+
+static const EpdKernClassEntry opendyslexic_8_bolditalicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x24, 3 }, // $
+    { 0x26, 4 }, // &
+    { 0x27, 5 }, // '
+    { 0x28, 6 }, // (
+    { 0x29, 7 }, // )
+    { 0x2A, 8 }, // *
+    { 0x2C, 9 }, // ,
+    { 0x2E, 10 }, // .
+    { 0x30, 11 }, // 0
+    { 0x31, 12 }, // 1
+    { 0x32, 13 }, // 2
+    { 0x33, 14 }, // 3
+    { 0x34, 15 }, // 4
+    { 0x35, 16 }, // 5
+    { 0x36, 17 }, // 6
+    { 0x37, 18 }, // 7
+    { 0x38, 19 }, // 8
+    { 0x39, 20 }, // 9
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 25 }, // D
+    { 0x45, 26 }, // E
+    { 0x46, 27 }, // F
+    { 0x47, 28 }, // G
+    { 0x48, 29 }, // H
+    { 0x49, 30 }, // I
+    { 0x4A, 31 }, // J
+    { 0x4B, 32 }, // K
+    { 0x4C, 33 }, // L
+    { 0x4D, 34 }, // M
+    { 0x4E, 35 }, // N
+    { 0x4F, 36 }, // O
+    { 0x50, 37 }, // P
+    { 0x51, 38 }, // Q
+    { 0x52, 39 }, // R
+    { 0x53, 40 }, // S
+    { 0x54, 41 }, // T
+    { 0x55, 42 }, // U
+    { 0x56, 43 }, // V
+    { 0x57, 44 }, // W
+    { 0x58, 45 }, // X
+    { 0x59, 46 }, // Y
+    { 0x5A, 47 }, // Z
+    { 0x5B, 48 }, // [
+    { 0x5D, 49 }, // ]
+    { 0x61, 50 }, // a
+    { 0x62, 51 }, // b
+    { 0x63, 52 }, // c
+    { 0x64, 53 }, // d
+    { 0x65, 54 }, // e
+    { 0x66, 55 }, // f
+    { 0x67, 56 }, // g
+    { 0x68, 57 }, // h
+    { 0x69, 58 }, // i
+    { 0x6A, 59 }, // j
+    { 0x6B, 60 }, // k
+    { 0x6C, 61 }, // l
+    { 0x6D, 62 }, // m
+    { 0x6E, 63 }, // n
+    { 0x6F, 64 }, // o
+    { 0x70, 65 }, // p
+    { 0x71, 52 }, // q
+    { 0x72, 66 }, // r
+    { 0x73, 67 }, // s
+    { 0x74, 68 }, // t
+    { 0x75, 69 }, // u
+    { 0x76, 70 }, // v
+    { 0x77, 71 }, // w
+    { 0x78, 72 }, // x
+    { 0x79, 73 }, // y
+    { 0x7A, 74 }, // z
+    { 0x7B, 75 }, // {
+    { 0x7D, 76 }, // }
+    { 0xA1, 77 }, // ¡
+    { 0xA2, 78 }, // ¢
+    { 0xA3, 79 }, // £
+    { 0xA5, 80 }, // ¥
+    { 0xBF, 81 }, // ¿
+    { 0xC1, 82 }, // Á
+    { 0xC4, 82 }, // Ä
+    { 0xC5, 82 }, // Å
+    { 0xC6, 83 }, // Æ
+    { 0xC7, 84 }, // Ç
+    { 0xCC, 85 }, // Ì
+    { 0xCD, 86 }, // Í
+    { 0xCF, 87 }, // Ï
+    { 0xD3, 88 }, // Ó
+    { 0xD6, 88 }, // Ö
+    { 0xD8, 89 }, // Ø
+    { 0xD9, 90 }, // Ù
+    { 0xDB, 91 }, // Û
+    { 0xDC, 90 }, // Ü
+    { 0xDE, 92 }, // Þ
+    { 0xDF, 93 }, // ß
+    { 0xE4, 94 }, // ä
+    { 0xE5, 95 }, // å
+    { 0xE6, 96 }, // æ
+    { 0xE7, 78 }, // ç
+    { 0xEC, 97 }, // ì
+    { 0xED, 98 }, // í
+    { 0xEE, 99 }, // î
+    { 0xEF, 100 }, // ï
+    { 0xF0, 101 }, // ð
+    { 0xF6, 102 }, // ö
+    { 0xF8, 103 }, // ø
+    { 0xFC, 104 }, // ü
+    { 0x129, 105 }, // ĩ
+    { 0x12B, 106 }, // ī
+    { 0x12F, 107 }, // į
+    { 0x131, 108 }, // ı
+    { 0x152, 88 }, // Œ
+    { 0x153, 109 }, // œ
+    { 0x2018, 110 }, // ‘
+    { 0x2019, 111 }, // ’
+    { 0x201A, 112 }, // ‚
+    { 0x201C, 113 }, // “
+    { 0x201D, 114 }, // ”
+    { 0x201E, 112 }, // „
+    { 0xFB01, 115 }, // ﬁ
+    { 0xFB02, 115 }, // ﬂ
+};
+
+static const int8_t opendyslexic_8_bolditalicKernMatrix[13570] = {
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -1, -2, -1, -2, -2, -1, -1, -2, -6, -2, -2, -1, -2, -1, -2, -1, -2, -2, -1, -1, -1, -1, -2, -2, -3, -3, -2, -3, -2, -3, -3, -3, -2, -3, -2, -2, -4, -2, -2, -3, -2, -3, -3, -3, -3, -2, -2, -2, -2, -3, -2, -4, -4, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, 0,
+    0, 0, -4, -1, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -3, -1, -1, -5, -2, -2, -2, -2, -2, -2, -3, -2, -2, -5, -3, -2, -2, -2, -2, -2, -3, -2, -4, -4, -3, -5, -4, -4, -5, -2, 0, 0, -2, -3, -2, -2, -2, -3, -2, -2, -2, -5, -2, -2, -2, -2, -2, -4, -3, -4, -4, -2, -4, -4, -4, -5, -3, 0, 0, -5, -2, -1, -1, -5, -2, -3, -2, -2, -2, -2, -2, -2, -3, -3, 0, -1, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, -1, -1, -1, 0, -1, 0, -1, -1, -4, -1, -3, -2, -1, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -2, -1, -1, -2, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -4, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, -2, -1, -1, -1, -1, -1, -2, -1, -1, 0, -1, 0, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 1, 1, 0, 0, 0, -1, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, -6, -1, 0, 0, -1, 0, -1, 0, -1, -2, -1, 0, -2, -1, -3, -2, -3, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, -2, -1, -2, 0, 0, -2, -1, 0, 0, -3, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1, -2, 0, -2, -1, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, -1, -1, -1, 0, -1, 0, -1, -2, -2, -1, -2, -2, -2, -3, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -3, -1, 0, -1, -1, 0, -1, -1, -2, 0, 0, -1, -1, -2, -1, -1, 1, 0, -2, 0, 0, 0, -2, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 1, -2, 1, 0, -1, 0, 0, -3, 1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -3, -1, -4, -3, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, -1, -1, 0, 0, -2, -1, -3, -2, 0, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -1, 1, 0, 0, 0, 0, -3, 1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, -2, -2, 0, -3, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 1, 0, -3, 1, 0, 1, 1, -1, -1, 1, 0, -1, 0, -1, -1, 1, 0, 1, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, 0, -1, -2, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -2, 0, -1, 1, 0, -2, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, -1, 0, -1, 0, -1, -2, -2, -1, -3, -2, -2, -3, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, -1, -2, 0, -2, -1, -1, -2, -1, 1, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, 0, -1, -2, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, -1, 0, 0, -2, -1, -1, -2, -1, -2, -2, -2, -2, -1, 1, 0, -2, 0, 0, 0, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, 0, -1, -2, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -2, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, -1, 0, 0, -2, -1, -1, -2, -1, -2, -1, -2, -2, -1, 1, 0, -2, 0, 0, 0, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -4, -1, 0, -1, 0, -1, -1, -1, -1, 0, -3, -2, -1, -1, -1, -1, -1, -1, -1, -2, 0, 0, -1, -1, -2, -1, -2, 0, 1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -3, -1, -1, -2, -1, -1, -2, -1, -2, -1, -1, -1, -1, -2, -1, -2, 0, 1, -1, -1, 0, 1, -2, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -1, -1, 0, -1, -1, -1, -1, -1, -1, -2, -1, -2, -2, -2, -3, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, 0, -3, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -2, -2, -2, -3, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -3, -1, 0, -1, -1, 0, -1, -1, -2, 0, 0, -1, -1, -2, -1, -1, 1, 0, -2, 0, 0, 0, -2, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -4, 0, -1, 0, -1, -1, -2, -4, -1, -3, -1, -2, -2, -2, -2, -2, -5, -3, -2, -2, -2, -2, -2, -2, -2, -3, -1, -2, -2, -2, -2, -2, -2, 0, 0, -4, -1, -4, -4, -4, -2, -4, -2, -2, -4, -2, -2, -3, -3, -4, -4, -3, -5, -3, -2, -2, -2, -4, -2, -4, 0, 0, -2, -4, -1, 0, -5, -4, -4, -3, -2, -2, -2, -2, -2, -2, -2, 0, -1, -1, -3, -4, 0, 0, 0, 0, -1, -2, -4, -2, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, -1,
+    1, 0, -1, 0, -2, 0, 0, -2, 1, 1, 0, 1, 1, 1, -1, 1, 0, -2, 0, 1, -3, 1, -1, -2, -1, -1, -1, -3, -1, -1, -4, -1, -1, -1, -1, -2, -1, -3, -1, -1, -5, -2, -5, -4, -1, -5, -1, 1, -1, -2, -2, -2, -2, -2, -2, -2, -1, -1, -3, -1, -1, -1, -1, -2, -1, -1, -1, -3, -2, -4, -3, -1, -4, -1, 0, 0, -4, -2, 0, 0, -1, 0, 0, -2, -1, -1, -1, -2, -1, -2, -2, 0, 1, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, 0, -2, -1, 0, 1, -1, 0, -1,
+    0, 1, -3, 0, -1, 1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -5, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -4, -4, -4, -4, -2, 0, 0, -2, -2, -2, -2, -2, -3, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -3, -4, -2, -3, -3, -4, -3, -3, 1, 0, -4, -2, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2,
+    0, 2, -3, -1, 0, 0, 1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -4, -1, -2, -3, -2, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2, -3, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 1, -2, -2, -2, -2, -2, -3, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -2, -4, -3, -4, -4, -2, -5, -2, 1, 1, -3, -2, -1, 0, -2, -1, -1, -3, -2, -2, -2, -3, -2, -2, -2, -1, -1, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 1, 0, 0, 1, 0, -2,
+    0, 2, -4, -1, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -5, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -3, -2, -2, -3, -2, -2, -2, -2, -4, -3, -2, -4, -3, -5, -4, -2, 0, 1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -3, -2, -2, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 1, 0, -4, -2, 0, -1, -5, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 0, 1, 0, 0, 1, -1,
+    0, 2, -2, -1, 0, 0, 1, -3, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -1, -1, -4, -1, -2, -3, -2, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2, -3, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 1, 0, -3, -2, -3, -3, -3, -3, -3, -2, -2, -4, -2, -2, -2, -2, -3, -3, -2, -2, -4, -3, -5, -4, -2, -4, -2, 0, 1, -3, -3, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -2, -2, 0, 0, -2, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    -1, 2, -4, -2, 0, 0, 1, -1, -6, -5, -1, -2, -1, -1, -3, -1, -1, 0, -2, -1, -3, -4, -2, -3, -2, -2, -3, -3, -2, -2, -8, -3, -3, -2, -3, -3, -3, -3, -3, -4, -2, -2, -2, -2, -3, -2, -3, 0, 1, -3, -2, -3, -3, -3, -3, -3, -3, -2, -5, -3, -2, -4, -3, -3, -4, -4, -4, -3, -3, -3, -3, -4, -3, -4, 0, 1, -3, -3, -1, 0, -6, -4, -6, -3, -2, -2, -2, -3, -3, -2, -2, 0, -2, -2, -3, -3, 0, 0, 0, 0, -1, -3, -3, -2, 0, 0, 0, -1, -3, 1, 0, -3, 0, 0, -2,
+    -1, 1, -4, 0, -1, 1, 0, -1, -2, -1, 0, -2, -2, -2, -1, -1, 0, -2, 0, -1, -5, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -4, -2, -4, -4, -4, -4, -3, 1, 0, -2, -2, -2, -2, -2, -3, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -3, -3, -4, -2, -4, -3, -4, -4, -3, 1, 0, -4, -2, 0, -1, -4, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2,
+    0, 2, -2, 0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -3, -2, 1, 1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 1, 1, -4, -2, 0, 0, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, 0, -2, 1, 1, 0, 1, 1, -1,
+    0, 2, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 1, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -4, -2, 0, 0, -2, -1, -1, -2, -2, -2, -2, -2, -2, -3, -3, 0, 0, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    -1, 3, -4, -1, 0, 1, 2, -1, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -6, -2, -2, -3, -2, -2, -3, -3, -2, -2, -4, -4, -3, -3, -3, -3, -3, -3, -3, -4, -2, -2, -2, -2, -3, -2, -3, 0, 1, -3, -2, -3, -3, -3, -2, -3, -3, -2, -4, -3, -3, -4, -3, -3, -4, -3, -3, -3, -2, -2, -2, -4, -2, -4, 1, 2, -3, -3, -1, 0, -4, -2, -2, -3, -2, -2, -2, -3, -3, -2, -2, -1, -1, -2, -3, -3, 0, 0, 0, 0, 0, -3, -3, -2, 0, 0, 0, -1, -3, 2, 1, 0, 2, 1, -2,
+    0, 0, -3, -2, -2, 1, 0, -4, 0, 0, -2, 0, 0, -1, -4, 0, -2, -3, -2, -1, -5, -1, -2, -5, -2, -2, -2, -6, -2, -2, -3, -2, -2, -2, -2, -5, -2, -6, -2, -3, -4, -4, -4, -4, -2, -4, -2, 1, 0, -4, -4, -4, -4, -4, -3, -4, -2, -2, -4, -2, -2, -2, -2, -4, -3, -2, -3, -5, -4, -6, -4, -2, -7, -2, 0, 0, -5, -4, 0, -2, -2, -1, -1, -5, -2, -2, -2, -5, -2, -4, -4, 0, 0, -4, -4, -4, 0, 0, 0, 0, -1, -4, -4, -4, 0, 0, 0, 0, -4, 0, 0, 1, 0, 0, -2,
+    0, -2, -2, 0, -6, 1, 0, -7, 0, 0, -1, 0, 0, 0, -1, 0, 0, -3, 0, -1, -5, -1, -2, -2, -2, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2, -2, -2, -3, -2, -2, -6, -2, -6, -4, -2, -6, -2, 1, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -4, -2, -5, -4, -2, -5, -2, 0, 0, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, 0, -2, -4, -4, 0, -4, -4, -2,
+    0, 2, -3, -1, 0, 1, 1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -5, -2, -2, -2, -2, -2, -3, -2, -2, -2, -3, -3, -3, -2, -3, -2, -3, -2, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 1, -2, -2, -2, -2, -2, -2, -2, -3, -2, -5, -3, -2, -3, -3, -2, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 1, 1, -3, -2, -1, 0, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -1, -2, 1, 1, 0, 1, 1, -1,
+    0, 3, -4, -1, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -5, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -3, -2, -2, -3, -2, -2, -2, -2, -4, -3, -2, -4, -3, -4, -4, -2, 1, 1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -3, -2, -2, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 1, 0, -4, -2, 0, -1, -5, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 0, 1, 0, 0, 1, -1,
+    -1, 2, -4, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -4, -1, -1, 0, -1, 0, -6, -4, -2, -2, -2, -2, -2, -2, -2, -2, -8, -3, -3, -2, -3, -2, -3, -2, -3, -3, -2, -2, -3, -3, -5, -4, -5, 0, 1, -3, -2, -3, -3, -3, -2, -3, -3, -2, -5, -2, -2, -3, -3, -3, -3, -3, -4, -2, -2, -2, -2, -3, -2, -4, 0, 0, -4, -3, -1, -1, -5, -4, -6, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -3, -3, 0, 0, 0, 0, -1, -3, -3, -2, 0, 0, 0, -1, -3, 0, 1, -4, 1, 0, -1,
+    -1, 2, -5, -2, 0, 0, 0, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -7, -3, -3, -3, -3, -4, -4, -3, -4, -4, -2, -4, -4, -4, -4, -3, -4, -3, -4, -5, -4, -4, -5, -5, -4, -6, -4, 2, 1, -4, -4, -3, -3, -4, -3, -2, -4, -4, -2, -4, -4, -4, -4, -3, -2, -4, -4, -3, -3, -4, -4, -4, -3, -4, 0, 1, -5, -3, -1, -3, -2, -3, -3, -3, -4, -4, -4, -3, -1, -4, -4, -2, -2, -4, -4, -4, 0, 0, 0, 0, -1, -3, -3, -3, 0, 0, 0, -2, -3, 0, 1, 2, 0, 1, -2,
+    0, 1, -2, -1, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -2, 0, -1, -2, -1, -1, -5, -1, -2, -4, -2, -2, -2, -4, -2, -2, -3, -2, -2, -2, -2, -4, -2, -4, -2, -2, -4, -3, -4, -4, -2, -5, -2, 1, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -4, -2, -2, -2, -2, -3, -3, -2, -2, -4, -3, -3, -3, -2, -3, -2, 0, 0, -5, -3, 0, -1, -2, -1, -1, -4, -2, -2, -2, -4, -2, -3, -3, 0, 0, -3, -3, -3, 0, 0, 0, 0, 1, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, -4, 0, -2, 1, 0, -2, 0, 0, 0, 0, -1, -1, -1, -1, 0, -3, 0, -1, -5, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -2, -2, -2, -2, -2, -2, -3, -4, -2, -4, -4, -4, -4, -2, 1, 0, -2, -3, -2, -2, -2, -3, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -3, -4, -2, -4, -3, -4, -4, -3, 1, 0, -4, -2, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2,
+    -1, 2, -4, -1, 0, 0, 1, -1, -5, -4, -2, -1, -1, -1, -5, -1, -2, 0, -2, -1, -2, -5, -2, -4, -2, -2, -3, -3, -2, -2, -7, -3, -3, -2, -3, -3, -3, -3, -3, -4, -2, -2, -2, -2, -3, -2, -3, 0, 1, -6, -2, -6, -6, -6, -3, -6, -3, -2, -5, -3, -2, -6, -6, -6, -7, -6, -6, -4, -7, -7, -7, -6, -7, -6, 0, 1, -3, -6, -1, 0, -7, -5, -5, -4, -2, -2, -2, -3, -3, -2, -2, 0, -1, -2, -4, -6, 0, 0, 0, 0, -4, -3, -6, -2, 0, 0, 0, -4, -6, 1, 0, -2, 1, 0, -2,
+    0, 2, -4, -1, 0, 1, 1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -3, -2, -2, -2, -2, -2, -3, -2, -2, -2, -4, -3, -3, -3, -3, -2, -3, -2, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 1, -2, -2, -2, -2, -2, -2, -2, -3, -2, -5, -3, -2, -3, -3, -2, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 1, 1, -3, -2, 0, 0, -4, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, -1, -2, 1, 1, 0, 1, 1, -1,
+    -1, 2, -5, -2, 0, 0, 1, -2, 0, 0, -2, -2, -1, -2, -4, -1, -2, -1, -2, -2, -3, -5, -2, -4, -2, -3, -3, -4, -2, -2, -7, -4, -3, -3, -3, -4, -3, -4, -3, -4, -2, -2, -2, -2, -3, -2, -3, 0, 1, -5, -2, -5, -5, -5, -3, -5, -3, -3, -5, -3, -3, -5, -4, -4, -5, -4, -5, -4, -4, -4, -4, -5, -4, -5, 0, 1, -3, -5, -2, 0, -6, -5, -5, -4, -2, -2, -2, -4, -4, -2, -2, -1, -2, -2, -4, -5, 0, 0, 0, 0, -2, -3, -4, -2, 0, 0, 0, -2, -4, 1, 0, -2, 1, 0, -2,
+    -1, 2, -5, -2, 0, 0, 2, -1, 0, 0, -2, -2, -1, -2, -3, -1, -2, -1, -2, -2, 0, -4, -2, -4, -2, -3, -3, -3, -2, -2, -6, -4, -3, -3, -3, -4, -3, -4, -3, -4, -2, -2, -2, -2, -3, -2, -3, 0, 1, -4, -2, -4, -4, -4, -3, -4, -3, -3, -5, -3, -3, -4, -4, -4, -4, -4, -5, -4, -3, -3, -3, -4, -3, -4, 0, 1, -3, -4, -2, 0, -6, -4, -4, -4, -2, -2, -2, -4, -4, -2, -2, -1, -2, -2, -4, -4, 0, 0, 0, 0, -1, -3, -4, -2, 0, 0, 0, -2, -4, 1, 0, -1, 1, 0, -2,
+    0, 1, -3, -2, -1, 1, 1, -3, 0, 0, -2, 0, 0, -1, -3, 0, -2, -2, -2, -1, -4, -1, -2, -5, -2, -2, -2, -5, -2, -2, -3, -2, -2, -2, -2, -4, -2, -5, -2, -3, -2, -2, -2, -3, -2, -2, -2, 1, 0, -3, -2, -4, -4, -4, -3, -4, -2, -2, -4, -2, -2, -2, -2, -4, -3, -2, -2, -4, -4, -5, -4, -2, -5, -2, 0, 0, -4, -4, 0, -1, -2, -1, -1, -5, -2, -2, -2, -4, -2, -2, -2, 0, 0, -2, -3, -3, 0, 0, 0, 0, -1, -3, -4, -3, 0, 0, 0, 0, -4, 0, 0, 1, 0, 0, -2,
+    -1, 2, -6, -2, 0, 0, 1, -2, 0, 0, -3, -2, -2, -2, -5, -2, -3, -1, -3, -2, -3, -5, -2, -5, -2, -3, -3, -4, -2, -2, -7, -4, -3, -3, -4, -4, -3, -4, -3, -5, -2, -2, -2, -2, -3, -2, -3, 0, 0, -6, -2, -6, -6, -6, -4, -6, -3, -3, -5, -3, -3, -5, -5, -6, -5, -5, -6, -5, -4, -4, -4, -5, -4, -6, -1, 1, -3, -6, -2, -1, -7, -5, -5, -5, -2, -2, -2, -4, -4, -2, -2, -1, -2, -2, -4, -6, 0, 0, 0, 0, -3, -3, -6, -2, 0, 0, 0, -3, -6, 1, 0, -2, 0, 0, -3,
+    0, 2, -3, -1, 0, 0, 1, -1, 0, 0, -2, -1, 0, -1, -2, 0, -2, 0, -1, -1, -3, -1, -2, -4, -2, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2, -3, -2, -3, -2, -3, -2, -2, -2, -2, -2, -2, -2, 1, 1, -3, -2, -3, -3, -3, -3, -3, -2, -2, -5, -2, -2, -2, -2, -3, -3, -2, -2, -4, -3, -4, -4, -2, -4, -2, 0, 1, -3, -3, -1, 0, -2, -1, -1, -4, -2, -2, -2, -3, -2, -2, -2, 0, -1, -2, -3, -3, 0, 0, 0, 0, 0, -3, -3, -2, 0, 0, 0, -1, -3, 1, 0, 0, 1, 0, -2,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, -1, 1, 0, 1, 1, 0, 1, 1, 0, 2, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    1, 1, -2, -1, -1, 0, 0, -1, 0, 1, -1, 0, 1, 1, -1, 1, -1, -3, -1, 0, -4, -1, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -6, -3, -4, -4, -2, -5, -2, 0, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -3, -2, -3, -2, 0, -1, -5, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -3, -3, 0, 0, -2, -2, -2, 1, 1, 1, 2, 1, -2, -2, -2, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -2,
+    1, 1, -3, 0, -1, 1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -4, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -6, -2, -5, -4, -4, -6, -2, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -4, -3, -4, -4, -2, 1, -1, -4, -2, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 1, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 1, -2, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -4, 0, -1, -3, -1, -1, -4, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -6, -3, -4, -4, -2, -5, -2, 0, -2, -3, -3, -3, -3, -3, -3, -3, -2, -2, -4, -2, -2, -2, -2, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, -1, -4, -3, 0, -1, -3, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, 0, 0, 0, 2, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 2, -2, -1, 0, 0, 1, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -3, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 1, -3, -2, 0, 0, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 3, 1, 4, 3, 1, -2, -2, -2, 2, 4, 1, 0, -2, 1, 0, 0, 1, 0, -1,
+    0, 1, -2, 0, -1, 1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -1, -5, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -6, -2, -5, -4, -2, -6, -2, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -4, -3, -2, -4, -2, 1, -1, -4, -2, 0, -1, -3, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 1, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    -1, 2, -4, -1, 0, 0, 1, 0, -2, -2, 0, -1, 0, -1, -2, 0, 0, 0, -1, 0, -5, -3, -2, -2, -2, -2, -2, -2, -2, -2, -4, -3, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -3, -2, -3, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -3, -2, -2, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 0, -3, -2, -1, 0, -4, -3, -3, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 2, 1, 3, 3, 1, -2, -2, -2, 2, 4, 0, 0, -2, 0, 1, -1, 0, 1, -1,
+    0, 2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -4, 0, 0, -5, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -7, -2, -3, -3, -2, -4, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -1, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 3, 1, -2, -2, -2, 0, 0, 1, -1, -2, 0, 1, 0, 0, 1, -1,
+    1, 1, -2, 0, -1, 0, 0, -1, 0, 1, -1, 0, 1, 1, -1, 1, -1, -3, 0, 0, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -6, -2, -5, -4, -2, -6, -2, 0, -1, -2, -3, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -3, -2, 0, -1, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 1, 1, 1, 1, 1, -2, -2, -2, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -2,
+    1, 2, -2, -1, 0, 0, 0, -1, 0, 1, -1, 0, 1, 1, -1, 1, -1, -1, -1, 0, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -3, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 2, 1, 3, 2, 1, -2, -2, -2, 2, 3, 1, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 2, -3, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, -3, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 1, -3, -2, 0, 0, -2, -1, -1, -2, -2, -2, -2, -2, -1, -2, -2, 0, -1, -2, -2, -2, 2, 1, 4, 3, 1, -2, -2, -2, 2, 4, 1, 0, -2, 1, 1, 0, 1, 1, -1,
+    1, 0, -3, -2, -2, 0, 0, -4, 0, 0, -2, 0, 1, -1, -4, 1, -2, -3, -2, -1, 0, -1, -2, -5, -2, -2, -2, -5, -2, -2, -2, -2, -2, -2, -2, -5, -2, -5, -2, -3, -6, -4, -6, -5, -2, -6, -2, 1, -1, -4, -4, -4, -4, -4, -3, -4, -2, -2, -4, -2, -2, -2, -2, -4, -2, -2, -3, -4, -4, -5, -4, -2, -5, -2, 0, 0, -5, -4, 0, -1, -2, -1, -1, -5, -2, -2, -2, -5, -2, -4, -4, 0, 0, -4, -4, -4, 1, 1, 1, 1, -1, -4, -4, -4, 1, 1, 1, 0, -4, -1, 0, 0, 0, 0, -2,
+    0, 0, -2, -1, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, -3, 0, -1, -2, -1, 0, -4, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -3, -2, -4, -2, -2, -4, -3, -4, -4, -2, -4, -2, 0, 0, -2, -3, -2, -3, -2, -3, -2, -2, -2, -4, -2, -2, -2, -2, -3, -2, -2, -2, -4, -3, -4, -4, -2, -4, -2, 0, 0, -5, -2, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -2, -2, -2, 1, 1, 2, 1, 1, -3, -3, -3, 1, 2, 1, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 1, -1, 1, 0, -3, 0, 0, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -6, -2, -5, -4, -2, -6, -2, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -3, -2, 0, -1, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 1, 1, 1, 1, 1, -2, -2, -2, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -2,
+    1, 1, -2, 0, -1, 0, 0, -1, 0, 1, -1, 0, 1, 1, -1, 1, -1, -3, 0, 0, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -6, -2, -5, -4, -2, -6, -2, 0, -1, -2, -3, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -3, -2, -4, -2, 0, -1, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 1, 1, 1, 1, 1, -2, -2, -2, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 1, -4, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, -4, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -6, -2, -4, -4, -4, -6, -2, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -3, -3, -4, -3, -3, 1, -1, -4, -2, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 1, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 1, -3, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -4, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -6, -2, -5, -4, -4, -6, -2, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -3, -3, -4, -3, -2, 1, -1, -4, -2, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 1, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    1, 0, -4, -2, -2, 0, 0, -2, 1, 1, -2, 0, 1, -1, -3, 1, -2, -3, -2, 0, -4, -1, -2, -4, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -4, -2, -4, -2, -4, -6, -4, -5, -5, -2, -6, -2, 0, 0, -3, -4, -4, -4, -4, -3, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -3, -4, -4, -4, -4, -2, -3, -2, 0, 0, -5, -4, 0, -3, -2, -1, -1, -4, -2, -2, -2, -4, -1, -4, -4, 0, 0, -3, -3, -3, 1, 1, 1, 1, -1, -4, -3, -4, 1, 1, 2, 0, -4, 0, 0, 1, 0, 0, -2,
+    -1, 2, -4, -1, 0, 0, 0, 0, -3, -2, 0, -1, -1, -2, -2, 0, 0, -5, -1, 0, -5, -3, -2, -2, -2, -2, -2, -2, -2, -2, -6, -3, -2, -2, -2, -2, -2, -2, -2, -4, -7, -2, -4, -3, -5, -4, -5, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -3, -2, -2, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 0, -4, -2, -2, -2, -5, -3, -4, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 2, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 1, -1, 0, 1, -1,
+    1, 1, -3, 0, -1, 1, 0, -2, 0, 1, -1, 0, -1, -1, -1, -1, 0, -4, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -3, -2, -3, -6, -2, -5, -4, -3, -6, -2, 0, -1, -2, -2, -2, -2, -2, -3, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -3, -4, -2, -3, -3, -3, -3, -2, 1, 0, -4, -2, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 1, 1, 1, 2, 1, -2, -2, -2, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 2, -2, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -3, 0, 0, -3, -1, 0, -5, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -4, -3, -2, -5, -2, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 2, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    1, 2, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, -1, 1, 0, -3, 0, 0, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -6, -2, -4, -3, -2, -4, -2, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 1, 1, 1, 2, 1, -2, -2, -2, 1, 1, 1, 0, -2, 0, 0, 0, 0, 0, -1,
+    -1, 2, -4, -1, 0, 0, 0, 0, -4, -2, -1, -1, 0, -3, -3, -1, -1, -6, -1, 0, 0, -4, -2, -2, -2, -2, -2, -2, -2, -2, -6, -3, -2, -2, -3, -2, -2, -2, -2, -3, -7, -2, -3, -3, -5, -4, -5, 0, 0, -4, -2, -3, -4, -4, -2, -3, -2, -2, -5, -2, -2, -3, -2, -3, -3, -3, -4, -3, -2, -2, -2, -3, -2, -3, 0, 0, -4, -3, -1, -2, -5, -4, -4, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -4, -4, -4, 0, 0, 0, 3, -1, -3, -3, -2, 0, 0, 0, -1, -3, 0, 0, -2, 0, 0, -1,
+    -1, 2, -4, -1, 0, 0, 0, 0, -2, -1, -1, -1, 0, -2, -2, -1, -1, -6, -1, 0, 0, -3, -2, -2, -2, -2, -2, -2, -2, -2, -5, -3, -2, -2, -3, -2, -2, -2, -2, -3, -7, -2, -3, -3, -4, -4, -4, 0, -1, -3, -2, -3, -3, -3, -2, -3, -2, -2, -5, -2, -2, -3, -2, -3, -3, -3, -4, -2, -2, -2, -2, -3, -2, -3, 0, 0, -4, -3, -1, -2, -4, -3, -3, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -3, -3, -3, 0, 0, 0, 3, 0, -3, -3, -2, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -1,
+    0, 1, -3, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -3, 0, -1, -3, -1, 0, -4, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -2, -3, -6, -3, -4, -4, -2, -5, -2, 0, -1, -3, -3, -4, -4, -4, -2, -4, -2, -2, -4, -2, -2, -2, -2, -4, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, 0, -1, -5, -4, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, 0, 0, 0, 2, -1, -4, -4, -2, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -1,
+    -1, 2, -4, -1, 0, 0, 0, -1, -2, -1, -1, -1, 0, -3, -2, -1, -1, -6, -1, 0, 0, -4, -2, -2, -2, -2, -2, -2, -2, -2, -5, -3, -2, -2, -3, -2, -2, -2, -2, -3, -7, -2, -4, -3, -5, -4, -4, 0, -1, -3, -2, -3, -3, -3, -2, -3, -2, -2, -5, -2, -2, -3, -2, -3, -3, -3, -4, -2, -2, -2, -2, -3, -2, -3, 0, 0, -4, -3, -1, -2, -5, -4, -4, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -3, -3, -3, 0, 0, 0, 3, 0, -3, -3, -2, 0, 0, 0, -1, -3, 0, 0, -1, 0, 0, -1,
+    1, 2, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -3, 1, 0, -3, -1, 0, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -6, -2, -4, -3, -2, -4, -2, 0, -1, -3, -2, -3, -3, -3, -2, -3, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -4, -3, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -3, -3, -3, 1, 1, 1, 2, 0, -2, -2, -2, 1, 1, 1, 0, -2, 0, 1, 0, 0, 0, -1,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 0, 1, 0, 0, 0, -1, 1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, -4, -2, 0, 0, 0, -2, 0, 0, -2, -2, -2, -2, -3, -2, -2, -2, -2, -3, -4, -3, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, -4, -4, -4, -4, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -5, -4, -4, -4, -4, -4, -4, -4, -4, -4, 0, 0, -5, -4, -2, -1, -4, -3, -3, -4, -4, -4, -4, -4, -4, -4, -4, 0, -2, -4, -4, -4, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -2, -4, 0, 0, 0, 0, 0, -3,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -3, 0, -1, -3, -1, -1, -4, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -4, -3, -4, -4, -2, -5, -2, 0, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -4, -2, -2, -2, -2, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -4, -3, 0, -1, -3, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -1, -1, -1, -2, -2, 0, -2, 0, 0, 0, -2, -1, -2, -2, -2, -1, -2, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, -1, -3, -2, -3, -2, 0, -3, 0, 0, 0, -2, -2, 1, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, -1, -1, 0, 1, -1, -2, -2, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -4, -1, 0, -2, 0, 0, -1, -2, 0, 0, -2, -1, -1, 0, -1, -2, -1, -2, -1, -2, 0, 0, 0, 0, -1, -1, -2, 0, 0, -2, 0, -2, -2, -2, -2, -2, -1, 0, -2, -1, 0, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, 0, 0, -1, -2, 0, 1, -2, -1, -1, -2, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    -3, 0, -6, -3, 0, 0, 0, -2, 0, 0, -3, -3, -3, -4, -4, -3, -3, -7, -3, -3, -8, -4, -5, -5, -5, -5, -5, -5, -5, -5, -6, -5, -5, -5, -5, -5, -5, -5, -5, -6, -9, -5, -6, -6, -6, -7, -5, 0, 0, -5, -5, -5, -5, -5, -4, -4, -5, -5, -7, -5, -5, -5, -5, -4, -6, -5, -6, -4, -4, -4, -4, -6, -4, -6, 0, 0, -7, -5, -3, -4, -2, -4, -5, -5, -5, -5, -5, -5, -5, -5, -5, 0, -3, -5, -5, -5, 0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, -3, -4, 0, 0, 0, 0, 0, -4,
+    0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -3, 0, -1, -2, -1, -1, -1, -3, -1, -1, -1, -1, -1, -1, -1, -2, -1, -3, -1, -1, -5, -2, -5, -4, -1, -5, -1, 0, 0, -2, -2, -2, -2, -2, -2, -2, -1, -1, -3, -1, -1, -1, -1, -2, -1, -1, -1, -3, -2, -4, -3, -1, -4, -1, 0, 0, -4, -2, 0, 0, -1, 0, 0, -2, -1, -1, -1, -2, -1, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, -1, -1, -1, -2, -1, -1, -4, -1, -1, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -2, -1, -1, -1, -3, -1, -1, -1, -1, -2, -1, -1, -1, -3, -2, -3, -3, -1, -3, -1, 0, 0, -2, -1, 0, 0, -1, 0, 0, -2, -1, -1, -1, -2, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -2, -2, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -4, -1, -2, -3, -2, -2, -2, -3, -2, -2, -3, -2, -2, -2, -2, -3, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, -2, -2, -3, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -4, -3, -4, -4, -2, -5, -2, 0, 0, -3, -2, -1, 0, -2, -1, -1, -3, -2, -2, -2, -3, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -2, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -4, -2, 0, 0, -2, -1, -1, -2, -2, -2, 0, -2, -2, -3, -3, 0, 0, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -4, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -4, -2, 0, 0, -2, -1, -1, -2, 0, -2, 0, -2, -2, -3, -3, 0, 0, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -2, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -4, -2, 0, 0, -2, -1, -1, -2, 1, 0, 1, -2, -2, -2, -3, 0, 0, -2, -2, -2, 0, 0, 0, 0, 1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 0, -4, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -5, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -3, -2, -2, -3, -2, -2, -2, -2, -4, -3, -2, -4, -3, -4, -4, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -3, -2, -2, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 0, -4, -2, 0, -1, -5, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1,
+    4, 0, 0, 3, 0, 0, 0, 4, 0, 0, 4, 3, 3, 3, 3, 3, 4, 3, 3, 4, 2, 1, 2, 2, 2, 2, 1, 2, 2, 1, 0, 1, 1, 2, 1, 2, 1, 2, 1, 0, 1, 2, 1, 1, 0, 1, 1, 0, 0, 2, 1, 2, 2, 2, 2, 2, 1, 2, 0, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 2, 2, 0, 2, 1, 0, 0, 1, 2, 4, 2, 0, 1, 1, 2, 1, 1, 1, 2, 2, 2, 2, 0, 3, 2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, 3,
+    0, 0, -4, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -3, -2, -2, -2, -2, -2, -3, -2, -2, -2, -4, -3, -3, -3, -3, -2, -3, -2, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 0, -2, -2, -2, -2, -2, -2, -2, -3, -2, -5, -3, -2, -3, -3, -2, -3, -3, -3, -2, -2, -2, -2, -3, -2, -3, 0, 0, -3, -2, 0, 0, -4, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, 0, -1, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1,
+    0, 2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, -1, 0, 0, 0, -1, -1, 0, -1, -1, -6, -1, -1, -1, -1, 0, -1, 0, -1, -3, -5, -1, -3, -2, -4, -4, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -3, -1, 0, -1, -1, 0, -1, -1, -2, 0, 0, -1, -1, -3, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    1, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -1, 0, 0, -1, -1, 0, -1, 0, -1, -2, -1, -3, -2, -1, -3, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, 0, 0, -3, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -3, -1, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -2, -3, -2, -2, -2, -3, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -3, -2, -3, -2, 0, 0, -4, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -3, -3, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -3, -1, 0, -4, -1, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -5, -3, -4, -4, -2, -5, -2, 0, 0, -2, -3, -2, -2, -2, -3, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -3, -2, -3, -2, 0, 0, -5, -2, 0, -1, -2, -1, -1, -2, -2, -2, -2, -2, -2, -3, -3, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -1, -5, -1, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -6, -2, -5, -4, -2, -6, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -4, -3, -2, -4, -2, 0, 0, -4, -2, 0, -1, -3, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -4, 0, -1, -3, -1, -1, -4, -1, -2, -3, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -6, -3, -4, -4, -2, -5, -2, 0, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -3, -2, -2, -2, -2, -3, -3, -2, -2, -3, -3, -3, -3, -2, -3, -2, 0, 0, -4, -3, 0, -1, -2, -1, -1, -3, -2, -2, -2, -3, -2, -3, -3, 0, 0, -3, -3, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 1, 2, 0, 1, 1, 1, 0, 1, 0, 1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 2, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 3, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 3, 3, 2, 2, 2, 2, 1, 0, 0, 0, 3, 0, 0, 0, 2, 0, 2, 3, 1, 2, 3, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 2, 1, 1, 2, 2, 2, 1, 2, 2, 1, 1, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 2, 1, 1, 1, 2, 1, 2, 2, 0, 2, 2, 2, 2, 1, 2, 2, 1, 2, 2, 3, 3, 2, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, -2, -1, 1, 1, 2, 1, 1, 1, 1, 1, -4, 1, 1, 1, 1, 1, 1, 1, 1, 0, -2, 1, 0, 1, -1, 0, -2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 1, 1, 2, 3, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 1, -1, 1, 1, 0,
+    0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -3, -2, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -3, -3, -4, -3, -3, 0, 0, -3, -2, 0, 0, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -2, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -4, -3, -4, -4, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -5, -2, -2, -2, -2, -2, -3, -2, -3, -2, -2, -3, -3, -4, -3, -3, 0, 0, -4, -2, 0, -1, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -3, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -3, -2, 0, 0, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 1, 2, 0, 1, 1, 0, 0, 1, 0, 1, 0, 1, 1, 2, 1, 1, 2, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 2, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 2, 2, 0, 2, 3, 2, 2, 2, 2, 2, 0, 2, 0, 2, 1, 3, 3, 3, 2, 2, 3, 2, 0, 0, 0, 3, 0, 0, 0, 1, 0, 2, 3, 0, 2, 2, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -4, -1, -2, -2, 0, -3, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    4, 0, 1, 2, 0, 0, 0, 1, 0, 0, 2, 3, 3, 3, 2, 3, 2, 2, 2, 3, 0, 2, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 3, 3, 1, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1,
+    2, 0, 0, 2, 0, 0, 0, 1, 0, 0, 2, 2, 2, 2, 1, 2, 2, 0, 2, 1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 1, 1, -1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, 1, 0, 1, 1, 1, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 1, 1, 2, 1, 1, 1, 1, 0, 1, 0, 1, 1, -1, 0, -1, 0, 1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 1, 1, -1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, 1, 0, 1, 1, 1, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -1, -2, -1, -1, -1, -2, -1, -1, -2, -1, -1, -1, -1, -2, -1, -2, -1, -1, -2, -2, -2, -2, -1, -2, -1, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -3, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -2, -1, -1, -1, -1, 0, 0, -3, -1, 0, 0, -1, 0, 0, -2, -1, -1, -1, -2, -1, -2, -2, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, -1, 1, 0, 0, 0, 1, -2, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, -2, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair opendyslexic_8_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_8_bolditalic = {
     opendyslexic_8_bolditalicBitmaps,
     opendyslexic_8_bolditalicGlyphs,
     opendyslexic_8_bolditalicIntervals,
-    52,
+    53,
     30,
     22,
     -9,
     true,
+    opendyslexic_8_bolditalicKernLeftClasses,
+    128,
+    opendyslexic_8_bolditalicKernRightClasses,
+    124,
+    opendyslexic_8_bolditalicKernMatrix,
+    118,
+    115,
+    opendyslexic_8_bolditalicLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_italicBitmaps[29759] = {
+static const uint8_t opendyslexic_8_italicBitmaps[30037] = {
     0x00, 0x01, 0x00, 0x01, 0xC0, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x1D, 0x00, 0x0B, 0x00, 0x03, 0xC0,
     0x01, 0xD0, 0x00, 0xB0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x00, 0x40, 0x01, 0x40, 0x00,
     0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x14, 0x15, 0x0F, 0x4F, 0xC3, 0xE2, 0xF0, 0xF8, 0x7C,
@@ -1867,7 +1867,25 @@ static const uint8_t opendyslexic_8_italicBitmaps[29759] = {
     0xFF, 0x00, 0x00, 0x00, 0x19, 0x00, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0x50, 0x00, 0x01, 0x6A,
     0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00,
     0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xBF, 0xD0, 0x1B, 0xFF, 0x90, 0x0F, 0xF9, 0x00,
-    0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x5A, 0xFF, 0xE0, 0xBE, 0x95, 0x00, 0x00,
+    0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x5A, 0xFF, 0xE0, 0xBE, 0x95, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x0B, 0x00, 0xB0, 0x00, 0x34, 0x03, 0x40, 0x01, 0xC0,
+    0x1C, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0xBE, 0xAB, 0xE8, 0x00, 0xE0, 0x0E, 0x00, 0x0B, 0x40, 0x74,
+    0x00, 0x3C, 0x02, 0xC0, 0x00, 0xF0, 0x0F, 0x00, 0x07, 0x80, 0x78, 0x00, 0x2D, 0x02, 0xD0, 0x00,
+    0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x02, 0xE0, 0x03, 0xFF, 0x40, 0x2C, 0x00, 0x00,
+    0xD0, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xFC, 0x01, 0xF5, 0xE0, 0x03, 0x83, 0x40, 0x2D, 0x1C, 0x00,
+    0xF0, 0xB0, 0x03, 0xC3, 0x80, 0x1E, 0x1D, 0x00, 0xB4, 0xB4, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x03, 0xF4, 0x3C, 0x00, 0xB0, 0x03, 0x80, 0x0D, 0x00, 0xB0, 0x01, 0xC0, 0x0F, 0x00,
+    0xFF, 0xD0, 0xD0, 0x07, 0xD4, 0x2C, 0x00, 0x38, 0x03, 0xC0, 0x0B, 0x40, 0x38, 0x00, 0xF0, 0x0B,
+    0x40, 0x0F, 0x00, 0xF0, 0x01, 0xE0, 0x0E, 0x00, 0x3D, 0x01, 0xFD, 0x03, 0xC0, 0x2F, 0xD0, 0x00,
+    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF4, 0x3F, 0xF8, 0x02, 0xC0, 0x2C, 0x00,
+    0x00, 0xD0, 0x0D, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xAA, 0xFA,
+    0xB0, 0x03, 0x80, 0x38, 0x34, 0x02, 0xD0, 0x1D, 0x0C, 0x00, 0xF0, 0x0B, 0x0B, 0x00, 0x3C, 0x03,
+    0xC3, 0x80, 0x1E, 0x01, 0xE0, 0xE0, 0x0B, 0x40, 0xB4, 0xB4, 0x03, 0xC0, 0x3C, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x3F, 0x43, 0xF4, 0x2C, 0x00, 0xB0, 0x0B, 0x00, 0x38, 0x00, 0xD0,
+    0x0D, 0x00, 0x74, 0x01, 0xC0, 0x1C, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0xE0, 0x0B, 0xEA, 0xBE,
+    0x81, 0xC0, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x0B, 0x40, 0x74, 0x03, 0x80, 0x0F, 0x00, 0xB0, 0x07,
+    0x40, 0x0F, 0x00, 0xF0, 0x0B, 0x00, 0x1E, 0x01, 0xE0, 0x0F, 0x00, 0x2D, 0x02, 0xD0, 0x0F, 0xD0,
+    0x3C, 0x03, 0xC0, 0x1F, 0xD0,
 };
 
 static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
@@ -2576,6 +2594,11 @@ static const EpdGlyph opendyslexic_8_italicGlyphs[] = {
     { 14, 15, 18, 4, 13, 53, 29611 }, // ≠
     { 15, 13, 14, -1, 12, 49, 29664 }, // ≤
     { 14, 13, 14, 1, 12, 46, 29713 }, // ≥
+    { 15, 14, 17, 1, 14, 53, 29759 }, // ﬀ
+    { 11, 15, 15, 1, 15, 42, 29812 }, // ﬁ
+    { 14, 14, 17, 1, 14, 49, 29854 }, // ﬂ
+    { 17, 15, 21, 1, 15, 64, 29903 }, // ﬃ
+    { 20, 14, 23, 1, 14, 70, 29967 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_8_italicIntervals[] = {
@@ -2631,15 +2654,340 @@ static const EpdUnicodeInterval opendyslexic_8_italicIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_8_italicKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x27, 2 }, // '
+    { 0x28, 3 }, // (
+    { 0x29, 4 }, // )
+    { 0x2A, 5 }, // *
+    { 0x2C, 6 }, // ,
+    { 0x2D, 7 }, // -
+    { 0x2E, 8 }, // .
+    { 0x30, 9 }, // 0
+    { 0x31, 10 }, // 1
+    { 0x32, 11 }, // 2
+    { 0x33, 12 }, // 3
+    { 0x34, 13 }, // 4
+    { 0x35, 14 }, // 5
+    { 0x36, 15 }, // 6
+    { 0x37, 16 }, // 7
+    { 0x38, 17 }, // 8
+    { 0x39, 18 }, // 9
+    { 0x3A, 19 }, // :
+    { 0x3F, 20 }, // ?
+    { 0x41, 21 }, // A
+    { 0x42, 22 }, // B
+    { 0x43, 23 }, // C
+    { 0x44, 24 }, // D
+    { 0x45, 25 }, // E
+    { 0x46, 26 }, // F
+    { 0x47, 27 }, // G
+    { 0x48, 28 }, // H
+    { 0x49, 29 }, // I
+    { 0x4A, 30 }, // J
+    { 0x4B, 31 }, // K
+    { 0x4C, 32 }, // L
+    { 0x4D, 33 }, // M
+    { 0x4E, 34 }, // N
+    { 0x4F, 35 }, // O
+    { 0x50, 36 }, // P
+    { 0x51, 37 }, // Q
+    { 0x52, 38 }, // R
+    { 0x53, 39 }, // S
+    { 0x54, 40 }, // T
+    { 0x55, 41 }, // U
+    { 0x56, 42 }, // V
+    { 0x57, 43 }, // W
+    { 0x58, 44 }, // X
+    { 0x59, 45 }, // Y
+    { 0x5A, 46 }, // Z
+    { 0x5B, 47 }, // [
+    { 0x5D, 48 }, // ]
+    { 0x5E, 49 }, // ^
+    { 0x61, 50 }, // a
+    { 0x62, 51 }, // b
+    { 0x63, 52 }, // c
+    { 0x64, 53 }, // d
+    { 0x65, 54 }, // e
+    { 0x66, 55 }, // f
+    { 0x67, 56 }, // g
+    { 0x68, 57 }, // h
+    { 0x69, 58 }, // i
+    { 0x6A, 59 }, // j
+    { 0x6B, 60 }, // k
+    { 0x6C, 61 }, // l
+    { 0x6D, 62 }, // m
+    { 0x6E, 57 }, // n
+    { 0x6F, 63 }, // o
+    { 0x70, 64 }, // p
+    { 0x71, 65 }, // q
+    { 0x72, 66 }, // r
+    { 0x73, 67 }, // s
+    { 0x74, 68 }, // t
+    { 0x75, 69 }, // u
+    { 0x76, 70 }, // v
+    { 0x77, 71 }, // w
+    { 0x78, 72 }, // x
+    { 0x79, 73 }, // y
+    { 0x7A, 74 }, // z
+    { 0x7B, 75 }, // {
+    { 0x7D, 76 }, // }
+    { 0xC6, 77 }, // Æ
+    { 0xC7, 78 }, // Ç
+    { 0xCC, 79 }, // Ì
+    { 0xCD, 79 }, // Í
+    { 0xCE, 80 }, // Î
+    { 0xCF, 79 }, // Ï
+    { 0xD8, 81 }, // Ø
+    { 0xDE, 82 }, // Þ
+    { 0xDF, 83 }, // ß
+    { 0xEC, 84 }, // ì
+    { 0xED, 85 }, // í
+    { 0xEE, 86 }, // î
+    { 0xEF, 87 }, // ï
+    { 0xF0, 88 }, // ð
+    { 0xFE, 89 }, // þ
+    { 0x104, 90 }, // Ą
+    { 0x128, 79 }, // Ĩ
+    { 0x129, 91 }, // ĩ
+    { 0x12A, 79 }, // Ī
+    { 0x12B, 92 }, // ī
+    { 0x12E, 93 }, // Į
+    { 0x12F, 94 }, // į
+    { 0x130, 79 }, // İ
+    { 0x152, 95 }, // Œ
+    { 0x201C, 96 }, // “
+    { 0x201D, 97 }, // ”
+    { 0x201E, 98 }, // „
+};
+
+static const EpdKernClassEntry opendyslexic_8_italicKernRightClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 2 }, // "
+    { 0x27, 3 }, // '
+    { 0x28, 4 }, // (
+    { 0x29, 5 }, // )
+    { 0x2A, 6 }, // *
+    { 0x2C, 7 }, // ,
+    { 0x2D, 8 }, // -
+    { 0x2E, 9 }, // .
+    { 0x30, 10 }, // 0
+    { 0x31, 11 }, // 1
+    { 0x32, 12 }, // 2
+    { 0x33, 13 }, // 3
+    { 0x34, 14 }, // 4
+    { 0x35, 15 }, // 5
+    { 0x36, 16 }, // 6
+    { 0x37, 17 }, // 7
+    { 0x38, 18 }, // 8
+    { 0x39, 19 }, // 9
+    { 0x3A, 20 }, // :
+    { 0x3F, 21 }, // ?
+    { 0x41, 22 }, // A
+    { 0x42, 23 }, // B
+    { 0x43, 24 }, // C
+    { 0x44, 25 }, // D
+    { 0x45, 26 }, // E
+    { 0x46, 27 }, // F
+    { 0x47, 28 }, // G
+    { 0x48, 29 }, // H
+    { 0x49, 30 }, // I
+    { 0x4A, 31 }, // J
+    { 0x4B, 32 }, // K
+    { 0x4C, 33 }, // L
+    { 0x4D, 34 }, // M
+    { 0x4E, 35 }, // N
+    { 0x4F, 36 }, // O
+    { 0x50, 37 }, // P
+    { 0x51, 38 }, // Q
+    { 0x52, 37 }, // R
+    { 0x53, 39 }, // S
+    { 0x54, 40 }, // T
+    { 0x55, 41 }, // U
+    { 0x56, 42 }, // V
+    { 0x57, 43 }, // W
+    { 0x58, 44 }, // X
+    { 0x59, 45 }, // Y
+    { 0x5A, 46 }, // Z
+    { 0x5B, 47 }, // [
+    { 0x5D, 48 }, // ]
+    { 0x5E, 49 }, // ^
+    { 0x61, 50 }, // a
+    { 0x62, 51 }, // b
+    { 0x63, 52 }, // c
+    { 0x64, 53 }, // d
+    { 0x65, 54 }, // e
+    { 0x66, 55 }, // f
+    { 0x67, 56 }, // g
+    { 0x68, 57 }, // h
+    { 0x69, 58 }, // i
+    { 0x6A, 59 }, // j
+    { 0x6B, 60 }, // k
+    { 0x6C, 61 }, // l
+    { 0x6D, 62 }, // m
+    { 0x6E, 63 }, // n
+    { 0x6F, 54 }, // o
+    { 0x70, 64 }, // p
+    { 0x71, 65 }, // q
+    { 0x72, 66 }, // r
+    { 0x73, 67 }, // s
+    { 0x74, 68 }, // t
+    { 0x75, 69 }, // u
+    { 0x76, 70 }, // v
+    { 0x77, 71 }, // w
+    { 0x78, 72 }, // x
+    { 0x79, 73 }, // y
+    { 0x7A, 74 }, // z
+    { 0x7B, 75 }, // {
+    { 0x7D, 76 }, // }
+    { 0xC6, 77 }, // Æ
+    { 0xC7, 78 }, // Ç
+    { 0xD8, 79 }, // Ø
+    { 0xDE, 80 }, // Þ
+    { 0xDF, 81 }, // ß
+    { 0xEC, 82 }, // ì
+    { 0xED, 83 }, // í
+    { 0xEE, 84 }, // î
+    { 0xEF, 85 }, // ï
+    { 0xF0, 86 }, // ð
+    { 0x129, 87 }, // ĩ
+    { 0x12B, 88 }, // ī
+    { 0x12F, 89 }, // į
+    { 0x152, 90 }, // Œ
+    { 0x201C, 91 }, // “
+    { 0x201D, 92 }, // ”
+    { 0x201E, 93 }, // „
+};
+
+static const int8_t opendyslexic_8_italicKernMatrix[9114] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -1, -3, -1, -2, 0, -2, -2, 0, 0, -2, 0, -2, 0, 0, -1, -2, 0, 0, -1, -1, -1, 0, -1, -2, -1, -2, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -2, 0, -2, -2, -2, -2, -1, 0, 0, 0, 0, 0, -2, -2, -1, -2, -2, -2, -2, -2, -2, -2, -2, -1, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, -2, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -2, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0,
+    0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 1, 0, 0, 0, 0, 0, 2, 0, 2, 2, 1, 1, 2, 1, 0, 1, 1, 2, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, -3, -3, -5, -3, -3, -3, -5, -3, -2, -6, -3, -3, -3, -3, -5, -3, -3, -3, -7, -4, -8, -6, -3, -7, -3, 0, -3, 0, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, 0, -2, -2, -3, -2, -2, -4, -3, -5, -4, -2, -5, -2, 0, -2, -3, -5, -3, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -5, -3, -2, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -4, -3, -3, -3, -3, -3, -3, -3, -2, -7, -3, -3, -3, -3, -3, -3, -2, -4, -4, -3, -5, -5, -5, -6, -3, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, -2, -4, -3, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, -2, -6, -3, -3, -3, -3, -4, -3, -2, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -3, -1, 0, -3, 0, 0, 0, -3, -3, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -5, -3, -3, -3, -3, -3, -3, -3, -2, -7, -4, -3, -3, -4, -3, -3, -2, -5, -5, -3, -5, -5, -6, -6, -4, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 1, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, -2, -6, -3, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, -3, -3, -4, -3, -3, -3, -4, -3, -2, -6, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -2, 0, 0, 0, -3, -4, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -1, 0,
+    -1, 0, 0, 0, 0, 0, -6, 0, -5, 0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -7, -3, -4, -3, -4, -4, -4, -3, -2, -7, -4, -4, -4, -4, -4, -4, -2, -5, -3, -3, -3, -3, -4, -3, -4, 0, 0, 0, -3, -2, -3, -3, -3, -2, -3, -2, -3, -2, -2, -2, -1, -3, -4, -3, -3, -3, -2, -2, -2, -2, -4, -2, -4, 0, 0, -8, -4, -4, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, -4, 0, 0, -5,
+    -1, 0, 0, 0, -2, 0, -2, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -4, -3, -3, -3, -3, -3, -3, -3, -2, -7, -3, -3, -3, -3, -3, -3, -2, -4, -5, -3, -5, -5, -5, -5, -4, 0, -1, 0, -2, -2, -2, -2, -2, -3, -2, -2, -2, -2, -2, -2, 0, -2, -3, -2, -2, -3, -4, -2, -3, -2, -3, -3, -3, 0, -1, -5, -3, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, -2, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, -2, -6, -3, -3, -3, -3, -3, -3, -2, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -1, -5, -2, -2, -2, -2, -2, -2, -1, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -3, -4, -3, -4, -4, -3, -3, -2, -4, -4, -4, -4, -4, -3, -4, -2, -4, -3, -3, -3, -3, -4, -3, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, -4, 0, -2, -1, -1, 0, 0, 0, -3, -3, -6, -3, -3, -3, -6, -3, -2, -6, -3, -3, -3, -3, -6, -3, -4, -4, -5, -5, -5, -5, -3, -5, -3, 0, -1, 0, -1, -1, -2, -1, -2, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1, -3, -2, 0, -3, 0, 0, -1, -3, -6, -3, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -6, -1, -2, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, -2, 0, 0, 0, 0, -3, -3, -4, -3, -3, -3, -4, -3, -2, -6, -3, -3, -3, -3, -4, -3, -2, -3, -7, -4, -7, -5, -3, -7, -3, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -3, 0, 0, -2, -3, -4, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -5, -6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -4, -3, -3, -3, -4, -3, -2, -6, -3, -3, -3, -3, -4, -3, -2, -3, -4, -4, -4, -4, -3, -4, -3, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 1, 1, -2, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, -3, -4, -3, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -3, -4, -3, -4, -4, -3, -3, -2, -7, -4, -4, -4, -4, -3, -4, -2, -4, -3, -3, -3, -3, -4, -3, -4, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, -2, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0, -4, -4, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -5, -3, -3, -3, -3, -3, -3, -3, -2, -7, -4, -3, -3, -4, -3, -3, -2, -4, -4, -3, -5, -4, -6, -5, -4, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, -1, 0, -1, 0, -2, -5, -3, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1,
+    0, 2, 0, 0, -1, 0, -4, -4, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -7, -3, -4, -3, -3, -4, -3, -3, -2, -7, -4, -4, -4, -4, -3, -4, -2, -4, -3, -3, -4, -4, -5, -4, -6, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, -9, -4, -3, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, -6,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -2, 0, 0, 0, 0, -4, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -2, -3, -3, -2, -3, -1, -4, -4, -2, -4, -4, -4, -4, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, -2, 0, -1, 0, 0, -4, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0,
+    0, 1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -3, -3, -4, -3, -3, -3, -4, -3, -2, -6, -3, -3, -3, -3, -4, -3, -3, -3, -5, -4, -5, -5, -3, -6, -3, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -2, -3, -4, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -1, -1, 0,
+    0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -4, -3, -3, -3, -3, -3, -3, -3, -2, -7, -3, -3, -3, -3, -3, -3, -2, -4, -5, -3, -5, -5, -5, -5, -3, 0, -2, 0, 1, 1, 1, 1, 1, -1, 1, 1, 1, -2, 1, 1, 0, 1, 0, 1, 0, 0, -1, 1, -1, -1, -1, -2, 0, 0, -1, -5, -3, -3, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, -3, -1, -2, 0,
+    -1, 2, 0, 0, 0, -2, -5, -2, -4, -1, -2, 0, 0, -4, 0, -1, 0, 0, -1, -2, -2, -8, -3, -6, -3, -3, -4, -4, -3, -2, -7, -4, -4, -4, -4, -4, -4, -3, -5, -3, -3, -3, -3, -4, -3, -4, 0, 0, -2, -6, -2, -6, -6, -6, -3, -6, -2, -2, -2, -2, -2, -3, -6, -7, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, 0, 0, -8, -6, -4, 1, 0, 0, 0, 0, -1, -4, 0, 1, 0, -4, 0, 0, -4,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -5, -3, -3, -3, -4, -4, -3, -3, -2, -7, -4, -4, -4, -4, -3, -4, -2, -4, -3, -3, -3, -3, -4, -3, -4, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -5, -3, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, -1, 0, -1, 0, 0, -1, -8, -3, -5, -3, -4, -4, -4, -3, -2, -7, -4, -4, -4, -4, -5, -4, -3, -5, -3, -3, -3, -3, -4, -3, -4, 0, 0, 0, -2, 1, -2, -2, -2, 0, -1, 0, 0, -2, 0, 0, -1, -1, -2, -2, -1, -2, 0, 0, 0, 0, -2, -1, -2, 0, 0, -8, -5, -5, 1, -1, 0, 0, 0, 0, -2, 0, 0, 0, -5, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, -7, -3, -5, -3, -4, -4, -4, -3, -2, -7, -4, -4, -4, -4, -4, -4, -3, -5, -3, -3, -3, -3, -4, -3, -4, 0, 0, 0, -2, 1, -1, -1, -1, 0, -1, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -2, 0, -2, 0, 0, -7, -5, -4, 1, -1, 0, 0, 0, 0, -1, 0, 1, 0, -4, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, -3, -3, -5, -3, -3, -3, -6, -3, -2, -6, -3, -3, -3, -3, -6, -3, -4, -4, -4, -4, -4, -4, -3, -4, -3, 0, 0, 0, -1, 1, -1, -1, -1, -1, -1, 1, 1, -2, 1, 1, 1, 1, 0, -1, 1, 0, -1, -1, -2, -2, 0, -2, 1, 0, 0, -3, -5, -3, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0, -6, 0, -1, 0,
+    0, 1, 0, -1, 0, 0, -2, -2, -2, -1, -1, 0, 0, -4, 0, -2, 0, -1, -1, 0, -2, -8, -3, -6, -3, -4, -4, -5, -3, -2, -7, -4, -4, -4, -4, -5, -4, -4, -6, -3, -3, -3, -3, -4, -3, -4, 0, 0, -2, -3, 1, -2, -2, -2, -1, -2, 0, 0, -2, 0, 0, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -2, -1, -2, 0, 0, -8, -6, -5, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, -5, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -3, -3, -4, -3, -3, -3, -4, -3, -2, -6, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0, 1, -1, -1, -1, -1, -1, 1, 1, -2, 1, 1, 1, 1, 0, -1, 1, 0, -1, -1, -1, -1, 0, -1, 1, 0, -1, -3, -4, -3, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -1, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, -3, -2, -2, -1, -1, 0, 0, 0, 0, 0, -3, -3, 0, -2, -3, -3, -1, -2, -2, -2, -3, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, 1, -6, 0, -2, -1, 1, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -1, -1, -2, -2, -2, -2, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, 1, 1, 1, 1, -2, -2, 1, 0, -2, 0, 1, 1, -2, 1, 1, 1, 0, -6, 1, -2, -1, -1, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -2, -2, -2, -1, -2, -2, -3, -3, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
+    0, 1, 0, 0, -1, -1, 0, -4, 0, -1, 0, 0, 0, -4, 0, -1, -2, -1, 0, 0, 0, -2, 0, -1, 0, 0, -2, -3, 0, 0, -2, 0, 0, 1, -2, -1, 0, -1, 1, -6, -1, -2, -1, 0, -2, 0, 0, 0, -1, -2, -2, -3, -3, -3, -2, -3, -1, -1, -2, -1, -1, 0, -1, -2, -3, -1, -1, -2, -2, -2, -2, -1, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, 1, 1, 0, -2, -2, 0, 0, -2, 0, 0, 1, -2, 1, 0, 1, 1, -6, 0, -1, -1, 0, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -2, -2, -2, -1, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 2, 0, 0, 0, 0, -2, 0, -1, 0, -2, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, -2, -2, -2, -1, -2, -2, -1, -2, -1, -1, 0, -2, -2, -2, -2, -2, -1, -1, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -2,
+    0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -6, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, 1, -6, 0, -2, -1, 1, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -1, -1, -2, -2, -2, -2, -1, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, 1, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, -2, 0, -2, 0, 0, 0, -4, 0, -2, -2, -1, 0, 0, 0, -2, 0, -2, 0, 0, -2, -4, 0, 0, -2, 0, 0, 1, -2, -2, 0, -2, 0, -6, -1, -3, -2, 1, -3, 0, 0, 0, -3, -3, -3, -3, -3, -3, -2, -3, -1, -1, -2, -1, -1, 0, -1, -2, -3, -1, -2, -3, -3, -4, -3, -1, -4, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, -2, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -3, 0, 0, -2, 0, 0, 1, -2, -1, 0, 0, 1, -3, 0, -1, -1, 1, -1, 0, 0, 0, -1, -2, -2, -2, -2, -2, -2, -2, -1, -1, -2, -1, -1, 0, -1, -2, -2, -1, -1, -3, -2, -3, -3, -1, -3, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 1, -3, 0, -2, -1, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, 0, 1, 0, 0, -2, -2, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, 0, -6, 0, -1, -1, -1, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -2, -2, -2, -1, -2, -2, -3, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1,
+    0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -6, 0, -1, -1, -1, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -2, -2, -2, -1, -2, -2, -3, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1,
+    -2, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, -2, -2, -2, -1, -1, -5, -1, -1, 0, -2, -4, -1, -1, -1, -2, -4, -4, -1, -1, 0, -2, -2, -1, -4, -1, -2, -1, -2, -8, -1, -2, -2, -2, -3, -2, 0, 0, 0, -3, -3, -3, -3, -3, -3, -2, -3, -3, 0, -3, -3, -2, -4, -2, -3, -4, -4, -3, -3, -3, -3, -4, -2, -4, -1, 0, 0, 0, 0, -1, -2, -1, -1, -1, 0, -2, -1, -1, 0, 0, -2, -1, 0,
+    0, 2, 0, 0, -1, 0, -3, -1, -2, 0, -2, -2, -2, -2, 0, 0, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, -6, 0, -1, 0, -2, -1, -2, 0, 0, 0, -2, -1, -1, -2, -2, -1, -1, -2, -1, -2, -1, -1, 0, -2, -2, -2, -2, -2, -1, -1, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -3,
+    0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, 0, -6, 0, -1, -1, 0, -2, 0, 0, 0, -2, -1, -2, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -1, -1, -2, -1, -2, -2, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, -4, 0, -1, -1, 0, -2, 0, 0, 0, -1, -2, -1, -2, -2, -2, -1, -2, -1, -1, -2, -1, -1, 0, -1, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, 1, -6, 0, -1, 0, 1, -1, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 2, 0, 0, -1, 0, -3, 0, -2, 0, -2, -3, -2, -2, 0, 0, -5, 0, 0, 0, 0, -5, 0, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, -6, 0, 0, 0, -2, -1, -2, 0, 0, 0, -2, -1, -2, -2, -2, -1, -2, -2, -1, -2, -2, -1, -1, -2, -2, -2, -2, -2, -2, -1, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -3,
+    -1, 2, 0, 0, -1, 0, -2, 0, -1, 0, -1, -2, -2, -1, 0, 0, -5, 0, 0, 0, 0, -4, 0, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, -6, 0, 0, 0, -2, -1, -1, 0, 0, 0, -2, -1, -2, -2, -2, -1, -2, -2, -1, -2, -2, -1, -1, -2, -2, -2, -2, -2, -1, -1, -1, -1, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -2,
+    0, 1, 0, -1, -1, -1, 0, -2, 0, -1, 0, 0, 0, -3, 0, -1, -3, -1, 0, 0, -1, -2, 0, -1, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, -2, -1, 0, -1, -1, -6, -1, -2, -1, 0, -2, 0, 0, 0, -2, -2, -2, -3, -3, -3, -2, -3, -1, -1, -2, -1, -1, 0, -1, -2, -3, -1, -2, -2, -1, -2, -2, -1, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1,
+    -1, 2, 0, 0, -1, 0, -2, 0, -1, 0, -1, -1, -2, -1, 0, 0, -5, 0, 0, 0, 0, -4, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -6, 0, 0, 0, -2, -1, -1, 0, 0, 0, -2, -1, -2, -2, -2, -1, -2, -2, -1, -2, -2, -1, -1, -2, -2, -2, -2, -2, -1, -1, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, 0, -6, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2, -1, -2, -2, -2, -1, -2, -1, -1, -2, -1, -1, 0, -1, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -4, 0, -2, 0, -1, -1, 0, 0, -2, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, -2, -2, -2, -1, -1, 0, 0, 0, 0, 0, -2, -2, 0, -2, -2, -2, -2, -2, -2, -2, -3, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -4, -3, -3, -3, -4, -3, -2, -6, -3, -3, -3, -3, -4, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -3, -3, -3, -3, -3, -2, -5, -3, -3, -3, -3, -4, -3, -2, -3, -3, -3, -3, -3, -3, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, -1, 0, 1, 1, 0, 1, 1, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, -2, -1, -1, 0, 0, -4, 0, 0, 0, 0, -2, 1, 1, 1, 0, 0, 1, 0, 0, -2, 0, 0, 1, 0, 1, 0, 1, -1, -4, 0, -1, -1, -3, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -5,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 2, 0, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, -1, 1, 1, 0, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 3, 2, 0, 2, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -2, 0, 0, -2, 0, 0, 0, 0, -2, 1, 1, 1, 0, 0, 1, 0, 0, -3, 0, 0, 1, 0, 1, 0, 1, 0, -2, 0, 0, 0, -2, -1, -3, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 2, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 2, 1, 0, 2, 4, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -1, 0, -1, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair opendyslexic_8_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_8_italic = {
     opendyslexic_8_italicBitmaps,
     opendyslexic_8_italicGlyphs,
     opendyslexic_8_italicIntervals,
-    52,
+    53,
     30,
     22,
     -9,
     true,
+    opendyslexic_8_italicKernLeftClasses,
+    105,
+    opendyslexic_8_italicKernRightClasses,
+    95,
+    opendyslexic_8_italicKernMatrix,
+    98,
+    93,
+    opendyslexic_8_italicLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_8_regularBitmaps[24726] = {
+static const uint8_t opendyslexic_8_regularBitmaps[24987] = {
     0x01, 0x01, 0xC0, 0xB0, 0x2C, 0x0B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x05,
     0x01, 0x43, 0xF0, 0xFC, 0x3F, 0x00, 0x14, 0x05, 0x0F, 0x8B, 0xC3, 0xD2, 0xF0, 0xF0, 0xF8, 0x3D,
     0x3E, 0x0A, 0x0A, 0x40, 0x00, 0x1C, 0x07, 0x00, 0x00, 0x0B, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0xF0,
@@ -1553,7 +1553,23 @@ static const uint8_t opendyslexic_8_regularBitmaps[24726] = {
     0x01, 0x40, 0x00, 0x00, 0xFF, 0xFA, 0x50, 0x00, 0x16, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90,
     0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00,
     0x6F, 0xF0, 0x1B, 0xFF, 0x80, 0x2F, 0xE4, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x16,
-    0xBF, 0xF4, 0x7E, 0x95, 0x00, 0x00,
+    0xBF, 0xF4, 0x7E, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x7F, 0x0E, 0x00, 0xE0, 0x0C,
+    0x00, 0xD0, 0x0D, 0x00, 0xD0, 0x7F, 0xFF, 0xFF, 0x6F, 0xAA, 0xF5, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
+    0xE0, 0x1E, 0x00, 0xE0, 0x1E, 0x00, 0xE0, 0x1E, 0x00, 0xF0, 0x1E, 0x00, 0xF0, 0x1E, 0x01, 0xF0,
+    0x00, 0x00, 0xA0, 0x00, 0x07, 0xC0, 0x7E, 0x2F, 0x03, 0x80, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00,
+    0x07, 0xFF, 0x0D, 0x0B, 0x94, 0x34, 0x0E, 0x00, 0xD0, 0x38, 0x03, 0x41, 0xE0, 0x0D, 0x07, 0x80,
+    0x34, 0x1E, 0x01, 0xE0, 0x78, 0x07, 0x81, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x10, 0x01, 0xF8, 0x1D,
+    0x00, 0xE0, 0x07, 0x00, 0x30, 0x02, 0xC0, 0x0C, 0x00, 0xB0, 0x1F, 0xFC, 0x2C, 0x02, 0xE5, 0x0F,
+    0x00, 0x38, 0x03, 0xC0, 0x0E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
+    0xC0, 0x1E, 0x00, 0xFF, 0x07, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07,
+    0xC0, 0x7E, 0x07, 0xF2, 0xF0, 0x38, 0x03, 0x80, 0x00, 0x0C, 0x00, 0xD0, 0x00, 0x03, 0x40, 0x34,
+    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0xD1, 0xBE, 0xAB, 0xD4, 0x34, 0x0E, 0x00, 0xE0, 0x0D, 0x03, 0x80,
+    0x38, 0x03, 0x41, 0xE0, 0x0E, 0x00, 0xD0, 0x78, 0x03, 0x80, 0x38, 0x1E, 0x00, 0xF0, 0x0E, 0x07,
+    0x80, 0x3C, 0x03, 0x81, 0xE0, 0x1F, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F, 0x81, 0xFC,
+    0x0D, 0x00, 0xE0, 0x0E, 0x00, 0x74, 0x03, 0x00, 0x34, 0x01, 0xC0, 0x0D, 0x00, 0xD0, 0x0B, 0x01,
+    0xFF, 0xFF, 0xFC, 0x2C, 0x06, 0xFA, 0xAF, 0x50, 0xB0, 0x03, 0x80, 0x38, 0x02, 0xC0, 0x0E, 0x00,
+    0xE0, 0x0F, 0x00, 0x78, 0x03, 0x80, 0x3C, 0x01, 0xE0, 0x0E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x03,
+    0xC0, 0x1E, 0x00, 0xF0, 0x0F, 0xF0, 0x78, 0x07, 0xC0, 0x3F, 0xC0,
 };
 
 static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
@@ -2262,6 +2278,11 @@ static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
     { 11, 15, 18, 4, 13, 42, 24598 }, // ≠
     { 13, 13, 14, 1, 12, 43, 24640 }, // ≤
     { 13, 13, 14, 1, 12, 43, 24683 }, // ≥
+    { 12, 14, 17, 2, 14, 42, 24726 }, // ﬀ
+    { 11, 15, 15, 2, 15, 42, 24768 }, // ﬁ
+    { 13, 14, 17, 2, 14, 46, 24810 }, // ﬂ
+    { 17, 15, 21, 2, 15, 64, 24856 }, // ﬃ
+    { 19, 14, 23, 2, 14, 67, 24920 }, // ﬄ
 };
 
 static const EpdUnicodeInterval opendyslexic_8_regularIntervals[] = {
@@ -2317,15 +2338,94 @@ static const EpdUnicodeInterval opendyslexic_8_regularIntervals[] = {
     { 0x2248, 0x2248, 0x2BD },
     { 0x2260, 0x2260, 0x2BE },
     { 0x2264, 0x2265, 0x2BF },
+    { 0xFB00, 0xFB04, 0x2C1 },
+};
+
+static const EpdKernClassEntry opendyslexic_8_regularKernLeftClasses[] = {
+    { 0x21, 1 }, // !
+    { 0x22, 1 }, // "
+    { 0x23, 1 }, // #
+    { 0x27, 1 }, // '
+    { 0x28, 1 }, // (
+    { 0x29, 1 }, // )
+    { 0x2A, 1 }, // *
+    { 0x2C, 1 }, // ,
+    { 0x2D, 1 }, // -
+    { 0x2E, 1 }, // .
+    { 0x2F, 1 }, // /
+    { 0x3A, 1 }, // :
+    { 0x3B, 1 }, // ;
+    { 0x3F, 1 }, // ?
+    { 0x5B, 1 }, // [
+    { 0x5C, 1 }, // <backslash>
+    { 0x5D, 1 }, // ]
+    { 0x5F, 1 }, // _
+    { 0x7B, 1 }, // {
+    { 0x7D, 1 }, // }
+    { 0xA1, 1 }, // ¡
+    { 0xAB, 1 }, // «
+    { 0xAD, 1 }, // ­
+    { 0xB7, 1 }, // ·
+    { 0xBB, 1 }, // »
+    { 0xBF, 1 }, // ¿
+    { 0x2010, 1 }, // ‐
+    { 0x2011, 1 }, // ‑
+    { 0x2012, 1 }, // ‒
+    { 0x2013, 1 }, // –
+    { 0x2014, 1 }, // —
+    { 0x2015, 1 }, // ―
+    { 0x2016, 1 }, // ‖
+    { 0x2017, 1 }, // ‗
+    { 0x2018, 1 }, // ‘
+    { 0x2019, 1 }, // ’
+    { 0x201A, 1 }, // ‚
+    { 0x201B, 1 }, // ‛
+    { 0x201C, 1 }, // “
+    { 0x201D, 1 }, // ”
+    { 0x201E, 1 }, // „
+    { 0x201F, 1 }, // ‟
+    { 0x2022, 1 }, // •
+    { 0x2023, 1 }, // ‣
+    { 0x2024, 1 }, // ․
+    { 0x2025, 1 }, // ‥
+    { 0x2026, 1 }, // …
+    { 0x2027, 1 }, // ‧
+    { 0x2039, 1 }, // ‹
+    { 0x203A, 1 }, // ›
+};
+
+static const EpdKernClassEntry opendyslexic_8_regularKernRightClasses[] = {
+    { 0x20, 1 }, //  
+};
+
+static const int8_t opendyslexic_8_regularKernMatrix[1] = {
+    3,
+};
+
+static const EpdLigaturePair opendyslexic_8_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData opendyslexic_8_regular = {
     opendyslexic_8_regularBitmaps,
     opendyslexic_8_regularGlyphs,
     opendyslexic_8_regularIntervals,
-    52,
+    53,
     30,
     22,
     -9,
     true,
+    opendyslexic_8_regularKernLeftClasses,
+    50,
+    opendyslexic_8_regularKernRightClasses,
+    1,
+    opendyslexic_8_regularKernMatrix,
+    1,
+    1,
+    opendyslexic_8_regularLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_10_boldBitmaps[13720] = {
+static const uint8_t ubuntu_10_boldBitmaps[13900] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xEF, 0xEF, 0xE7, 0xE7, 0x1E, 0xF0,
     0xF7, 0x87, 0x3C, 0x39, 0xCF, 0xFF, 0xFF, 0xFC, 0xF7, 0x87, 0x3C, 0x39, 0xC7, 0xFF, 0xFF, 0xFE,
     0xF7, 0x87, 0xBC, 0x39, 0xE1, 0xCE, 0x00, 0x0F, 0x01, 0xE0, 0x7F, 0x9F, 0xF7, 0xFC, 0xF3, 0x9E,
@@ -865,7 +865,18 @@ static const uint8_t ubuntu_10_boldBitmaps[13720] = {
     0xEF, 0xFE, 0xE3, 0xC0, 0x01, 0x80, 0xE0, 0x3B, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0x70, 0xFF, 0xFF,
     0xFF, 0xFD, 0xC0, 0x70, 0x18, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFE, 0xF8, 0x3F, 0xEF, 0xFC, 0xFF,
     0x03, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x3F, 0xCF, 0xFD, 0xFF, 0x07, 0xDF, 0xFF, 0xFF,
-    0xFC, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFC, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x1F, 0xBF, 0x9F, 0xFF, 0xDF, 0xFF, 0x6F,
+    0xAF, 0x07, 0x87, 0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xF0, 0x78, 0x78, 0x3C, 0x3C, 0x1E, 0x1E,
+    0x0F, 0x0F, 0x07, 0x87, 0x83, 0xC3, 0xC1, 0xE1, 0xE0, 0xF0, 0x3F, 0x7B, 0xFB, 0xFF, 0xDF, 0xF0,
+    0xFF, 0x00, 0x7F, 0xBF, 0xFD, 0xFF, 0xEF, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8,
+    0x3F, 0xC1, 0xFE, 0x0F, 0x3F, 0x78, 0xFE, 0xF3, 0xFD, 0xE7, 0xC3, 0xCF, 0x07, 0x9F, 0xEF, 0x3F,
+    0xDE, 0x7F, 0xBC, 0xF0, 0x79, 0xE0, 0xF3, 0xC1, 0xE7, 0x83, 0xCF, 0x07, 0xDE, 0x0F, 0xBC, 0x1F,
+    0x78, 0x1E, 0x3F, 0x1F, 0xB9, 0xFC, 0xFF, 0xFF, 0xF7, 0xF7, 0xFE, 0xDF, 0x4E, 0xF0, 0x78, 0x03,
+    0xFD, 0xFE, 0xFF, 0xF7, 0xFB, 0xFF, 0xDF, 0xEF, 0xF0, 0x78, 0x3F, 0xC1, 0xE0, 0xFF, 0x07, 0x83,
+    0xFC, 0x1E, 0x0F, 0xF0, 0x78, 0x3F, 0xC1, 0xE0, 0xFF, 0x07, 0x83, 0xFC, 0x1E, 0x0F, 0x3F, 0x1F,
+    0xBC, 0xFE, 0x7F, 0x7B, 0xFD, 0xFC, 0xF7, 0xDB, 0xE9, 0xEF, 0x07, 0x83, 0xDF, 0xEF, 0xF7, 0xBF,
+    0xDF, 0xEF, 0x7F, 0xBF, 0xDE, 0xF0, 0x78, 0x3D, 0xE0, 0xF0, 0x7B, 0xC1, 0xE0, 0xF7, 0x83, 0xC1,
+    0xEF, 0x07, 0x83, 0xDE, 0x0F, 0x07, 0xFC, 0x1E, 0x0F, 0xF8, 0x3C, 0x0F,
 };
 
 static const EpdGlyph ubuntu_10_boldGlyphs[] = {
@@ -1443,6 +1454,11 @@ static const EpdGlyph ubuntu_10_boldGlyphs[] = {
     { 10, 14, 12, 1, 14, 18, 13668 }, // ≠
     { 10, 13, 12, 1, 13, 17, 13686 }, // ≤
     { 10, 13, 12, 1, 13, 17, 13703 }, // ≥
+    { 17, 16, 18, 1, 16, 34, 13720 }, // ﬀ
+    { 13, 16, 15, 1, 16, 26, 13754 }, // ﬁ
+    { 15, 16, 15, 1, 16, 30, 13780 }, // ﬂ
+    { 22, 16, 24, 1, 16, 44, 13810 }, // ﬃ
+    { 23, 16, 24, 1, 16, 46, 13854 }, // ﬄ
 };
 
 static const EpdUnicodeInterval ubuntu_10_boldIntervals[] = {
@@ -1481,15 +1497,623 @@ static const EpdUnicodeInterval ubuntu_10_boldIntervals[] = {
     { 0x2248, 0x2248, 0x23A },
     { 0x2260, 0x2260, 0x23B },
     { 0x2264, 0x2265, 0x23C },
+    { 0xFB00, 0xFB04, 0x23E },
+};
+
+static const EpdKernClassEntry ubuntu_10_boldKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x29, 4 }, // )
+    { 0x2A, 5 }, // *
+    { 0x2C, 6 }, // ,
+    { 0x2D, 7 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 8 }, // /
+    { 0x3A, 9 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x40, 7 }, // @
+    { 0x41, 10 }, // A
+    { 0x42, 11 }, // B
+    { 0x43, 12 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 14 }, // E
+    { 0x46, 15 }, // F
+    { 0x47, 16 }, // G
+    { 0x4A, 17 }, // J
+    { 0x4B, 18 }, // K
+    { 0x4C, 19 }, // L
+    { 0x4F, 13 }, // O
+    { 0x50, 20 }, // P
+    { 0x51, 13 }, // Q
+    { 0x52, 21 }, // R
+    { 0x53, 22 }, // S
+    { 0x54, 23 }, // T
+    { 0x55, 24 }, // U
+    { 0x56, 25 }, // V
+    { 0x57, 26 }, // W
+    { 0x58, 27 }, // X
+    { 0x59, 28 }, // Y
+    { 0x5A, 29 }, // Z
+    { 0x5B, 30 }, // [
+    { 0x5C, 31 }, // <backslash>
+    { 0x5D, 32 }, // ]
+    { 0x61, 33 }, // a
+    { 0x62, 34 }, // b
+    { 0x63, 35 }, // c
+    { 0x64, 33 }, // d
+    { 0x66, 36 }, // f
+    { 0x67, 37 }, // g
+    { 0x68, 38 }, // h
+    { 0x69, 38 }, // i
+    { 0x6A, 39 }, // j
+    { 0x6B, 40 }, // k
+    { 0x6C, 41 }, // l
+    { 0x6D, 38 }, // m
+    { 0x6E, 38 }, // n
+    { 0x6F, 34 }, // o
+    { 0x70, 34 }, // p
+    { 0x71, 37 }, // q
+    { 0x72, 42 }, // r
+    { 0x73, 43 }, // s
+    { 0x74, 44 }, // t
+    { 0x75, 45 }, // u
+    { 0x76, 46 }, // v
+    { 0x77, 46 }, // w
+    { 0x78, 47 }, // x
+    { 0x79, 46 }, // y
+    { 0x7A, 48 }, // z
+    { 0x7B, 49 }, // {
+    { 0xA1, 50 }, // ¡
+    { 0xAB, 9 }, // «
+    { 0xBB, 51 }, // »
+    { 0xBF, 52 }, // ¿
+    { 0xC0, 10 }, // À
+    { 0xC1, 10 }, // Á
+    { 0xC2, 10 }, // Â
+    { 0xC3, 10 }, // Ã
+    { 0xC4, 10 }, // Ä
+    { 0xC5, 10 }, // Å
+    { 0xC6, 14 }, // Æ
+    { 0xC7, 12 }, // Ç
+    { 0xC8, 14 }, // È
+    { 0xC9, 14 }, // É
+    { 0xCA, 14 }, // Ê
+    { 0xCB, 14 }, // Ë
+    { 0xD0, 13 }, // Ð
+    { 0xD2, 13 }, // Ò
+    { 0xD3, 13 }, // Ó
+    { 0xD4, 13 }, // Ô
+    { 0xD5, 13 }, // Õ
+    { 0xD6, 13 }, // Ö
+    { 0xD8, 13 }, // Ø
+    { 0xD9, 24 }, // Ù
+    { 0xDA, 24 }, // Ú
+    { 0xDB, 24 }, // Û
+    { 0xDC, 24 }, // Ü
+    { 0xDD, 28 }, // Ý
+    { 0xDE, 53 }, // Þ
+    { 0xDF, 54 }, // ß
+    { 0xE0, 33 }, // à
+    { 0xE1, 33 }, // á
+    { 0xE2, 33 }, // â
+    { 0xE3, 33 }, // ã
+    { 0xE4, 33 }, // ä
+    { 0xE5, 33 }, // å
+    { 0xE7, 35 }, // ç
+    { 0xEC, 38 }, // ì
+    { 0xED, 38 }, // í
+    { 0xEE, 38 }, // î
+    { 0xEF, 38 }, // ï
+    { 0xF0, 55 }, // ð
+    { 0xF1, 38 }, // ñ
+    { 0xF2, 34 }, // ò
+    { 0xF3, 34 }, // ó
+    { 0xF4, 34 }, // ô
+    { 0xF5, 34 }, // õ
+    { 0xF6, 34 }, // ö
+    { 0xF8, 34 }, // ø
+    { 0xF9, 45 }, // ù
+    { 0xFA, 45 }, // ú
+    { 0xFB, 45 }, // û
+    { 0xFC, 45 }, // ü
+    { 0xFD, 46 }, // ý
+    { 0xFE, 56 }, // þ
+    { 0xFF, 46 }, // ÿ
+    { 0x100, 10 }, // Ā
+    { 0x101, 33 }, // ā
+    { 0x102, 10 }, // Ă
+    { 0x103, 33 }, // ă
+    { 0x104, 10 }, // Ą
+    { 0x105, 33 }, // ą
+    { 0x106, 12 }, // Ć
+    { 0x107, 35 }, // ć
+    { 0x108, 12 }, // Ĉ
+    { 0x109, 35 }, // ĉ
+    { 0x10A, 12 }, // Ċ
+    { 0x10B, 35 }, // ċ
+    { 0x10C, 12 }, // Č
+    { 0x10D, 35 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 57 }, // ď
+    { 0x110, 13 }, // Đ
+    { 0x111, 33 }, // đ
+    { 0x112, 14 }, // Ē
+    { 0x114, 14 }, // Ĕ
+    { 0x116, 14 }, // Ė
+    { 0x118, 14 }, // Ę
+    { 0x11A, 14 }, // Ě
+    { 0x11C, 16 }, // Ĝ
+    { 0x11D, 37 }, // ĝ
+    { 0x11E, 16 }, // Ğ
+    { 0x11F, 37 }, // ğ
+    { 0x120, 16 }, // Ġ
+    { 0x121, 37 }, // ġ
+    { 0x122, 16 }, // Ģ
+    { 0x123, 37 }, // ģ
+    { 0x125, 38 }, // ĥ
+    { 0x127, 38 }, // ħ
+    { 0x129, 38 }, // ĩ
+    { 0x12B, 38 }, // ī
+    { 0x12D, 38 }, // ĭ
+    { 0x12F, 38 }, // į
+    { 0x131, 38 }, // ı
+    { 0x132, 17 }, // Ĳ
+    { 0x133, 39 }, // ĳ
+    { 0x134, 17 }, // Ĵ
+    { 0x135, 39 }, // ĵ
+    { 0x136, 18 }, // Ķ
+    { 0x137, 40 }, // ķ
+    { 0x138, 40 }, // ĸ
+    { 0x139, 19 }, // Ĺ
+    { 0x13A, 41 }, // ĺ
+    { 0x13B, 19 }, // Ļ
+    { 0x13C, 41 }, // ļ
+    { 0x13D, 19 }, // Ľ
+    { 0x13E, 57 }, // ľ
+    { 0x13F, 19 }, // Ŀ
+    { 0x140, 41 }, // ŀ
+    { 0x141, 19 }, // Ł
+    { 0x142, 41 }, // ł
+    { 0x144, 38 }, // ń
+    { 0x146, 38 }, // ņ
+    { 0x148, 38 }, // ň
+    { 0x149, 38 }, // ŉ
+    { 0x14B, 58 }, // ŋ
+    { 0x14C, 13 }, // Ō
+    { 0x14D, 34 }, // ō
+    { 0x14E, 13 }, // Ŏ
+    { 0x14F, 34 }, // ŏ
+    { 0x150, 13 }, // Ő
+    { 0x151, 34 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x154, 21 }, // Ŕ
+    { 0x155, 42 }, // ŕ
+    { 0x156, 21 }, // Ŗ
+    { 0x157, 42 }, // ŗ
+    { 0x158, 21 }, // Ř
+    { 0x159, 42 }, // ř
+    { 0x15A, 22 }, // Ś
+    { 0x15B, 43 }, // ś
+    { 0x15C, 22 }, // Ŝ
+    { 0x15D, 43 }, // ŝ
+    { 0x15E, 22 }, // Ş
+    { 0x15F, 43 }, // ş
+    { 0x160, 22 }, // Š
+    { 0x161, 43 }, // š
+    { 0x162, 23 }, // Ţ
+    { 0x163, 44 }, // ţ
+    { 0x164, 23 }, // Ť
+    { 0x165, 44 }, // ť
+    { 0x166, 23 }, // Ŧ
+    { 0x167, 44 }, // ŧ
+    { 0x168, 24 }, // Ũ
+    { 0x169, 45 }, // ũ
+    { 0x16A, 24 }, // Ū
+    { 0x16B, 45 }, // ū
+    { 0x16C, 24 }, // Ŭ
+    { 0x16D, 45 }, // ŭ
+    { 0x16E, 24 }, // Ů
+    { 0x16F, 45 }, // ů
+    { 0x170, 24 }, // Ű
+    { 0x171, 45 }, // ű
+    { 0x172, 24 }, // Ų
+    { 0x173, 45 }, // ų
+    { 0x174, 26 }, // Ŵ
+    { 0x175, 46 }, // ŵ
+    { 0x176, 28 }, // Ŷ
+    { 0x177, 46 }, // ŷ
+    { 0x178, 28 }, // Ÿ
+    { 0x179, 29 }, // Ź
+    { 0x17A, 48 }, // ź
+    { 0x17B, 29 }, // Ż
+    { 0x17C, 48 }, // ż
+    { 0x17D, 29 }, // Ž
+    { 0x17E, 48 }, // ž
+    { 0x17F, 36 }, // ſ
+    { 0x2013, 7 }, // –
+    { 0x2014, 7 }, // —
+    { 0x2018, 59 }, // ‘
+    { 0x2019, 60 }, // ’
+    { 0x201A, 61 }, // ‚
+    { 0x201C, 59 }, // “
+    { 0x201D, 60 }, // ”
+    { 0x201E, 61 }, // „
+    { 0x2026, 6 }, // …
+    { 0x2039, 9 }, // ‹
+    { 0x203A, 51 }, // ›
+    { 0xFB00, 36 }, // ﬀ
+    { 0xFB01, 38 }, // ﬁ
+    { 0xFB02, 41 }, // ﬂ
+    { 0xFB03, 38 }, // ﬃ
+    { 0xFB04, 41 }, // ﬄ
+};
+
+static const EpdKernClassEntry ubuntu_10_boldKernRightClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x29, 4 }, // )
+    { 0x2A, 5 }, // *
+    { 0x2C, 6 }, // ,
+    { 0x2D, 7 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 8 }, // /
+    { 0x3A, 9 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x3F, 10 }, // ?
+    { 0x40, 11 }, // @
+    { 0x41, 12 }, // A
+    { 0x42, 13 }, // B
+    { 0x43, 14 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 13 }, // E
+    { 0x46, 13 }, // F
+    { 0x47, 14 }, // G
+    { 0x48, 13 }, // H
+    { 0x49, 13 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 13 }, // K
+    { 0x4C, 13 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 13 }, // N
+    { 0x4F, 14 }, // O
+    { 0x50, 13 }, // P
+    { 0x51, 14 }, // Q
+    { 0x52, 13 }, // R
+    { 0x53, 17 }, // S
+    { 0x54, 18 }, // T
+    { 0x55, 19 }, // U
+    { 0x56, 20 }, // V
+    { 0x57, 21 }, // W
+    { 0x58, 22 }, // X
+    { 0x59, 23 }, // Y
+    { 0x5A, 17 }, // Z
+    { 0x5C, 24 }, // <backslash>
+    { 0x5D, 25 }, // ]
+    { 0x61, 26 }, // a
+    { 0x62, 17 }, // b
+    { 0x63, 27 }, // c
+    { 0x64, 27 }, // d
+    { 0x65, 27 }, // e
+    { 0x66, 17 }, // f
+    { 0x67, 27 }, // g
+    { 0x68, 28 }, // h
+    { 0x69, 17 }, // i
+    { 0x6A, 29 }, // j
+    { 0x6B, 28 }, // k
+    { 0x6C, 28 }, // l
+    { 0x6D, 30 }, // m
+    { 0x6E, 30 }, // n
+    { 0x6F, 27 }, // o
+    { 0x70, 30 }, // p
+    { 0x71, 27 }, // q
+    { 0x72, 30 }, // r
+    { 0x73, 31 }, // s
+    { 0x74, 17 }, // t
+    { 0x75, 32 }, // u
+    { 0x76, 33 }, // v
+    { 0x77, 34 }, // w
+    { 0x78, 35 }, // x
+    { 0x79, 36 }, // y
+    { 0x7A, 37 }, // z
+    { 0x7D, 38 }, // }
+    { 0xAB, 39 }, // «
+    { 0xBB, 9 }, // »
+    { 0xC0, 12 }, // À
+    { 0xC1, 12 }, // Á
+    { 0xC2, 12 }, // Â
+    { 0xC3, 12 }, // Ã
+    { 0xC4, 12 }, // Ä
+    { 0xC5, 12 }, // Å
+    { 0xC6, 40 }, // Æ
+    { 0xC7, 14 }, // Ç
+    { 0xC8, 13 }, // È
+    { 0xC9, 13 }, // É
+    { 0xCA, 13 }, // Ê
+    { 0xCB, 13 }, // Ë
+    { 0xCC, 13 }, // Ì
+    { 0xCD, 13 }, // Í
+    { 0xCE, 13 }, // Î
+    { 0xCF, 13 }, // Ï
+    { 0xD0, 13 }, // Ð
+    { 0xD1, 13 }, // Ñ
+    { 0xD2, 14 }, // Ò
+    { 0xD3, 14 }, // Ó
+    { 0xD4, 14 }, // Ô
+    { 0xD5, 14 }, // Õ
+    { 0xD6, 14 }, // Ö
+    { 0xD8, 14 }, // Ø
+    { 0xD9, 19 }, // Ù
+    { 0xDA, 19 }, // Ú
+    { 0xDB, 19 }, // Û
+    { 0xDC, 19 }, // Ü
+    { 0xDD, 23 }, // Ý
+    { 0xDF, 17 }, // ß
+    { 0xE0, 26 }, // à
+    { 0xE1, 26 }, // á
+    { 0xE2, 26 }, // â
+    { 0xE3, 26 }, // ã
+    { 0xE4, 41 }, // ä
+    { 0xE5, 26 }, // å
+    { 0xE6, 26 }, // æ
+    { 0xE7, 27 }, // ç
+    { 0xE8, 27 }, // è
+    { 0xE9, 27 }, // é
+    { 0xEA, 27 }, // ê
+    { 0xEB, 27 }, // ë
+    { 0xEC, 28 }, // ì
+    { 0xED, 17 }, // í
+    { 0xEE, 42 }, // î
+    { 0xEF, 43 }, // ï
+    { 0xF0, 44 }, // ð
+    { 0xF1, 30 }, // ñ
+    { 0xF2, 27 }, // ò
+    { 0xF3, 27 }, // ó
+    { 0xF4, 27 }, // ô
+    { 0xF5, 27 }, // õ
+    { 0xF6, 27 }, // ö
+    { 0xF8, 27 }, // ø
+    { 0xF9, 32 }, // ù
+    { 0xFA, 32 }, // ú
+    { 0xFB, 32 }, // û
+    { 0xFC, 32 }, // ü
+    { 0xFD, 36 }, // ý
+    { 0xFF, 36 }, // ÿ
+    { 0x100, 12 }, // Ā
+    { 0x101, 26 }, // ā
+    { 0x102, 12 }, // Ă
+    { 0x103, 26 }, // ă
+    { 0x104, 12 }, // Ą
+    { 0x105, 26 }, // ą
+    { 0x106, 14 }, // Ć
+    { 0x107, 27 }, // ć
+    { 0x108, 14 }, // Ĉ
+    { 0x109, 27 }, // ĉ
+    { 0x10A, 14 }, // Ċ
+    { 0x10B, 27 }, // ċ
+    { 0x10C, 14 }, // Č
+    { 0x10D, 27 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 27 }, // ď
+    { 0x111, 27 }, // đ
+    { 0x112, 13 }, // Ē
+    { 0x113, 27 }, // ē
+    { 0x114, 13 }, // Ĕ
+    { 0x115, 27 }, // ĕ
+    { 0x116, 13 }, // Ė
+    { 0x117, 27 }, // ė
+    { 0x118, 13 }, // Ę
+    { 0x119, 27 }, // ę
+    { 0x11A, 13 }, // Ě
+    { 0x11B, 27 }, // ě
+    { 0x11C, 14 }, // Ĝ
+    { 0x11D, 27 }, // ĝ
+    { 0x11E, 14 }, // Ğ
+    { 0x11F, 27 }, // ğ
+    { 0x120, 14 }, // Ġ
+    { 0x121, 27 }, // ġ
+    { 0x122, 14 }, // Ģ
+    { 0x123, 27 }, // ģ
+    { 0x124, 13 }, // Ĥ
+    { 0x125, 28 }, // ĥ
+    { 0x126, 13 }, // Ħ
+    { 0x127, 28 }, // ħ
+    { 0x128, 13 }, // Ĩ
+    { 0x129, 43 }, // ĩ
+    { 0x12A, 13 }, // Ī
+    { 0x12B, 45 }, // ī
+    { 0x12C, 13 }, // Ĭ
+    { 0x12D, 46 }, // ĭ
+    { 0x12E, 13 }, // Į
+    { 0x12F, 17 }, // į
+    { 0x130, 13 }, // İ
+    { 0x131, 17 }, // ı
+    { 0x132, 13 }, // Ĳ
+    { 0x133, 17 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 29 }, // ĵ
+    { 0x136, 13 }, // Ķ
+    { 0x137, 28 }, // ķ
+    { 0x139, 13 }, // Ĺ
+    { 0x13A, 28 }, // ĺ
+    { 0x13B, 13 }, // Ļ
+    { 0x13C, 28 }, // ļ
+    { 0x13D, 13 }, // Ľ
+    { 0x13E, 28 }, // ľ
+    { 0x13F, 13 }, // Ŀ
+    { 0x140, 28 }, // ŀ
+    { 0x141, 13 }, // Ł
+    { 0x142, 28 }, // ł
+    { 0x143, 13 }, // Ń
+    { 0x144, 30 }, // ń
+    { 0x145, 13 }, // Ņ
+    { 0x146, 30 }, // ņ
+    { 0x147, 13 }, // Ň
+    { 0x148, 30 }, // ň
+    { 0x149, 30 }, // ŉ
+    { 0x14A, 17 }, // Ŋ
+    { 0x14B, 9 }, // ŋ
+    { 0x14C, 14 }, // Ō
+    { 0x14D, 27 }, // ō
+    { 0x14E, 14 }, // Ŏ
+    { 0x14F, 27 }, // ŏ
+    { 0x150, 14 }, // Ő
+    { 0x151, 27 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x153, 27 }, // œ
+    { 0x154, 13 }, // Ŕ
+    { 0x155, 30 }, // ŕ
+    { 0x156, 13 }, // Ŗ
+    { 0x157, 30 }, // ŗ
+    { 0x158, 13 }, // Ř
+    { 0x159, 30 }, // ř
+    { 0x15A, 17 }, // Ś
+    { 0x15B, 31 }, // ś
+    { 0x15C, 17 }, // Ŝ
+    { 0x15D, 31 }, // ŝ
+    { 0x15E, 17 }, // Ş
+    { 0x15F, 31 }, // ş
+    { 0x160, 17 }, // Š
+    { 0x161, 31 }, // š
+    { 0x162, 18 }, // Ţ
+    { 0x163, 17 }, // ţ
+    { 0x164, 18 }, // Ť
+    { 0x165, 17 }, // ť
+    { 0x166, 18 }, // Ŧ
+    { 0x167, 17 }, // ŧ
+    { 0x168, 19 }, // Ũ
+    { 0x169, 32 }, // ũ
+    { 0x16A, 19 }, // Ū
+    { 0x16B, 32 }, // ū
+    { 0x16C, 19 }, // Ŭ
+    { 0x16D, 32 }, // ŭ
+    { 0x16E, 19 }, // Ů
+    { 0x16F, 32 }, // ů
+    { 0x170, 19 }, // Ű
+    { 0x171, 32 }, // ű
+    { 0x172, 19 }, // Ų
+    { 0x173, 32 }, // ų
+    { 0x174, 21 }, // Ŵ
+    { 0x175, 34 }, // ŵ
+    { 0x176, 23 }, // Ŷ
+    { 0x177, 36 }, // ŷ
+    { 0x178, 23 }, // Ÿ
+    { 0x179, 17 }, // Ź
+    { 0x17A, 37 }, // ź
+    { 0x17B, 17 }, // Ż
+    { 0x17C, 37 }, // ż
+    { 0x17D, 17 }, // Ž
+    { 0x17E, 37 }, // ž
+    { 0x17F, 17 }, // ſ
+    { 0x2013, 7 }, // –
+    { 0x2014, 7 }, // —
+    { 0x2018, 47 }, // ‘
+    { 0x2019, 48 }, // ’
+    { 0x201A, 49 }, // ‚
+    { 0x201C, 47 }, // “
+    { 0x201D, 48 }, // ”
+    { 0x201E, 49 }, // „
+    { 0x2026, 6 }, // …
+    { 0x2039, 39 }, // ‹
+    { 0x203A, 9 }, // ›
+    { 0xFB00, 17 }, // ﬀ
+    { 0xFB01, 17 }, // ﬁ
+    { 0xFB02, 17 }, // ﬂ
+    { 0xFB03, 17 }, // ﬃ
+    { 0xFB04, 17 }, // ﬄ
+};
+
+static const int8_t ubuntu_10_boldKernMatrix[2989] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 0, 0, -1, -1, 0, 2, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, -1, -2, -1, 1, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 1, 0, 1, 1, 1, 1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, -2, 1, 0, 0, 0, -1, 0, 1, 0, -1, 1, 0, 0, -2, 0, -1, -1, 1, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 1,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 1, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 1, -1, 0, 0, -1, 1, 0, 0, 1, -1, 1, 0, 0, 0, 1,
+    -2, 0, 0, 0, -2, 1, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, -2, 0, -2, -1, 1, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 1,
+    0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 1, 1, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -2, -1, -2, -1, 1, -1, -2, 0, 0, -2, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, -2, -2, 0, 0, -1, -2, -1, -2, -2, -2, -2, -1, 0, -2, -2, -2, 1, 1, -2, 1, 1, 1, 0, -1,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 1, 0, -2, -1, -2, 0, 1, -1, -1, 0, -1, -2, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -3, -1, 0, 1, -1, 1, 1, 1, 1, -1,
+    0, 0, 0, 1, 0, -1, 0, -1, 0, 1, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, -1, 0, 0, 1, 1, 0,
+    0, 0, 0, 1, -1, 1, -1, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 1, 0, 0, 0, 0, 0, 1,
+    0, -1, -1, 1, 0, -2, -1, -2, -1, 1, -1, -2, 0, -1, -2, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, -2, -2, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -2, -3, -1, 0, 1, -2, 1, 0, 1, 1, -1,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 1, 1, 1, 0, 2, -1, -1, 0, 2, -1, -1, -1, -1, -1, -1, 1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -2, -1, -2, -1, 0, -2, 0, 0, -1, -1, 0, 3, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0,
+    0, 0, 0, 1, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -2, -1, -1, -1, -1, -2, 0, 0, -1, -1, -1, 1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, -1, 1, 0, 0, -1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 2, 0, 2, 2, 0, 1, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -1, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -1, -2, 0, 0, -1, -2, -1, 0, 0, 0, 0, -1, 0, 0, -3, -1, 0, 0, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -3, -2, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair ubuntu_10_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData ubuntu_10_bold = {
     ubuntu_10_boldBitmaps,
     ubuntu_10_boldGlyphs,
     ubuntu_10_boldIntervals,
-    35,
+    36,
     24,
     20,
     -4,
     false,
+    ubuntu_10_boldKernLeftClasses,
+    247,
+    ubuntu_10_boldKernRightClasses,
+    273,
+    ubuntu_10_boldKernMatrix,
+    61,
+    49,
+    ubuntu_10_boldLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_10_regularBitmaps[12366] = {
+static const uint8_t ubuntu_10_regularBitmaps[12530] = {
     0xEE, 0xEE, 0xE6, 0x66, 0x66, 0x00, 0xEF, 0xE0, 0xEF, 0xDF, 0xBF, 0x6E, 0xC0, 0x1C, 0x61, 0xCE,
     0x1C, 0xE1, 0x8E, 0xFF, 0xFF, 0xFF, 0x38, 0xC3, 0x9C, 0x31, 0xCF, 0xFF, 0xFF, 0xF7, 0x18, 0x73,
     0x87, 0x38, 0x63, 0x80, 0x0C, 0x03, 0x03, 0xF9, 0xFE, 0xF1, 0xB8, 0x0E, 0x01, 0xE0, 0x7E, 0x07,
@@ -780,7 +780,18 @@ static const uint8_t ubuntu_10_regularBitmaps[12366] = {
     0x38, 0x78, 0xF8, 0xF0, 0x3C, 0x6F, 0xFD, 0xBF, 0xB1, 0xE3, 0xC6, 0xFF, 0xDB, 0xFB, 0x1E, 0x03,
     0x00, 0xC0, 0x73, 0xFF, 0xFF, 0xC3, 0x80, 0xC0, 0x70, 0xFF, 0xFF, 0xF3, 0x01, 0xC0, 0x60, 0x00,
     0x01, 0xC3, 0xF7, 0xFB, 0xF0, 0xF0, 0x3F, 0x07, 0xF8, 0x3F, 0x01, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0x07, 0xF8, 0x3F, 0x03, 0xC3, 0xF7, 0xFB, 0xF0, 0xE0, 0x00, 0x0F, 0xFF, 0xFF,
+    0x3F, 0x07, 0xF8, 0x3F, 0x03, 0xC3, 0xF7, 0xFB, 0xF0, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0x3F,
+    0x7E, 0x7F, 0x72, 0x72, 0xE0, 0x60, 0xE0, 0x60, 0xFE, 0xFE, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3E, 0xE7,
+    0xEE, 0x70, 0x0E, 0x00, 0xE0, 0x0F, 0xEE, 0xFE, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E,
+    0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x0E, 0x3E, 0x63, 0xF7, 0x1C, 0x39, 0xC1, 0xCE, 0x0E, 0x7F, 0x73,
+    0xFB, 0x9C, 0x1C, 0xE0, 0xE7, 0x07, 0x38, 0x39, 0xC1, 0xCE, 0x0E, 0x70, 0x3B, 0x81, 0xFC, 0x0F,
+    0x3F, 0x3E, 0x67, 0xE7, 0xE6, 0x72, 0x72, 0x0E, 0x06, 0x00, 0xE0, 0x60, 0x0F, 0xEF, 0xE6, 0xFE,
+    0xFE, 0x6E, 0x0E, 0x06, 0xE0, 0xE0, 0x6E, 0x0E, 0x06, 0xE0, 0xE0, 0x6E, 0x0E, 0x06, 0xE0, 0xE0,
+    0x6E, 0x0E, 0x06, 0xE0, 0xE0, 0x6E, 0x0E, 0x06, 0x3F, 0x3E, 0x63, 0xF3, 0xF3, 0x1C, 0x9C, 0x99,
+    0xC0, 0xC0, 0xCE, 0x06, 0x06, 0x7F, 0x7F, 0x33, 0xFB, 0xF9, 0x9C, 0x1C, 0x0C, 0xE0, 0xE0, 0x67,
+    0x07, 0x03, 0x38, 0x38, 0x19, 0xC1, 0xC0, 0xCE, 0x0E, 0x06, 0x70, 0x70, 0x3B, 0x83, 0x81, 0xFC,
+    0x1C, 0x07,
 };
 
 static const EpdGlyph ubuntu_10_regularGlyphs[] = {
@@ -1358,6 +1369,11 @@ static const EpdGlyph ubuntu_10_regularGlyphs[] = {
     { 10, 13, 12, 1, 13, 17, 12319 }, // ≠
     { 10, 12, 12, 1, 12, 15, 12336 }, // ≤
     { 10, 12, 12, 1, 12, 15, 12351 }, // ≥
+    { 16, 16, 16, 1, 16, 32, 12366 }, // ﬀ
+    { 12, 16, 14, 1, 16, 24, 12398 }, // ﬁ
+    { 13, 16, 14, 1, 16, 26, 12422 }, // ﬂ
+    { 20, 16, 22, 1, 16, 40, 12448 }, // ﬃ
+    { 21, 16, 22, 1, 16, 42, 12488 }, // ﬄ
 };
 
 static const EpdUnicodeInterval ubuntu_10_regularIntervals[] = {
@@ -1396,15 +1412,477 @@ static const EpdUnicodeInterval ubuntu_10_regularIntervals[] = {
     { 0x2248, 0x2248, 0x23A },
     { 0x2260, 0x2260, 0x23B },
     { 0x2264, 0x2265, 0x23C },
+    { 0xFB00, 0xFB04, 0x23E },
+};
+
+static const EpdKernClassEntry ubuntu_10_regularKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x29, 3 }, // )
+    { 0x2A, 4 }, // *
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 8 }, // ;
+    { 0x40, 9 }, // @
+    { 0x41, 10 }, // A
+    { 0x42, 11 }, // B
+    { 0x43, 12 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 14 }, // E
+    { 0x46, 15 }, // F
+    { 0x47, 16 }, // G
+    { 0x4A, 17 }, // J
+    { 0x4B, 18 }, // K
+    { 0x4C, 19 }, // L
+    { 0x4F, 20 }, // O
+    { 0x50, 21 }, // P
+    { 0x51, 22 }, // Q
+    { 0x52, 23 }, // R
+    { 0x54, 24 }, // T
+    { 0x55, 17 }, // U
+    { 0x56, 25 }, // V
+    { 0x57, 26 }, // W
+    { 0x58, 27 }, // X
+    { 0x59, 28 }, // Y
+    { 0x5A, 29 }, // Z
+    { 0x5B, 30 }, // [
+    { 0x61, 31 }, // a
+    { 0x62, 32 }, // b
+    { 0x63, 33 }, // c
+    { 0x66, 34 }, // f
+    { 0x68, 35 }, // h
+    { 0x6B, 36 }, // k
+    { 0x6D, 37 }, // m
+    { 0x6E, 37 }, // n
+    { 0x6F, 37 }, // o
+    { 0x70, 37 }, // p
+    { 0x71, 38 }, // q
+    { 0x72, 39 }, // r
+    { 0x74, 33 }, // t
+    { 0x76, 40 }, // v
+    { 0x77, 40 }, // w
+    { 0x78, 41 }, // x
+    { 0x7A, 42 }, // z
+    { 0x7B, 43 }, // {
+    { 0x7D, 44 }, // }
+    { 0xA1, 45 }, // ¡
+    { 0xAB, 8 }, // «
+    { 0xBB, 46 }, // »
+    { 0xBF, 47 }, // ¿
+    { 0xC0, 10 }, // À
+    { 0xC1, 10 }, // Á
+    { 0xC2, 10 }, // Â
+    { 0xC3, 10 }, // Ã
+    { 0xC4, 10 }, // Ä
+    { 0xC5, 10 }, // Å
+    { 0xC6, 14 }, // Æ
+    { 0xC7, 12 }, // Ç
+    { 0xC8, 14 }, // È
+    { 0xC9, 14 }, // É
+    { 0xCA, 14 }, // Ê
+    { 0xCB, 14 }, // Ë
+    { 0xD0, 13 }, // Ð
+    { 0xD2, 20 }, // Ò
+    { 0xD3, 20 }, // Ó
+    { 0xD4, 20 }, // Ô
+    { 0xD5, 20 }, // Õ
+    { 0xD6, 20 }, // Ö
+    { 0xD8, 20 }, // Ø
+    { 0xD9, 17 }, // Ù
+    { 0xDA, 17 }, // Ú
+    { 0xDB, 17 }, // Û
+    { 0xDC, 17 }, // Ü
+    { 0xDD, 28 }, // Ý
+    { 0xDE, 48 }, // Þ
+    { 0xDF, 49 }, // ß
+    { 0xE0, 31 }, // à
+    { 0xE1, 31 }, // á
+    { 0xE2, 31 }, // â
+    { 0xE3, 31 }, // ã
+    { 0xE4, 31 }, // ä
+    { 0xE5, 31 }, // å
+    { 0xE7, 33 }, // ç
+    { 0xF1, 37 }, // ñ
+    { 0xF2, 37 }, // ò
+    { 0xF3, 37 }, // ó
+    { 0xF4, 37 }, // ô
+    { 0xF5, 37 }, // õ
+    { 0xF6, 37 }, // ö
+    { 0xF8, 37 }, // ø
+    { 0xFE, 32 }, // þ
+    { 0x100, 10 }, // Ā
+    { 0x101, 31 }, // ā
+    { 0x102, 10 }, // Ă
+    { 0x103, 31 }, // ă
+    { 0x104, 10 }, // Ą
+    { 0x105, 31 }, // ą
+    { 0x106, 12 }, // Ć
+    { 0x107, 33 }, // ć
+    { 0x108, 12 }, // Ĉ
+    { 0x109, 33 }, // ĉ
+    { 0x10A, 12 }, // Ċ
+    { 0x10B, 33 }, // ċ
+    { 0x10C, 12 }, // Č
+    { 0x10D, 33 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 50 }, // ď
+    { 0x110, 13 }, // Đ
+    { 0x112, 14 }, // Ē
+    { 0x114, 14 }, // Ĕ
+    { 0x116, 14 }, // Ė
+    { 0x118, 14 }, // Ę
+    { 0x11A, 14 }, // Ě
+    { 0x11C, 16 }, // Ĝ
+    { 0x11E, 16 }, // Ğ
+    { 0x120, 16 }, // Ġ
+    { 0x122, 16 }, // Ģ
+    { 0x125, 35 }, // ĥ
+    { 0x127, 35 }, // ħ
+    { 0x132, 17 }, // Ĳ
+    { 0x134, 17 }, // Ĵ
+    { 0x136, 18 }, // Ķ
+    { 0x137, 36 }, // ķ
+    { 0x138, 36 }, // ĸ
+    { 0x139, 19 }, // Ĺ
+    { 0x13B, 19 }, // Ļ
+    { 0x13D, 19 }, // Ľ
+    { 0x13E, 50 }, // ľ
+    { 0x13F, 19 }, // Ŀ
+    { 0x141, 19 }, // Ł
+    { 0x144, 37 }, // ń
+    { 0x146, 37 }, // ņ
+    { 0x148, 37 }, // ň
+    { 0x149, 37 }, // ŉ
+    { 0x14B, 51 }, // ŋ
+    { 0x14C, 20 }, // Ō
+    { 0x14D, 37 }, // ō
+    { 0x14E, 20 }, // Ŏ
+    { 0x14F, 37 }, // ŏ
+    { 0x150, 20 }, // Ő
+    { 0x151, 37 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x154, 23 }, // Ŕ
+    { 0x155, 39 }, // ŕ
+    { 0x156, 23 }, // Ŗ
+    { 0x157, 39 }, // ŗ
+    { 0x158, 23 }, // Ř
+    { 0x159, 39 }, // ř
+    { 0x162, 24 }, // Ţ
+    { 0x163, 33 }, // ţ
+    { 0x164, 24 }, // Ť
+    { 0x165, 33 }, // ť
+    { 0x166, 24 }, // Ŧ
+    { 0x167, 33 }, // ŧ
+    { 0x168, 17 }, // Ũ
+    { 0x16A, 17 }, // Ū
+    { 0x16C, 17 }, // Ŭ
+    { 0x16E, 17 }, // Ů
+    { 0x170, 17 }, // Ű
+    { 0x172, 17 }, // Ų
+    { 0x174, 26 }, // Ŵ
+    { 0x175, 40 }, // ŵ
+    { 0x176, 28 }, // Ŷ
+    { 0x178, 28 }, // Ÿ
+    { 0x179, 29 }, // Ź
+    { 0x17A, 42 }, // ź
+    { 0x17B, 29 }, // Ż
+    { 0x17C, 42 }, // ż
+    { 0x17D, 29 }, // Ž
+    { 0x17E, 42 }, // ž
+    { 0x17F, 34 }, // ſ
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2018, 52 }, // ‘
+    { 0x201A, 5 }, // ‚
+    { 0x201C, 52 }, // “
+    { 0x201E, 5 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 8 }, // ‹
+    { 0x203A, 46 }, // ›
+    { 0xFB00, 34 }, // ﬀ
+};
+
+static const EpdKernClassEntry ubuntu_10_regularKernRightClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x29, 3 }, // )
+    { 0x2A, 4 }, // *
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 8 }, // ;
+    { 0x3F, 9 }, // ?
+    { 0x40, 2 }, // @
+    { 0x41, 10 }, // A
+    { 0x43, 11 }, // C
+    { 0x47, 11 }, // G
+    { 0x4A, 12 }, // J
+    { 0x4F, 11 }, // O
+    { 0x51, 11 }, // Q
+    { 0x53, 13 }, // S
+    { 0x54, 14 }, // T
+    { 0x55, 13 }, // U
+    { 0x56, 15 }, // V
+    { 0x57, 16 }, // W
+    { 0x58, 17 }, // X
+    { 0x59, 18 }, // Y
+    { 0x5A, 19 }, // Z
+    { 0x5C, 20 }, // <backslash>
+    { 0x5D, 21 }, // ]
+    { 0x61, 22 }, // a
+    { 0x63, 23 }, // c
+    { 0x64, 23 }, // d
+    { 0x65, 24 }, // e
+    { 0x67, 25 }, // g
+    { 0x6A, 26 }, // j
+    { 0x6D, 27 }, // m
+    { 0x6E, 27 }, // n
+    { 0x6F, 23 }, // o
+    { 0x70, 27 }, // p
+    { 0x71, 23 }, // q
+    { 0x72, 27 }, // r
+    { 0x73, 28 }, // s
+    { 0x75, 29 }, // u
+    { 0x76, 30 }, // v
+    { 0x77, 31 }, // w
+    { 0x78, 32 }, // x
+    { 0x79, 33 }, // y
+    { 0x7A, 29 }, // z
+    { 0x7B, 34 }, // {
+    { 0x7D, 35 }, // }
+    { 0xAB, 36 }, // «
+    { 0xBB, 8 }, // »
+    { 0xC0, 10 }, // À
+    { 0xC1, 10 }, // Á
+    { 0xC2, 10 }, // Â
+    { 0xC3, 10 }, // Ã
+    { 0xC4, 10 }, // Ä
+    { 0xC5, 10 }, // Å
+    { 0xC6, 37 }, // Æ
+    { 0xC7, 11 }, // Ç
+    { 0xD2, 11 }, // Ò
+    { 0xD3, 11 }, // Ó
+    { 0xD4, 11 }, // Ô
+    { 0xD5, 11 }, // Õ
+    { 0xD6, 11 }, // Ö
+    { 0xD8, 11 }, // Ø
+    { 0xD9, 13 }, // Ù
+    { 0xDA, 13 }, // Ú
+    { 0xDB, 13 }, // Û
+    { 0xDC, 13 }, // Ü
+    { 0xDD, 18 }, // Ý
+    { 0xE0, 22 }, // à
+    { 0xE1, 22 }, // á
+    { 0xE2, 22 }, // â
+    { 0xE3, 22 }, // ã
+    { 0xE4, 22 }, // ä
+    { 0xE5, 22 }, // å
+    { 0xE6, 22 }, // æ
+    { 0xE7, 23 }, // ç
+    { 0xE8, 24 }, // è
+    { 0xE9, 24 }, // é
+    { 0xEA, 24 }, // ê
+    { 0xEB, 24 }, // ë
+    { 0xEC, 38 }, // ì
+    { 0xEE, 20 }, // î
+    { 0xEF, 39 }, // ï
+    { 0xF0, 40 }, // ð
+    { 0xF1, 27 }, // ñ
+    { 0xF2, 23 }, // ò
+    { 0xF3, 23 }, // ó
+    { 0xF4, 23 }, // ô
+    { 0xF5, 23 }, // õ
+    { 0xF6, 23 }, // ö
+    { 0xF8, 23 }, // ø
+    { 0xF9, 29 }, // ù
+    { 0xFA, 29 }, // ú
+    { 0xFB, 29 }, // û
+    { 0xFC, 29 }, // ü
+    { 0xFD, 33 }, // ý
+    { 0xFF, 33 }, // ÿ
+    { 0x100, 10 }, // Ā
+    { 0x101, 22 }, // ā
+    { 0x102, 10 }, // Ă
+    { 0x103, 22 }, // ă
+    { 0x104, 10 }, // Ą
+    { 0x105, 22 }, // ą
+    { 0x106, 11 }, // Ć
+    { 0x107, 23 }, // ć
+    { 0x108, 11 }, // Ĉ
+    { 0x109, 23 }, // ĉ
+    { 0x10A, 11 }, // Ċ
+    { 0x10B, 23 }, // ċ
+    { 0x10C, 11 }, // Č
+    { 0x10D, 23 }, // č
+    { 0x10F, 23 }, // ď
+    { 0x111, 23 }, // đ
+    { 0x113, 24 }, // ē
+    { 0x115, 24 }, // ĕ
+    { 0x117, 24 }, // ė
+    { 0x119, 24 }, // ę
+    { 0x11B, 24 }, // ě
+    { 0x11C, 11 }, // Ĝ
+    { 0x11D, 25 }, // ĝ
+    { 0x11E, 11 }, // Ğ
+    { 0x11F, 25 }, // ğ
+    { 0x120, 11 }, // Ġ
+    { 0x121, 25 }, // ġ
+    { 0x122, 11 }, // Ģ
+    { 0x123, 25 }, // ģ
+    { 0x129, 39 }, // ĩ
+    { 0x12B, 41 }, // ī
+    { 0x12D, 42 }, // ĭ
+    { 0x134, 12 }, // Ĵ
+    { 0x135, 26 }, // ĵ
+    { 0x144, 27 }, // ń
+    { 0x146, 27 }, // ņ
+    { 0x148, 27 }, // ň
+    { 0x149, 27 }, // ŉ
+    { 0x14B, 43 }, // ŋ
+    { 0x14C, 11 }, // Ō
+    { 0x14D, 23 }, // ō
+    { 0x14E, 11 }, // Ŏ
+    { 0x14F, 23 }, // ŏ
+    { 0x150, 11 }, // Ő
+    { 0x151, 23 }, // ő
+    { 0x152, 11 }, // Œ
+    { 0x153, 23 }, // œ
+    { 0x155, 27 }, // ŕ
+    { 0x157, 27 }, // ŗ
+    { 0x159, 27 }, // ř
+    { 0x15A, 13 }, // Ś
+    { 0x15B, 28 }, // ś
+    { 0x15C, 13 }, // Ŝ
+    { 0x15D, 28 }, // ŝ
+    { 0x15E, 13 }, // Ş
+    { 0x15F, 28 }, // ş
+    { 0x160, 13 }, // Š
+    { 0x161, 28 }, // š
+    { 0x162, 14 }, // Ţ
+    { 0x164, 14 }, // Ť
+    { 0x166, 14 }, // Ŧ
+    { 0x168, 13 }, // Ũ
+    { 0x169, 29 }, // ũ
+    { 0x16A, 13 }, // Ū
+    { 0x16B, 29 }, // ū
+    { 0x16C, 13 }, // Ŭ
+    { 0x16D, 29 }, // ŭ
+    { 0x16E, 13 }, // Ů
+    { 0x16F, 29 }, // ů
+    { 0x170, 13 }, // Ű
+    { 0x171, 29 }, // ű
+    { 0x172, 13 }, // Ų
+    { 0x173, 29 }, // ų
+    { 0x174, 16 }, // Ŵ
+    { 0x175, 31 }, // ŵ
+    { 0x176, 18 }, // Ŷ
+    { 0x177, 33 }, // ŷ
+    { 0x178, 18 }, // Ÿ
+    { 0x179, 19 }, // Ź
+    { 0x17A, 29 }, // ź
+    { 0x17B, 19 }, // Ż
+    { 0x17C, 29 }, // ż
+    { 0x17D, 19 }, // Ž
+    { 0x17E, 29 }, // ž
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2018, 44 }, // ‘
+    { 0x2019, 45 }, // ’
+    { 0x201A, 46 }, // ‚
+    { 0x201C, 44 }, // “
+    { 0x201D, 45 }, // ”
+    { 0x201E, 46 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 36 }, // ‹
+    { 0x203A, 8 }, // ›
+};
+
+static const int8_t ubuntu_10_regularKernMatrix[2392] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, 0, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, -1, 1, 0, 0, 0, 0, 1, 0, 1, 0, -1, -1, 0, 1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 1,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -2,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 1, -1, 1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, -3, 0, -1, 0, 0, 0, 1, -1, 1, 0, -2, -2, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, -2, -2, 0,
+    0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, -1, -2, -2, 0, -1, -1, -2, 0, 0, 1, 0, 0, 1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, -2, -2, 0, 1, -2, 0, 0, -2, 0, 0, -1,
+    0, -1, 0, 0, -2, 0, -1, 0, 0, -1, 0, -2, 0, 1, 1, 0, 0, 1, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 1, -1, 1, 0, -1, 0, 0, -2,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, -1, -2, -1, 1, -2, -1, -2, 0, 1, 1, 0, 0, 1, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, -2, 0, 1, -2, 1, 0, -1, 0, 0, -2,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, -1,
+    -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1,
+    -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 2, 0, 2, 2, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair ubuntu_10_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData ubuntu_10_regular = {
     ubuntu_10_regularBitmaps,
     ubuntu_10_regularGlyphs,
     ubuntu_10_regularIntervals,
-    35,
+    36,
     24,
     20,
     -4,
     false,
+    ubuntu_10_regularKernLeftClasses,
+    188,
+    ubuntu_10_regularKernRightClasses,
+    195,
+    ubuntu_10_regularKernMatrix,
+    52,
+    46,
+    ubuntu_10_regularLigatures,
+    5,
 };
@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_12_boldBitmaps[18633] = {
+static const uint8_t ubuntu_12_boldBitmaps[18893] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDC, 0x07, 0x7F, 0xFF, 0x70, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF,
     0xF3, 0xFC, 0xEF, 0x38, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0x0F, 0x3C, 0xFF, 0xFE, 0xFF, 0xFE,
     0xFF, 0xFE, 0x1E, 0x78, 0x1E, 0x78, 0x3C, 0x78, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x3C, 0xF0,
@@ -1172,7 +1172,23 @@ static const uint8_t ubuntu_12_boldBitmaps[18633] = {
     0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x80, 0x78, 0x03, 0x00, 0x01, 0xF3, 0xFF, 0xFF, 0xFF,
     0xFF, 0xFF, 0xEF, 0xC0, 0xFF, 0xEF, 0xFF, 0xFF, 0xF3, 0xFF, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
     0xFF, 0xF0, 0x78, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x78, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0xFC, 0x78, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xC7, 0xF1, 0xFE, 0x7F, 0x9F, 0xF3,
+    0xFC, 0xF9, 0x3F, 0x6F, 0x81, 0xE0, 0x7C, 0x0F, 0x03, 0xFE, 0x7F, 0xDF, 0xF3, 0xFE, 0xFF, 0x9F,
+    0xF7, 0xC0, 0xF0, 0x3E, 0x07, 0x81, 0xF0, 0x3C, 0x0F, 0x81, 0xE0, 0x7C, 0x0F, 0x03, 0xE0, 0x78,
+    0x1F, 0x03, 0xC0, 0xF8, 0x1E, 0x07, 0xC0, 0xF0, 0x3E, 0x07, 0x80, 0x1F, 0xDE, 0x3F, 0xDF, 0x7F,
+    0x9F, 0x7C, 0x9E, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0x9E, 0xFF, 0x9E, 0xFF, 0x9E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8,
+    0x1E, 0x1F, 0xDE, 0x0F, 0xF7, 0x87, 0xF9, 0xE1, 0xF2, 0x78, 0xF8, 0x1E, 0x3E, 0x07, 0x8F, 0xF9,
+    0xE3, 0xFE, 0x78, 0xFF, 0x9E, 0x3E, 0x07, 0x8F, 0x81, 0xE3, 0xE0, 0x78, 0xF8, 0x1E, 0x3E, 0x07,
+    0x8F, 0x81, 0xE3, 0xE0, 0x7C, 0xF8, 0x1F, 0xBE, 0x03, 0xEF, 0x80, 0x78, 0x1F, 0xC7, 0xF3, 0xCF,
+    0xF3, 0xFD, 0xF7, 0xFC, 0xFF, 0x7D, 0xF2, 0x7E, 0x8F, 0xF8, 0x1E, 0x00, 0x3E, 0x07, 0x80, 0x0F,
+    0xF9, 0xFF, 0x7F, 0xFE, 0x7F, 0xDF, 0xFF, 0x9F, 0xF7, 0xFE, 0x07, 0x81, 0xFF, 0x81, 0xE0, 0x7F,
+    0xE0, 0x78, 0x1F, 0xF8, 0x1E, 0x07, 0xFE, 0x07, 0x81, 0xFF, 0x81, 0xE0, 0x7F, 0xE0, 0x78, 0x1F,
+    0xF8, 0x1E, 0x07, 0xFE, 0x07, 0x81, 0xFF, 0x81, 0xE0, 0x7C, 0x1F, 0xC7, 0xF3, 0xC3, 0xFC, 0xFF,
+    0x7C, 0x7F, 0xCF, 0xF7, 0xC7, 0xC9, 0xFA, 0x7C, 0xF8, 0x1E, 0x07, 0xCF, 0x81, 0xE0, 0x7C, 0xFF,
+    0x9F, 0xF7, 0xCF, 0xF9, 0xFF, 0x7C, 0xFF, 0x9F, 0xF7, 0xCF, 0x81, 0xE0, 0x7C, 0xF8, 0x1E, 0x07,
+    0xCF, 0x81, 0xE0, 0x7C, 0xF8, 0x1E, 0x07, 0xCF, 0x81, 0xE0, 0x7C, 0xF8, 0x1E, 0x07, 0xCF, 0x81,
+    0xE0, 0x7E, 0xF8, 0x1E, 0x03, 0xFF, 0x81, 0xE0, 0x3F, 0xF8, 0x1E, 0x01, 0xE0,
 };
 
 static const EpdGlyph ubuntu_12_boldGlyphs[] = {
@@ -1750,6 +1766,11 @@ static const EpdGlyph ubuntu_12_boldGlyphs[] = {
     { 12, 14, 14, 1, 14, 21, 18566 }, // ≠
     { 12, 15, 14, 1, 15, 23, 18587 }, // ≤
     { 12, 15, 14, 1, 15, 23, 18610 }, // ≥
+    { 21, 19, 21, 1, 19, 50, 18633 }, // ﬀ
+    { 16, 19, 18, 1, 19, 38, 18683 }, // ﬁ
+    { 18, 19, 18, 1, 19, 43, 18721 }, // ﬂ
+    { 26, 19, 28, 1, 19, 62, 18764 }, // ﬃ
+    { 28, 19, 29, 1, 19, 67, 18826 }, // ﬄ
 };
 
 static const EpdUnicodeInterval ubuntu_12_boldIntervals[] = {
@@ -1788,15 +1809,629 @@ static const EpdUnicodeInterval ubuntu_12_boldIntervals[] = {
     { 0x2248, 0x2248, 0x23A },
     { 0x2260, 0x2260, 0x23B },
     { 0x2264, 0x2265, 0x23C },
+    { 0xFB00, 0xFB04, 0x23E },
+};
+
+static const EpdKernClassEntry ubuntu_12_boldKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x29, 4 }, // )
+    { 0x2A, 5 }, // *
+    { 0x2C, 6 }, // ,
+    { 0x2D, 7 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 8 }, // /
+    { 0x3A, 9 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x40, 10 }, // @
+    { 0x41, 11 }, // A
+    { 0x42, 12 }, // B
+    { 0x43, 13 }, // C
+    { 0x44, 14 }, // D
+    { 0x45, 15 }, // E
+    { 0x46, 16 }, // F
+    { 0x47, 17 }, // G
+    { 0x4A, 18 }, // J
+    { 0x4B, 19 }, // K
+    { 0x4C, 20 }, // L
+    { 0x4F, 14 }, // O
+    { 0x50, 21 }, // P
+    { 0x51, 14 }, // Q
+    { 0x52, 22 }, // R
+    { 0x53, 23 }, // S
+    { 0x54, 24 }, // T
+    { 0x55, 25 }, // U
+    { 0x56, 26 }, // V
+    { 0x57, 27 }, // W
+    { 0x58, 28 }, // X
+    { 0x59, 29 }, // Y
+    { 0x5A, 30 }, // Z
+    { 0x5B, 31 }, // [
+    { 0x5C, 32 }, // <backslash>
+    { 0x5D, 33 }, // ]
+    { 0x61, 34 }, // a
+    { 0x62, 35 }, // b
+    { 0x63, 36 }, // c
+    { 0x64, 37 }, // d
+    { 0x66, 38 }, // f
+    { 0x67, 39 }, // g
+    { 0x68, 40 }, // h
+    { 0x69, 41 }, // i
+    { 0x6A, 42 }, // j
+    { 0x6B, 43 }, // k
+    { 0x6C, 44 }, // l
+    { 0x6D, 40 }, // m
+    { 0x6E, 40 }, // n
+    { 0x6F, 45 }, // o
+    { 0x70, 35 }, // p
+    { 0x71, 46 }, // q
+    { 0x72, 47 }, // r
+    { 0x73, 48 }, // s
+    { 0x74, 49 }, // t
+    { 0x75, 41 }, // u
+    { 0x76, 50 }, // v
+    { 0x77, 51 }, // w
+    { 0x78, 52 }, // x
+    { 0x79, 50 }, // y
+    { 0x7A, 53 }, // z
+    { 0x7B, 54 }, // {
+    { 0xA1, 55 }, // ¡
+    { 0xAB, 56 }, // «
+    { 0xBB, 57 }, // »
+    { 0xBF, 58 }, // ¿
+    { 0xC0, 11 }, // À
+    { 0xC1, 11 }, // Á
+    { 0xC2, 11 }, // Â
+    { 0xC3, 11 }, // Ã
+    { 0xC4, 11 }, // Ä
+    { 0xC5, 11 }, // Å
+    { 0xC6, 15 }, // Æ
+    { 0xC7, 13 }, // Ç
+    { 0xC8, 15 }, // È
+    { 0xC9, 15 }, // É
+    { 0xCA, 15 }, // Ê
+    { 0xCB, 15 }, // Ë
+    { 0xD0, 14 }, // Ð
+    { 0xD2, 14 }, // Ò
+    { 0xD3, 14 }, // Ó
+    { 0xD4, 14 }, // Ô
+    { 0xD5, 14 }, // Õ
+    { 0xD6, 14 }, // Ö
+    { 0xD8, 14 }, // Ø
+    { 0xD9, 25 }, // Ù
+    { 0xDA, 25 }, // Ú
+    { 0xDB, 25 }, // Û
+    { 0xDC, 25 }, // Ü
+    { 0xDD, 29 }, // Ý
+    { 0xDE, 59 }, // Þ
+    { 0xDF, 60 }, // ß
+    { 0xE0, 34 }, // à
+    { 0xE1, 34 }, // á
+    { 0xE2, 34 }, // â
+    { 0xE3, 34 }, // ã
+    { 0xE4, 34 }, // ä
+    { 0xE5, 34 }, // å
+    { 0xE7, 36 }, // ç
+    { 0xEC, 41 }, // ì
+    { 0xED, 41 }, // í
+    { 0xEE, 41 }, // î
+    { 0xEF, 41 }, // ï
+    { 0xF0, 61 }, // ð
+    { 0xF1, 40 }, // ñ
+    { 0xF2, 45 }, // ò
+    { 0xF3, 45 }, // ó
+    { 0xF4, 45 }, // ô
+    { 0xF5, 45 }, // õ
+    { 0xF6, 45 }, // ö
+    { 0xF8, 45 }, // ø
+    { 0xF9, 41 }, // ù
+    { 0xFA, 41 }, // ú
+    { 0xFB, 41 }, // û
+    { 0xFC, 41 }, // ü
+    { 0xFD, 50 }, // ý
+    { 0xFE, 62 }, // þ
+    { 0xFF, 50 }, // ÿ
+    { 0x100, 11 }, // Ā
+    { 0x101, 34 }, // ā
+    { 0x102, 11 }, // Ă
+    { 0x103, 34 }, // ă
+    { 0x104, 11 }, // Ą
+    { 0x105, 34 }, // ą
+    { 0x106, 13 }, // Ć
+    { 0x107, 36 }, // ć
+    { 0x108, 13 }, // Ĉ
+    { 0x109, 36 }, // ĉ
+    { 0x10A, 13 }, // Ċ
+    { 0x10B, 36 }, // ċ
+    { 0x10C, 13 }, // Č
+    { 0x10D, 36 }, // č
+    { 0x10E, 14 }, // Ď
+    { 0x10F, 63 }, // ď
+    { 0x110, 14 }, // Đ
+    { 0x111, 37 }, // đ
+    { 0x112, 15 }, // Ē
+    { 0x114, 15 }, // Ĕ
+    { 0x116, 15 }, // Ė
+    { 0x118, 15 }, // Ę
+    { 0x11A, 15 }, // Ě
+    { 0x11C, 17 }, // Ĝ
+    { 0x11D, 39 }, // ĝ
+    { 0x11E, 17 }, // Ğ
+    { 0x11F, 39 }, // ğ
+    { 0x120, 17 }, // Ġ
+    { 0x121, 39 }, // ġ
+    { 0x122, 17 }, // Ģ
+    { 0x123, 39 }, // ģ
+    { 0x125, 40 }, // ĥ
+    { 0x127, 40 }, // ħ
+    { 0x129, 41 }, // ĩ
+    { 0x12B, 41 }, // ī
+    { 0x12D, 41 }, // ĭ
+    { 0x12F, 41 }, // į
+    { 0x131, 41 }, // ı
+    { 0x132, 18 }, // Ĳ
+    { 0x133, 42 }, // ĳ
+    { 0x134, 18 }, // Ĵ
+    { 0x135, 42 }, // ĵ
+    { 0x136, 19 }, // Ķ
+    { 0x137, 43 }, // ķ
+    { 0x138, 43 }, // ĸ
+    { 0x139, 20 }, // Ĺ
+    { 0x13A, 44 }, // ĺ
+    { 0x13B, 20 }, // Ļ
+    { 0x13C, 44 }, // ļ
+    { 0x13D, 20 }, // Ľ
+    { 0x13E, 63 }, // ľ
+    { 0x13F, 20 }, // Ŀ
+    { 0x140, 44 }, // ŀ
+    { 0x141, 20 }, // Ł
+    { 0x142, 44 }, // ł
+    { 0x144, 40 }, // ń
+    { 0x146, 40 }, // ņ
+    { 0x148, 40 }, // ň
+    { 0x149, 40 }, // ŉ
+    { 0x14B, 64 }, // ŋ
+    { 0x14C, 14 }, // Ō
+    { 0x14D, 45 }, // ō
+    { 0x14E, 14 }, // Ŏ
+    { 0x14F, 45 }, // ŏ
+    { 0x150, 14 }, // Ő
+    { 0x151, 45 }, // ő
+    { 0x152, 15 }, // Œ
+    { 0x154, 22 }, // Ŕ
+    { 0x155, 47 }, // ŕ
+    { 0x156, 22 }, // Ŗ
+    { 0x157, 47 }, // ŗ
+    { 0x158, 22 }, // Ř
+    { 0x159, 47 }, // ř
+    { 0x15A, 23 }, // Ś
+    { 0x15B, 48 }, // ś
+    { 0x15C, 23 }, // Ŝ
+    { 0x15D, 48 }, // ŝ
+    { 0x15E, 23 }, // Ş
+    { 0x15F, 48 }, // ş
+    { 0x160, 23 }, // Š
+    { 0x161, 48 }, // š
+    { 0x162, 24 }, // Ţ
+    { 0x163, 49 }, // ţ
+    { 0x164, 24 }, // Ť
+    { 0x165, 49 }, // ť
+    { 0x166, 24 }, // Ŧ
+    { 0x167, 49 }, // ŧ
+    { 0x168, 25 }, // Ũ
+    { 0x169, 41 }, // ũ
+    { 0x16A, 25 }, // Ū
+    { 0x16B, 41 }, // ū
+    { 0x16C, 25 }, // Ŭ
+    { 0x16D, 41 }, // ŭ
+    { 0x16E, 25 }, // Ů
+    { 0x16F, 41 }, // ů
+    { 0x170, 25 }, // Ű
+    { 0x171, 41 }, // ű
+    { 0x172, 25 }, // Ų
+    { 0x173, 41 }, // ų
+    { 0x174, 27 }, // Ŵ
+    { 0x175, 51 }, // ŵ
+    { 0x176, 29 }, // Ŷ
+    { 0x177, 50 }, // ŷ
+    { 0x178, 29 }, // Ÿ
+    { 0x179, 30 }, // Ź
+    { 0x17A, 53 }, // ź
+    { 0x17B, 30 }, // Ż
+    { 0x17C, 53 }, // ż
+    { 0x17D, 30 }, // Ž
+    { 0x17E, 53 }, // ž
+    { 0x17F, 38 }, // ſ
+    { 0x2013, 7 }, // –
+    { 0x2014, 7 }, // —
+    { 0x2018, 65 }, // ‘
+    { 0x2019, 66 }, // ’
+    { 0x201A, 67 }, // ‚
+    { 0x201C, 65 }, // “
+    { 0x201D, 66 }, // ”
+    { 0x201E, 67 }, // „
+    { 0x2026, 6 }, // …
+    { 0x2039, 56 }, // ‹
+    { 0x203A, 57 }, // ›
+    { 0xFB00, 38 }, // ﬀ
+    { 0xFB01, 41 }, // ﬁ
+    { 0xFB02, 44 }, // ﬂ
+    { 0xFB03, 41 }, // ﬃ
+    { 0xFB04, 44 }, // ﬄ
+};
+
+static const EpdKernClassEntry ubuntu_12_boldKernRightClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x26, 2 }, // &
+    { 0x27, 1 }, // '
+    { 0x28, 3 }, // (
+    { 0x29, 4 }, // )
+    { 0x2A, 5 }, // *
+    { 0x2C, 6 }, // ,
+    { 0x2D, 7 }, // -
+    { 0x2E, 6 }, // .
+    { 0x2F, 8 }, // /
+    { 0x3A, 9 }, // :
+    { 0x3B, 9 }, // ;
+    { 0x3F, 10 }, // ?
+    { 0x40, 11 }, // @
+    { 0x41, 12 }, // A
+    { 0x42, 13 }, // B
+    { 0x43, 14 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 13 }, // E
+    { 0x46, 13 }, // F
+    { 0x47, 14 }, // G
+    { 0x48, 13 }, // H
+    { 0x49, 13 }, // I
+    { 0x4A, 15 }, // J
+    { 0x4B, 13 }, // K
+    { 0x4C, 13 }, // L
+    { 0x4D, 16 }, // M
+    { 0x4E, 13 }, // N
+    { 0x4F, 14 }, // O
+    { 0x50, 13 }, // P
+    { 0x51, 14 }, // Q
+    { 0x52, 13 }, // R
+    { 0x53, 17 }, // S
+    { 0x54, 18 }, // T
+    { 0x55, 19 }, // U
+    { 0x56, 20 }, // V
+    { 0x57, 21 }, // W
+    { 0x58, 22 }, // X
+    { 0x59, 23 }, // Y
+    { 0x5A, 24 }, // Z
+    { 0x5C, 25 }, // <backslash>
+    { 0x5D, 26 }, // ]
+    { 0x61, 27 }, // a
+    { 0x62, 17 }, // b
+    { 0x63, 28 }, // c
+    { 0x64, 28 }, // d
+    { 0x65, 28 }, // e
+    { 0x66, 29 }, // f
+    { 0x67, 28 }, // g
+    { 0x68, 30 }, // h
+    { 0x69, 17 }, // i
+    { 0x6A, 31 }, // j
+    { 0x6B, 30 }, // k
+    { 0x6C, 30 }, // l
+    { 0x6D, 32 }, // m
+    { 0x6E, 32 }, // n
+    { 0x6F, 28 }, // o
+    { 0x70, 32 }, // p
+    { 0x71, 28 }, // q
+    { 0x72, 32 }, // r
+    { 0x73, 33 }, // s
+    { 0x74, 17 }, // t
+    { 0x75, 34 }, // u
+    { 0x76, 35 }, // v
+    { 0x77, 36 }, // w
+    { 0x78, 37 }, // x
+    { 0x79, 38 }, // y
+    { 0x7A, 39 }, // z
+    { 0x7D, 40 }, // }
+    { 0xAB, 41 }, // «
+    { 0xBB, 9 }, // »
+    { 0xC0, 12 }, // À
+    { 0xC1, 12 }, // Á
+    { 0xC2, 12 }, // Â
+    { 0xC3, 12 }, // Ã
+    { 0xC4, 12 }, // Ä
+    { 0xC5, 12 }, // Å
+    { 0xC6, 42 }, // Æ
+    { 0xC7, 14 }, // Ç
+    { 0xC8, 13 }, // È
+    { 0xC9, 13 }, // É
+    { 0xCA, 13 }, // Ê
+    { 0xCB, 13 }, // Ë
+    { 0xCC, 13 }, // Ì
+    { 0xCD, 13 }, // Í
+    { 0xCE, 13 }, // Î
+    { 0xCF, 13 }, // Ï
+    { 0xD0, 13 }, // Ð
+    { 0xD1, 13 }, // Ñ
+    { 0xD2, 14 }, // Ò
+    { 0xD3, 14 }, // Ó
+    { 0xD4, 14 }, // Ô
+    { 0xD5, 14 }, // Õ
+    { 0xD6, 14 }, // Ö
+    { 0xD8, 14 }, // Ø
+    { 0xD9, 19 }, // Ù
+    { 0xDA, 19 }, // Ú
+    { 0xDB, 19 }, // Û
+    { 0xDC, 19 }, // Ü
+    { 0xDD, 23 }, // Ý
+    { 0xDF, 17 }, // ß
+    { 0xE0, 27 }, // à
+    { 0xE1, 27 }, // á
+    { 0xE2, 27 }, // â
+    { 0xE3, 27 }, // ã
+    { 0xE4, 43 }, // ä
+    { 0xE5, 27 }, // å
+    { 0xE6, 27 }, // æ
+    { 0xE7, 28 }, // ç
+    { 0xE8, 28 }, // è
+    { 0xE9, 28 }, // é
+    { 0xEA, 28 }, // ê
+    { 0xEB, 28 }, // ë
+    { 0xEC, 30 }, // ì
+    { 0xED, 17 }, // í
+    { 0xEE, 44 }, // î
+    { 0xEF, 45 }, // ï
+    { 0xF0, 46 }, // ð
+    { 0xF1, 32 }, // ñ
+    { 0xF2, 28 }, // ò
+    { 0xF3, 28 }, // ó
+    { 0xF4, 28 }, // ô
+    { 0xF5, 28 }, // õ
+    { 0xF6, 28 }, // ö
+    { 0xF8, 28 }, // ø
+    { 0xF9, 34 }, // ù
+    { 0xFA, 34 }, // ú
+    { 0xFB, 34 }, // û
+    { 0xFC, 34 }, // ü
+    { 0xFD, 38 }, // ý
+    { 0xFF, 38 }, // ÿ
+    { 0x100, 12 }, // Ā
+    { 0x101, 27 }, // ā
+    { 0x102, 12 }, // Ă
+    { 0x103, 27 }, // ă
+    { 0x104, 12 }, // Ą
+    { 0x105, 27 }, // ą
+    { 0x106, 14 }, // Ć
+    { 0x107, 28 }, // ć
+    { 0x108, 14 }, // Ĉ
+    { 0x109, 28 }, // ĉ
+    { 0x10A, 14 }, // Ċ
+    { 0x10B, 28 }, // ċ
+    { 0x10C, 14 }, // Č
+    { 0x10D, 28 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 28 }, // ď
+    { 0x111, 28 }, // đ
+    { 0x112, 13 }, // Ē
+    { 0x113, 28 }, // ē
+    { 0x114, 13 }, // Ĕ
+    { 0x115, 28 }, // ĕ
+    { 0x116, 13 }, // Ė
+    { 0x117, 28 }, // ė
+    { 0x118, 13 }, // Ę
+    { 0x119, 28 }, // ę
+    { 0x11A, 13 }, // Ě
+    { 0x11B, 28 }, // ě
+    { 0x11C, 14 }, // Ĝ
+    { 0x11D, 28 }, // ĝ
+    { 0x11E, 14 }, // Ğ
+    { 0x11F, 28 }, // ğ
+    { 0x120, 14 }, // Ġ
+    { 0x121, 28 }, // ġ
+    { 0x122, 14 }, // Ģ
+    { 0x123, 28 }, // ģ
+    { 0x124, 13 }, // Ĥ
+    { 0x125, 30 }, // ĥ
+    { 0x126, 13 }, // Ħ
+    { 0x127, 30 }, // ħ
+    { 0x128, 13 }, // Ĩ
+    { 0x129, 45 }, // ĩ
+    { 0x12A, 13 }, // Ī
+    { 0x12B, 47 }, // ī
+    { 0x12C, 13 }, // Ĭ
+    { 0x12D, 48 }, // ĭ
+    { 0x12E, 13 }, // Į
+    { 0x12F, 17 }, // į
+    { 0x130, 13 }, // İ
+    { 0x131, 17 }, // ı
+    { 0x132, 13 }, // Ĳ
+    { 0x133, 17 }, // ĳ
+    { 0x134, 15 }, // Ĵ
+    { 0x135, 31 }, // ĵ
+    { 0x136, 13 }, // Ķ
+    { 0x137, 30 }, // ķ
+    { 0x139, 13 }, // Ĺ
+    { 0x13A, 30 }, // ĺ
+    { 0x13B, 13 }, // Ļ
+    { 0x13C, 30 }, // ļ
+    { 0x13D, 13 }, // Ľ
+    { 0x13E, 30 }, // ľ
+    { 0x13F, 13 }, // Ŀ
+    { 0x140, 30 }, // ŀ
+    { 0x141, 13 }, // Ł
+    { 0x142, 30 }, // ł
+    { 0x143, 13 }, // Ń
+    { 0x144, 32 }, // ń
+    { 0x145, 13 }, // Ņ
+    { 0x146, 32 }, // ņ
+    { 0x147, 13 }, // Ň
+    { 0x148, 32 }, // ň
+    { 0x149, 32 }, // ŉ
+    { 0x14A, 49 }, // Ŋ
+    { 0x14B, 50 }, // ŋ
+    { 0x14C, 14 }, // Ō
+    { 0x14D, 28 }, // ō
+    { 0x14E, 14 }, // Ŏ
+    { 0x14F, 28 }, // ŏ
+    { 0x150, 14 }, // Ő
+    { 0x151, 28 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x153, 28 }, // œ
+    { 0x154, 13 }, // Ŕ
+    { 0x155, 32 }, // ŕ
+    { 0x156, 13 }, // Ŗ
+    { 0x157, 32 }, // ŗ
+    { 0x158, 13 }, // Ř
+    { 0x159, 32 }, // ř
+    { 0x15A, 17 }, // Ś
+    { 0x15B, 33 }, // ś
+    { 0x15C, 17 }, // Ŝ
+    { 0x15D, 33 }, // ŝ
+    { 0x15E, 17 }, // Ş
+    { 0x15F, 33 }, // ş
+    { 0x160, 17 }, // Š
+    { 0x161, 33 }, // š
+    { 0x162, 18 }, // Ţ
+    { 0x163, 17 }, // ţ
+    { 0x164, 18 }, // Ť
+    { 0x165, 17 }, // ť
+    { 0x166, 18 }, // Ŧ
+    { 0x167, 17 }, // ŧ
+    { 0x168, 19 }, // Ũ
+    { 0x169, 34 }, // ũ
+    { 0x16A, 19 }, // Ū
+    { 0x16B, 34 }, // ū
+    { 0x16C, 19 }, // Ŭ
+    { 0x16D, 34 }, // ŭ
+    { 0x16E, 19 }, // Ů
+    { 0x16F, 34 }, // ů
+    { 0x170, 19 }, // Ű
+    { 0x171, 34 }, // ű
+    { 0x172, 19 }, // Ų
+    { 0x173, 34 }, // ų
+    { 0x174, 21 }, // Ŵ
+    { 0x175, 36 }, // ŵ
+    { 0x176, 23 }, // Ŷ
+    { 0x177, 38 }, // ŷ
+    { 0x178, 23 }, // Ÿ
+    { 0x179, 24 }, // Ź
+    { 0x17A, 39 }, // ź
+    { 0x17B, 24 }, // Ż
+    { 0x17C, 39 }, // ż
+    { 0x17D, 24 }, // Ž
+    { 0x17E, 39 }, // ž
+    { 0x17F, 29 }, // ſ
+    { 0x2013, 7 }, // –
+    { 0x2014, 7 }, // —
+    { 0x2018, 51 }, // ‘
+    { 0x2019, 52 }, // ’
+    { 0x201A, 53 }, // ‚
+    { 0x201C, 51 }, // “
+    { 0x201D, 52 }, // ”
+    { 0x201E, 53 }, // „
+    { 0x2026, 6 }, // …
+    { 0x2039, 41 }, // ‹
+    { 0x203A, 9 }, // ›
+    { 0xFB00, 29 }, // ﬀ
+    { 0xFB01, 29 }, // ﬁ
+    { 0xFB02, 29 }, // ﬂ
+    { 0xFB03, 29 }, // ﬃ
+    { 0xFB04, 29 }, // ﬄ
+};
+
+static const int8_t ubuntu_12_boldKernMatrix[3551] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 0, 0, 0, -1, -1, 0, 0, 2, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, -1, -2, -1, 1, -2, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -2, 0, 0, 1, 0, 1, 1, 1, 1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, -2, 1, 0, 1, 0, -1, 0, 1, 0, -1, 1, 0, 0, -2, 0, -2, -1, 1, -2, 1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 1,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1, 0, -2, 0, -2, 0, 1, 0, -1, 0, 0, -2, 0, 0, 1, 0, 1, 1, 0, 1, 0, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, -2,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, -1, 1, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 1, -1, 1, 0, -1, 1, 0, 0, 1, -1, 1, 0, 0, 0, 0, 0, 1,
+    -2, 0, 0, 0, -3, 1, 0, 0, 1, -1, 0, 1, 0, 0, 1, 0, 0, -2, 0, -2, -1, 1, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 1,
+    0, 0, 0, 0, 0, -3, 0, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 1, 1, -2,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -2, -1, -2, -2, 1, -1, -2, 0, -1, -2, 0, 0, 1, 0, 1, 1, 1, 1, 0, 1, 1, -2, -2, 0, 0, 0, -2, -2, -2, -2, -2, -2, -2, -2, 0, -2, -3, -2, 1, 1, -2, 1, 1, 0, -1, 1, 0, -1,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, -1, -1, 1, 0, -2, -1, -2, 0, 1, -1, -2, 0, -1, -2, 0, 0, 1, 0, 1, 1, 1, 1, 0, 1, 1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -4, -1, 0, 1, -2, 1, 1, 0, 0, 1, 1, -2,
+    0, 0, 0, 1, 0, -1, 0, -2, 0, 1, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 1, 1, 1, 0, 1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, -1, 0, 0, 0, 0, 1, 1, -1,
+    0, 0, 0, 1, -1, 1, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 1, -1, 0, 0, -1, 1, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1,
+    0, -1, -1, 1, 0, -2, -2, -2, -1, 1, -1, -2, 0, -1, -2, 0, 0, 1, 0, 1, 1, 1, 1, 0, 1, 1, -2, -2, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, -1, 0, -2, -4, -1, 0, 1, -2, 1, 0, 0, -1, 1, 1, -2,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 1, 1, 1, 1, 0, 0, 2, -1, -1, 0, 0, 2, -1, -1, -1, -1, -1, -1, 1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -2, -1, -3, -2, 0, -3, 0, 0, 0, -1, -1, 0, 0, 4, 0, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, -1, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, -2, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1,
+    0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, -1, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -1, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -3, -1, -2, -1, -2, -2, -1, 0, 0, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, -2, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 2, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, -1, 0, 1, 0, 0, -1, 0, 1, 1, 1, 1, 1, 2, 0, 0, 0, 2, 3, 0, 2, 2, 0, 0, 0, 1, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -3, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, -2, -2, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, -1, 0, 0, -3, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -2, 0, -3, -2, 1, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 1, -1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair ubuntu_12_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData ubuntu_12_bold = {
     ubuntu_12_boldBitmaps,
     ubuntu_12_boldGlyphs,
     ubuntu_12_boldIntervals,
-    35,
+    36,
     29,
     24,
     -5,
     false,
+    ubuntu_12_boldKernLeftClasses,
+    247,
+    ubuntu_12_boldKernRightClasses,
+    273,
+    ubuntu_12_boldKernMatrix,
+    67,
+    53,
+    ubuntu_12_boldLigatures,
+    5,
 };
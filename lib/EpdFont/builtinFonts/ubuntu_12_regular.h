@@ -7,7 +7,7 @@
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t ubuntu_12_regularBitmaps[16913] = {
+static const uint8_t ubuntu_12_regularBitmaps[17133] = {
     0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE0, 0x01, 0xDE, 0x70, 0xF7, 0xF7, 0xF7, 0x67, 0x67,
     0x67, 0x0E, 0x18, 0x1C, 0x70, 0x38, 0xE0, 0x71, 0xC0, 0xC3, 0x9F, 0xFF, 0xFF, 0xFF, 0x8E, 0x38,
     0x1C, 0x70, 0x30, 0xE3, 0xFF, 0xFF, 0xFF, 0xF3, 0x8E, 0x07, 0x1C, 0x0E, 0x38, 0x38, 0x60, 0x71,
@@ -1065,7 +1065,20 @@ static const uint8_t ubuntu_12_regularBitmaps[16913] = {
     0x80, 0x30, 0x00, 0x00, 0x70, 0x1F, 0x0F, 0xE3, 0xF8, 0xFC, 0x0F, 0x00, 0xFC, 0x03, 0xF8, 0x0F,
     0xE0, 0x1F, 0x00, 0x70, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0xE0, 0x0F, 0x80, 0x7F, 0x00, 0xFC,
     0x03, 0xF0, 0x0F, 0x03, 0xF0, 0xFC, 0x7F, 0x0F, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0,
+    0xF0, 0x3F, 0x1F, 0xDF, 0xCF, 0xFF, 0x33, 0xCB, 0x80, 0xE0, 0xE0, 0x78, 0x38, 0x1C, 0x0F, 0xF7,
+    0xFB, 0xFD, 0xFE, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+    0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x00, 0x3F, 0x03, 0xFB, 0xFC,
+    0x9F, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0xFD, 0xDF, 0xEE, 0xE0, 0x77, 0x03, 0xB8, 0x1D, 0xC0, 0xEE,
+    0x07, 0x70, 0x3B, 0x81, 0xDC, 0x0E, 0xE0, 0x77, 0x03, 0xB8, 0x1C, 0x3F, 0x71, 0xFD, 0xCF, 0x27,
+    0x38, 0x1C, 0xE0, 0x73, 0x81, 0xCF, 0xF7, 0x3F, 0xDC, 0xE0, 0x73, 0x81, 0xCE, 0x07, 0x38, 0x1C,
+    0xE0, 0x73, 0x81, 0xCE, 0x07, 0x38, 0x1C, 0xE0, 0x7B, 0x80, 0xFE, 0x01, 0xC0, 0x3F, 0x1F, 0x80,
+    0xFE, 0x7F, 0x3B, 0xCC, 0xF2, 0x77, 0x01, 0xC0, 0x0E, 0x07, 0x80, 0x1C, 0x0E, 0x00, 0x3F, 0xDF,
+    0xE7, 0x7F, 0xBF, 0xCE, 0xE0, 0x70, 0x1D, 0xC0, 0xE0, 0x3B, 0x81, 0xC0, 0x77, 0x03, 0x80, 0xEE,
+    0x07, 0x01, 0xDC, 0x0E, 0x03, 0xB8, 0x1C, 0x07, 0x70, 0x38, 0x0E, 0xE0, 0x70, 0x1D, 0xC0, 0xE0,
+    0x3B, 0x81, 0xC0, 0x70, 0x3F, 0x1F, 0x9C, 0x7F, 0x3F, 0x9C, 0xF3, 0x3C, 0x9C, 0xE0, 0x38, 0x1C,
+    0xE0, 0x78, 0x1C, 0xE0, 0x70, 0x1C, 0xFF, 0x7F, 0x9C, 0xFF, 0x7F, 0x9C, 0xE0, 0x70, 0x1C, 0xE0,
+    0x70, 0x1C, 0xE0, 0x70, 0x1C, 0xE0, 0x70, 0x1C, 0xE0, 0x70, 0x1C, 0xE0, 0x70, 0x1C, 0xE0, 0x70,
+    0x1C, 0xE0, 0x70, 0x1C, 0xE0, 0x70, 0x1E, 0xE0, 0x70, 0x0F, 0xE0, 0x70, 0x0F,
 };
 
 static const EpdGlyph ubuntu_12_regularGlyphs[] = {
@@ -1643,6 +1656,11 @@ static const EpdGlyph ubuntu_12_regularGlyphs[] = {
     { 12, 13, 14, 1, 14, 20, 16847 }, // ≠
     { 12, 15, 14, 1, 15, 23, 16867 }, // ≤
     { 12, 15, 14, 1, 15, 23, 16890 }, // ≥
+    { 18, 19, 19, 2, 19, 43, 16913 }, // ﬀ
+    { 13, 19, 16, 2, 19, 31, 16956 }, // ﬁ
+    { 14, 19, 17, 2, 19, 34, 16987 }, // ﬂ
+    { 23, 19, 26, 2, 19, 55, 17021 }, // ﬃ
+    { 24, 19, 26, 2, 19, 57, 17076 }, // ﬄ
 };
 
 static const EpdUnicodeInterval ubuntu_12_regularIntervals[] = {
@@ -1681,15 +1699,479 @@ static const EpdUnicodeInterval ubuntu_12_regularIntervals[] = {
     { 0x2248, 0x2248, 0x23A },
     { 0x2260, 0x2260, 0x23B },
     { 0x2264, 0x2265, 0x23C },
+    { 0xFB00, 0xFB04, 0x23E },
+};
+
+static const EpdKernClassEntry ubuntu_12_regularKernLeftClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x29, 3 }, // )
+    { 0x2A, 4 }, // *
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 8 }, // ;
+    { 0x40, 9 }, // @
+    { 0x41, 10 }, // A
+    { 0x42, 11 }, // B
+    { 0x43, 12 }, // C
+    { 0x44, 13 }, // D
+    { 0x45, 14 }, // E
+    { 0x46, 15 }, // F
+    { 0x47, 16 }, // G
+    { 0x4A, 17 }, // J
+    { 0x4B, 18 }, // K
+    { 0x4C, 19 }, // L
+    { 0x4F, 13 }, // O
+    { 0x50, 20 }, // P
+    { 0x51, 21 }, // Q
+    { 0x52, 22 }, // R
+    { 0x54, 23 }, // T
+    { 0x55, 24 }, // U
+    { 0x56, 25 }, // V
+    { 0x57, 26 }, // W
+    { 0x58, 27 }, // X
+    { 0x59, 28 }, // Y
+    { 0x5A, 29 }, // Z
+    { 0x5B, 30 }, // [
+    { 0x61, 31 }, // a
+    { 0x62, 32 }, // b
+    { 0x63, 33 }, // c
+    { 0x66, 34 }, // f
+    { 0x68, 35 }, // h
+    { 0x6B, 36 }, // k
+    { 0x6D, 35 }, // m
+    { 0x6E, 35 }, // n
+    { 0x6F, 32 }, // o
+    { 0x70, 32 }, // p
+    { 0x71, 37 }, // q
+    { 0x72, 38 }, // r
+    { 0x74, 33 }, // t
+    { 0x76, 39 }, // v
+    { 0x77, 39 }, // w
+    { 0x78, 40 }, // x
+    { 0x7A, 41 }, // z
+    { 0x7B, 42 }, // {
+    { 0x7D, 43 }, // }
+    { 0xA1, 44 }, // ¡
+    { 0xAB, 45 }, // «
+    { 0xBB, 46 }, // »
+    { 0xBF, 47 }, // ¿
+    { 0xC0, 10 }, // À
+    { 0xC1, 10 }, // Á
+    { 0xC2, 10 }, // Â
+    { 0xC3, 10 }, // Ã
+    { 0xC4, 10 }, // Ä
+    { 0xC5, 10 }, // Å
+    { 0xC6, 14 }, // Æ
+    { 0xC7, 12 }, // Ç
+    { 0xC8, 14 }, // È
+    { 0xC9, 14 }, // É
+    { 0xCA, 14 }, // Ê
+    { 0xCB, 14 }, // Ë
+    { 0xD0, 13 }, // Ð
+    { 0xD2, 13 }, // Ò
+    { 0xD3, 13 }, // Ó
+    { 0xD4, 13 }, // Ô
+    { 0xD5, 13 }, // Õ
+    { 0xD6, 13 }, // Ö
+    { 0xD8, 13 }, // Ø
+    { 0xD9, 24 }, // Ù
+    { 0xDA, 24 }, // Ú
+    { 0xDB, 24 }, // Û
+    { 0xDC, 24 }, // Ü
+    { 0xDD, 28 }, // Ý
+    { 0xDE, 48 }, // Þ
+    { 0xDF, 49 }, // ß
+    { 0xE0, 31 }, // à
+    { 0xE1, 31 }, // á
+    { 0xE2, 31 }, // â
+    { 0xE3, 31 }, // ã
+    { 0xE4, 31 }, // ä
+    { 0xE5, 31 }, // å
+    { 0xE7, 33 }, // ç
+    { 0xF0, 50 }, // ð
+    { 0xF1, 35 }, // ñ
+    { 0xF2, 32 }, // ò
+    { 0xF3, 32 }, // ó
+    { 0xF4, 32 }, // ô
+    { 0xF5, 32 }, // õ
+    { 0xF6, 32 }, // ö
+    { 0xF8, 32 }, // ø
+    { 0xFE, 32 }, // þ
+    { 0x100, 10 }, // Ā
+    { 0x101, 31 }, // ā
+    { 0x102, 10 }, // Ă
+    { 0x103, 31 }, // ă
+    { 0x104, 10 }, // Ą
+    { 0x105, 31 }, // ą
+    { 0x106, 12 }, // Ć
+    { 0x107, 33 }, // ć
+    { 0x108, 12 }, // Ĉ
+    { 0x109, 33 }, // ĉ
+    { 0x10A, 12 }, // Ċ
+    { 0x10B, 33 }, // ċ
+    { 0x10C, 12 }, // Č
+    { 0x10D, 33 }, // č
+    { 0x10E, 13 }, // Ď
+    { 0x10F, 51 }, // ď
+    { 0x110, 13 }, // Đ
+    { 0x112, 14 }, // Ē
+    { 0x114, 14 }, // Ĕ
+    { 0x116, 14 }, // Ė
+    { 0x118, 14 }, // Ę
+    { 0x11A, 14 }, // Ě
+    { 0x11C, 16 }, // Ĝ
+    { 0x11E, 16 }, // Ğ
+    { 0x120, 16 }, // Ġ
+    { 0x122, 16 }, // Ģ
+    { 0x125, 35 }, // ĥ
+    { 0x127, 35 }, // ħ
+    { 0x132, 17 }, // Ĳ
+    { 0x134, 17 }, // Ĵ
+    { 0x136, 18 }, // Ķ
+    { 0x137, 36 }, // ķ
+    { 0x138, 36 }, // ĸ
+    { 0x139, 19 }, // Ĺ
+    { 0x13B, 19 }, // Ļ
+    { 0x13D, 19 }, // Ľ
+    { 0x13E, 51 }, // ľ
+    { 0x13F, 19 }, // Ŀ
+    { 0x141, 19 }, // Ł
+    { 0x144, 35 }, // ń
+    { 0x146, 35 }, // ņ
+    { 0x148, 35 }, // ň
+    { 0x149, 35 }, // ŉ
+    { 0x14B, 52 }, // ŋ
+    { 0x14C, 13 }, // Ō
+    { 0x14D, 32 }, // ō
+    { 0x14E, 13 }, // Ŏ
+    { 0x14F, 32 }, // ŏ
+    { 0x150, 13 }, // Ő
+    { 0x151, 32 }, // ő
+    { 0x152, 14 }, // Œ
+    { 0x154, 22 }, // Ŕ
+    { 0x155, 38 }, // ŕ
+    { 0x156, 22 }, // Ŗ
+    { 0x157, 38 }, // ŗ
+    { 0x158, 22 }, // Ř
+    { 0x159, 38 }, // ř
+    { 0x162, 23 }, // Ţ
+    { 0x163, 33 }, // ţ
+    { 0x164, 23 }, // Ť
+    { 0x165, 33 }, // ť
+    { 0x166, 23 }, // Ŧ
+    { 0x167, 33 }, // ŧ
+    { 0x168, 24 }, // Ũ
+    { 0x16A, 24 }, // Ū
+    { 0x16C, 24 }, // Ŭ
+    { 0x16E, 24 }, // Ů
+    { 0x170, 24 }, // Ű
+    { 0x172, 24 }, // Ų
+    { 0x174, 26 }, // Ŵ
+    { 0x175, 39 }, // ŵ
+    { 0x176, 28 }, // Ŷ
+    { 0x178, 28 }, // Ÿ
+    { 0x179, 29 }, // Ź
+    { 0x17A, 41 }, // ź
+    { 0x17B, 29 }, // Ż
+    { 0x17C, 41 }, // ż
+    { 0x17D, 29 }, // Ž
+    { 0x17E, 41 }, // ž
+    { 0x17F, 34 }, // ſ
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2018, 1 }, // ‘
+    { 0x201A, 53 }, // ‚
+    { 0x201C, 1 }, // “
+    { 0x201E, 53 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 45 }, // ‹
+    { 0x203A, 46 }, // ›
+    { 0xFB00, 34 }, // ﬀ
+};
+
+static const EpdKernClassEntry ubuntu_12_regularKernRightClasses[] = {
+    { 0x22, 1 }, // "
+    { 0x27, 1 }, // '
+    { 0x28, 2 }, // (
+    { 0x29, 3 }, // )
+    { 0x2A, 4 }, // *
+    { 0x2C, 5 }, // ,
+    { 0x2D, 6 }, // -
+    { 0x2E, 5 }, // .
+    { 0x2F, 7 }, // /
+    { 0x3A, 8 }, // :
+    { 0x3B, 8 }, // ;
+    { 0x3F, 9 }, // ?
+    { 0x40, 10 }, // @
+    { 0x41, 11 }, // A
+    { 0x43, 12 }, // C
+    { 0x47, 12 }, // G
+    { 0x4A, 13 }, // J
+    { 0x4F, 12 }, // O
+    { 0x51, 12 }, // Q
+    { 0x53, 14 }, // S
+    { 0x54, 15 }, // T
+    { 0x55, 16 }, // U
+    { 0x56, 17 }, // V
+    { 0x57, 18 }, // W
+    { 0x58, 19 }, // X
+    { 0x59, 20 }, // Y
+    { 0x5A, 21 }, // Z
+    { 0x5C, 22 }, // <backslash>
+    { 0x5D, 23 }, // ]
+    { 0x61, 24 }, // a
+    { 0x63, 25 }, // c
+    { 0x64, 25 }, // d
+    { 0x65, 25 }, // e
+    { 0x67, 26 }, // g
+    { 0x6A, 27 }, // j
+    { 0x6D, 24 }, // m
+    { 0x6E, 24 }, // n
+    { 0x6F, 25 }, // o
+    { 0x70, 24 }, // p
+    { 0x71, 28 }, // q
+    { 0x72, 24 }, // r
+    { 0x73, 29 }, // s
+    { 0x75, 30 }, // u
+    { 0x76, 31 }, // v
+    { 0x77, 32 }, // w
+    { 0x78, 33 }, // x
+    { 0x79, 34 }, // y
+    { 0x7A, 35 }, // z
+    { 0x7B, 36 }, // {
+    { 0x7D, 37 }, // }
+    { 0xAB, 38 }, // «
+    { 0xBB, 39 }, // »
+    { 0xC0, 11 }, // À
+    { 0xC1, 11 }, // Á
+    { 0xC2, 11 }, // Â
+    { 0xC3, 11 }, // Ã
+    { 0xC4, 11 }, // Ä
+    { 0xC5, 11 }, // Å
+    { 0xC6, 40 }, // Æ
+    { 0xC7, 12 }, // Ç
+    { 0xD2, 12 }, // Ò
+    { 0xD3, 12 }, // Ó
+    { 0xD4, 12 }, // Ô
+    { 0xD5, 12 }, // Õ
+    { 0xD6, 12 }, // Ö
+    { 0xD8, 12 }, // Ø
+    { 0xD9, 16 }, // Ù
+    { 0xDA, 16 }, // Ú
+    { 0xDB, 16 }, // Û
+    { 0xDC, 16 }, // Ü
+    { 0xDD, 20 }, // Ý
+    { 0xE0, 24 }, // à
+    { 0xE1, 24 }, // á
+    { 0xE2, 24 }, // â
+    { 0xE3, 24 }, // ã
+    { 0xE4, 24 }, // ä
+    { 0xE5, 24 }, // å
+    { 0xE6, 24 }, // æ
+    { 0xE7, 25 }, // ç
+    { 0xE8, 25 }, // è
+    { 0xE9, 25 }, // é
+    { 0xEA, 25 }, // ê
+    { 0xEB, 25 }, // ë
+    { 0xEC, 41 }, // ì
+    { 0xEE, 42 }, // î
+    { 0xEF, 43 }, // ï
+    { 0xF0, 44 }, // ð
+    { 0xF1, 24 }, // ñ
+    { 0xF2, 25 }, // ò
+    { 0xF3, 25 }, // ó
+    { 0xF4, 25 }, // ô
+    { 0xF5, 25 }, // õ
+    { 0xF6, 25 }, // ö
+    { 0xF8, 25 }, // ø
+    { 0xF9, 30 }, // ù
+    { 0xFA, 30 }, // ú
+    { 0xFB, 30 }, // û
+    { 0xFC, 30 }, // ü
+    { 0xFD, 34 }, // ý
+    { 0xFF, 34 }, // ÿ
+    { 0x100, 11 }, // Ā
+    { 0x101, 24 }, // ā
+    { 0x102, 11 }, // Ă
+    { 0x103, 24 }, // ă
+    { 0x104, 11 }, // Ą
+    { 0x105, 24 }, // ą
+    { 0x106, 12 }, // Ć
+    { 0x107, 25 }, // ć
+    { 0x108, 12 }, // Ĉ
+    { 0x109, 25 }, // ĉ
+    { 0x10A, 12 }, // Ċ
+    { 0x10B, 25 }, // ċ
+    { 0x10C, 12 }, // Č
+    { 0x10D, 25 }, // č
+    { 0x10F, 25 }, // ď
+    { 0x111, 25 }, // đ
+    { 0x113, 25 }, // ē
+    { 0x115, 25 }, // ĕ
+    { 0x117, 25 }, // ė
+    { 0x119, 25 }, // ę
+    { 0x11B, 25 }, // ě
+    { 0x11C, 12 }, // Ĝ
+    { 0x11D, 26 }, // ĝ
+    { 0x11E, 12 }, // Ğ
+    { 0x11F, 26 }, // ğ
+    { 0x120, 12 }, // Ġ
+    { 0x121, 26 }, // ġ
+    { 0x122, 12 }, // Ģ
+    { 0x123, 26 }, // ģ
+    { 0x129, 45 }, // ĩ
+    { 0x12B, 45 }, // ī
+    { 0x12D, 41 }, // ĭ
+    { 0x134, 13 }, // Ĵ
+    { 0x135, 27 }, // ĵ
+    { 0x144, 24 }, // ń
+    { 0x146, 24 }, // ņ
+    { 0x148, 24 }, // ň
+    { 0x149, 24 }, // ŉ
+    { 0x14B, 46 }, // ŋ
+    { 0x14C, 12 }, // Ō
+    { 0x14D, 25 }, // ō
+    { 0x14E, 12 }, // Ŏ
+    { 0x14F, 25 }, // ŏ
+    { 0x150, 12 }, // Ő
+    { 0x151, 25 }, // ő
+    { 0x152, 12 }, // Œ
+    { 0x153, 25 }, // œ
+    { 0x155, 24 }, // ŕ
+    { 0x157, 24 }, // ŗ
+    { 0x159, 24 }, // ř
+    { 0x15A, 14 }, // Ś
+    { 0x15B, 29 }, // ś
+    { 0x15C, 14 }, // Ŝ
+    { 0x15D, 29 }, // ŝ
+    { 0x15E, 14 }, // Ş
+    { 0x15F, 29 }, // ş
+    { 0x160, 14 }, // Š
+    { 0x161, 29 }, // š
+    { 0x162, 15 }, // Ţ
+    { 0x164, 15 }, // Ť
+    { 0x166, 15 }, // Ŧ
+    { 0x168, 16 }, // Ũ
+    { 0x169, 30 }, // ũ
+    { 0x16A, 16 }, // Ū
+    { 0x16B, 30 }, // ū
+    { 0x16C, 16 }, // Ŭ
+    { 0x16D, 30 }, // ŭ
+    { 0x16E, 16 }, // Ů
+    { 0x16F, 30 }, // ů
+    { 0x170, 16 }, // Ű
+    { 0x171, 30 }, // ű
+    { 0x172, 16 }, // Ų
+    { 0x173, 30 }, // ų
+    { 0x174, 18 }, // Ŵ
+    { 0x175, 32 }, // ŵ
+    { 0x176, 20 }, // Ŷ
+    { 0x177, 34 }, // ŷ
+    { 0x178, 20 }, // Ÿ
+    { 0x179, 21 }, // Ź
+    { 0x17A, 35 }, // ź
+    { 0x17B, 21 }, // Ż
+    { 0x17C, 35 }, // ż
+    { 0x17D, 21 }, // Ž
+    { 0x17E, 35 }, // ž
+    { 0x2013, 6 }, // –
+    { 0x2014, 6 }, // —
+    { 0x2018, 47 }, // ‘
+    { 0x2019, 48 }, // ’
+    { 0x201A, 49 }, // ‚
+    { 0x201C, 47 }, // “
+    { 0x201D, 48 }, // ”
+    { 0x201E, 49 }, // „
+    { 0x2026, 5 }, // …
+    { 0x2039, 38 }, // ‹
+    { 0x203A, 39 }, // ›
+};
+
+static const int8_t ubuntu_12_regularKernMatrix[2597] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, 0, -2, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, -2, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, -2, 0, -2, 0, 1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, -2, 1,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, -3,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, -1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 0, -2, 0, 1, 0, 0, 1, -1, 0, 0, 0, 0, 0,
+    -3, 0, 0, -3, 1, -2, 0, 0, 0, 0, 1, -1, 1, 0, -3, 0, -2, -1, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -3, -3, 0,
+    0, 0, -1, 0, -2, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3,
+    -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, -1, -2, -2, 1, -1, -2, -1, -2, 0, 1, 0, 1, 0, 0, 1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -2, 0, -1, -1, -1, 0, -2, -2, -2, 0, 1, 1, -2, 1, -2, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, -1, 0, 0, -2, 0, -2, 0, 1, -1, -2, 0, -2, 0, 1, 0, 1, 1, 0, 1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 1, -1, 1, -1, 0, 1, -2,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 1, -1,
+    0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, -1, -2, -1, 1, -1, -2, -1, -3, 0, 1, 0, 1, 1, 1, 1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, -2, -1, -2, 0, 0, 1, -2, 1, -1, 0, 0, -2,
+    0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, -1,
+    -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -1, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, -3, -1, -1, -1, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, -2, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1,
+    -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 3, 0, 3, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, 0, -2, 0, -2, -1, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair ubuntu_12_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
 };
 
 static const EpdFontData ubuntu_12_regular = {
     ubuntu_12_regularBitmaps,
     ubuntu_12_regularGlyphs,
     ubuntu_12_regularIntervals,
-    35,
+    36,
     29,
     24,
     -5,
     false,
+    ubuntu_12_regularKernLeftClasses,
+    189,
+    ubuntu_12_regularKernRightClasses,
+    195,
+    ubuntu_12_regularKernMatrix,
+    53,
+    49,
+    ubuntu_12_regularLigatures,
+    5,
 };
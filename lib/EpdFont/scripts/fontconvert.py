@@ -15,6 +15,8 @@ parser.add_argument("size", type=int, help="font size to use.")
 parser.add_argument("fontstack", action="store", nargs='+', help="list of font files, ordered by descending priority.")
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
+parser.add_argument("--no-kerning", dest="kerning", action="store_false", help="do not export pair kerning tables.")
+parser.add_argument("--no-ligatures", dest="ligatures", action="store_false", help="do not export ligature substitutions.")
 args = parser.parse_args()
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "data_length", "data_offset", "code_point"])
@@ -60,6 +62,9 @@ intervals = [
     (0x2200, 0x22FF),
     # Arrows
     (0x2190, 0x21FF),
+    ### Alphabetic Presentation Forms (Latin ligatures) ###
+    # ff, fi, fl, ffi, ffl
+    (0xFB00, 0xFB04),
     ### CJK ###
     # Core Unified Ideographs
     # (0x4E00, 0x9FFF),
@@ -101,6 +106,23 @@ intervals = [
     # (0xF900, 0xFAFF),
 ]
 
+# code points considered for pair kerning, keeps the pair scan and the tables small
+kerning_intervals = [
+    (0x0020, 0x017F),
+    (0x2010, 0x2027),
+    (0x2039, 0x203A),
+    (0xFB00, 0xFB04),
+]
+
+# (first, second, ligature) substitutions, applied repeatedly so "ffi" folds to ff + i -> ffi
+ligature_candidates = [
+    (ord('f'), ord('f'), 0xFB00),
+    (ord('f'), ord('i'), 0xFB01),
+    (ord('f'), ord('l'), 0xFB02),
+    (0xFB00, ord('i'), 0xFB03),
+    (0xFB00, ord('l'), 0xFB04),
+]
+
 add_ints = []
 if args.additional_intervals:
     add_ints = [tuple([int(n, base=0) for n in i.split(",")]) for i in args.additional_intervals]
@@ -127,6 +149,90 @@ def load_glyph(code_point):
     print(f"code point {code_point} ({hex(code_point)}) not found in font stack!", file=sys.stderr)
     return None
 
+def gpos_kerning(path, code_points):
+    """Pair adjustments in font units from the GPOS 'kern' feature, keyed by code point pair."""
+    try:
+        from fontTools.ttLib import TTFont
+    except ImportError:
+        return None
+    tt = TTFont(path)
+    if "GPOS" not in tt:
+        return None
+    gpos = tt["GPOS"].table
+    cmap = tt.getBestCmap()
+    names = {cmap[cp]: cp for cp in code_points if cp in cmap}
+    pairs = {}
+    lookup_indices = set()
+    for record in gpos.FeatureList.FeatureRecord:
+        if record.FeatureTag == "kern":
+            lookup_indices.update(record.Feature.LookupListIndex)
+    for lookup_index in sorted(lookup_indices):
+        lookup = gpos.LookupList.Lookup[lookup_index]
+        for subtable in lookup.SubTable:
+            if lookup.LookupType == 9:
+                subtable = subtable.ExtSubTable
+            if getattr(subtable, "LookupType", lookup.LookupType) != 2:
+                continue
+            for first in subtable.Coverage.glyphs:
+                if first not in names:
+                    continue
+                if subtable.Format == 1:
+                    pair_set = subtable.PairSet[subtable.Coverage.glyphs.index(first)]
+                    for record in pair_set.PairValueRecord:
+                        x_advance = getattr(record.Value1, "XAdvance", 0) if record.Value1 else 0
+                        if record.SecondGlyph in names and x_advance:
+                            pairs.setdefault((names[first], names[record.SecondGlyph]), x_advance)
+                elif subtable.Format == 2:
+                    class1 = subtable.ClassDef1.classDefs.get(first, 0)
+                    class2_records = subtable.Class1Record[class1].Class2Record
+                    for second, second_cp in names.items():
+                        value = class2_records[subtable.ClassDef2.classDefs.get(second, 0)].Value1
+                        x_advance = getattr(value, "XAdvance", 0) if value else 0
+                        if x_advance:
+                            pairs.setdefault((names[first], second_cp), x_advance)
+    return pairs, tt["head"].unitsPerEm
+
+def build_kerning(code_points):
+    """Pair adjustments in whole pixels for the primary face, keyed by code point pair."""
+    face = font_stack[0]
+    code_points = [cp for cp in code_points if face.get_char_index(cp) > 0]
+    pixels = {}
+    gpos = gpos_kerning(args.fontstack[0], code_points)
+    if gpos is not None:
+        pairs, units_per_em = gpos
+        ppem = size * 150 / 72
+        for pair, value in pairs.items():
+            pixels[pair] = round(value * ppem / units_per_em)
+    elif face.has_kerning:
+        indices = {cp: face.get_char_index(cp) for cp in code_points}
+        for left in code_points:
+            for right in code_points:
+                value = face.get_kerning(indices[left], indices[right], freetype.FT_KERNING_UNFITTED).x
+                pixels[(left, right)] = round(value / (1 << 6))
+    return {pair: max(-128, min(127, px)) for pair, px in pixels.items() if px != 0}
+
+def build_kerning_classes(pairs):
+    """Collapses code points with identical kerning behaviour into 1-based classes."""
+    lefts = sorted({left for left, _ in pairs})
+    rights = sorted({right for _, right in pairs})
+    left_signatures = {}
+    left_classes = {}
+    for left in lefts:
+        signature = tuple(pairs.get((left, right), 0) for right in rights)
+        left_classes[left] = left_signatures.setdefault(signature, len(left_signatures) + 1)
+    right_signatures = {}
+    right_classes = {}
+    for right in rights:
+        signature = tuple(pairs.get((left, right), 0) for left in lefts)
+        right_classes[right] = right_signatures.setdefault(signature, len(right_signatures) + 1)
+    if len(left_signatures) > 255 or len(right_signatures) > 255:
+        print(f"too many kerning classes ({len(left_signatures)}x{len(right_signatures)}), kerning disabled", file=sys.stderr)
+        return {}, {}, []
+    matrix = [0] * (len(left_signatures) * len(right_signatures))
+    for (left, right), px in pairs.items():
+        matrix[(left_classes[left] - 1) * len(right_signatures) + right_classes[right] - 1] = px
+    return left_classes, right_classes, matrix
+
 unmerged_intervals = sorted(intervals + add_ints)
 intervals = []
 unvalidated_intervals = []
@@ -285,6 +391,40 @@ for i_start, i_end in intervals:
     offset += i_end - i_start + 1
 print ("};\n");
 
+exported = set()
+for i_start, i_end in intervals:
+    exported.update(range(i_start, i_end + 1))
+
+kern_left, kern_right, kern_matrix = {}, {}, []
+if args.kerning:
+    kern_code_points = sorted(cp for i_start, i_end in kerning_intervals for cp in range(i_start, i_end + 1) if cp in exported)
+    kern_left, kern_right, kern_matrix = build_kerning_classes(build_kerning(kern_code_points))
+kern_columns = max(kern_right.values()) if kern_right else 0
+
+ligatures = []
+if args.ligatures:
+    ligatures = sorted(l for l in ligature_candidates if all(cp in exported for cp in l))
+
+def print_kern_classes(array_name, classes):
+    print(f"static const EpdKernClassEntry {font_name}{array_name}[] = {{")
+    for cp in sorted(classes):
+        print(f"    {{ 0x{cp:X}, {classes[cp]} }},", f"// {chr(cp) if cp != 92 else '<backslash>'}")
+    print ("};\n");
+
+if kern_matrix:
+    print_kern_classes("KernLeftClasses", kern_left)
+    print_kern_classes("KernRightClasses", kern_right)
+    print(f"static const int8_t {font_name}KernMatrix[{len(kern_matrix)}] = {{")
+    for c in chunks(kern_matrix, kern_columns):
+        print ("    " + " ".join(f"{v}," for v in c))
+    print ("};\n");
+
+if ligatures:
+    print(f"static const EpdLigaturePair {font_name}Ligatures[] = {{")
+    for first, second, ligature in ligatures:
+        print (f"    {{ 0x{first:X}, 0x{second:X}, 0x{ligature:X} }},")
+    print ("};\n");
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -294,4 +434,19 @@ print(f"    {norm_ceil(face.size.height)},")
 print(f"    {norm_ceil(face.size.ascender)},")
 print(f"    {norm_floor(face.size.descender)},")
 print(f"    {'true' if is2Bit else 'false'},")
+if kern_matrix:
+    print(f"    {font_name}KernLeftClasses,")
+    print(f"    {len(kern_left)},")
+    print(f"    {font_name}KernRightClasses,")
+    print(f"    {len(kern_right)},")
+    print(f"    {font_name}KernMatrix,")
+    print(f"    {max(kern_left.values())},")
+    print(f"    {kern_columns},")
+else:
+    print("    nullptr,\n    0,\n    nullptr,\n    0,\n    nullptr,\n    0,\n    0,")
+if ligatures:
+    print(f"    {font_name}Ligatures,")
+    print(f"    {len(ligatures)},")
+else:
+    print("    nullptr,\n    0,")
 print("};")
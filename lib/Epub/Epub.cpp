@@ -3,14 +3,46 @@
 #include <FsHelpers.h>
 #include <HardwareSerial.h>
 #include <JpegToBmpConverter.h>
+#include <PngToBmpConverter.h>
 #include <SDCardManager.h>
+#include <ScaledBmpEncoder.h>
 #include <ZipFile.h>
 
+#include "Epub/CacheKeyMap.h"
 #include "Epub/parsers/ContainerParser.h"
 #include "Epub/parsers/ContentOpfParser.h"
 #include "Epub/parsers/TocNavParser.h"
 #include "Epub/parsers/TocNcxParser.h"
 
+bool Epub::resolveCachePath(const bool fingerprintIfMissing) {
+  if (!cachePath.empty()) {
+    return true;
+  }
+
+  // Caches used to be keyed by path, one from before is taken over instead of indexing the book again
+  const std::string pathKeyedCache = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(filepath));
+  const bool hasPathKeyedCache = SdMan.exists(pathKeyedCache.c_str());
+
+  // A key based on the contents, so the cache follows the book when it is moved or renamed
+  const std::string key = CacheKeyMap::getKey(filepath, cacheDir, fingerprintIfMissing || hasPathKeyedCache);
+  if (key.empty()) {
+    // Not fingerprinted yet, or not readable as a ZIP file
+    return false;
+  }
+  cachePath = cacheDir + "/epub_" + key;
+
+  if (hasPathKeyedCache && !SdMan.exists(cachePath.c_str())) {
+    FsFile dir = SdMan.open(pathKeyedCache.c_str());
+    const bool renamed = dir && dir.rename(cachePath.c_str());
+    if (dir) {
+      dir.close();
+    }
+    Serial.printf("[%lu] [EBP] %s path keyed cache of %s\n", millis(), renamed ? "Moved" : "Failed to move",
+                  filepath.c_str());
+  }
+  return true;
+}
+
 bool Epub::findContentOpfFile(std::string* contentOpfFile) const {
   const auto containerPath = "META-INF/container.xml";
   size_t containerSize;
@@ -207,6 +239,11 @@ bool Epub::parseTocNavFile() const {
 bool Epub::load(const bool buildIfMissing) {
   Serial.printf("[%lu] [EBP] Loading ePub: %s\n", millis(), filepath.c_str());
 
+  if (!resolveCachePath(buildIfMissing)) {
+    Serial.printf("[%lu] [EBP] No cache key for %s\n", millis(), filepath.c_str());
+    return false;
+  }
+
   // Initialize spine/TOC cache
   bookMetadataCache.reset(new BookMetadataCache(cachePath));
 
@@ -241,6 +278,10 @@ bool Epub::load(const bool buildIfMissing) {
     Serial.printf("[%lu] [EBP] Could not parse content.opf\n", millis());
     return false;
   }
+  if (isAborted()) {
+    Serial.printf("[%lu] [EBP] Aborted building cache after content.opf pass\n", millis());
+    return false;
+  }
   if (!bookMetadataCache->endContentOpfPass()) {
     Serial.printf("[%lu] [EBP] Could not end writing content.opf pass\n", millis());
     return false;
@@ -266,6 +307,12 @@ bool Epub::load(const bool buildIfMissing) {
     tocParsed = parseTocNcxFile();
   }
 
+  if (isAborted()) {
+    // A cut-short TOC would otherwise be kept as if the book had no (complete) TOC
+    Serial.printf("[%lu] [EBP] Aborted building cache during toc pass\n", millis());
+    return false;
+  }
+
   if (!tocParsed) {
     Serial.printf("[%lu] [EBP] Warning: Could not parse any TOC format\n", millis());
     // Continue anyway - book will work without TOC
@@ -283,7 +330,7 @@ bool Epub::load(const bool buildIfMissing) {
   }
 
   // Build final book.bin
-  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata)) {
+  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata, abortCheck)) {
     Serial.printf("[%lu] [EBP] Could not update mappings and sizes\n", millis());
     return false;
   }
@@ -359,6 +406,17 @@ bool Epub::generateCoverBmp(bool cropped) const {
     return true;
   }
 
+  return convertCoverImage(getCoverBmpPath(cropped), ScaledBmpEncoder::COVER_MAX_WIDTH,
+                           ScaledBmpEncoder::COVER_MAX_HEIGHT);
+}
+
+std::string Epub::getThumbBmpPath() const { return cachePath + "/thumb.bmp"; }
+
+bool Epub::generateThumbBmp(const int maxWidth, const int maxHeight) const {
+  return convertCoverImage(getThumbBmpPath(), maxWidth, maxHeight);
+}
+
+bool Epub::convertCoverImage(const std::string& bmpPath, const int maxWidth, const int maxHeight) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
     Serial.printf("[%lu] [EBP] Cannot generate cover BMP, cache not loaded\n", millis());
     return false;
@@ -370,40 +428,55 @@ bool Epub::generateCoverBmp(bool cropped) const {
     return false;
   }
 
-  if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
-      coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    Serial.printf("[%lu] [EBP] Generating BMP from JPG cover image\n", millis());
-    const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
+  const bool isJpeg = coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
+                      coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg";
+  const bool isPng = coverImageHref.substr(coverImageHref.length() - 4) == ".png";
+
+  if (isJpeg || isPng) {
+    const char* format = isPng ? "PNG" : "JPG";
+    Serial.printf("[%lu] [EBP] Generating %dx%d BMP from %s cover image\n", millis(), maxWidth, maxHeight, format);
+    const auto coverImageTempPath = getCachePath() + (isPng ? "/.cover.png" : "/.cover.jpg");
 
-    FsFile coverJpg;
-    if (!SdMan.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
+    FsFile coverImage;
+    if (!SdMan.openFileForWrite("EBP", coverImageTempPath, coverImage)) {
+      return false;
+    }
+    const bool extracted = readItemContentsToStream(coverImageHref, coverImage, 1024);
+    coverImage.close();
+    if (!extracted) {
+      Serial.printf("[%lu] [EBP] Failed to extract %s cover image\n", millis(), format);
+      SdMan.remove(coverImageTempPath.c_str());
       return false;
     }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
-    coverJpg.close();
 
-    if (!SdMan.openFileForRead("EBP", coverJpgTempPath, coverJpg)) {
+    if (!SdMan.openFileForRead("EBP", coverImageTempPath, coverImage)) {
       return false;
     }
 
     FsFile coverBmp;
-    if (!SdMan.openFileForWrite("EBP", getCoverBmpPath(cropped), coverBmp)) {
-      coverJpg.close();
+    if (!SdMan.openFileForWrite("EBP", bmpPath, coverBmp)) {
+      coverImage.close();
       return false;
     }
-    const bool success = JpegToBmpConverter::jpegFileToBmpStream(coverJpg, coverBmp);
-    coverJpg.close();
+    const auto scratchPath = getCachePath() + "/.cover.tmp";
+    const bool success =
+        isPng ? PngToBmpConverter::pngFileToBmpStreamScaled(coverImage, coverBmp, maxWidth, maxHeight, nullptr,
+                                                            nullptr, scratchPath, abortCheck)
+              : JpegToBmpConverter::jpegFileToBmpStreamScaled(coverImage, coverBmp, maxWidth, maxHeight, nullptr,
+                                                              nullptr, scratchPath, abortCheck);
+    coverImage.close();
     coverBmp.close();
-    SdMan.remove(coverJpgTempPath.c_str());
+    SdMan.remove(coverImageTempPath.c_str());
 
     if (!success) {
-      Serial.printf("[%lu] [EBP] Failed to generate BMP from JPG cover image\n", millis());
-      SdMan.remove(getCoverBmpPath(cropped).c_str());
+      Serial.printf("[%lu] [EBP] Failed to generate BMP from %s cover image\n", millis(), format);
+      SdMan.remove(bmpPath.c_str());
     }
-    Serial.printf("[%lu] [EBP] Generated BMP from JPG cover image, success: %s\n", millis(), success ? "yes" : "no");
+    Serial.printf("[%lu] [EBP] Generated BMP from %s cover image, success: %s\n", millis(), format,
+                  success ? "yes" : "no");
     return success;
   } else {
-    Serial.printf("[%lu] [EBP] Cover image is not a JPG, skipping\n", millis());
+    Serial.printf("[%lu] [EBP] Cover image is not a JPG or PNG, skipping\n", millis());
   }
 
   return false;
@@ -433,7 +506,7 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
+  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize, abortCheck);
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
@@ -441,6 +514,11 @@ bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
 }
 
+bool Epub::getItemCrc32(const std::string& itemHref, uint32_t* crc, size_t* size) const {
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  return ZipFile(filepath).getFileCrc32(path.c_str(), crc, size);
+}
+
 int Epub::getSpineItemsCount() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
     return 0;
@@ -2,6 +2,7 @@
 
 #include <Print.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -20,23 +21,34 @@ class Epub {
   std::string filepath;
   // the base path for items in the EPUB file
   std::string contentBasePath;
-  // Uniq cache key based on filepath
+  // Directory holding the caches of all books
+  std::string cacheDir;
+  // Uniq cache key based on the file contents, empty until resolveCachePath() found it
   std::string cachePath;
   // Spine and TOC cache
   std::unique_ptr<BookMetadataCache> bookMetadataCache;
+  // Polled by long-running work on the book, which gives up once it returns true
+  std::function<bool()> abortCheck;
 
   bool findContentOpfFile(std::string* contentOpfFile) const;
   bool parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata);
   bool parseTocNcxFile() const;
   bool parseTocNavFile() const;
+  bool convertCoverImage(const std::string& bmpPath, int maxWidth, int maxHeight) const;
 
  public:
-  explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
-    // create a cache key based on the filepath
-    cachePath = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(this->filepath));
-  }
+  // Cheap, touches no files; the cache directory is only resolved by load()
+  explicit Epub(std::string filepath, std::string cacheDir)
+      : filepath(std::move(filepath)), cacheDir(std::move(cacheDir)) {}
   ~Epub() = default;
+  // Building the cache, generating covers and laying out sections fail early once check returns true
+  void setAbortCheck(std::function<bool()> check) { abortCheck = std::move(check); }
+  const std::function<bool()>& getAbortCheck() const { return abortCheck; }
+  bool isAborted() const { return abortCheck && abortCheck(); }
   std::string& getBasePath() { return contentBasePath; }
+  // Finds the cache directory by the book's content key. Without `fingerprintIfMissing` only a key remembered in the
+  // key map is used, so a book that was never opened or indexed is not read at all.
+  bool resolveCachePath(bool fingerprintIfMissing = true);
   bool load(bool buildIfMissing = true);
   bool clearCache() const;
   void setupCacheDir() const;
@@ -46,10 +58,14 @@ class Epub {
   const std::string& getAuthor() const;
   std::string getCoverBmpPath(bool cropped = false) const;
   bool generateCoverBmp(bool cropped = false) const;
+  // Small cover for the library grid, regenerated on every call (the caller packs it into its own store)
+  std::string getThumbBmpPath() const;
+  bool generateThumbBmp(int maxWidth, int maxHeight) const;
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
+  bool getItemCrc32(const std::string& itemHref, uint32_t* crc, size_t* size = nullptr) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
   int getSpineItemsCount() const;
@@ -68,7 +68,8 @@ bool BookMetadataCache::endWrite() {
   return true;
 }
 
-bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata) {
+bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata,
+                                     const std::function<bool()>& shouldAbort) {
   // Open all three files, writing to meta, reading from spine and toc
   if (!SdMan.openFileForWrite("BMC", cachePath + bookBinFile, bookFile)) {
     return false;
@@ -146,6 +147,16 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   spineFile.seek(0);
   int lastSpineTocIndex = -1;
   for (int i = 0; i < spineCount; i++) {
+    if (shouldAbort && shouldAbort()) {
+      Serial.printf("[%lu] [BMC] Aborted building book.bin at spine item %d\n", millis(), i);
+      bookFile.close();
+      spineFile.close();
+      tocFile.close();
+      zip.close();
+      SdMan.remove((cachePath + bookBinFile).c_str());
+      return false;
+    }
+
     auto spineEntry = readSpineEntry(spineFile);
 
     tocFile.seek(0);
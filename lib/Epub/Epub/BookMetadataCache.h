@@ -2,6 +2,7 @@
 
 #include <SDCardManager.h>
 
+#include <functional>
 #include <string>
 
 class BookMetadataCache {
@@ -75,8 +76,9 @@ class BookMetadataCache {
   bool endWrite();
   bool cleanupTmpFiles() const;
 
-  // Post-processing to update mappings and sizes
-  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata);
+  // Post-processing to update mappings and sizes, gives up between spine entries once shouldAbort returns true
+  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata,
+                    const std::function<bool()>& shouldAbort = nullptr);
 
   // Reading phase (read mode)
   bool load();
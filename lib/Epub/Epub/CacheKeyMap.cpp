@@ -0,0 +1,142 @@
+#include "CacheKeyMap.h"
+
+#include <HardwareSerial.h>
+#include <ZipFile.h>
+
+#include <cstdio>
+
+namespace {
+constexpr uint32_t MAP_MAGIC = 0x4D4B4243;  // "CBKM"
+constexpr uint8_t MAP_FILE_VERSION = 2;
+constexpr char mapFile[] = "/book_keys.bin";
+
+uint32_t hashPath(const std::string& filepath) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (const char c : filepath) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+uint32_t checkPath(const std::string& filepath) {
+  // sdbm, unrelated to FNV-1a so a collision in one is not one in the other
+  uint32_t hash = 0;
+  for (const char c : filepath) {
+    hash = static_cast<uint8_t>(c) + (hash << 6) + (hash << 16) - hash;
+  }
+  return hash;
+}
+}  // namespace
+
+bool CacheKeyMap::openMap(const std::string& mapPath, FsFile& file, const bool create) {
+  Header header = {};
+  file = SdMan.open(mapPath.c_str(), O_RDWR);
+  if (file && file.size() == sizeof(Header) + SLOTS * sizeof(Slot) &&
+      file.read(&header, sizeof(header)) == static_cast<int>(sizeof(header)) && header.magic == MAP_MAGIC &&
+      header.version == MAP_FILE_VERSION && header.slots == SLOTS) {
+    return true;
+  }
+  if (file) {
+    file.close();
+  }
+  if (!create) {
+    return false;
+  }
+
+  // Lay out the whole table up front, so slots are only ever overwritten in place
+  if (!SdMan.openFileForWrite("KEY", mapPath, file)) {
+    return false;
+  }
+  header = {};
+  header.magic = MAP_MAGIC;
+  header.version = MAP_FILE_VERSION;
+  header.slots = SLOTS;
+  const Slot empty = {};
+  bool ok = file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+  for (int slot = 0; ok && slot < SLOTS; slot++) {
+    ok = file.write(reinterpret_cast<const uint8_t*>(&empty), sizeof(empty)) == sizeof(empty);
+  }
+  if (!ok) {
+    Serial.printf("[%lu] [KEY] Failed to create key map\n", millis());
+    file.close();
+    SdMan.remove(mapPath.c_str());
+  }
+  return ok;
+}
+
+std::string CacheKeyMap::formatKey(const uint32_t fileSize, const uint32_t fingerprint) {
+  char key[17];
+  snprintf(key, sizeof(key), "%08lx%08lx", static_cast<unsigned long>(fileSize),
+           static_cast<unsigned long>(fingerprint));
+  return key;
+}
+
+std::string CacheKeyMap::getKey(const std::string& filepath, const std::string& cacheDir,
+                                const bool computeIfMissing) {
+  FsFile book;
+  if (!SdMan.openFileForRead("KEY", filepath, book)) {
+    return "";
+  }
+  Slot entry = {};
+  entry.pathHash = hashPath(filepath);
+  entry.pathCheck = checkPath(filepath);
+  entry.pathLength = static_cast<uint16_t>(filepath.size());
+  entry.fileSize = static_cast<uint32_t>(book.size());
+  book.getModifyDateTime(&entry.modifyDate, &entry.modifyTime);
+  book.close();
+
+  FsFile map;
+  const bool mapOpen = openMap(cacheDir + mapFile, map, computeIfMissing);
+  const int home = static_cast<int>(entry.pathHash % SLOTS);
+  int target = home;  // Where a new key goes; the first slot of the chain if every probed slot is taken
+  for (int probe = 0; mapOpen && probe < PROBES; probe++) {
+    const int index = (home + probe) % SLOTS;
+    Slot slot;
+    if (!map.seek(sizeof(Header) + index * sizeof(Slot)) ||
+        map.read(&slot, sizeof(slot)) != static_cast<int>(sizeof(slot))) {
+      break;
+    }
+    if (slot.fileSize == 0) {
+      target = index;
+      break;
+    }
+    if (slot.pathHash == entry.pathHash && slot.pathCheck == entry.pathCheck && slot.pathLength == entry.pathLength) {
+      if (slot.fileSize == entry.fileSize && slot.modifyDate == entry.modifyDate &&
+          slot.modifyTime == entry.modifyTime) {
+        map.close();
+        return formatKey(slot.fileSize, slot.fingerprint);
+      }
+      // The file at this path was replaced
+      target = index;
+      break;
+    }
+  }
+
+  if (!computeIfMissing) {
+    if (mapOpen) {
+      map.close();
+    }
+    return "";
+  }
+
+  const unsigned long start = millis();
+  ZipFile zip(filepath);
+  if (!zip.getFingerprint(&entry.fingerprint)) {
+    Serial.printf("[%lu] [KEY] Could not fingerprint %s\n", millis(), filepath.c_str());
+    if (mapOpen) {
+      map.close();
+    }
+    return "";
+  }
+  Serial.printf("[%lu] [KEY] Fingerprinted %s in %lu ms\n", millis(), filepath.c_str(), millis() - start);
+
+  if (mapOpen) {
+    if (!map.seek(sizeof(Header) + target * sizeof(Slot)) ||
+        map.write(reinterpret_cast<const uint8_t*>(&entry), sizeof(entry)) != sizeof(entry)) {
+      Serial.printf("[%lu] [KEY] Failed to store key of %s\n", millis(), filepath.c_str());
+    }
+    map.close();
+  }
+  return formatKey(entry.fileSize, entry.fingerprint);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <SDCardManager.h>
+
+#include <cstdint>
+#include <string>
+
+// Content based cache keys for books, so a book keeps its cache when it is moved, renamed or uploaded again.
+// The key is the file size plus a fingerprint of the ZIP central directory. As that takes reading the whole central
+// directory, keys are remembered in <cacheDir>/book_keys.bin: a fixed hash table by path, whose slots also hold the
+// size and modification time of the file, so a replaced file is fingerprinted again. Slots are matched by two
+// independent hashes and the length of the path, as a wrong match would hand one book the cache of another.
+class CacheKeyMap {
+ public:
+  // Key of the book at `filepath`, or an empty string if it cannot be read as a ZIP file. Without `computeIfMissing`
+  // only a remembered key is returned, the map is never created and the book is not fingerprinted.
+  static std::string getKey(const std::string& filepath, const std::string& cacheDir, bool computeIfMissing = true);
+
+ private:
+  static constexpr int SLOTS = 512;
+  static constexpr int PROBES = 8;
+
+  struct Header {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t slots;
+  };
+
+  struct Slot {
+    uint32_t pathHash;   // FNV-1a, also picks the slot
+    uint32_t pathCheck;  // sdbm, compared along with pathHash and pathLength
+    uint16_t pathLength;
+    uint16_t reserved;
+    uint32_t fileSize;  // 0 if the slot is empty
+    uint16_t modifyDate;
+    uint16_t modifyTime;
+    uint32_t fingerprint;
+  };
+
+  // Opens the map for reading and writing, creating an empty one unless `create` is false
+  static bool openMap(const std::string& mapPath, FsFile& file, bool create);
+  static std::string formatKey(uint32_t fileSize, uint32_t fingerprint);
+};
@@ -21,7 +21,7 @@ void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffse
     return;
   }
 
-  // Use existing drawBitmap which reads row-by-row for memory efficiency
+  // Cached images are pre-scaled 2bpp BMPs, so drawBitmap takes its unscaled block-read path
   renderer.drawBitmap(bitmap, xPos + xOffset, yPos + yOffset, width, height);
   bmpFile.close();
 }
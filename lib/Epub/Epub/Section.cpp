@@ -1,5 +1,6 @@
 #include "Section.h"
 
+#include <Metrics.h>
 #include <SDCardManager.h>
 #include <Serialization.h>
 
@@ -7,7 +8,7 @@
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 9;
+constexpr uint8_t SECTION_FILE_VERSION = 12;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t);
 }  // namespace
@@ -19,10 +20,16 @@ uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   }
 
   const uint32_t position = file.position();
-  if (!page->serialize(file)) {
+  bool serialized;
+  {
+    metrics::ScopedTimer writeTimer(metrics::Timer::SdWrite);
+    serialized = page->serialize(file);
+  }
+  if (!serialized) {
     Serial.printf("[%lu] [SCT] Failed to serialize page %d\n", millis(), pageCount);
     return 0;
   }
+  metrics::add(metrics::Counter::SdBytesWritten, file.position() - position);
   Serial.printf("[%lu] [SCT] Page %d processed\n", millis(), pageCount);
 
   pageCount++;
@@ -117,6 +124,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const std::function<void()>& progressSetupFn,
                                 const std::function<void(int)>& progressFn) {
+  metrics::ScopedTimer buildTimer(metrics::Timer::SectionBuild);
   constexpr uint32_t MIN_SIZE_FOR_PROGRESS = 50 * 1024;  // 50KB
   const auto localPath = epub->getSpineItem(spineIndex).href;
   const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
@@ -184,8 +192,8 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     }
   }
 
-  // Create image cache directory
-  const std::string imageCacheDir = epub->getCachePath() + "/sections/images";
+  // Create image cache directory, converted images are shared by all sections
+  const std::string imageCacheDir = epub->getCachePath() + "/images";
   SdMan.mkdir(imageCacheDir.c_str());
 
   ChapterHtmlSlimParser visitor(
@@ -230,6 +238,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
 }
 
 std::unique_ptr<Page> Section::loadPageFromSectionFile() {
+  metrics::ScopedTimer loadTimer(metrics::Timer::PageLoad);
   if (!SdMan.openFileForRead("SCT", filePath, file)) {
     return nullptr;
   }
@@ -1,12 +1,16 @@
 #include "ChapterHtmlSlimParser.h"
 
+#include <Bitmap.h>
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
 #include <JpegToBmpConverter.h>
+#include <PngToBmpConverter.h>
 #include <SDCardManager.h>
+#include <ScaledBmpEncoder.h>
 #include <expat.h>
 
 #include <cctype>
+#include <cstdio>
 #include <vector>
 
 #include "../Page.h"
@@ -54,6 +58,14 @@ bool isJpegFile(const std::string& path) {
   return false;
 }
 
+// Check if file extension indicates PNG format
+bool isPngFile(const std::string& path) {
+  if (path.length() < 4) return false;
+  std::string ext = path.substr(path.length() - 4);
+  for (char& c : ext) c = static_cast<char>(tolower(c));
+  return ext == ".png";
+}
+
 // Normalize path by resolving .. and . components
 std::string normalizePath(const std::string& basePath, const std::string& relativePath) {
   // If relativePath is already absolute (starts with /), return as-is
@@ -357,6 +369,17 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       file.close();
       return false;
     }
+
+    // Checked after each chunk, as an image conversion cut short inside it leaves the image out
+    if (epub && epub->isAborted()) {
+      Serial.printf("[%lu] [EHP] Aborted parsing at %zu of %zu bytes\n", millis(), bytesRead, totalSize);
+      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
+      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
+      XML_SetCharacterDataHandler(parser, nullptr);
+      XML_ParserFree(parser);
+      file.close();
+      return false;
+    }
   } while (!done);
 
   XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
@@ -418,72 +441,132 @@ void ChapterHtmlSlimParser::processImage(const char* srcAttr) {
   // Resolve relative path against content base path
   const std::string fullPath = normalizePath(contentBasePath, srcAttr);
 
-  // Check if image is JPEG (only supported format for now)
-  if (!isJpegFile(fullPath)) {
-    Serial.printf("[%lu] [EHP] Skipping non-JPEG image: %s\n", millis(), fullPath.c_str());
+  // Check if image is JPEG or PNG (only supported formats for now)
+  const bool isPng = isPngFile(fullPath);
+  if (!isPng && !isJpegFile(fullPath)) {
+    Serial.printf("[%lu] [EHP] Skipping unsupported image: %s\n", millis(), fullPath.c_str());
     return;
   }
 
-  // Generate unique BMP path in cache directory
-  const std::string bmpPath = imageCacheDir + "/img_" + std::to_string(imageCounter++) + ".bmp";
+  // The converted BMP only depends on the image data, the target box and the dither mode, so it is cached under
+  // those. Re-layouts and images referenced more than once reuse it instead of decoding again.
+  uint32_t crc = 0;
+  size_t itemSize = 0;
+  if (!epub->getItemCrc32(fullPath, &crc, &itemSize)) {
+    Serial.printf("[%lu] [EHP] Image not found in EPUB: %s\n", millis(), fullPath.c_str());
+    return;
+  }
+  char cacheKey[48];
+  snprintf(cacheKey, sizeof(cacheKey), "%08lx_%lx_%dx%d_%u", static_cast<unsigned long>(crc),
+           static_cast<unsigned long>(itemSize), INLINE_IMAGE_MAX_WIDTH, INLINE_IMAGE_MAX_HEIGHT,
+           ScaledBmpEncoder::getOutputMode());
+  const std::string bmpPath = imageCacheDir + "/" + cacheKey + ".bmp";
 
-  // Extract JPEG from EPUB to temp file
-  const std::string tmpJpegPath = imageCacheDir + "/.tmp_img.jpg";
-  FsFile tmpJpeg;
-  if (!SdMan.openFileForWrite("EHP", tmpJpegPath, tmpJpeg)) {
-    Serial.printf("[%lu] [EHP] Failed to create temp JPEG file\n", millis());
+  uint16_t imgWidth = 0;
+  uint16_t imgHeight = 0;
+  if (SdMan.exists(bmpPath.c_str())) {
+    if (readCachedImageSize(bmpPath, &imgWidth, &imgHeight)) {
+      Serial.printf("[%lu] [EHP] Reusing cached image %s -> %s\n", millis(), fullPath.c_str(), bmpPath.c_str());
+    } else {
+      SdMan.remove(bmpPath.c_str());
+    }
+  }
+  if ((imgWidth == 0 || imgHeight == 0) && !convertImage(fullPath, isPng, bmpPath, &imgWidth, &imgHeight)) {
     return;
   }
 
-  if (!epub->readItemContentsToStream(fullPath, tmpJpeg, 1024)) {
+  // Flush any pending text block before adding image
+  if (currentTextBlock && !currentTextBlock->isEmpty()) {
+    makePages();
+  }
+
+  // Add image to page
+  addImageToPage(bmpPath, imgWidth, imgHeight);
+}
+
+bool ChapterHtmlSlimParser::readCachedImageSize(const std::string& bmpPath, uint16_t* width, uint16_t* height) {
+  FsFile bmpFile;
+  if (!SdMan.openFileForRead("EHP", bmpPath, bmpFile)) {
+    return false;
+  }
+
+  Bitmap bitmap(bmpFile);
+  const BmpReaderError err = bitmap.parseHeaders();
+  bmpFile.close();
+  if (err != BmpReaderError::Ok) {
+    Serial.printf("[%lu] [EHP] Discarding cached image %s: %s\n", millis(), bmpPath.c_str(),
+                  Bitmap::errorToString(err));
+    return false;
+  }
+
+  *width = static_cast<uint16_t>(bitmap.getWidth());
+  *height = static_cast<uint16_t>(bitmap.getHeight());
+  return true;
+}
+
+bool ChapterHtmlSlimParser::convertImage(const std::string& fullPath, const bool isPng, const std::string& bmpPath,
+                                         uint16_t* width, uint16_t* height) {
+  // Extract image from EPUB to temp file
+  const std::string tmpImagePath = imageCacheDir + (isPng ? "/.tmp_img.png" : "/.tmp_img.jpg");
+  FsFile tmpImage;
+  if (!SdMan.openFileForWrite("EHP", tmpImagePath, tmpImage)) {
+    Serial.printf("[%lu] [EHP] Failed to create temp image file\n", millis());
+    return false;
+  }
+
+  if (!epub->readItemContentsToStream(fullPath, tmpImage, 1024)) {
     Serial.printf("[%lu] [EHP] Failed to extract image: %s\n", millis(), fullPath.c_str());
-    tmpJpeg.close();
-    SdMan.remove(tmpJpegPath.c_str());
-    return;
+    tmpImage.close();
+    SdMan.remove(tmpImagePath.c_str());
+    return false;
   }
-  tmpJpeg.close();
+  tmpImage.close();
 
-  // Open temp JPEG for reading
-  if (!SdMan.openFileForRead("EHP", tmpJpegPath, tmpJpeg)) {
-    Serial.printf("[%lu] [EHP] Failed to reopen temp JPEG\n", millis());
-    SdMan.remove(tmpJpegPath.c_str());
-    return;
+  // Open temp image for reading
+  if (!SdMan.openFileForRead("EHP", tmpImagePath, tmpImage)) {
+    Serial.printf("[%lu] [EHP] Failed to reopen temp image\n", millis());
+    SdMan.remove(tmpImagePath.c_str());
+    return false;
   }
 
-  // Create output BMP file
+  // Convert into a temp BMP that is only renamed to its cache key once complete, so an interrupted conversion
+  // never leaves a truncated entry behind
+  const std::string tmpBmpPath = imageCacheDir + "/.tmp_img.bmp";
   FsFile bmpFile;
-  if (!SdMan.openFileForWrite("EHP", bmpPath, bmpFile)) {
-    Serial.printf("[%lu] [EHP] Failed to create BMP file: %s\n", millis(), bmpPath.c_str());
-    tmpJpeg.close();
-    SdMan.remove(tmpJpegPath.c_str());
-    return;
+  if (!SdMan.openFileForWrite("EHP", tmpBmpPath, bmpFile)) {
+    Serial.printf("[%lu] [EHP] Failed to create BMP file: %s\n", millis(), tmpBmpPath.c_str());
+    tmpImage.close();
+    SdMan.remove(tmpImagePath.c_str());
+    return false;
   }
 
-  // Convert JPEG to BMP with scaling
+  // Convert image to BMP with scaling
   uint16_t imgWidth = 0;
   uint16_t imgHeight = 0;
-  const bool success = JpegToBmpConverter::jpegFileToBmpStreamScaled(tmpJpeg, bmpFile, INLINE_IMAGE_MAX_WIDTH,
-                                                                     INLINE_IMAGE_MAX_HEIGHT, &imgWidth, &imgHeight);
+  const std::string scratchPath = imageCacheDir + "/.tmp_img.scratch";
+  bool success =
+      isPng ? PngToBmpConverter::pngFileToBmpStreamScaled(tmpImage, bmpFile, INLINE_IMAGE_MAX_WIDTH,
+                                                          INLINE_IMAGE_MAX_HEIGHT, &imgWidth, &imgHeight, scratchPath,
+                                                          epub->getAbortCheck())
+            : JpegToBmpConverter::jpegFileToBmpStreamScaled(tmpImage, bmpFile, INLINE_IMAGE_MAX_WIDTH,
+                                                            INLINE_IMAGE_MAX_HEIGHT, &imgWidth, &imgHeight,
+                                                            scratchPath, epub->getAbortCheck());
+  success = success && imgWidth != 0 && imgHeight != 0 && bmpFile.rename(bmpPath.c_str());
   bmpFile.close();
-  tmpJpeg.close();
-  SdMan.remove(tmpJpegPath.c_str());
+  tmpImage.close();
+  SdMan.remove(tmpImagePath.c_str());
 
-  if (!success || imgWidth == 0 || imgHeight == 0) {
+  if (!success) {
     Serial.printf("[%lu] [EHP] Failed to convert image: %s\n", millis(), fullPath.c_str());
-    SdMan.remove(bmpPath.c_str());
-    return;
+    SdMan.remove(tmpBmpPath.c_str());
+    return false;
   }
 
   Serial.printf("[%lu] [EHP] Converted image %s -> %s (%dx%d)\n", millis(), fullPath.c_str(), bmpPath.c_str(), imgWidth,
                 imgHeight);
-
-  // Flush any pending text block before adding image
-  if (currentTextBlock && !currentTextBlock->isEmpty()) {
-    makePages();
-  }
-
-  // Add image to page
-  addImageToPage(bmpPath, imgWidth, imgHeight);
+  *width = imgWidth;
+  *height = imgHeight;
+  return true;
 }
 
 void ChapterHtmlSlimParser::addImageToPage(const std::string& bmpPath, const uint16_t width, const uint16_t height) {
@@ -42,12 +42,14 @@ class ChapterHtmlSlimParser {
   // Image support
   Epub* epub = nullptr;         // For resource extraction
   std::string contentBasePath;  // Base path for resolving relative image URLs
-  std::string imageCacheDir;    // Directory for cached BMP files
-  int imageCounter = 0;         // Counter for unique image filenames
+  std::string imageCacheDir;    // Directory for cached BMP files, shared by all sections of the book
 
   void startNewTextBlock(TextBlock::Style style);
   void makePages();
   void processImage(const char* srcAttr);
+  static bool readCachedImageSize(const std::string& bmpPath, uint16_t* width, uint16_t* height);
+  bool convertImage(const std::string& fullPath, bool isPng, const std::string& bmpPath, uint16_t* width,
+                    uint16_t* height);
   void addImageToPage(const std::string& bmpPath, uint16_t width, uint16_t height);
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
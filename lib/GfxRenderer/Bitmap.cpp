@@ -19,27 +19,11 @@ Bitmap::~Bitmap() {
   delete fsDitherer;
 }
 
-uint16_t Bitmap::readLE16(FsFile& f) {
-  const int c0 = f.read();
-  const int c1 = f.read();
-  const auto b0 = static_cast<uint8_t>(c0 < 0 ? 0 : c0);
-  const auto b1 = static_cast<uint8_t>(c1 < 0 ? 0 : c1);
-  return static_cast<uint16_t>(b0) | (static_cast<uint16_t>(b1) << 8);
-}
-
-uint32_t Bitmap::readLE32(FsFile& f) {
-  const int c0 = f.read();
-  const int c1 = f.read();
-  const int c2 = f.read();
-  const int c3 = f.read();
-
-  const auto b0 = static_cast<uint8_t>(c0 < 0 ? 0 : c0);
-  const auto b1 = static_cast<uint8_t>(c1 < 0 ? 0 : c1);
-  const auto b2 = static_cast<uint8_t>(c2 < 0 ? 0 : c2);
-  const auto b3 = static_cast<uint8_t>(c3 < 0 ? 0 : c3);
+uint16_t Bitmap::readLE16(const uint8_t* p) { return static_cast<uint16_t>(p[0]) | (static_cast<uint16_t>(p[1]) << 8); }
 
-  return static_cast<uint32_t>(b0) | (static_cast<uint32_t>(b1) << 8) | (static_cast<uint32_t>(b2) << 16) |
-         (static_cast<uint32_t>(b3) << 24);
+uint32_t Bitmap::readLE32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
 }
 
 const char* Bitmap::errorToString(BmpReaderError err) {
@@ -66,6 +50,8 @@ const char* Bitmap::errorToString(BmpReaderError err) {
       return "ImageTooLarge (max 2048x3072)";
     case BmpReaderError::PaletteTooLarge:
       return "PaletteTooLarge";
+    case BmpReaderError::ShortReadPalette:
+      return "ShortReadPalette";
 
     case BmpReaderError::SeekPixelDataFailed:
       return "SeekPixelDataFailed";
@@ -84,25 +70,27 @@ BmpReaderError Bitmap::parseHeaders() {
   if (!file) return BmpReaderError::FileInvalid;
   if (!file.seek(0)) return BmpReaderError::SeekStartFailed;
 
-  // --- BMP FILE HEADER ---
-  const uint16_t bfType = readLE16(file);
-  if (bfType != 0x4D42) return BmpReaderError::NotBMP;
+  // File header, DIB header and a palette of up to 256 entries are fetched in a single read
+  uint8_t header[14 + 40 + 256 * 4];
+  const int headerBytes = file.read(header, sizeof(header));
 
-  file.seekCur(8);
-  bfOffBits = readLE32(file);
+  // --- BMP FILE HEADER ---
+  if (headerBytes < 14 || readLE16(header) != 0x4D42) return BmpReaderError::NotBMP;
+  bfOffBits = readLE32(header + 10);
 
   // --- DIB HEADER ---
-  const uint32_t biSize = readLE32(file);
+  if (headerBytes < 14 + 40) return BmpReaderError::DIBTooSmall;
+  const uint32_t biSize = readLE32(header + 14);
   if (biSize < 40) return BmpReaderError::DIBTooSmall;
 
-  width = static_cast<int32_t>(readLE32(file));
-  const auto rawHeight = static_cast<int32_t>(readLE32(file));
+  width = static_cast<int32_t>(readLE32(header + 18));
+  const auto rawHeight = static_cast<int32_t>(readLE32(header + 22));
   topDown = rawHeight < 0;
   height = topDown ? -rawHeight : rawHeight;
 
-  const uint16_t planes = readLE16(file);
-  bpp = readLE16(file);
-  const uint32_t comp = readLE32(file);
+  const uint16_t planes = readLE16(header + 26);
+  bpp = readLE16(header + 28);
+  const uint32_t comp = readLE32(header + 30);
   const bool validBpp = bpp == 1 || bpp == 2 || bpp == 8 || bpp == 24 || bpp == 32;
 
   if (planes != 1) return BmpReaderError::BadPlanes;
@@ -110,10 +98,9 @@ BmpReaderError Bitmap::parseHeaders() {
   // Allow BI_RGB (0) for all, and BI_BITFIELDS (3) for 32bpp which is common for BGRA masks.
   if (!(comp == 0 || (bpp == 32 && comp == 3))) return BmpReaderError::UnsupportedCompression;
 
-  file.seekCur(12);  // biSizeImage, biXPelsPerMeter, biYPelsPerMeter
-  const uint32_t colorsUsed = readLE32(file);
+  // biSizeImage, biXPelsPerMeter, biYPelsPerMeter are skipped
+  const uint32_t colorsUsed = readLE32(header + 46);
   if (colorsUsed > 256u) return BmpReaderError::PaletteTooLarge;
-  file.seekCur(4);  // biClrImportant
 
   if (width <= 0 || height <= 0) return BmpReaderError::BadDimensions;
 
@@ -129,13 +116,26 @@ BmpReaderError Bitmap::parseHeaders() {
 
   for (int i = 0; i < 256; i++) paletteLum[i] = static_cast<uint8_t>(i);
   if (colorsUsed > 0) {
+    // The palette follows the DIB header, which may be larger than BITMAPINFOHEADER
+    const uint32_t paletteOffset = 14 + biSize;
+    const uint32_t paletteSize = colorsUsed * 4;
+    const uint8_t* palette = header;
+    if (paletteOffset + paletteSize <= static_cast<uint32_t>(headerBytes)) {
+      palette += paletteOffset;
+    } else if (!file.seek(paletteOffset) || file.read(header, paletteSize) != static_cast<int>(paletteSize)) {
+      return BmpReaderError::ShortReadPalette;
+    }
     for (uint32_t i = 0; i < colorsUsed; i++) {
-      uint8_t rgb[4];
-      file.read(rgb, 4);  // Read B, G, R, Reserved in one go
+      const uint8_t* rgb = palette + i * 4;  // B, G, R, Reserved
       paletteLum[i] = (77u * rgb[2] + 150u * rgb[1] + 29u * rgb[0]) >> 8;
     }
   }
 
+  native2Bit = bpp == 2;
+  for (int i = 0; i < 4 && native2Bit; i++) {
+    native2Bit = (paletteLum[i] >> 6) == i;
+  }
+
   if (!file.seek(bfOffBits)) {
     return BmpReaderError::SeekPixelDataFailed;
   }
@@ -248,6 +248,14 @@ BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
   return BmpReaderError::Ok;
 }
 
+BmpReaderError Bitmap::readRawRows(uint8_t* buffer, const int rowCount) const {
+  const int totalBytes = rowBytes * rowCount;
+  if (file.read(buffer, totalBytes) != totalBytes) return BmpReaderError::ShortReadRow;
+
+  prevRowY += rowCount;
+  return BmpReaderError::Ok;
+}
+
 BmpReaderError Bitmap::rewindToData() const {
   if (!file.seek(bfOffBits)) {
     return BmpReaderError::SeekPixelDataFailed;
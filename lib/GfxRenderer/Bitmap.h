@@ -21,6 +21,7 @@ enum class BmpReaderError : uint8_t {
   BadDimensions,
   ImageTooLarge,
   PaletteTooLarge,
+  ShortReadPalette,
 
   SeekPixelDataFailed,
   BufferTooSmall,
@@ -36,16 +37,20 @@ class Bitmap {
   ~Bitmap();
   BmpReaderError parseHeaders();
   BmpReaderError readNextRow(uint8_t* data, uint8_t* rowBuffer) const;
+  // Reads `rowCount` raw rows (getRowBytes() each) in a single file read, without any conversion
+  BmpReaderError readRawRows(uint8_t* buffer, int rowCount) const;
   BmpReaderError rewindToData() const;
   int getWidth() const { return width; }
   int getHeight() const { return height; }
   bool isTopDown() const { return topDown; }
   bool hasGreyscale() const { return bpp > 1; }
   int getRowBytes() const { return rowBytes; }
+  // True for 2bpp images whose palette indices already are the 2-bit output values (as written by our converters)
+  bool isNative2Bit() const { return native2Bit; }
 
  private:
-  static uint16_t readLE16(FsFile& f);
-  static uint32_t readLE32(FsFile& f);
+  static uint16_t readLE16(const uint8_t* p);
+  static uint32_t readLE32(const uint8_t* p);
 
   FsFile& file;
   bool dithering = false;
@@ -55,6 +60,7 @@ class Bitmap {
   uint32_t bfOffBits = 0;
   uint16_t bpp = 0;
   int rowBytes = 0;
+  bool native2Bit = false;
   uint8_t paletteLum[256] = {};
 
   // Floyd-Steinberg dithering state (mutable for const methods)
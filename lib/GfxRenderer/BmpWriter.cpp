@@ -0,0 +1,109 @@
+#include "BmpWriter.h"
+
+#include <HardwareSerial.h>
+#include <Print.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+void putLE16(uint8_t* p, const uint16_t value) {
+  p[0] = value & 0xFF;
+  p[1] = (value >> 8) & 0xFF;
+}
+
+void putLE32(uint8_t* p, const uint32_t value) {
+  p[0] = value & 0xFF;
+  p[1] = (value >> 8) & 0xFF;
+  p[2] = (value >> 16) & 0xFF;
+  p[3] = (value >> 24) & 0xFF;
+}
+}  // namespace
+
+BmpWriter::BmpWriter(Print& out) : out(out), buffer(static_cast<uint8_t*>(malloc(BUFFER_SIZE))) {
+  if (!buffer) {
+    Serial.printf("[%lu] [BMW] Failed to allocate write buffer, writing unbuffered\n", millis());
+  }
+}
+
+BmpWriter::~BmpWriter() {
+  flush();
+  free(buffer);
+}
+
+void BmpWriter::writeHeader(const int width, const int height, const uint16_t bpp) {
+  rowStride = getRowStride(width, bpp);
+  const uint32_t paletteColors = 1u << bpp;
+  const uint32_t dataOffset = 14 + 40 + paletteColors * 4;
+  const uint32_t imageSize = rowStride * height;
+
+  uint8_t header[14 + 40];
+  // BMP File Header (14 bytes)
+  header[0] = 'B';
+  header[1] = 'M';
+  putLE32(header + 2, dataOffset + imageSize);  // File size
+  putLE32(header + 6, 0);                       // Reserved
+  putLE32(header + 10, dataOffset);             // Offset to pixel data
+
+  // DIB Header (BITMAPINFOHEADER - 40 bytes)
+  putLE32(header + 14, 40);
+  putLE32(header + 18, static_cast<uint32_t>(width));
+  putLE32(header + 22, static_cast<uint32_t>(-height));  // Negative height = top-down bitmap
+  putLE16(header + 26, 1);                               // Color planes
+  putLE16(header + 28, bpp);                             // Bits per pixel
+  putLE32(header + 30, 0);                               // BI_RGB (no compression)
+  putLE32(header + 34, imageSize);
+  putLE32(header + 38, 2835);  // xPixelsPerMeter (72 DPI)
+  putLE32(header + 42, 2835);  // yPixelsPerMeter (72 DPI)
+  putLE32(header + 46, paletteColors);
+  putLE32(header + 50, paletteColors);
+  append(header, sizeof(header));
+
+  // Grayscale palette from black to white, BGRA entries
+  for (uint32_t i = 0; i < paletteColors; i++) {
+    const auto level = static_cast<uint8_t>(i * 255 / (paletteColors - 1));
+    const uint8_t entry[4] = {level, level, level, 0};
+    append(entry, sizeof(entry));
+  }
+}
+
+void BmpWriter::writeRow(const uint8_t* row, const size_t length) {
+  static constexpr uint8_t padding[4] = {0, 0, 0, 0};
+
+  append(row, length);
+  for (size_t written = length; written < rowStride; written += sizeof(padding)) {
+    append(padding, std::min(sizeof(padding), rowStride - written));
+  }
+}
+
+bool BmpWriter::flush() {
+  if (buffer && used > 0) {
+    if (out.write(buffer, used) != used) {
+      writeFailed = true;
+    }
+    used = 0;
+  }
+  return !writeFailed;
+}
+
+void BmpWriter::append(const uint8_t* data, size_t length) {
+  if (!buffer) {
+    if (out.write(data, length) != length) {
+      writeFailed = true;
+    }
+    return;
+  }
+
+  while (length > 0) {
+    const size_t chunk = std::min(length, BUFFER_SIZE - used);
+    memcpy(buffer + used, data, chunk);
+    used += chunk;
+    data += chunk;
+    length -= chunk;
+
+    if (used == BUFFER_SIZE) {
+      flush();
+    }
+  }
+}
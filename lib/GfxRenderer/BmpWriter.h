@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class Print;
+
+/**
+ * Buffered writer for top-down grayscale BMP files.
+ * The header, palette and pixel rows are assembled in a fixed buffer that is handed to the output in
+ * BUFFER_SIZE blocks. Since the file starts at the beginning of the buffer, every flush except the last
+ * one covers whole SD sectors.
+ */
+class BmpWriter {
+ public:
+  static constexpr size_t BUFFER_SIZE = 4096;  // 8 SD sectors
+
+  explicit BmpWriter(Print& out);
+  ~BmpWriter();
+
+  BmpWriter(const BmpWriter&) = delete;
+  BmpWriter& operator=(const BmpWriter&) = delete;
+
+  // Row stride in bytes for the given width and bit depth (rows are padded to 4 bytes)
+  static int getRowStride(int width, int bpp) { return (width * bpp + 31) / 32 * 4; }
+
+  // Writes the file header, BITMAPINFOHEADER and an evenly spaced grayscale palette (1, 2 or 8 bpp)
+  void writeHeader(int width, int height, uint16_t bpp);
+  // Writes one row of packed pixels, zero padding it up to the row stride
+  void writeRow(const uint8_t* row, size_t length);
+  // Hands any buffered bytes to the output, returns false if any write so far came up short
+  bool flush();
+
+ private:
+  void append(const uint8_t* data, size_t length);
+
+  Print& out;
+  uint8_t* buffer;
+  size_t used = 0;
+  size_t rowStride = 0;
+  bool writeFailed = false;
+};
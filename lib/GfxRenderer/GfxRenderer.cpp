@@ -1,5 +1,6 @@
 #include "GfxRenderer.h"
 
+#include <Metrics.h>
 #include <Utf8.h>
 
 void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
@@ -105,8 +106,14 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
   }
 
   uint32_t cp;
+  uint32_t prevCp = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    cp = font.applyLigatures(cp, &text, style);
+    if (prevCp) {
+      xpos += font.getKerning(prevCp, cp, style);
+    }
     renderChar(font, cp, &xpos, &yPos, black, style);
+    prevCp = cp;
   }
 }
 
@@ -171,6 +178,11 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   }
   Serial.printf("[%lu] [GFX] Scaling by %f - %s\n", millis(), scale, isScaled ? "scaled" : "not scaled");
 
+  if (!isScaled && cropPixX == 0 && cropPixY == 0 && bitmap.isNative2Bit()) {
+    drawNative2BitBitmap(bitmap, x, y);
+    return;
+  }
+
   // Calculate output row size (2 bits per pixel, packed into bytes)
   // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
@@ -234,6 +246,121 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   free(rowBytes);
 }
 
+/**
+ * Fast path for the pre-scaled 2bpp BMPs written by our own converters.
+ * Rows are read in blocks and painted with draw2BitRow.
+ */
+void GfxRenderer::drawNative2BitBitmap(const Bitmap& bitmap, const int x, const int y) const {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer in drawNative2BitBitmap\n", millis());
+    return;
+  }
+
+  uint8_t paintMask[256];
+  build2BitPaintMask(paintMask);
+
+  const int width = bitmap.getWidth();
+  const int height = bitmap.getHeight();
+  const int rowBytes = bitmap.getRowBytes();
+  const int rowsPerBlock = std::max(1, BITMAP_READ_BLOCK_SIZE / rowBytes);
+  auto* block = static_cast<uint8_t*>(malloc(rowsPerBlock * rowBytes));
+  if (!block) {
+    Serial.printf("[%lu] [GFX] !! Failed to allocate BMP block buffer\n", millis());
+    return;
+  }
+
+  for (int blockY = 0; blockY < height; blockY += rowsPerBlock) {
+    const int rows = std::min(rowsPerBlock, height - blockY);
+    if (bitmap.readRawRows(block, rows) != BmpReaderError::Ok) {
+      Serial.printf("[%lu] [GFX] Failed to read rows %d-%d from bitmap\n", millis(), blockY, blockY + rows - 1);
+      break;
+    }
+
+    for (int row = 0; row < rows; row++) {
+      const int bmpY = blockY + row;
+      const int screenY = y + (bitmap.isTopDown() ? bmpY : height - 1 - bmpY);
+      draw2BitRow(frameBuffer, paintMask, block + row * rowBytes, x, screenY, width);
+    }
+  }
+
+  free(block);
+}
+
+void GfxRenderer::draw2BitImage(const uint8_t* data, const int x, const int y, const int width,
+                                const int height) const {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer in draw2BitImage\n", millis());
+    return;
+  }
+
+  uint8_t paintMask[256];
+  build2BitPaintMask(paintMask);
+
+  const int rowBytes = (width + 3) / 4;
+  for (int row = 0; row < height; row++) {
+    draw2BitRow(frameBuffer, paintMask, data + row * rowBytes, x, y + row, width);
+  }
+}
+
+// Bit 3 - p is set when pixel p (0 = leftmost) of a packed 2bpp byte is painted in the current render mode
+void GfxRenderer::build2BitPaintMask(uint8_t* paintMask) const {
+  for (int value = 0; value < 256; value++) {
+    uint8_t mask = 0;
+    for (int p = 0; p < 4; p++) {
+      const uint8_t val = (value >> (6 - p * 2)) & 0x3;
+      if ((renderMode == BW && val < 3) || (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) ||
+          (renderMode == GRAYSCALE_LSB && val == 1)) {
+        mask |= 0x8 >> p;
+      }
+    }
+    paintMask[value] = mask;
+  }
+}
+
+/**
+ * Paints one row of packed 2bpp pixels straight into the frame buffer.
+ * Each source byte (4 pixels) is mapped through the paint mask, so fully untouched bytes are skipped without
+ * per-pixel work.
+ */
+void GfxRenderer::draw2BitRow(uint8_t* frameBuffer, const uint8_t* paintMask, const uint8_t* src, const int x,
+                              const int screenY, const int width) const {
+  if (screenY < 0 || screenY >= getScreenHeight()) {
+    return;
+  }
+
+  // BW paints black (clears bits), the grayscale passes flag pixels by setting bits
+  const bool clearBits = renderMode == BW;
+  const int xEnd = std::min(x + width, getScreenWidth());
+  const int usedRowBytes = (xEnd - x + 3) / 4;
+
+  for (int byteX = 0; byteX < usedRowBytes; byteX++) {
+    const uint8_t mask = paintMask[src[byteX]];
+    if (!mask) {
+      continue;
+    }
+
+    for (int p = 0; p < 4; p++) {
+      const int screenX = x + byteX * 4 + p;
+      if (!(mask & (0x8 >> p)) || screenX < 0 || screenX >= xEnd) {
+        continue;
+      }
+
+      int rotatedX = 0;
+      int rotatedY = 0;
+      rotateCoordinates(screenX, screenY, &rotatedX, &rotatedY);
+      const uint32_t byteIndex = rotatedY * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+      const uint8_t bit = 1 << (7 - (rotatedX % 8));
+      if (clearBits) {
+        frameBuffer[byteIndex] &= ~bit;
+      } else {
+        frameBuffer[byteIndex] |= bit;
+      }
+    }
+  }
+}
+
 void GfxRenderer::clearScreen(const uint8_t color) const { einkDisplay.clearScreen(color); }
 
 void GfxRenderer::invertScreen() const {
@@ -248,6 +375,7 @@ void GfxRenderer::invertScreen() const {
 }
 
 void GfxRenderer::displayBuffer(const EInkDisplay::RefreshMode refreshMode) const {
+  metrics::ScopedTimer refreshTimer(metrics::Timer::DisplayRefresh);
   einkDisplay.displayBuffer(refreshMode);
 }
 
@@ -263,7 +391,11 @@ std::string GfxRenderer::truncatedText(const int fontId, const char* text, const
 }
 
 // Note: Internal driver treats screen in command orientation; this library exposes a logical orientation
-int GfxRenderer::getScreenWidth() const {
+int GfxRenderer::getScreenWidth() const { return getScreenWidth(orientation); }
+
+int GfxRenderer::getScreenHeight() const { return getScreenHeight(orientation); }
+
+int GfxRenderer::getScreenWidth(const Orientation orientation) {
   switch (orientation) {
     case Portrait:
     case PortraitInverted:
@@ -277,7 +409,7 @@ int GfxRenderer::getScreenWidth() const {
   return EInkDisplay::DISPLAY_HEIGHT;
 }
 
-int GfxRenderer::getScreenHeight() const {
+int GfxRenderer::getScreenHeight(const Orientation orientation) {
   switch (orientation) {
     case Portrait:
     case PortraitInverted:
@@ -424,7 +556,9 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   int yPos = y;  // Current Y position (decreases as we draw characters)
 
   uint32_t cp;
+  uint32_t prevCp = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    cp = font.applyLigatures(cp, &text, style);
     const EpdGlyph* glyph = font.getGlyph(cp, style);
     if (!glyph) {
       glyph = font.getGlyph('?', style);
@@ -433,6 +567,11 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
       continue;
     }
 
+    if (prevCp) {
+      yPos -= font.getKerning(prevCp, cp, style);
+    }
+    prevCp = cp;
+
     const int is2Bit = font.getData(style)->is2Bit;
     const uint32_t offset = glyph->dataOffset;
     const uint8_t width = glyph->width;
@@ -492,7 +631,10 @@ void GfxRenderer::copyGrayscaleLsbBuffers() const { einkDisplay.copyGrayscaleLsb
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { einkDisplay.copyGrayscaleMsbBuffers(einkDisplay.getFrameBuffer()); }
 
-void GfxRenderer::displayGrayBuffer() const { einkDisplay.displayGrayBuffer(); }
+void GfxRenderer::displayGrayBuffer() const {
+  metrics::ScopedTimer refreshTimer(metrics::Timer::DisplayRefresh);
+  einkDisplay.displayGrayBuffer();
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -666,6 +808,11 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
 }
 
 void GfxRenderer::getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
+  getOrientedViewableTRBL(orientation, outTop, outRight, outBottom, outLeft);
+}
+
+void GfxRenderer::getOrientedViewableTRBL(const Orientation orientation, int* outTop, int* outRight, int* outBottom,
+                                          int* outLeft) {
   switch (orientation) {
     case Portrait:
       *outTop = VIEWABLE_MARGIN_TOP;
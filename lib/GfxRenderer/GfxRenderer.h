@@ -22,6 +22,7 @@ class GfxRenderer {
  private:
   static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = EInkDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
+  static constexpr int BITMAP_READ_BLOCK_SIZE = 4096;  // Rows are read from SD in blocks of up to this many bytes
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == EInkDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
 
@@ -32,6 +33,10 @@ class GfxRenderer {
   std::map<int, EpdFontFamily> fontMap;
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
+  void drawNative2BitBitmap(const Bitmap& bitmap, int x, int y) const;
+  void build2BitPaintMask(uint8_t* paintMask) const;
+  void draw2BitRow(uint8_t* frameBuffer, const uint8_t* paintMask, const uint8_t* src, int x, int screenY,
+                   int width) const;
   void freeBwBufferChunks();
   void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) const;
 
@@ -54,6 +59,9 @@ class GfxRenderer {
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
+  // Logical size in the given orientation, for laying out pages without switching the renderer to it
+  static int getScreenWidth(Orientation orientation);
+  static int getScreenHeight(Orientation orientation);
   void displayBuffer(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH) const;
   // EXPERIMENTAL: Windowed update - display only a rectangular region
   void displayWindow(int x, int y, int width, int height) const;
@@ -68,6 +76,8 @@ class GfxRenderer {
   void drawImage(const uint8_t bitmap[], int x, int y, int width, int height) const;
   void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight, float cropX = 0,
                   float cropY = 0) const;
+  // Unscaled packed 2bpp pixels (0 = black ... 3 = white), rows of (width + 3) / 4 bytes, top-down
+  void draw2BitImage(const uint8_t* data, int x, int y, int width, int height) const;
 
   // Text
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
@@ -106,4 +116,6 @@ class GfxRenderer {
   static size_t getBufferSize();
   void grayscaleRevert() const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
+  static void getOrientedViewableTRBL(Orientation orientation, int* outTop, int* outRight, int* outBottom,
+                                      int* outLeft);
 };
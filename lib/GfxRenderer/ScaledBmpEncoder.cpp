@@ -0,0 +1,185 @@
+#include "ScaledBmpEncoder.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "BitmapHelpers.h"
+
+// ============================================================================
+// IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
+// ============================================================================
+constexpr bool USE_8BIT_OUTPUT = false;  // true: 8-bit grayscale (no quantization), false: 2-bit (4 levels)
+// Dithering method selection (only one should be true, or all false for simple quantization):
+constexpr bool USE_ATKINSON = true;          // Atkinson dithering (cleaner than F-S, less error diffusion)
+constexpr bool USE_FLOYD_STEINBERG = false;  // Floyd-Steinberg error diffusion (can cause "worm" artifacts)
+// Pre-resize to target display size (CRITICAL: avoids dithering artifacts from post-downsampling)
+constexpr bool USE_PRESCALE = true;  // true: scale image to target size before dithering
+// ============================================================================
+
+void ScaledBmpEncoder::getOutputSize(const int srcWidth, const int srcHeight, const int targetMaxWidth,
+                                     const int targetMaxHeight, int* outWidth, int* outHeight) {
+  *outWidth = srcWidth;
+  *outHeight = srcHeight;
+  if (!USE_PRESCALE || (srcWidth <= targetMaxWidth && srcHeight <= targetMaxHeight)) {
+    return;
+  }
+
+  // Calculate scale to fit within target dimensions while maintaining aspect ratio
+  const float scaleToFitWidth = static_cast<float>(targetMaxWidth) / srcWidth;
+  const float scaleToFitHeight = static_cast<float>(targetMaxHeight) / srcHeight;
+  // We scale to the smaller dimension, so we can potentially crop later.
+  // TODO: ideally, we already crop here.
+  const float scale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+
+  *outWidth = static_cast<int>(srcWidth * scale);
+  *outHeight = static_cast<int>(srcHeight * scale);
+
+  // Ensure at least 1 pixel
+  if (*outWidth < 1) *outWidth = 1;
+  if (*outHeight < 1) *outHeight = 1;
+}
+
+uint8_t ScaledBmpEncoder::getOutputMode() {
+  return (USE_8BIT_OUTPUT ? 1 : 0) | (USE_ATKINSON ? 2 : 0) | (USE_FLOYD_STEINBERG ? 4 : 0) | (USE_PRESCALE ? 8 : 0);
+}
+
+ScaledBmpEncoder::ScaledBmpEncoder(Print& out, const int srcWidth, const int srcHeight, const int targetMaxWidth,
+                                   const int targetMaxHeight)
+    : bmpWriter(out), srcWidth(srcWidth) {
+  getOutputSize(srcWidth, srcHeight, targetMaxWidth, targetMaxHeight, &bmpWidth, &bmpHeight);
+  if (bmpWidth != srcWidth || bmpHeight != srcHeight) {
+    // Calculate fixed-point scale factors (source pixels per output pixel)
+    // scaleX_fp = (srcWidth << 16) / bmpWidth
+    scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / bmpWidth;
+    scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / bmpHeight;
+    needsScaling = true;
+  }
+}
+
+ScaledBmpEncoder::~ScaledBmpEncoder() {
+  delete[] rowAccum;
+  delete[] rowCount;
+  delete atkinsonDitherer;
+  delete fsDitherer;
+  free(rowBuffer);
+}
+
+bool ScaledBmpEncoder::begin() {
+  // Write BMP header with output dimensions (8-bit grayscale or 2-bit)
+  const int bpp = USE_8BIT_OUTPUT ? 8 : 2;
+  bytesPerRow = BmpWriter::getRowStride(bmpWidth, bpp);
+  rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
+  if (!rowBuffer) {
+    return false;
+  }
+  bmpWriter.writeHeader(bmpWidth, bmpHeight, bpp);
+
+  // Create ditherer if enabled (only for 2-bit output)
+  // Use OUTPUT dimensions for dithering (after prescaling)
+  if (!USE_8BIT_OUTPUT) {
+    if (USE_ATKINSON) {
+      atkinsonDitherer = new AtkinsonDitherer(bmpWidth);
+    } else if (USE_FLOYD_STEINBERG) {
+      fsDitherer = new FloydSteinbergDitherer(bmpWidth);
+    }
+  }
+
+  // Using fixed-point: srcY_fp = outY * scaleY_fp (gives source Y in 16.16 format)
+  if (needsScaling) {
+    rowAccum = new uint32_t[bmpWidth]();
+    rowCount = new uint16_t[bmpWidth]();
+    nextOutY_srcStart = scaleY_fp;  // First boundary is at scaleY_fp (source Y for outY=1)
+  }
+
+  memset(rowBuffer, 0, bytesPerRow);
+  return true;
+}
+
+void ScaledBmpEncoder::writeSourceRow(const uint8_t* gray) {
+  const int y = srcY++;
+
+  if (!needsScaling) {
+    // No scaling - direct output (1:1 mapping)
+    for (int x = 0; x < bmpWidth; x++) {
+      writePixel(gray[x], x, y);
+    }
+    writeRow();
+    return;
+  }
+
+  // Fixed-point area averaging for exact fit scaling
+  // For each output pixel X, accumulate source pixels that map to it
+  // srcX range for bmpX: [bmpX * scaleX_fp >> 16, (bmpX+1) * scaleX_fp >> 16)
+  for (int bmpX = 0; bmpX < bmpWidth; bmpX++) {
+    // Calculate source X range for this output pixel
+    const int srcXStart = (static_cast<uint32_t>(bmpX) * scaleX_fp) >> 16;
+    const int srcXEnd = (static_cast<uint32_t>(bmpX + 1) * scaleX_fp) >> 16;
+
+    // Accumulate all source pixels in this range
+    int sum = 0;
+    int count = 0;
+    for (int srcX = srcXStart; srcX < srcXEnd && srcX < srcWidth; srcX++) {
+      sum += gray[srcX];
+      count++;
+    }
+
+    // Handle edge case: if no pixels in range, use nearest
+    if (count == 0 && srcXStart < srcWidth) {
+      sum = gray[srcXStart];
+      count = 1;
+    }
+
+    rowAccum[bmpX] += sum;
+    rowCount[bmpX] += count;
+  }
+
+  // Output row when source Y crosses the boundary
+  const uint32_t srcY_fp = static_cast<uint32_t>(y + 1) << 16;
+  if (srcY_fp >= nextOutY_srcStart && currentOutY < bmpHeight) {
+    for (int x = 0; x < bmpWidth; x++) {
+      writePixel((rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0, x, currentOutY);
+    }
+    writeRow();
+    currentOutY++;
+
+    // Reset accumulators for next output row
+    memset(rowAccum, 0, bmpWidth * sizeof(uint32_t));
+    memset(rowCount, 0, bmpWidth * sizeof(uint16_t));
+
+    // Update boundary for next output row
+    nextOutY_srcStart = static_cast<uint32_t>(currentOutY + 1) * scaleY_fp;
+  }
+}
+
+bool ScaledBmpEncoder::finish() { return bmpWriter.flush(); }
+
+void ScaledBmpEncoder::writePixel(const int gray, const int x, const int y) {
+  if (USE_8BIT_OUTPUT) {
+    rowBuffer[x] = adjustPixel(gray);
+    return;
+  }
+
+  const int adjusted = adjustPixel(gray);
+  uint8_t twoBit;
+  if (atkinsonDitherer) {
+    twoBit = atkinsonDitherer->processPixel(adjusted, x);
+  } else if (fsDitherer) {
+    twoBit = fsDitherer->processPixel(adjusted, x);
+  } else {
+    twoBit = quantize(adjusted, x, y);
+  }
+  const int byteIndex = (x * 2) / 8;
+  const int bitOffset = 6 - ((x * 2) % 8);
+  rowBuffer[byteIndex] |= (twoBit << bitOffset);
+}
+
+void ScaledBmpEncoder::writeRow() {
+  if (atkinsonDitherer) {
+    atkinsonDitherer->nextRow();
+  } else if (fsDitherer) {
+    fsDitherer->nextRow();
+  }
+
+  bmpWriter.writeRow(rowBuffer, bytesPerRow);
+  memset(rowBuffer, 0, bytesPerRow);
+}
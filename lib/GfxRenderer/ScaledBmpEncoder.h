@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+
+#include "BmpWriter.h"
+
+class AtkinsonDitherer;
+class FloydSteinbergDitherer;
+class Print;
+
+/**
+ * Turns a stream of 8-bit grayscale source rows into a dithered BMP.
+ * Images larger than the target box are area-averaged down so they fill it while keeping their aspect ratio.
+ * The result is then dithered to 2 bits per pixel. Only one source row and one output row are held at a time,
+ * so decoders can hand over rows as they produce them.
+ */
+class ScaledBmpEncoder {
+ public:
+  // Default size limits for cover images (portrait display size)
+  static constexpr int COVER_MAX_WIDTH = 480;
+  static constexpr int COVER_MAX_HEIGHT = 800;
+
+  ScaledBmpEncoder(Print& out, int srcWidth, int srcHeight, int targetMaxWidth, int targetMaxHeight);
+  ~ScaledBmpEncoder();
+
+  ScaledBmpEncoder(const ScaledBmpEncoder&) = delete;
+  ScaledBmpEncoder& operator=(const ScaledBmpEncoder&) = delete;
+
+  // Output size for a source image, lets decoders that can downscale cheaply pick their resolution up front
+  static void getOutputSize(int srcWidth, int srcHeight, int targetMaxWidth, int targetMaxHeight, int* outWidth,
+                            int* outHeight);
+  // Identifies the bit depth and dithering settings, so cached conversions can be keyed on them
+  static uint8_t getOutputMode();
+
+  // Allocates the working buffers and writes the BMP header, returns false if out of memory
+  bool begin();
+  // Consumes the next source row (srcWidth grayscale pixels, top to bottom)
+  void writeSourceRow(const uint8_t* gray);
+  // Flushes buffered output, returns false if writing the BMP failed
+  bool finish();
+
+  bool isScaled() const { return needsScaling; }
+  int getWidth() const { return bmpWidth; }
+  int getHeight() const { return bmpHeight; }
+
+ private:
+  void writePixel(int gray, int x, int y);
+  void writeRow();
+
+  BmpWriter bmpWriter;
+  int srcWidth;
+  int bmpWidth;
+  int bmpHeight;
+  int bytesPerRow = 0;
+  // Fixed-point (16.16) source pixels per output pixel
+  uint32_t scaleX_fp = 65536;
+  uint32_t scaleY_fp = 65536;
+  bool needsScaling = false;
+
+  uint8_t* rowBuffer = nullptr;
+  AtkinsonDitherer* atkinsonDitherer = nullptr;
+  FloydSteinbergDitherer* fsDitherer = nullptr;
+
+  // For scaling: accumulate source rows into scaled output rows
+  uint32_t* rowAccum = nullptr;    // Accumulator for each output X (32-bit for larger sums)
+  uint16_t* rowCount = nullptr;    // Count of source pixels accumulated per output X
+  int srcY = 0;                    // Next source row
+  int currentOutY = 0;             // Current output row being accumulated
+  uint32_t nextOutY_srcStart = 0;  // Source Y where next output row starts (16.16 fixed point)
+};
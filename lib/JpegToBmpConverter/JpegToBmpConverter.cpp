@@ -1,13 +1,16 @@
 #include "JpegToBmpConverter.h"
 
 #include <HardwareSerial.h>
+#include <Metrics.h>
 #include <SdFat.h>
 #include <picojpeg.h>
 
 #include <cstdio>
 #include <cstring>
+#include <memory>
 
-#include "BitmapHelpers.h"
+#include "ProgressiveJpegDecoder.h"
+#include "ScaledBmpEncoder.h"
 
 // Context structure for picojpeg callback
 struct JpegReadContext {
@@ -17,115 +20,10 @@ struct JpegReadContext {
   size_t bufferFilled;
 };
 
-// ============================================================================
-// IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
-// ============================================================================
-constexpr bool USE_8BIT_OUTPUT = false;  // true: 8-bit grayscale (no quantization), false: 2-bit (4 levels)
-// Dithering method selection (only one should be true, or all false for simple quantization):
-constexpr bool USE_ATKINSON = true;          // Atkinson dithering (cleaner than F-S, less error diffusion)
-constexpr bool USE_FLOYD_STEINBERG = false;  // Floyd-Steinberg error diffusion (can cause "worm" artifacts)
-constexpr bool USE_NOISE_DITHERING = false;  // Hash-based noise dithering (good for downsampling)
-// Pre-resize to target display size (CRITICAL: avoids dithering artifacts from post-downsampling)
-constexpr bool USE_PRESCALE = true;     // true: scale image to target size before dithering
-constexpr int TARGET_MAX_WIDTH = 480;   // Max width for cover images (portrait display width)
-constexpr int TARGET_MAX_HEIGHT = 800;  // Max height for cover images (portrait display height)
-// ============================================================================
-
-inline void write16(Print& out, const uint16_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-}
-
-inline void write32(Print& out, const uint32_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-  out.write((value >> 16) & 0xFF);
-  out.write((value >> 24) & 0xFF);
-}
-
-inline void write32Signed(Print& out, const int32_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-  out.write((value >> 16) & 0xFF);
-  out.write((value >> 24) & 0xFF);
-}
-
-// Helper function: Write BMP header with 8-bit grayscale (256 levels)
-void writeBmpHeader8bit(Print& bmpOut, const int width, const int height) {
-  // Calculate row padding (each row must be multiple of 4 bytes)
-  const int bytesPerRow = (width + 3) / 4 * 4;  // 8 bits per pixel, padded
-  const int imageSize = bytesPerRow * height;
-  const uint32_t paletteSize = 256 * 4;  // 256 colors * 4 bytes (BGRA)
-  const uint32_t fileSize = 14 + 40 + paletteSize + imageSize;
-
-  // BMP File Header (14 bytes)
-  bmpOut.write('B');
-  bmpOut.write('M');
-  write32(bmpOut, fileSize);
-  write32(bmpOut, 0);                      // Reserved
-  write32(bmpOut, 14 + 40 + paletteSize);  // Offset to pixel data
-
-  // DIB Header (BITMAPINFOHEADER - 40 bytes)
-  write32(bmpOut, 40);
-  write32Signed(bmpOut, width);
-  write32Signed(bmpOut, -height);  // Negative height = top-down bitmap
-  write16(bmpOut, 1);              // Color planes
-  write16(bmpOut, 8);              // Bits per pixel (8 bits)
-  write32(bmpOut, 0);              // BI_RGB (no compression)
-  write32(bmpOut, imageSize);
-  write32(bmpOut, 2835);  // xPixelsPerMeter (72 DPI)
-  write32(bmpOut, 2835);  // yPixelsPerMeter (72 DPI)
-  write32(bmpOut, 256);   // colorsUsed
-  write32(bmpOut, 256);   // colorsImportant
-
-  // Color Palette (256 grayscale entries x 4 bytes = 1024 bytes)
-  for (int i = 0; i < 256; i++) {
-    bmpOut.write(static_cast<uint8_t>(i));  // Blue
-    bmpOut.write(static_cast<uint8_t>(i));  // Green
-    bmpOut.write(static_cast<uint8_t>(i));  // Red
-    bmpOut.write(static_cast<uint8_t>(0));  // Reserved
-  }
-}
-
-// Helper function: Write BMP header with 2-bit color depth
-static void writeBmpHeader(Print& bmpOut, const int width, const int height) {
-  // Calculate row padding (each row must be multiple of 4 bytes)
-  const int bytesPerRow = (width * 2 + 31) / 32 * 4;  // 2 bits per pixel, round up
-  const int imageSize = bytesPerRow * height;
-  const uint32_t fileSize = 70 + imageSize;  // 14 (file header) + 40 (DIB header) + 16 (palette) + image
-
-  // BMP File Header (14 bytes)
-  bmpOut.write('B');
-  bmpOut.write('M');
-  write32(bmpOut, fileSize);  // File size
-  write32(bmpOut, 0);         // Reserved
-  write32(bmpOut, 70);        // Offset to pixel data
-
-  // DIB Header (BITMAPINFOHEADER - 40 bytes)
-  write32(bmpOut, 40);
-  write32Signed(bmpOut, width);
-  write32Signed(bmpOut, -height);  // Negative height = top-down bitmap
-  write16(bmpOut, 1);              // Color planes
-  write16(bmpOut, 2);              // Bits per pixel (2 bits)
-  write32(bmpOut, 0);              // BI_RGB (no compression)
-  write32(bmpOut, imageSize);
-  write32(bmpOut, 2835);  // xPixelsPerMeter (72 DPI)
-  write32(bmpOut, 2835);  // yPixelsPerMeter (72 DPI)
-  write32(bmpOut, 4);     // colorsUsed
-  write32(bmpOut, 4);     // colorsImportant
-
-  // Color Palette (4 colors x 4 bytes = 16 bytes)
-  // Format: Blue, Green, Red, Reserved (BGRA)
-  uint8_t palette[16] = {
-      0x00, 0x00, 0x00, 0x00,  // Color 0: Black
-      0x55, 0x55, 0x55, 0x00,  // Color 1: Dark gray (85)
-      0xAA, 0xAA, 0xAA, 0x00,  // Color 2: Light gray (170)
-      0xFF, 0xFF, 0xFF, 0x00   // Color 3: White
-  };
-  for (const uint8_t i : palette) {
-    bmpOut.write(i);
-  }
-}
+// Safety limits to prevent memory issues on ESP32
+constexpr int MAX_IMAGE_WIDTH = 2048;
+constexpr int MAX_IMAGE_HEIGHT = 3072;
+constexpr int MAX_MCU_ROW_BYTES = 65536;
 
 // Callback function for picojpeg to read JPEG data
 static unsigned char jpegReadCallback(unsigned char* pBuf, const unsigned char buf_size,
@@ -159,9 +57,66 @@ static unsigned char jpegReadCallback(unsigned char* pBuf, const unsigned char b
   return 0;  // Success
 }
 
+// picojpeg only handles baseline files, progressive ones are decoded at reduced resolution instead
+static bool progressiveJpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut, const int targetMaxWidth,
+                                           const int targetMaxHeight, uint16_t* outWidth, uint16_t* outHeight,
+                                           const std::string& scratchPath,
+                                           const std::function<bool()>& shouldAbort) {
+  const std::unique_ptr<ProgressiveJpegDecoder> decoder(new ProgressiveJpegDecoder(jpegFile, scratchPath));
+  if (!decoder->readFrameHeader()) {
+    Serial.printf("[%lu] [JPG] Unsupported JPEG frame type\n", millis());
+    return false;
+  }
+
+  const int width = decoder->getWidth();
+  const int height = decoder->getHeight();
+  Serial.printf("[%lu] [JPG] Progressive JPEG dimensions: %dx%d\n", millis(), width, height);
+
+  if (width > MAX_IMAGE_WIDTH || height > MAX_IMAGE_HEIGHT) {
+    Serial.printf("[%lu] [JPG] Image too large (%dx%d), max supported: %dx%d\n", millis(), width, height,
+                  MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
+    return false;
+  }
+
+  // Keep only as many DCT frequencies per block as the output resolution needs (1x1 to 8x8)
+  int fitWidth;
+  int fitHeight;
+  ScaledBmpEncoder::getOutputSize(width, height, targetMaxWidth, targetMaxHeight, &fitWidth, &fitHeight);
+  int scale = 1;
+  while (scale < 8 && ((width * scale + 7) / 8 < fitWidth || (height * scale + 7) / 8 < fitHeight)) {
+    scale *= 2;
+  }
+
+  if (!decoder->decodeScans(scale, shouldAbort)) {
+    return false;
+  }
+
+  ScaledBmpEncoder encoder(bmpOut, decoder->getScaledWidth(), decoder->getScaledHeight(), targetMaxWidth,
+                           targetMaxHeight);
+  if (!encoder.begin()) {
+    Serial.printf("[%lu] [JPG] Failed to allocate row buffer\n", millis());
+    return false;
+  }
+  if (!decoder->writeRows(encoder)) {
+    return false;
+  }
+  if (!encoder.finish()) {
+    Serial.printf("[%lu] [JPG] Failed to write BMP output\n", millis());
+    return false;
+  }
+
+  if (outWidth) *outWidth = static_cast<uint16_t>(encoder.getWidth());
+  if (outHeight) *outHeight = static_cast<uint16_t>(encoder.getHeight());
+
+  Serial.printf("[%lu] [JPG] Successfully converted progressive JPEG to BMP\n", millis());
+  return true;
+}
+
 // Internal implementation with configurable size limits
 static bool jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bmpOut, const int targetMaxWidth,
-                                        const int targetMaxHeight, uint16_t* outWidth, uint16_t* outHeight) {
+                                        const int targetMaxHeight, uint16_t* outWidth, uint16_t* outHeight,
+                                        const std::string& scratchPath, const std::function<bool()>& shouldAbort) {
+  metrics::ScopedTimer conversionTimer(metrics::Timer::ImageConversion);
   Serial.printf("[%lu] [JPG] Converting JPEG to BMP\n", millis());
 
   // Setup context for picojpeg callback
@@ -170,6 +125,10 @@ static bool jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bmpOut, const i
   // Initialize picojpeg decoder
   pjpeg_image_info_t imageInfo;
   const unsigned char status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 0);
+  if (status == PJPG_UNSUPPORTED_MODE) {
+    return progressiveJpegFileToBmpStream(jpegFile, bmpOut, targetMaxWidth, targetMaxHeight, outWidth, outHeight,
+                                          scratchPath, shouldAbort);
+  }
   if (status != 0) {
     Serial.printf("[%lu] [JPG] JPEG decode init failed with error code: %d\n", millis(), status);
     return false;
@@ -178,117 +137,74 @@ static bool jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bmpOut, const i
   Serial.printf("[%lu] [JPG] JPEG dimensions: %dx%d, components: %d, MCUs: %dx%d\n", millis(), imageInfo.m_width,
                 imageInfo.m_height, imageInfo.m_comps, imageInfo.m_MCUSPerRow, imageInfo.m_MCUSPerCol);
 
-  // Safety limits to prevent memory issues on ESP32
-  constexpr int MAX_IMAGE_WIDTH = 2048;
-  constexpr int MAX_IMAGE_HEIGHT = 3072;
-  constexpr int MAX_MCU_ROW_BYTES = 65536;
-
   if (imageInfo.m_width > MAX_IMAGE_WIDTH || imageInfo.m_height > MAX_IMAGE_HEIGHT) {
     Serial.printf("[%lu] [JPG] Image too large (%dx%d), max supported: %dx%d\n", millis(), imageInfo.m_width,
                   imageInfo.m_height, MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
     return false;
   }
 
-  // Calculate output dimensions (pre-scale to fit display exactly)
-  int bmpWidth = imageInfo.m_width;
-  int bmpHeight = imageInfo.m_height;
-  // Use fixed-point scaling (16.16) for sub-pixel accuracy
-  uint32_t scaleX_fp = 65536;  // 1.0 in 16.16 fixed point
-  uint32_t scaleY_fp = 65536;
-  bool needsScaling = false;
-
-  if (USE_PRESCALE && (imageInfo.m_width > targetMaxWidth || imageInfo.m_height > targetMaxHeight)) {
-    // Calculate scale to fit within target dimensions while maintaining aspect ratio
-    const float scaleToFitWidth = static_cast<float>(targetMaxWidth) / imageInfo.m_width;
-    const float scaleToFitHeight = static_cast<float>(targetMaxHeight) / imageInfo.m_height;
-    // We scale to the smaller dimension, so we can potentially crop later.
-    // TODO: ideally, we already crop here.
-    const float scale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
-
-    bmpWidth = static_cast<int>(imageInfo.m_width * scale);
-    bmpHeight = static_cast<int>(imageInfo.m_height * scale);
-
-    // Ensure at least 1 pixel
-    if (bmpWidth < 1) bmpWidth = 1;
-    if (bmpHeight < 1) bmpHeight = 1;
-
-    // Calculate fixed-point scale factors (source pixels per output pixel)
-    // scaleX_fp = (srcWidth << 16) / bmpWidth
-    scaleX_fp = (static_cast<uint32_t>(imageInfo.m_width) << 16) / bmpWidth;
-    scaleY_fp = (static_cast<uint32_t>(imageInfo.m_height) << 16) / bmpHeight;
-    needsScaling = true;
-
-    Serial.printf("[%lu] [JPG] Pre-scaling %dx%d -> %dx%d (fit to %dx%d)\n", millis(), imageInfo.m_width,
-                  imageInfo.m_height, bmpWidth, bmpHeight, targetMaxWidth, targetMaxHeight);
+  // When the output is at most 1/8 of the source (thumbnails), the DC term of each block is all that is needed.
+  // picojpeg's reduce mode decodes just that, skipping dequantization and IDCT of the AC coefficients.
+  int fitWidth;
+  int fitHeight;
+  ScaledBmpEncoder::getOutputSize(imageInfo.m_width, imageInfo.m_height, targetMaxWidth, targetMaxHeight, &fitWidth,
+                                  &fitHeight);
+  const bool reduce = (imageInfo.m_width + 7) / 8 >= fitWidth && (imageInfo.m_height + 7) / 8 >= fitHeight;
+  if (reduce) {
+    context.bufferPos = 0;
+    context.bufferFilled = 0;
+    if (!jpegFile.seek(0) || pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 1) != 0) {
+      Serial.printf("[%lu] [JPG] JPEG reduced decode init failed\n", millis());
+      return false;
+    }
   }
 
-  // Write BMP header with output dimensions
-  int bytesPerRow;
-  if (USE_8BIT_OUTPUT) {
-    writeBmpHeader8bit(bmpOut, bmpWidth, bmpHeight);
-    bytesPerRow = (bmpWidth + 3) / 4 * 4;
-  } else {
-    writeBmpHeader(bmpOut, bmpWidth, bmpHeight);
-    bytesPerRow = (bmpWidth * 2 + 31) / 32 * 4;
-  }
+  // Source pixels per 8x8 block along each axis, and the resulting source image size
+  const int blockPixels = reduce ? 1 : 8;
+  const int srcWidth = reduce ? (imageInfo.m_width + 7) / 8 : imageInfo.m_width;
+  const int srcHeight = reduce ? (imageInfo.m_height + 7) / 8 : imageInfo.m_height;
 
-  // Allocate row buffer
-  auto* rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
-  if (!rowBuffer) {
-    Serial.printf("[%lu] [JPG] Failed to allocate row buffer\n", millis());
-    return false;
+  ScaledBmpEncoder encoder(bmpOut, srcWidth, srcHeight, targetMaxWidth, targetMaxHeight);
+  if (encoder.isScaled() || reduce) {
+    Serial.printf("[%lu] [JPG] Pre-scaling %dx%d -> %dx%d (fit to %dx%d%s)\n", millis(), imageInfo.m_width,
+                  imageInfo.m_height, encoder.getWidth(), encoder.getHeight(), targetMaxWidth, targetMaxHeight,
+                  reduce ? ", DC only" : "");
   }
 
   // Allocate a buffer for one MCU row worth of grayscale pixels
   // This is the minimal memory needed for streaming conversion
-  const int mcuPixelHeight = imageInfo.m_MCUHeight;
-  const int mcuRowPixels = imageInfo.m_width * mcuPixelHeight;
+  const int mcuPixelHeight = imageInfo.m_MCUHeight / 8 * blockPixels;
+  const int mcuRowPixels = srcWidth * mcuPixelHeight;
 
   // Validate MCU row buffer size before allocation
   if (mcuRowPixels > MAX_MCU_ROW_BYTES) {
     Serial.printf("[%lu] [JPG] MCU row buffer too large (%d bytes), max: %d\n", millis(), mcuRowPixels,
                   MAX_MCU_ROW_BYTES);
-    free(rowBuffer);
     return false;
   }
 
   auto* mcuRowBuffer = static_cast<uint8_t*>(malloc(mcuRowPixels));
   if (!mcuRowBuffer) {
     Serial.printf("[%lu] [JPG] Failed to allocate MCU row buffer (%d bytes)\n", millis(), mcuRowPixels);
-    free(rowBuffer);
     return false;
   }
 
-  // Create ditherer if enabled (only for 2-bit output)
-  // Use OUTPUT dimensions for dithering (after prescaling)
-  AtkinsonDitherer* atkinsonDitherer = nullptr;
-  FloydSteinbergDitherer* fsDitherer = nullptr;
-  if (!USE_8BIT_OUTPUT) {
-    if (USE_ATKINSON) {
-      atkinsonDitherer = new AtkinsonDitherer(bmpWidth);
-    } else if (USE_FLOYD_STEINBERG) {
-      fsDitherer = new FloydSteinbergDitherer(bmpWidth);
-    }
-  }
-
-  // For scaling: accumulate source rows into scaled output rows
-  // We need to track which source Y maps to which output Y
-  // Using fixed-point: srcY_fp = outY * scaleY_fp (gives source Y in 16.16 format)
-  uint32_t* rowAccum = nullptr;    // Accumulator for each output X (32-bit for larger sums)
-  uint16_t* rowCount = nullptr;    // Count of source pixels accumulated per output X
-  int currentOutY = 0;             // Current output row being accumulated
-  uint32_t nextOutY_srcStart = 0;  // Source Y where next output row starts (16.16 fixed point)
-
-  if (needsScaling) {
-    rowAccum = new uint32_t[bmpWidth]();
-    rowCount = new uint16_t[bmpWidth]();
-    nextOutY_srcStart = scaleY_fp;  // First boundary is at scaleY_fp (source Y for outY=1)
+  if (!encoder.begin()) {
+    Serial.printf("[%lu] [JPG] Failed to allocate row buffer\n", millis());
+    free(mcuRowBuffer);
+    return false;
   }
 
   // Process MCUs row-by-row and write to BMP as we go (top-down)
-  const int mcuPixelWidth = imageInfo.m_MCUWidth;
+  const int mcuPixelWidth = imageInfo.m_MCUWidth / 8 * blockPixels;
 
   for (int mcuY = 0; mcuY < imageInfo.m_MCUSPerCol; mcuY++) {
+    if (shouldAbort && shouldAbort()) {
+      Serial.printf("[%lu] [JPG] Aborted at MCU row %d\n", millis(), mcuY);
+      free(mcuRowBuffer);
+      return false;
+    }
+
     // Clear the MCU row buffer
     memset(mcuRowBuffer, 0, mcuRowPixels);
 
@@ -303,23 +219,22 @@ static bool jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bmpOut, const i
                         mcuStatus);
         }
         free(mcuRowBuffer);
-        free(rowBuffer);
         return false;
       }
 
-      // picojpeg stores MCU data in 8x8 blocks
+      // picojpeg stores MCU data in 8x8 blocks (only the first pixel of each is set in reduce mode)
       // Block layout: H2V2(16x16)=0,64,128,192 H2V1(16x8)=0,64 H1V2(8x16)=0,128
       for (int blockY = 0; blockY < mcuPixelHeight; blockY++) {
         for (int blockX = 0; blockX < mcuPixelWidth; blockX++) {
           const int pixelX = mcuX * mcuPixelWidth + blockX;
-          if (pixelX >= imageInfo.m_width) continue;
+          if (pixelX >= srcWidth) continue;
 
           // Calculate proper block offset for picojpeg buffer
-          const int blockCol = blockX / 8;
-          const int blockRow = blockY / 8;
-          const int localX = blockX % 8;
-          const int localY = blockY % 8;
-          const int blocksPerRow = mcuPixelWidth / 8;
+          const int blockCol = blockX / blockPixels;
+          const int blockRow = blockY / blockPixels;
+          const int localX = blockX % blockPixels;
+          const int localY = blockY % blockPixels;
+          const int blocksPerRow = imageInfo.m_MCUWidth / 8;
           const int blockIndex = blockRow * blocksPerRow + blockCol;
           const int pixelOffset = blockIndex * 64 + localY * 8 + localX;
 
@@ -333,156 +248,44 @@ static bool jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bmpOut, const i
             gray = (r * 25 + g * 50 + b * 25) / 100;
           }
 
-          mcuRowBuffer[blockY * imageInfo.m_width + pixelX] = gray;
+          mcuRowBuffer[blockY * srcWidth + pixelX] = gray;
         }
       }
     }
 
-    // Process source rows from this MCU row
+    // Hand the source rows from this MCU row to the encoder (top-down)
     const int startRow = mcuY * mcuPixelHeight;
-    const int endRow = (mcuY + 1) * mcuPixelHeight;
-
-    for (int y = startRow; y < endRow && y < imageInfo.m_height; y++) {
-      const int bufferY = y - startRow;
-
-      if (!needsScaling) {
-        // No scaling - direct output (1:1 mapping)
-        memset(rowBuffer, 0, bytesPerRow);
-
-        if (USE_8BIT_OUTPUT) {
-          for (int x = 0; x < bmpWidth; x++) {
-            const uint8_t gray = mcuRowBuffer[bufferY * imageInfo.m_width + x];
-            rowBuffer[x] = adjustPixel(gray);
-          }
-        } else {
-          for (int x = 0; x < bmpWidth; x++) {
-            const uint8_t gray = adjustPixel(mcuRowBuffer[bufferY * imageInfo.m_width + x]);
-            uint8_t twoBit;
-            if (atkinsonDitherer) {
-              twoBit = atkinsonDitherer->processPixel(gray, x);
-            } else if (fsDitherer) {
-              twoBit = fsDitherer->processPixel(gray, x);
-            } else {
-              twoBit = quantize(gray, x, y);
-            }
-            const int byteIndex = (x * 2) / 8;
-            const int bitOffset = 6 - ((x * 2) % 8);
-            rowBuffer[byteIndex] |= (twoBit << bitOffset);
-          }
-          if (atkinsonDitherer)
-            atkinsonDitherer->nextRow();
-          else if (fsDitherer)
-            fsDitherer->nextRow();
-        }
-        bmpOut.write(rowBuffer, bytesPerRow);
-      } else {
-        // Fixed-point area averaging for exact fit scaling
-        // For each output pixel X, accumulate source pixels that map to it
-        // srcX range for bmpX: [bmpX * scaleX_fp >> 16, (bmpX+1) * scaleX_fp >> 16)
-        const uint8_t* srcRow = mcuRowBuffer + bufferY * imageInfo.m_width;
-
-        for (int bmpX = 0; bmpX < bmpWidth; bmpX++) {
-          // Calculate source X range for this output pixel
-          const int srcXStart = (static_cast<uint32_t>(bmpX) * scaleX_fp) >> 16;
-          const int srcXEnd = (static_cast<uint32_t>(bmpX + 1) * scaleX_fp) >> 16;
-
-          // Accumulate all source pixels in this range
-          int sum = 0;
-          int count = 0;
-          for (int srcX = srcXStart; srcX < srcXEnd && srcX < imageInfo.m_width; srcX++) {
-            sum += srcRow[srcX];
-            count++;
-          }
-
-          // Handle edge case: if no pixels in range, use nearest
-          if (count == 0 && srcXStart < imageInfo.m_width) {
-            sum = srcRow[srcXStart];
-            count = 1;
-          }
-
-          rowAccum[bmpX] += sum;
-          rowCount[bmpX] += count;
-        }
-
-        // Check if we've crossed into the next output row
-        // Current source Y in fixed point: y << 16
-        const uint32_t srcY_fp = static_cast<uint32_t>(y + 1) << 16;
-
-        // Output row when source Y crosses the boundary
-        if (srcY_fp >= nextOutY_srcStart && currentOutY < bmpHeight) {
-          memset(rowBuffer, 0, bytesPerRow);
-
-          if (USE_8BIT_OUTPUT) {
-            for (int x = 0; x < bmpWidth; x++) {
-              const uint8_t gray = (rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0;
-              rowBuffer[x] = adjustPixel(gray);
-            }
-          } else {
-            for (int x = 0; x < bmpWidth; x++) {
-              const uint8_t gray = adjustPixel((rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0);
-              uint8_t twoBit;
-              if (atkinsonDitherer) {
-                twoBit = atkinsonDitherer->processPixel(gray, x);
-              } else if (fsDitherer) {
-                twoBit = fsDitherer->processPixel(gray, x);
-              } else {
-                twoBit = quantize(gray, x, currentOutY);
-              }
-              const int byteIndex = (x * 2) / 8;
-              const int bitOffset = 6 - ((x * 2) % 8);
-              rowBuffer[byteIndex] |= (twoBit << bitOffset);
-            }
-            if (atkinsonDitherer)
-              atkinsonDitherer->nextRow();
-            else if (fsDitherer)
-              fsDitherer->nextRow();
-          }
-
-          bmpOut.write(rowBuffer, bytesPerRow);
-          currentOutY++;
-
-          // Reset accumulators for next output row
-          memset(rowAccum, 0, bmpWidth * sizeof(uint32_t));
-          memset(rowCount, 0, bmpWidth * sizeof(uint16_t));
-
-          // Update boundary for next output row
-          nextOutY_srcStart = static_cast<uint32_t>(currentOutY + 1) * scaleY_fp;
-        }
-      }
+    for (int y = startRow; y < startRow + mcuPixelHeight && y < srcHeight; y++) {
+      encoder.writeSourceRow(mcuRowBuffer + (y - startRow) * srcWidth);
     }
   }
 
-  // Clean up
-  if (rowAccum) {
-    delete[] rowAccum;
-  }
-  if (rowCount) {
-    delete[] rowCount;
-  }
-  if (atkinsonDitherer) {
-    delete atkinsonDitherer;
-  }
-  if (fsDitherer) {
-    delete fsDitherer;
-  }
   free(mcuRowBuffer);
-  free(rowBuffer);
+
+  if (!encoder.finish()) {
+    Serial.printf("[%lu] [JPG] Failed to write BMP output\n", millis());
+    return false;
+  }
 
   // Output the final dimensions if requested
-  if (outWidth) *outWidth = static_cast<uint16_t>(bmpWidth);
-  if (outHeight) *outHeight = static_cast<uint16_t>(bmpHeight);
+  if (outWidth) *outWidth = static_cast<uint16_t>(encoder.getWidth());
+  if (outHeight) *outHeight = static_cast<uint16_t>(encoder.getHeight());
 
   Serial.printf("[%lu] [JPG] Successfully converted JPEG to BMP\n", millis());
   return true;
 }
 
 // Public wrapper with default cover image size limits
-bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
-  return jpegFileToBmpStreamInternal(jpegFile, bmpOut, TARGET_MAX_WIDTH, TARGET_MAX_HEIGHT, nullptr, nullptr);
+bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut, const std::string& scratchPath) {
+  return jpegFileToBmpStreamInternal(jpegFile, bmpOut, ScaledBmpEncoder::COVER_MAX_WIDTH,
+                                     ScaledBmpEncoder::COVER_MAX_HEIGHT, nullptr, nullptr, scratchPath, nullptr);
 }
 
 // Public wrapper with custom size limits
 bool JpegToBmpConverter::jpegFileToBmpStreamScaled(FsFile& jpegFile, Print& bmpOut, const int maxWidth,
-                                                   const int maxHeight, uint16_t* outWidth, uint16_t* outHeight) {
-  return jpegFileToBmpStreamInternal(jpegFile, bmpOut, maxWidth, maxHeight, outWidth, outHeight);
+                                                   const int maxHeight, uint16_t* outWidth, uint16_t* outHeight,
+                                                   const std::string& scratchPath,
+                                                   const std::function<bool()>& shouldAbort) {
+  return jpegFileToBmpStreamInternal(jpegFile, bmpOut, maxWidth, maxHeight, outWidth, outHeight, scratchPath,
+                                     shouldAbort);
 }
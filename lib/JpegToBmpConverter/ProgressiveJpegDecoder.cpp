@@ -0,0 +1,762 @@
+#include "ProgressiveJpegDecoder.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "ScaledBmpEncoder.h"
+
+namespace {
+// JPEG markers
+constexpr int M_SOF0 = 0xC0;
+constexpr int M_SOF2 = 0xC2;
+constexpr int M_DHT = 0xC4;
+constexpr int M_DAC = 0xCC;
+constexpr int M_SOF15 = 0xCF;
+constexpr int M_RST0 = 0xD0;
+constexpr int M_RST7 = 0xD7;
+constexpr int M_SOI = 0xD8;
+constexpr int M_EOI = 0xD9;
+constexpr int M_SOS = 0xDA;
+constexpr int M_DQT = 0xDB;
+constexpr int M_DRI = 0xDD;
+
+constexpr int MASK_WORDS = 4;  // 64-bit non-zero mask at the start of each block record
+
+// Natural (row-major) index of each zigzag position
+constexpr uint8_t ZIGZAG[64] = {0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,
+                                12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6,  7,  14, 21, 28,
+                                35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+                                58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63};
+
+bool isRestartMarker(const int marker) { return marker >= M_RST0 && marker <= M_RST7; }
+
+bool isNonZero(const int16_t* record, const int k) {
+  return (static_cast<uint16_t>(record[k >> 4]) >> (k & 15)) & 1;
+}
+
+void markNonZero(int16_t* record, const int k) {
+  record[k >> 4] = static_cast<int16_t>(static_cast<uint16_t>(record[k >> 4]) | (1u << (k & 15)));
+}
+}  // namespace
+
+ProgressiveJpegDecoder::ProgressiveJpegDecoder(FsFile& file, std::string scratchPath)
+    : file(file), scratchPath(std::move(scratchPath)) {}
+
+ProgressiveJpegDecoder::~ProgressiveJpegDecoder() {
+  free(store);
+  if (spilled) {
+    scratch.close();
+    SdMan.remove(scratchPath.c_str());
+  }
+}
+
+int ProgressiveJpegDecoder::readByte() {
+  if (readPos >= readFilled) {
+    const int bytesRead = file.read(readBuffer, sizeof(readBuffer));
+    if (bytesRead <= 0) {
+      return -1;
+    }
+    readFilled = bytesRead;
+    readPos = 0;
+  }
+  return readBuffer[readPos++];
+}
+
+uint16_t ProgressiveJpegDecoder::readWord() {
+  const int hi = readByte();
+  const int lo = readByte();
+  if (hi < 0 || lo < 0) return 0;
+  return static_cast<uint16_t>((hi << 8) | lo);
+}
+
+// Skips to the next marker, ignoring fill bytes and stuffed 0xFF bytes in entropy-coded data
+int ProgressiveJpegDecoder::nextMarker() {
+  while (true) {
+    int c = readByte();
+    if (c < 0) return -1;
+    if (c != 0xFF) continue;
+
+    do {
+      c = readByte();
+    } while (c == 0xFF);
+    if (c < 0) return -1;
+    if (c != 0) return c;
+  }
+}
+
+bool ProgressiveJpegDecoder::skipSegment() {
+  const int length = readWord();
+  if (length < 2) return false;
+  for (int i = 2; i < length; i++) {
+    if (readByte() < 0) return false;
+  }
+  return true;
+}
+
+bool ProgressiveJpegDecoder::readQuantTables() {
+  int length = readWord() - 2;
+  while (length > 0) {
+    const int info = readByte();
+    if (info < 0 || (info & 15) > 3) return false;
+
+    const bool wide = (info >> 4) != 0;
+    uint16_t* table = quantTables[info & 15];
+    for (int i = 0; i < 64; i++) {
+      table[i] = wide ? readWord() : static_cast<uint16_t>(readByte());
+    }
+    length -= 1 + 64 * (wide ? 2 : 1);
+  }
+  return length == 0;
+}
+
+bool ProgressiveJpegDecoder::readHuffmanTables() {
+  int length = readWord() - 2;
+  while (length > 0) {
+    const int info = readByte();
+    if (info < 0 || (info >> 4) > 1 || (info & 15) > 3) return false;
+    HuffmanTable& table = (info >> 4) ? acTables[info & 15] : dcTables[info & 15];
+
+    uint8_t counts[17];
+    int total = 0;
+    for (int len = 1; len <= 16; len++) {
+      counts[len] = static_cast<uint8_t>(readByte());
+      total += counts[len];
+    }
+    if (total > 256) return false;
+    for (int i = 0; i < total; i++) {
+      table.values[i] = static_cast<uint8_t>(readByte());
+    }
+
+    // Canonical code ranges per code length (JPEG spec F.2.2.3)
+    int code = 0;
+    int index = 0;
+    for (int len = 1; len <= 16; len++) {
+      table.valueOffset[len] = index - code;
+      if (counts[len] > 0) {
+        code += counts[len];
+        index += counts[len];
+        table.maxCode[len] = code - 1;
+      } else {
+        table.maxCode[len] = -1;
+      }
+      code <<= 1;
+    }
+    table.defined = true;
+    length -= 17 + total;
+  }
+  return length == 0;
+}
+
+bool ProgressiveJpegDecoder::readRestartInterval() {
+  if (readWord() != 4) return false;
+  restartInterval = readWord();
+  return true;
+}
+
+bool ProgressiveJpegDecoder::readFrame() {
+  const int length = readWord();
+  const int precision = readByte();
+  height = readWord();
+  width = readWord();
+  componentCount = readByte();
+
+  if (precision != 8 || width == 0 || height == 0 || (componentCount != 1 && componentCount != 3) ||
+      length != 8 + componentCount * 3) {
+    Serial.printf("[%lu] [JPG] Unsupported progressive frame (precision %d, %d components)\n", millis(), precision,
+                  componentCount);
+    return false;
+  }
+
+  for (int i = 0; i < componentCount; i++) {
+    Component& component = components[i];
+    component.id = static_cast<uint8_t>(readByte());
+    const int sampling = readByte();
+    component.h = sampling >> 4;
+    component.v = sampling & 15;
+    component.quantTable = static_cast<uint8_t>(readByte());
+    if (component.h < 1 || component.h > 4 || component.v < 1 || component.v > 4 || component.quantTable > 3) {
+      return false;
+    }
+    if (component.h > maxH) maxH = component.h;
+    if (component.v > maxV) maxV = component.v;
+  }
+
+  mcusPerLine = (width + 8 * maxH - 1) / (8 * maxH);
+  mcusPerColumn = (height + 8 * maxV - 1) / (8 * maxV);
+  // The first component is luminance for both grayscale and YCbCr images
+  lumaWidth = (width * components[0].h + maxH - 1) / maxH;
+  lumaHeight = (height * components[0].v + maxV - 1) / maxV;
+  return true;
+}
+
+bool ProgressiveJpegDecoder::readFrameHeader() {
+  if (!file.seek(0)) return false;
+  readPos = 0;
+  readFilled = 0;
+
+  if (readByte() != 0xFF || readByte() != M_SOI) {
+    return false;
+  }
+
+  while (true) {
+    const int marker = nextMarker();
+    switch (marker) {
+      case M_SOF2:
+        return readFrame();
+      case M_DQT:
+        if (!readQuantTables()) return false;
+        break;
+      case M_DHT:
+        if (!readHuffmanTables()) return false;
+        break;
+      case M_DRI:
+        if (!readRestartInterval()) return false;
+        break;
+      case -1:
+      case M_EOI:
+      case M_SOS:
+        return false;
+      default:
+        // Any other frame type (baseline, lossless, arithmetic coded) is not ours to handle
+        if (marker >= M_SOF0 && marker <= M_SOF15 && marker != M_DHT && marker != M_DAC) {
+          return false;
+        }
+        if (!skipSegment()) return false;
+        break;
+    }
+  }
+}
+
+void ProgressiveJpegDecoder::resetBits() {
+  bitBuffer = 0;
+  bitCount = 0;
+}
+
+// Tops up the MSB-aligned bit buffer, undoing byte stuffing. Once a marker is reached only zero bits are produced.
+void ProgressiveJpegDecoder::fillBits() {
+  while (bitCount <= 24) {
+    int byte = 0;
+    if (pendingMarker < 0) {
+      byte = readByte();
+      if (byte < 0) {
+        pendingMarker = M_EOI;
+        byte = 0;
+      } else if (byte == 0xFF) {
+        int next;
+        do {
+          next = readByte();
+        } while (next == 0xFF);
+
+        if (next != 0) {
+          pendingMarker = next < 0 ? M_EOI : next;
+          byte = 0;
+        }
+      }
+    }
+    bitBuffer |= static_cast<uint32_t>(byte) << (24 - bitCount);
+    bitCount += 8;
+  }
+}
+
+int ProgressiveJpegDecoder::getBits(const int count) {
+  if (count == 0) return 0;
+  if (bitCount < count) fillBits();
+  const int value = static_cast<int>(bitBuffer >> (32 - count));
+  bitBuffer <<= count;
+  bitCount -= count;
+  return value;
+}
+
+int ProgressiveJpegDecoder::getBit() { return getBits(1); }
+
+int ProgressiveJpegDecoder::decodeHuffman(const HuffmanTable& table) {
+  int code = 0;
+  for (int len = 1; len <= 16; len++) {
+    code = (code << 1) | getBit();
+    if (code <= table.maxCode[len]) {
+      return table.values[table.valueOffset[len] + code];
+    }
+  }
+  decodeError = true;
+  return 0;
+}
+
+int ProgressiveJpegDecoder::extend(const int value, const int bits) {
+  if (bits == 0) return 0;
+  return value < (1 << (bits - 1)) ? value - (1 << bits) + 1 : value;
+}
+
+// Consumes the RSTn marker at the end of each restart interval and resets the decoder state
+bool ProgressiveJpegDecoder::handleRestart() {
+  if (restartInterval == 0) return true;
+
+  if (restartsLeft == 0) {
+    if (pendingMarker < 0) {
+      pendingMarker = nextMarker();
+    }
+    if (!isRestartMarker(pendingMarker)) {
+      Serial.printf("[%lu] [JPG] Expected restart marker, found 0x%02X\n", millis(), pendingMarker);
+      return false;
+    }
+    pendingMarker = -1;
+    resetBits();
+    eobRun = 0;
+    for (int i = 0; i < componentCount; i++) {
+      components[i].dcPredictor = 0;
+    }
+    restartsLeft = restartInterval;
+  }
+  restartsLeft--;
+  return true;
+}
+
+// Chroma-only scans are not needed for grayscale output, so their data is skipped up to the next real marker
+bool ProgressiveJpegDecoder::skipEntropyData() {
+  int marker;
+  do {
+    marker = nextMarker();
+  } while (isRestartMarker(marker));
+  pendingMarker = marker;
+  return true;
+}
+
+void ProgressiveJpegDecoder::decodeDcFirst(Component& component, int16_t* record) {
+  const int size = decodeHuffman(dcTables[component.dcTable]);
+  if (size > 16) {
+    decodeError = true;
+    return;
+  }
+  component.dcPredictor += extend(getBits(size), size);
+  record[MASK_WORDS] = static_cast<int16_t>(component.dcPredictor * (1 << approxLow));
+}
+
+void ProgressiveJpegDecoder::decodeDcRefine(int16_t* record) {
+  if (getBit()) {
+    record[MASK_WORDS] = static_cast<int16_t>(record[MASK_WORDS] | (1 << approxLow));
+  }
+}
+
+void ProgressiveJpegDecoder::decodeAcFirst(const Component& component, int16_t* record) {
+  if (eobRun > 0) {
+    eobRun--;
+    return;
+  }
+
+  const HuffmanTable& table = acTables[component.acTable];
+  for (int k = spectralStart; k <= spectralEnd; k++) {
+    const int rs = decodeHuffman(table);
+    const int run = rs >> 4;
+    const int size = rs & 15;
+
+    if (size == 0) {
+      if (run < 15) {
+        // End of band for this and the next eobRun blocks
+        eobRun = (1 << run) - 1;
+        if (run > 0) eobRun += getBits(run);
+        break;
+      }
+      k += 15;  // Run of 16 zeros
+      continue;
+    }
+
+    k += run;
+    if (k > 63) {
+      decodeError = true;
+      return;
+    }
+    const int value = extend(getBits(size), size) * (1 << approxLow);
+    markNonZero(record, k);
+    if (zigzagSlot[k] >= 0) {
+      record[MASK_WORDS + zigzagSlot[k]] = static_cast<int16_t>(value);
+    }
+  }
+}
+
+// Applies one correction bit to a coefficient that is already non-zero. Bits for dropped coefficients are
+// still consumed to stay in sync with the bitstream.
+void ProgressiveJpegDecoder::refineCoefficient(int16_t* record, const int k) {
+  if (!getBit() || zigzagSlot[k] < 0) return;
+
+  int16_t& coefficient = record[MASK_WORDS + zigzagSlot[k]];
+  const int bit = 1 << approxLow;
+  if ((coefficient & bit) == 0) {
+    coefficient = static_cast<int16_t>(coefficient >= 0 ? coefficient + bit : coefficient - bit);
+  }
+}
+
+// Successive approximation refinement of an AC band (JPEG spec G.1.2.3)
+void ProgressiveJpegDecoder::decodeAcRefine(const Component& component, int16_t* record) {
+  const HuffmanTable& table = acTables[component.acTable];
+  int k = spectralStart;
+
+  if (eobRun == 0) {
+    for (; k <= spectralEnd; k++) {
+      const int rs = decodeHuffman(table);
+      int run = rs >> 4;
+      int value = 0;
+
+      if ((rs & 15) != 0) {
+        // Newly non-zero coefficient, always of magnitude 1 in this bit plane
+        value = getBit() ? (1 << approxLow) : -(1 << approxLow);
+      } else if (run != 15) {
+        eobRun = 1 << run;
+        if (run > 0) eobRun += getBits(run);
+        break;
+      }
+
+      // Refine non-zero coefficients while skipping over run zero ones
+      while (k <= spectralEnd) {
+        if (isNonZero(record, k)) {
+          refineCoefficient(record, k);
+        } else if (--run < 0) {
+          break;
+        }
+        k++;
+      }
+
+      if (value != 0 && k <= 63) {
+        markNonZero(record, k);
+        if (zigzagSlot[k] >= 0) {
+          record[MASK_WORDS + zigzagSlot[k]] = static_cast<int16_t>(value);
+        }
+      }
+    }
+  }
+
+  if (eobRun > 0) {
+    // Rest of the band only carries correction bits for non-zero coefficients
+    for (; k <= spectralEnd; k++) {
+      if (isNonZero(record, k)) {
+        refineCoefficient(record, k);
+      }
+    }
+    eobRun--;
+  }
+}
+
+void ProgressiveJpegDecoder::decodeBlock(Component& component, int16_t* record) {
+  if (spectralStart == 0) {
+    if (approxHigh == 0) {
+      decodeDcFirst(component, record);
+    } else {
+      decodeDcRefine(record);
+    }
+  } else if (approxHigh == 0) {
+    decodeAcFirst(component, record);
+  } else {
+    decodeAcRefine(component, record);
+  }
+}
+
+bool ProgressiveJpegDecoder::decodeScan() {
+  const int length = readWord();
+  scanComponentCount = readByte();
+  if (scanComponentCount < 1 || scanComponentCount > componentCount || length != 6 + 2 * scanComponentCount) {
+    Serial.printf("[%lu] [JPG] Bad SOS segment\n", millis());
+    return false;
+  }
+
+  bool hasLuma = false;
+  for (int i = 0; i < scanComponentCount; i++) {
+    const int id = readByte();
+    const int tables = readByte();
+    int index = 0;
+    while (index < componentCount && components[index].id != id) index++;
+    if (index == componentCount || (tables >> 4) > 3 || (tables & 15) > 3) {
+      Serial.printf("[%lu] [JPG] Bad SOS component %d\n", millis(), id);
+      return false;
+    }
+    components[index].dcTable = tables >> 4;
+    components[index].acTable = tables & 15;
+    scanComponents[i] = index;
+    hasLuma |= index == 0;
+  }
+
+  spectralStart = readByte();
+  spectralEnd = readByte();
+  const int approx = readByte();
+  approxHigh = approx >> 4;
+  approxLow = approx & 15;
+
+  const bool validSpectral = spectralStart == 0
+                                 ? spectralEnd == 0
+                                 : spectralEnd >= spectralStart && spectralEnd <= 63 && scanComponentCount == 1;
+  if (!validSpectral || approxLow > 13) {
+    Serial.printf("[%lu] [JPG] Bad scan parameters Ss=%d Se=%d Al=%d\n", millis(), spectralStart, spectralEnd,
+                  approxLow);
+    return false;
+  }
+
+  if (!hasLuma) {
+    return skipEntropyData();
+  }
+
+  for (int i = 0; i < scanComponentCount; i++) {
+    const Component& component = components[scanComponents[i]];
+    const bool needsDc = spectralStart == 0 && approxHigh == 0;
+    const bool needsAc = spectralStart > 0;
+    if ((needsDc && !dcTables[component.dcTable].defined) || (needsAc && !acTables[component.acTable].defined)) {
+      Serial.printf("[%lu] [JPG] Scan uses undefined Huffman table\n", millis());
+      return false;
+    }
+  }
+
+  resetBits();
+  eobRun = 0;
+  restartsLeft = restartInterval;
+  for (int i = 0; i < componentCount; i++) {
+    components[i].dcPredictor = 0;
+  }
+
+  Component& luma = components[0];
+  if (scanComponentCount == 1) {
+    // Non-interleaved scan, blocks in raster order over the component itself
+    const int blocksWide = (lumaWidth + 7) / 8;
+    const int blocksHigh = (lumaHeight + 7) / 8;
+    for (int row = 0; row < blocksHigh; row++) {
+      int16_t* rows = loadRows(row, 1);
+      if (!rows) return false;
+      for (int column = 0; column < blocksWide; column++) {
+        if (!handleRestart()) return false;
+        decodeBlock(luma, recordAt(rows, 0, column));
+      }
+      if (decodeError || !storeRows()) break;
+    }
+  } else {
+    // Interleaved DC scan, each MCU holds h x v blocks of every component. Chroma is decoded and dropped.
+    int16_t discard[MASK_WORDS + 64];
+    for (int mcuY = 0; mcuY < mcusPerColumn; mcuY++) {
+      int16_t* rows = loadRows(mcuY * luma.v, luma.v);
+      if (!rows) return false;
+      for (int mcuX = 0; mcuX < mcusPerLine; mcuX++) {
+        if (!handleRestart()) return false;
+        for (int i = 0; i < scanComponentCount; i++) {
+          Component& component = components[scanComponents[i]];
+          for (int v = 0; v < component.v; v++) {
+            for (int h = 0; h < component.h; h++) {
+              int16_t* record = scanComponents[i] == 0 ? recordAt(rows, v, mcuX * component.h + h) : discard;
+              decodeBlock(component, record);
+            }
+          }
+        }
+      }
+      if (decodeError || !storeRows()) break;
+    }
+  }
+
+  if (decodeError) {
+    Serial.printf("[%lu] [JPG] Corrupt progressive scan data\n", millis());
+    return false;
+  }
+  return true;
+}
+
+bool ProgressiveJpegDecoder::openStore() {
+  const Component& luma = components[0];
+  recordWords = MASK_WORDS + scale * scale;
+  recordsPerRow = mcusPerLine * luma.h;
+  blockRows = mcusPerColumn * luma.v;
+
+  const size_t rowBytes = static_cast<size_t>(recordsPerRow) * recordWords * sizeof(int16_t);
+  const size_t storeBytes = rowBytes * blockRows;
+
+  if (storeBytes <= COEFFICIENT_RAM_BUDGET) {
+    store = static_cast<int16_t*>(calloc(storeBytes, 1));
+    if (!store) {
+      Serial.printf("[%lu] [JPG] Failed to allocate coefficient store (%d bytes)\n", millis(),
+                    static_cast<int>(storeBytes));
+      return false;
+    }
+    Serial.printf("[%lu] [JPG] Progressive decode at 1/%d scale, %d byte coefficient store in RAM\n", millis(),
+                  8 / scale, static_cast<int>(storeBytes));
+    return true;
+  }
+
+  // Spill to the SD card, keeping one MCU row of blocks in RAM
+  store = static_cast<int16_t*>(calloc(rowBytes * luma.v, 1));
+  if (!store) {
+    Serial.printf("[%lu] [JPG] Failed to allocate coefficient window (%d bytes)\n", millis(),
+                  static_cast<int>(rowBytes * luma.v));
+    return false;
+  }
+  if (!SdMan.openFileForWrite("JPG", scratchPath, scratch)) {
+    Serial.printf("[%lu] [JPG] Failed to create coefficient scratch file\n", millis());
+    return false;
+  }
+  spilled = true;
+  for (int row = 0; row < blockRows; row++) {
+    if (scratch.write(reinterpret_cast<const uint8_t*>(store), rowBytes) != rowBytes) {
+      Serial.printf("[%lu] [JPG] Failed to initialise coefficient scratch file\n", millis());
+      return false;
+    }
+  }
+  Serial.printf("[%lu] [JPG] Progressive decode at 1/%d scale, %d byte coefficient store spilled to SD (%d in RAM)\n",
+                millis(), 8 / scale, static_cast<int>(storeBytes), static_cast<int>(rowBytes * luma.v));
+  return true;
+}
+
+int16_t* ProgressiveJpegDecoder::loadRows(const int firstRow, const int count) {
+  const size_t rowWords = static_cast<size_t>(recordsPerRow) * recordWords;
+  if (!spilled) {
+    return store + firstRow * rowWords;
+  }
+
+  const size_t bytes = count * rowWords * sizeof(int16_t);
+  if (!scratch.seek(firstRow * rowWords * sizeof(int16_t)) ||
+      scratch.read(reinterpret_cast<uint8_t*>(store), bytes) != static_cast<int>(bytes)) {
+    Serial.printf("[%lu] [JPG] Failed to read coefficient scratch file\n", millis());
+    return nullptr;
+  }
+  windowFirstRow = firstRow;
+  windowRowCount = count;
+  return store;
+}
+
+bool ProgressiveJpegDecoder::storeRows() {
+  if (!spilled) {
+    return true;
+  }
+
+  const size_t rowBytes = static_cast<size_t>(recordsPerRow) * recordWords * sizeof(int16_t);
+  const size_t bytes = windowRowCount * rowBytes;
+  if (!scratch.seek(windowFirstRow * rowBytes) ||
+      scratch.write(reinterpret_cast<const uint8_t*>(store), bytes) != bytes) {
+    Serial.printf("[%lu] [JPG] Failed to write coefficient scratch file\n", millis());
+    return false;
+  }
+  return true;
+}
+
+bool ProgressiveJpegDecoder::decodeScans(const int blockScale, const std::function<bool()>& shouldAbort) {
+  scale = blockScale;
+
+  // Keep the top-left scale x scale frequencies of every block
+  for (int k = 0; k < 64; k++) {
+    const int row = ZIGZAG[k] / 8;
+    const int column = ZIGZAG[k] % 8;
+    zigzagSlot[k] = -1;
+    if (row < scale && column < scale) {
+      zigzagSlot[k] = static_cast<int8_t>(row * scale + column);
+      slotZigzag[row * scale + column] = k;
+    }
+  }
+
+  // scale-point IDCT with the 8-point normalisation, so the DC term keeps its brightness at every scale
+  for (int x = 0; x < scale; x++) {
+    for (int u = 0; u < scale; u++) {
+      const double weight = u == 0 ? M_SQRT1_2 : 1.0;
+      const double basis = cos((2 * x + 1) * u * M_PI / (2 * scale));
+      idctTable[x * scale + u] = static_cast<int32_t>(lround(4096 * 0.5 * weight * basis));
+    }
+  }
+
+  if (!openStore()) {
+    return false;
+  }
+
+  while (true) {
+    const int marker = pendingMarker >= 0 ? pendingMarker : nextMarker();
+    pendingMarker = -1;
+
+    switch (marker) {
+      case M_SOS:
+        if (shouldAbort && shouldAbort()) {
+          Serial.printf("[%lu] [JPG] Aborted before next progressive scan\n", millis());
+          return false;
+        }
+        if (!decodeScan()) return false;
+        break;
+      case M_DHT:
+        if (!readHuffmanTables()) return false;
+        break;
+      case M_DQT:
+        if (!readQuantTables()) return false;
+        break;
+      case M_DRI:
+        if (!readRestartInterval()) return false;
+        break;
+      case M_EOI:
+        return true;
+      case -1:
+        // A truncated progressive file still holds a usable, if blurrier, image
+        Serial.printf("[%lu] [JPG] Progressive JPEG ended without EOI, using scans decoded so far\n", millis());
+        return true;
+      default:
+        if (!isRestartMarker(marker) && !skipSegment()) return false;
+        break;
+    }
+  }
+}
+
+void ProgressiveJpegDecoder::inverseTransform(const int16_t* record, uint8_t* out, const int stride) const {
+  const uint16_t* quant = quantTables[components[0].quantTable];
+  int32_t coefficients[64];
+  int32_t rows[64];
+
+  for (int slot = 0; slot < scale * scale; slot++) {
+    int32_t value = record[MASK_WORDS + slot] * quant[slotZigzag[slot]];
+    // Only corrupt data can exceed this, and clamping keeps the fixed-point sums below in range
+    if (value > 16384) value = 16384;
+    if (value < -16384) value = -16384;
+    coefficients[slot] = value;
+  }
+
+  // Rows, then columns, both in 4.12 fixed point
+  for (int v = 0; v < scale; v++) {
+    for (int x = 0; x < scale; x++) {
+      int32_t sum = 0;
+      for (int u = 0; u < scale; u++) {
+        sum += coefficients[v * scale + u] * idctTable[x * scale + u];
+      }
+      rows[v * scale + x] = (sum + 2048) >> 12;
+    }
+  }
+
+  for (int y = 0; y < scale; y++) {
+    for (int x = 0; x < scale; x++) {
+      int32_t sum = 0;
+      for (int v = 0; v < scale; v++) {
+        sum += rows[v * scale + x] * idctTable[y * scale + v];
+      }
+      int pixel = ((sum + 2048) >> 12) + 128;
+      if (pixel < 0) pixel = 0;
+      if (pixel > 255) pixel = 255;
+      out[y * stride + x] = static_cast<uint8_t>(pixel);
+    }
+  }
+}
+
+bool ProgressiveJpegDecoder::writeRows(ScaledBmpEncoder& encoder) {
+  const int blocksWide = (lumaWidth + 7) / 8;
+  const int blocksHigh = (lumaHeight + 7) / 8;
+  const int scaledHeight = getScaledHeight();
+  const int bandStride = blocksWide * scale;
+
+  auto* band = static_cast<uint8_t*>(malloc(bandStride * scale));
+  if (!band) {
+    Serial.printf("[%lu] [JPG] Failed to allocate IDCT row buffer\n", millis());
+    return false;
+  }
+
+  for (int row = 0; row < blocksHigh; row++) {
+    int16_t* rows = loadRows(row, 1);
+    if (!rows) {
+      free(band);
+      return false;
+    }
+    for (int column = 0; column < blocksWide; column++) {
+      inverseTransform(recordAt(rows, 0, column), band + column * scale, bandStride);
+    }
+    for (int y = 0; y < scale && row * scale + y < scaledHeight; y++) {
+      encoder.writeSourceRow(band + y * bandStride);
+    }
+  }
+
+  free(band);
+  return true;
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <SdFat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+class ScaledBmpEncoder;
+
+/**
+ * Decoder for progressive (SOF2) Huffman JPEGs, which picojpeg rejects.
+ *
+ * Progressive files spread every block over several scans, so coefficients have to be kept until the last scan.
+ * To bound memory only the luminance channel is stored (the output is grayscale), and of each 8x8 block only the
+ * top-left scale x scale coefficients plus a 64-bit mask of which coefficients are non-zero (needed to parse AC
+ * refinement scans). A reduced IDCT then yields the image at scale/8 of its size.
+ *
+ * The coefficient store is sized to that reduced resolution. When it exceeds COEFFICIENT_RAM_BUDGET it is kept
+ * in a scratch file and streamed through a window of one MCU row per scan.
+ */
+class ProgressiveJpegDecoder {
+ public:
+  static constexpr size_t COEFFICIENT_RAM_BUDGET = 32 * 1024;
+
+  ProgressiveJpegDecoder(FsFile& file, std::string scratchPath);
+  ~ProgressiveJpegDecoder();
+
+  ProgressiveJpegDecoder(const ProgressiveJpegDecoder&) = delete;
+  ProgressiveJpegDecoder& operator=(const ProgressiveJpegDecoder&) = delete;
+
+  // Reads markers up to the frame header, returns false unless the file is a progressive Huffman JPEG
+  bool readFrameHeader();
+  int getWidth() const { return width; }
+  int getHeight() const { return height; }
+
+  // Decodes all scans, keeping scale x scale coefficients per block (scale is 1, 2, 4 or 8)
+  // Gives up between scans once shouldAbort returns true
+  bool decodeScans(int scale, const std::function<bool()>& shouldAbort = nullptr);
+  int getScaledWidth() const { return (lumaWidth * scale + 7) / 8; }
+  int getScaledHeight() const { return (lumaHeight * scale + 7) / 8; }
+
+  // Runs the reduced IDCT over the stored coefficients and hands getScaledWidth() wide gray rows to the encoder
+  bool writeRows(ScaledBmpEncoder& encoder);
+
+ private:
+  struct HuffmanTable {
+    bool defined = false;
+    uint8_t values[256];
+    int32_t maxCode[18];
+    int32_t valueOffset[17];
+  };
+
+  struct Component {
+    uint8_t id;
+    uint8_t h;
+    uint8_t v;
+    uint8_t quantTable;
+    uint8_t dcTable;
+    uint8_t acTable;
+    int dcPredictor;
+  };
+
+  // Input
+  int readByte();
+  uint16_t readWord();
+  int nextMarker();
+  bool skipSegment();
+  bool readQuantTables();
+  bool readHuffmanTables();
+  bool readRestartInterval();
+  bool readFrame();
+
+  // Entropy decoding
+  void resetBits();
+  void fillBits();
+  int getBits(int count);
+  int getBit();
+  int decodeHuffman(const HuffmanTable& table);
+  static int extend(int value, int bits);
+  bool handleRestart();
+  bool skipEntropyData();
+
+  // Scans
+  bool decodeScan();
+  void decodeBlock(Component& component, int16_t* record);
+  void decodeDcFirst(Component& component, int16_t* record);
+  void decodeDcRefine(int16_t* record);
+  void decodeAcFirst(const Component& component, int16_t* record);
+  void decodeAcRefine(const Component& component, int16_t* record);
+  void refineCoefficient(int16_t* record, int k);
+
+  // Coefficient store, one record per luma block: 4 mask words followed by scale * scale coefficients
+  bool openStore();
+  int16_t* loadRows(int firstRow, int count);
+  bool storeRows();
+  int16_t* recordAt(int16_t* rows, int row, int column) const {
+    return rows + row * recordsPerRow * recordWords + column * recordWords;
+  }
+
+  void inverseTransform(const int16_t* record, uint8_t* out, int stride) const;
+
+  FsFile& file;
+  std::string scratchPath;
+  uint8_t readBuffer[512];
+  size_t readPos = 0;
+  size_t readFilled = 0;
+
+  uint16_t quantTables[4][64] = {};
+  HuffmanTable dcTables[4];
+  HuffmanTable acTables[4];
+  int restartInterval = 0;
+
+  int width = 0;
+  int height = 0;
+  int componentCount = 0;
+  Component components[3] = {};
+  int maxH = 1;
+  int maxV = 1;
+  int mcusPerLine = 0;
+  int mcusPerColumn = 0;
+  int lumaWidth = 0;
+  int lumaHeight = 0;
+
+  // Current scan
+  int scanComponents[3] = {};
+  int scanComponentCount = 0;
+  int spectralStart = 0;
+  int spectralEnd = 0;
+  int approxHigh = 0;
+  int approxLow = 0;
+  int eobRun = 0;
+  int restartsLeft = 0;
+
+  uint32_t bitBuffer = 0;
+  int bitCount = 0;
+  int pendingMarker = -1;
+  bool decodeError = false;
+
+  int scale = 8;
+  int8_t zigzagSlot[64] = {};   // Stored coefficient slot for each zigzag position, -1 if dropped
+  uint8_t slotZigzag[64] = {};  // Zigzag position of each stored coefficient slot
+  int32_t idctTable[64] = {};   // Reduced IDCT basis, [output pixel * scale + frequency] in 4.12 fixed point
+  int recordWords = 0;
+  int recordsPerRow = 0;
+  int blockRows = 0;
+  int16_t* store = nullptr;  // Whole store in RAM, or a window of rows when spilled to scratch
+  bool spilled = false;
+  FsFile scratch;
+  int windowFirstRow = 0;
+  int windowRowCount = 0;
+};
@@ -0,0 +1,95 @@
+#include "Metrics.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+
+namespace {
+constexpr const char* COUNTER_NAMES[metrics::COUNTER_COUNT] = {"sdBytesRead", "sdBytesWritten", "loopBusyMs",
+                                                               "loopIdleMs"};
+constexpr const char* TIMER_NAMES[metrics::TIMER_COUNT] = {"pageLoad", "sectionBuild", "imageConversion",
+                                                           "displayRefresh", "sdRead", "sdWrite", "renderLatency"};
+}  // namespace
+
+const char* metrics::getName(const Counter counter) { return COUNTER_NAMES[static_cast<int>(counter)]; }
+
+const char* metrics::getName(const Timer timer) { return TIMER_NAMES[static_cast<int>(timer)]; }
+
+#if CROSSPOINT_METRICS
+namespace {
+constexpr uint32_t METRICS_MAGIC = 0x54454D43;  // "CMET"
+constexpr uint8_t METRICS_FILE_VERSION = 1;
+
+uint32_t counters[metrics::COUNTER_COUNT] = {};
+metrics::Histogram histograms[metrics::TIMER_COUNT] = {};
+uint32_t minMaxAllocHeap = UINT32_MAX;
+}  // namespace
+
+void metrics::add(const Counter counter, const uint32_t value) { counters[static_cast<int>(counter)] += value; }
+
+void metrics::record(const Timer timer, const uint32_t ms) {
+  Histogram& histogram = histograms[static_cast<int>(timer)];
+  int bucket = 0;
+  while (bucket < BUCKET_COUNT - 1 && ms > BUCKET_LIMITS_MS[bucket]) {
+    bucket++;
+  }
+  histogram.buckets[bucket]++;
+  histogram.count++;
+  histogram.totalMs += ms;
+  if (ms > histogram.maxMs) {
+    histogram.maxMs = ms;
+  }
+
+  const uint32_t maxAlloc = ESP.getMaxAllocHeap();
+  if (maxAlloc < minMaxAllocHeap) {
+    minMaxAllocHeap = maxAlloc;
+  }
+}
+
+uint32_t metrics::get(const Counter counter) { return counters[static_cast<int>(counter)]; }
+
+const metrics::Histogram& metrics::get(const Timer timer) { return histograms[static_cast<int>(timer)]; }
+
+uint32_t metrics::getMinFreeHeap() { return ESP.getMinFreeHeap(); }
+
+uint32_t metrics::getMinMaxAllocHeap() {
+  return minMaxAllocHeap == UINT32_MAX ? ESP.getMaxAllocHeap() : minMaxAllocHeap;
+}
+
+/*
+ * Dump layout, little endian:
+ *   u32 magic "CMET", u8 version, u8 counter count, u8 timer count, u8 bucket count
+ *   u32 uptime in ms, u32 minimum free heap, u32 minimum largest free block
+ *   u16 bucket limits[bucket count - 1]
+ *   u32 counters[counter count]
+ *   per timer: u32 count, u32 total ms, u32 max ms, u32 buckets[bucket count]
+ */
+bool metrics::dumpToFile(const char* path) {
+  FsFile file;
+  if (!SdMan.openFileForWrite("MET", path, file)) {
+    return false;
+  }
+
+  serialization::writePod(file, METRICS_MAGIC);
+  serialization::writePod(file, METRICS_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(COUNTER_COUNT));
+  serialization::writePod(file, static_cast<uint8_t>(TIMER_COUNT));
+  serialization::writePod(file, static_cast<uint8_t>(BUCKET_COUNT));
+  serialization::writePod(file, static_cast<uint32_t>(millis()));
+  serialization::writePod(file, getMinFreeHeap());
+  serialization::writePod(file, getMinMaxAllocHeap());
+  for (const uint16_t limit : BUCKET_LIMITS_MS) {
+    serialization::writePod(file, limit);
+  }
+  for (const uint32_t value : counters) {
+    serialization::writePod(file, value);
+  }
+  for (const Histogram& histogram : histograms) {
+    serialization::writePod(file, histogram);
+  }
+  file.close();
+
+  Serial.printf("[%lu] [MET] Wrote metrics to %s\n", millis(), path);
+  return true;
+}
+#endif
@@ -0,0 +1,96 @@
+#pragma once
+#include <Arduino.h>
+
+#include <cstdint>
+
+#ifndef CROSSPOINT_METRICS
+#define CROSSPOINT_METRICS 0
+#endif
+
+/**
+ * Runtime metrics registry: counters, fixed-bucket latency histograms and heap low-water marks.
+ *
+ * Everything lives in static arrays indexed by the enums below, so recording is a few additions and never
+ * allocates. The registry is only compiled in when CROSSPOINT_METRICS is set to 1; otherwise the recording calls
+ * and ScopedTimer are empty inline functions and vanish from the build.
+ */
+namespace metrics {
+
+enum class Counter : uint8_t {
+  SdBytesRead,
+  SdBytesWritten,
+  LoopBusyMs,  // Main loop time spent handling input and running the activity
+  LoopIdleMs,  // Main loop time spent in its end-of-loop delay, where the CPU can idle
+  COUNT
+};
+
+enum class Timer : uint8_t {
+  PageLoad,         // Reading and decoding one page from the book cache
+  SectionBuild,     // Laying out a whole chapter into its section file
+  ImageConversion,  // Decoding an image into a BMP
+  DisplayRefresh,   // Pushing a frame to the panel
+  SdRead,           // Bulk reads from book files
+  SdWrite,          // Bulk writes to cache files
+  RenderLatency,    // From the first render request to the end of the render
+  COUNT
+};
+
+// Upper bounds of the histogram buckets in ms; the last bucket takes everything slower
+constexpr uint16_t BUCKET_LIMITS_MS[] = {5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+constexpr int BUCKET_COUNT = sizeof(BUCKET_LIMITS_MS) / sizeof(BUCKET_LIMITS_MS[0]) + 1;
+constexpr int COUNTER_COUNT = static_cast<int>(Counter::COUNT);
+constexpr int TIMER_COUNT = static_cast<int>(Timer::COUNT);
+
+struct Histogram {
+  uint32_t count;
+  uint32_t totalMs;
+  uint32_t maxMs;
+  uint32_t buckets[BUCKET_COUNT];
+};
+
+// camelCase names, as used in the /api/status export
+const char* getName(Counter counter);
+const char* getName(Timer timer);
+
+#if CROSSPOINT_METRICS
+constexpr bool ENABLED = true;
+
+void add(Counter counter, uint32_t value);
+// Adds a duration to the timer's histogram and samples the heap
+void record(Timer timer, uint32_t ms);
+
+uint32_t get(Counter counter);
+const Histogram& get(Timer timer);
+uint32_t getMinFreeHeap();
+// Smallest largest-free-block seen after a timed operation, an indicator of heap fragmentation
+uint32_t getMinMaxAllocHeap();
+
+// Writes all metrics to a binary file (format in Metrics.cpp), replacing any earlier dump
+bool dumpToFile(const char* path);
+
+// Records the lifetime of the object into a histogram
+class ScopedTimer {
+  Timer timer;
+  unsigned long start;
+
+ public:
+  explicit ScopedTimer(const Timer timer) : timer(timer), start(millis()) {}
+  ~ScopedTimer() { record(timer, millis() - start); }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+#else
+constexpr bool ENABLED = false;
+
+inline void add(Counter, uint32_t) {}
+inline void record(Timer, uint32_t) {}
+inline bool dumpToFile(const char*) { return false; }
+
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(Timer) {}
+};
+#endif
+
+}  // namespace metrics
@@ -4,7 +4,13 @@
 
 #include <cstring>
 
-OpdsParser::~OpdsParser() {
+namespace {
+constexpr size_t PARSE_CHUNK_SIZE = 1024;
+}  // namespace
+
+OpdsParser::~OpdsParser() { freeParser(); }
+
+void OpdsParser::freeParser() {
   if (parser) {
     XML_StopParser(parser, XML_FALSE);
     XML_SetElementHandler(parser, nullptr, nullptr);
@@ -14,59 +20,95 @@ OpdsParser::~OpdsParser() {
   }
 }
 
-bool OpdsParser::parse(const char* xmlData, const size_t length) {
+bool OpdsParser::setup() {
   clear();
+  return createParser();
+}
+
+bool OpdsParser::setupPage() {
+  freeParser();
+  resetParseState();
+  nextHref.clear();
+  return createParser();
+}
 
+bool OpdsParser::createParser() {
   parser = XML_ParserCreate(nullptr);
   if (!parser) {
     Serial.printf("[%lu] [OPDS] Couldn't allocate memory for parser\n", millis());
+    error = true;
     return false;
   }
 
   XML_SetUserData(parser, this);
   XML_SetElementHandler(parser, startElement, endElement);
   XML_SetCharacterDataHandler(parser, characterData);
+  return true;
+}
 
-  // Parse in chunks to avoid large buffer allocations
-  const char* currentPos = xmlData;
-  size_t remaining = length;
-  constexpr size_t chunkSize = 1024;
+size_t OpdsParser::write(const uint8_t data) { return write(&data, 1); }
 
-  while (remaining > 0) {
-    void* const buf = XML_GetBuffer(parser, chunkSize);
+size_t OpdsParser::write(const uint8_t* buffer, const size_t size) {
+  return parseChunk(buffer, size, false) ? size : 0;
+}
+
+bool OpdsParser::finish() {
+  if (!parseChunk(nullptr, 0, true)) {
+    return false;
+  }
+  freeParser();
+
+  Serial.printf("[%lu] [OPDS] Parsed %zu entries (%zu bytes of text)\n", millis(), records.size(), arena.size());
+  return true;
+}
+
+bool OpdsParser::parse(const char* xmlData, const size_t length) {
+  return setup() && parseChunk(reinterpret_cast<const uint8_t*>(xmlData), length, false) && finish();
+}
+
+// Parse in chunks to avoid large buffer allocations
+bool OpdsParser::parseChunk(const uint8_t* data, size_t length, const bool isFinal) {
+  if (!parser) {
+    return false;
+  }
+
+  do {
+    void* const buf = XML_GetBuffer(parser, PARSE_CHUNK_SIZE);
     if (!buf) {
       Serial.printf("[%lu] [OPDS] Couldn't allocate memory for buffer\n", millis());
-      XML_ParserFree(parser);
-      parser = nullptr;
+      error = true;
+      freeParser();
       return false;
     }
 
-    const size_t toRead = remaining < chunkSize ? remaining : chunkSize;
-    memcpy(buf, currentPos, toRead);
+    const size_t toRead = length < PARSE_CHUNK_SIZE ? length : PARSE_CHUNK_SIZE;
+    memcpy(buf, data, toRead);
 
-    const bool isFinal = (remaining == toRead);
-    if (XML_ParseBuffer(parser, static_cast<int>(toRead), isFinal) == XML_STATUS_ERROR) {
+    if (XML_ParseBuffer(parser, static_cast<int>(toRead), isFinal && toRead == length) == XML_STATUS_ERROR) {
       Serial.printf("[%lu] [OPDS] Parse error at line %lu: %s\n", millis(), XML_GetCurrentLineNumber(parser),
                     XML_ErrorString(XML_GetErrorCode(parser)));
-      XML_ParserFree(parser);
-      parser = nullptr;
+      error = true;
+      freeParser();
       return false;
     }
 
-    currentPos += toRead;
-    remaining -= toRead;
-  }
+    data += toRead;
+    length -= toRead;
+  } while (length > 0);
 
-  // Clean up parser
-  XML_ParserFree(parser);
-  parser = nullptr;
-
-  Serial.printf("[%lu] [OPDS] Parsed %zu entries\n", millis(), entries.size());
   return true;
 }
 
 void OpdsParser::clear() {
-  entries.clear();
+  freeParser();
+  records.clear();
+  arena.clear();
+  nextHref.clear();
+  resetParseState();
+}
+
+void OpdsParser::resetParseState() {
+  error = false;
   currentEntry = OpdsEntry{};
   currentText.clear();
   inEntry = false;
@@ -76,11 +118,42 @@ void OpdsParser::clear() {
   inId = false;
 }
 
+uint32_t OpdsParser::addToArena(const std::string& value) {
+  const auto offset = static_cast<uint32_t>(arena.size());
+  arena.append(value.c_str(), value.size() + 1);
+  return offset;
+}
+
+void OpdsParser::addEntry(const OpdsEntry& entry) {
+  records.push_back(
+      {addToArena(entry.title), addToArena(entry.author), addToArena(entry.href), addToArena(entry.id), entry.type});
+}
+
+void OpdsParser::truncate(const size_t count) {
+  freeParser();
+  if (count < records.size()) {
+    // The title is the first field an entry adds to the arena
+    arena.resize(records[count].title);
+    records.resize(count);
+  }
+}
+
+OpdsEntry OpdsParser::getEntry(const size_t index) const {
+  const EntryRecord& record = records[index];
+  OpdsEntry entry;
+  entry.type = record.type;
+  entry.title = arena.c_str() + record.title;
+  entry.author = arena.c_str() + record.author;
+  entry.href = arena.c_str() + record.href;
+  entry.id = arena.c_str() + record.id;
+  return entry;
+}
+
 std::vector<OpdsEntry> OpdsParser::getBooks() const {
   std::vector<OpdsEntry> books;
-  for (const auto& entry : entries) {
-    if (entry.type == OpdsEntryType::BOOK) {
-      books.push_back(entry);
+  for (size_t i = 0; i < records.size(); i++) {
+    if (records[i].type == OpdsEntryType::BOOK) {
+      books.push_back(getEntry(i));
     }
   }
   return books;
@@ -105,7 +178,17 @@ void XMLCALL OpdsParser::startElement(void* userData, const XML_Char* name, cons
     return;
   }
 
-  if (!self->inEntry) return;
+  if (!self->inEntry) {
+    // Feed-level link to the next page of a paged feed
+    if (strcmp(name, "link") == 0 || strstr(name, ":link") != nullptr) {
+      const char* rel = findAttribute(atts, "rel");
+      const char* href = findAttribute(atts, "href");
+      if (rel && href && strcmp(rel, "next") == 0) {
+        self->nextHref = href;
+      }
+    }
+    return;
+  }
 
   // Check for title element
   if (strcmp(name, "title") == 0 || strstr(name, ":title") != nullptr) {
@@ -166,7 +249,7 @@ void XMLCALL OpdsParser::endElement(void* userData, const XML_Char* name) {
   if (strcmp(name, "entry") == 0 || strstr(name, ":entry") != nullptr) {
     // Only add entry if it has required fields (title and href)
     if (!self->currentEntry.title.empty() && !self->currentEntry.href.empty()) {
-      self->entries.push_back(self->currentEntry);
+      self->addEntry(self->currentEntry);
     }
     self->inEntry = false;
     self->currentEntry = OpdsEntry{};
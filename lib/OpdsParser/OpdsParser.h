@@ -1,4 +1,5 @@
 #pragma once
+#include <Print.h>
 #include <expat.h>
 
 #include <string>
@@ -30,10 +31,18 @@ using OpdsBook = OpdsEntry;
  * Parser for OPDS (Open Publication Distribution System) Atom feeds.
  * Uses the Expat XML parser to parse OPDS catalog entries.
  *
+ * The parser is a Print sink fed the feed as it arrives, so entries become available while the rest of the feed is
+ * still downloading. Completed entries are stored as offsets into one string arena instead of a vector of
+ * std::string quadruples, which keeps large catalogs to roughly the size of their text.
+ *
+ * A paged feed links to its next page with rel="next" (getNextHref()). setupPage() parses such a page behind the
+ * entries already read, so the pages of a feed form one list.
+ *
  * Usage:
  *   OpdsParser parser;
- *   if (parser.parse(xmlData, xmlLength)) {
- *     for (const auto& entry : parser.getEntries()) {
+ *   if (parser.setup() && HttpDownloader::fetchUrl(url, parser) && parser.finish()) {
+ *     for (size_t i = 0; i < parser.getEntryCount(); i++) {
+ *       const OpdsEntry entry = parser.getEntry(i);
  *       if (entry.type == OpdsEntryType::BOOK) {
  *         // Downloadable book
  *       } else {
@@ -42,28 +51,68 @@ using OpdsBook = OpdsEntry;
  *     }
  *   }
  */
-class OpdsParser {
+class OpdsParser final : public Print {
  public:
   OpdsParser() = default;
-  ~OpdsParser();
+  ~OpdsParser() override;
 
   // Disable copy
   OpdsParser(const OpdsParser&) = delete;
   OpdsParser& operator=(const OpdsParser&) = delete;
 
   /**
-   * Parse an OPDS XML feed.
+   * Clear all entries and start a new feed.
+   * @return true if the XML parser could be created
+   */
+  bool setup();
+
+  /**
+   * Start parsing the next page of a paged feed, keeping the entries read so far.
+   * @return true if the XML parser could be created
+   */
+  bool setupPage();
+
+  // Feed the next part of the XML; returns 0 once parsing has failed
+  size_t write(uint8_t) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  /**
+   * Signal the end of the feed.
+   * @return true if the whole feed parsed without error
+   */
+  bool finish();
+
+  /**
+   * Parse a complete OPDS XML feed held in memory.
    * @param xmlData Pointer to the XML data
    * @param length Length of the XML data
    * @return true if parsing succeeded, false on error
    */
   bool parse(const char* xmlData, size_t length);
 
+  // True once the XML parser reported an error; the entries completed before it stay available
+  bool hasError() const { return error; }
+
+  /**
+   * Get the number of complete entries parsed so far (both navigation and book entries).
+   */
+  size_t getEntryCount() const { return records.size(); }
+
   /**
-   * Get the parsed entries (both navigation and book entries).
-   * @return Vector of OpdsEntry entries
+   * Get a copy of a parsed entry.
+   * @param index Entry index, below getEntryCount()
    */
-  const std::vector<OpdsEntry>& getEntries() const { return entries; }
+  OpdsEntry getEntry(size_t index) const;
+
+  // Adds an entry read elsewhere (e.g. from a cached copy of the feed)
+  void addEntry(const OpdsEntry& entry);
+
+  // Drops the entries from `count` on and stops parsing a page in progress
+  void truncate(size_t count);
+
+  // Link to the next page of the feed, relative like the entry links; empty on the last page
+  const std::string& getNextHref() const { return nextHref; }
+  void setNextHref(const std::string& href) { nextHref = href; }
 
   /**
    * Get only book entries (legacy compatibility).
@@ -77,6 +126,15 @@ class OpdsParser {
   void clear();
 
  private:
+  // Offsets of an entry's NUL-terminated fields in the arena
+  struct EntryRecord {
+    uint32_t title;
+    uint32_t author;
+    uint32_t href;
+    uint32_t id;
+    OpdsEntryType type;
+  };
+
   // Expat callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL endElement(void* userData, const XML_Char* name);
@@ -85,8 +143,17 @@ class OpdsParser {
   // Helper to find attribute value
   static const char* findAttribute(const XML_Char** atts, const char* name);
 
+  bool createParser();
+  bool parseChunk(const uint8_t* data, size_t length, bool isFinal);
+  void resetParseState();
+  void freeParser();
+  uint32_t addToArena(const std::string& value);
+
   XML_Parser parser = nullptr;
-  std::vector<OpdsEntry> entries;
+  bool error = false;
+  std::vector<EntryRecord> records;
+  std::string arena;
+  std::string nextHref;
   OpdsEntry currentEntry;
   std::string currentText;
 
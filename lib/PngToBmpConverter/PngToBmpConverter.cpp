@@ -0,0 +1,610 @@
+#include "PngToBmpConverter.h"
+
+#include <HardwareSerial.h>
+#include <Metrics.h>
+#include <SDCardManager.h>
+#include <SdFat.h>
+#include <miniz.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "ScaledBmpEncoder.h"
+
+namespace {
+// Safety limits to prevent memory issues on ESP32
+constexpr int MAX_IMAGE_WIDTH = 2048;
+constexpr int MAX_IMAGE_HEIGHT = 3072;
+constexpr size_t READ_BUFFER_SIZE = 1024;
+
+constexpr uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+enum PngColorType : uint8_t {
+  COLOR_GRAY = 0,
+  COLOR_RGB = 2,
+  COLOR_PALETTE = 3,
+  COLOR_GRAY_ALPHA = 4,
+  COLOR_RGBA = 6,
+};
+
+// Adam7 pass geometry
+constexpr uint8_t ADAM7_START_X[7] = {0, 4, 0, 2, 0, 1, 0};
+constexpr uint8_t ADAM7_START_Y[7] = {0, 0, 4, 0, 2, 0, 1};
+constexpr uint8_t ADAM7_STEP_X[7] = {8, 8, 4, 4, 2, 2, 1};
+constexpr uint8_t ADAM7_STEP_Y[7] = {8, 8, 8, 4, 4, 2, 2};
+
+uint32_t readBE32(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+}
+
+uint16_t readBE16(const uint8_t* p) { return static_cast<uint16_t>((p[0] << 8) | p[1]); }
+
+// Same weights as the JPEG path so both formats render alike
+uint8_t rgbToGray(const int r, const int g, const int b) { return (r * 25 + g * 50 + b * 25) / 100; }
+
+// Transparent pixels are composited onto the white page
+uint8_t blendOnWhite(const int gray, const int alpha) { return (gray * alpha + 255 * (255 - alpha)) / 255; }
+
+uint8_t paethPredictor(const int a, const int b, const int c) {
+  const int p = a + b - c;
+  const int pa = abs(p - a);
+  const int pb = abs(p - b);
+  const int pc = abs(p - c);
+  if (pa <= pb && pa <= pc) return a;
+  if (pb <= pc) return b;
+  return c;
+}
+
+/**
+ * Decodes the IDAT stream one scanline at a time.
+ * Only the current and previous (filtered) scanline are kept, together with the inflate dictionary.
+ * Rows of non-interlaced images go straight to the encoder. Adam7 pass rows are spooled to a scratch
+ * file and reassembled once all passes are decoded.
+ */
+class PngRowDecoder {
+ public:
+  explicit PngRowDecoder(FsFile& file) : file(file) {}
+
+  ~PngRowDecoder() {
+    free(inflator);
+    free(dictionary);
+    free(readBuffer);
+    free(scanline);
+    free(prevScanline);
+    free(grayRow);
+    if (scratch) {
+      scratch.close();
+    }
+    if (!scratchPath.empty()) {
+      SdMan.remove(scratchPath.c_str());
+    }
+  }
+
+  PngRowDecoder(const PngRowDecoder&) = delete;
+  PngRowDecoder& operator=(const PngRowDecoder&) = delete;
+
+  bool readHeaders();
+  bool decode(ScaledBmpEncoder& bmpEncoder, const std::string& interlaceScratchPath,
+              const std::function<bool()>& shouldAbort);
+
+  int width = 0;
+  int height = 0;
+
+ private:
+  bool readChunkHeader(uint32_t* length, char type[5]);
+  bool setupPass();
+  bool fillInput();
+  bool consume(const uint8_t* data, size_t length);
+  bool processScanline();
+  void convertToGray(const uint8_t* row, int pixels);
+  uint16_t sampleAt(const uint8_t* row, int index) const;
+  bool reassembleInterlaced();
+
+  size_t rowBytes(const int pixels) const { return (static_cast<size_t>(pixels) * bitsPerPixel + 7) / 8; }
+
+  FsFile& file;
+  ScaledBmpEncoder* encoder = nullptr;
+
+  uint8_t bitDepth = 0;
+  uint8_t colorType = 0;
+  bool interlaced = false;
+  int bitsPerPixel = 0;
+  int filterStride = 0;  // Bytes per complete pixel for the filters, at least 1
+
+  uint8_t paletteGray[256] = {};
+  int paletteSize = 0;
+  bool hasColorKey = false;
+  uint16_t colorKey[3] = {};
+
+  tinfl_decompressor* inflator = nullptr;
+  uint8_t* dictionary = nullptr;
+  uint8_t* readBuffer = nullptr;
+  size_t readPos = 0;
+  size_t readFilled = 0;
+  uint32_t idatRemaining = 0;
+  bool idatEnded = false;
+
+  uint8_t* scanline = nullptr;
+  uint8_t* prevScanline = nullptr;
+  uint8_t* grayRow = nullptr;
+  size_t scanlineSize = 0;
+  size_t scanlinePos = 0;
+
+  int pass = 0;
+  int passWidth = 0;
+  int passHeight = 0;
+  int passRow = 0;
+  bool rowsDone = false;
+  FsFile scratch;
+  std::string scratchPath;  // Set while the scratch file exists, removed on destruction
+};
+
+bool PngRowDecoder::readChunkHeader(uint32_t* length, char type[5]) {
+  uint8_t header[8];
+  if (file.read(header, sizeof(header)) != sizeof(header)) {
+    return false;
+  }
+  *length = readBE32(header);
+  memcpy(type, header + 4, 4);
+  type[4] = '\0';
+  return true;
+}
+
+// Reads IHDR and the ancillary chunks up to the first IDAT, leaving the file positioned at its data
+bool PngRowDecoder::readHeaders() {
+  uint8_t signature[8];
+  if (file.read(signature, sizeof(signature)) != sizeof(signature) ||
+      memcmp(signature, PNG_SIGNATURE, sizeof(signature)) != 0) {
+    Serial.printf("[%lu] [PNG] Not a PNG file\n", millis());
+    return false;
+  }
+
+  uint8_t data[256 * 3];
+  uint32_t length;
+  char type[5];
+  bool seenHeader = false;
+
+  while (readChunkHeader(&length, type)) {
+    if (strcmp(type, "IDAT") == 0) {
+      if (!seenHeader || (colorType == COLOR_PALETTE && paletteSize == 0)) {
+        Serial.printf("[%lu] [PNG] Missing IHDR or PLTE before image data\n", millis());
+        return false;
+      }
+      idatRemaining = length;
+      return true;
+    }
+
+    if (strcmp(type, "IHDR") == 0) {
+      if (length != 13 || file.read(data, 13) != 13) {
+        Serial.printf("[%lu] [PNG] Bad IHDR chunk\n", millis());
+        return false;
+      }
+      width = static_cast<int>(readBE32(data));
+      height = static_cast<int>(readBE32(data + 4));
+      bitDepth = data[8];
+      colorType = data[9];
+      interlaced = data[12] == 1;
+
+      int channels;
+      bool validDepth;
+      switch (colorType) {
+        case COLOR_GRAY:
+          channels = 1;
+          validDepth = bitDepth == 1 || bitDepth == 2 || bitDepth == 4 || bitDepth == 8 || bitDepth == 16;
+          break;
+        case COLOR_PALETTE:
+          channels = 1;
+          validDepth = bitDepth == 1 || bitDepth == 2 || bitDepth == 4 || bitDepth == 8;
+          break;
+        case COLOR_RGB:
+          channels = 3;
+          validDepth = bitDepth == 8 || bitDepth == 16;
+          break;
+        case COLOR_GRAY_ALPHA:
+          channels = 2;
+          validDepth = bitDepth == 8 || bitDepth == 16;
+          break;
+        case COLOR_RGBA:
+          channels = 4;
+          validDepth = bitDepth == 8 || bitDepth == 16;
+          break;
+        default:
+          channels = 0;
+          validDepth = false;
+          break;
+      }
+      if (!validDepth || data[10] != 0 || data[11] != 0 || data[12] > 1) {
+        Serial.printf("[%lu] [PNG] Unsupported format (color type %d, bit depth %d, interlace %d)\n", millis(),
+                      colorType, bitDepth, data[12]);
+        return false;
+      }
+      bitsPerPixel = channels * bitDepth;
+      filterStride = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+      seenHeader = true;
+    } else if (strcmp(type, "PLTE") == 0) {
+      if (length % 3 != 0 || length > sizeof(data) || file.read(data, length) != static_cast<int>(length)) {
+        Serial.printf("[%lu] [PNG] Bad PLTE chunk\n", millis());
+        return false;
+      }
+      paletteSize = static_cast<int>(length / 3);
+      for (int i = 0; i < paletteSize; i++) {
+        paletteGray[i] = rgbToGray(data[i * 3], data[i * 3 + 1], data[i * 3 + 2]);
+      }
+    } else if (strcmp(type, "tRNS") == 0) {
+      if (length > sizeof(data) || file.read(data, length) != static_cast<int>(length)) {
+        Serial.printf("[%lu] [PNG] Bad tRNS chunk\n", millis());
+        return false;
+      }
+      if (colorType == COLOR_PALETTE) {
+        // Alpha per palette entry, baked into the palette gray levels
+        for (uint32_t i = 0; i < length && i < static_cast<uint32_t>(paletteSize); i++) {
+          paletteGray[i] = blendOnWhite(paletteGray[i], data[i]);
+        }
+      } else if ((colorType == COLOR_GRAY && length == 2) || (colorType == COLOR_RGB && length == 6)) {
+        // Single transparent color, compared against raw samples
+        hasColorKey = true;
+        for (uint32_t i = 0; i < length / 2; i++) {
+          colorKey[i] = readBE16(data + i * 2);
+        }
+      }
+    } else if (!file.seekCur(length)) {
+      return false;
+    }
+
+    // Skip CRC
+    if (!file.seekCur(4)) {
+      return false;
+    }
+  }
+
+  Serial.printf("[%lu] [PNG] No image data found\n", millis());
+  return false;
+}
+
+// Advances to the next non-empty pass (the single pass of a non-interlaced image counts as pass 0)
+bool PngRowDecoder::setupPass() {
+  while (pass < 7) {
+    if (interlaced) {
+      passWidth = (width - ADAM7_START_X[pass] + ADAM7_STEP_X[pass] - 1) / ADAM7_STEP_X[pass];
+      passHeight = (height - ADAM7_START_Y[pass] + ADAM7_STEP_Y[pass] - 1) / ADAM7_STEP_Y[pass];
+    } else {
+      passWidth = width;
+      passHeight = height;
+    }
+
+    if (passWidth > 0 && passHeight > 0) {
+      scanlineSize = 1 + rowBytes(passWidth);
+      scanlinePos = 0;
+      passRow = 0;
+      memset(prevScanline, 0, scanlineSize);
+      return true;
+    }
+    pass++;
+  }
+  return false;
+}
+
+// Refills the read buffer from the current IDAT chunk, moving on to following IDAT chunks as needed
+bool PngRowDecoder::fillInput() {
+  while (idatRemaining == 0) {
+    uint32_t length;
+    char type[5];
+    if (!file.seekCur(4) || !readChunkHeader(&length, type) || strcmp(type, "IDAT") != 0) {
+      idatEnded = true;
+      return false;
+    }
+    idatRemaining = length;
+  }
+
+  const size_t toRead = idatRemaining < READ_BUFFER_SIZE ? idatRemaining : READ_BUFFER_SIZE;
+  const int bytesRead = file.read(readBuffer, toRead);
+  if (bytesRead <= 0) {
+    idatEnded = true;
+    return false;
+  }
+  idatRemaining -= bytesRead;
+  readPos = 0;
+  readFilled = bytesRead;
+  return true;
+}
+
+bool PngRowDecoder::consume(const uint8_t* data, size_t length) {
+  while (length > 0 && !rowsDone) {
+    const size_t chunk = length < scanlineSize - scanlinePos ? length : scanlineSize - scanlinePos;
+    memcpy(scanline + scanlinePos, data, chunk);
+    scanlinePos += chunk;
+    data += chunk;
+    length -= chunk;
+
+    if (scanlinePos == scanlineSize && !processScanline()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PngRowDecoder::processScanline() {
+  // Undo the row filter in place, using the previous unfiltered row of the same pass
+  uint8_t* row = scanline + 1;
+  const uint8_t* prior = prevScanline + 1;
+  const size_t length = scanlineSize - 1;
+  const size_t bpp = filterStride;
+
+  switch (scanline[0]) {
+    case 0:  // None
+      break;
+    case 1:  // Sub
+      for (size_t i = bpp; i < length; i++) row[i] += row[i - bpp];
+      break;
+    case 2:  // Up
+      for (size_t i = 0; i < length; i++) row[i] += prior[i];
+      break;
+    case 3:  // Average
+      for (size_t i = 0; i < length; i++) row[i] += ((i >= bpp ? row[i - bpp] : 0) + prior[i]) >> 1;
+      break;
+    case 4:  // Paeth
+      for (size_t i = 0; i < length; i++) {
+        row[i] += i >= bpp ? paethPredictor(row[i - bpp], prior[i], prior[i - bpp]) : prior[i];
+      }
+      break;
+    default:
+      Serial.printf("[%lu] [PNG] Invalid filter type %d\n", millis(), scanline[0]);
+      return false;
+  }
+
+  convertToGray(row, passWidth);
+  if (interlaced) {
+    if (scratch.write(grayRow, passWidth) != static_cast<size_t>(passWidth)) {
+      Serial.printf("[%lu] [PNG] Failed to write interlace scratch file\n", millis());
+      return false;
+    }
+  } else {
+    encoder->writeSourceRow(grayRow);
+  }
+
+  uint8_t* temp = prevScanline;
+  prevScanline = scanline;
+  scanline = temp;
+  scanlinePos = 0;
+
+  if (++passRow == passHeight) {
+    pass++;
+    rowsDone = !interlaced || !setupPass();
+  }
+  return true;
+}
+
+// Raw sample value for one channel of sub-byte or 8-bit images, or one 16-bit sample
+uint16_t PngRowDecoder::sampleAt(const uint8_t* row, const int index) const {
+  if (bitDepth == 16) return readBE16(row + index * 2);
+  if (bitDepth == 8) return row[index];
+
+  const int bitIndex = index * bitDepth;
+  const int shift = 8 - bitDepth - (bitIndex % 8);
+  return (row[bitIndex / 8] >> shift) & ((1 << bitDepth) - 1);
+}
+
+void PngRowDecoder::convertToGray(const uint8_t* row, const int pixels) {
+  // 16-bit samples keep their high byte, lower depths are expanded to the full 8-bit range
+  const int sampleShift = bitDepth == 16 ? 8 : 0;
+  const int sampleScale = bitDepth < 8 ? 255 / ((1 << bitDepth) - 1) : 1;
+
+  for (int x = 0; x < pixels; x++) {
+    switch (colorType) {
+      case COLOR_GRAY: {
+        const uint16_t v = sampleAt(row, x);
+        grayRow[x] = (hasColorKey && v == colorKey[0]) ? 255 : (v >> sampleShift) * sampleScale;
+        break;
+      }
+      case COLOR_PALETTE:
+        grayRow[x] = paletteGray[sampleAt(row, x)];
+        break;
+      case COLOR_RGB: {
+        const uint16_t r = sampleAt(row, x * 3);
+        const uint16_t g = sampleAt(row, x * 3 + 1);
+        const uint16_t b = sampleAt(row, x * 3 + 2);
+        const bool transparent = hasColorKey && r == colorKey[0] && g == colorKey[1] && b == colorKey[2];
+        grayRow[x] = transparent ? 255 : rgbToGray(r >> sampleShift, g >> sampleShift, b >> sampleShift);
+        break;
+      }
+      case COLOR_GRAY_ALPHA:
+        grayRow[x] = blendOnWhite(sampleAt(row, x * 2) >> sampleShift, sampleAt(row, x * 2 + 1) >> sampleShift);
+        break;
+      case COLOR_RGBA: {
+        const int gray = rgbToGray(sampleAt(row, x * 4) >> sampleShift, sampleAt(row, x * 4 + 1) >> sampleShift,
+                                   sampleAt(row, x * 4 + 2) >> sampleShift);
+        grayRow[x] = blendOnWhite(gray, sampleAt(row, x * 4 + 3) >> sampleShift);
+        break;
+      }
+      default:
+        grayRow[x] = 255;
+        break;
+    }
+  }
+}
+
+bool PngRowDecoder::decode(ScaledBmpEncoder& bmpEncoder, const std::string& interlaceScratchPath,
+                           const std::function<bool()>& shouldAbort) {
+  encoder = &bmpEncoder;
+  // Scanlines double as the pass row buffer when reassembling interlaced images, so they hold a gray row too
+  size_t maxScanline = 1 + rowBytes(width);
+  if (interlaced && maxScanline < static_cast<size_t>(width)) {
+    maxScanline = width;
+  }
+  inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  dictionary = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+  readBuffer = static_cast<uint8_t*>(malloc(READ_BUFFER_SIZE));
+  scanline = static_cast<uint8_t*>(malloc(maxScanline));
+  prevScanline = static_cast<uint8_t*>(malloc(maxScanline));
+  grayRow = static_cast<uint8_t*>(malloc(width));
+  if (!inflator || !dictionary || !readBuffer || !scanline || !prevScanline || !grayRow) {
+    Serial.printf("[%lu] [PNG] Failed to allocate decode buffers (%d byte scanlines)\n", millis(),
+                  static_cast<int>(maxScanline));
+    return false;
+  }
+  tinfl_init(inflator);
+
+  if (interlaced) {
+    if (!SdMan.openFileForWrite("PNG", interlaceScratchPath, scratch)) {
+      Serial.printf("[%lu] [PNG] Failed to create interlace scratch file\n", millis());
+      return false;
+    }
+    scratchPath = interlaceScratchPath;
+  }
+
+  pass = 0;
+  setupPass();
+
+  size_t dictPos = 0;  // Current offset in the circular dictionary
+  while (!rowsDone) {
+    if (readPos >= readFilled && !idatEnded) {
+      if (shouldAbort && shouldAbort()) {
+        Serial.printf("[%lu] [PNG] Aborted at pass %d, row %d\n", millis(), pass, passRow);
+        return false;
+      }
+      fillInput();
+    }
+
+    size_t inBytes = readFilled - readPos;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - dictPos;
+    const tinfl_status status =
+        tinfl_decompress(inflator, readBuffer + readPos, &inBytes, dictionary, dictionary + dictPos, &outBytes,
+                         TINFL_FLAG_PARSE_ZLIB_HEADER | (idatEnded ? 0 : TINFL_FLAG_HAS_MORE_INPUT));
+    readPos += inBytes;
+
+    if (outBytes > 0) {
+      if (!consume(dictionary + dictPos, outBytes)) {
+        return false;
+      }
+      dictPos = (dictPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+    }
+
+    if (status < 0) {
+      Serial.printf("[%lu] [PNG] tinfl_decompress() failed with status %d\n", millis(), status);
+      return false;
+    }
+    if (status == TINFL_STATUS_DONE) {
+      break;
+    }
+  }
+
+  if (!rowsDone) {
+    Serial.printf("[%lu] [PNG] Image data ended early (pass %d, row %d)\n", millis(), pass, passRow);
+    return false;
+  }
+
+  return !interlaced || reassembleInterlaced();
+}
+
+// Interleaves the spooled Adam7 passes back into full rows. Each image row is covered by up to four passes,
+// whose rows are stored contiguously in the scratch file.
+bool PngRowDecoder::reassembleInterlaced() {
+  scratch.close();
+  if (!SdMan.openFileForRead("PNG", scratchPath, scratch)) {
+    Serial.printf("[%lu] [PNG] Failed to reopen interlace scratch file\n", millis());
+    return false;
+  }
+
+  uint32_t passOffset[7];
+  int passWidths[7];
+  uint32_t offset = 0;
+  for (int p = 0; p < 7; p++) {
+    passWidths[p] = (width - ADAM7_START_X[p] + ADAM7_STEP_X[p] - 1) / ADAM7_STEP_X[p];
+    const int rows = (height - ADAM7_START_Y[p] + ADAM7_STEP_Y[p] - 1) / ADAM7_STEP_Y[p];
+    passOffset[p] = offset;
+    if (passWidths[p] > 0 && rows > 0) {
+      offset += static_cast<uint32_t>(passWidths[p]) * rows;
+    }
+  }
+
+  // The scanline buffer is free now and was sized to hold a full gray row
+  uint8_t* passPixels = scanline;
+  for (int y = 0; y < height; y++) {
+    for (int p = 0; p < 7; p++) {
+      if (passWidths[p] <= 0 || y < ADAM7_START_Y[p] || (y - ADAM7_START_Y[p]) % ADAM7_STEP_Y[p] != 0) {
+        continue;
+      }
+
+      const uint32_t rowOffset = passOffset[p] + static_cast<uint32_t>((y - ADAM7_START_Y[p]) / ADAM7_STEP_Y[p]) *
+                                                     passWidths[p];
+      if (!scratch.seek(rowOffset) || scratch.read(passPixels, passWidths[p]) != passWidths[p]) {
+        Serial.printf("[%lu] [PNG] Failed to read interlace scratch file\n", millis());
+        return false;
+      }
+      for (int i = 0; i < passWidths[p]; i++) {
+        grayRow[ADAM7_START_X[p] + i * ADAM7_STEP_X[p]] = passPixels[i];
+      }
+    }
+    encoder->writeSourceRow(grayRow);
+  }
+  return true;
+}
+}  // namespace
+
+// Internal implementation with configurable size limits
+static bool pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOut, const int targetMaxWidth,
+                                       const int targetMaxHeight, uint16_t* outWidth, uint16_t* outHeight,
+                                       const std::string& scratchPath, const std::function<bool()>& shouldAbort) {
+  metrics::ScopedTimer conversionTimer(metrics::Timer::ImageConversion);
+  Serial.printf("[%lu] [PNG] Converting PNG to BMP\n", millis());
+
+  if (!pngFile.seek(0)) {
+    return false;
+  }
+
+  PngRowDecoder decoder(pngFile);
+  if (!decoder.readHeaders()) {
+    return false;
+  }
+
+  Serial.printf("[%lu] [PNG] PNG dimensions: %dx%d\n", millis(), decoder.width, decoder.height);
+
+  if (decoder.width <= 0 || decoder.height <= 0 || decoder.width > MAX_IMAGE_WIDTH ||
+      decoder.height > MAX_IMAGE_HEIGHT) {
+    Serial.printf("[%lu] [PNG] Image size %dx%d not supported, max: %dx%d\n", millis(), decoder.width,
+                  decoder.height, MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
+    return false;
+  }
+
+  ScaledBmpEncoder encoder(bmpOut, decoder.width, decoder.height, targetMaxWidth, targetMaxHeight);
+  if (encoder.isScaled()) {
+    Serial.printf("[%lu] [PNG] Pre-scaling %dx%d -> %dx%d (fit to %dx%d)\n", millis(), decoder.width, decoder.height,
+                  encoder.getWidth(), encoder.getHeight(), targetMaxWidth, targetMaxHeight);
+  }
+  if (!encoder.begin()) {
+    Serial.printf("[%lu] [PNG] Failed to allocate row buffer\n", millis());
+    return false;
+  }
+
+  if (!decoder.decode(encoder, scratchPath, shouldAbort)) {
+    return false;
+  }
+
+  if (!encoder.finish()) {
+    Serial.printf("[%lu] [PNG] Failed to write BMP output\n", millis());
+    return false;
+  }
+
+  // Output the final dimensions if requested
+  if (outWidth) *outWidth = static_cast<uint16_t>(encoder.getWidth());
+  if (outHeight) *outHeight = static_cast<uint16_t>(encoder.getHeight());
+
+  Serial.printf("[%lu] [PNG] Successfully converted PNG to BMP\n", millis());
+  return true;
+}
+
+// Public wrapper with default cover image size limits
+bool PngToBmpConverter::pngFileToBmpStream(FsFile& pngFile, Print& bmpOut, const std::string& scratchPath) {
+  return pngFileToBmpStreamInternal(pngFile, bmpOut, ScaledBmpEncoder::COVER_MAX_WIDTH,
+                                    ScaledBmpEncoder::COVER_MAX_HEIGHT, nullptr, nullptr, scratchPath, nullptr);
+}
+
+// Public wrapper with custom size limits
+bool PngToBmpConverter::pngFileToBmpStreamScaled(FsFile& pngFile, Print& bmpOut, const int maxWidth,
+                                                 const int maxHeight, uint16_t* outWidth, uint16_t* outHeight,
+                                                 const std::string& scratchPath,
+                                                 const std::function<bool()>& shouldAbort) {
+  return pngFileToBmpStreamInternal(pngFile, bmpOut, maxWidth, maxHeight, outWidth, outHeight, scratchPath,
+                                    shouldAbort);
+}
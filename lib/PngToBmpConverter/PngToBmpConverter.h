@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+class FsFile;
+class Print;
+
+class PngToBmpConverter {
+ public:
+  // Convert PNG to BMP using default cover image size limits (480x800)
+  // Interlaced (Adam7) images are de-interlaced through a temporary file at scratchPath
+  static bool pngFileToBmpStream(FsFile& pngFile, Print& bmpOut, const std::string& scratchPath);
+
+  // Convert PNG to BMP with custom size limits and return actual output dimensions
+  // Returns true on success, false on failure
+  // outWidth/outHeight will contain the actual BMP dimensions after scaling
+  // Gives up between reads of compressed data once shouldAbort returns true
+  static bool pngFileToBmpStreamScaled(FsFile& pngFile, Print& bmpOut, int maxWidth, int maxHeight,
+                                       uint16_t* outWidth, uint16_t* outHeight, const std::string& scratchPath,
+                                       const std::function<bool()>& shouldAbort = nullptr);
+};
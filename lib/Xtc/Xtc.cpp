@@ -7,9 +7,12 @@
 
 #include "Xtc.h"
 
+#include <BmpWriter.h>
 #include <FsHelpers.h>
 #include <HardwareSerial.h>
+#include <Metrics.h>
 #include <SDCardManager.h>
+#include <ScaledBmpEncoder.h>
 
 bool Xtc::load() {
   Serial.printf("[%lu] [XTC] Loading XTC: %s\n", millis(), filepath.c_str());
@@ -104,48 +107,39 @@ const std::vector<xtc::ChapterInfo>& Xtc::getChapters() const {
 
 std::string Xtc::getCoverBmpPath() const { return cachePath + "/cover.bmp"; }
 
-bool Xtc::generateCoverBmp() const {
-  // Already generated
-  if (SdMan.exists(getCoverBmpPath().c_str())) {
-    return true;
-  }
-
+uint8_t* Xtc::loadCoverPage(xtc::PageInfo* pageInfo) const {
   if (!loaded || !parser) {
     Serial.printf("[%lu] [XTC] Cannot generate cover BMP, file not loaded\n", millis());
-    return false;
+    return nullptr;
   }
 
   if (parser->getPageCount() == 0) {
     Serial.printf("[%lu] [XTC] No pages in XTC file\n", millis());
-    return false;
+    return nullptr;
   }
 
   // Setup cache directory
   setupCacheDir();
 
   // Get first page info for cover
-  xtc::PageInfo pageInfo;
-  if (!parser->getPageInfo(0, pageInfo)) {
+  if (!parser->getPageInfo(0, *pageInfo)) {
     Serial.printf("[%lu] [XTC] Failed to get first page info\n", millis());
-    return false;
+    return nullptr;
   }
 
-  // Get bit depth
-  const uint8_t bitDepth = parser->getBitDepth();
-
   // Allocate buffer for page data
   // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
   size_t bitmapSize;
-  if (bitDepth == 2) {
-    bitmapSize = ((static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8) * 2;
+  if (parser->getBitDepth() == 2) {
+    bitmapSize = ((static_cast<size_t>(pageInfo->width) * pageInfo->height + 7) / 8) * 2;
   } else {
-    bitmapSize = ((pageInfo.width + 7) / 8) * pageInfo.height;
+    bitmapSize = ((pageInfo->width + 7) / 8) * pageInfo->height;
   }
   uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(bitmapSize));
   if (!pageBuffer) {
     Serial.printf("[%lu] [XTC] Failed to allocate page buffer (%lu bytes)\n", millis(), bitmapSize);
-    return false;
+    return nullptr;
   }
 
   // Load first page (cover)
@@ -153,8 +147,24 @@ bool Xtc::generateCoverBmp() const {
   if (bytesRead == 0) {
     Serial.printf("[%lu] [XTC] Failed to load cover page\n", millis());
     free(pageBuffer);
+    return nullptr;
+  }
+
+  return pageBuffer;
+}
+
+bool Xtc::generateCoverBmp() const {
+  // Already generated
+  if (SdMan.exists(getCoverBmpPath().c_str())) {
+    return true;
+  }
+
+  xtc::PageInfo pageInfo;
+  uint8_t* pageBuffer = loadCoverPage(&pageInfo);
+  if (!pageBuffer) {
     return false;
   }
+  const uint8_t bitDepth = parser->getBitDepth();
 
   // Create BMP file
   FsFile coverBmp;
@@ -164,55 +174,11 @@ bool Xtc::generateCoverBmp() const {
     return false;
   }
 
-  // Write BMP header
-  // BMP file header (14 bytes)
-  const uint32_t rowSize = ((pageInfo.width + 31) / 32) * 4;  // Row size aligned to 4 bytes
-  const uint32_t imageSize = rowSize * pageInfo.height;
-  const uint32_t fileSize = 14 + 40 + 8 + imageSize;  // Header + DIB + palette + data
-
-  // File header
-  coverBmp.write('B');
-  coverBmp.write('M');
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&fileSize), 4);
-  uint32_t reserved = 0;
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&reserved), 4);
-  uint32_t dataOffset = 14 + 40 + 8;  // 1-bit palette has 2 colors (8 bytes)
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&dataOffset), 4);
-
-  // DIB header (BITMAPINFOHEADER - 40 bytes)
-  uint32_t dibHeaderSize = 40;
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&dibHeaderSize), 4);
-  int32_t width = pageInfo.width;
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&width), 4);
-  int32_t height = -static_cast<int32_t>(pageInfo.height);  // Negative for top-down
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&height), 4);
-  uint16_t planes = 1;
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&planes), 2);
-  uint16_t bitsPerPixel = 1;  // 1-bit monochrome
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&bitsPerPixel), 2);
-  uint32_t compression = 0;  // BI_RGB (no compression)
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&compression), 4);
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&imageSize), 4);
-  int32_t ppmX = 2835;  // 72 DPI
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&ppmX), 4);
-  int32_t ppmY = 2835;
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&ppmY), 4);
-  uint32_t colorsUsed = 2;
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&colorsUsed), 4);
-  uint32_t colorsImportant = 2;
-  coverBmp.write(reinterpret_cast<const uint8_t*>(&colorsImportant), 4);
-
-  // Color palette (2 colors for 1-bit)
-  // XTC uses inverted polarity: 0 = black, 1 = white
-  // Color 0: Black (text/foreground in XTC)
-  uint8_t black[4] = {0x00, 0x00, 0x00, 0x00};
-  coverBmp.write(black, 4);
-  // Color 1: White (background in XTC)
-  uint8_t white[4] = {0xFF, 0xFF, 0xFF, 0x00};
-  coverBmp.write(white, 4);
-
-  // Write bitmap data
-  // BMP requires 4-byte row alignment
+  // 1-bit grayscale palette matches XTC polarity: 0 = black (text), 1 = white (background)
+  BmpWriter bmpWriter(coverBmp);
+  bmpWriter.writeHeader(pageInfo.width, pageInfo.height, 1);
+
+  // Write bitmap data, BmpWriter pads each row to a 4-byte boundary
   const size_t dstRowSize = (pageInfo.width + 7) / 8;  // 1-bit destination row size
 
   if (bitDepth == 2) {
@@ -257,15 +223,7 @@ bool Xtc::generateCoverBmp() const {
         }
       }
 
-      // Write converted row
-      coverBmp.write(rowBuffer, dstRowSize);
-
-      // Pad to 4-byte boundary
-      uint8_t padding[4] = {0, 0, 0, 0};
-      size_t paddingSize = rowSize - dstRowSize;
-      if (paddingSize > 0) {
-        coverBmp.write(padding, paddingSize);
-      }
+      bmpWriter.writeRow(rowBuffer, dstRowSize);
     }
 
     free(rowBuffer);
@@ -274,25 +232,85 @@ bool Xtc::generateCoverBmp() const {
     const size_t srcRowSize = (pageInfo.width + 7) / 8;
 
     for (uint16_t y = 0; y < pageInfo.height; y++) {
-      // Write source row
-      coverBmp.write(pageBuffer + y * srcRowSize, srcRowSize);
-
-      // Pad to 4-byte boundary
-      uint8_t padding[4] = {0, 0, 0, 0};
-      size_t paddingSize = rowSize - srcRowSize;
-      if (paddingSize > 0) {
-        coverBmp.write(padding, paddingSize);
-      }
+      bmpWriter.writeRow(pageBuffer + y * srcRowSize, srcRowSize);
     }
   }
 
+  const bool written = bmpWriter.flush();
   coverBmp.close();
   free(pageBuffer);
 
+  if (!written) {
+    Serial.printf("[%lu] [XTC] Failed to write cover BMP\n", millis());
+    return false;
+  }
+
   Serial.printf("[%lu] [XTC] Generated cover BMP: %s\n", millis(), getCoverBmpPath().c_str());
   return true;
 }
 
+std::string Xtc::getThumbBmpPath() const { return cachePath + "/thumb.bmp"; }
+
+bool Xtc::generateThumbBmp(const int maxWidth, const int maxHeight) const {
+  xtc::PageInfo pageInfo;
+  uint8_t* pageBuffer = loadCoverPage(&pageInfo);
+  if (!pageBuffer) {
+    return false;
+  }
+
+  FsFile thumbBmp;
+  if (!SdMan.openFileForWrite("XTC", getThumbBmpPath(), thumbBmp)) {
+    Serial.printf("[%lu] [XTC] Failed to create thumbnail BMP file\n", millis());
+    free(pageBuffer);
+    return false;
+  }
+
+  // Unlike the full-size cover, the thumbnail is area-averaged, so it keeps the page's gray levels
+  ScaledBmpEncoder encoder(thumbBmp, pageInfo.width, pageInfo.height, maxWidth, maxHeight);
+  uint8_t* grayRow = static_cast<uint8_t*>(malloc(pageInfo.width));
+  if (!grayRow || !encoder.begin()) {
+    Serial.printf("[%lu] [XTC] Failed to allocate thumbnail buffers\n", millis());
+    free(grayRow);
+    free(pageBuffer);
+    thumbBmp.close();
+    SdMan.remove(getThumbBmpPath().c_str());
+    return false;
+  }
+
+  const bool twoBit = parser->getBitDepth() == 2;
+  const size_t planeSize = (static_cast<size_t>(pageInfo.width) * pageInfo.height + 7) / 8;
+  const size_t colBytes = (pageInfo.height + 7) / 8;
+  const size_t srcRowSize = (pageInfo.width + 7) / 8;
+
+  for (uint16_t y = 0; y < pageInfo.height; y++) {
+    for (uint16_t x = 0; x < pageInfo.width; x++) {
+      if (twoBit) {
+        // Same plane layout as in generateCoverBmp, 0 = white ... 3 = black
+        const size_t byteOffset = (pageInfo.width - 1 - x) * colBytes + y / 8;
+        const size_t bitInByte = 7 - (y % 8);
+        const uint8_t bit1 = (pageBuffer[byteOffset] >> bitInByte) & 1;
+        const uint8_t bit2 = (pageBuffer[planeSize + byteOffset] >> bitInByte) & 1;
+        grayRow[x] = 255 - ((bit1 << 1) | bit2) * 85;
+      } else {
+        grayRow[x] = (pageBuffer[y * srcRowSize + x / 8] >> (7 - (x % 8))) & 1 ? 255 : 0;
+      }
+    }
+    encoder.writeSourceRow(grayRow);
+  }
+
+  const bool written = encoder.finish();
+  thumbBmp.close();
+  free(grayRow);
+  free(pageBuffer);
+
+  if (!written) {
+    Serial.printf("[%lu] [XTC] Failed to write thumbnail BMP\n", millis());
+    SdMan.remove(getThumbBmpPath().c_str());
+    return false;
+  }
+  return true;
+}
+
 uint32_t Xtc::getPageCount() const {
   if (!loaded || !parser) {
     return 0;
@@ -325,6 +343,7 @@ size_t Xtc::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) con
   if (!loaded || !parser) {
     return 0;
   }
+  metrics::ScopedTimer loadTimer(metrics::Timer::PageLoad);
   return const_cast<xtc::XtcParser*>(parser.get())->loadPage(pageIndex, buffer, bufferSize);
 }
 
@@ -334,6 +353,7 @@ xtc::XtcError Xtc::loadPageStreaming(uint32_t pageIndex,
   if (!loaded || !parser) {
     return xtc::XtcError::FILE_NOT_FOUND;
   }
+  metrics::ScopedTimer loadTimer(metrics::Timer::PageLoad);
   return const_cast<xtc::XtcParser*>(parser.get())->loadPageStreaming(pageIndex, callback, chunkSize);
 }
 
@@ -26,6 +26,8 @@ class Xtc {
   std::unique_ptr<xtc::XtcParser> parser;
   bool loaded;
 
+  uint8_t* loadCoverPage(xtc::PageInfo* pageInfo) const;
+
  public:
   explicit Xtc(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)), loaded(false) {
     // Create cache key based on filepath (same as Epub)
@@ -62,6 +64,9 @@ class Xtc {
   // Cover image support (for sleep screen)
   std::string getCoverBmpPath() const;
   bool generateCoverBmp() const;
+  // Small cover for the library grid, regenerated on every call (the caller packs it into its own store)
+  std::string getThumbBmpPath() const;
+  bool generateThumbBmp(int maxWidth, int maxHeight) const;
 
   // Page access
   uint32_t getPageCount() const;
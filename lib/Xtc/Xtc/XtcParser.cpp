@@ -9,6 +9,7 @@
 
 #include <FsHelpers.h>
 #include <HardwareSerial.h>
+#include <Metrics.h>
 #include <SDCardManager.h>
 
 #include <cstring>
@@ -353,7 +354,12 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
   }
 
   // Read bitmap data
-  size_t bytesRead = m_file.read(buffer, bitmapSize);
+  size_t bytesRead;
+  {
+    metrics::ScopedTimer readTimer(metrics::Timer::SdRead);
+    bytesRead = m_file.read(buffer, bitmapSize);
+  }
+  metrics::add(metrics::Counter::SdBytesRead, bytesRead);
   if (bytesRead != bitmapSize) {
     Serial.printf("[%lu] [XTC] Page read error: expected %u, got %u\n", millis(), bitmapSize, bytesRead);
     m_lastError = XtcError::READ_ERROR;
@@ -411,6 +417,7 @@ XtcError XtcParser::loadPageStreaming(uint32_t pageIndex,
     if (bytesRead == 0) {
       return XtcError::READ_ERROR;
     }
+    metrics::add(metrics::Counter::SdBytesRead, bytesRead);
 
     callback(chunk.data(), bytesRead, totalRead);
     totalRead += bytesRead;
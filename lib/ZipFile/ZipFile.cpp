@@ -1,9 +1,23 @@
 #include "ZipFile.h"
 
 #include <HardwareSerial.h>
+#include <Metrics.h>
 #include <SDCardManager.h>
 #include <miniz.h>
 
+namespace {
+// Bulk read of entry data, counted as SD traffic
+size_t readEntryData(FsFile& file, void* buffer, const size_t size) {
+  metrics::ScopedTimer readTimer(metrics::Timer::SdRead);
+  const int dataRead = file.read(buffer, size);
+  if (dataRead <= 0) {
+    return 0;
+  }
+  metrics::add(metrics::Counter::SdBytesRead, dataRead);
+  return dataRead;
+}
+}  // namespace
+
 bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t* outputBuf, const size_t inflatedSize) {
   // Setup inflator
   const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
@@ -56,7 +70,8 @@ bool ZipFile::loadAllFileStatSlims() {
 
     file.seekCur(6);
     file.read(&fileStat.method, 2);
-    file.seekCur(8);
+    file.seekCur(4);
+    file.read(&fileStat.crc, 4);
     file.read(&fileStat.compressedSize, 4);
     file.read(&fileStat.uncompressedSize, 4);
     uint16_t nameLen, m, k;
@@ -114,7 +129,8 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
 
     file.seekCur(6);
     file.read(&fileStat->method, 2);
-    file.seekCur(8);
+    file.seekCur(4);
+    file.read(&fileStat->crc, 4);
     file.read(&fileStat->compressedSize, 4);
     file.read(&fileStat->uncompressedSize, 4);
     uint16_t nameLen, m, k;
@@ -266,6 +282,73 @@ bool ZipFile::getInflatedFileSize(const char* filename, size_t* size) {
   return true;
 }
 
+bool ZipFile::getFileCrc32(const char* filename, uint32_t* crc, size_t* size) {
+  FileStatSlim fileStat = {};
+  if (!loadFileStatSlim(filename, &fileStat)) {
+    return false;
+  }
+
+  *crc = fileStat.crc;
+  if (size) {
+    *size = static_cast<size_t>(fileStat.uncompressedSize);
+  }
+  return true;
+}
+
+bool ZipFile::getFingerprint(uint32_t* fingerprint) {
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
+    return false;
+  }
+
+  if (!loadZipDetails()) {
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+
+  file.seek(zipDetails.centralDirOffset);
+
+  // FNV-1a over the entry count and each entry's CRC-32, compressed and uncompressed size, in directory order
+  uint32_t hash = 2166136261u;
+  const auto addBytes = [&hash](const void* data, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+      hash = (hash ^ static_cast<const uint8_t*>(data)[i]) * 16777619u;
+    }
+  };
+  addBytes(&zipDetails.totalEntries, sizeof(zipDetails.totalEntries));
+
+  uint16_t entries = 0;
+  for (; entries < zipDetails.totalEntries; entries++) {
+    uint32_t sig;
+    if (file.read(&sig, 4) != 4 || sig != 0x02014b50) break;
+
+    uint32_t sums[3];  // CRC-32, compressed size, uncompressed size
+    file.seekCur(12);
+    file.read(sums, sizeof(sums));
+    addBytes(sums, sizeof(sums));
+    uint16_t nameLen, m, k;
+    file.read(&nameLen, 2);
+    file.read(&m, 2);
+    file.read(&k, 2);
+
+    // Skip the rest of this entry (disk, attributes, offset, name, extra field + comment)
+    file.seekCur(12 + nameLen + m + k);
+  }
+
+  if (!wasOpen) {
+    close();
+  }
+  if (entries != zipDetails.totalEntries) {
+    Serial.printf("[%lu] [ZIP] Central directory ended after %u of %u entries\n", millis(), entries,
+                  zipDetails.totalEntries);
+    return false;
+  }
+  *fingerprint = hash;
+  return true;
+}
+
 uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const bool trailingNullByte) {
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
@@ -304,7 +387,7 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
 
   if (fileStat.method == MZ_NO_COMPRESSION) {
     // no deflation, just read content
-    const size_t dataRead = file.read(data, inflatedDataSize);
+    const size_t dataRead = readEntryData(file, data, inflatedDataSize);
     if (!wasOpen) {
       close();
     }
@@ -327,7 +410,7 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
       return nullptr;
     }
 
-    const size_t dataRead = file.read(deflatedData, deflatedDataSize);
+    const size_t dataRead = readEntryData(file, deflatedData, deflatedDataSize);
     if (!wasOpen) {
       close();
     }
@@ -362,7 +445,8 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
   return data;
 }
 
-bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize) {
+bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize,
+                               const std::function<bool()>& shouldAbort) {
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return false;
@@ -395,7 +479,16 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
 
     size_t remaining = inflatedDataSize;
     while (remaining > 0) {
-      const size_t dataRead = file.read(buffer, remaining < chunkSize ? remaining : chunkSize);
+      if (shouldAbort && shouldAbort()) {
+        Serial.printf("[%lu] [ZIP] Aborted reading %s\n", millis(), filename);
+        free(buffer);
+        if (!wasOpen) {
+          close();
+        }
+        return false;
+      }
+
+      const size_t dataRead = readEntryData(file, buffer, remaining < chunkSize ? remaining : chunkSize);
       if (dataRead == 0) {
         Serial.printf("[%lu] [ZIP] Could not read more bytes\n", millis());
         free(buffer);
@@ -465,9 +558,19 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
           // Should not be hit, but a safe protection
           break;  // EOF
         }
+        if (shouldAbort && shouldAbort()) {
+          Serial.printf("[%lu] [ZIP] Aborted reading %s\n", millis(), filename);
+          if (!wasOpen) {
+            close();
+          }
+          free(outputBuffer);
+          free(fileReadBuffer);
+          free(inflator);
+          return false;
+        }
 
         fileReadBufferFilledBytes =
-            file.read(fileReadBuffer, fileRemainingBytes < chunkSize ? fileRemainingBytes : chunkSize);
+            readEntryData(file, fileReadBuffer, fileRemainingBytes < chunkSize ? fileRemainingBytes : chunkSize);
         fileRemainingBytes -= fileReadBufferFilledBytes;
         fileReadBufferCursor = 0;
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <SdFat.h>
 
+#include <functional>
 #include <string>
 #include <unordered_map>
 
@@ -8,6 +9,7 @@ class ZipFile {
  public:
   struct FileStatSlim {
     uint16_t method;             // Compression method
+    uint32_t crc;                // CRC-32 of the uncompressed data
     uint32_t compressedSize;     // Compressed size
     uint32_t uncompressedSize;   // Uncompressed size
     uint32_t localHeaderOffset;  // Offset of local file header
@@ -39,8 +41,14 @@ class ZipFile {
   bool close();
   bool loadAllFileStatSlims();
   bool getInflatedFileSize(const char* filename, size_t* size);
+  // CRC-32 and size from the central directory, a cheap fingerprint of the entry's contents
+  bool getFileCrc32(const char* filename, uint32_t* crc, size_t* size = nullptr);
+  // Hash of the CRC-32 and sizes of all entries in the central directory, identifies the archive by its contents
+  bool getFingerprint(uint32_t* fingerprint);
   // Due to the memory required to run each of these, it is recommended to not preopen the zip file for multiple
   // These functions will open and close the zip as needed
   uint8_t* readFileToMemory(const char* filename, size_t* size = nullptr, bool trailingNullByte = false);
-  bool readFileToStream(const char* filename, Print& out, size_t chunkSize);
+  // Gives up between chunks once shouldAbort returns true
+  bool readFileToStream(const char* filename, Print& out, size_t chunkSize,
+                        const std::function<bool()>& shouldAbort = nullptr);
 };
@@ -1,3 +1,5 @@
+import gzip
+import hashlib
 import os
 import re
 
@@ -39,13 +41,28 @@ for root, _, files in os.walk(SRC_DIR):
                 html_content = f.read()
 
             # minified = regex.sub("\g<1>", html_content)
-            minified = minify_html(html_content)
+            minified = minify_html(html_content).encode("utf-8")
+            # mtime=0 keeps the output, and so the ETag, identical between builds of the same page
+            compressed = gzip.compress(minified, compresslevel=9, mtime=0)
+            # One strong ETag per representation: gzip and identity bodies differ byte for byte
+            etag = hashlib.sha256(compressed).hexdigest()[:16]
+            identity_etag = hashlib.sha256(minified).hexdigest()[:16]
             base_name = f"{os.path.splitext(file)[0]}Html"
             header_path = os.path.join(root, f"{base_name}.generated.h")
 
             with open(header_path, "w", encoding="utf-8") as h:
                 h.write(f"// THIS FILE IS AUTOGENERATED, DO NOT EDIT MANUALLY\n\n")
                 h.write(f"#pragma once\n")
-                h.write(f'constexpr char {base_name}[] PROGMEM = R"rawliteral({minified})rawliteral";\n')
+                h.write(f"#include <cstddef>\n")
+                h.write(f"#include <cstdint>\n\n")
+                h.write(f"// {len(html_content.encode('utf-8'))} bytes source, {len(minified)} minified, "
+                        f"{len(compressed)} gzipped\n")
+                h.write(f"constexpr uint8_t {base_name}Gz[] PROGMEM = {{")
+                for i in range(0, len(compressed), 16):
+                    h.write("\n    " + " ".join(f"0x{b:02x}," for b in compressed[i:i + 16]))
+                h.write("\n};\n")
+                h.write(f"constexpr size_t {base_name}Length = {len(minified)};\n")
+                h.write(f'constexpr char {base_name}ETag[] = "\\"{etag}\\"";\n')
+                h.write(f'constexpr char {base_name}IdentityETag[] = "\\"{identity_etag}\\"";\n')
 
-            print(f"Generated: {header_path}")
+            print(f"Generated: {header_path} ({len(minified)} bytes, {len(compressed)} gzipped)")
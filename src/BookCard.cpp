@@ -0,0 +1,52 @@
+#include "BookCard.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+
+#include <functional>
+
+#include "util/StringUtils.h"
+
+namespace {
+constexpr uint8_t BOOK_CARD_VERSION = 2;
+constexpr char BOOK_CARD_FILE[] = "/.crosspoint/book_card.bin";
+
+uint32_t hashPath(const std::string& bookPath) { return static_cast<uint32_t>(std::hash<std::string>{}(bookPath)); }
+}  // namespace
+
+bool BookCard::save(const std::string& bookPath, const std::string& title, const std::string& author,
+                    const std::string& chapter, const uint8_t progress) {
+  BookCard card = {};
+  card.version = BOOK_CARD_VERSION;
+  card.progress = progress;
+  card.pathHash = hashPath(bookPath);
+  StringUtils::copyTruncated(card.title, sizeof(card.title), title);
+  StringUtils::copyTruncated(card.author, sizeof(card.author), author);
+  StringUtils::copyTruncated(card.chapter, sizeof(card.chapter), chapter);
+
+  FsFile file;
+  if (!SdMan.openFileForWrite("BCD", BOOK_CARD_FILE, file)) {
+    return false;
+  }
+  const bool ok = file.write(reinterpret_cast<const uint8_t*>(&card), sizeof(card)) == sizeof(card);
+  file.close();
+  return ok;
+}
+
+bool BookCard::load(const std::string& bookPath, BookCard& card) {
+  FsFile file;
+  if (!SdMan.openFileForRead("BCD", BOOK_CARD_FILE, file)) {
+    return false;
+  }
+  const bool ok = file.read(&card, sizeof(card)) == static_cast<int>(sizeof(card));
+  file.close();
+
+  if (!ok || card.version != BOOK_CARD_VERSION || card.pathHash != hashPath(bookPath)) {
+    return false;
+  }
+  // Fields are NUL-padded, but don't trust the file for it
+  card.title[sizeof(card.title) - 1] = '\0';
+  card.author[sizeof(card.author) - 1] = '\0';
+  card.chapter[sizeof(card.chapter) - 1] = '\0';
+  return true;
+}
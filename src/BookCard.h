@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * Fixed-layout summary of the last opened book, stored in /.crosspoint/book_card.bin.
+ *
+ * The readers rewrite it whenever they save progress, so the home screen can show the book with a single small
+ * read instead of opening and loading it.
+ */
+struct BookCard {
+  static constexpr uint8_t NO_PROGRESS = 0xFF;
+
+  uint8_t version;
+  uint8_t progress;  // Percent, NO_PROGRESS if unknown
+  uint16_t reserved;
+  uint32_t pathHash;  // Book the card belongs to
+  char title[96];     // NUL-padded, truncated on a character boundary
+  char author[64];
+  char chapter[64];
+
+  static bool save(const std::string& bookPath, const std::string& title, const std::string& author,
+                   const std::string& chapter, uint8_t progress);
+  // Returns false if there is no card for this book
+  static bool load(const std::string& bookPath, BookCard& card);
+};
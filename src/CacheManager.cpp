@@ -0,0 +1,343 @@
+#include "CacheManager.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "CrossPointSettings.h"
+#include "CrossPointState.h"
+#include "util/StringUtils.h"
+
+namespace {
+constexpr char CACHE_DIR[] = "/.crosspoint";
+constexpr char INDEX_PATH[] = "/.crosspoint/cache_index.bin";
+constexpr uint32_t INDEX_MAGIC = 0x58494343;  // "CCIX"
+constexpr uint8_t INDEX_FILE_VERSION = 2;
+
+// The cleanup pass, restarted at boot and whenever a book was opened
+enum class Phase : uint8_t { Idle, Discover, Check, Evict };
+Phase phase = Phase::Discover;
+int nextRecord = 0;
+uint64_t totalSize = 0;  // Sections and images of the records checked so far
+
+bool isEpubDir(const char* dirName) { return strncmp(dirName, "epub_", 5) == 0; }
+
+bool isCacheDir(const char* dirName) { return isEpubDir(dirName) || strncmp(dirName, "xtc_", 4) == 0; }
+
+// Total size of the files directly in a directory, 0 if it does not exist
+uint32_t measureDir(const std::string& path) {
+  FsFile dir = SdMan.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    return 0;
+  }
+  uint32_t size = 0;
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (!file.isDirectory()) {
+      size += static_cast<uint32_t>(file.size());
+    }
+    file.close();
+  }
+  dir.close();
+  return size;
+}
+
+// Removes a directory of what opening the book builds again
+void removeDerivedDir(const std::string& cachePath, const char* subDir) {
+  const std::string path = cachePath + subDir;
+  if (SdMan.exists(path.c_str())) {
+    SdMan.removeDir(path.c_str());
+  }
+}
+}  // namespace
+
+std::string CacheManager::getCachePath(const Record& record) {
+  return std::string(CACHE_DIR) + "/" + std::string(record.dirName, strnlen(record.dirName, DIR_NAME_LENGTH));
+}
+
+uint32_t CacheManager::getLayoutKey() {
+  // FNV-1a of the settings that decide how sections are laid out
+  const uint8_t layout[] = {SETTINGS.fontFamily, SETTINGS.fontSize, SETTINGS.lineSpacing,
+                            SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, SETTINGS.orientation,
+                            SETTINGS.screenMargin};
+  uint32_t hash = 2166136261u;
+  for (const uint8_t value : layout) {
+    hash = (hash ^ value) * 16777619u;
+  }
+  return hash;
+}
+
+bool CacheManager::openIndex(FsFile& file, Header& header) {
+  file = SdMan.open(INDEX_PATH, O_RDWR);
+  if (file && file.size() >= sizeof(Header) &&
+      file.read(&header, sizeof(header)) == static_cast<int>(sizeof(header)) && header.magic == INDEX_MAGIC &&
+      header.version == INDEX_FILE_VERSION && header.count <= MAX_RECORDS &&
+      file.size() >= sizeof(Header) + header.count * sizeof(Record)) {
+    return true;
+  }
+  if (file) {
+    file.close();
+  }
+
+  SdMan.mkdir(CACHE_DIR);
+  if (!SdMan.openFileForWrite("CCH", INDEX_PATH, file)) {
+    return false;
+  }
+  header = {};
+  header.magic = INDEX_MAGIC;
+  header.version = INDEX_FILE_VERSION;
+  if (!writeHeader(file, header)) {
+    Serial.printf("[%lu] [CCH] Failed to create index\n", millis());
+    file.close();
+    SdMan.remove(INDEX_PATH);
+    return false;
+  }
+  return true;
+}
+
+bool CacheManager::writeHeader(FsFile& file, const Header& header) {
+  return file.seek(0) && file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+}
+
+bool CacheManager::readRecord(FsFile& file, const int index, Record& record) {
+  return file.seek(sizeof(Header) + index * sizeof(Record)) &&
+         file.read(&record, sizeof(record)) == static_cast<int>(sizeof(record));
+}
+
+bool CacheManager::writeRecord(FsFile& file, const int index, const Record& record) {
+  return file.seek(sizeof(Header) + index * sizeof(Record)) &&
+         file.write(reinterpret_cast<const uint8_t*>(&record), sizeof(record)) == sizeof(record);
+}
+
+bool CacheManager::removeRecord(FsFile& file, Header& header, const int index) {
+  Record last;
+  if (index != header.count - 1 && !(readRecord(file, header.count - 1, last) && writeRecord(file, index, last))) {
+    return false;
+  }
+  header.count--;
+  return writeHeader(file, header) && file.truncate(sizeof(Header) + header.count * sizeof(Record));
+}
+
+bool CacheManager::isProtected(const Record& record) {
+  // Opening a book records its path, so the open book always has one
+  return !APP_STATE.openEpubPath.empty() && strncmp(record.path, APP_STATE.openEpubPath.c_str(), PATH_LENGTH) == 0;
+}
+
+bool CacheManager::recordAccess(const std::string& bookPath, const std::string& cachePath) {
+  if (bookPath.size() >= PATH_LENGTH) {
+    Serial.printf("[%lu] [CCH] Path too long to index: %s\n", millis(), bookPath.c_str());
+    return false;
+  }
+
+  FsFile file;
+  Header header;
+  if (!openIndex(file, header)) {
+    return false;
+  }
+
+  const std::string dirName = cachePath.substr(cachePath.find_last_of('/') + 1);
+  Record record;
+  int index = 0;
+  for (; index < header.count; index++) {
+    if (!readRecord(file, index, record)) {
+      file.close();
+      return false;
+    }
+    if (strncmp(record.dirName, dirName.c_str(), DIR_NAME_LENGTH) == 0) {
+      break;
+    }
+  }
+  if (index == header.count) {
+    if (header.count == MAX_RECORDS) {
+      Serial.printf("[%lu] [CCH] Index full, not indexing %s\n", millis(), bookPath.c_str());
+      file.close();
+      return false;
+    }
+    record = {};
+    StringUtils::copyTruncated(record.dirName, DIR_NAME_LENGTH, dirName);
+    header.count++;
+  }
+
+  header.clock++;
+  record.lastAccess = header.clock;
+  record.layoutKey = isEpubDir(record.dirName) ? getLayoutKey() : 0;
+  record.missingSince = 0;
+  memset(record.path, 0, PATH_LENGTH);
+  strncpy(record.path, bookPath.c_str(), PATH_LENGTH - 1);
+  const bool ok = writeRecord(file, index, record) && writeHeader(file, header);
+  file.close();
+
+  // The book may have built sections since the last pass measured it
+  if (phase == Phase::Idle) {
+    phase = Phase::Discover;
+  }
+  return ok;
+}
+
+bool CacheManager::runStep() {
+  switch (phase) {
+    case Phase::Idle:
+      return false;
+    case Phase::Discover:
+      addUnknownDirs();
+      phase = Phase::Check;
+      nextRecord = 0;
+      totalSize = 0;
+      return true;
+    case Phase::Check:
+      checkNextRecord();
+      return true;
+    case Phase::Evict:
+      if (evictLeastRecentlyUsed()) {
+        return true;
+      }
+      Serial.printf("[%lu] [CCH] Book caches take %llu KB\n", millis(),
+                    static_cast<unsigned long long>(totalSize / 1024));
+      phase = Phase::Idle;
+      return false;
+  }
+  return false;
+}
+
+void CacheManager::addUnknownDirs() {
+  FsFile file;
+  Header header;
+  if (!openIndex(file, header)) {
+    return;
+  }
+
+  std::vector<std::string> known;
+  known.reserve(header.count);
+  Record record;
+  for (int index = 0; index < header.count; index++) {
+    if (!readRecord(file, index, record)) {
+      file.close();
+      return;
+    }
+    known.emplace_back(record.dirName, strnlen(record.dirName, DIR_NAME_LENGTH));
+  }
+
+  FsFile dir = SdMan.open(CACHE_DIR);
+  if (!dir || !dir.isDirectory()) {
+    file.close();
+    return;
+  }
+  const int knownCount = header.count;
+  char name[DIR_NAME_LENGTH];
+  for (auto entry = dir.openNextFile(); entry && header.count < MAX_RECORDS; entry = dir.openNextFile()) {
+    const bool isDir = entry.isDirectory();
+    entry.getName(name, sizeof(name));
+    entry.close();
+    if (!isDir || !isCacheDir(name) || std::find(known.begin(), known.end(), name) != known.end()) {
+      continue;
+    }
+    // Assumed to be laid out for the current settings, only the size limit removes its sections
+    record = {};
+    StringUtils::copyTruncated(record.dirName, DIR_NAME_LENGTH, name);
+    record.layoutKey = isEpubDir(name) ? getLayoutKey() : 0;
+    if (!writeRecord(file, header.count, record)) {
+      break;
+    }
+    header.count++;
+  }
+  dir.close();
+
+  if (header.count != knownCount) {
+    Serial.printf("[%lu] [CCH] Indexed %d caches without a known book\n", millis(), header.count - knownCount);
+    writeHeader(file, header);
+  }
+  file.close();
+}
+
+void CacheManager::checkNextRecord() {
+  FsFile file;
+  Header header;
+  if (!openIndex(file, header)) {
+    phase = Phase::Idle;
+    return;
+  }
+  Record record;
+  if (nextRecord >= header.count || !readRecord(file, nextRecord, record)) {
+    file.close();
+    phase = Phase::Evict;
+    return;
+  }
+
+  const std::string cachePath = getCachePath(record);
+  const std::string bookPath(record.path, strnlen(record.path, PATH_LENGTH));
+  if (!SdMan.exists(cachePath.c_str())) {
+    // Cleared some other way, the record that moves into this slot is checked next
+    removeRecord(file, header, nextRecord);
+    file.close();
+    return;
+  }
+  if (!bookPath.empty() && !SdMan.exists(bookPath.c_str()) && !isProtected(record)) {
+    // The book may only have been moved, and is then still there under another path
+    if (record.missingSince == 0) {
+      record.missingSince = header.clock + 1;
+    } else if (header.clock + 1 - record.missingSince >= ORPHAN_GRACE_OPENS) {
+      Serial.printf("[%lu] [CCH] Removing cache of missing book %s\n", millis(), bookPath.c_str());
+      SdMan.removeDir(cachePath.c_str());
+      removeRecord(file, header, nextRecord);
+      file.close();
+      return;
+    }
+  } else {
+    record.missingSince = 0;
+  }
+
+  if (isEpubDir(record.dirName) && record.layoutKey != getLayoutKey() && !isProtected(record)) {
+    // The reader would lay these sections out again anyway
+    Serial.printf("[%lu] [CCH] Removing sections of %s laid out with other settings\n", millis(), cachePath.c_str());
+    // Converted images are keyed by their own size and dither mode, which the layout settings do not change
+    removeDerivedDir(cachePath, "/sections");
+    record.layoutKey = getLayoutKey();
+  }
+  record.size = measureDir(cachePath + "/sections") + measureDir(cachePath + "/images");
+  writeRecord(file, nextRecord, record);
+  file.close();
+
+  totalSize += record.size;
+  nextRecord++;
+}
+
+bool CacheManager::evictLeastRecentlyUsed() {
+  if (totalSize <= SETTINGS.getCacheSizeLimitBytes()) {
+    return false;
+  }
+
+  FsFile file;
+  Header header;
+  if (!openIndex(file, header)) {
+    return false;
+  }
+  Record record;
+  Record oldest = {};
+  int oldestIndex = -1;
+  for (int index = 0; index < header.count; index++) {
+    if (!readRecord(file, index, record)) {
+      break;
+    }
+    if (record.size > 0 && !isProtected(record) && (oldestIndex < 0 || record.lastAccess < oldest.lastAccess)) {
+      oldest = record;
+      oldestIndex = index;
+    }
+  }
+  if (oldestIndex < 0) {
+    file.close();
+    return false;
+  }
+
+  const std::string cachePath = getCachePath(oldest);
+  Serial.printf("[%lu] [CCH] Over the limit, removing %lu KB of sections and images from %s\n", millis(),
+                static_cast<unsigned long>(oldest.size / 1024), cachePath.c_str());
+  removeDerivedDir(cachePath, "/sections");
+  removeDerivedDir(cachePath, "/images");
+  totalSize -= oldest.size;
+  oldest.size = 0;
+  writeRecord(file, oldestIndex, oldest);
+  file.close();
+  return true;
+}
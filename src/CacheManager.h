@@ -0,0 +1,71 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Keeps the book caches in /.crosspoint (epub_<key>/ and xtc_<hash>/ directories) from growing forever, using an
+ * index of the cached books in /.crosspoint/cache_index.bin.
+ *
+ * Each record holds the cache directory, the book it belongs to, when the book was last opened and how many bytes
+ * its laid out sections and converted images take. Time is an access counter kept in the index header, as the device
+ * has no clock. Cache directories that are on the card but not in the index (e.g. from before the index existed) are
+ * added without a book path and count as the least recently used.
+ *
+ * The home and library screens run a cleanup pass as idle work of their display task, one step per call:
+ *  - a cache whose book is gone is removed entirely once a few other books were opened since it went missing; EPUB
+ *    caches are keyed by content, so a book that was only moved takes its cache back when opened at the new path
+ *  - sections laid out with different reader settings than the current ones are removed (converted images do not
+ *    depend on those settings and stay)
+ *  - while the sections and images of all books exceed the limit from the settings, those of the least recently
+ *    opened book are removed; they are rebuilt when the book is opened again
+ * Progress, book.bin and the covers stay, so an evicted book still shows in the library and opens where it was left.
+ * The book the home screen offers to continue is never touched.
+ */
+class CacheManager {
+ public:
+  // Records that a book was opened (or prepared) with its cache in `cachePath`, making it the most recently used
+  static bool recordAccess(const std::string& bookPath, const std::string& cachePath);
+  // Runs one step of the cleanup pass, returns whether the pass has more to do
+  static bool runStep();
+
+ private:
+  static constexpr int MAX_RECORDS = 256;
+  static constexpr int DIR_NAME_LENGTH = 28;
+  static constexpr int PATH_LENGTH = 212;
+  // Books opened after a book went missing before its cache is removed
+  static constexpr uint32_t ORPHAN_GRACE_OPENS = 10;
+
+  struct Header {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t count;
+    uint32_t clock;  // Access counter, the lastAccess of the most recently opened book
+  };
+
+  struct Record {
+    char dirName[DIR_NAME_LENGTH];  // NUL-padded
+    uint32_t lastAccess;            // 0 if the book was never opened since the index exists
+    uint32_t size;                  // Bytes of sections and images when last measured
+    uint32_t layoutKey;             // Reader settings the sections were laid out with
+    uint32_t missingSince;          // Access counter + 1 when the book was found missing, 0 while it exists
+    char path[PATH_LENGTH];         // NUL-padded, empty if unknown
+  };
+
+  static std::string getCachePath(const Record& record);
+  static uint32_t getLayoutKey();
+  // Opens the index file and reads its header, creating an empty index if there is none or it is unusable
+  static bool openIndex(FsFile& file, Header& header);
+  static bool writeHeader(FsFile& file, const Header& header);
+  static bool readRecord(FsFile& file, int index, Record& record);
+  static bool writeRecord(FsFile& file, int index, const Record& record);
+  // Moves the last record into the slot of the removed one
+  static bool removeRecord(FsFile& file, Header& header, int index);
+  static bool isProtected(const Record& record);
+
+  static void addUnknownDirs();
+  static void checkNextRecord();
+  static bool evictLeastRecentlyUsed();
+};
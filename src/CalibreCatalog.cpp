@@ -0,0 +1,355 @@
+#include "CalibreCatalog.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "util/StringUtils.h"
+
+namespace {
+constexpr char CATALOG_DIR[] = "/.crosspoint";
+constexpr char CATALOG_PATH[] = "/.crosspoint/calibre.bin";
+constexpr uint32_t CATALOG_MAGIC = 0x4C414343;  // "CCAL"
+constexpr uint8_t CATALOG_FILE_VERSION = 1;
+// magic, version, padding, book count
+constexpr uint32_t HEADER_SIZE = 4 + 1 + 1 + 2;
+}  // namespace
+
+uint32_t CalibreCatalog::hash(const std::string& text) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (const char c : text) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+uint32_t CalibreCatalog::fingerprint(const uint32_t lpathHash, const uint32_t size, const uint16_t modifyDate,
+                                     const uint16_t modifyTime) {
+  uint32_t hash = lpathHash;
+  hash = (hash ^ size) * 16777619u;
+  hash = (hash ^ (static_cast<uint32_t>(modifyDate) << 16 | modifyTime)) * 16777619u;
+  return hash;
+}
+
+bool CalibreCatalog::open() {
+  pending.clear();
+  dropped.clear();
+  return openFile();
+}
+
+bool CalibreCatalog::openFile() {
+  close();
+  count = 0;
+  file = SdMan.open(CATALOG_PATH);
+  if (!file) {
+    return false;
+  }
+
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  uint8_t padding = 0;
+  if (file.size() >= HEADER_SIZE) {
+    serialization::readPod(file, magic);
+    serialization::readPod(file, version);
+    serialization::readPod(file, padding);
+    serialization::readPod(file, count);
+  }
+
+  if (magic != CATALOG_MAGIC || version != CATALOG_FILE_VERSION ||
+      file.size() != HEADER_SIZE + count * (sizeof(Record) + sizeof(UuidSlot))) {
+    Serial.printf("[%lu] [CAL] Ignoring invalid Calibre catalogue\n", millis());
+    close();
+    count = 0;
+    return false;
+  }
+  return true;
+}
+
+void CalibreCatalog::close() {
+  if (file) {
+    file.close();
+  }
+}
+
+void CalibreCatalog::toRecord(const Book& book, Record& record) {
+  memset(&record, 0, sizeof(record));
+  record.lpathHash = hash(book.lpath);
+  record.size = book.size;
+  record.modifyDate = book.modifyDate;
+  record.modifyTime = book.modifyTime;
+  StringUtils::copyTruncated(record.lpath, sizeof(record.lpath), book.lpath);
+  StringUtils::copyTruncated(record.uuid, sizeof(record.uuid), book.uuid);
+  StringUtils::copyTruncated(record.lastModified, sizeof(record.lastModified), book.lastModified);
+  StringUtils::copyTruncated(record.title, sizeof(record.title), book.title);
+  StringUtils::copyTruncated(record.authors, sizeof(record.authors), book.authors);
+}
+
+void CalibreCatalog::fromRecord(const Record& record, Book& book) {
+  book.lpath.assign(record.lpath, strnlen(record.lpath, sizeof(record.lpath)));
+  book.uuid.assign(record.uuid, strnlen(record.uuid, sizeof(record.uuid)));
+  book.lastModified.assign(record.lastModified, strnlen(record.lastModified, sizeof(record.lastModified)));
+  book.title.assign(record.title, strnlen(record.title, sizeof(record.title)));
+  book.authors.assign(record.authors, strnlen(record.authors, sizeof(record.authors)));
+  book.size = record.size;
+  book.modifyDate = record.modifyDate;
+  book.modifyTime = record.modifyTime;
+}
+
+bool CalibreCatalog::readRecord(const size_t index, Record& record) {
+  return file.seek(HEADER_SIZE + index * sizeof(Record)) &&
+         file.read(&record, sizeof(Record)) == static_cast<int>(sizeof(Record));
+}
+
+bool CalibreCatalog::readUuidSlot(const size_t index, UuidSlot& slot) {
+  return file.seek(HEADER_SIZE + count * sizeof(Record) + index * sizeof(UuidSlot)) &&
+         file.read(&slot, sizeof(UuidSlot)) == static_cast<int>(sizeof(UuidSlot));
+}
+
+size_t CalibreCatalog::lowerBound(const uint32_t sectionOffset, const size_t entrySize, const uint32_t key) {
+  size_t low = 0;
+  size_t high = count;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    uint32_t midHash = 0;
+    if (!file.seek(sectionOffset + mid * entrySize) ||
+        file.read(&midHash, sizeof(midHash)) != static_cast<int>(sizeof(midHash))) {
+      return count;
+    }
+    if (midHash < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+bool CalibreCatalog::isReplaced(const std::string& lpath) const {
+  return std::find(dropped.begin(), dropped.end(), lpath) != dropped.end() ||
+         std::any_of(pending.begin(), pending.end(), [&lpath](const Book& book) { return book.lpath == lpath; });
+}
+
+bool CalibreCatalog::readBook(const size_t index, Book& book) {
+  Record record;
+  if (!file || index >= count || !readRecord(index, record)) {
+    return false;
+  }
+  fromRecord(record, book);
+  return true;
+}
+
+bool CalibreCatalog::findByLpath(const std::string& lpath, Book& book) {
+  for (const auto& pendingBook : pending) {
+    if (pendingBook.lpath == lpath) {
+      book = pendingBook;
+      return true;
+    }
+  }
+  if (!file || lpath.empty() || isReplaced(lpath)) {
+    return false;
+  }
+
+  const uint32_t key = hash(lpath);
+  Record record;
+  for (size_t i = lowerBound(HEADER_SIZE, sizeof(Record), key); i < count && readRecord(i, record); i++) {
+    if (record.lpathHash != key) {
+      break;
+    }
+    if (strncmp(record.lpath, lpath.c_str(), sizeof(record.lpath)) == 0) {
+      fromRecord(record, book);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CalibreCatalog::findByUuid(const std::string& uuid, Book& book) {
+  if (uuid.empty()) {
+    return false;
+  }
+  for (const auto& pendingBook : pending) {
+    if (pendingBook.uuid == uuid) {
+      book = pendingBook;
+      return true;
+    }
+  }
+  if (!file) {
+    return false;
+  }
+
+  const uint32_t key = hash(uuid);
+  UuidSlot slot;
+  Record record;
+  for (size_t i = lowerBound(HEADER_SIZE + count * sizeof(Record), sizeof(UuidSlot), key);
+       i < count && readUuidSlot(i, slot); i++) {
+    if (slot.uuidHash != key) {
+      break;
+    }
+    if (readRecord(slot.record, record) && strncmp(record.uuid, uuid.c_str(), sizeof(record.uuid)) == 0) {
+      fromRecord(record, book);
+      if (!isReplaced(book.lpath)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool CalibreCatalog::put(Book book) {
+  if (book.lpath.empty() || book.lpath.size() >= LPATH_LENGTH) {
+    return false;
+  }
+
+  FsFile bookFile;
+  if (!SdMan.openFileForRead("CAL", "/" + book.lpath, bookFile)) {
+    return false;
+  }
+  book.size = static_cast<uint32_t>(bookFile.size());
+  bookFile.getModifyDateTime(&book.modifyDate, &book.modifyTime);
+  bookFile.close();
+
+  // The same book stored under another lpath is superseded
+  Book previous;
+  if (findByUuid(book.uuid, previous) && previous.lpath != book.lpath) {
+    dropped.push_back(previous.lpath);
+  }
+  pending.erase(std::remove_if(pending.begin(), pending.end(),
+                               [&book](const Book& pendingBook) {
+                                 return pendingBook.lpath == book.lpath ||
+                                        (!book.uuid.empty() && pendingBook.uuid == book.uuid);
+                               }),
+                pending.end());
+  pending.push_back(std::move(book));
+
+  if (pending.size() >= MAX_PENDING) {
+    return commit();
+  }
+  return true;
+}
+
+bool CalibreCatalog::scanCard(std::vector<uint32_t>& fingerprints) {
+  auto root = SdMan.open("/");
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return false;
+  }
+
+  root.rewindDirectory();
+  char name[500];
+  for (auto entry = root.openNextFile(); entry; entry = root.openNextFile()) {
+    if (!entry.isDirectory()) {
+      entry.getName(name, sizeof(name));
+      uint16_t modifyDate = 0;
+      uint16_t modifyTime = 0;
+      entry.getModifyDateTime(&modifyDate, &modifyTime);
+      fingerprints.push_back(fingerprint(hash(name), static_cast<uint32_t>(entry.size()), modifyDate, modifyTime));
+    }
+    entry.close();
+  }
+  root.close();
+  std::sort(fingerprints.begin(), fingerprints.end());
+  return true;
+}
+
+bool CalibreCatalog::commit() {
+  const unsigned long start = millis();
+  std::vector<uint32_t> cardFingerprints;
+  if (!scanCard(cardFingerprints)) {
+    return false;
+  }
+  const auto isOnCard = [&cardFingerprints](const Record& record) {
+    return std::binary_search(cardFingerprints.begin(), cardFingerprints.end(),
+                              fingerprint(record.lpathHash, record.size, record.modifyDate, record.modifyTime));
+  };
+
+  // Stored books to keep, found with a sequential pass that only needs to rewrite the file if something changed
+  std::vector<uint16_t> kept;
+  kept.reserve(count);
+  Record record;
+  for (size_t i = 0; file && i < count; i++) {
+    if (!readRecord(i, record)) {
+      return false;
+    }
+    if (isOnCard(record) && !isReplaced(std::string(record.lpath, strnlen(record.lpath, sizeof(record.lpath))))) {
+      kept.push_back(static_cast<uint16_t>(i));
+    }
+  }
+  if (pending.empty() && kept.size() == count) {
+    dropped.clear();
+    return true;
+  }
+
+  // Merge the kept books and the pending ones in (lpath hash, lpath) order
+  std::vector<Record> added(pending.size());
+  for (size_t i = 0; i < pending.size(); i++) {
+    toRecord(pending[i], added[i]);
+  }
+  const auto recordLess = [](const Record& record1, const Record& record2) {
+    if (record1.lpathHash != record2.lpathHash) return record1.lpathHash < record2.lpathHash;
+    return strncmp(record1.lpath, record2.lpath, sizeof(record1.lpath)) < 0;
+  };
+  std::sort(added.begin(), added.end(), recordLess);
+
+  SdMan.mkdir(CATALOG_DIR);
+  const std::string tmpPath = std::string(CATALOG_PATH) + ".tmp";
+  FsFile out;
+  if (!SdMan.openFileForWrite("CAL", tmpPath, out)) {
+    return false;
+  }
+
+  const auto bookCount = static_cast<uint16_t>(std::min<size_t>(kept.size() + added.size(), UINT16_MAX));
+  serialization::writePod(out, CATALOG_MAGIC);
+  serialization::writePod(out, CATALOG_FILE_VERSION);
+  serialization::writePod(out, static_cast<uint8_t>(0));
+  serialization::writePod(out, bookCount);
+
+  bool ok = true;
+  std::vector<UuidSlot> uuidSlots;
+  uuidSlots.reserve(bookCount);
+  size_t nextKept = 0;
+  size_t nextAdded = 0;
+  for (uint32_t written = 0; ok && written < bookCount; written++) {
+    Record storedRecord;
+    const bool haveStored = nextKept < kept.size() && readRecord(kept[nextKept], storedRecord);
+    const bool takeAdded =
+        nextAdded < added.size() && (!haveStored || recordLess(added[nextAdded], storedRecord));
+    if (!haveStored && !takeAdded) {
+      ok = false;
+      break;
+    }
+    const Record& next = takeAdded ? added[nextAdded++] : storedRecord;
+    if (!takeAdded) {
+      nextKept++;
+    }
+    ok = out.write(reinterpret_cast<const uint8_t*>(&next), sizeof(Record)) == sizeof(Record);
+    uuidSlots.push_back({hash(std::string(next.uuid, strnlen(next.uuid, sizeof(next.uuid)))), written});
+  }
+  std::sort(uuidSlots.begin(), uuidSlots.end(),
+            [](const UuidSlot& slot1, const UuidSlot& slot2) { return slot1.uuidHash < slot2.uuidHash; });
+  for (const auto& slot : uuidSlots) {
+    ok = ok && out.write(reinterpret_cast<const uint8_t*>(&slot), sizeof(UuidSlot)) == sizeof(UuidSlot);
+  }
+
+  close();
+  if (ok) {
+    SdMan.remove(CATALOG_PATH);
+    ok = out.rename(CATALOG_PATH);
+  }
+  out.close();
+  if (!ok) {
+    Serial.printf("[%lu] [CAL] Failed to write Calibre catalogue\n", millis());
+    SdMan.remove(tmpPath.c_str());
+    openFile();
+    return false;
+  }
+
+  Serial.printf("[%lu] [CAL] Catalogue has %u books (%zu recorded, %zu dropped) after %lu ms\n", millis(), bookCount,
+                added.size(), count - kept.size(), millis() - start);
+  pending.clear();
+  dropped.clear();
+  return openFile();
+}
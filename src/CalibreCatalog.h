@@ -0,0 +1,103 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Catalogue of the books Calibre sent to the device, stored in /.crosspoint/calibre.bin, so a wireless session can
+ * tell Calibre which books are already on the card and Calibre only sends what is new or changed.
+ *
+ * The file holds a header, one fixed-size record per book sorted by lpath hash, and a UUID section of (hash, record)
+ * pairs sorted by UUID hash. Finding a book by lpath or UUID is a binary search with one seek per step, and the book
+ * list is read in record order.
+ *
+ * Books recorded during a session are kept in memory and merged into the file by commit(), which also drops books
+ * whose file was deleted or changed on the card since it was recorded (checked by size and modification time).
+ * Record positions stay valid until the next commit().
+ */
+class CalibreCatalog {
+ public:
+  struct Book {
+    std::string lpath;  // Relative to the card root, where the book file is stored
+    std::string uuid;
+    std::string title;
+    std::string authors;
+    std::string lastModified;  // Calibre's timestamp, compared by Calibre to decide whether to resend the book
+    uint32_t size = 0;
+    uint16_t modifyDate = 0;  // FAT date and time of the book file when it was recorded
+    uint16_t modifyTime = 0;
+  };
+
+  CalibreCatalog() = default;
+  ~CalibreCatalog() { close(); }
+
+  CalibreCatalog(const CalibreCatalog&) = delete;
+  CalibreCatalog& operator=(const CalibreCatalog&) = delete;
+
+  // Opens the stored catalogue, returns false if there is none yet (it starts out empty then)
+  bool open();
+  void close();
+
+  // Books in the file; books recorded since the last commit() are not included
+  size_t getCount() const { return count; }
+  bool readBook(size_t index, Book& book);
+
+  // Find a book by lpath or UUID, including books recorded since the last commit()
+  bool findByLpath(const std::string& lpath, Book& book);
+  bool findByUuid(const std::string& uuid, Book& book);
+
+  // Records a book whose file is on the card, replacing any book with the same lpath or UUID. Size and modification
+  // time are taken from the file. Commits once enough books are pending.
+  bool put(Book book);
+
+  // Merges the recorded books into the file and drops the books no longer on the card
+  bool commit();
+
+ private:
+  static constexpr int LPATH_LENGTH = 128;
+  static constexpr int UUID_LENGTH = 40;
+  static constexpr int TITLE_LENGTH = 64;
+  static constexpr int AUTHORS_LENGTH = 40;
+  static constexpr int LAST_MODIFIED_LENGTH = 36;
+  static constexpr size_t MAX_PENDING = 32;
+
+  struct Record {
+    uint32_t lpathHash;
+    uint32_t size;
+    uint16_t modifyDate;
+    uint16_t modifyTime;
+    char lpath[LPATH_LENGTH];  // NUL-padded
+    char uuid[UUID_LENGTH];
+    char lastModified[LAST_MODIFIED_LENGTH];
+    char title[TITLE_LENGTH];  // Truncated on a character boundary
+    char authors[AUTHORS_LENGTH];
+  };
+
+  struct UuidSlot {
+    uint32_t uuidHash;
+    uint32_t record;
+  };
+
+  bool openFile();
+  static uint32_t hash(const std::string& text);
+  static uint32_t fingerprint(uint32_t lpathHash, uint32_t size, uint16_t modifyDate, uint16_t modifyTime);
+  static void toRecord(const Book& book, Record& record);
+  static void fromRecord(const Record& record, Book& book);
+  bool readRecord(size_t index, Record& record);
+  bool readUuidSlot(size_t index, UuidSlot& slot);
+  // Position of the first entry of a section (records or UUID slots, both start with their hash) whose hash is not
+  // less than `key`
+  size_t lowerBound(uint32_t sectionOffset, size_t entrySize, uint32_t key);
+  // Whether a stored book has been superseded by a book recorded since the last commit()
+  bool isReplaced(const std::string& lpath) const;
+  // Sorted fingerprints of the files in the card root, by name, size and modification time
+  static bool scanCard(std::vector<uint32_t>& fingerprints);
+
+  FsFile file;
+  uint16_t count = 0;
+  std::vector<Book> pending;
+  std::vector<std::string> dropped;  // lpaths of stored books replaced by a pending book with the same UUID
+};
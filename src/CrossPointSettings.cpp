@@ -14,7 +14,7 @@ CrossPointSettings CrossPointSettings::instance;
 namespace {
 constexpr uint8_t SETTINGS_FILE_VERSION = 1;
 // Increment this when adding new persisted settings fields
-constexpr uint8_t SETTINGS_COUNT = 17;
+constexpr uint8_t SETTINGS_COUNT = 19;
 constexpr char SETTINGS_FILE[] = "/.crosspoint/settings.bin";
 }  // namespace
 
@@ -47,6 +47,8 @@ bool CrossPointSettings::saveToFile() const {
   serialization::writeString(outputFile, std::string(opdsServerUrl));
   serialization::writePod(outputFile, textAntiAliasing);
   serialization::writePod(outputFile, hideBatteryPercentage);
+  serialization::writePod(outputFile, libraryView);
+  serialization::writePod(outputFile, cacheSizeLimit);
   outputFile.close();
 
   Serial.printf("[%lu] [CPS] Settings saved to file\n", millis());
@@ -113,6 +115,10 @@ bool CrossPointSettings::loadFromFile() {
     if (++settingsRead >= fileSettingsCount) break;
     serialization::readPod(inputFile, hideBatteryPercentage);
     if (++settingsRead >= fileSettingsCount) break;
+    serialization::readPod(inputFile, libraryView);
+    if (++settingsRead >= fileSettingsCount) break;
+    serialization::readPod(inputFile, cacheSizeLimit);
+    if (++settingsRead >= fileSettingsCount) break;
   } while (false);
 
   inputFile.close();
@@ -188,6 +194,20 @@ int CrossPointSettings::getRefreshFrequency() const {
   }
 }
 
+uint32_t CrossPointSettings::getCacheSizeLimitBytes() const {
+  switch (cacheSizeLimit) {
+    case CACHE_100_MB:
+      return 100UL * 1024 * 1024;
+    case CACHE_250_MB:
+      return 250UL * 1024 * 1024;
+    case CACHE_500_MB:
+    default:
+      return 500UL * 1024 * 1024;
+    case CACHE_1_GB:
+      return 1024UL * 1024 * 1024;
+  }
+}
+
 int CrossPointSettings::getReaderFontId() const {
   switch (fontFamily) {
     case BOOKERLY:
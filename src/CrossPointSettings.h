@@ -58,6 +58,12 @@ class CrossPointSettings {
   // Hide battery percentage
   enum HIDE_BATTERY_PERCENTAGE { HIDE_NEVER = 0, HIDE_READER = 1, HIDE_ALWAYS = 2 };
 
+  // File browser layout
+  enum LIBRARY_VIEW { LIST = 0, GRID = 1 };
+
+  // Space the book caches (laid out sections and converted images) may take on the SD card
+  enum CACHE_SIZE_LIMIT { CACHE_100_MB = 0, CACHE_250_MB = 1, CACHE_500_MB = 2, CACHE_1_GB = 3 };
+
   // Sleep screen settings
   uint8_t sleepScreen = DARK;
   // Sleep screen cover mode settings
@@ -90,6 +96,10 @@ class CrossPointSettings {
   char opdsServerUrl[128] = "";
   // Hide battery percentage
   uint8_t hideBatteryPercentage = HIDE_NEVER;
+  // File browser layout
+  uint8_t libraryView = LIST;
+  // Book cache size limit
+  uint8_t cacheSizeLimit = CACHE_500_MB;
 
   ~CrossPointSettings() = default;
 
@@ -107,6 +117,7 @@ class CrossPointSettings {
   float getReaderLineCompression() const;
   unsigned long getSleepTimeoutMs() const;
   int getRefreshFrequency() const;
+  uint32_t getCacheSizeLimitBytes() const;
 };
 
 // Helper macro to access settings
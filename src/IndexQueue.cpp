@@ -0,0 +1,249 @@
+#include "IndexQueue.h"
+
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <GfxRenderer.h>
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+
+#include <cstring>
+#include <memory>
+
+#include "CacheManager.h"
+#include "CrossPointSettings.h"
+#include "activities/reader/EpubReaderActivity.h"
+#include "util/StringUtils.h"
+
+namespace {
+constexpr char QUEUE_PATH[] = "/.crosspoint/index_queue.bin";
+constexpr uint32_t QUEUE_MAGIC = 0x51584943;  // "CIXQ"
+constexpr uint8_t QUEUE_FILE_VERSION = 1;
+}  // namespace
+
+uint32_t IndexQueue::hashPath(const std::string& bookPath) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (const char c : bookPath) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+bool IndexQueue::openQueue(FsFile& file, Header& header) {
+  file = SdMan.open(QUEUE_PATH, O_RDWR);
+  if (file && file.size() == sizeof(Header) + SLOTS * sizeof(Slot) &&
+      file.read(&header, sizeof(header)) == static_cast<int>(sizeof(header)) && header.magic == QUEUE_MAGIC &&
+      header.version == QUEUE_FILE_VERSION && header.head < SLOTS && header.count <= SLOTS) {
+    return true;
+  }
+  if (file) {
+    file.close();
+  }
+
+  // Lay out the whole ring up front, so slots are only ever overwritten in place
+  SdMan.mkdir("/.crosspoint");
+  if (!SdMan.openFileForWrite("IDX", QUEUE_PATH, file)) {
+    return false;
+  }
+  header = {};
+  header.magic = QUEUE_MAGIC;
+  header.version = QUEUE_FILE_VERSION;
+  const Slot empty = {};
+  bool ok = file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+  for (int slot = 0; ok && slot < SLOTS; slot++) {
+    ok = file.write(reinterpret_cast<const uint8_t*>(&empty), sizeof(empty)) == sizeof(empty);
+  }
+  if (!ok) {
+    Serial.printf("[%lu] [IDX] Failed to create queue\n", millis());
+    file.close();
+    SdMan.remove(QUEUE_PATH);
+  }
+  return ok;
+}
+
+bool IndexQueue::writeHeader(FsFile& file, const Header& header) {
+  return file.seek(0) && file.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+}
+
+bool IndexQueue::readSlot(FsFile& file, const int slot, Slot& entry) {
+  return file.seek(sizeof(Header) + slot * sizeof(Slot)) &&
+         file.read(&entry, sizeof(entry)) == static_cast<int>(sizeof(entry));
+}
+
+bool IndexQueue::writeSlot(FsFile& file, const int slot, const Slot& entry) {
+  return file.seek(sizeof(Header) + slot * sizeof(Slot)) &&
+         file.write(reinterpret_cast<const uint8_t*>(&entry), sizeof(entry)) == sizeof(entry);
+}
+
+bool IndexQueue::add(const std::string& bookPath) {
+  if (!StringUtils::checkFileExtension(bookPath, ".epub")) {
+    return false;
+  }
+  if (bookPath.size() >= PATH_LENGTH) {
+    Serial.printf("[%lu] [IDX] Path too long to queue: %s\n", millis(), bookPath.c_str());
+    return false;
+  }
+
+  FsFile file;
+  Header header;
+  if (!openQueue(file, header)) {
+    return false;
+  }
+
+  const uint32_t pathHash = hashPath(bookPath);
+  Slot entry;
+  for (int i = 0; i < header.count; i++) {
+    if (!readSlot(file, (header.head + i) % SLOTS, entry)) {
+      file.close();
+      return false;
+    }
+    if (entry.pathHash == pathHash && bookPath == entry.path) {
+      // The file was replaced; if it is the book being worked on, start over with the new file
+      bool ok = true;
+      if (i == 0 && (header.stage != 0 || header.attempts != 0)) {
+        header.stage = 0;
+        header.attempts = 0;
+        ok = writeHeader(file, header);
+      }
+      file.close();
+      return ok;
+    }
+  }
+
+  if (header.count == SLOTS) {
+    // The book is still indexed when it is opened
+    Serial.printf("[%lu] [IDX] Queue full, not queueing %s\n", millis(), bookPath.c_str());
+    file.close();
+    return false;
+  }
+
+  entry = {};
+  entry.pathHash = pathHash;
+  strncpy(entry.path, bookPath.c_str(), PATH_LENGTH - 1);
+  const int slot = (header.head + header.count) % SLOTS;
+  header.count++;
+  const bool ok = writeSlot(file, slot, entry) && writeHeader(file, header);
+  file.close();
+  if (ok) {
+    Serial.printf("[%lu] [IDX] Queued %s (%u waiting)\n", millis(), bookPath.c_str(), header.count);
+  }
+  return ok;
+}
+
+bool IndexQueue::runStep(GfxRenderer& renderer, const std::function<bool()>& shouldAbort) {
+  if (!SdMan.exists(QUEUE_PATH)) {
+    return false;
+  }
+  FsFile file;
+  Header header;
+  if (!openQueue(file, header)) {
+    return false;
+  }
+  if (header.count == 0) {
+    file.close();
+    return false;
+  }
+
+  Slot entry;
+  if (!readSlot(file, header.head, entry)) {
+    file.close();
+    return false;
+  }
+  const std::string bookPath(entry.path, strnlen(entry.path, PATH_LENGTH));
+
+  bool bookDone = header.stage >= static_cast<uint8_t>(Stage::COUNT) || !SdMan.exists(bookPath.c_str());
+  if (!bookDone && header.attempts >= MAX_ATTEMPTS) {
+    Serial.printf("[%lu] [IDX] Giving up on %s after %u attempts at stage %u\n", millis(), bookPath.c_str(),
+                  header.attempts, header.stage);
+    bookDone = true;
+  }
+
+  if (!bookDone) {
+    // Recorded before the stage runs, so a stage that never returns is not retried forever
+    header.attempts++;
+    if (!writeHeader(file, header)) {
+      file.close();
+      return false;
+    }
+    file.close();
+
+    const unsigned long start = millis();
+    const auto stage = static_cast<Stage>(header.stage);
+    const bool ok = runStage(stage, bookPath, renderer, shouldAbort);
+    const bool aborted = !ok && shouldAbort && shouldAbort();
+    Serial.printf("[%lu] [IDX] Stage %u of %s %s in %lu ms\n", millis(), header.stage, bookPath.c_str(),
+                  ok ? "done" : aborted ? "interrupted" : "failed", millis() - start);
+
+    if (!openQueue(file, header)) {
+      return false;
+    }
+    if (aborted) {
+      // Cut short to give way, not a failure of the book: run the stage again later
+      if (header.attempts > 0) {
+        header.attempts--;
+      }
+      const bool more = writeHeader(file, header) && header.count > 0;
+      file.close();
+      return more;
+    }
+    // A book that cannot be opened has nothing left to prepare
+    bookDone = (!ok && stage == Stage::Metadata) || header.stage + 1 >= static_cast<uint8_t>(Stage::COUNT);
+    if (!bookDone) {
+      header.stage++;
+      header.attempts = 0;
+    }
+  }
+
+  if (bookDone) {
+    header.head = (header.head + 1) % SLOTS;
+    header.count--;
+    header.stage = 0;
+    header.attempts = 0;
+  }
+  const bool more = writeHeader(file, header) && header.count > 0;
+  file.close();
+  return more;
+}
+
+bool IndexQueue::runStage(const Stage stage, const std::string& bookPath, GfxRenderer& renderer,
+                          const std::function<bool()>& shouldAbort) {
+  const auto epub = std::make_shared<Epub>(bookPath, "/.crosspoint");
+  epub->setAbortCheck(shouldAbort);
+  if (stage == Stage::Metadata) {
+    if (!epub->load(true)) {
+      return false;
+    }
+    // Indexed as just used, so the cache manager keeps what is prepared here and knows its book
+    CacheManager::recordAccess(bookPath, epub->getCachePath());
+    return true;
+  }
+  if (!epub->load(false)) {
+    return false;
+  }
+
+  if (stage == Stage::Cover) {
+    return epub->generateCoverBmp(SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP);
+  }
+
+  // The section the reader opens a new book at, laid out for the reader's orientation. The renderer is shared with
+  // the screen, so it stays in the screen's orientation and only its fonts are used.
+  const int spineIndex = epub->getSpineIndexForTextReference();
+  if (spineIndex < 0 || spineIndex >= epub->getSpineItemsCount()) {
+    return false;
+  }
+  const auto orientation = EpubReaderActivity::getOrientation();
+  int marginTop, marginRight, marginBottom, marginLeft;
+  EpubReaderActivity::getPageMargins(orientation, &marginTop, &marginRight, &marginBottom, &marginLeft);
+  const uint16_t viewportWidth = GfxRenderer::getScreenWidth(orientation) - marginLeft - marginRight;
+  const uint16_t viewportHeight = GfxRenderer::getScreenHeight(orientation) - marginTop - marginBottom;
+
+  Section section(epub, spineIndex, renderer);
+  if (section.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                              SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                              viewportHeight)) {
+    return true;
+  }
+  return section.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                   SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                   viewportHeight);
+}
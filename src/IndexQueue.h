@@ -0,0 +1,64 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+class GfxRenderer;
+
+/**
+ * Books waiting to be prepared for reading, stored in /.crosspoint/index_queue.bin.
+ *
+ * Transfers (web upload, Calibre, OPDS) add the EPUBs they receive. The home and library screens then work through
+ * the queue as idle work of their display task, one stage of one book per step: the spine/TOC cache (book.bin), the
+ * sleep screen cover and the first text section at the current reader layout. Opening a book later only has to load
+ * what is already there. The reader does not run the queue, so indexing pauses while a book is open.
+ *
+ * A stage holds the display task, and with it the SD card, until it returns. Its work polls an abort check between
+ * chunks (ZIP reads, MCU rows, chapter text), so a pending render, a button handler waiting for the render lock or
+ * leaving the screen cuts it short. An interrupted stage is not counted as an attempt and starts over on a later step.
+ *
+ * The file is a fixed ring of path slots with a header holding the position of the first book and the stage it has
+ * reached, so the queue survives reboots and its size never grows. Only the book being worked on is held in memory.
+ * A book whose stage keeps failing to finish (e.g. the device restarts during it) is given up after a few attempts.
+ */
+class IndexQueue {
+ public:
+  // Adds an EPUB to the queue, or restarts it if already queued; other files are ignored
+  static bool add(const std::string& bookPath);
+  // Runs one stage of the first queued book, returns whether books are left.
+  // The stage gives up as soon as shouldAbort returns true.
+  static bool runStep(GfxRenderer& renderer, const std::function<bool()>& shouldAbort);
+
+ private:
+  enum class Stage : uint8_t { Metadata, Cover, FirstSection, COUNT };
+
+  static constexpr int SLOTS = 32;
+  static constexpr int PATH_LENGTH = 252;
+  static constexpr uint8_t MAX_ATTEMPTS = 2;
+
+  struct Header {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t stage;
+    uint8_t attempts;  // Times the current stage of the first book was started
+    uint8_t reserved;
+    uint16_t head;
+    uint16_t count;
+  };
+
+  struct Slot {
+    uint32_t pathHash;
+    char path[PATH_LENGTH];  // NUL-padded
+  };
+
+  static uint32_t hashPath(const std::string& bookPath);
+  // Opens the queue file and reads its header, creating an empty queue if there is none or it is unusable
+  static bool openQueue(FsFile& file, Header& header);
+  static bool writeHeader(FsFile& file, const Header& header);
+  static bool readSlot(FsFile& file, int slot, Slot& entry);
+  static bool writeSlot(FsFile& file, int slot, const Slot& entry);
+  static bool runStage(Stage stage, const std::string& bookPath, GfxRenderer& renderer,
+                       const std::function<bool()>& shouldAbort);
+};
@@ -0,0 +1,376 @@
+#include "LibraryIndex.h"
+
+#include <Epub.h>
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <Xtc.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "util/StringUtils.h"
+
+namespace {
+constexpr char LIBRARY_DIR[] = "/.crosspoint/library";
+constexpr uint32_t LIBRARY_MAGIC = 0x42494C43;  // "CLIB"
+constexpr uint8_t LIBRARY_FILE_VERSION = 1;
+// magic, version, padding, entry count, fingerprint, names offset
+constexpr uint32_t HEADER_SIZE = 4 + 1 + 1 + 2 + 4 + 4;
+
+std::string joinPath(const std::string& dirPath, const std::string& name) {
+  return dirPath.back() == '/' ? dirPath + name : dirPath + "/" + name;
+}
+}  // namespace
+
+std::string LibraryIndex::getIndexPath(const std::string& dirPath) {
+  return std::string(LIBRARY_DIR) + "/dir_" + std::to_string(std::hash<std::string>{}(dirPath)) + ".bin";
+}
+
+uint32_t LibraryIndex::hashName(const std::string& name) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (const char c : name) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+uint32_t LibraryIndex::fingerprintEntry(const uint32_t nameHash, const uint32_t size, const uint16_t modifyDate,
+                                        const uint16_t modifyTime) {
+  uint32_t hash = nameHash;
+  hash = (hash ^ size) * 16777619u;
+  hash = (hash ^ (static_cast<uint32_t>(modifyDate) << 16 | modifyTime)) * 16777619u;
+  return hash;
+}
+
+bool LibraryIndex::open(const std::string& dirPath) {
+  close();
+  this->dirPath = dirPath;
+  count = 0;
+  fingerprint = 0;
+  metadataCursor = 0;
+
+  file = SdMan.open(getIndexPath(dirPath).c_str(), O_RDWR);
+  if (!file) {
+    return false;
+  }
+
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  uint8_t padding = 0;
+  if (file.size() >= HEADER_SIZE) {
+    serialization::readPod(file, magic);
+    serialization::readPod(file, version);
+    serialization::readPod(file, padding);
+    serialization::readPod(file, count);
+    serialization::readPod(file, fingerprint);
+    serialization::readPod(file, namesOffset);
+  }
+
+  if (magic != LIBRARY_MAGIC || version != LIBRARY_FILE_VERSION ||
+      namesOffset != HEADER_SIZE + count * sizeof(Record) || file.size() < namesOffset) {
+    Serial.printf("[%lu] [LIB] Ignoring invalid library index for %s\n", millis(), dirPath.c_str());
+    close();
+    count = 0;
+    return false;
+  }
+  return true;
+}
+
+void LibraryIndex::close() {
+  if (file) {
+    file.close();
+  }
+}
+
+bool LibraryIndex::scanDirectory(std::vector<ScanEntry>* entries, uint16_t* entryCount,
+                                 uint32_t* entriesFingerprint) const {
+  auto root = SdMan.open(dirPath.c_str());
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return false;
+  }
+
+  root.rewindDirectory();
+
+  *entryCount = 0;
+  *entriesFingerprint = 0;
+  char name[500];
+  for (auto file = root.openNextFile(); file && *entryCount < UINT16_MAX; file = root.openNextFile()) {
+    file.getName(name, sizeof(name));
+    if (name[0] == '.' || strcmp(name, "System Volume Information") == 0) {
+      file.close();
+      continue;
+    }
+
+    Format format;
+    if (file.isDirectory()) {
+      format = Format::Directory;
+    } else if (StringUtils::checkFileExtension(name, ".epub")) {
+      format = Format::Epub;
+    } else if (StringUtils::checkFileExtension(name, ".xtch")) {
+      format = Format::Xtch;
+    } else if (StringUtils::checkFileExtension(name, ".xtc")) {
+      format = Format::Xtc;
+    } else {
+      file.close();
+      continue;
+    }
+
+    uint16_t modifyDate = 0;
+    uint16_t modifyTime = 0;
+    file.getModifyDateTime(&modifyDate, &modifyTime);
+    const uint32_t size = format == Format::Directory ? 0 : static_cast<uint32_t>(file.size());
+    file.close();
+
+    // Order-independent, so it can be compared without sorting
+    *entriesFingerprint += fingerprintEntry(hashName(name), size, modifyDate, modifyTime);
+    (*entryCount)++;
+    if (entries) {
+      entries->push_back({name, size, modifyDate, modifyTime, format});
+    }
+  }
+  root.close();
+  return true;
+}
+
+bool LibraryIndex::sync() {
+  uint16_t entryCount;
+  uint32_t entriesFingerprint;
+  if (!scanDirectory(nullptr, &entryCount, &entriesFingerprint)) {
+    return false;
+  }
+  if (file && entryCount == count && entriesFingerprint == fingerprint) {
+    return false;
+  }
+
+  const unsigned long start = millis();
+  std::vector<ScanEntry> entries;
+  entries.reserve(entryCount);
+  if (!scanDirectory(&entries, &entryCount, &entriesFingerprint)) {
+    return false;
+  }
+  if (!rebuild(entries, entriesFingerprint)) {
+    Serial.printf("[%lu] [LIB] Failed to write library index for %s\n", millis(), dirPath.c_str());
+    return false;
+  }
+  Serial.printf("[%lu] [LIB] Indexed %u entries in %s in %lu ms\n", millis(), count, dirPath.c_str(),
+                millis() - start);
+  return true;
+}
+
+bool LibraryIndex::rebuild(std::vector<ScanEntry>& entries, const uint32_t entriesFingerprint) {
+  std::sort(entries.begin(), entries.end(), [](const ScanEntry& entry1, const ScanEntry& entry2) {
+    const bool isDir1 = entry1.format == Format::Directory;
+    const bool isDir2 = entry2.format == Format::Directory;
+    if (isDir1 != isDir2) return isDir1;
+    return lexicographical_compare(
+        begin(entry1.name), end(entry1.name), begin(entry2.name), end(entry2.name),
+        [](const char& char1, const char& char2) { return tolower(char1) < tolower(char2); });
+  });
+
+  // Old records with metadata or progress worth keeping, found again by name, size and modification time
+  std::vector<std::pair<uint32_t, uint16_t>> carryOver;
+  for (size_t i = 0; file && i < count; i++) {
+    Record record;
+    if (!readRecord(i, record)) {
+      break;
+    }
+    if ((record.flags & FLAG_METADATA) || record.progress != NO_PROGRESS) {
+      carryOver.emplace_back(
+          fingerprintEntry(record.nameHash, record.size, record.modifyDate, record.modifyTime), i);
+    }
+  }
+  std::sort(carryOver.begin(), carryOver.end());
+
+  SdMan.mkdir(LIBRARY_DIR);
+  const std::string indexPath = getIndexPath(dirPath);
+  const std::string tmpPath = indexPath + ".tmp";
+  FsFile out;
+  if (!SdMan.openFileForWrite("LIB", tmpPath, out)) {
+    return false;
+  }
+
+  const auto entryCount = static_cast<uint16_t>(entries.size());
+  const uint32_t entriesNamesOffset = HEADER_SIZE + entryCount * sizeof(Record);
+  serialization::writePod(out, LIBRARY_MAGIC);
+  serialization::writePod(out, LIBRARY_FILE_VERSION);
+  serialization::writePod(out, static_cast<uint8_t>(0));
+  serialization::writePod(out, entryCount);
+  serialization::writePod(out, entriesFingerprint);
+  serialization::writePod(out, entriesNamesOffset);
+
+  bool ok = true;
+  uint32_t nameOffset = 0;
+  for (const auto& entry : entries) {
+    Record record = {};
+    record.nameHash = hashName(entry.name);
+    record.nameOffset = nameOffset;
+    record.size = entry.size;
+    record.modifyDate = entry.modifyDate;
+    record.modifyTime = entry.modifyTime;
+    record.nameLength = static_cast<uint16_t>(entry.name.size());
+    record.format = static_cast<uint8_t>(entry.format);
+    record.flags = entry.format == Format::Directory ? FLAG_METADATA : 0;
+    record.progress = NO_PROGRESS;
+
+    const uint32_t key = fingerprintEntry(record.nameHash, record.size, record.modifyDate, record.modifyTime);
+    const auto it = std::lower_bound(carryOver.begin(), carryOver.end(), std::make_pair(key, uint16_t{0}));
+    Record previous;
+    if (it != carryOver.end() && it->first == key && readRecord(it->second, previous) &&
+        previous.nameHash == record.nameHash) {
+      record.flags = previous.flags;
+      record.progress = previous.progress;
+      memcpy(record.title, previous.title, sizeof(record.title));
+      memcpy(record.author, previous.author, sizeof(record.author));
+    }
+
+    ok = ok && out.write(reinterpret_cast<const uint8_t*>(&record), sizeof(record)) == sizeof(record);
+    nameOffset += record.nameLength;
+  }
+  for (const auto& entry : entries) {
+    ok = ok && out.write(reinterpret_cast<const uint8_t*>(entry.name.data()), entry.name.size()) == entry.name.size();
+  }
+
+  close();
+  if (ok) {
+    SdMan.remove(indexPath.c_str());
+    ok = out.rename(indexPath.c_str());
+  }
+  out.close();
+  if (!ok) {
+    SdMan.remove(tmpPath.c_str());
+    count = 0;
+    return false;
+  }
+  return open(dirPath);
+}
+
+bool LibraryIndex::readRecord(const size_t index, Record& record) {
+  return file.seek(HEADER_SIZE + index * sizeof(Record)) &&
+         file.read(&record, sizeof(Record)) == static_cast<int>(sizeof(Record));
+}
+
+bool LibraryIndex::writeRecord(const size_t index, const Record& record) {
+  if (!file.seek(HEADER_SIZE + index * sizeof(Record)) ||
+      file.write(reinterpret_cast<const uint8_t*>(&record), sizeof(Record)) != sizeof(Record)) {
+    return false;
+  }
+  file.flush();
+  return true;
+}
+
+bool LibraryIndex::readName(const Record& record, std::string& name) {
+  name.resize(record.nameLength);
+  if (!file.seek(namesOffset + record.nameOffset) || file.read(&name[0], record.nameLength) != record.nameLength) {
+    return false;
+  }
+  if (record.format == static_cast<uint8_t>(Format::Directory)) {
+    name += '/';
+  }
+  return true;
+}
+
+bool LibraryIndex::readEntry(const size_t index, Entry& entry) {
+  Record record;
+  if (index >= count || !readRecord(index, record) || !readName(record, entry.name)) {
+    return false;
+  }
+  entry.format = static_cast<Format>(record.format);
+  entry.size = record.size;
+  entry.progress = record.progress;
+  entry.hasMetadata = record.flags & FLAG_METADATA;
+  entry.title.assign(record.title, strnlen(record.title, sizeof(record.title)));
+  entry.author.assign(record.author, strnlen(record.author, sizeof(record.author)));
+  return true;
+}
+
+bool LibraryIndex::readPage(const size_t first, const size_t pageSize, std::vector<Entry>& entries) {
+  entries.clear();
+  for (size_t i = first; i < count && i < first + pageSize; i++) {
+    entries.emplace_back();
+    if (!readEntry(i, entries.back())) {
+      entries.pop_back();
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t LibraryIndex::findEntry(const std::string& name) {
+  const bool isDirectory = !name.empty() && name.back() == '/';
+  const uint32_t nameHash = hashName(isDirectory ? name.substr(0, name.size() - 1) : name);
+  for (size_t i = 0; i < count; i++) {
+    Record record;
+    if (!readRecord(i, record)) {
+      break;
+    }
+    std::string recordName;
+    if (record.nameHash == nameHash && readName(record, recordName) && recordName == name) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+int LibraryIndex::updateNextMetadata() {
+  for (; metadataCursor < count; metadataCursor++) {
+    Record record;
+    if (!readRecord(metadataCursor, record)) {
+      return -1;
+    }
+    if (record.flags & FLAG_METADATA) {
+      continue;
+    }
+
+    std::string name;
+    if (!readName(record, name)) {
+      return -1;
+    }
+    const std::string bookPath = joinPath(dirPath, name);
+    if (record.format == static_cast<uint8_t>(Format::Epub)) {
+      // Only read an existing book.bin, building one takes seconds and holds up rendering and input. A book without
+      // one is left unmarked and tried again on a later visit, once it was opened or prepared by the IndexQueue.
+      Epub epub(bookPath, "/.crosspoint");
+      if (!epub.load(false)) {
+        metadataCursor++;
+        return METADATA_SKIPPED;
+      }
+      StringUtils::copyTruncated(record.title, sizeof(record.title), epub.getTitle());
+      StringUtils::copyTruncated(record.author, sizeof(record.author), epub.getAuthor());
+    } else {
+      Xtc xtc(bookPath, "/.crosspoint");
+      if (xtc.load()) {
+        StringUtils::copyTruncated(record.title, sizeof(record.title), xtc.getTitle());
+      }
+    }
+
+    // Marked even if the book could not be read, so it is not retried on every visit
+    record.flags |= FLAG_METADATA;
+    writeRecord(metadataCursor, record);
+    return static_cast<int>(metadataCursor++);
+  }
+  return -1;
+}
+
+void LibraryIndex::recordProgress(const std::string& bookPath, const uint8_t progress) {
+  const auto lastSlash = bookPath.find_last_of('/');
+  if (lastSlash == std::string::npos) {
+    return;
+  }
+
+  LibraryIndex index;
+  if (!index.open(lastSlash == 0 ? "/" : bookPath.substr(0, lastSlash))) {
+    return;
+  }
+
+  const size_t position = index.findEntry(bookPath.substr(lastSlash + 1));
+  Record record;
+  std::string name;
+  if (index.readRecord(position, record) && index.readName(record, name) && name == bookPath.substr(lastSlash + 1) &&
+      record.progress != progress) {
+    record.progress = progress;
+    index.writeRecord(position, record);
+  }
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * On-disk index of one library directory, stored in /.crosspoint/library/dir_<hash>.bin.
+ *
+ * The file holds a header, one fixed-size record per entry in display order (folders first, then case-insensitive
+ * by name) and a section with the entry names. Opening a directory only reads the header, and a page of entries is
+ * read with a single seek, so showing the picker does not depend on library size.
+ *
+ * sync() re-enumerates the directory and compares it against a fingerprint of the stored names, sizes and
+ * modification times; the entries are only collected, sorted and rewritten when something changed. Title and
+ * author are filled in afterwards, one book at a time, and survive rebuilds as long as the file is unchanged.
+ */
+class LibraryIndex {
+ public:
+  enum class Format : uint8_t { Directory, Epub, Xtc, Xtch };
+
+  static constexpr uint8_t NO_PROGRESS = 0xFF;
+
+  struct Entry {
+    std::string name;  // Directories end with '/'
+    Format format;
+    uint32_t size;
+    uint8_t progress;  // Last-read position in percent, NO_PROGRESS if never opened
+    bool hasMetadata;
+    std::string title;
+    std::string author;
+  };
+
+  LibraryIndex() = default;
+  ~LibraryIndex() { close(); }
+
+  LibraryIndex(const LibraryIndex&) = delete;
+  LibraryIndex& operator=(const LibraryIndex&) = delete;
+
+  // Opens the stored index for the directory, returns false if there is none yet (call sync() to build it)
+  bool open(const std::string& dirPath);
+  void close();
+  // Brings the index in line with the directory, returns true if the entries changed
+  bool sync();
+
+  size_t getCount() const { return count; }
+  bool readPage(size_t first, size_t pageSize, std::vector<Entry>& entries);
+  bool readEntry(size_t index, Entry& entry);
+  // Position of the entry with this name (as returned in Entry::name), or 0 if there is none
+  size_t findEntry(const std::string& name);
+
+  // Reads title and author of the next book that lacks them, returns its position, METADATA_SKIPPED if the book has
+  // no metadata cache to read them from yet, or -1 once all are done
+  static constexpr int METADATA_SKIPPED = -2;
+  int updateNextMetadata();
+
+  // Stores the last-read position of a book in the index of its directory, if that index exists
+  static void recordProgress(const std::string& bookPath, uint8_t progress);
+
+ private:
+  static constexpr int TITLE_LENGTH = 64;
+  static constexpr int AUTHOR_LENGTH = 40;
+  static constexpr uint8_t FLAG_METADATA = 1;
+
+  struct Record {
+    uint32_t nameHash;
+    uint32_t nameOffset;  // Relative to the names section
+    uint32_t size;
+    uint16_t modifyDate;  // FAT date and time
+    uint16_t modifyTime;
+    uint16_t nameLength;
+    uint8_t format;
+    uint8_t flags;
+    uint8_t progress;
+    uint8_t reserved[3];
+    char title[TITLE_LENGTH];  // NUL-padded, truncated on a character boundary
+    char author[AUTHOR_LENGTH];
+  };
+
+  struct ScanEntry {
+    std::string name;
+    uint32_t size;
+    uint16_t modifyDate;
+    uint16_t modifyTime;
+    Format format;
+  };
+
+  static std::string getIndexPath(const std::string& dirPath);
+  static uint32_t hashName(const std::string& name);
+  static uint32_t fingerprintEntry(uint32_t nameHash, uint32_t size, uint16_t modifyDate, uint16_t modifyTime);
+  bool readRecord(size_t index, Record& record);
+  bool writeRecord(size_t index, const Record& record);
+  bool readName(const Record& record, std::string& name);
+  // Enumerates the directory; entries are only collected when `entries` is given
+  bool scanDirectory(std::vector<ScanEntry>* entries, uint16_t* entryCount, uint32_t* entriesFingerprint) const;
+  bool rebuild(std::vector<ScanEntry>& entries, uint32_t entriesFingerprint);
+
+  std::string dirPath;
+  FsFile file;
+  uint16_t count = 0;
+  uint32_t fingerprint = 0;
+  uint32_t namesOffset = 0;
+  size_t metadataCursor = 0;
+};
@@ -0,0 +1,137 @@
+#include "ProgressJournal.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <miniz.h>
+
+#include <cstddef>
+
+uint32_t ProgressJournal::getCrc(const Record& record) {
+  return static_cast<uint32_t>(
+      mz_crc32(MZ_CRC32_INIT, reinterpret_cast<const unsigned char*>(&record), offsetof(Record, crc)));
+}
+
+bool ProgressJournal::open(const std::string& journalPath, uint16_t* spineIndex, uint32_t* page) {
+  path = journalPath;
+  nextSequence = 1;
+  recordCount = 0;
+  needsCompaction = false;
+  pending = false;
+
+  // A compaction that was interrupted after removing the log leaves only the new copy
+  const std::string tmpPath = path + ".tmp";
+  if (!SdMan.exists(path.c_str()) && SdMan.exists(tmpPath.c_str())) {
+    FsFile tmp = SdMan.open(tmpPath.c_str(), O_RDWR);
+    if (tmp) {
+      tmp.rename(path.c_str());
+      tmp.close();
+    }
+  }
+
+  FsFile file;
+  if (!SdMan.exists(path.c_str()) || !SdMan.openFileForRead("PRJ", path, file)) {
+    return false;
+  }
+
+  const size_t size = file.size();
+  needsCompaction = size % sizeof(Record) != 0;
+  recordCount = size / sizeof(Record);
+
+  bool found = false;
+  uint32_t newestSequence = 0;
+  Record record;
+  for (uint32_t i = 0; i < recordCount; i++) {
+    if (file.read(&record, sizeof(Record)) != sizeof(Record)) {
+      break;
+    }
+    if (record.crc != getCrc(record) || (found && record.sequence <= newestSequence)) {
+      continue;
+    }
+    found = true;
+    newestSequence = record.sequence;
+    *spineIndex = record.spineIndex;
+    *page = record.page;
+  }
+  file.close();
+
+  nextSequence = newestSequence + 1;
+  if (!found) {
+    Serial.printf("[%lu] [PRJ] No valid progress record in %s\n", millis(), path.c_str());
+  }
+  return found;
+}
+
+void ProgressJournal::update(const uint16_t spineIndex, const uint32_t page) {
+  if (pending && spineIndex == pendingSpineIndex && page == pendingPage) {
+    return;
+  }
+  pending = true;
+  pendingSpineIndex = spineIndex;
+  pendingPage = page;
+  updateTime = millis();
+}
+
+bool ProgressJournal::isFlushDue() const { return pending && millis() - updateTime >= FLUSH_DELAY_MS; }
+
+bool ProgressJournal::flush() {
+  if (!pending || path.empty()) {
+    return false;
+  }
+
+  Record record = {};
+  record.sequence = nextSequence;
+  record.spineIndex = pendingSpineIndex;
+  record.page = pendingPage;
+  record.crc = getCrc(record);
+
+  bool ok;
+  if (needsCompaction || recordCount >= COMPACT_RECORDS) {
+    ok = compact(record);
+  } else {
+    FsFile file = SdMan.open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND);
+    ok = file && file.write(reinterpret_cast<const uint8_t*>(&record), sizeof(Record)) == sizeof(Record);
+    if (file) {
+      file.close();
+    }
+    if (ok) {
+      recordCount++;
+    } else {
+      // Whatever part of the record made it to the card has to be cleaned up before appending again
+      needsCompaction = true;
+    }
+  }
+
+  if (!ok) {
+    Serial.printf("[%lu] [PRJ] Failed to write progress to %s\n", millis(), path.c_str());
+    return false;
+  }
+  nextSequence++;
+  pending = false;
+  return true;
+}
+
+// Replaces the log with a single record, written to a temporary file first so there always is a valid copy
+bool ProgressJournal::compact(const Record& record) {
+  const std::string tmpPath = path + ".tmp";
+  FsFile file;
+  if (!SdMan.openFileForWrite("PRJ", tmpPath, file)) {
+    return false;
+  }
+  if (file.write(reinterpret_cast<const uint8_t*>(&record), sizeof(Record)) != sizeof(Record)) {
+    file.close();
+    SdMan.remove(tmpPath.c_str());
+    return false;
+  }
+  file.flush();
+
+  SdMan.remove(path.c_str());
+  const bool renamed = file.rename(path.c_str());
+  file.close();
+  if (!renamed) {
+    return false;
+  }
+
+  recordCount = 1;
+  needsCompaction = false;
+  return true;
+}
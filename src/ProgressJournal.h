@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * Append-only log of a book's reading position (progress.log in the book's cache directory).
+ *
+ * Every record is fixed-size and carries a sequence number and a CRC, so a record torn by power loss is simply
+ * skipped and the newest intact one wins. Page turns only update the pending position; it is appended once the
+ * reader has settled (isFlushDue) or leaves the book, instead of rewriting a file on every page. Once the log
+ * reaches COMPACT_RECORDS it is replaced by a file holding just the latest record.
+ */
+class ProgressJournal {
+ public:
+  static constexpr unsigned long FLUSH_DELAY_MS = 3000;
+  static constexpr uint32_t COMPACT_RECORDS = 64;
+
+  // Reads the newest valid record, returns false if there is none
+  bool open(const std::string& journalPath, uint16_t* spineIndex, uint32_t* page);
+  void update(uint16_t spineIndex, uint32_t page);
+  bool isFlushDue() const;
+  bool hasPending() const { return pending; }
+  bool flush();
+
+ private:
+  struct Record {
+    uint32_t sequence;
+    uint16_t spineIndex;
+    uint16_t reserved;
+    uint32_t page;
+    uint32_t crc;  // Over the fields above
+  };
+
+  static uint32_t getCrc(const Record& record);
+  bool compact(const Record& record);
+
+  std::string path;
+  uint32_t nextSequence = 1;
+  uint32_t recordCount = 0;
+  bool needsCompaction = false;  // Log ends in a torn record, appending would misalign everything after it
+  bool pending = false;
+  uint16_t pendingSpineIndex = 0;
+  uint32_t pendingPage = 0;
+  unsigned long updateTime = 0;
+};
@@ -0,0 +1,104 @@
+#include "ResumeSnapshot.h"
+
+#include <GfxRenderer.h>
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+
+namespace {
+constexpr char SNAPSHOT_FILE[] = "/.crosspoint/resume.bin";
+constexpr uint32_t SNAPSHOT_MAGIC = 0x4D535243;  // "CRSM"
+constexpr uint8_t SNAPSHOT_FILE_VERSION = 1;
+
+bool getBookSize(const std::string& bookPath, uint32_t* size) {
+  FsFile book;
+  if (!SdMan.openFileForRead("RSM", bookPath, book)) {
+    return false;
+  }
+  *size = static_cast<uint32_t>(book.size());
+  book.close();
+  return true;
+}
+}  // namespace
+
+std::string ResumeSnapshot::restoredBookPath;
+
+bool ResumeSnapshot::save(const GfxRenderer& renderer, const std::string& bookPath) {
+  const unsigned long start = millis();
+  uint32_t bookSize;
+  if (!getBookSize(bookPath, &bookSize)) {
+    clear();
+    return false;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForWrite("RSM", SNAPSHOT_FILE, file)) {
+    return false;
+  }
+
+  serialization::writePod(file, SNAPSHOT_MAGIC);
+  serialization::writePod(file, SNAPSHOT_FILE_VERSION);
+  serialization::writeString(file, bookPath);
+  serialization::writePod(file, bookSize);
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  const bool ok = file.write(renderer.getFrameBuffer(), bufferSize) == bufferSize;
+  file.close();
+
+  if (!ok) {
+    Serial.printf("[%lu] [RSM] Failed to write resume snapshot\n", millis());
+    clear();
+    return false;
+  }
+  Serial.printf("[%lu] [RSM] Saved resume snapshot in %lu ms\n", millis(), millis() - start);
+  return true;
+}
+
+void ResumeSnapshot::clear() {
+  if (SdMan.exists(SNAPSHOT_FILE)) {
+    SdMan.remove(SNAPSHOT_FILE);
+  }
+}
+
+bool ResumeSnapshot::restore(const GfxRenderer& renderer, const std::string& bookPath) {
+  FsFile file;
+  if (!SdMan.exists(SNAPSHOT_FILE) || !SdMan.openFileForRead("RSM", SNAPSHOT_FILE, file)) {
+    return false;
+  }
+
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  std::string snapshotBookPath;
+  uint32_t snapshotBookSize = 0;
+  serialization::readPod(file, magic);
+  serialization::readPod(file, version);
+  bool ok = magic == SNAPSHOT_MAGIC && version == SNAPSHOT_FILE_VERSION;
+  if (ok) {
+    serialization::readString(file, snapshotBookPath);
+    serialization::readPod(file, snapshotBookSize);
+    uint32_t bookSize;
+    ok = snapshotBookPath == bookPath && getBookSize(bookPath, &bookSize) && bookSize == snapshotBookSize;
+  }
+
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  // Read straight into the frame buffer, it is redrawn either way
+  ok = ok && file.read(renderer.getFrameBuffer(), bufferSize) == static_cast<int>(bufferSize);
+  file.close();
+  // Only valid until the reader moves on
+  SdMan.remove(SNAPSHOT_FILE);
+
+  if (!ok) {
+    Serial.printf("[%lu] [RSM] No usable resume snapshot for %s\n", millis(), bookPath.c_str());
+    return false;
+  }
+
+  renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
+  restoredBookPath = bookPath;
+  Serial.printf("[%lu] [RSM] Resume page shown %lu ms after boot\n", millis(), millis());
+  return true;
+}
+
+bool ResumeSnapshot::takeRestored(const std::string& bookPath) {
+  const bool wasRestored = !restoredBookPath.empty() && restoredBookPath == bookPath;
+  restoredBookPath.clear();
+  return wasRestored;
+}
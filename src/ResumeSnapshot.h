@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+
+class GfxRenderer;
+
+/**
+ * Copy of the last displayed reader page, stored in /.crosspoint/resume.bin when the device goes to sleep.
+ *
+ * On wake the frame buffer is streamed straight back to the panel, so the page is visible before the book has been
+ * opened, parsed and laid out again. The snapshot only holds the black and white plane (the grayscale planes live in
+ * the display controller), so the reader's own first render follows with a fast refresh to add anti-aliasing.
+ * A snapshot is used at most once and is dropped if the book changed on disk.
+ */
+class ResumeSnapshot {
+  static std::string restoredBookPath;
+
+ public:
+  static bool save(const GfxRenderer& renderer, const std::string& bookPath);
+  static void clear();
+  // Shows the snapshot if it belongs to this book, returns false if there is none
+  static bool restore(const GfxRenderer& renderer, const std::string& bookPath);
+  // True once after this book's snapshot was shown, so the reader can skip the full refresh of its first page
+  static bool takeRestored(const std::string& bookPath);
+};
@@ -0,0 +1,292 @@
+#include "ThumbnailStore.h"
+
+#include <Bitmap.h>
+#include <Epub.h>
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <Xtc.h>
+
+#include <cstring>
+
+#include "util/StringUtils.h"
+
+namespace {
+constexpr char THUMBS_FILE[] = "/.crosspoint/thumbs.bin";
+constexpr uint32_t THUMBS_MAGIC = 0x42485443;  // "CTHB"
+constexpr uint8_t THUMBS_FILE_VERSION = 2;
+// magic, version, padding, tile width, tile height, tile count, entry count
+constexpr uint32_t HEADER_SIZE = 4 + 1 + 1 + 2 + 2 + 2 + 2;
+constexpr uint32_t TILE_COUNT_OFFSET = HEADER_SIZE - 4;
+constexpr uint16_t NO_TILE = 0xFFFF;
+}  // namespace
+
+bool ThumbnailStore::open() {
+  SdMan.mkdir("/.crosspoint");
+  file = SdMan.open(THUMBS_FILE, O_RDWR | O_CREAT);
+  if (!file) {
+    Serial.printf("[%lu] [THS] Failed to open %s\n", millis(), THUMBS_FILE);
+    return false;
+  }
+
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  uint8_t padding = 0;
+  uint16_t tileWidth = 0;
+  uint16_t tileHeight = 0;
+  if (file.size() >= HEADER_SIZE) {
+    serialization::readPod(file, magic);
+    serialization::readPod(file, version);
+    serialization::readPod(file, padding);
+    serialization::readPod(file, tileWidth);
+    serialization::readPod(file, tileHeight);
+    serialization::readPod(file, tileCount);
+    serialization::readPod(file, entryCount);
+  }
+
+  if (magic != THUMBS_MAGIC || version != THUMBS_FILE_VERSION || tileWidth != TILE_WIDTH ||
+      tileHeight != TILE_HEIGHT || entryCount > MAX_ENTRIES || tileCount > entryCount) {
+    Serial.printf("[%lu] [THS] Creating new thumbnail store\n", millis());
+    return reset();
+  }
+
+  Serial.printf("[%lu] [THS] Opened thumbnail store with %u tiles for %u books\n", millis(), tileCount, entryCount);
+  return true;
+}
+
+void ThumbnailStore::close() {
+  if (file) {
+    file.close();
+  }
+}
+
+bool ThumbnailStore::reset() {
+  tileCount = 0;
+  entryCount = 0;
+  if (!file.seek(0) || !file.truncate(0)) {
+    return false;
+  }
+
+  serialization::writePod(file, THUMBS_MAGIC);
+  serialization::writePod(file, THUMBS_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(0));
+  serialization::writePod(file, static_cast<uint16_t>(TILE_WIDTH));
+  serialization::writePod(file, static_cast<uint16_t>(TILE_HEIGHT));
+  serialization::writePod(file, tileCount);
+  serialization::writePod(file, entryCount);
+
+  // Empty index
+  uint8_t zeros[512] = {};
+  for (size_t remaining = INDEX_SLOTS * sizeof(IndexEntry); remaining > 0;) {
+    const size_t chunk = remaining < sizeof(zeros) ? remaining : sizeof(zeros);
+    if (file.write(zeros, chunk) != chunk) {
+      Serial.printf("[%lu] [THS] Failed to write thumbnail index\n", millis());
+      return false;
+    }
+    remaining -= chunk;
+  }
+  file.flush();
+  return true;
+}
+
+uint32_t ThumbnailStore::hashPath(const std::string& bookPath) {
+  // FNV-1a, with 0 reserved for empty slots
+  uint32_t hash = 2166136261u;
+  for (const char c : bookPath) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash ? hash : 1;
+}
+
+bool ThumbnailStore::getFileSize(const std::string& bookPath, uint32_t* size) {
+  FsFile book;
+  if (!SdMan.openFileForRead("THS", bookPath, book)) {
+    return false;
+  }
+  *size = static_cast<uint32_t>(book.size());
+  book.close();
+  return true;
+}
+
+bool ThumbnailStore::findSlot(const uint32_t pathHash, const uint32_t fileSize, int* slot, IndexEntry* entry) {
+  for (int probe = 0; probe < INDEX_SLOTS; probe++) {
+    const int candidate = static_cast<int>((pathHash + probe) % INDEX_SLOTS);
+    if (!file.seek(HEADER_SIZE + candidate * sizeof(IndexEntry)) ||
+        file.read(entry, sizeof(IndexEntry)) != sizeof(IndexEntry)) {
+      break;
+    }
+    if (entry->pathHash == 0 || (entry->pathHash == pathHash && entry->fileSize == fileSize)) {
+      *slot = candidate;
+      return entry->pathHash != 0;
+    }
+  }
+  *slot = -1;
+  return false;
+}
+
+bool ThumbnailStore::writeEntry(const int slot, const IndexEntry& entry) {
+  if (!file.seek(HEADER_SIZE + slot * sizeof(IndexEntry)) ||
+      file.write(reinterpret_cast<const uint8_t*>(&entry), sizeof(entry)) != sizeof(entry)) {
+    return false;
+  }
+  file.flush();
+  return true;
+}
+
+uint32_t ThumbnailStore::getTileOffset(const uint16_t tile) {
+  return HEADER_SIZE + INDEX_SLOTS * sizeof(IndexEntry) + tile * TILE_SIZE;
+}
+
+bool ThumbnailStore::readTile(const uint16_t tile, uint8_t* data) {
+  return file.seek(getTileOffset(tile)) && file.read(data, TILE_SIZE) == static_cast<int>(TILE_SIZE);
+}
+
+ThumbnailStore::Lookup ThumbnailStore::find(const std::string& bookPath, uint8_t* tile) {
+  uint32_t fileSize;
+  if (!file || !getFileSize(bookPath, &fileSize)) {
+    return Lookup::Missing;
+  }
+
+  int slot;
+  IndexEntry entry;
+  if (!findSlot(hashPath(bookPath), fileSize, &slot, &entry)) {
+    return Lookup::Missing;
+  }
+  if (entry.state != static_cast<uint8_t>(Lookup::Found)) {
+    return Lookup::NoCover;
+  }
+  return readTile(entry.tile, tile) ? Lookup::Found : Lookup::Missing;
+}
+
+ThumbnailStore::Lookup ThumbnailStore::generate(const std::string& bookPath, uint8_t* tile) {
+  uint32_t fileSize;
+  if (!file || !getFileSize(bookPath, &fileSize)) {
+    return Lookup::Missing;
+  }
+
+  const unsigned long start = millis();
+  bool generated = false;
+  std::string thumbPath;
+  if (StringUtils::checkFileExtension(bookPath, ".epub")) {
+    // Building the spine/TOC cache takes seconds, which browsing should not pay for
+    Epub epub(bookPath, "/.crosspoint");
+    if (!epub.load(false)) {
+      return Lookup::Missing;
+    }
+    thumbPath = epub.getThumbBmpPath();
+    generated = epub.generateThumbBmp(TILE_WIDTH, TILE_HEIGHT);
+  } else if (StringUtils::checkFileExtension(bookPath, ".xtc") ||
+             StringUtils::checkFileExtension(bookPath, ".xtch")) {
+    Xtc xtc(bookPath, "/.crosspoint");
+    if (xtc.load()) {
+      thumbPath = xtc.getThumbBmpPath();
+      generated = xtc.generateThumbBmp(TILE_WIDTH, TILE_HEIGHT);
+    }
+  }
+
+  const bool packed = generated && packTile(thumbPath, tile);
+  if (generated) {
+    SdMan.remove(thumbPath.c_str());
+  }
+
+  const uint32_t pathHash = hashPath(bookPath);
+  int slot;
+  IndexEntry entry;
+  const bool replacing = findSlot(pathHash, fileSize, &slot, &entry);
+  // A replaced entry keeps its tile, so there are never more tiles than entries
+  const uint16_t oldTile = replacing && entry.state == static_cast<uint8_t>(Lookup::Found) ? entry.tile : NO_TILE;
+  if (!replacing && entryCount >= MAX_ENTRIES) {
+    if (!reset()) {
+      return Lookup::Missing;
+    }
+    findSlot(pathHash, fileSize, &slot, &entry);
+  }
+  if (slot < 0) {
+    return Lookup::Missing;
+  }
+
+  entry = {pathHash, fileSize, NO_TILE, static_cast<uint8_t>(Lookup::NoCover), 0};
+  if (packed) {
+    const uint16_t tileIndex = oldTile != NO_TILE ? oldTile : tileCount;
+    if (!file.seek(getTileOffset(tileIndex)) || file.write(tile, TILE_SIZE) != TILE_SIZE) {
+      Serial.printf("[%lu] [THS] Failed to write thumbnail tile\n", millis());
+      return Lookup::Missing;
+    }
+    if (tileIndex == tileCount) {
+      tileCount++;
+    }
+    entry.tile = tileIndex;
+    entry.state = static_cast<uint8_t>(Lookup::Found);
+  }
+  if (!replacing) {
+    entryCount++;
+  }
+  file.seek(TILE_COUNT_OFFSET);
+  serialization::writePod(file, tileCount);
+  serialization::writePod(file, entryCount);
+  if (!writeEntry(slot, entry)) {
+    Serial.printf("[%lu] [THS] Failed to write thumbnail index entry\n", millis());
+    return Lookup::Missing;
+  }
+
+  Serial.printf("[%lu] [THS] %s thumbnail for %s in %lu ms\n", millis(), packed ? "Generated" : "No", bookPath.c_str(),
+                millis() - start);
+  return packed ? Lookup::Found : Lookup::NoCover;
+}
+
+// Centers the thumbnail BMP on a white tile, cropping whatever overflows it
+bool ThumbnailStore::packTile(const std::string& bmpPath, uint8_t* tile) {
+  FsFile bmpFile;
+  if (!SdMan.openFileForRead("THS", bmpPath, bmpFile)) {
+    return false;
+  }
+
+  Bitmap bitmap(bmpFile);
+  if (bitmap.parseHeaders() != BmpReaderError::Ok) {
+    bmpFile.close();
+    return false;
+  }
+
+  const int width = bitmap.getWidth();
+  const int height = bitmap.getHeight();
+  auto* outputRow = static_cast<uint8_t*>(malloc((width + 3) / 4));
+  auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
+  if (!outputRow || !rowBytes) {
+    free(outputRow);
+    free(rowBytes);
+    bmpFile.close();
+    return false;
+  }
+
+  memset(tile, 0xFF, TILE_SIZE);
+  const int offsetX = (width - TILE_WIDTH) / 2;  // Source x of the tile's first column (negative: pad)
+  const int offsetY = (height - TILE_HEIGHT) / 2;
+  bool ok = true;
+  for (int row = 0; row < height; row++) {
+    if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
+      ok = false;
+      break;
+    }
+
+    const int tileY = (bitmap.isTopDown() ? row : height - 1 - row) - offsetY;
+    if (tileY < 0 || tileY >= TILE_HEIGHT) {
+      continue;
+    }
+
+    uint8_t* dst = tile + tileY * TILE_ROW_BYTES;
+    for (int tileX = 0; tileX < TILE_WIDTH; tileX++) {
+      const int srcX = tileX + offsetX;
+      if (srcX < 0 || srcX >= width) {
+        continue;
+      }
+      const uint8_t val = (outputRow[srcX / 4] >> (6 - (srcX % 4) * 2)) & 0x3;
+      const int shift = 6 - (tileX % 4) * 2;
+      dst[tileX / 4] = (dst[tileX / 4] & ~(0x3 << shift)) | (val << shift);
+    }
+  }
+
+  free(outputRow);
+  free(rowBytes);
+  bmpFile.close();
+  return ok;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Cover thumbnails for the library grid, packed into a single file on the SD card (/.crosspoint/thumbs.bin).
+ *
+ * The file holds a header, a fixed-size open-addressing hash index keyed by book path and file size, and then
+ * fixed-size 2bpp tiles. Lookups probe the index on disk, so RAM use does not grow with the library: drawing a
+ * thumbnail needs a single tile buffer. Books without a usable cover are recorded as well, so they are not retried
+ * on every visit. Once three quarters of the index slots are taken the store starts over, which drops every tile.
+ * Tiles are only ever reached through the index, so no tile number outlives that.
+ */
+class ThumbnailStore {
+ public:
+  static constexpr int TILE_WIDTH = 120;
+  static constexpr int TILE_HEIGHT = 180;
+  static constexpr int TILE_ROW_BYTES = (TILE_WIDTH + 3) / 4;
+  static constexpr size_t TILE_SIZE = TILE_ROW_BYTES * TILE_HEIGHT;
+
+  enum class Lookup : uint8_t { Missing, Found, NoCover };
+
+  ThumbnailStore() = default;
+  ~ThumbnailStore() { close(); }
+
+  ThumbnailStore(const ThumbnailStore&) = delete;
+  ThumbnailStore& operator=(const ThumbnailStore&) = delete;
+
+  bool open();
+  void close();
+
+  // Reads the book's tile into `tile` (TILE_SIZE bytes) if there is one
+  Lookup find(const std::string& bookPath, uint8_t* tile);
+  // Renders the book's cover into a tile, stores it and leaves it in `tile`. Returns NoCover if the book has no usable
+  // cover, and Missing without recording anything if it is an EPUB whose spine/TOC cache is not built yet.
+  Lookup generate(const std::string& bookPath, uint8_t* tile);
+
+ private:
+  struct IndexEntry {
+    uint32_t pathHash;  // 0 marks an empty slot
+    uint32_t fileSize;
+    uint16_t tile;
+    uint8_t state;  // Lookup::Found or Lookup::NoCover
+    uint8_t reserved;
+  };
+
+  static constexpr int INDEX_SLOTS = 2048;
+  static constexpr int MAX_ENTRIES = INDEX_SLOTS * 3 / 4;  // Keep probe sequences short
+
+  static uint32_t hashPath(const std::string& bookPath);
+  static bool getFileSize(const std::string& bookPath, uint32_t* size);
+  // Empties the index and drops all tiles
+  bool reset();
+  // Probes for the book's slot: returns true and fills `entry` if found, otherwise `slot` is the free slot to use
+  bool findSlot(uint32_t pathHash, uint32_t fileSize, int* slot, IndexEntry* entry);
+  bool writeEntry(int slot, const IndexEntry& entry);
+  static uint32_t getTileOffset(uint16_t tile);
+  bool readTile(uint16_t tile, uint8_t* data);
+  static bool packTile(const std::string& bmpPath, uint8_t* tile);
+
+  FsFile file;
+  uint16_t tileCount = 0;
+  uint16_t entryCount = 0;  // Occupied index slots, with or without a tile
+};
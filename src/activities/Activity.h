@@ -23,4 +23,6 @@ class Activity {
   virtual void loop() {}
   virtual bool skipLoopDelay() { return false; }
   virtual bool preventAutoSleep() { return false; }
+  // Whether the screen shows a book page that can be put back on the next boot
+  virtual bool canSnapshotScreen() const { return false; }
 };
@@ -14,4 +14,5 @@ class ActivityWithSubactivity : public Activity {
       : Activity(std::move(name), renderer, mappedInput) {}
   void loop() override;
   void onExit() override;
+  bool canSnapshotScreen() const override { return subActivity && subActivity->canSnapshotScreen(); }
 };
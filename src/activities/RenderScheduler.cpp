@@ -0,0 +1,82 @@
+#include "RenderScheduler.h"
+
+#include <Metrics.h>
+
+void RenderScheduler::taskTrampoline(void* param) {
+  auto* self = static_cast<RenderScheduler*>(param);
+  self->taskLoop();
+}
+
+void RenderScheduler::start(const char* name, const uint32_t stackSize, std::function<void()> renderFn,
+                            std::function<bool()> idleWorkFn) {
+  taskName = name;
+  render = std::move(renderFn);
+  idleWork = std::move(idleWorkFn);
+  stopping = false;
+  mutex = xSemaphoreCreateMutex();
+
+  xTaskCreate(&RenderScheduler::taskTrampoline, taskName,
+              stackSize,   // Stack size
+              this,        // Parameters
+              1,           // Priority
+              &taskHandle  // Task handle
+  );
+}
+
+void RenderScheduler::stop() {
+  if (!mutex) {
+    return;
+  }
+
+  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD. Idle work in progress sees
+  // the flag and returns early.
+  stopping = true;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  if (taskHandle) {
+    vTaskDelete(taskHandle);
+    taskHandle = nullptr;
+  }
+  vSemaphoreDelete(mutex);
+  mutex = nullptr;
+}
+
+void RenderScheduler::requestUpdate() {
+  if (!updatePending.exchange(true)) {
+    requestTime = millis();
+  }
+  // Before start() the flag alone is enough, the task checks it before it first waits
+  if (taskHandle) {
+    xTaskNotifyGive(taskHandle);
+  }
+}
+
+void RenderScheduler::lock() const {
+  // Counted while waiting, so idle work holding the mutex knows to give it up
+  ++lockWaiters;
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  --lockWaiters;
+}
+
+void RenderScheduler::unlock() const { xSemaphoreGive(mutex); }
+
+void RenderScheduler::taskLoop() {
+  bool idleWorkLeft = static_cast<bool>(idleWork);
+  while (true) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (updatePending.exchange(false)) {
+      const unsigned long requestedAt = requestTime;
+      render();
+      metrics::record(metrics::Timer::RenderLatency, millis() - requestedAt);
+      // A render can leave background work behind (e.g. thumbnails it could not draw yet)
+      idleWorkLeft = static_cast<bool>(idleWork);
+    } else if (idleWorkLeft) {
+      idleWorkLeft = idleWork();
+    }
+    xSemaphoreGive(mutex);
+
+    if (!updatePending) {
+      // With background work left, only yield for a tick so input is still handled between steps
+      ulTaskNotifyTake(pdTRUE, idleWorkLeft ? 1 : portMAX_DELAY);
+    }
+  }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+/**
+ * Display task shared by the activities: owns the task and the rendering mutex and renders on request.
+ *
+ * requestUpdate() sets a flag and notifies the task, which sleeps on the notification with no timeout, so an idle
+ * screen costs no CPU and a request is picked up immediately. Requests arriving before the task gets to them
+ * collapse into one render. An optional idle callback runs one step of background work at a time between renders.
+ * A step can take long (indexing a book), so it is expected to poll shouldYield() and return early when it is set.
+ *
+ * The time from the first request to the end of the render is recorded as metrics::Timer::RenderLatency.
+ */
+class RenderScheduler {
+ public:
+  RenderScheduler() = default;
+  ~RenderScheduler() { stop(); }
+
+  RenderScheduler(const RenderScheduler&) = delete;
+  RenderScheduler& operator=(const RenderScheduler&) = delete;
+
+  // Creates the mutex and the task. `render` runs with the mutex held; `idleWork`, if given, runs the same way
+  // whenever nothing needs rendering and returns whether more work is left.
+  void start(const char* taskName, uint32_t stackSize, std::function<void()> render,
+             std::function<bool()> idleWork = nullptr);
+  // Waits for a render in progress to finish, then deletes the task and the mutex
+  void stop();
+
+  // Safe to call from any task, including the display task itself
+  void requestUpdate();
+  // Keeps the task from rendering while the caller draws or uses the SD card
+  void lock() const;
+  void unlock() const;
+  // Whether idle work should stop early: a render is wanted, another task waits in lock(), or stop() was called
+  bool shouldYield() const { return updatePending || lockWaiters > 0 || stopping; }
+
+ private:
+  static void taskTrampoline(void* param);
+  [[noreturn]] void taskLoop();
+
+  const char* taskName = "";
+  TaskHandle_t taskHandle = nullptr;
+  SemaphoreHandle_t mutex = nullptr;
+  std::function<void()> render;
+  std::function<bool()> idleWork;
+  std::atomic<bool> updatePending{false};
+  std::atomic<bool> stopping{false};
+  mutable std::atomic<int> lockWaiters{0};
+  std::atomic<unsigned long> requestTime{0};
+};
@@ -4,7 +4,10 @@
 #include <HardwareSerial.h>
 #include <WiFi.h>
 
+#include <algorithm>
+
 #include "CrossPointSettings.h"
+#include "IndexQueue.h"
 #include "MappedInputManager.h"
 #include "ScreenComponents.h"
 #include "activities/network/WifiSelectionActivity.h"
@@ -17,32 +20,86 @@ namespace {
 constexpr int PAGE_ITEMS = 23;
 constexpr int SKIP_PAGE_MS = 700;
 constexpr char OPDS_ROOT_PATH[] = "opds";  // No leading slash - relative to server URL
+constexpr unsigned long PREFETCH_DELAY_MS = 1000;
+
+// Feeds the parser under the render lock, so entries can be drawn while the rest of the feed is still arriving.
+// `onStart` prepares the parser, also under the lock, once the first bytes show that the server sends a new body.
+class LockedFeedSink final : public Print {
+  OpdsParser& feed;
+  RenderScheduler& renderScheduler;
+  const std::function<bool()> onStart;
+  const std::function<void()> onChunk;
+  bool started = false;
+  bool ready = false;
+
+ public:
+  LockedFeedSink(OpdsParser& feed, RenderScheduler& renderScheduler, std::function<bool()> onStart,
+                 std::function<void()> onChunk)
+      : feed(feed), renderScheduler(renderScheduler), onStart(std::move(onStart)), onChunk(std::move(onChunk)) {}
+
+  size_t write(const uint8_t data) override { return write(&data, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    renderScheduler.lock();
+    if (!started) {
+      started = true;
+      ready = onStart();
+    }
+    const size_t written = ready ? feed.write(buffer, size) : 0;
+    renderScheduler.unlock();
+    onChunk();
+    return written;
+  }
+
+  bool hasStarted() const { return started; }
+};
+
+// Parses a prefetched page. A new body replaces the cached entries; once `aborted` is set, writes fail so the
+// download stops.
+class PrefetchSink final : public Print {
+  OpdsParser& feed;
+  const std::atomic<bool>& aborted;
+  bool& started;
+  bool ready = false;
+
+ public:
+  PrefetchSink(OpdsParser& feed, const std::atomic<bool>& aborted, bool& started)
+      : feed(feed), aborted(aborted), started(started) {}
+
+  size_t write(const uint8_t data) override { return write(&data, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    if (aborted) {
+      return 0;
+    }
+    if (!started) {
+      started = true;
+      ready = feed.setup();
+    }
+    return ready ? feed.write(buffer, size) : 0;
+  }
+
+  bool isReady() const { return ready; }
+};
 }  // namespace
 
-void OpdsBookBrowserActivity::taskTrampoline(void* param) {
+void OpdsBookBrowserActivity::prefetchTaskTrampoline(void* param) {
   auto* self = static_cast<OpdsBookBrowserActivity*>(param);
-  self->displayTaskLoop();
+  self->prefetchTaskLoop();
 }
 
 void OpdsBookBrowserActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
   state = BrowserState::CHECK_WIFI;
-  entries.clear();
+  feed.clear();
   navigationHistory.clear();
   currentPath = OPDS_ROOT_PATH;
   selectorIndex = 0;
   errorMessage.clear();
   statusMessage = "Checking WiFi...";
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 
-  xTaskCreate(&OpdsBookBrowserActivity::taskTrampoline, "OpdsBookBrowserTask",
-              4096,               // Stack size (larger for HTTP operations)
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  // Larger stack for HTTP operations
+  renderScheduler.start("OpdsBookBrowserTask", 4096, [this] { render(); });
 
   // Check WiFi and connect if needed, then fetch feed
   checkAndConnectWifi();
@@ -51,17 +108,14 @@ void OpdsBookBrowserActivity::onEnter() {
 void OpdsBookBrowserActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
+  // The prefetch task may still be talking to the server
+  cancelPrefetch();
+
   // Turn off WiFi when exiting
   WiFi.mode(WIFI_OFF);
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-  entries.clear();
+  renderScheduler.stop();
+  feed.clear();
   navigationHistory.clear();
 }
 
@@ -81,7 +135,7 @@ void OpdsBookBrowserActivity::loop() {
         Serial.printf("[%lu] [OPDS] Retry: WiFi connected, retrying fetch\n", millis());
         state = BrowserState::LOADING;
         statusMessage = "Loading...";
-        updateRequired = true;
+        renderScheduler.requestUpdate();
         fetchFeed(currentPath);
       } else {
         // WiFi not connected - launch WiFi selection
@@ -117,6 +171,9 @@ void OpdsBookBrowserActivity::loop() {
 
   // Handle browsing state
   if (state == BrowserState::BROWSING) {
+    if (mappedInput.wasAnyPressed() || mappedInput.wasAnyReleased()) {
+      lastInputTime = millis();
+    }
     const bool prevReleased = mappedInput.wasReleased(MappedInputManager::Button::Up) ||
                               mappedInput.wasReleased(MappedInputManager::Button::Left);
     const bool nextReleased = mappedInput.wasReleased(MappedInputManager::Button::Down) ||
@@ -124,8 +181,8 @@ void OpdsBookBrowserActivity::loop() {
     const bool skipPage = mappedInput.getHeldTime() > SKIP_PAGE_MS;
 
     if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-      if (!entries.empty()) {
-        const auto& entry = entries[selectorIndex];
+      if (feed.getEntryCount() > 0) {
+        const OpdsEntry entry = feed.getEntry(selectorIndex);
         if (entry.type == OpdsEntryType::BOOK) {
           downloadBook(entry);
         } else {
@@ -134,33 +191,29 @@ void OpdsBookBrowserActivity::loop() {
       }
     } else if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
       navigateBack();
-    } else if (prevReleased && !entries.empty()) {
+    } else if (prevReleased && feed.getEntryCount() > 0) {
+      const size_t entryCount = feed.getEntryCount();
       if (skipPage) {
-        selectorIndex = ((selectorIndex / PAGE_ITEMS - 1) * PAGE_ITEMS + entries.size()) % entries.size();
+        selectorIndex = ((selectorIndex / PAGE_ITEMS - 1) * PAGE_ITEMS + entryCount) % entryCount;
       } else {
-        selectorIndex = (selectorIndex + entries.size() - 1) % entries.size();
+        selectorIndex = (selectorIndex + entryCount - 1) % entryCount;
       }
-      updateRequired = true;
-    } else if (nextReleased && !entries.empty()) {
-      if (skipPage) {
-        selectorIndex = ((selectorIndex / PAGE_ITEMS + 1) * PAGE_ITEMS) % entries.size();
-      } else {
-        selectorIndex = (selectorIndex + 1) % entries.size();
+      renderScheduler.requestUpdate();
+    } else if (nextReleased && feed.getEntryCount() > 0) {
+      const size_t target = skipPage ? (selectorIndex / PAGE_ITEMS + 1) * PAGE_ITEMS : selectorIndex + 1;
+      // Moving past the last entry follows the next link of a paged feed before wrapping around
+      if (target >= feed.getEntryCount()) {
+        loadNextPage();
       }
-      updateRequired = true;
-    }
-  }
-}
-
-void OpdsBookBrowserActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
+      selectorIndex = static_cast<int>(target % feed.getEntryCount());
+      renderScheduler.requestUpdate();
+    } else if (prefetchState == PrefetchState::IDLE && !nextPageFailed && !feed.getNextHref().empty() &&
+               feed.getNextHref() != prefetchHref && millis() - lastInputTime >= PREFETCH_DELAY_MS &&
+               feed.getEntryCount() > 0 &&
+               static_cast<size_t>(selectorIndex) / PAGE_ITEMS == (feed.getEntryCount() - 1) / PAGE_ITEMS) {
+      // The user rests on the last loaded screen: fetch the next page before they reach its end
+      startPrefetch();
     }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
   }
 }
 
@@ -214,13 +267,14 @@ void OpdsBookBrowserActivity::render() const {
   // Browsing state
   // Show appropriate button hint based on selected entry type
   const char* confirmLabel = "Open";
-  if (!entries.empty() && entries[selectorIndex].type == OpdsEntryType::BOOK) {
+  const size_t entryCount = feed.getEntryCount();
+  if (entryCount > 0 && feed.getEntry(selectorIndex).type == OpdsEntryType::BOOK) {
     confirmLabel = "Download";
   }
   const auto labels = mappedInput.mapLabels("« Back", confirmLabel, "", "");
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  if (entries.empty()) {
+  if (entryCount == 0) {
     renderer.drawCenteredText(UI_10_FONT_ID, pageHeight / 2, "No entries found");
     renderer.displayBuffer();
     return;
@@ -229,8 +283,8 @@ void OpdsBookBrowserActivity::render() const {
   const auto pageStartIndex = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
   renderer.fillRect(0, 60 + (selectorIndex % PAGE_ITEMS) * 30 - 2, pageWidth - 1, 30);
 
-  for (size_t i = pageStartIndex; i < entries.size() && i < static_cast<size_t>(pageStartIndex + PAGE_ITEMS); i++) {
-    const auto& entry = entries[i];
+  for (size_t i = pageStartIndex; i < entryCount && i < static_cast<size_t>(pageStartIndex + PAGE_ITEMS); i++) {
+    const OpdsEntry entry = feed.getEntry(i);
 
     // Format display text with type indicator
     std::string displayText;
@@ -257,53 +311,223 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   if (strlen(serverUrl) == 0) {
     state = BrowserState::ERROR;
     errorMessage = "No server URL configured";
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     return;
   }
 
-  std::string url = UrlUtils::buildUrl(serverUrl, path);
-  Serial.printf("[%lu] [OPDS] Fetching: %s\n", millis(), url.c_str());
+  cancelPrefetch();
+  renderScheduler.lock();
+  feed.clear();
+  renderScheduler.unlock();
+  selectorIndex = 0;
+  nextPageFailed = false;
 
-  std::string content;
-  if (!HttpDownloader::fetchUrl(url, content)) {
+  if (!fetchPage(path)) {
     state = BrowserState::ERROR;
-    errorMessage = "Failed to fetch feed";
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     return;
   }
 
-  OpdsParser parser;
-  if (!parser.parse(content.c_str(), content.size())) {
+  if (feed.getEntryCount() == 0) {
     state = BrowserState::ERROR;
-    errorMessage = "Failed to parse feed";
-    updateRequired = true;
+    errorMessage = "No entries found";
+    renderScheduler.requestUpdate();
     return;
   }
 
-  entries = parser.getEntries();
-  selectorIndex = 0;
+  // Also redraws a screen shown early, which may have been short of entries or showed the cached copy
+  state = BrowserState::BROWSING;
+  renderScheduler.requestUpdate();
+}
 
-  if (entries.empty()) {
-    state = BrowserState::ERROR;
-    errorMessage = "No entries found";
-    updateRequired = true;
+// Appends one page of a feed: straight from the cache if it was checked during this visit, otherwise from the
+// server, with the cached copy shown meanwhile and used for a conditional GET. Sets errorMessage on failure.
+bool OpdsBookBrowserActivity::fetchPage(const std::string& path) {
+  const std::string url = UrlUtils::buildUrl(SETTINGS.opdsServerUrl, path);
+  const size_t firstEntry = feed.getEntryCount();
+
+  OpdsFeedCache::Validators validators;
+  renderScheduler.lock();
+  const bool cached = feedCache.load(url, feed, validators);
+  renderScheduler.unlock();
+  if (cached && feedCache.isFresh(url)) {
+    return true;
+  }
+  if (cached && state == BrowserState::LOADING && feed.getEntryCount() > 0) {
+    state = BrowserState::BROWSING;
+    renderScheduler.requestUpdate();
+  }
+
+  Serial.printf("[%lu] [OPDS] Fetching: %s\n", millis(), url.c_str());
+  bool parserReady = false;
+  LockedFeedSink sink(
+      feed, renderScheduler,
+      [this, firstEntry, &parserReady] {
+        // A new body replaces the cached entries of the page
+        feed.truncate(firstEntry);
+        parserReady = feed.setupPage();
+        return parserReady;
+      },
+      // Show the first screenful as soon as it has been parsed instead of waiting for the whole feed
+      [this] {
+        if (state == BrowserState::LOADING && feed.getEntryCount() >= PAGE_ITEMS) {
+          state = BrowserState::BROWSING;
+          renderScheduler.requestUpdate();
+        }
+      });
+  const auto result = HttpDownloader::fetchUrlIfModified(url, sink, validators.etag, validators.lastModified);
+
+  if (result == HttpDownloader::FetchResult::NotModified) {
+    feedCache.markFresh(url);
+    return true;
+  }
+  if (result == HttpDownloader::FetchResult::Failed && cached && !sink.hasStarted()) {
+    // Server unreachable: keep the cached copy, and ask again on the next visit
+    Serial.printf("[%lu] [OPDS] Using cached copy of %s\n", millis(), url.c_str());
+    return true;
+  }
+
+  renderScheduler.lock();
+  const bool parsed = result == HttpDownloader::FetchResult::Ok && parserReady && feed.finish();
+  const bool parseFailed = sink.hasStarted() && (!parserReady || feed.hasError());
+  if (!parsed) {
+    feed.truncate(firstEntry);
+  }
+  renderScheduler.unlock();
+
+  if (!parsed) {
+    errorMessage = parseFailed ? "Failed to parse feed" : "Failed to fetch feed";
+    return false;
+  }
+  feedCache.store(url, feed, firstEntry, validators);
+  return true;
+}
+
+// Follows the next link of a paged feed, returns whether entries were added
+bool OpdsBookBrowserActivity::loadNextPage() {
+  const std::string nextHref = feed.getNextHref();
+  if (nextHref.empty() || nextPageFailed) {
+    return false;
+  }
+
+  const size_t entryCount = feed.getEntryCount();
+  if (!takePrefetchedPage(nextHref) && !fetchPage(nextHref)) {
+    // Keep the pages loaded so far
+    nextPageFailed = true;
+    return false;
+  }
+  if (feed.getNextHref() == nextHref) {
+    // A page linking to itself would be followed forever
+    feed.setNextHref("");
+  }
+  renderScheduler.requestUpdate();
+  return feed.getEntryCount() > entryCount;
+}
+
+// Fetches the next page of the current feed in a separate task, so the buttons keep working while it downloads.
+// The task only talks to the server and parses into prefetchFeed. The SD card and `feed` stay with this task: the
+// cached copy and its validators are loaded here, and the page is stored and appended in takePrefetchedPage().
+void OpdsBookBrowserActivity::startPrefetch() {
+  prefetchHref = feed.getNextHref();
+  prefetchUrl = UrlUtils::buildUrl(SETTINGS.opdsServerUrl, prefetchHref);
+  if (feedCache.isFresh(prefetchUrl)) {
+    // loadNextPage() reads it from the SD card without asking the server
     return;
   }
 
-  state = BrowserState::BROWSING;
-  updateRequired = true;
+  prefetchFeed.clear();
+  prefetchValidators = {};
+  prefetchCached = feedCache.load(prefetchUrl, prefetchFeed, prefetchValidators);
+  prefetchStarted = false;
+  prefetchParsed = false;
+  prefetchResult = HttpDownloader::FetchResult::Failed;
+  prefetchAborted = false;
+  prefetchWaiter = xTaskGetCurrentTaskHandle();
+  prefetchState = PrefetchState::RUNNING;
+
+  Serial.printf("[%lu] [OPDS] Prefetching: %s\n", millis(), prefetchUrl.c_str());
+  // Large stack for the TLS handshake; same priority as the display task and the loop, which share the CPU with it
+  if (xTaskCreate(&OpdsBookBrowserActivity::prefetchTaskTrampoline, "OpdsPrefetchTask", 8192, this, 1, nullptr) !=
+      pdPASS) {
+    Serial.printf("[%lu] [OPDS] Failed to start prefetch task\n", millis());
+    prefetchState = PrefetchState::IDLE;
+  }
+}
+
+void OpdsBookBrowserActivity::prefetchTaskLoop() {
+  {
+    PrefetchSink sink(prefetchFeed, prefetchAborted, prefetchStarted);
+    prefetchResult = HttpDownloader::fetchUrlIfModified(prefetchUrl, sink, prefetchValidators.etag,
+                                                        prefetchValidators.lastModified);
+    prefetchParsed = prefetchResult == HttpDownloader::FetchResult::Ok && sink.isReady() && prefetchFeed.finish();
+  }
+
+  // The activity may be gone as soon as it sees DONE, so nothing of it is touched afterwards
+  const TaskHandle_t waiter = prefetchWaiter;
+  prefetchState = PrefetchState::DONE;
+  xTaskNotifyGive(waiter);
+  vTaskDelete(nullptr);
+}
+
+// Returns once the prefetch task no longer uses the members it owns
+void OpdsBookBrowserActivity::waitForPrefetch() {
+  while (prefetchState == PrefetchState::RUNNING) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+  }
+}
+
+// Stops a prefetch in progress and drops its page, before the feed changes or another download needs the network
+void OpdsBookBrowserActivity::cancelPrefetch() {
+  prefetchAborted = true;
+  waitForPrefetch();
+  prefetchState = PrefetchState::IDLE;
+  prefetchFeed.clear();
+  prefetchHref.clear();
+}
+
+// Appends the prefetched page if it is `href`, waiting for the prefetch to finish; false if there is none to use
+bool OpdsBookBrowserActivity::takePrefetchedPage(const std::string& href) {
+  waitForPrefetch();
+  if (prefetchState != PrefetchState::DONE || href != prefetchHref) {
+    return false;
+  }
+  prefetchState = PrefetchState::IDLE;
+
+  // Same outcomes as fetchPage(): an unreachable server leaves the cached copy in use
+  const bool notModified = prefetchResult == HttpDownloader::FetchResult::NotModified;
+  const bool usable = prefetchParsed || notModified ||
+                      (prefetchResult == HttpDownloader::FetchResult::Failed && prefetchCached && !prefetchStarted);
+  if (usable) {
+    const size_t firstEntry = feed.getEntryCount();
+    renderScheduler.lock();
+    for (size_t i = 0; i < prefetchFeed.getEntryCount(); i++) {
+      feed.addEntry(prefetchFeed.getEntry(i));
+    }
+    feed.setNextHref(prefetchFeed.getNextHref());
+    renderScheduler.unlock();
+
+    if (prefetchParsed) {
+      feedCache.store(prefetchUrl, feed, firstEntry, prefetchValidators);
+    } else if (notModified) {
+      feedCache.markFresh(prefetchUrl);
+    }
+  }
+  prefetchFeed.clear();
+  return usable;
 }
 
 void OpdsBookBrowserActivity::navigateToEntry(const OpdsEntry& entry) {
   // Push current path to history before navigating
-  navigationHistory.push_back(currentPath);
+  navigationHistory.push_back({currentPath, selectorIndex});
   currentPath = entry.href;
 
   state = BrowserState::LOADING;
   statusMessage = "Loading...";
-  entries.clear();
+  renderScheduler.lock();
+  feed.clear();
+  renderScheduler.unlock();
   selectorIndex = 0;
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 
   fetchFeed(currentPath);
 }
@@ -314,25 +538,37 @@ void OpdsBookBrowserActivity::navigateBack() {
     onGoHome();
   } else {
     // Go back to previous catalog
-    currentPath = navigationHistory.back();
+    const HistoryEntry previous = navigationHistory.back();
     navigationHistory.pop_back();
+    currentPath = previous.path;
 
     state = BrowserState::LOADING;
     statusMessage = "Loading...";
-    entries.clear();
+    renderScheduler.lock();
+    feed.clear();
+    renderScheduler.unlock();
     selectorIndex = 0;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
 
     fetchFeed(currentPath);
+
+    // Select the entry that was opened again, loading the pages before it (cached during this visit)
+    if (state == BrowserState::BROWSING) {
+      while (static_cast<size_t>(previous.selectorIndex) >= feed.getEntryCount() && loadNextPage()) {
+      }
+      selectorIndex = std::min(previous.selectorIndex, static_cast<int>(feed.getEntryCount()) - 1);
+      renderScheduler.requestUpdate();
+    }
   }
 }
 
 void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
+  cancelPrefetch();
   state = BrowserState::DOWNLOADING;
   statusMessage = book.title;
   downloadProgress = 0;
   downloadTotal = 0;
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 
   // Build full download URL
   std::string downloadUrl = UrlUtils::buildUrl(SETTINGS.opdsServerUrl, book.href);
@@ -350,17 +586,18 @@ void OpdsBookBrowserActivity::downloadBook(const OpdsEntry& book) {
       HttpDownloader::downloadToFile(downloadUrl, filename, [this](const size_t downloaded, const size_t total) {
         downloadProgress = downloaded;
         downloadTotal = total;
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       });
 
   if (result == HttpDownloader::OK) {
     Serial.printf("[%lu] [OPDS] Download complete: %s\n", millis(), filename.c_str());
+    IndexQueue::add(filename);
     state = BrowserState::BROWSING;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   } else {
     state = BrowserState::ERROR;
-    errorMessage = "Download failed";
-    updateRequired = true;
+    errorMessage = result == HttpDownloader::INCOMPLETE ? "Download interrupted, retry to resume" : "Download failed";
+    renderScheduler.requestUpdate();
   }
 }
 
@@ -369,7 +606,7 @@ void OpdsBookBrowserActivity::checkAndConnectWifi() {
   if (WiFi.status() == WL_CONNECTED && WiFi.localIP() != IPAddress(0, 0, 0, 0)) {
     state = BrowserState::LOADING;
     statusMessage = "Loading...";
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     fetchFeed(currentPath);
     return;
   }
@@ -380,7 +617,7 @@ void OpdsBookBrowserActivity::checkAndConnectWifi() {
 
 void OpdsBookBrowserActivity::launchWifiSelection() {
   state = BrowserState::WIFI_SELECTION;
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 
   enterNewActivity(new WifiSelectionActivity(renderer, mappedInput,
                                              [this](const bool connected) { onWifiSelectionComplete(connected); }));
@@ -393,7 +630,7 @@ void OpdsBookBrowserActivity::onWifiSelectionComplete(const bool connected) {
     Serial.printf("[%lu] [OPDS] WiFi connected via selection, fetching feed\n", millis());
     state = BrowserState::LOADING;
     statusMessage = "Loading...";
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     fetchFeed(currentPath);
   } else {
     Serial.printf("[%lu] [OPDS] WiFi selection cancelled/failed\n", millis());
@@ -403,6 +640,6 @@ void OpdsBookBrowserActivity::onWifiSelectionComplete(const bool connected) {
     WiFi.mode(WIFI_OFF);
     state = BrowserState::ERROR;
     errorMessage = "WiFi connection failed";
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 }
@@ -1,19 +1,24 @@
 #pragma once
 #include <OpdsParser.h>
 #include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#include <atomic>
 #include <functional>
 #include <string>
 #include <vector>
 
 #include "../ActivityWithSubactivity.h"
+#include "../RenderScheduler.h"
+#include "network/HttpDownloader.h"
+#include "network/OpdsFeedCache.h"
 
 /**
  * Activity for browsing and downloading books from an OPDS server.
  * Supports navigation through catalog hierarchy and downloading EPUBs.
  * When WiFi connection fails, launches WiFi selection to let user connect.
+ * Feed pages come from OpdsFeedCache when possible; paged feeds are followed when the user moves past their last entry.
+ * Resting on the last loaded screen fetches the next page in a separate task, see startPrefetch().
  */
 class OpdsBookBrowserActivity final : public ActivityWithSubactivity {
  public:
@@ -35,30 +40,58 @@ class OpdsBookBrowserActivity final : public ActivityWithSubactivity {
   void loop() override;
 
  private:
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderScheduler renderScheduler;
+
+  struct HistoryEntry {
+    std::string path;
+    int selectorIndex;
+  };
 
   BrowserState state = BrowserState::LOADING;
-  std::vector<OpdsEntry> entries;
-  std::vector<std::string> navigationHistory;  // Stack of previous feed paths for back navigation
-  std::string currentPath;                     // Current feed path being displayed
+  OpdsParser feed;                              // Entries of the current feed, filled while it downloads
+  OpdsFeedCache feedCache;                      // Parsed pages on the SD card
+  std::vector<HistoryEntry> navigationHistory;  // Stack of previous feeds and their selection for back navigation
+  std::string currentPath;                      // Current feed path being displayed
   int selectorIndex = 0;
+  bool nextPageFailed = false;  // The next page of the current feed could not be loaded, do not retry it
+  unsigned long lastInputTime = 0;
   std::string errorMessage;
   std::string statusMessage;
   size_t downloadProgress = 0;
   size_t downloadTotal = 0;
 
+  // Background fetch of the next page. While prefetchState is RUNNING the prefetch task owns prefetchFeed,
+  // prefetchValidators and the results below; the activity reads them once it sees DONE.
+  enum class PrefetchState : uint8_t { IDLE, RUNNING, DONE };
+  TaskHandle_t prefetchWaiter = nullptr;
+  std::atomic<PrefetchState> prefetchState{PrefetchState::IDLE};
+  std::atomic<bool> prefetchAborted{false};
+  OpdsParser prefetchFeed;  // Entries of the next page, starting with the cached copy if there is one
+  std::string prefetchHref;
+  std::string prefetchUrl;
+  OpdsFeedCache::Validators prefetchValidators;
+  bool prefetchCached = false;
+  bool prefetchStarted = false;  // The server sent a new body, the cached entries were dropped
+  bool prefetchParsed = false;
+  HttpDownloader::FetchResult prefetchResult = HttpDownloader::FetchResult::Failed;
+
   const std::function<void()> onGoHome;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
+  static void prefetchTaskTrampoline(void* param);
+
   void render() const;
 
   void checkAndConnectWifi();
   void launchWifiSelection();
   void onWifiSelectionComplete(bool connected);
   void fetchFeed(const std::string& path);
+  bool fetchPage(const std::string& path);
+  bool loadNextPage();
+  void startPrefetch();
+  void prefetchTaskLoop();
+  void waitForPrefetch();
+  void cancelPrefetch();
+  bool takePrefetchedPage(const std::string& href);
   void navigateToEntry(const OpdsEntry& entry);
   void navigateBack();
   void downloadBook(const OpdsEntry& book);
@@ -8,18 +8,16 @@
 #include <vector>
 
 #include "Battery.h"
+#include "BookCard.h"
+#include "CacheManager.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "IndexQueue.h"
 #include "MappedInputManager.h"
 #include "ScreenComponents.h"
 #include "fontIds.h"
 #include "util/StringUtils.h"
 
-void HomeActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<HomeActivity*>(param);
-  self->displayTaskLoop();
-}
-
 int HomeActivity::getMenuItemCount() const {
   int count = 3;  // Browse files, File transfer, Settings
   if (hasContinueReading) count++;
@@ -30,15 +28,24 @@ int HomeActivity::getMenuItemCount() const {
 void HomeActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Check if we have a book to continue reading
   hasContinueReading = !APP_STATE.openEpubPath.empty() && SdMan.exists(APP_STATE.openEpubPath.c_str());
 
   // Check if OPDS browser URL is configured
   hasOpdsUrl = strlen(SETTINGS.opdsServerUrl) > 0;
 
-  if (hasContinueReading) {
+  lastBookAuthor.clear();
+  lastBookChapter.clear();
+  lastBookProgress = BookCard::NO_PROGRESS;
+
+  BookCard card;
+  if (hasContinueReading && BookCard::load(APP_STATE.openEpubPath, card)) {
+    // Written by the reader, no need to open the book
+    lastBookTitle = card.title;
+    lastBookAuthor = card.author;
+    lastBookChapter = card.chapter;
+    lastBookProgress = card.progress;
+  } else if (hasContinueReading) {
     // Extract filename from path for display
     lastBookTitle = APP_STATE.openEpubPath;
     const size_t lastSlash = lastBookTitle.find_last_of('/');
@@ -66,27 +73,19 @@ void HomeActivity::onEnter() {
   selectorIndex = 0;
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&HomeActivity::taskTrampoline, "HomeActivityTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderScheduler.requestUpdate();
+
+  // Prepares newly arrived books between renders, which takes the stack of a reader display task, then cleans up
+  // the book caches
+  renderScheduler.start("HomeActivityTask", 8192, [this] { render(); }, [this] {
+    return IndexQueue::runStep(renderer, [this] { return renderScheduler.shouldYield(); }) || CacheManager::runStep();
+  });
 }
 
 void HomeActivity::onExit() {
   Activity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderScheduler.stop();
 }
 
 void HomeActivity::loop() {
@@ -119,22 +118,10 @@ void HomeActivity::loop() {
     }
   } else if (prevPressed) {
     selectorIndex = (selectorIndex + menuCount - 1) % menuCount;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   } else if (nextPressed) {
     selectorIndex = (selectorIndex + 1) % menuCount;
-    updateRequired = true;
-  }
-}
-
-void HomeActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderScheduler.requestUpdate();
   }
 }
 
@@ -277,8 +264,16 @@ void HomeActivity::render() const {
       renderer.drawCenteredText(UI_10_FONT_ID, titleYStart, trimmedAuthor.c_str(), !bookSelected);
     }
 
-    renderer.drawCenteredText(UI_10_FONT_ID, bookY + bookHeight - renderer.getLineHeight(UI_10_FONT_ID) * 3 / 2,
-                              "Continue Reading", !bookSelected);
+    const int continueY = bookY + bookHeight - renderer.getLineHeight(UI_10_FONT_ID) * 3 / 2;
+    if (!lastBookChapter.empty()) {
+      const auto chapter = renderer.truncatedText(SMALL_FONT_ID, lastBookChapter.c_str(), maxLineWidth);
+      renderer.drawCenteredText(SMALL_FONT_ID, continueY - renderer.getLineHeight(SMALL_FONT_ID) * 3 / 2,
+                                chapter.c_str(), !bookSelected);
+    }
+    const std::string continueLabel = lastBookProgress == BookCard::NO_PROGRESS
+                                          ? std::string("Continue Reading")
+                                          : "Continue Reading - " + std::to_string(lastBookProgress) + "%";
+    renderer.drawCenteredText(UI_10_FONT_ID, continueY, continueLabel.c_str(), !bookSelected);
   } else {
     // No book to continue reading
     const int y =
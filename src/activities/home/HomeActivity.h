@@ -1,29 +1,24 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
-
 #include <functional>
 
 #include "../Activity.h"
+#include "../RenderScheduler.h"
 
 class HomeActivity final : public Activity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderScheduler renderScheduler;
   int selectorIndex = 0;
-  bool updateRequired = false;
   bool hasContinueReading = false;
   bool hasOpdsUrl = false;
   std::string lastBookTitle;
   std::string lastBookAuthor;
+  std::string lastBookChapter;
+  uint8_t lastBookProgress = 0xFF;
   const std::function<void()> onContinueReading;
   const std::function<void()> onReaderOpen;
   const std::function<void()> onSettingsOpen;
   const std::function<void()> onFileTransferOpen;
   const std::function<void()> onOpdsBrowserOpen;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   int getMenuItemCount() const;
 
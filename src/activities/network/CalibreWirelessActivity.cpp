@@ -1,12 +1,15 @@
 #include "CalibreWirelessActivity.h"
 
+#include <ArduinoJson.h>
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
 #include <SDCardManager.h>
 #include <WiFi.h>
 
+#include <cstdlib>
 #include <cstring>
 
+#include "IndexQueue.h"
 #include "MappedInputManager.h"
 #include "ScreenComponents.h"
 #include "fontIds.h"
@@ -15,22 +18,46 @@
 namespace {
 constexpr uint16_t UDP_PORTS[] = {54982, 48123, 39001, 44044, 59678};
 constexpr uint16_t LOCAL_UDP_PORT = 8134;  // Port to receive responses
+// SD writes end on multiples of this file offset, so they stay large and sector aligned
+constexpr size_t WRITE_BLOCK_SIZE = 4096;
+constexpr unsigned long STALL_WAIT_MS = 20;
+
+// Book list entry and metadata reply for a catalogue book; priKey is how Calibre asks for a book's metadata later
+std::string bookToJson(const CalibreCatalog::Book& book, const size_t priKey) {
+  JsonDocument doc;
+  doc["priKey"] = priKey;
+  doc["lpath"] = book.lpath;
+  doc["uuid"] = book.uuid;
+  doc["title"] = book.title;
+  JsonArray authors = doc["authors"].to<JsonArray>();
+  if (!book.authors.empty()) {
+    authors.add(book.authors);
+  }
+  // Calibre reads "None" as unknown and asks for the full metadata instead of trusting its cache
+  doc["last_modified"] = book.lastModified.empty() ? "None" : book.lastModified;
+  doc["size"] = book.size;
+  const size_t dot = book.lpath.rfind('.');
+  doc["extension"] = dot == std::string::npos ? "" : book.lpath.substr(dot + 1);
+
+  std::string json;
+  serializeJson(doc, json);
+  return json;
+}
 }  // namespace
 
-void CalibreWirelessActivity::displayTaskTrampoline(void* param) {
+void CalibreWirelessActivity::networkTaskTrampoline(void* param) {
   auto* self = static_cast<CalibreWirelessActivity*>(param);
-  self->displayTaskLoop();
+  self->networkTaskLoop();
 }
 
-void CalibreWirelessActivity::networkTaskTrampoline(void* param) {
+void CalibreWirelessActivity::sdWriterTaskTrampoline(void* param) {
   auto* self = static_cast<CalibreWirelessActivity*>(param);
-  self->networkTaskLoop();
+  self->sdWriterTaskLoop();
 }
 
 void CalibreWirelessActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
   stateMutex = xSemaphoreCreateMutex();
 
   state = WirelessState::DISCOVERING;
@@ -43,16 +70,20 @@ void CalibreWirelessActivity::onEnter() {
   currentFilename.clear();
   currentFileSize = 0;
   bytesReceived = 0;
+  transferStats = {};
   inBinaryMode = false;
-  recvBuffer.clear();
+  recvRing.clear();
+  messageReader.reset();
+  currentBook = {};
+  catalog.open();
 
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 
   // Start UDP listener for Calibre responses
   udp.begin(LOCAL_UDP_PORT);
 
   // Create display task
-  xTaskCreate(&CalibreWirelessActivity::displayTaskTrampoline, "CalDisplayTask", 2048, this, 1, &displayTaskHandle);
+  renderScheduler.start("CalDisplayTask", 2048, [this] { render(); });
 
   // Create network task with larger stack for JSON parsing
   xTaskCreate(&CalibreWirelessActivity::networkTaskTrampoline, "CalNetworkTask", 12288, this, 2, &networkTaskHandle);
@@ -72,10 +103,8 @@ void CalibreWirelessActivity::onExit() {
     tcpClient.stop();
   }
 
-  // Close any open file
-  if (currentFile) {
-    currentFile.close();
-  }
+  // Stop the SD writer first: it may be in the middle of a write, and it notifies the network task
+  stopSdWriter();
 
   // Acquire stateMutex before deleting network task to avoid race condition
   xSemaphoreTake(stateMutex, portMAX_DELAY);
@@ -85,14 +114,14 @@ void CalibreWirelessActivity::onExit() {
   }
   xSemaphoreGive(stateMutex);
 
-  // Acquire renderingMutex before deleting display task
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
+  // Close any open file, now that no task writes to it
+  if (currentFile) {
+    currentFile.close();
   }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  catalog.commit();
+  catalog.close();
+
+  renderScheduler.stop();
 
   vSemaphoreDelete(stateMutex);
   stateMutex = nullptr;
@@ -105,18 +134,6 @@ void CalibreWirelessActivity::loop() {
   }
 }
 
-void CalibreWirelessActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(50 / portTICK_PERIOD_MS);
-  }
-}
-
 void CalibreWirelessActivity::networkTaskLoop() {
   while (true) {
     xSemaphoreTake(stateMutex, portMAX_DELAY);
@@ -267,129 +284,36 @@ void CalibreWirelessActivity::handleTcpClient() {
     return;
   }
 
-  std::string message;
-  if (readJsonMessage(message)) {
-    // Parse opcode from JSON array format: [opcode, {...}]
-    // Find the opcode (first number after '[')
-    size_t start = message.find('[');
-    if (start != std::string::npos) {
-      start++;
-      size_t end = message.find(',', start);
-      if (end != std::string::npos) {
-        const int opcodeInt = std::stoi(message.substr(start, end - start));
-        if (opcodeInt < 0 || opcodeInt >= OpCode::ERROR) {
-          Serial.printf("[%lu] [CAL] Invalid opcode: %d\n", millis(), opcodeInt);
-          sendJsonResponse(OpCode::OK, "{}");
-          return;
-        }
-        const auto opcode = static_cast<OpCode>(opcodeInt);
-
-        // Extract data object (everything after the comma until the last ']')
-        size_t dataStart = end + 1;
-        size_t dataEnd = message.rfind(']');
-        std::string data = "";
-        if (dataEnd != std::string::npos && dataEnd > dataStart) {
-          data = message.substr(dataStart, dataEnd - dataStart);
-        }
+  fillRecvRing();
+  if (!messageReader.read(recvRing)) {
+    return;
+  }
 
-        handleCommand(opcode, data);
-      }
-    }
+  const int opcodeInt = messageReader.getOpcode();
+  if (opcodeInt < 0 || opcodeInt >= OpCode::ERROR) {
+    Serial.printf("[%lu] [CAL] Invalid opcode: %d\n", millis(), opcodeInt);
+    sendJsonResponse(OpCode::OK, "{}");
+    return;
   }
+  handleCommand(static_cast<OpCode>(opcodeInt));
 }
 
-bool CalibreWirelessActivity::readJsonMessage(std::string& message) {
-  // Read available data into buffer
+// Reads whatever the socket has straight into the free space of the receive ring
+void CalibreWirelessActivity::fillRecvRing() {
   int available = tcpClient.available();
-  if (available > 0) {
-    // Limit buffer growth to prevent memory issues
-    if (recvBuffer.size() > 100000) {
-      recvBuffer.clear();
-      return false;
-    }
-    // Read in chunks
-    char buf[1024];
-    while (available > 0) {
-      int toRead = std::min(available, static_cast<int>(sizeof(buf)));
-      int bytesRead = tcpClient.read(reinterpret_cast<uint8_t*>(buf), toRead);
-      if (bytesRead > 0) {
-        recvBuffer.append(buf, bytesRead);
-        available -= bytesRead;
-      } else {
-        break;
-      }
-    }
-  }
-
-  if (recvBuffer.empty()) {
-    return false;
-  }
-
-  // Find '[' which marks the start of JSON
-  size_t bracketPos = recvBuffer.find('[');
-  if (bracketPos == std::string::npos) {
-    // No '[' found - if buffer is getting large, something is wrong
-    if (recvBuffer.size() > 1000) {
-      recvBuffer.clear();
-    }
-    return false;
-  }
-
-  // Try to extract length from digits before '['
-  // Calibre ALWAYS sends a length prefix, so if it's not valid digits, it's garbage
-  size_t msgLen = 0;
-  bool validPrefix = false;
-
-  if (bracketPos > 0 && bracketPos <= 12) {
-    // Check if prefix is all digits
-    bool allDigits = true;
-    for (size_t i = 0; i < bracketPos; i++) {
-      char c = recvBuffer[i];
-      if (c < '0' || c > '9') {
-        allDigits = false;
-        break;
-      }
-    }
-    if (allDigits) {
-      msgLen = std::stoul(recvBuffer.substr(0, bracketPos));
-      validPrefix = true;
+  while (available > 0) {
+    size_t length;
+    uint8_t* span = recvRing.writeSpan(&length);
+    if (length == 0) {
+      break;
     }
-  }
-
-  if (!validPrefix) {
-    // Not a valid length prefix - discard everything up to '[' and treat '[' as start
-    if (bracketPos > 0) {
-      recvBuffer = recvBuffer.substr(bracketPos);
+    const int bytesRead = tcpClient.read(span, std::min(length, static_cast<size_t>(available)));
+    if (bytesRead <= 0) {
+      break;
     }
-    // Without length prefix, we can't reliably parse - wait for more data
-    // that hopefully starts with a proper length prefix
-    return false;
+    recvRing.commit(bytesRead);
+    available -= bytesRead;
   }
-
-  // Sanity check the message length
-  if (msgLen > 1000000) {
-    recvBuffer = recvBuffer.substr(bracketPos + 1);  // Skip past this '[' and try again
-    return false;
-  }
-
-  // Check if we have the complete message
-  size_t totalNeeded = bracketPos + msgLen;
-  if (recvBuffer.size() < totalNeeded) {
-    // Not enough data yet - wait for more
-    return false;
-  }
-
-  // Extract the message
-  message = recvBuffer.substr(bracketPos, msgLen);
-
-  // Keep the rest in buffer (may contain binary data or next message)
-  if (recvBuffer.size() > totalNeeded) {
-    recvBuffer = recvBuffer.substr(totalNeeded);
-  } else {
-    recvBuffer.clear();
-  }
-
-  return true;
 }
 
 void CalibreWirelessActivity::sendJsonResponse(const OpCode opcode, const std::string& data) {
@@ -402,10 +326,10 @@ void CalibreWirelessActivity::sendJsonResponse(const OpCode opcode, const std::s
   tcpClient.flush();
 }
 
-void CalibreWirelessActivity::handleCommand(const OpCode opcode, const std::string& data) {
+void CalibreWirelessActivity::handleCommand(const OpCode opcode) {
   switch (opcode) {
     case OpCode::GET_INITIALIZATION_INFO:
-      handleGetInitializationInfo(data);
+      handleGetInitializationInfo();
       break;
     case OpCode::GET_DEVICE_INFORMATION:
       handleGetDeviceInformation();
@@ -417,16 +341,16 @@ void CalibreWirelessActivity::handleCommand(const OpCode opcode, const std::stri
       handleGetBookCount();
       break;
     case OpCode::SEND_BOOK:
-      handleSendBook(data);
+      handleSendBook();
       break;
     case OpCode::SEND_BOOK_METADATA:
-      handleSendBookMetadata(data);
+      handleSendBookMetadata();
       break;
     case OpCode::DISPLAY_MESSAGE:
-      handleDisplayMessage(data);
+      handleDisplayMessage();
       break;
     case OpCode::NOOP:
-      handleNoop(data);
+      handleNoop();
       break;
     case OpCode::SET_CALIBRE_DEVICE_INFO:
     case OpCode::SET_CALIBRE_DEVICE_NAME:
@@ -439,9 +363,8 @@ void CalibreWirelessActivity::handleCommand(const OpCode opcode, const std::stri
       sendJsonResponse(OpCode::OK, "{}");
       break;
     case OpCode::SEND_BOOKLISTS:
-      // Calibre asking us to send our book list. We report 0 books in
-      // handleGetBookCount, so this is effectively a no-op.
-      sendJsonResponse(OpCode::OK, "{}");
+      // Calibre's view of our book list, followed by one SEND_BOOK_METADATA per book. Calibre does not wait for a
+      // reply to either.
       break;
     case OpCode::TOTAL_SPACE:
       handleFreeSpace();
@@ -453,7 +376,7 @@ void CalibreWirelessActivity::handleCommand(const OpCode opcode, const std::stri
   }
 }
 
-void CalibreWirelessActivity::handleGetInitializationInfo(const std::string& data) {
+void CalibreWirelessActivity::handleGetInitializationInfo() {
   setState(WirelessState::WAITING);
   setStatus("Connected to " + calibreHostname +
             "\nWaiting for transfer...\n\nIf transfer fails, enable\n'Ignore free space' in Calibre's\nSmartDevice "
@@ -510,69 +433,41 @@ void CalibreWirelessActivity::handleFreeSpace() {
 }
 
 void CalibreWirelessActivity::handleGetBookCount() {
-  // We report 0 books - Calibre will send books without checking for duplicates
-  std::string response = "{\"count\":0,\"willStream\":true,\"willScan\":false}";
-  sendJsonResponse(OpCode::OK, response);
-}
-
-void CalibreWirelessActivity::handleSendBook(const std::string& data) {
-  // Manually extract lpath and length from SEND_BOOK data
-  // Full JSON parsing crashes on large metadata, so we just extract what we need
-
-  // Extract "lpath" field - format: "lpath": "value"
-  std::string lpath;
-  size_t lpathPos = data.find("\"lpath\"");
-  if (lpathPos != std::string::npos) {
-    size_t colonPos = data.find(':', lpathPos + 7);
-    if (colonPos != std::string::npos) {
-      size_t quoteStart = data.find('"', colonPos + 1);
-      if (quoteStart != std::string::npos) {
-        size_t quoteEnd = data.find('"', quoteStart + 1);
-        if (quoteEnd != std::string::npos) {
-          lpath = data.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-        }
-      }
+  // Merge the books received so far, so every book has a fixed position to serve as its priKey
+  catalog.commit();
+  const size_t count = catalog.getCount();
+  sendJsonResponse(OpCode::OK, "{\"count\":" + std::to_string(count) + ",\"willStream\":true,\"willScan\":false}");
+
+  // Streamed one book per message. Calibre matches them against its library by lpath, UUID and last_modified, only
+  // asks (NOOP with priKey) for the metadata of books it cannot match, and only sends books that are not listed.
+  CalibreCatalog::Book book;
+  for (size_t i = 0; i < count; i++) {
+    if (!catalog.readBook(i, book)) {
+      Serial.printf("[%lu] [CAL] Failed to read catalogue book %zu\n", millis(), i);
+      book = {};
     }
+    sendJsonResponse(OpCode::OK, bookToJson(book, i));
   }
+  Serial.printf("[%lu] [CAL] Sent book list with %zu books\n", millis(), count);
+}
 
-  // Extract top-level "length" field - must track depth to skip nested objects
-  // The metadata contains nested "length" fields (e.g., cover image length)
-  size_t length = 0;
-  int depth = 0;
-  for (size_t i = 0; i < data.size(); i++) {
-    char c = data[i];
-    if (c == '{' || c == '[') {
-      depth++;
-    } else if (c == '}' || c == ']') {
-      depth--;
-    } else if (depth == 1 && c == '"') {
-      // At top level, check if this is "length"
-      if (i + 9 < data.size() && data.substr(i, 8) == "\"length\"") {
-        // Found top-level "length" - extract the number after ':'
-        size_t colonPos = data.find(':', i + 8);
-        if (colonPos != std::string::npos) {
-          size_t numStart = colonPos + 1;
-          while (numStart < data.size() && (data[numStart] == ' ' || data[numStart] == '\t')) {
-            numStart++;
-          }
-          size_t numEnd = numStart;
-          while (numEnd < data.size() && data[numEnd] >= '0' && data[numEnd] <= '9') {
-            numEnd++;
-          }
-          if (numEnd > numStart) {
-            length = std::stoul(data.substr(numStart, numEnd - numStart));
-            break;
-          }
-        }
-      }
-    }
-  }
+void CalibreWirelessActivity::handleSendBook() {
+  // The reader only takes "length" from the top level, so the nested "length" fields of the metadata (e.g. the
+  // cover's) never shadow the book's
+  const std::string lpath = messageReader.get(CalibreMessageReader::Field::Lpath);
+  const size_t length = strtoul(messageReader.get(CalibreMessageReader::Field::Length), nullptr, 10);
 
   if (lpath.empty() || length == 0) {
     sendJsonResponse(OpCode::ERROR, "{\"message\":\"Invalid book data\"}");
     return;
   }
 
+  currentBook = {};
+  currentBook.uuid = messageReader.get(CalibreMessageReader::Field::Uuid);
+  currentBook.title = messageReader.get(CalibreMessageReader::Field::Title);
+  currentBook.authors = messageReader.get(CalibreMessageReader::Field::Authors);
+  currentBook.lastModified = messageReader.get(CalibreMessageReader::Field::LastModified);
+
   // Extract filename from lpath
   std::string filename = lpath;
   const size_t lastSlash = filename.rfind('/');
@@ -580,13 +475,20 @@ void CalibreWirelessActivity::handleSendBook(const std::string& data) {
     filename = filename.substr(lastSlash + 1);
   }
 
-  // Sanitize and create full path
-  currentFilename = "/" + StringUtils::sanitizeFilename(filename);
-  if (!StringUtils::checkFileExtension(currentFilename, ".epub")) {
-    currentFilename += ".epub";
+  // A new version of a book already on the card replaces it in place, otherwise sanitize and create full path
+  CalibreCatalog::Book existing;
+  if (catalog.findByUuid(currentBook.uuid, existing)) {
+    currentFilename = "/" + existing.lpath;
+  } else {
+    currentFilename = "/" + StringUtils::sanitizeFilename(filename);
+    if (!StringUtils::checkFileExtension(currentFilename, ".epub")) {
+      currentFilename += ".epub";
+    }
   }
+  currentBook.lpath = currentFilename.substr(1);
   currentFileSize = length;
   bytesReceived = 0;
+  transferStats = {};
 
   setState(WirelessState::RECEIVING);
   setStatus("Receiving: " + filename);
@@ -597,83 +499,231 @@ void CalibreWirelessActivity::handleSendBook(const std::string& data) {
     sendJsonResponse(OpCode::ERROR, "{\"message\":\"Failed to create file\"}");
     return;
   }
+  // Reserve the whole book up front, so the writes do not have to allocate clusters as they go
+  if (!currentFile.preAllocate(length)) {
+    Serial.printf("[%lu] [CAL] Could not preallocate %zu bytes, writing without\n", millis(), length);
+  }
 
-  // Send OK to start receiving binary data
-  sendJsonResponse(OpCode::OK, "{}");
+  // Start the SD writer before asking for the data; book data that arrived with the command is already in recvRing
+  transferAborted = false;
+  writeFailed = false;
+  writerFinished = false;
+  transferStats.startTime = millis();
+  xTaskCreate(&CalibreWirelessActivity::sdWriterTaskTrampoline, "CalSdWriterTask", 4096, this, 2, &sdWriterTaskHandle);
+
+  // Send OK to start receiving binary data, with the lpath the book is stored under so Calibre uses it from now on
+  JsonDocument reply;
+  reply["lpath"] = currentBook.lpath;
+  std::string replyJson;
+  serializeJson(reply, replyJson);
+  sendJsonResponse(OpCode::OK, replyJson);
 
   // Switch to binary mode
   inBinaryMode = true;
-  binaryBytesRemaining = length;
-
-  // Check if recvBuffer has leftover data (binary file data that arrived with the JSON)
-  if (!recvBuffer.empty()) {
-    size_t toWrite = std::min(recvBuffer.size(), binaryBytesRemaining);
-    size_t written = currentFile.write(reinterpret_cast<const uint8_t*>(recvBuffer.data()), toWrite);
-    bytesReceived += written;
-    binaryBytesRemaining -= written;
-    recvBuffer = recvBuffer.substr(toWrite);
-    updateRequired = true;
-  }
 }
 
-void CalibreWirelessActivity::handleSendBookMetadata(const std::string& data) {
-  // We receive metadata after the book - just acknowledge
-  sendJsonResponse(OpCode::OK, "{}");
+void CalibreWirelessActivity::handleSendBookMetadata() {
+  // Calibre's metadata for a book on the card, e.g. after it was edited in the library. Not acknowledged: Calibre
+  // streams these without waiting.
+  CalibreCatalog::Book book;
+  const std::string lpath = messageReader.get(CalibreMessageReader::Field::Lpath);
+  const bool known = catalog.findByLpath(lpath, book);
+  const CalibreCatalog::Book stored = book;
+  book.lpath = lpath;
+  book.uuid = messageReader.get(CalibreMessageReader::Field::Uuid);
+  book.title = messageReader.get(CalibreMessageReader::Field::Title);
+  book.authors = messageReader.get(CalibreMessageReader::Field::Authors);
+  book.lastModified = messageReader.get(CalibreMessageReader::Field::LastModified);
+  // Calibre sends this for every book on each sync, so unchanged books must not touch the card. Any edit in Calibre
+  // moves last_modified.
+  if (known && book.uuid == stored.uuid && book.lastModified == stored.lastModified) {
+    return;
+  }
+  if (!catalog.put(book)) {
+    Serial.printf("[%lu] [CAL] Metadata for unknown book %s\n", millis(), lpath.c_str());
+  }
 }
 
-void CalibreWirelessActivity::handleDisplayMessage(const std::string& data) {
+void CalibreWirelessActivity::handleDisplayMessage() {
   // Calibre may send messages to display
   // Check messageKind - 1 means password error
-  if (data.find("\"messageKind\":1") != std::string::npos) {
+  if (strcmp(messageReader.get(CalibreMessageReader::Field::MessageKind), "1") == 0) {
     setError("Password required");
   }
   sendJsonResponse(OpCode::OK, "{}");
 }
 
-void CalibreWirelessActivity::handleNoop(const std::string& data) {
+void CalibreWirelessActivity::handleNoop() {
   // Check for ejecting flag
-  if (data.find("\"ejecting\":true") != std::string::npos) {
+  if (strcmp(messageReader.get(CalibreMessageReader::Field::Ejecting), "true") == 0) {
+    catalog.commit();
     setState(WirelessState::DISCONNECTED);
     setStatus("Calibre disconnected");
   }
+
+  // Follow-ups to the book list: "count" announces how many books Calibre wants metadata for and needs no reply,
+  // "priKey" asks for the metadata of one of them
+  if (messageReader.get(CalibreMessageReader::Field::Count)[0] != '\0') {
+    return;
+  }
+  const char* priKey = messageReader.get(CalibreMessageReader::Field::PriKey);
+  if (priKey[0] != '\0') {
+    const size_t index = strtoul(priKey, nullptr, 10);
+    CalibreCatalog::Book book;
+    if (!catalog.readBook(index, book)) {
+      Serial.printf("[%lu] [CAL] Metadata requested for unknown book %zu\n", millis(), index);
+    }
+    sendJsonResponse(OpCode::OK, bookToJson(book, index));
+    return;
+  }
+
   sendJsonResponse(OpCode::NOOP, "{}");
 }
 
+// Network side of a book transfer: keeps the ring filled from the socket while the SD writer task drains it, and
+// returns once the writer is done. Socket data past the end of the book stays in the ring for the message reader.
 void CalibreWirelessActivity::receiveBinaryData() {
-  const int available = tcpClient.available();
-  if (available == 0) {
-    // Check if connection is still alive
-    if (!tcpClient.connected()) {
-      currentFile.close();
-      inBinaryMode = false;
-      setError("Transfer interrupted");
+  bool stalled = false;
+  unsigned long stallStart = 0;
+  while (!writerFinished) {
+    if (recvRing.freeSpace() == 0) {
+      // The SD card is behind: wait for the writer to make room
+      if (!stalled) {
+        stalled = true;
+        stallStart = millis();
+        transferStats.networkStalls++;
+      }
+      ulTaskNotifyTake(pdTRUE, STALL_WAIT_MS / portTICK_PERIOD_MS);
+      continue;
+    }
+    if (stalled) {
+      stalled = false;
+      transferStats.networkStallMs += millis() - stallStart;
+    }
+
+    const size_t filled = recvRing.size();
+    fillRecvRing();
+    if (recvRing.size() != filled) {
+      xTaskNotifyGive(sdWriterTaskHandle);
+    } else if (!tcpClient.connected()) {
+      transferAborted = true;
+      xTaskNotifyGive(sdWriterTaskHandle);
+      ulTaskNotifyTake(pdTRUE, STALL_WAIT_MS / portTICK_PERIOD_MS);
+    } else {
+      vTaskDelay(1);
     }
+  }
+
+  stopSdWriter();
+  inBinaryMode = false;
+  transferStats.durationMs = millis() - transferStats.startTime;
+
+  if (transferAborted || writeFailed) {
+    currentFile.close();
+    setError(writeFailed ? "Failed to write file" : "Transfer interrupted");
     return;
   }
 
-  uint8_t buffer[1024];
-  const size_t toRead = std::min(sizeof(buffer), binaryBytesRemaining);
-  const size_t bytesRead = tcpClient.read(buffer, toRead);
+  // Transfer complete
+  currentFile.flush();
+  currentFile.close();
+  if (!catalog.put(currentBook)) {
+    Serial.printf("[%lu] [CAL] Failed to record %s in the catalogue\n", millis(), currentBook.lpath.c_str());
+  }
+  IndexQueue::add(currentFilename);
+  const std::string stats = formatTransferStats();
+  Serial.printf("[%lu] [CAL] Received %zu bytes in %lu ms: %s, %lu ms waiting for SD, %lu ms for network\n", millis(),
+                bytesReceived, transferStats.durationMs, stats.c_str(), transferStats.networkStallMs,
+                transferStats.writerStallMs);
 
-  if (bytesRead > 0) {
-    currentFile.write(buffer, bytesRead);
-    bytesReceived += bytesRead;
-    binaryBytesRemaining -= bytesRead;
-    updateRequired = true;
+  setState(WirelessState::WAITING);
+  setStatus("Received: " + currentFilename + "\n" + stats + "\nWaiting for more...");
 
-    if (binaryBytesRemaining == 0) {
-      // Transfer complete
-      currentFile.flush();
-      currentFile.close();
-      inBinaryMode = false;
+  // Send OK to acknowledge completion
+  sendJsonResponse(OpCode::OK, "{}");
+}
 
-      setState(WirelessState::WAITING);
-      setStatus("Received: " + currentFilename + "\nWaiting for more...");
+// Drains the ring into the book file until the whole book is written or the transfer is aborted
+void CalibreWirelessActivity::sdWriterTaskLoop() {
+  bool stalled = false;
+  unsigned long stallStart = 0;
+  size_t written = 0;
+  while (written < currentFileSize && !transferAborted) {
+    // Write up to the next block boundary of the file; only the end of the book may be shorter
+    size_t wanted = WRITE_BLOCK_SIZE - written % WRITE_BLOCK_SIZE;
+    if (wanted > currentFileSize - written) {
+      wanted = currentFileSize - written;
+    }
+    if (recvRing.size() < wanted) {
+      // The network is behind: wait for more data
+      if (!stalled) {
+        stalled = true;
+        stallStart = millis();
+        transferStats.writerStalls++;
+      }
+      ulTaskNotifyTake(pdTRUE, STALL_WAIT_MS / portTICK_PERIOD_MS);
+      continue;
+    }
+    if (stalled) {
+      stalled = false;
+      transferStats.writerStallMs += millis() - stallStart;
+    }
 
-      // Send OK to acknowledge completion
-      sendJsonResponse(OpCode::OK, "{}");
+    // Written straight out of the ring; a block that wraps around its end takes two writes
+    size_t length;
+    const uint8_t* data = recvRing.readSpan(&length);
+    if (length > wanted) {
+      length = wanted;
     }
+    const bool ok = currentFile.write(data, length) == length;
+    recvRing.consume(length);
+    xTaskNotifyGive(networkTaskHandle);
+    if (!ok) {
+      Serial.printf("[%lu] [CAL] Write failed at %zu of %zu bytes\n", millis(), written, currentFileSize);
+      writeFailed = true;
+      break;
+    }
+    written += length;
+    bytesReceived = written;
+    renderScheduler.requestUpdate();
+  }
+
+  writerFinished = true;
+  xTaskNotifyGive(networkTaskHandle);
+
+  // Parked until stopSdWriter() deletes it
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+
+// Deletes the SD writer once it is parked. A writer still working on the book is told to stop and waited for first,
+// so it is never deleted in the middle of a write to currentFile.
+void CalibreWirelessActivity::stopSdWriter() {
+  xSemaphoreTake(stateMutex, portMAX_DELAY);
+  if (sdWriterTaskHandle) {
+    if (!writerFinished) {
+      transferAborted = true;
+      xTaskNotifyGive(sdWriterTaskHandle);
+      while (!writerFinished) {
+        vTaskDelay(1);
+      }
+    }
+    vTaskDelete(sdWriterTaskHandle);
+    sdWriterTaskHandle = nullptr;
   }
+  xSemaphoreGive(stateMutex);
+}
+
+// Throughput and how often each side of the pipeline had to wait for the other, short enough for one screen line
+std::string CalibreWirelessActivity::formatTransferStats() const {
+  const unsigned long elapsed =
+      transferStats.durationMs > 0 ? transferStats.durationMs : millis() - transferStats.startTime;
+  const auto kbPerSecond = static_cast<unsigned long>(elapsed > 0 ? bytesReceived * 1000ULL / 1024 / elapsed : 0);
+  char stats[64];
+  snprintf(stats, sizeof(stats), "%lu KB/s, waits: SD %u, net %u", kbPerSecond,
+           static_cast<unsigned>(transferStats.networkStalls), static_cast<unsigned>(transferStats.writerStalls));
+  return stats;
 }
 
 void CalibreWirelessActivity::render() const {
@@ -712,6 +762,7 @@ void CalibreWirelessActivity::render() const {
     constexpr int barX = 50;
     const int barY = statusY + 20;
     ScreenComponents::drawProgressBar(renderer, barX, barY, barWidth, barHeight, bytesReceived, currentFileSize);
+    renderer.drawCenteredText(UI_10_FONT_ID, barY + barHeight + 15, formatTransferStats().c_str());
   }
 
   // Draw error if present
@@ -742,12 +793,12 @@ void CalibreWirelessActivity::setState(WirelessState newState) {
   xSemaphoreTake(stateMutex, portMAX_DELAY);
   state = newState;
   xSemaphoreGive(stateMutex);
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 }
 
 void CalibreWirelessActivity::setStatus(const std::string& message) {
   statusMessage = message;
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 }
 
 void CalibreWirelessActivity::setError(const std::string& message) {
@@ -6,10 +6,14 @@
 #include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#include <atomic>
 #include <functional>
 #include <string>
 
+#include "CalibreCatalog.h"
 #include "activities/Activity.h"
+#include "activities/RenderScheduler.h"
+#include "network/CalibreMessageReader.h"
 
 /**
  * CalibreWirelessActivity implements Calibre's "wireless device" protocol.
@@ -61,11 +65,20 @@ class CalibreWirelessActivity final : public Activity {
     ERROR = 20,
   };
 
-  TaskHandle_t displayTaskHandle = nullptr;
+  // Per-book transfer statistics, shown on the status screen
+  struct TransferStats {
+    unsigned long startTime = 0;
+    unsigned long durationMs = 0;
+    uint32_t networkStalls = 0;  // Times the socket had to wait for the SD writer to free ring space
+    unsigned long networkStallMs = 0;
+    uint32_t writerStalls = 0;  // Times the SD writer had to wait for data from the network
+    unsigned long writerStallMs = 0;
+  };
+
   TaskHandle_t networkTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  TaskHandle_t sdWriterTaskHandle = nullptr;
+  RenderScheduler renderScheduler;
   SemaphoreHandle_t stateMutex = nullptr;
-  bool updateRequired = false;
 
   WirelessState state = WirelessState::DISCOVERING;
   const std::function<void()> onComplete;
@@ -80,42 +93,53 @@ class CalibreWirelessActivity final : public Activity {
   uint16_t calibreAltPort = 0;  // Alternative port (content server)
   std::string calibreHostname;
 
+  // Books on the card as known to Calibre, and the metadata of the one being received
+  CalibreCatalog catalog;
+  CalibreCatalog::Book currentBook;
+
   // Transfer state
   std::string currentFilename;
   size_t currentFileSize = 0;
-  size_t bytesReceived = 0;
+  size_t bytesReceived = 0;  // Bytes written to the SD card
+  TransferStats transferStats;
   std::string statusMessage;
   std::string errorMessage;
 
   // Protocol state
   bool inBinaryMode = false;
-  size_t binaryBytesRemaining = 0;
   FsFile currentFile;
-  std::string recvBuffer;  // Buffer for incoming data (like KOReader)
+  // Book transfer hand-off: the network task fills recvRing, the SD writer task drains it into currentFile
+  std::atomic<bool> transferAborted{false};
+  std::atomic<bool> writeFailed{false};
+  std::atomic<bool> writerFinished{false};
+  CalibreMessageReader::Ring recvRing;  // Socket data not yet consumed by the message reader or the book file
+  CalibreMessageReader messageReader;
 
-  static void displayTaskTrampoline(void* param);
   static void networkTaskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   [[noreturn]] void networkTaskLoop();
+  static void sdWriterTaskTrampoline(void* param);
+  [[noreturn]] void sdWriterTaskLoop();
   void render() const;
 
   // Network operations
   void listenForDiscovery();
   void handleTcpClient();
-  bool readJsonMessage(std::string& message);
+  void fillRecvRing();
   void sendJsonResponse(OpCode opcode, const std::string& data);
-  void handleCommand(OpCode opcode, const std::string& data);
+  void handleCommand(OpCode opcode);
   void receiveBinaryData();
+  void stopSdWriter();
+  std::string formatTransferStats() const;
 
-  // Protocol handlers
-  void handleGetInitializationInfo(const std::string& data);
+  // Protocol handlers, reading the fields of the current message from messageReader
+  void handleGetInitializationInfo();
   void handleGetDeviceInformation();
   void handleFreeSpace();
   void handleGetBookCount();
-  void handleSendBook(const std::string& data);
-  void handleSendBookMetadata(const std::string& data);
-  void handleDisplayMessage(const std::string& data);
-  void handleNoop(const std::string& data);
+  void handleSendBook();
+  void handleSendBookMetadata();
+  void handleDisplayMessage();
+  void handleNoop();
 
   // Utility
   std::string getDeviceUuid() const;
@@ -1,11 +1,8 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
-
 #include <functional>
 
 #include "../Activity.h"
+#include "../RenderScheduler.h"
 
 // Enum for network mode selection
 enum class NetworkMode { JOIN_NETWORK, CREATE_HOTSPOT };
@@ -19,15 +16,11 @@ enum class NetworkMode { JOIN_NETWORK, CREATE_HOTSPOT };
  * The onCancel callback is called if the user presses back.
  */
 class NetworkModeSelectionActivity final : public Activity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderScheduler renderScheduler;
   int selectedIndex = 0;
-  bool updateRequired = false;
   const std::function<void(NetworkMode)> onModeSelected;
   const std::function<void()> onCancel;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
 
  public:
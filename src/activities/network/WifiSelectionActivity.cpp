@@ -10,20 +10,21 @@
 #include "activities/util/KeyboardEntryActivity.h"
 #include "fontIds.h"
 
-void WifiSelectionActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<WifiSelectionActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void WifiSelectionActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
+  // Larger stack for WiFi operations. Don't render while in PASSWORD_ENTRY state - we're just transitioning from the
+  // keyboard subactivity back to the main activity, and attemptConnection() asks for the next render
+  renderScheduler.start("WifiSelectionTask", 4096, [this] {
+    if (!subActivity && state != WifiSelectionState::PASSWORD_ENTRY) {
+      render();
+    }
+  });
 
   // Load saved WiFi credentials - SD card operations need lock as we use SPI for both
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  renderScheduler.lock();
   WIFI_STORE.loadFromFile();
-  xSemaphoreGive(renderingMutex);
+  renderScheduler.unlock();
 
   // Reset state
   selectedNetworkIndex = 0;
@@ -38,14 +39,7 @@ void WifiSelectionActivity::onEnter() {
   forgetPromptSelection = 0;
 
   // Trigger first update to show scanning message
-  updateRequired = true;
-
-  xTaskCreate(&WifiSelectionActivity::taskTrampoline, "WifiSelectionTask",
-              4096,               // Stack size (larger for WiFi operations)
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderScheduler.requestUpdate();
 
   // Start WiFi scan
   startWifiScan();
@@ -64,24 +58,9 @@ void WifiSelectionActivity::onExit() {
   // Note: We do NOT disconnect WiFi here - the parent activity (CrossPointWebServerActivity)
   // manages WiFi connection state. We just clean up the scan and task.
 
-  // Acquire mutex before deleting task to ensure task isn't using it
-  // This prevents hangs/crashes if the task holds the mutex when deleted
-  Serial.printf("[%lu] [WIFI] Acquiring rendering mutex before task deletion...\n", millis());
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-
-  // Delete the display task (we now hold the mutex, so task is blocked if it needs it)
-  Serial.printf("[%lu] [WIFI] Deleting display task...\n", millis());
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-    Serial.printf("[%lu] [WIFI] Display task deleted\n", millis());
-  }
-
-  // Now safe to delete the mutex since we own it
-  Serial.printf("[%lu] [WIFI] Deleting mutex...\n", millis());
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-  Serial.printf("[%lu] [WIFI] Mutex deleted\n", millis());
+  // Wait for a render in progress, then delete the display task
+  Serial.printf("[%lu] [WIFI] Stopping display task...\n", millis());
+  renderScheduler.stop();
 
   Serial.printf("[%lu] [WIFI] [MEM] Free heap at onExit end: %d bytes\n", millis(), ESP.getFreeHeap());
 }
@@ -89,7 +68,7 @@ void WifiSelectionActivity::onExit() {
 void WifiSelectionActivity::startWifiScan() {
   state = WifiSelectionState::SCANNING;
   networks.clear();
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 
   // Set WiFi mode to station
   WiFi.mode(WIFI_STA);
@@ -110,7 +89,7 @@ void WifiSelectionActivity::processWifiScanResults() {
 
   if (scanResult == WIFI_SCAN_FAILED) {
     state = WifiSelectionState::NETWORK_LIST;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     return;
   }
 
@@ -159,7 +138,7 @@ void WifiSelectionActivity::processWifiScanResults() {
   WiFi.scanDelete();
   state = WifiSelectionState::NETWORK_LIST;
   selectedNetworkIndex = 0;
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 }
 
 void WifiSelectionActivity::selectNetwork(const int index) {
@@ -189,7 +168,7 @@ void WifiSelectionActivity::selectNetwork(const int index) {
     // Show password entry
     state = WifiSelectionState::PASSWORD_ENTRY;
     // Don't allow screen updates while changing activity
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    renderScheduler.lock();
     enterNewActivity(new KeyboardEntryActivity(
         renderer, mappedInput, "Enter WiFi Password",
         "",     // No initial text
@@ -202,11 +181,11 @@ void WifiSelectionActivity::selectNetwork(const int index) {
         },
         [this] {
           state = WifiSelectionState::NETWORK_LIST;
-          updateRequired = true;
+          renderScheduler.requestUpdate();
           exitActivity();
         }));
-    updateRequired = true;
-    xSemaphoreGive(renderingMutex);
+    renderScheduler.requestUpdate();
+    renderScheduler.unlock();
   } else {
     // Connect directly for open networks
     attemptConnection();
@@ -218,7 +197,7 @@ void WifiSelectionActivity::attemptConnection() {
   connectionStartTime = millis();
   connectedIP.clear();
   connectionError.clear();
-  updateRequired = true;
+  renderScheduler.requestUpdate();
 
   WiFi.mode(WIFI_STA);
 
@@ -248,7 +227,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
     if (!usedSavedPassword && !enteredPassword.empty()) {
       state = WifiSelectionState::SAVE_PROMPT;
       savePromptSelection = 0;  // Default to "Yes"
-      updateRequired = true;
+      renderScheduler.requestUpdate();
     } else {
       // Using saved password or open network - complete immediately
       Serial.printf("[%lu] [WIFI] Connected with saved/open credentials, completing immediately\n", millis());
@@ -263,7 +242,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
       connectionError = "Network not found";
     }
     state = WifiSelectionState::CONNECTION_FAILED;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     return;
   }
 
@@ -272,7 +251,7 @@ void WifiSelectionActivity::checkConnectionStatus() {
     WiFi.disconnect();
     connectionError = "Connection timeout";
     state = WifiSelectionState::CONNECTION_FAILED;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     return;
   }
 }
@@ -307,20 +286,20 @@ void WifiSelectionActivity::loop() {
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       if (savePromptSelection > 0) {
         savePromptSelection--;
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       if (savePromptSelection < 1) {
         savePromptSelection++;
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
       if (savePromptSelection == 0) {
         // User chose "Yes" - save the password
-        xSemaphoreTake(renderingMutex, portMAX_DELAY);
+        renderScheduler.lock();
         WIFI_STORE.addCredential(selectedSSID, enteredPassword);
-        xSemaphoreGive(renderingMutex);
+        renderScheduler.unlock();
       }
       // Complete - parent will start web server
       onComplete(true);
@@ -337,20 +316,20 @@ void WifiSelectionActivity::loop() {
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       if (forgetPromptSelection > 0) {
         forgetPromptSelection--;
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       if (forgetPromptSelection < 1) {
         forgetPromptSelection++;
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
       if (forgetPromptSelection == 0) {
         // User chose "Yes" - forget the network
-        xSemaphoreTake(renderingMutex, portMAX_DELAY);
+        renderScheduler.lock();
         WIFI_STORE.removeCredential(selectedSSID);
-        xSemaphoreGive(renderingMutex);
+        renderScheduler.unlock();
         // Update the network list to reflect the change
         const auto network = find_if(networks.begin(), networks.end(),
                                      [this](const WifiNetworkInfo& net) { return net.ssid == selectedSSID; });
@@ -360,11 +339,11 @@ void WifiSelectionActivity::loop() {
       }
       // Go back to network list
       state = WifiSelectionState::NETWORK_LIST;
-      updateRequired = true;
+      renderScheduler.requestUpdate();
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Back)) {
       // Skip forgetting, go back to network list
       state = WifiSelectionState::NETWORK_LIST;
-      updateRequired = true;
+      renderScheduler.requestUpdate();
     }
     return;
   }
@@ -388,7 +367,7 @@ void WifiSelectionActivity::loop() {
         // Go back to network list on failure
         state = WifiSelectionState::NETWORK_LIST;
       }
-      updateRequired = true;
+      renderScheduler.requestUpdate();
       return;
     }
   }
@@ -416,13 +395,13 @@ void WifiSelectionActivity::loop() {
         mappedInput.wasPressed(MappedInputManager::Button::Left)) {
       if (selectedNetworkIndex > 0) {
         selectedNetworkIndex--;
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       }
     } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
                mappedInput.wasPressed(MappedInputManager::Button::Right)) {
       if (!networks.empty() && selectedNetworkIndex < static_cast<int>(networks.size()) - 1) {
         selectedNetworkIndex++;
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       }
     }
   }
@@ -445,31 +424,6 @@ std::string WifiSelectionActivity::getSignalStrengthIndicator(const int32_t rssi
   return "    ";  // Very weak
 }
 
-void WifiSelectionActivity::displayTaskLoop() {
-  while (true) {
-    // If a subactivity is active, yield CPU time but don't render
-    if (subActivity) {
-      vTaskDelay(10 / portTICK_PERIOD_MS);
-      continue;
-    }
-
-    // Don't render if we're in PASSWORD_ENTRY state - we're just transitioning
-    // from the keyboard subactivity back to the main activity
-    if (state == WifiSelectionState::PASSWORD_ENTRY) {
-      vTaskDelay(10 / portTICK_PERIOD_MS);
-      continue;
-    }
-
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void WifiSelectionActivity::render() const {
   renderer.clearScreen();
 
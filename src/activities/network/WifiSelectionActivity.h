@@ -1,8 +1,4 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
-
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -10,6 +6,7 @@
 #include <vector>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/RenderScheduler.h"
 
 // Structure to hold WiFi network information
 struct WifiNetworkInfo {
@@ -43,9 +40,7 @@ enum class WifiSelectionState {
  * The onComplete callback receives true if connected successfully, false if cancelled.
  */
 class WifiSelectionActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderScheduler renderScheduler;
   WifiSelectionState state = WifiSelectionState::SCANNING;
   int selectedNetworkIndex = 0;
   std::vector<WifiNetworkInfo> networks;
@@ -73,8 +68,6 @@ class WifiSelectionActivity final : public ActivityWithSubactivity {
   static constexpr unsigned long CONNECTION_TIMEOUT_MS = 15000;
   unsigned long connectionStartTime = 0;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   void renderNetworkList() const;
   void renderPasswordEntry() const;
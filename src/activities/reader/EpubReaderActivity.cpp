@@ -5,10 +5,13 @@
 #include <GfxRenderer.h>
 #include <SDCardManager.h>
 
+#include "BookCard.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "EpubReaderChapterSelectionActivity.h"
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
+#include "ResumeSnapshot.h"
 #include "ScreenComponents.h"
 #include "fontIds.h"
 
@@ -19,9 +22,34 @@ constexpr unsigned long goHomeMs = 1000;
 constexpr int statusBarMargin = 19;
 }  // namespace
 
-void EpubReaderActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<EpubReaderActivity*>(param);
-  self->displayTaskLoop();
+GfxRenderer::Orientation EpubReaderActivity::getOrientation() {
+  switch (SETTINGS.orientation) {
+    case CrossPointSettings::ORIENTATION::LANDSCAPE_CW:
+      return GfxRenderer::Orientation::LandscapeClockwise;
+    case CrossPointSettings::ORIENTATION::INVERTED:
+      return GfxRenderer::Orientation::PortraitInverted;
+    case CrossPointSettings::ORIENTATION::LANDSCAPE_CCW:
+      return GfxRenderer::Orientation::LandscapeCounterClockwise;
+    case CrossPointSettings::ORIENTATION::PORTRAIT:
+    default:
+      return GfxRenderer::Orientation::Portrait;
+  }
+}
+
+void EpubReaderActivity::applyOrientation(GfxRenderer& renderer) { renderer.setOrientation(getOrientation()); }
+
+void EpubReaderActivity::getPageMargins(const GfxRenderer::Orientation orientation, int* top, int* right,
+                                        int* bottom, int* left) {
+  // Apply screen viewable areas and additional padding
+  GfxRenderer::getOrientedViewableTRBL(orientation, top, right, bottom, left);
+  *top += SETTINGS.screenMargin;
+  *left += SETTINGS.screenMargin;
+  *right += SETTINGS.screenMargin;
+  *bottom += statusBarMargin;
+}
+
+void EpubReaderActivity::getPageMargins(const GfxRenderer& renderer, int* top, int* right, int* bottom, int* left) {
+  getPageMargins(renderer.getOrientation(), top, right, bottom, left);
 }
 
 void EpubReaderActivity::onEnter() {
@@ -32,29 +60,19 @@ void EpubReaderActivity::onEnter() {
   }
 
   // Configure screen orientation based on settings
-  switch (SETTINGS.orientation) {
-    case CrossPointSettings::ORIENTATION::PORTRAIT:
-      renderer.setOrientation(GfxRenderer::Orientation::Portrait);
-      break;
-    case CrossPointSettings::ORIENTATION::LANDSCAPE_CW:
-      renderer.setOrientation(GfxRenderer::Orientation::LandscapeClockwise);
-      break;
-    case CrossPointSettings::ORIENTATION::INVERTED:
-      renderer.setOrientation(GfxRenderer::Orientation::PortraitInverted);
-      break;
-    case CrossPointSettings::ORIENTATION::LANDSCAPE_CCW:
-      renderer.setOrientation(GfxRenderer::Orientation::LandscapeCounterClockwise);
-      break;
-    default:
-      break;
-  }
-
-  renderingMutex = xSemaphoreCreateMutex();
+  applyOrientation(renderer);
 
   epub->setupCacheDir();
 
+  uint16_t savedSpineIndex;
+  uint32_t savedPage;
   FsFile f;
-  if (SdMan.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
+  if (progressJournal.open(epub->getCachePath() + "/progress.log", &savedSpineIndex, &savedPage)) {
+    currentSpineIndex = savedSpineIndex;
+    nextPageNumber = static_cast<int>(savedPage);
+    Serial.printf("[%lu] [ERS] Loaded progress: %d, %d\n", millis(), currentSpineIndex, nextPageNumber);
+  } else if (SdMan.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
+    // Progress saved before the journal existed
     uint8_t data[4];
     if (f.read(data, 4) == 4) {
       currentSpineIndex = data[0] + (data[1] << 8);
@@ -78,15 +96,15 @@ void EpubReaderActivity::onEnter() {
   APP_STATE.openEpubPath = epub->getPath();
   APP_STATE.saveToFile();
 
+  // The page is already on screen from the resume snapshot, a fast refresh is enough to add anti-aliasing
+  if (ResumeSnapshot::takeRestored(epub->getPath())) {
+    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
+  }
+
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&EpubReaderActivity::taskTrampoline, "EpubReaderActivityTask",
-              8192,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderScheduler.requestUpdate();
+
+  renderScheduler.start("EpubReaderActivityTask", 8192, [this] { renderScreen(); });
 }
 
 void EpubReaderActivity::onExit() {
@@ -95,14 +113,14 @@ void EpubReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
+  renderScheduler.stop();
+
+  if (epub) {
+    saveProgress();
+    const float sectionProgress =
+        section && section->pageCount > 0 ? static_cast<float>(section->currentPage) / section->pageCount : 0;
+    LibraryIndex::recordProgress(epub->getPath(), epub->calculateProgress(currentSpineIndex, sectionProgress));
   }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
   section.reset();
   epub.reset();
 }
@@ -114,16 +132,23 @@ void EpubReaderActivity::loop() {
     return;
   }
 
+  // Write the position once page turns have settled
+  if (progressJournal.isFlushDue()) {
+    renderScheduler.lock();
+    saveProgress();
+    renderScheduler.unlock();
+  }
+
   // Enter chapter selection activity
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     // Don't start activity transition while rendering
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    renderScheduler.lock();
     exitActivity();
     enterNewActivity(new EpubReaderChapterSelectionActivity(
         this->renderer, this->mappedInput, epub, currentSpineIndex,
         [this] {
           exitActivity();
-          updateRequired = true;
+          renderScheduler.requestUpdate();
         },
         [this](const int newSpineIndex) {
           if (currentSpineIndex != newSpineIndex) {
@@ -132,9 +157,9 @@ void EpubReaderActivity::loop() {
             section.reset();
           }
           exitActivity();
-          updateRequired = true;
+          renderScheduler.requestUpdate();
         }));
-    xSemaphoreGive(renderingMutex);
+    renderScheduler.unlock();
   }
 
   // Long press BACK (1s+) goes directly to home
@@ -164,7 +189,7 @@ void EpubReaderActivity::loop() {
   if (currentSpineIndex > 0 && currentSpineIndex >= epub->getSpineItemsCount()) {
     currentSpineIndex = epub->getSpineItemsCount() - 1;
     nextPageNumber = UINT16_MAX;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     return;
   }
 
@@ -172,18 +197,18 @@ void EpubReaderActivity::loop() {
 
   if (skipChapter) {
     // We don't want to delete the section mid-render, so grab the semaphore
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    renderScheduler.lock();
     nextPageNumber = 0;
     currentSpineIndex = nextReleased ? currentSpineIndex + 1 : currentSpineIndex - 1;
     section.reset();
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
+    renderScheduler.unlock();
+    renderScheduler.requestUpdate();
     return;
   }
 
   // No current section, attempt to rerender the book
   if (!section) {
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     return;
   }
 
@@ -192,37 +217,25 @@ void EpubReaderActivity::loop() {
       section->currentPage--;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      renderScheduler.lock();
       nextPageNumber = UINT16_MAX;
       currentSpineIndex--;
       section.reset();
-      xSemaphoreGive(renderingMutex);
+      renderScheduler.unlock();
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   } else {
     if (section->currentPage < section->pageCount - 1) {
       section->currentPage++;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      renderScheduler.lock();
       nextPageNumber = 0;
       currentSpineIndex++;
       section.reset();
-      xSemaphoreGive(renderingMutex);
-    }
-    updateRequired = true;
-  }
-}
-
-void EpubReaderActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
+      renderScheduler.unlock();
     }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderScheduler.requestUpdate();
   }
 }
 
@@ -249,14 +262,8 @@ void EpubReaderActivity::renderScreen() {
     return;
   }
 
-  // Apply screen viewable areas and additional padding
   int orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft;
-  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
-                                   &orientedMarginLeft);
-  orientedMarginTop += SETTINGS.screenMargin;
-  orientedMarginLeft += SETTINGS.screenMargin;
-  orientedMarginRight += SETTINGS.screenMargin;
-  orientedMarginBottom += statusBarMargin;
+  getPageMargins(renderer, &orientedMarginTop, &orientedMarginRight, &orientedMarginBottom, &orientedMarginLeft);
 
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
@@ -360,16 +367,21 @@ void EpubReaderActivity::renderScreen() {
     Serial.printf("[%lu] [ERS] Rendered page in %dms\n", millis(), millis() - start);
   }
 
-  FsFile f;
-  if (SdMan.openFileForWrite("ERS", epub->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    data[0] = currentSpineIndex & 0xFF;
-    data[1] = (currentSpineIndex >> 8) & 0xFF;
-    data[2] = section->currentPage & 0xFF;
-    data[3] = (section->currentPage >> 8) & 0xFF;
-    f.write(data, 4);
-    f.close();
+  progressJournal.update(currentSpineIndex, section->currentPage);
+}
+
+// Writes the pending position to the journal, along with the home screen summary
+void EpubReaderActivity::saveProgress() {
+  if (!progressJournal.flush()) {
+    return;
   }
+
+  const int tocIndex = epub->getTocIndexForSpineIndex(currentSpineIndex);
+  const float sectionProgress =
+      section && section->pageCount > 0 ? static_cast<float>(section->currentPage) / section->pageCount : 0;
+  BookCard::save(epub->getPath(), epub->getTitle(), epub->getAuthor(),
+                 tocIndex == -1 ? "" : epub->getTocItem(tocIndex).title,
+                 epub->calculateProgress(currentSpineIndex, sectionProgress));
 }
 
 void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
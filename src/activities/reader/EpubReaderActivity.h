@@ -1,30 +1,28 @@
 #pragma once
 #include <Epub.h>
 #include <Epub/Section.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
+#include <GfxRenderer.h>
 
+#include "ProgressJournal.h"
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/RenderScheduler.h"
 
 class EpubReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderScheduler renderScheduler;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
   int pagesUntilFullRefresh = 0;
-  bool updateRequired = false;
+  ProgressJournal progressJournal;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
+  void saveProgress();
 
  public:
   explicit EpubReaderActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::unique_ptr<Epub> epub,
@@ -35,5 +33,13 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
         onGoHome(onGoHome) {}
   void onEnter() override;
   void onExit() override;
+  bool canSnapshotScreen() const override { return !subActivity && section; }
   void loop() override;
+
+  // Reader layout, shared with IndexQueue so sections built ahead of time match what the reader looks for
+  static GfxRenderer::Orientation getOrientation();
+  static void applyOrientation(GfxRenderer& renderer);
+  // Margins around the page text in the given orientation, status bar included
+  static void getPageMargins(GfxRenderer::Orientation orientation, int* top, int* right, int* bottom, int* left);
+  static void getPageMargins(const GfxRenderer& renderer, int* top, int* right, int* bottom, int* left);
 };
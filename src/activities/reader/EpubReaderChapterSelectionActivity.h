@@ -1,20 +1,16 @@
 #pragma once
 #include <Epub.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
 #include <memory>
 
 #include "../Activity.h"
+#include "../RenderScheduler.h"
 
 class EpubReaderChapterSelectionActivity final : public Activity {
   std::shared_ptr<Epub> epub;
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderScheduler renderScheduler;
   int currentSpineIndex = 0;
   int selectorIndex = 0;
-  bool updateRequired = false;
   const std::function<void()> onGoBack;
   const std::function<void(int newSpineIndex)> onSelectSpineIndex;
 
@@ -22,8 +18,6 @@ class EpubReaderChapterSelectionActivity final : public Activity {
   // This adapts automatically when switching between portrait and landscape.
   int getPageItems() const;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void renderScreen();
 
  public:
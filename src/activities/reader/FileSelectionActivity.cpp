@@ -3,6 +3,11 @@
 #include <GfxRenderer.h>
 #include <SDCardManager.h>
 
+#include <algorithm>
+
+#include "CacheManager.h"
+#include "CrossPointSettings.h"
+#include "IndexQueue.h"
 #include "MappedInputManager.h"
 #include "fontIds.h"
 #include "util/StringUtils.h"
@@ -11,89 +16,67 @@ namespace {
 constexpr int PAGE_ITEMS = 23;
 constexpr int SKIP_PAGE_MS = 700;
 constexpr unsigned long GO_HOME_MS = 1000;
-}  // namespace
-
-void sortFileList(std::vector<std::string>& strs) {
-  std::sort(begin(strs), end(strs), [](const std::string& str1, const std::string& str2) {
-    if (str1.back() == '/' && str2.back() != '/') return true;
-    if (str1.back() != '/' && str2.back() == '/') return false;
-    return lexicographical_compare(
-        begin(str1), end(str1), begin(str2), end(str2),
-        [](const char& char1, const char& char2) { return tolower(char1) < tolower(char2); });
-  });
-}
-
-void FileSelectionActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<FileSelectionActivity*>(param);
-  self->displayTaskLoop();
-}
-
-void FileSelectionActivity::loadFiles() {
-  files.clear();
-
-  auto root = SdMan.open(basepath.c_str());
-  if (!root || !root.isDirectory()) {
-    if (root) root.close();
-    return;
-  }
-
-  root.rewindDirectory();
 
-  char name[500];
-  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
-    file.getName(name, sizeof(name));
-    if (name[0] == '.' || strcmp(name, "System Volume Information") == 0) {
-      file.close();
-      continue;
-    }
+// Grid view: 3x3 cover thumbnails with a name below each
+constexpr int GRID_COLUMNS = 3;
+constexpr int GRID_ROWS = 3;
+constexpr int GRID_ITEMS = GRID_COLUMNS * GRID_ROWS;
+constexpr int GRID_TOP = 50;
+constexpr int GRID_LABEL_HEIGHT = 26;
+constexpr int GRID_ROW_HEIGHT = ThumbnailStore::TILE_HEIGHT + GRID_LABEL_HEIGHT + 8;
+}  // namespace
 
-    if (file.isDirectory()) {
-      files.emplace_back(std::string(name) + "/");
-    } else {
-      auto filename = std::string(name);
-      if (StringUtils::checkFileExtension(filename, ".epub") || StringUtils::checkFileExtension(filename, ".xtch") ||
-          StringUtils::checkFileExtension(filename, ".xtc")) {
-        files.emplace_back(filename);
-      }
-    }
-    file.close();
+void FileSelectionActivity::openDirectory() {
+  pageEntries.clear();
+  loadedPageStart = SIZE_MAX;
+  pendingThumbnails.clear();
+  unpreparedBooks.clear();
+  metadataPending = true;
+
+  // Show the stored index right away and check it against the directory once the page is up
+  syncRequired = library.open(basepath);
+  if (!syncRequired) {
+    library.sync();
   }
-  root.close();
-  sortFileList(files);
 }
 
 void FileSelectionActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
+  gridView = SETTINGS.libraryView == CrossPointSettings::LIBRARY_VIEW::GRID;
+  if (gridView) {
+    tileBuffer = static_cast<uint8_t*>(malloc(ThumbnailStore::TILE_SIZE));
+    if (!tileBuffer || !thumbnails.open()) {
+      Serial.printf("[%lu] [FSA] Thumbnail store unavailable, falling back to list view\n", millis());
+      free(tileBuffer);
+      tileBuffer = nullptr;
+      gridView = false;
+    }
+  }
 
   // basepath is set via constructor parameter (defaults to "/" if not specified)
-  loadFiles();
+  openDirectory();
   selectorIndex = 0;
 
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&FileSelectionActivity::taskTrampoline, "FileSelectionActivityTask",
-              2048,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderScheduler.requestUpdate();
+
+  // Stack size: reading book metadata and covers parses the books
+  renderScheduler.start("FileSelectionActivityTask", 8192, [this] { render(); }, [this] { return runIdleWork(); });
 }
 
 void FileSelectionActivity::onExit() {
   Activity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
-  files.clear();
+  renderScheduler.stop();
+  library.close();
+  pageEntries.clear();
+
+  thumbnails.close();
+  free(tileBuffer);
+  tileBuffer = nullptr;
+  pendingThumbnails.clear();
+  unpreparedBooks.clear();
 }
 
 void FileSelectionActivity::loop() {
@@ -101,8 +84,11 @@ void FileSelectionActivity::loop() {
   if (mappedInput.isPressed(MappedInputManager::Button::Back) && mappedInput.getHeldTime() >= GO_HOME_MS) {
     if (basepath != "/") {
       basepath = "/";
-      loadFiles();
-      updateRequired = true;
+      renderScheduler.lock();
+      openDirectory();
+      renderScheduler.unlock();
+      selectorIndex = 0;
+      renderScheduler.requestUpdate();
     }
     return;
   }
@@ -113,20 +99,33 @@ void FileSelectionActivity::loop() {
                             mappedInput.wasReleased(MappedInputManager::Button::Right);
 
   const bool skipPage = mappedInput.getHeldTime() > SKIP_PAGE_MS;
+  const size_t pageItems = getPageItems();
+  const size_t fileCount = library.getCount();
 
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-    if (files.empty()) {
+    if (fileCount == 0) {
+      return;
+    }
+
+    // The display task may be reading the SD card
+    renderScheduler.lock();
+    LibraryIndex::Entry entry;
+    const bool found = library.readEntry(selectorIndex, entry);
+    renderScheduler.unlock();
+    if (!found) {
       return;
     }
 
     if (basepath.back() != '/') basepath += "/";
-    if (files[selectorIndex].back() == '/') {
-      basepath += files[selectorIndex].substr(0, files[selectorIndex].length() - 1);
-      loadFiles();
+    if (entry.format == LibraryIndex::Format::Directory) {
+      basepath += entry.name.substr(0, entry.name.length() - 1);
+      renderScheduler.lock();
+      openDirectory();
+      renderScheduler.unlock();
       selectorIndex = 0;
-      updateRequired = true;
+      renderScheduler.requestUpdate();
     } else {
-      onSelect(basepath + files[selectorIndex]);
+      onSelect(basepath + entry.name);
     }
   } else if (mappedInput.wasReleased(MappedInputManager::Button::Back)) {
     // Short press: go up one directory, or go home if at root
@@ -136,74 +135,229 @@ void FileSelectionActivity::loop() {
 
         basepath.replace(basepath.find_last_of('/'), std::string::npos, "");
         if (basepath.empty()) basepath = "/";
-        loadFiles();
 
         const auto pos = oldPath.find_last_of('/');
         const std::string dirName = oldPath.substr(pos + 1) + "/";
-        selectorIndex = findEntry(dirName);
+        renderScheduler.lock();
+        openDirectory();
+        selectorIndex = library.findEntry(dirName);
+        renderScheduler.unlock();
 
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       } else {
         onGoHome();
       }
     }
+  } else if (fileCount == 0) {
+    return;
   } else if (prevReleased) {
     if (skipPage) {
-      selectorIndex = ((selectorIndex / PAGE_ITEMS - 1) * PAGE_ITEMS + files.size()) % files.size();
+      selectorIndex = ((selectorIndex / pageItems - 1) * pageItems + fileCount) % fileCount;
     } else {
-      selectorIndex = (selectorIndex + files.size() - 1) % files.size();
+      selectorIndex = (selectorIndex + fileCount - 1) % fileCount;
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   } else if (nextReleased) {
     if (skipPage) {
-      selectorIndex = ((selectorIndex / PAGE_ITEMS + 1) * PAGE_ITEMS) % files.size();
+      selectorIndex = ((selectorIndex / pageItems + 1) * pageItems) % fileCount;
     } else {
-      selectorIndex = (selectorIndex + 1) % files.size();
+      selectorIndex = (selectorIndex + 1) % fileCount;
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 }
 
-void FileSelectionActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
+size_t FileSelectionActivity::getPageItems() const { return gridView ? GRID_ITEMS : PAGE_ITEMS; }
+
+// Runs one step of background work between renders, returns whether there is more to do
+bool FileSelectionActivity::runIdleWork() {
+  if (syncRequired) {
+    syncRequired = false;
+    if (library.sync()) {
+      if (selectorIndex >= library.getCount()) {
+        selectorIndex = 0;
+      }
+      loadedPageStart = SIZE_MAX;
+      renderScheduler.requestUpdate();
+    }
+  } else if (!pendingThumbnails.empty()) {
+    // Fill in missing thumbnails one at a time, so input is handled between them
+    generateNextThumbnail();
+  } else if (metadataPending) {
+    const int updated = library.updateNextMetadata();
+    if (updated == -1) {
+      metadataPending = false;
+    } else if (updated >= 0 && static_cast<size_t>(updated) / getPageItems() == selectorIndex / getPageItems()) {
+      loadedPageStart = SIZE_MAX;
+      renderScheduler.requestUpdate();
     }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+  } else if (indexingPending) {
+    indexingPending = IndexQueue::runStep(renderer, [this] { return renderScheduler.shouldYield(); });
+    if (!indexingPending && !unpreparedBooks.empty()) {
+      // Their spine/TOC caches are there now, so the next paint can generate their thumbnails
+      unpreparedBooks.clear();
+      renderScheduler.requestUpdate();
+    }
+  } else if (cleanupPending) {
+    cleanupPending = CacheManager::runStep();
   }
+  return syncRequired || !pendingThumbnails.empty() || metadataPending || indexingPending || cleanupPending;
 }
 
-void FileSelectionActivity::render() const {
+void FileSelectionActivity::render() {
   renderer.clearScreen();
 
-  const auto pageWidth = renderer.getScreenWidth();
   renderer.drawCenteredText(UI_12_FONT_ID, 15, "Books", true, EpdFontFamily::BOLD);
 
   // Help text
   const auto labels = mappedInput.mapLabels("« Home", "Open", "", "");
   renderer.drawButtonHints(UI_10_FONT_ID, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 
-  if (files.empty()) {
+  if (library.getCount() == 0) {
+    pendingThumbnails.clear();
     renderer.drawText(UI_10_FONT_ID, 20, 60, "No books found");
     renderer.displayBuffer();
     return;
   }
 
+  const size_t pageStartIndex = selectorIndex / getPageItems() * getPageItems();
+  if (pageStartIndex != loadedPageStart) {
+    library.readPage(pageStartIndex, getPageItems(), pageEntries);
+    loadedPageStart = pageStartIndex;
+  }
+
+  if (gridView) {
+    renderGrid();
+  } else {
+    renderList();
+  }
+}
+
+void FileSelectionActivity::renderList() const {
+  const auto pageWidth = renderer.getScreenWidth();
   const auto pageStartIndex = selectorIndex / PAGE_ITEMS * PAGE_ITEMS;
   renderer.fillRect(0, 60 + (selectorIndex % PAGE_ITEMS) * 30 - 2, pageWidth - 1, 30);
-  for (size_t i = pageStartIndex; i < files.size() && i < pageStartIndex + PAGE_ITEMS; i++) {
-    auto item = renderer.truncatedText(UI_10_FONT_ID, files[i].c_str(), renderer.getScreenWidth() - 40);
-    renderer.drawText(UI_10_FONT_ID, 20, 60 + (i % PAGE_ITEMS) * 30, item.c_str(), i != selectorIndex);
+  for (size_t i = 0; i < pageEntries.size(); i++) {
+    const auto& entry = pageEntries[i];
+    const bool selected = pageStartIndex + i == selectorIndex;
+
+    int progressWidth = 0;
+    if (entry.progress != LibraryIndex::NO_PROGRESS) {
+      const std::string progress = std::to_string(entry.progress) + "%";
+      progressWidth = renderer.getTextWidth(SMALL_FONT_ID, progress.c_str()) + 10;
+      renderer.drawText(SMALL_FONT_ID, pageWidth - 10 - progressWidth, 62 + i * 30, progress.c_str(), !selected);
+    }
+
+    auto item = renderer.truncatedText(UI_10_FONT_ID, getEntryLabel(entry, true).c_str(),
+                                       pageWidth - 40 - progressWidth);
+    renderer.drawText(UI_10_FONT_ID, 20, 60 + i * 30, item.c_str(), !selected);
   }
 
   renderer.displayBuffer();
 }
 
-size_t FileSelectionActivity::findEntry(const std::string& name) const {
-  for (size_t i = 0; i < files.size(); i++)
-    if (files[i] == name) return i;
-  return 0;
+void FileSelectionActivity::renderGrid() {
+  const unsigned long start = millis();
+  const auto pageStartIndex = selectorIndex / GRID_ITEMS * GRID_ITEMS;
+  const int gap = (renderer.getScreenWidth() - GRID_COLUMNS * ThumbnailStore::TILE_WIDTH) / (GRID_COLUMNS + 1);
+
+  for (size_t i = pageStartIndex; i < pageStartIndex + pageEntries.size(); i++) {
+    const int cellX = gap + static_cast<int>(i % GRID_COLUMNS) * (ThumbnailStore::TILE_WIDTH + gap);
+    const int cellY = GRID_TOP + static_cast<int>((i % GRID_ITEMS) / GRID_COLUMNS) * GRID_ROW_HEIGHT;
+
+    if (i == selectorIndex) {
+      renderer.drawRect(cellX - 4, cellY - 4, ThumbnailStore::TILE_WIDTH + 8, ThumbnailStore::TILE_HEIGHT + 8);
+      renderer.drawRect(cellX - 3, cellY - 3, ThumbnailStore::TILE_WIDTH + 6, ThumbnailStore::TILE_HEIGHT + 6);
+    }
+
+    const std::string name = getEntryLabel(pageEntries[i - pageStartIndex], false);
+    const auto label = renderer.truncatedText(UI_10_FONT_ID, name.c_str(), ThumbnailStore::TILE_WIDTH + gap - 4);
+    const int labelX = cellX + (ThumbnailStore::TILE_WIDTH - renderer.getTextWidth(UI_10_FONT_ID, label.c_str())) / 2;
+    renderer.drawText(UI_10_FONT_ID, labelX, cellY + ThumbnailStore::TILE_HEIGHT + 6, label.c_str());
+  }
+
+  pendingThumbnails.clear();
+  drawGridThumbnails(pageStartIndex, true);
+  renderer.displayBuffer();
+  Serial.printf("[%lu] [FSA] Grid page painted in %lu ms, %d thumbnails pending\n", millis(), millis() - start,
+                static_cast<int>(pendingThumbnails.size()));
+
+  // Thumbnails are 2bpp, add the gray levels once the page is complete
+  if (!pendingThumbnails.empty()) {
+    return;
+  }
+  renderer.storeBwBuffer();
+
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  drawGridThumbnails(pageStartIndex, false);
+  renderer.copyGrayscaleLsbBuffers();
+
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  drawGridThumbnails(pageStartIndex, false);
+  renderer.copyGrayscaleMsbBuffers();
+
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
+  renderer.restoreBwBuffer();
+}
+
+// Draws the page's cached thumbnails in the current render mode, and placeholders for books without one
+void FileSelectionActivity::drawGridThumbnails(const size_t pageStartIndex, const bool collectPending) {
+  const int gap = (renderer.getScreenWidth() - GRID_COLUMNS * ThumbnailStore::TILE_WIDTH) / (GRID_COLUMNS + 1);
+  const std::string dirPath = basepath.back() == '/' ? basepath : basepath + "/";
+
+  for (size_t i = pageStartIndex; i < pageStartIndex + pageEntries.size(); i++) {
+    const int cellX = gap + static_cast<int>(i % GRID_COLUMNS) * (ThumbnailStore::TILE_WIDTH + gap);
+    const int cellY = GRID_TOP + static_cast<int>((i % GRID_ITEMS) / GRID_COLUMNS) * GRID_ROW_HEIGHT;
+
+    const auto& entry = pageEntries[i - pageStartIndex];
+    const bool isDirectory = entry.format == LibraryIndex::Format::Directory;
+    const auto lookup =
+        isDirectory ? ThumbnailStore::Lookup::NoCover : thumbnails.find(dirPath + entry.name, tileBuffer);
+    if (lookup == ThumbnailStore::Lookup::Found) {
+      renderer.draw2BitImage(tileBuffer, cellX, cellY, ThumbnailStore::TILE_WIDTH, ThumbnailStore::TILE_HEIGHT);
+      continue;
+    }
+
+    if (!collectPending) {
+      continue;
+    }
+    if (lookup == ThumbnailStore::Lookup::Missing &&
+        std::find(unpreparedBooks.begin(), unpreparedBooks.end(), dirPath + entry.name) == unpreparedBooks.end()) {
+      pendingThumbnails.push_back(dirPath + entry.name);
+    }
+    renderer.drawRect(cellX, cellY, ThumbnailStore::TILE_WIDTH, ThumbnailStore::TILE_HEIGHT);
+    const char* placeholder = isDirectory ? "Folder" : lookup == ThumbnailStore::Lookup::Missing ? "..." : "No cover";
+    const int textX = cellX + (ThumbnailStore::TILE_WIDTH - renderer.getTextWidth(UI_10_FONT_ID, placeholder)) / 2;
+    renderer.drawText(UI_10_FONT_ID, textX, cellY + ThumbnailStore::TILE_HEIGHT / 2 - 10, placeholder);
+  }
+}
+
+void FileSelectionActivity::generateNextThumbnail() {
+  const std::string bookPath = pendingThumbnails.front();
+  pendingThumbnails.erase(pendingThumbnails.begin());
+  if (thumbnails.generate(bookPath, tileBuffer) == ThumbnailStore::Lookup::Missing) {
+    // Not prepared yet, have the IndexQueue build its spine/TOC cache rather than doing it here
+    unpreparedBooks.push_back(bookPath);
+    IndexQueue::add(bookPath);
+    indexingPending = true;
+  }
+
+  // Repaint once the whole page is available, or every few thumbnails while a cold page fills in
+  if (pendingThumbnails.empty() || pendingThumbnails.size() % 3 == 0) {
+    renderScheduler.requestUpdate();
+  }
+}
+
+// The book's title once its metadata has been read, its file name until then
+std::string FileSelectionActivity::getEntryLabel(const LibraryIndex::Entry& entry, const bool withAuthor) {
+  if (entry.title.empty()) {
+    return entry.name;
+  }
+  if (withAuthor && !entry.author.empty()) {
+    return entry.title + " - " + entry.author;
+  }
+  return entry.title;
 }
@@ -1,30 +1,43 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
-
 #include <functional>
 #include <string>
 #include <vector>
 
 #include "../Activity.h"
+#include "../RenderScheduler.h"
+#include "LibraryIndex.h"
+#include "ThumbnailStore.h"
 
 class FileSelectionActivity final : public Activity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderScheduler renderScheduler;
   std::string basepath = "/";
-  std::vector<std::string> files;
+  LibraryIndex library;
+  std::vector<LibraryIndex::Entry> pageEntries;  // Entries of the page that was last rendered
+  size_t loadedPageStart = SIZE_MAX;
   size_t selectorIndex = 0;
-  bool updateRequired = false;
+  bool syncRequired = false;
+  bool metadataPending = false;
+  bool indexingPending = true;  // Books in the IndexQueue, worked on once the directory itself is done
+  bool cleanupPending = true;   // Steps of the CacheManager pass, run last
   const std::function<void(const std::string&)> onSelect;
   const std::function<void()> onGoHome;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
-  void render() const;
-  void loadFiles();
+  // Grid view
+  bool gridView = false;
+  ThumbnailStore thumbnails;
+  uint8_t* tileBuffer = nullptr;               // One thumbnail tile, the only per-page thumbnail memory
+  std::vector<std::string> pendingThumbnails;  // Books on the current page that still need a thumbnail
+  std::vector<std::string> unpreparedBooks;    // EPUBs that get their thumbnail once the IndexQueue prepared them
 
-  size_t findEntry(const std::string& name) const;
+  bool runIdleWork();
+  void render();
+  void renderList() const;
+  void renderGrid();
+  void drawGridThumbnails(size_t pageStartIndex, bool collectPending);
+  void generateNextThumbnail();
+  void openDirectory();
+  size_t getPageItems() const;
+  static std::string getEntryLabel(const LibraryIndex::Entry& entry, bool withAuthor);
 
  public:
   explicit FileSelectionActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
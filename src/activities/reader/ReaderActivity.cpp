@@ -1,5 +1,6 @@
 #include "ReaderActivity.h"
 
+#include "CacheManager.h"
 #include "Epub.h"
 #include "EpubReaderActivity.h"
 #include "FileSelectionActivity.h"
@@ -93,6 +94,7 @@ void ReaderActivity::onGoToFileSelection(const std::string& fromBookPath) {
 void ReaderActivity::onGoToEpubReader(std::unique_ptr<Epub> epub) {
   const auto epubPath = epub->getPath();
   currentBookPath = epubPath;
+  CacheManager::recordAccess(epubPath, epub->getCachePath());
   exitActivity();
   enterNewActivity(new EpubReaderActivity(
       renderer, mappedInput, std::move(epub), [this, epubPath] { onGoToFileSelection(epubPath); },
@@ -102,6 +104,7 @@ void ReaderActivity::onGoToEpubReader(std::unique_ptr<Epub> epub) {
 void ReaderActivity::onGoToXtcReader(std::unique_ptr<Xtc> xtc) {
   const auto xtcPath = xtc->getPath();
   currentBookPath = xtcPath;
+  CacheManager::recordAccess(xtcPath, xtc->getCachePath());
   exitActivity();
   enterNewActivity(new XtcReaderActivity(
       renderer, mappedInput, std::move(xtc), [this, xtcPath] { onGoToFileSelection(xtcPath); },
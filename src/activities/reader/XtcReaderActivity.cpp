@@ -11,9 +11,12 @@
 #include <GfxRenderer.h>
 #include <SDCardManager.h>
 
+#include "BookCard.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "LibraryIndex.h"
 #include "MappedInputManager.h"
+#include "ResumeSnapshot.h"
 #include "XtcReaderChapterSelectionActivity.h"
 #include "fontIds.h"
 
@@ -22,11 +25,6 @@ constexpr unsigned long skipPageMs = 700;
 constexpr unsigned long goHomeMs = 1000;
 }  // namespace
 
-void XtcReaderActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<XtcReaderActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void XtcReaderActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
@@ -34,8 +32,6 @@ void XtcReaderActivity::onEnter() {
     return;
   }
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   xtc->setupCacheDir();
 
   // Load saved progress
@@ -45,28 +41,27 @@ void XtcReaderActivity::onEnter() {
   APP_STATE.openEpubPath = xtc->getPath();
   APP_STATE.saveToFile();
 
+  // The page is already on screen from the resume snapshot, a fast refresh is enough to add the gray levels
+  if (ResumeSnapshot::takeRestored(xtc->getPath())) {
+    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
+  }
+
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&XtcReaderActivity::taskTrampoline, "XtcReaderActivityTask",
-              4096,               // Stack size (smaller than EPUB since no parsing needed)
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderScheduler.requestUpdate();
+
+  // Smaller stack than EPUB since no parsing needed
+  renderScheduler.start("XtcReaderActivityTask", 4096, [this] { renderScreen(); });
 }
 
 void XtcReaderActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  // Wait until not rendering to delete task
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
+  renderScheduler.stop();
+
+  if (xtc && xtc->getPageCount() > 0) {
+    saveProgress();
+    LibraryIndex::recordProgress(xtc->getPath(), static_cast<uint8_t>((currentPage + 1) * 100 / xtc->getPageCount()));
   }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
   xtc.reset();
 }
 
@@ -77,23 +72,30 @@ void XtcReaderActivity::loop() {
     return;
   }
 
+  // Write the position once page turns have settled
+  if (progressJournal.isFlushDue()) {
+    renderScheduler.lock();
+    saveProgress();
+    renderScheduler.unlock();
+  }
+
   // Enter chapter selection activity
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     if (xtc && xtc->hasChapters() && !xtc->getChapters().empty()) {
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      renderScheduler.lock();
       exitActivity();
       enterNewActivity(new XtcReaderChapterSelectionActivity(
           this->renderer, this->mappedInput, xtc, currentPage,
           [this] {
             exitActivity();
-            updateRequired = true;
+            renderScheduler.requestUpdate();
           },
           [this](const uint32_t newPage) {
             currentPage = newPage;
             exitActivity();
-            updateRequired = true;
+            renderScheduler.requestUpdate();
           }));
-      xSemaphoreGive(renderingMutex);
+      renderScheduler.unlock();
     }
   }
 
@@ -123,7 +125,7 @@ void XtcReaderActivity::loop() {
   // Handle end of book
   if (currentPage >= xtc->getPageCount()) {
     currentPage = xtc->getPageCount() - 1;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
     return;
   }
 
@@ -136,25 +138,13 @@ void XtcReaderActivity::loop() {
     } else {
       currentPage = 0;
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   } else if (nextReleased) {
     currentPage += skipAmount;
     if (currentPage >= xtc->getPageCount()) {
       currentPage = xtc->getPageCount();  // Allow showing "End of book"
     }
-    updateRequired = true;
-  }
-}
-
-void XtcReaderActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      renderScreen();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    renderScheduler.requestUpdate();
   }
 }
 
@@ -173,7 +163,7 @@ void XtcReaderActivity::renderScreen() {
   }
 
   renderPage();
-  saveProgress();
+  progressJournal.update(0, currentPage);
 }
 
 void XtcReaderActivity::renderPage() {
@@ -358,20 +348,33 @@ void XtcReaderActivity::renderPage() {
                 bitDepth);
 }
 
-void XtcReaderActivity::saveProgress() const {
-  FsFile f;
-  if (SdMan.openFileForWrite("XTR", xtc->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    data[0] = currentPage & 0xFF;
-    data[1] = (currentPage >> 8) & 0xFF;
-    data[2] = (currentPage >> 16) & 0xFF;
-    data[3] = (currentPage >> 24) & 0xFF;
-    f.write(data, 4);
-    f.close();
+// Writes the pending position to the journal, along with the home screen summary
+void XtcReaderActivity::saveProgress() {
+  if (!progressJournal.flush()) {
+    return;
   }
+
+  std::string chapter;
+  for (const auto& chapterInfo : xtc->getChapters()) {
+    if (currentPage >= chapterInfo.startPage && currentPage <= chapterInfo.endPage) {
+      chapter = chapterInfo.name;
+      break;
+    }
+  }
+  BookCard::save(xtc->getPath(), xtc->getTitle(), "", chapter,
+                 static_cast<uint8_t>((currentPage + 1) * 100 / xtc->getPageCount()));
 }
 
 void XtcReaderActivity::loadProgress() {
+  uint16_t spineIndex;
+  uint32_t savedPage;
+  if (progressJournal.open(xtc->getCachePath() + "/progress.log", &spineIndex, &savedPage)) {
+    currentPage = savedPage < xtc->getPageCount() ? savedPage : 0;
+    Serial.printf("[%lu] [XTR] Loaded progress: page %lu\n", millis(), currentPage);
+    return;
+  }
+
+  // Progress saved before the journal existed
   FsFile f;
   if (SdMan.openFileForRead("XTR", xtc->getCachePath() + "/progress.bin", f)) {
     uint8_t data[4];
@@ -8,27 +8,23 @@
 #pragma once
 
 #include <Xtc.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
 
+#include "ProgressJournal.h"
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/RenderScheduler.h"
 
 class XtcReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Xtc> xtc;
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
+  RenderScheduler renderScheduler;
   uint32_t currentPage = 0;
   int pagesUntilFullRefresh = 0;
-  bool updateRequired = false;
+  ProgressJournal progressJournal;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void renderPage();
-  void saveProgress() const;
+  void saveProgress();
   void loadProgress();
 
  public:
@@ -40,5 +36,6 @@ class XtcReaderActivity final : public ActivityWithSubactivity {
         onGoHome(onGoHome) {}
   void onEnter() override;
   void onExit() override;
+  bool canSnapshotScreen() const override { return !subActivity && xtc; }
   void loop() override;
 };
@@ -17,36 +17,24 @@ constexpr int MENU_ITEMS = 2;
 const char* menuNames[MENU_ITEMS] = {"Calibre Web URL", "Connect as Wireless Device"};
 }  // namespace
 
-void CalibreSettingsActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<CalibreSettingsActivity*>(param);
-  self->displayTaskLoop();
-}
-
 void CalibreSettingsActivity::onEnter() {
   ActivityWithSubactivity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
   selectedIndex = 0;
-  updateRequired = true;
-
-  xTaskCreate(&CalibreSettingsActivity::taskTrampoline, "CalibreSettingsTask",
-              4096,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderScheduler.requestUpdate();
+
+  renderScheduler.start("CalibreSettingsTask", 4096, [this] {
+    // Subactivities draw for themselves; closing one asks for a render again
+    if (!subActivity) {
+      render();
+    }
+  });
 }
 
 void CalibreSettingsActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderScheduler.stop();
 }
 
 void CalibreSettingsActivity::loop() {
@@ -68,16 +56,16 @@ void CalibreSettingsActivity::loop() {
   if (mappedInput.wasPressed(MappedInputManager::Button::Up) ||
       mappedInput.wasPressed(MappedInputManager::Button::Left)) {
     selectedIndex = (selectedIndex + MENU_ITEMS - 1) % MENU_ITEMS;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   } else if (mappedInput.wasPressed(MappedInputManager::Button::Down) ||
              mappedInput.wasPressed(MappedInputManager::Button::Right)) {
     selectedIndex = (selectedIndex + 1) % MENU_ITEMS;
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 }
 
 void CalibreSettingsActivity::handleSelection() {
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  renderScheduler.lock();
 
   if (selectedIndex == 0) {
     // Calibre Web URL
@@ -91,11 +79,11 @@ void CalibreSettingsActivity::handleSelection() {
           SETTINGS.opdsServerUrl[sizeof(SETTINGS.opdsServerUrl) - 1] = '\0';
           SETTINGS.saveToFile();
           exitActivity();
-          updateRequired = true;
+          renderScheduler.requestUpdate();
         },
         [this]() {
           exitActivity();
-          updateRequired = true;
+          renderScheduler.requestUpdate();
         }));
   } else if (selectedIndex == 1) {
     // Wireless Device - launch the activity (handles WiFi connection internally)
@@ -106,33 +94,21 @@ void CalibreSettingsActivity::handleSelection() {
         if (connected) {
           enterNewActivity(new CalibreWirelessActivity(renderer, mappedInput, [this] {
             exitActivity();
-            updateRequired = true;
+            renderScheduler.requestUpdate();
           }));
         } else {
-          updateRequired = true;
+          renderScheduler.requestUpdate();
         }
       }));
     } else {
       enterNewActivity(new CalibreWirelessActivity(renderer, mappedInput, [this] {
         exitActivity();
-        updateRequired = true;
+        renderScheduler.requestUpdate();
       }));
     }
   }
 
-  xSemaphoreGive(renderingMutex);
-}
-
-void CalibreSettingsActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired && !subActivity) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
+  renderScheduler.unlock();
 }
 
 void CalibreSettingsActivity::render() {
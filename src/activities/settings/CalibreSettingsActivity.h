@@ -1,11 +1,8 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
-
 #include <functional>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/RenderScheduler.h"
 
 /**
  * Submenu for Calibre settings.
@@ -22,15 +19,11 @@ class CalibreSettingsActivity final : public ActivityWithSubactivity {
   void loop() override;
 
  private:
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderScheduler renderScheduler;
 
   int selectedIndex = 0;
   const std::function<void()> onBack;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
   void handleSelection();
 };
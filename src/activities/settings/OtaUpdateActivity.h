@@ -1,9 +1,6 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
-
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/RenderScheduler.h"
 #include "network/OtaUpdater.h"
 
 class OtaUpdateActivity : public ActivityWithSubactivity {
@@ -21,17 +18,13 @@ class OtaUpdateActivity : public ActivityWithSubactivity {
   // Can't initialize this to 0 or the first render doesn't happen
   static constexpr unsigned int UNINITIALIZED_PERCENTAGE = 111;
 
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderScheduler renderScheduler;
   const std::function<void()> goBack;
   State state = WIFI_SELECTION;
   unsigned int lastUpdaterPercentage = UNINITIALIZED_PERCENTAGE;
   OtaUpdater updater;
 
   void onWifiSelectionComplete(bool success);
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render();
 
  public:
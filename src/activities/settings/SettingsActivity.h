@@ -1,13 +1,10 @@
 #pragma once
-#include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
-#include <freertos/task.h>
-
 #include <functional>
 #include <string>
 #include <vector>
 
 #include "activities/ActivityWithSubactivity.h"
+#include "activities/RenderScheduler.h"
 
 class CrossPointSettings;
 
@@ -45,14 +42,10 @@ struct SettingInfo {
 };
 
 class SettingsActivity final : public ActivityWithSubactivity {
-  TaskHandle_t displayTaskHandle = nullptr;
-  SemaphoreHandle_t renderingMutex = nullptr;
-  bool updateRequired = false;
+  RenderScheduler renderScheduler;
   int selectedSettingIndex = 0;  // Currently selected setting
   const std::function<void()> onGoHome;
 
-  static void taskTrampoline(void* param);
-  [[noreturn]] void displayTaskLoop();
   void render() const;
   void toggleCurrentSetting();
 
@@ -13,50 +13,19 @@ const char* const KeyboardEntryActivity::keyboard[NUM_ROWS] = {
 const char* const KeyboardEntryActivity::keyboardShift[NUM_ROWS] = {"~!@#$%^&*()_+", "QWERTYUIOP{}|", "ASDFGHJKL:\"",
                                                                     "ZXCVBNM<>?", "SPECIAL ROW"};
 
-void KeyboardEntryActivity::taskTrampoline(void* param) {
-  auto* self = static_cast<KeyboardEntryActivity*>(param);
-  self->displayTaskLoop();
-}
-
-void KeyboardEntryActivity::displayTaskLoop() {
-  while (true) {
-    if (updateRequired) {
-      updateRequired = false;
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      render();
-      xSemaphoreGive(renderingMutex);
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-  }
-}
-
 void KeyboardEntryActivity::onEnter() {
   Activity::onEnter();
 
-  renderingMutex = xSemaphoreCreateMutex();
-
   // Trigger first update
-  updateRequired = true;
-
-  xTaskCreate(&KeyboardEntryActivity::taskTrampoline, "KeyboardEntryActivity",
-              2048,               // Stack size
-              this,               // Parameters
-              1,                  // Priority
-              &displayTaskHandle  // Task handle
-  );
+  renderScheduler.requestUpdate();
+
+  renderScheduler.start("KeyboardEntryActivity", 2048, [this] { render(); });
 }
 
 void KeyboardEntryActivity::onExit() {
   Activity::onExit();
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
-  xSemaphoreTake(renderingMutex, portMAX_DELAY);
-  if (displayTaskHandle) {
-    vTaskDelete(displayTaskHandle);
-    displayTaskHandle = nullptr;
-  }
-  vSemaphoreDelete(renderingMutex);
-  renderingMutex = nullptr;
+  renderScheduler.stop();
 }
 
 int KeyboardEntryActivity::getRowLength(const int row) const {
@@ -146,7 +115,7 @@ void KeyboardEntryActivity::loop() {
       const int maxCol = getRowLength(selectedRow) - 1;
       if (selectedCol > maxCol) selectedCol = maxCol;
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 
   if (mappedInput.wasPressed(MappedInputManager::Button::Down)) {
@@ -155,7 +124,7 @@ void KeyboardEntryActivity::loop() {
       const int maxCol = getRowLength(selectedRow) - 1;
       if (selectedCol > maxCol) selectedCol = maxCol;
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 
   if (mappedInput.wasPressed(MappedInputManager::Button::Left)) {
@@ -174,7 +143,7 @@ void KeyboardEntryActivity::loop() {
         // At done button, move to backspace
         selectedCol = BACKSPACE_COL;
       }
-      updateRequired = true;
+      renderScheduler.requestUpdate();
       return;
     }
 
@@ -185,7 +154,7 @@ void KeyboardEntryActivity::loop() {
       selectedRow--;
       selectedCol = getRowLength(selectedRow) - 1;
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 
   if (mappedInput.wasPressed(MappedInputManager::Button::Right)) {
@@ -206,7 +175,7 @@ void KeyboardEntryActivity::loop() {
       } else if (selectedCol >= DONE_COL) {
         // At done button, do nothing
       }
-      updateRequired = true;
+      renderScheduler.requestUpdate();
       return;
     }
 
@@ -217,13 +186,13 @@ void KeyboardEntryActivity::loop() {
       selectedRow++;
       selectedCol = 0;
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 
   // Selection
   if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
     handleKeyPress();
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 
   // Cancel
@@ -231,7 +200,7 @@ void KeyboardEntryActivity::loop() {
     if (onCancel) {
       onCancel();
     }
-    updateRequired = true;
+    renderScheduler.requestUpdate();
   }
 }
 
@@ -3,6 +3,7 @@
 #include <Epub.h>
 #include <GfxRenderer.h>
 #include <InputManager.h>
+#include <Metrics.h>
 #include <SDCardManager.h>
 #include <SPI.h>
 #include <builtinFonts/all.h>
@@ -13,6 +14,7 @@
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "MappedInputManager.h"
+#include "ResumeSnapshot.h"
 #include "activities/boot_sleep/BootActivity.h"
 #include "activities/boot_sleep/SleepActivity.h"
 #include "activities/browser/OpdsBookBrowserActivity.h"
@@ -194,8 +196,16 @@ void waitForPowerRelease() {
 
 // Enter deep sleep mode
 void enterDeepSleep() {
+  // Keep the page for the next boot; exiting stops the display task but leaves the frame buffer as it was
+  const bool snapshotPage = currentActivity && currentActivity->canSnapshotScreen();
   exitActivity();
+  if (snapshotPage) {
+    ResumeSnapshot::save(renderer, APP_STATE.openEpubPath);
+  } else {
+    ResumeSnapshot::clear();
+  }
   enterNewActivity(new SleepActivity(renderer, mappedInputManager));
+  metrics::dumpToFile("/.crosspoint/metrics.bin");
 
   einkDisplay.deepSleep();
   Serial.printf("[%lu] [   ] Power button press calibration value: %lu ms\n", millis(), t2 - t1);
@@ -293,10 +303,13 @@ void setup() {
 
   setupDisplayAndFonts();
 
-  exitActivity();
-  enterNewActivity(new BootActivity(renderer, mappedInputManager));
-
   APP_STATE.loadFromFile();
+  // Put the last page back on screen right away, the book is opened behind it
+  if (APP_STATE.openEpubPath.empty() || !ResumeSnapshot::restore(renderer, APP_STATE.openEpubPath)) {
+    exitActivity();
+    enterNewActivity(new BootActivity(renderer, mappedInputManager));
+  }
+
   if (APP_STATE.openEpubPath.empty()) {
     onGoHome();
   } else {
@@ -353,6 +366,7 @@ void loop() {
   const unsigned long activityDuration = millis() - activityStartTime;
 
   const unsigned long loopDuration = millis() - loopStartTime;
+  metrics::add(metrics::Counter::LoopBusyMs, loopDuration);
   if (loopDuration > maxLoopDuration) {
     maxLoopDuration = loopDuration;
     if (maxLoopDuration > 50) {
@@ -368,5 +382,6 @@ void loop() {
     yield();  // Give FreeRTOS a chance to run tasks, but return immediately
   } else {
     delay(10);  // Normal delay when no activity requires fast response
+    metrics::add(metrics::Counter::LoopIdleMs, 10);
   }
 }
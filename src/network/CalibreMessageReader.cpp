@@ -0,0 +1,310 @@
+#include "CalibreMessageReader.h"
+
+#include <cstring>
+
+namespace {
+using Field = CalibreMessageReader::Field;
+
+// Objects whose keys are looked up; -1 marks an object or array that is skipped
+enum Context : int8_t { ROOT, BOOK };
+constexpr int8_t NONE = -1;
+
+struct KeyMapping {
+  int8_t context;  // Object the key belongs to
+  const char* key;
+  int8_t field;  // Field the value is read into, or NONE
+  int8_t opens;  // Context of the value if it is an object, or NONE
+};
+
+constexpr int8_t fieldIndex(const Field field) { return static_cast<int8_t>(field); }
+
+constexpr KeyMapping KEY_MAPPINGS[] = {
+    {ROOT, "lpath", fieldIndex(Field::Lpath), NONE},
+    {ROOT, "length", fieldIndex(Field::Length), NONE},
+    {ROOT, "messageKind", fieldIndex(Field::MessageKind), NONE},
+    {ROOT, "ejecting", fieldIndex(Field::Ejecting), NONE},
+    {ROOT, "priKey", fieldIndex(Field::PriKey), NONE},
+    {ROOT, "count", fieldIndex(Field::Count), NONE},
+    {ROOT, "metadata", NONE, BOOK},
+    {ROOT, "data", NONE, BOOK},
+    {BOOK, "lpath", fieldIndex(Field::Lpath), NONE},
+    {BOOK, "uuid", fieldIndex(Field::Uuid), NONE},
+    {BOOK, "title", fieldIndex(Field::Title), NONE},
+    {BOOK, "authors", fieldIndex(Field::Authors), NONE},
+    {BOOK, "last_modified", fieldIndex(Field::LastModified), NONE},
+};
+constexpr int KEY_MAPPING_COUNT = sizeof(KEY_MAPPINGS) / sizeof(KEY_MAPPINGS[0]);
+
+int hexValue(const uint8_t c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+}  // namespace
+
+void CalibreMessageReader::reset() {
+  inBody = false;
+  prefixDigits = 0;
+  bodyRemaining = 0;
+  opcode = -1;
+  memset(values, 0, sizeof(values));
+}
+
+bool CalibreMessageReader::read(Ring& ring) {
+  while (!ring.empty()) {
+    size_t length;
+    const uint8_t* data = ring.readSpan(&length);
+    for (size_t i = 0; i < length; i++) {
+      if (feed(data[i])) {
+        ring.consume(i + 1);
+        return true;
+      }
+    }
+    ring.consume(length);
+  }
+  return false;
+}
+
+bool CalibreMessageReader::feed(const uint8_t c) {
+  if (inBody) {
+    feedJson(c);
+    if (--bodyRemaining == 0) {
+      inBody = false;
+      return true;
+    }
+    return false;
+  }
+
+  // Length prefix: digits immediately followed by the '[' that opens the message. Calibre always sends one, so
+  // anything else is garbage and is skipped.
+  if (c >= '0' && c <= '9' && prefixDigits < MAX_PREFIX_DIGITS) {
+    bodyRemaining = (prefixDigits == 0 ? 0 : bodyRemaining * 10) + (c - '0');
+    prefixDigits++;
+    return false;
+  }
+  const bool validPrefix = c == '[' && prefixDigits > 0 && bodyRemaining > 0 && bodyRemaining <= MAX_MESSAGE_LENGTH;
+  prefixDigits = 0;
+  if (!validPrefix) {
+    return false;
+  }
+
+  beginMessage();
+  inBody = true;
+  feedJson(c);
+  if (--bodyRemaining == 0) {
+    inBody = false;
+    return true;
+  }
+  return false;
+}
+
+void CalibreMessageReader::beginMessage() {
+  depth = 0;
+  element = 0;
+  inString = false;
+  escape = false;
+  unicodeDigits = -1;
+  highSurrogate = 0;
+  expectKey = false;
+  currentKey = -1;
+  target = nullptr;
+  opcode = -1;
+  memset(values, 0, sizeof(values));
+}
+
+void CalibreMessageReader::feedJson(const uint8_t c) {
+  if (inString) {
+    if (unicodeDigits > 0) {
+      const int digit = hexValue(c);
+      unicodeValue = (unicodeValue << 4) | (digit < 0 ? 0 : digit);
+      if (--unicodeDigits > 0) {
+        return;
+      }
+      unicodeDigits = -1;
+      // Calibre escapes everything outside ASCII; characters beyond the BMP arrive as surrogate pairs
+      if (unicodeValue >= 0xD800 && unicodeValue <= 0xDBFF) {
+        highSurrogate = unicodeValue;
+      } else if (unicodeValue >= 0xDC00 && unicodeValue <= 0xDFFF) {
+        if (highSurrogate) {
+          appendCodepoint(0x10000 + ((highSurrogate - 0xD800) << 10) + (unicodeValue - 0xDC00));
+        }
+        highSurrogate = 0;
+      } else {
+        highSurrogate = 0;
+        appendCodepoint(unicodeValue);
+      }
+      return;
+    }
+
+    // A high surrogate only pairs with a low one escaped right after it; anything else drops it
+    if (highSurrogate && !(escape ? c == 'u' : c == '\\')) {
+      highSurrogate = 0;
+    }
+    if (escape) {
+      escape = false;
+      uint8_t escaped = c;  // '"', '\\' and '/' stand for themselves
+      switch (c) {
+        case 'u':
+          unicodeDigits = 4;
+          unicodeValue = 0;
+          return;
+        case 'n':
+          escaped = '\n';
+          break;
+        case 't':
+          escaped = '\t';
+          break;
+        case 'r':
+          escaped = '\r';
+          break;
+        case 'b':
+          escaped = '\b';
+          break;
+        case 'f':
+          escaped = '\f';
+          break;
+        default:
+          break;
+      }
+      appendToString(&escaped, 1);
+    } else if (c == '\\') {
+      escape = true;
+    } else if (c == '"') {
+      inString = false;
+      endString();
+    } else {
+      appendToString(&c, 1);
+    }
+    return;
+  }
+
+  const bool inObject = depth < MAX_DEPTH && isObject[depth];
+  const int8_t frame = depth < MAX_DEPTH ? frames[depth] : NONE;
+  switch (c) {
+    case '"':
+      inString = true;
+      highSurrogate = 0;
+      targetLength = 0;
+      target = nullptr;
+      if (inObject && expectKey) {
+        if (frame != NONE) {
+          target = key;
+          targetSize = sizeof(key);
+        }
+      } else if (inObject && currentKey >= 0 && KEY_MAPPINGS[currentKey].field != NONE) {
+        target = values[KEY_MAPPINGS[currentKey].field];
+        targetSize = sizeof(values[0]);
+      } else if (!inObject && depth > 1 && frame != NONE && values[frame][0] == '\0') {
+        // First string of an array field
+        target = values[frame];
+        targetSize = sizeof(values[0]);
+      }
+      if (target) {
+        target[0] = '\0';
+      }
+      break;
+    case '{':
+    case '[': {
+      const int mapping = inObject && !expectKey ? currentKey : -1;
+      depth++;
+      if (depth < MAX_DEPTH) {
+        isObject[depth] = c == '{';
+        if (depth == 2) {
+          frames[depth] = element == 1 && c == '{' ? ROOT : NONE;
+        } else if (mapping >= 0) {
+          frames[depth] = c == '{' ? KEY_MAPPINGS[mapping].opens : KEY_MAPPINGS[mapping].field;
+        } else {
+          frames[depth] = NONE;
+        }
+      }
+      expectKey = c == '{';
+      currentKey = -1;
+      break;
+    }
+    case '}':
+    case ']':
+      depth--;
+      expectKey = false;
+      currentKey = -1;
+      break;
+    case ',':
+      if (depth == 1) {
+        element++;
+      } else if (inObject) {
+        expectKey = true;
+        currentKey = -1;
+      }
+      break;
+    case ':':
+      if (inObject) {
+        expectKey = false;
+      }
+      break;
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+      break;
+    default:
+      // Numbers and literals
+      if (depth == 1 && element == 0 && c >= '0' && c <= '9') {
+        opcode = (opcode < 0 ? 0 : opcode * 10) + (c - '0');
+      } else if (inObject && !expectKey && currentKey >= 0 && KEY_MAPPINGS[currentKey].field != NONE) {
+        char* value = values[KEY_MAPPINGS[currentKey].field];
+        const size_t length = strlen(value);
+        if (length < MAX_VALUE_LENGTH) {
+          value[length] = static_cast<char>(c);
+        }
+      }
+      break;
+  }
+}
+
+void CalibreMessageReader::appendToString(const uint8_t* bytes, const size_t count) {
+  // Drop characters that do not fit; the terminating NUL is always kept
+  if (target && targetLength + count < targetSize) {
+    memcpy(target + targetLength, bytes, count);
+    targetLength += count;
+    target[targetLength] = '\0';
+  }
+}
+
+void CalibreMessageReader::appendCodepoint(const uint32_t codepoint) {
+  uint8_t bytes[4];
+  size_t count;
+  if (codepoint < 0x80) {
+    bytes[0] = codepoint;
+    count = 1;
+  } else if (codepoint < 0x800) {
+    bytes[0] = 0xC0 | (codepoint >> 6);
+    bytes[1] = 0x80 | (codepoint & 0x3F);
+    count = 2;
+  } else if (codepoint < 0x10000) {
+    bytes[0] = 0xE0 | (codepoint >> 12);
+    bytes[1] = 0x80 | ((codepoint >> 6) & 0x3F);
+    bytes[2] = 0x80 | (codepoint & 0x3F);
+    count = 3;
+  } else {
+    bytes[0] = 0xF0 | (codepoint >> 18);
+    bytes[1] = 0x80 | ((codepoint >> 12) & 0x3F);
+    bytes[2] = 0x80 | ((codepoint >> 6) & 0x3F);
+    bytes[3] = 0x80 | (codepoint & 0x3F);
+    count = 4;
+  }
+  appendToString(bytes, count);
+}
+
+void CalibreMessageReader::endString() {
+  if (target == key) {
+    currentKey = -1;
+    const int8_t context = frames[depth];
+    for (int i = 0; i < KEY_MAPPING_COUNT; i++) {
+      if (KEY_MAPPINGS[i].context == context && strcmp(key, KEY_MAPPINGS[i].key) == 0) {
+        currentKey = i;
+        break;
+      }
+    }
+  }
+  target = nullptr;
+}
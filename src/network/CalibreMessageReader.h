@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "util/RingBuffer.h"
+
+/**
+ * Incremental decoder for Calibre wireless protocol messages: a decimal length prefix followed by that many bytes of
+ * JSON, "[<opcode>, {<data>}]".
+ *
+ * Bytes are consumed from the receive ring as they arrive and the JSON is scanned in place. Only the opcode and the
+ * fields listed in Field are kept, so a message can be much larger than the ring (SEND_BOOK metadata carries a base64
+ * cover) without ever being buffered whole.
+ */
+class CalibreMessageReader {
+ public:
+  // Also the pipe between the network and SD writer tasks during book transfers, so it holds several write blocks
+  static constexpr size_t RING_SIZE = 16384;
+  using Ring = RingBuffer<RING_SIZE>;
+
+  // Fields the activity acts on: Lpath to Count are keys of the data object, Uuid to LastModified keys of the book
+  // metadata nested in it ("metadata" in SEND_BOOK, "data" in SEND_BOOK_METADATA). Lpath is read from either place.
+  // Authors holds the first author only.
+  enum class Field : uint8_t {
+    Lpath,
+    Length,
+    MessageKind,
+    Ejecting,
+    PriKey,
+    Count,
+    Uuid,
+    Title,
+    Authors,
+    LastModified,
+    COUNT
+  };
+
+  /**
+   * Consume bytes from the ring until a message is complete.
+   * Bytes following the message (e.g. book data after SEND_BOOK) stay in the ring.
+   * @return true if a complete message is available through getOpcode()/get()
+   */
+  bool read(Ring& ring);
+
+  // Opcode of the last complete message, -1 if it had none
+  int getOpcode() const { return opcode; }
+
+  // Text of a field of the last complete message (strings unescaped), empty if it was absent
+  const char* get(Field field) const { return values[static_cast<int>(field)]; }
+
+  void reset();
+
+ private:
+  static constexpr size_t MAX_PREFIX_DIGITS = 12;
+  static constexpr size_t MAX_MESSAGE_LENGTH = 1000000;
+  static constexpr size_t MAX_KEY_LENGTH = 16;
+  static constexpr size_t MAX_VALUE_LENGTH = 256;
+  static constexpr int MAX_DEPTH = 8;  // Deeper values are skipped
+  static constexpr int FIELD_COUNT = static_cast<int>(Field::COUNT);
+
+  // Returns true once the byte completes a message
+  bool feed(uint8_t c);
+  void beginMessage();
+  void feedJson(uint8_t c);
+  void appendToString(const uint8_t* bytes, size_t count);
+  void appendCodepoint(uint32_t codepoint);
+  void endString();
+
+  // Framing
+  bool inBody = false;
+  size_t prefixDigits = 0;
+  size_t bodyRemaining = 0;
+
+  // JSON scanner
+  int depth = 0;
+  int element = 0;  // Index in the outer array: 0 = opcode, 1 = data
+  bool inString = false;
+  bool escape = false;
+  int unicodeDigits = -1;  // Hex digits left in a \u escape, -1 outside one
+  uint32_t unicodeValue = 0;
+  uint32_t highSurrogate = 0;
+  bool expectKey = false;
+  int currentKey = -1;  // Entry of the key table for the value being read, -1 if the current key is not wanted
+  // Per nesting level: whether it is an object, and the object's context in the key table, or for an array the field
+  // its first string goes to (-1 if neither)
+  bool isObject[MAX_DEPTH] = {};
+  int8_t frames[MAX_DEPTH] = {};
+  char* target = nullptr;  // String being captured (key or value), nullptr to skip
+  size_t targetSize = 0;
+  size_t targetLength = 0;
+  char key[MAX_KEY_LENGTH + 1] = {};
+
+  int opcode = -1;
+  char values[FIELD_COUNT][MAX_VALUE_LENGTH + 1] = {};
+};
@@ -2,11 +2,15 @@
 
 #include <ArduinoJson.h>
 #include <FsHelpers.h>
+#include <Metrics.h>
 #include <SDCardManager.h>
 #include <WiFi.h>
+#include <miniz.h>
 
 #include <algorithm>
+#include <cstring>
 
+#include "IndexQueue.h"
 #include "html/FilesPageHtml.generated.h"
 #include "html/HomePageHtml.generated.h"
 
@@ -15,12 +19,54 @@ namespace {
 // Note: Items starting with "." are automatically hidden
 const char* HIDDEN_ITEMS[] = {"System Volume Information", "XTCache"};
 constexpr size_t HIDDEN_ITEMS_COUNT = sizeof(HIDDEN_ITEMS) / sizeof(HIDDEN_ITEMS[0]);
+
+// Directory containing a file or folder path
+String getParentPath(const String& path) {
+  const int lastSlash = path.lastIndexOf('/');
+  return lastSlash <= 0 ? String("/") : path.substring(0, lastSlash);
+}
+
+// Gathers the small pieces of a chunked response, so each chunk goes out in one write
+class ChunkedResponse {
+  WebServer& server;
+  char buffer[1024];
+  size_t length = 0;
+
+ public:
+  explicit ChunkedResponse(WebServer& server) : server(server) {}
+
+  void write(const char* data) {
+    const size_t size = strlen(data);
+    if (length + size > sizeof(buffer)) {
+      flush();
+    }
+    if (size > sizeof(buffer)) {
+      server.sendContent(data, size);
+      return;
+    }
+    memcpy(buffer + length, data, size);
+    length += size;
+  }
+
+  void flush() {
+    if (length > 0) {
+      server.sendContent(buffer, length);
+      length = 0;
+    }
+  }
+
+  // End of streamed response, empty chunk to signal client
+  void end() {
+    flush();
+    server.sendContent("");
+  }
+};
 }  // namespace
 
-// File listing page template - now using generated headers:
+// Pages are embedded gzipped by scripts/build_html.py, as <Name>HtmlGz with <Name>HtmlLength, <Name>HtmlETag and
+// <Name>HtmlIdentityETag:
 // - HomePageHtml (from html/HomePage.html)
-// - FilesPageHeaderHtml (from html/FilesPageHeader.html)
-// - FilesPageFooterHtml (from html/FilesPageFooter.html)
+// - FilesPageHtml (from html/FilesPage.html)
 CrossPointWebServer::CrossPointWebServer() {}
 
 CrossPointWebServer::~CrossPointWebServer() { stop(); }
@@ -74,7 +120,9 @@ void CrossPointWebServer::begin() {
   server->on("/api/files", HTTP_GET, [this] { handleFileListData(); });
 
   // Upload endpoint with special handling for multipart form data
-  server->on("/upload", HTTP_POST, [this] { handleUploadPost(); }, [this] { handleUpload(); });
+  server->on("/upload", HTTP_POST, [this] { handleUploadPost(); }, [this] { handleUpload(false); });
+  // Several files in one multipart request, see handleUpload()
+  server->on("/upload/batch", HTTP_POST, [this] { handleBatchUploadPost(); }, [this] { handleUpload(true); });
 
   // Create folder endpoint
   server->on("/mkdir", HTTP_POST, [this] { handleCreateFolder(); });
@@ -83,6 +131,10 @@ void CrossPointWebServer::begin() {
   server->on("/delete", HTTP_POST, [this] { handleDelete(); });
 
   server->onNotFound([this] { handleNotFound(); });
+
+  // Request headers the page handlers look at; WebServer drops all others
+  const char* headerKeys[] = {"Accept-Encoding", "If-None-Match"};
+  server->collectHeaders(headerKeys, 2);
   Serial.printf("[%lu] [WEB] [MEM] Free heap after route setup: %d bytes\n", millis(), ESP.getFreeHeap());
 
   server->begin();
@@ -150,8 +202,53 @@ void CrossPointWebServer::handleClient() const {
   server->handleClient();
 }
 
+void CrossPointWebServer::sendPage(const uint8_t* gzipped, const size_t gzippedLength, const size_t length,
+                                   const char* etag, const char* identityEtag) const {
+  // Browsers revalidate on every visit and get a bodiless 304 while the firmware, and so the page, is unchanged.
+  // The gzipped and the inflated body are different bytes, so each has its own strong ETag, and a cache holding one
+  // is never told it matches the other.
+  const bool sendGzip = server->header("Accept-Encoding").indexOf("gzip") >= 0;
+  const char* bodyEtag = sendGzip ? etag : identityEtag;
+  server->sendHeader("ETag", bodyEtag);
+  server->sendHeader("Cache-Control", "no-cache");
+  server->sendHeader("Vary", "Accept-Encoding");
+  if (server->header("If-None-Match").indexOf(bodyEtag) >= 0) {
+    server->send(304);
+    return;
+  }
+
+  if (sendGzip) {
+    server->sendHeader("Content-Encoding", "gzip");
+    server->send_P(200, "text/html", reinterpret_cast<const char*>(gzipped), gzippedLength);
+    return;
+  }
+
+  // Clients without gzip support get the page inflated into a temporary buffer, skipping the 10-byte gzip header
+  // (the build writes no optional fields) and the 8-byte trailer
+  constexpr size_t GZIP_HEADER_SIZE = 10;
+  constexpr size_t GZIP_TRAILER_SIZE = 8;
+  auto* page = static_cast<uint8_t*>(malloc(length));
+  auto* inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  tinfl_status status = TINFL_STATUS_FAILED;
+  if (page && inflator) {
+    tinfl_init(inflator);
+    size_t inBytes = gzippedLength - GZIP_HEADER_SIZE - GZIP_TRAILER_SIZE;
+    size_t outBytes = length;
+    status = tinfl_decompress(inflator, gzipped + GZIP_HEADER_SIZE, &inBytes, page, page, &outBytes,
+                              TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+  }
+  free(inflator);
+  if (status == TINFL_STATUS_DONE) {
+    server->send_P(200, "text/html", reinterpret_cast<const char*>(page), length);
+  } else {
+    Serial.printf("[%lu] [WEB] Failed to inflate page (status %d)\n", millis(), status);
+    server->send(500, "text/plain", "Failed to load page");
+  }
+  free(page);
+}
+
 void CrossPointWebServer::handleRoot() const {
-  server->send(200, "text/html", HomePageHtml);
+  sendPage(HomePageHtmlGz, sizeof(HomePageHtmlGz), HomePageHtmlLength, HomePageHtmlETag, HomePageHtmlIdentityETag);
   Serial.printf("[%lu] [WEB] Served root page\n", millis());
 }
 
@@ -173,6 +270,34 @@ void CrossPointWebServer::handleStatus() const {
   doc["freeHeap"] = ESP.getFreeHeap();
   doc["uptime"] = millis() / 1000;
 
+#if CROSSPOINT_METRICS
+  JsonObject metricsJson = doc["metrics"].to<JsonObject>();
+  metricsJson["minFreeHeap"] = metrics::getMinFreeHeap();
+  metricsJson["minMaxAllocHeap"] = metrics::getMinMaxAllocHeap();
+  JsonArray bucketLimits = metricsJson["bucketLimitsMs"].to<JsonArray>();
+  for (const uint16_t limit : metrics::BUCKET_LIMITS_MS) {
+    bucketLimits.add(limit);
+  }
+  JsonObject counters = metricsJson["counters"].to<JsonObject>();
+  for (int i = 0; i < metrics::COUNTER_COUNT; i++) {
+    const auto counter = static_cast<metrics::Counter>(i);
+    counters[metrics::getName(counter)] = metrics::get(counter);
+  }
+  JsonObject timers = metricsJson["timers"].to<JsonObject>();
+  for (int i = 0; i < metrics::TIMER_COUNT; i++) {
+    const auto timer = static_cast<metrics::Timer>(i);
+    const metrics::Histogram& histogram = metrics::get(timer);
+    JsonObject timerJson = timers[metrics::getName(timer)].to<JsonObject>();
+    timerJson["count"] = histogram.count;
+    timerJson["totalMs"] = histogram.totalMs;
+    timerJson["maxMs"] = histogram.maxMs;
+    JsonArray buckets = timerJson["buckets"].to<JsonArray>();
+    for (const uint32_t bucket : histogram.buckets) {
+      buckets.add(bucket);
+    }
+  }
+#endif
+
   String json;
   serializeJson(doc, json);
   server->send(200, "application/json", json);
@@ -241,9 +366,12 @@ bool CrossPointWebServer::isEpubFile(const String& filename) const {
   return lower.endsWith(".epub");
 }
 
-void CrossPointWebServer::handleFileList() const { server->send(200, "text/html", FilesPageHtml); }
+void CrossPointWebServer::handleFileList() const {
+  sendPage(FilesPageHtmlGz, sizeof(FilesPageHtmlGz), FilesPageHtmlLength, FilesPageHtmlETag,
+           FilesPageHtmlIdentityETag);
+}
 
-void CrossPointWebServer::handleFileListData() const {
+void CrossPointWebServer::handleFileListData() {
   // Get current path from query string (default to root)
   String currentPath = "/";
   if (server->hasArg("path")) {
@@ -258,38 +386,75 @@ void CrossPointWebServer::handleFileListData() const {
     }
   }
 
+  // Paging parameters get a page with the directory totals; without them the whole directory is sent as a plain array
+  const bool paged = server->hasArg("offset") || server->hasArg("limit") || server->hasArg("sort");
+  auto sort = FileListingCache::Sort::Name;
+  if (server->arg("sort") == "size") {
+    sort = FileListingCache::Sort::Size;
+  } else if (server->arg("sort") == "type") {
+    sort = FileListingCache::Sort::Type;
+  }
+  const bool descending = server->arg("order") == "desc";
+  const long offset = server->hasArg("offset") ? std::max(0L, server->arg("offset").toInt()) : 0;
+  const long limit = server->hasArg("limit") ? std::max(0L, server->arg("limit").toInt()) : -1;
+
+  const std::string dirPath = currentPath.c_str();
+  if (!listingCache.open(dirPath)) {
+    std::vector<FileListingCache::Entry> entries;
+    scanFiles(currentPath.c_str(), [&entries](const FileInfo& info) {
+      entries.push_back({info.name.c_str(), static_cast<uint32_t>(info.size), info.isDirectory, info.isEpub});
+    });
+    listingCache.rebuild(dirPath, entries);
+  }
+  const size_t total = listingCache.getCount();
+  const size_t first = std::min(static_cast<size_t>(offset), total);
+  const size_t last = limit < 0 ? total : std::min(first + static_cast<size_t>(limit), total);
+
   server->setContentLength(CONTENT_LENGTH_UNKNOWN);
   server->send(200, "application/json", "");
-  server->sendContent("[");
+  ChunkedResponse response(*server);
   char output[512];
   constexpr size_t outputSize = sizeof(output);
+  if (paged) {
+    snprintf(output, outputSize, "{\"total\":%u,\"folders\":%u,\"totalSize\":%llu,\"offset\":%u,\"files\":[",
+             static_cast<unsigned>(total), static_cast<unsigned>(listingCache.getFolderCount()),
+             static_cast<unsigned long long>(listingCache.getTotalSize()), static_cast<unsigned>(first));
+    response.write(output);
+  } else {
+    response.write("[");
+  }
+
   bool seenFirst = false;
   JsonDocument doc;
-
-  scanFiles(currentPath.c_str(), [this, &output, &doc, seenFirst](const FileInfo& info) mutable {
+  FileListingCache::Entry entry;
+  for (size_t position = first; position < last; position++) {
+    if (!listingCache.readEntry(sort, descending, position, entry)) {
+      Serial.printf("[%lu] [WEB] Failed to read listing entry %zu of %s\n", millis(), position, currentPath.c_str());
+      break;
+    }
     doc.clear();
-    doc["name"] = info.name;
-    doc["size"] = info.size;
-    doc["isDirectory"] = info.isDirectory;
-    doc["isEpub"] = info.isEpub;
+    doc["name"] = entry.name;
+    doc["size"] = entry.size;
+    doc["isDirectory"] = entry.isDirectory;
+    doc["isEpub"] = entry.isEpub;
 
     const size_t written = serializeJson(doc, output, outputSize);
     if (written >= outputSize) {
       // JSON output truncated; skip this entry to avoid sending malformed JSON
-      Serial.printf("[%lu] [WEB] Skipping file entry with oversized JSON for name: %s\n", millis(), info.name.c_str());
-      return;
+      Serial.printf("[%lu] [WEB] Skipping file entry with oversized JSON for name: %s\n", millis(), entry.name.c_str());
+      continue;
     }
 
     if (seenFirst) {
-      server->sendContent(",");
+      response.write(",");
     } else {
       seenFirst = true;
     }
-    server->sendContent(output);
-  });
-  server->sendContent("]");
-  // End of streamed response, empty chunk to signal client
-  server->sendContent("");
+    response.write(output);
+    yield();
+  }
+  response.write(paged ? "]}" : "]");
+  response.end();
   Serial.printf("[%lu] [WEB] Served file listing page for path: %s\n", millis(), currentPath.c_str());
 }
 
@@ -299,9 +464,50 @@ static String uploadFileName;
 static String uploadPath = "/";
 static size_t uploadSize = 0;
 static bool uploadSuccess = false;
+static bool uploadPreallocated = false;
 static String uploadError = "";
 
-void CrossPointWebServer::handleUpload() const {
+// Batch upload state, for the request currently being received on /upload/batch
+struct BatchFailure {
+  size_t index;  // Position of the file in the request
+  String name;
+  String error;
+};
+static bool batchActive = false;
+static std::vector<size_t> batchSizes;  // Declared file sizes, in request order
+static size_t batchIndex = 0;           // Position of the next file part
+static size_t batchUploaded = 0;
+static size_t batchBytes = 0;
+static unsigned long batchStartTime = 0;
+static std::vector<BatchFailure> batchFailures;
+
+static String getUploadFilePath() {
+  String filePath = uploadPath;
+  if (!filePath.endsWith("/")) filePath += "/";
+  filePath += uploadFileName;
+  return filePath;
+}
+
+static String getRequestedUploadPath(WebServer& server) {
+  // Get upload path from query parameter (defaults to root if not specified)
+  // Note: We use query parameter instead of form data because multipart form
+  // fields aren't available until after file upload completes
+  if (!server.hasArg("path")) {
+    return "/";
+  }
+  String path = server.arg("path");
+  // Ensure path starts with /
+  if (!path.startsWith("/")) {
+    path = "/" + path;
+  }
+  // Remove trailing slash unless it's root
+  if (path.length() > 1 && path.endsWith("/")) {
+    path = path.substring(0, path.length() - 1);
+  }
+  return path;
+}
+
+void CrossPointWebServer::handleUpload(const bool batch) {
   static unsigned long lastWriteTime = 0;
   static unsigned long uploadStartTime = 0;
   static size_t lastLoggedSize = 0;
@@ -318,35 +524,48 @@ void CrossPointWebServer::handleUpload() const {
     uploadFileName = upload.filename;
     uploadSize = 0;
     uploadSuccess = false;
+    uploadPreallocated = false;
     uploadError = "";
     uploadStartTime = millis();
     lastWriteTime = millis();
     lastLoggedSize = 0;
 
-    // Get upload path from query parameter (defaults to root if not specified)
-    // Note: We use query parameter instead of form data because multipart form
-    // fields aren't available until after file upload completes
-    if (server->hasArg("path")) {
-      uploadPath = server->arg("path");
-      // Ensure path starts with /
-      if (!uploadPath.startsWith("/")) {
-        uploadPath = "/" + uploadPath;
+    size_t declaredSize = 0;
+    if (!batch) {
+      uploadPath = getRequestedUploadPath(*server);
+    } else {
+      if (!batchActive) {
+        // First file of the request: the files of a batch all go to the same folder, and their sizes come as a
+        // comma-separated "sizes" query parameter so each file can be preallocated before its data arrives
+        batchActive = true;
+        uploadPath = getRequestedUploadPath(*server);
+        batchSizes.clear();
+        batchFailures.clear();
+        batchIndex = 0;
+        batchUploaded = 0;
+        batchBytes = 0;
+        batchStartTime = millis();
+        const String sizes = server->arg("sizes");
+        const char* cursor = sizes.c_str();
+        while (*cursor) {
+          char* end;
+          batchSizes.push_back(strtoul(cursor, &end, 10));
+          cursor = *end == ',' ? end + 1 : end + strlen(end);
+        }
+        Serial.printf("[%lu] [WEB] [UPLOAD] Batch START: %u files to path: %s\n", millis(), batchSizes.size(),
+                      uploadPath.c_str());
       }
-      // Remove trailing slash unless it's root
-      if (uploadPath.length() > 1 && uploadPath.endsWith("/")) {
-        uploadPath = uploadPath.substring(0, uploadPath.length() - 1);
+      if (batchIndex < batchSizes.size()) {
+        declaredSize = batchSizes[batchIndex];
       }
-    } else {
-      uploadPath = "/";
+      batchIndex++;
     }
 
     Serial.printf("[%lu] [WEB] [UPLOAD] START: %s to path: %s\n", millis(), uploadFileName.c_str(), uploadPath.c_str());
     Serial.printf("[%lu] [WEB] [UPLOAD] Free heap: %d bytes\n", millis(), ESP.getFreeHeap());
 
     // Create file path
-    String filePath = uploadPath;
-    if (!filePath.endsWith("/")) filePath += "/";
-    filePath += uploadFileName;
+    const String filePath = getUploadFilePath();
 
     // Check if file already exists
     if (SdMan.exists(filePath.c_str())) {
@@ -360,8 +579,19 @@ void CrossPointWebServer::handleUpload() const {
       Serial.printf("[%lu] [WEB] [UPLOAD] FAILED to create file: %s\n", millis(), filePath.c_str());
       return;
     }
+    // Reserve the whole file up front, so the writes do not have to allocate clusters as they go
+    if (declaredSize > 0) {
+      uploadPreallocated = uploadFile.preAllocate(declaredSize);
+      if (!uploadPreallocated) {
+        Serial.printf("[%lu] [WEB] [UPLOAD] Could not preallocate %u bytes, writing without\n", millis(),
+                      declaredSize);
+      }
+    }
 
     Serial.printf("[%lu] [WEB] [UPLOAD] File created successfully: %s\n", millis(), filePath.c_str());
+    if (!batch) {
+      listingCache.invalidate(uploadPath.c_str());
+    }
   } else if (upload.status == UPLOAD_FILE_WRITE) {
     if (uploadFile && uploadError.isEmpty()) {
       const unsigned long writeStartTime = millis();
@@ -394,22 +624,44 @@ void CrossPointWebServer::handleUpload() const {
     }
   } else if (upload.status == UPLOAD_FILE_END) {
     if (uploadFile) {
+      // A preallocated file is as long as the declared size; cut it to what was actually received
+      if (uploadPreallocated && !uploadFile.truncate(uploadSize)) {
+        uploadError = "Failed to write to SD card";
+      }
       uploadFile.close();
+      if (!batch) {
+        listingCache.invalidate(uploadPath.c_str());
+      }
 
       if (uploadError.isEmpty()) {
         uploadSuccess = true;
         Serial.printf("[%lu] [WEB] Upload complete: %s (%d bytes)\n", millis(), uploadFileName.c_str(), uploadSize);
+        IndexQueue::add(getUploadFilePath().c_str());
+      }
+    }
+    // A failed preallocated file would keep its uninitialised clusters
+    if (!uploadSuccess && uploadPreallocated) {
+      SdMan.remove(getUploadFilePath().c_str());
+    }
+
+    if (batch) {
+      if (uploadSuccess) {
+        batchUploaded++;
+        batchBytes += uploadSize;
+      } else {
+        batchFailures.push_back(
+            {batchIndex - 1, uploadFileName, uploadError.isEmpty() ? "Unknown error during upload" : uploadError});
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
     if (uploadFile) {
       uploadFile.close();
       // Try to delete the incomplete file
-      String filePath = uploadPath;
-      if (!filePath.endsWith("/")) filePath += "/";
-      filePath += uploadFileName;
-      SdMan.remove(filePath.c_str());
+      SdMan.remove(getUploadFilePath().c_str());
     }
+    // The request ends here without reaching handleUploadPost()/handleBatchUploadPost()
+    listingCache.invalidate(uploadPath.c_str());
+    batchActive = false;
     uploadError = "Upload aborted";
     Serial.printf("[%lu] [WEB] Upload aborted\n", millis());
   }
@@ -424,7 +676,40 @@ void CrossPointWebServer::handleUploadPost() const {
   }
 }
 
-void CrossPointWebServer::handleCreateFolder() const {
+void CrossPointWebServer::handleBatchUploadPost() {
+  if (!batchActive) {
+    server->send(400, "text/plain", "No files received");
+    return;
+  }
+  batchActive = false;
+  // The listing is refreshed once for the whole batch rather than after every file
+  listingCache.invalidate(uploadPath.c_str());
+
+  const unsigned long elapsed = millis() - batchStartTime;
+  Serial.printf("[%lu] [WEB] [UPLOAD] Batch complete: %u/%u files, %u bytes in %lu ms (%.1f books/min)\n", millis(),
+                batchUploaded, batchIndex, batchBytes, elapsed,
+                elapsed > 0 ? batchUploaded * 60000.0 / elapsed : 0.0);
+
+  JsonDocument doc;
+  doc["uploaded"] = batchUploaded;
+  doc["bytes"] = batchBytes;
+  doc["ms"] = elapsed;
+  JsonArray failed = doc["failed"].to<JsonArray>();
+  for (const auto& failure : batchFailures) {
+    JsonObject entry = failed.add<JsonObject>();
+    entry["index"] = failure.index;
+    entry["name"] = failure.name;
+    entry["error"] = failure.error;
+  }
+  batchSizes.clear();
+  batchFailures.clear();
+
+  String json;
+  serializeJson(doc, json);
+  server->send(200, "application/json", json);
+}
+
+void CrossPointWebServer::handleCreateFolder() {
   // Get folder name from form data
   if (!server->hasArg("name")) {
     server->send(400, "text/plain", "Missing folder name");
@@ -466,6 +751,8 @@ void CrossPointWebServer::handleCreateFolder() const {
 
   // Create the folder
   if (SdMan.mkdir(folderPath.c_str())) {
+    listingCache.invalidate(parentPath.c_str());
+    listingCache.invalidate(folderPath.c_str());
     Serial.printf("[%lu] [WEB] Folder created successfully: %s\n", millis(), folderPath.c_str());
     server->send(200, "text/plain", "Folder created: " + folderName);
   } else {
@@ -474,7 +761,7 @@ void CrossPointWebServer::handleCreateFolder() const {
   }
 }
 
-void CrossPointWebServer::handleDelete() const {
+void CrossPointWebServer::handleDelete() {
   // Get path from form data
   if (!server->hasArg("path")) {
     server->send(400, "text/plain", "Missing path");
@@ -548,6 +835,8 @@ void CrossPointWebServer::handleDelete() const {
   }
 
   if (success) {
+    listingCache.invalidate(getParentPath(itemPath).c_str());
+    listingCache.invalidate(itemPath.c_str());
     Serial.printf("[%lu] [WEB] Successfully deleted: %s\n", millis(), itemPath.c_str());
     server->send(200, "text/plain", "Deleted successfully");
   } else {
@@ -4,6 +4,8 @@
 
 #include <vector>
 
+#include "FileListingCache.h"
+
 // Structure to hold file information
 struct FileInfo {
   String name;
@@ -37,20 +39,28 @@ class CrossPointWebServer {
   bool running = false;
   bool apMode = false;  // true when running in AP mode, false for STA mode
   uint16_t port = 80;
+  FileListingCache listingCache;
 
   // File scanning
   void scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const;
   String formatFileSize(size_t bytes) const;
   bool isEpubFile(const String& filename) const;
 
+  // Sends an embedded page (see scripts/build_html.py), honouring If-None-Match and Accept-Encoding. `etag` names the
+  // gzipped body and `identityEtag` the inflated one.
+  void sendPage(const uint8_t* gzipped, size_t gzippedLength, size_t length, const char* etag,
+                const char* identityEtag) const;
+
   // Request handlers
   void handleRoot() const;
   void handleNotFound() const;
   void handleStatus() const;
   void handleFileList() const;
-  void handleFileListData() const;
-  void handleUpload() const;
+  void handleFileListData();
+  // Receives the file parts of /upload (one file) and /upload/batch (several files in one request)
+  void handleUpload(bool batch);
   void handleUploadPost() const;
-  void handleCreateFolder() const;
-  void handleDelete() const;
+  void handleBatchUploadPost();
+  void handleCreateFolder();
+  void handleDelete();
 };
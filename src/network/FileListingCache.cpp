@@ -0,0 +1,262 @@
+#include "FileListingCache.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cctype>
+#include <numeric>
+
+namespace {
+constexpr char LISTING_DIR[] = "/.crosspoint/web";
+constexpr uint32_t LISTING_MAGIC = 0x42455743;  // "CWEB"
+constexpr uint8_t LISTING_FILE_VERSION = 1;
+// magic, version, padding, entry count, folder count, padding, total size, names offset
+constexpr uint32_t HEADER_SIZE = 4 + 1 + 1 + 2 + 2 + 2 + 8 + 4;
+
+int compareIgnoreCase(const std::string& text1, const std::string& text2) {
+  const size_t length = std::min(text1.size(), text2.size());
+  for (size_t i = 0; i < length; i++) {
+    const int char1 = tolower(static_cast<unsigned char>(text1[i]));
+    const int char2 = tolower(static_cast<unsigned char>(text2[i]));
+    if (char1 != char2) {
+      return char1 < char2 ? -1 : 1;
+    }
+  }
+  return text1.size() == text2.size() ? 0 : (text1.size() < text2.size() ? -1 : 1);
+}
+
+std::string getExtension(const std::string& name) {
+  const size_t dot = name.rfind('.');
+  return dot == std::string::npos ? std::string() : name.substr(dot + 1);
+}
+}  // namespace
+
+std::string FileListingCache::getListingPath(const std::string& dirPath) {
+  return std::string(LISTING_DIR) + "/dir_" + std::to_string(std::hash<std::string>{}(dirPath)) + ".bin";
+}
+
+void FileListingCache::sortOrder(const std::vector<Entry>& entries, const Sort sort, const bool descending,
+                                 std::vector<uint16_t>& order) {
+  order.resize(entries.size());
+  std::iota(order.begin(), order.end(), 0);
+
+  const auto group = [sort](const Entry& entry) {
+    if (entry.isDirectory) return 0;
+    if (sort == Sort::Name && entry.isEpub) return 1;
+    return 2;
+  };
+  std::sort(order.begin(), order.end(), [&entries, &group, sort, descending](const uint16_t index1,
+                                                                           const uint16_t index2) {
+    const Entry& entry1 = entries[index1];
+    const Entry& entry2 = entries[index2];
+    const int group1 = group(entry1);
+    const int group2 = group(entry2);
+    if (group1 != group2) return group1 < group2;
+
+    int comparison = 0;
+    if (sort == Sort::Size && entry1.size != entry2.size) {
+      comparison = entry1.size < entry2.size ? -1 : 1;
+    } else if (sort == Sort::Type) {
+      comparison = compareIgnoreCase(getExtension(entry1.name), getExtension(entry2.name));
+    }
+    if (comparison == 0) {
+      comparison = compareIgnoreCase(entry1.name, entry2.name);
+    }
+    return descending ? comparison > 0 : comparison < 0;
+  });
+}
+
+bool FileListingCache::isValid(const std::string& dirPath) const {
+  return std::find(validDirs.begin(), validDirs.end(), dirPath) != validDirs.end();
+}
+
+bool FileListingCache::open(const std::string& dirPath) {
+  if (dirPath == this->dirPath && !memoryEntries.empty()) {
+    return true;
+  }
+  close();
+  memoryEntries.clear();
+  this->dirPath = dirPath;
+  count = 0;
+  folderCount = 0;
+  totalSize = 0;
+  if (!isValid(dirPath)) {
+    return false;
+  }
+
+  file = SdMan.open(getListingPath(dirPath).c_str());
+  if (!file) {
+    return false;
+  }
+
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  uint8_t padding = 0;
+  uint16_t padding2 = 0;
+  if (file.size() >= HEADER_SIZE) {
+    serialization::readPod(file, magic);
+    serialization::readPod(file, version);
+    serialization::readPod(file, padding);
+    serialization::readPod(file, count);
+    serialization::readPod(file, folderCount);
+    serialization::readPod(file, padding2);
+    serialization::readPod(file, totalSize);
+    serialization::readPod(file, namesOffset);
+  }
+
+  if (magic != LISTING_MAGIC || version != LISTING_FILE_VERSION ||
+      namesOffset != HEADER_SIZE + count * (sizeof(Record) + ORDER_COUNT * sizeof(uint16_t)) ||
+      file.size() < namesOffset) {
+    Serial.printf("[%lu] [WEB] Ignoring invalid listing for %s\n", millis(), dirPath.c_str());
+    close();
+    count = 0;
+    return false;
+  }
+  return true;
+}
+
+void FileListingCache::close() {
+  if (file) {
+    file.close();
+  }
+}
+
+void FileListingCache::invalidate(const std::string& dirPath) {
+  validDirs.erase(std::remove(validDirs.begin(), validDirs.end(), dirPath), validDirs.end());
+  if (dirPath == this->dirPath) {
+    close();
+    memoryEntries.clear();
+    this->dirPath.clear();
+    count = 0;
+  }
+}
+
+bool FileListingCache::rebuild(const std::string& dirPath, std::vector<Entry>& entries) {
+  const unsigned long start = millis();
+  invalidate(dirPath);
+  if (entries.size() > UINT16_MAX) {
+    entries.resize(UINT16_MAX);
+  }
+
+  if (writeListing(getListingPath(dirPath), entries)) {
+    validDirs.push_back(dirPath);
+    if (open(dirPath)) {
+      Serial.printf("[%lu] [WEB] Listed %u entries of %s in %lu ms\n", millis(), count, dirPath.c_str(),
+                    millis() - start);
+      return true;
+    }
+    validDirs.pop_back();
+  }
+
+  Serial.printf("[%lu] [WEB] Failed to store listing for %s, keeping it in memory\n", millis(), dirPath.c_str());
+  for (int sort = 0; sort < static_cast<int>(Sort::COUNT); sort++) {
+    for (const bool descending : {false, true}) {
+      const auto order = static_cast<Sort>(sort);
+      sortOrder(entries, order, descending, memoryOrders[orderIndex(order, descending)]);
+    }
+  }
+  this->dirPath = dirPath;
+  count = static_cast<uint16_t>(entries.size());
+  folderCount = static_cast<uint16_t>(
+      std::count_if(entries.begin(), entries.end(), [](const Entry& entry) { return entry.isDirectory; }));
+  totalSize = 0;
+  for (const auto& entry : entries) {
+    totalSize += entry.size;
+  }
+  memoryEntries = std::move(entries);
+  return true;
+}
+
+bool FileListingCache::writeListing(const std::string& path, const std::vector<Entry>& entries) {
+  SdMan.mkdir(LISTING_DIR);
+  const std::string tmpPath = path + ".tmp";
+  FsFile out;
+  if (!SdMan.openFileForWrite("WEB", tmpPath, out)) {
+    return false;
+  }
+
+  const auto entryCount = static_cast<uint16_t>(entries.size());
+  uint16_t entriesFolderCount = 0;
+  uint64_t entriesTotalSize = 0;
+  for (const auto& entry : entries) {
+    entriesFolderCount += entry.isDirectory;
+    entriesTotalSize += entry.size;
+  }
+  serialization::writePod(out, LISTING_MAGIC);
+  serialization::writePod(out, LISTING_FILE_VERSION);
+  serialization::writePod(out, static_cast<uint8_t>(0));
+  serialization::writePod(out, entryCount);
+  serialization::writePod(out, entriesFolderCount);
+  serialization::writePod(out, static_cast<uint16_t>(0));
+  serialization::writePod(out, entriesTotalSize);
+  serialization::writePod(out, static_cast<uint32_t>(HEADER_SIZE +
+                                                     entryCount * (sizeof(Record) + ORDER_COUNT * sizeof(uint16_t))));
+
+  bool ok = true;
+  uint32_t nameOffset = 0;
+  for (const auto& entry : entries) {
+    Record record = {};
+    record.nameOffset = nameOffset;
+    record.size = entry.size;
+    record.nameLength = static_cast<uint16_t>(entry.name.size());
+    record.flags = (entry.isDirectory ? FLAG_DIRECTORY : 0) | (entry.isEpub ? FLAG_EPUB : 0);
+    ok = ok && out.write(reinterpret_cast<const uint8_t*>(&record), sizeof(record)) == sizeof(record);
+    nameOffset += record.nameLength;
+  }
+
+  // One order at a time, so only one is held in memory
+  std::vector<uint16_t> order;
+  for (int sort = 0; ok && sort < static_cast<int>(Sort::COUNT); sort++) {
+    for (const bool descending : {false, true}) {
+      sortOrder(entries, static_cast<Sort>(sort), descending, order);
+      const size_t bytes = order.size() * sizeof(uint16_t);
+      ok = ok && out.write(reinterpret_cast<const uint8_t*>(order.data()), bytes) == bytes;
+    }
+  }
+
+  for (const auto& entry : entries) {
+    ok = ok && out.write(reinterpret_cast<const uint8_t*>(entry.name.data()), entry.name.size()) == entry.name.size();
+  }
+
+  if (ok) {
+    SdMan.remove(path.c_str());
+    ok = out.rename(path.c_str());
+  }
+  out.close();
+  if (!ok) {
+    SdMan.remove(tmpPath.c_str());
+  }
+  return ok;
+}
+
+bool FileListingCache::readEntry(const Sort sort, const bool descending, const size_t position, Entry& entry) {
+  if (position >= count) {
+    return false;
+  }
+  const int order = orderIndex(sort, descending);
+  if (!memoryEntries.empty()) {
+    entry = memoryEntries[memoryOrders[order][position]];
+    return true;
+  }
+
+  uint16_t index = 0;
+  Record record;
+  if (!file.seek(HEADER_SIZE + count * sizeof(Record) + (order * count + position) * sizeof(uint16_t)) ||
+      file.read(&index, sizeof(index)) != static_cast<int>(sizeof(index)) || index >= count ||
+      !file.seek(HEADER_SIZE + index * sizeof(Record)) ||
+      file.read(&record, sizeof(record)) != static_cast<int>(sizeof(record))) {
+    return false;
+  }
+
+  entry.name.resize(record.nameLength);
+  if (!file.seek(namesOffset + record.nameOffset) ||
+      file.read(&entry.name[0], record.nameLength) != record.nameLength) {
+    return false;
+  }
+  entry.size = record.size;
+  entry.isDirectory = record.flags & FLAG_DIRECTORY;
+  entry.isEpub = record.flags & FLAG_EPUB;
+  return true;
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Sorted directory listings for the web file manager, stored in /.crosspoint/web/dir_<hash>.bin.
+ *
+ * A listing holds a header with the directory totals, one fixed-size record per entry, the entry positions in every
+ * supported order and the entry names. A page of entries in any order is read with a few seeks per entry, so the file
+ * manager neither enumerates nor sorts the directory again on every request.
+ *
+ * Listings are only trusted within the lifetime of the cache object (one web server session), during which the server
+ * is the only writer on the card; its upload, mkdir and delete handlers drop the listings they change. If a listing
+ * cannot be written, the entries are kept in memory for that directory instead.
+ */
+class FileListingCache {
+ public:
+  enum class Sort : uint8_t { Name, Size, Type, COUNT };
+
+  struct Entry {
+    std::string name;
+    uint32_t size;
+    bool isDirectory;
+    bool isEpub;
+  };
+
+  FileListingCache() = default;
+  ~FileListingCache() { close(); }
+
+  FileListingCache(const FileListingCache&) = delete;
+  FileListingCache& operator=(const FileListingCache&) = delete;
+
+  // Opens the listing of a directory built during this session, returns false if there is none (call rebuild())
+  bool open(const std::string& dirPath);
+  // Sorts and stores the entries as the directory's listing and opens it
+  bool rebuild(const std::string& dirPath, std::vector<Entry>& entries);
+  void close();
+  // Drops the listing of a directory after its contents changed
+  void invalidate(const std::string& dirPath);
+
+  size_t getCount() const { return count; }
+  size_t getFolderCount() const { return folderCount; }
+  uint64_t getTotalSize() const { return totalSize; }
+
+  // Reads the entry at `position` of the listing sorted by `sort`. Folders always come first; for Sort::Name, EPUBs
+  // come before other files. `descending` reverses the order within these groups.
+  bool readEntry(Sort sort, bool descending, size_t position, Entry& entry);
+
+ private:
+  static constexpr int ORDER_COUNT = static_cast<int>(Sort::COUNT) * 2;
+  static constexpr uint8_t FLAG_DIRECTORY = 1;
+  static constexpr uint8_t FLAG_EPUB = 2;
+
+  struct Record {
+    uint32_t nameOffset;  // Relative to the names section
+    uint32_t size;
+    uint16_t nameLength;
+    uint8_t flags;
+    uint8_t reserved;
+  };
+
+  static std::string getListingPath(const std::string& dirPath);
+  static void sortOrder(const std::vector<Entry>& entries, Sort sort, bool descending, std::vector<uint16_t>& order);
+  static int orderIndex(const Sort sort, const bool descending) { return static_cast<int>(sort) * 2 + descending; }
+  bool isValid(const std::string& dirPath) const;
+  bool writeListing(const std::string& path, const std::vector<Entry>& entries);
+
+  std::vector<std::string> validDirs;  // Directories whose stored listing was built this session
+  std::string dirPath;
+  FsFile file;
+  uint16_t count = 0;
+  uint16_t folderCount = 0;
+  uint64_t totalSize = 0;
+  uint32_t namesOffset = 0;
+  // Fallback when the listing could not be written: the entries and their orders, kept for one directory
+  std::vector<Entry> memoryEntries;
+  std::vector<uint16_t> memoryOrders[ORDER_COUNT];
+};
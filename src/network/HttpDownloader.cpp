@@ -2,127 +2,362 @@
 
 #include <HTTPClient.h>
 #include <HardwareSerial.h>
+#include <Serialization.h>
 #include <WiFiClientSecure.h>
 
+#include <cstdlib>
 #include <memory>
 
-bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent) {
-  const std::unique_ptr<WiFiClientSecure> client(new WiFiClientSecure());
-  client->setInsecure();
-  HTTPClient http;
+namespace {
+constexpr uint32_t PART_META_MAGIC = 0x54524150;  // "PART"
 
-  Serial.printf("[%lu] [HTTP] Fetching: %s\n", millis(), url.c_str());
+// Collects a streamed body into a string, for the callers that need it whole
+class StringPrint final : public Print {
+  std::string& out;
+
+ public:
+  explicit StringPrint(std::string& out) : out(out) {}
+  size_t write(const uint8_t byte) override {
+    out.push_back(static_cast<char>(byte));
+    return 1;
+  }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    out.append(reinterpret_cast<const char*>(buffer), size);
+    return size;
+  }
+};
 
-  http.begin(*client, url.c_str());
+bool readPartMeta(const std::string& metaPath, std::string& etag, uint32_t& total) {
+  FsFile meta;
+  if (!SdMan.exists(metaPath.c_str()) || !SdMan.openFileForRead("HTTP", metaPath, meta)) {
+    return false;
+  }
+  uint32_t magic = 0;
+  serialization::readPod(meta, magic);
+  if (magic != PART_META_MAGIC) {
+    meta.close();
+    return false;
+  }
+  serialization::readPod(meta, total);
+  serialization::readString(meta, etag);
+  meta.close();
+  return true;
+}
+
+bool writePartMeta(const std::string& metaPath, const std::string& etag, const uint32_t total) {
+  FsFile meta;
+  if (!SdMan.openFileForWrite("HTTP", metaPath, meta)) {
+    return false;
+  }
+  serialization::writePod(meta, PART_META_MAGIC);
+  serialization::writePod(meta, total);
+  serialization::writeString(meta, etag);
+  meta.close();
+  return true;
+}
+
+// Parses "bytes <start>-<end>/<total>"
+bool parseContentRange(const String& header, size_t& start, size_t& total) {
+  const int dash = header.indexOf('-');
+  const int slash = header.indexOf('/');
+  if (!header.startsWith("bytes ") || dash < 0 || slash < dash) {
+    return false;
+  }
+  start = strtoul(header.c_str() + 6, nullptr, 10);
+  total = strtoul(header.c_str() + slash + 1, nullptr, 10);
+  return total > 0;
+}
+}  // namespace
+
+void HttpDownloader::beginRequest(HTTPClient& http, WiFiClient& client, const std::string& url) {
+  http.begin(client, url.c_str());
   http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
   http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
+}
 
-  const int httpCode = http.GET();
-  if (httpCode != HTTP_CODE_OK) {
-    Serial.printf("[%lu] [HTTP] Fetch failed: %d\n", millis(), httpCode);
-    http.end();
-    return false;
+size_t HttpDownloader::streamBody(WiFiClient& stream, Print& out, uint8_t* buffer, const int length,
+                                  bool* writeFailed, const std::function<void(size_t copied)>& onChunk) {
+  size_t copied = 0;
+  size_t filled = 0;
+  unsigned long lastDataTime = millis();
+  *writeFailed = false;
+
+  while (length < 0 || copied < static_cast<size_t>(length)) {
+    const int available = stream.available();
+    if (available > 0) {
+      size_t toRead = DOWNLOAD_BUFFER_SIZE - filled;
+      if (static_cast<size_t>(available) < toRead) {
+        toRead = available;
+      }
+      if (length >= 0 && length - copied - filled < toRead) {
+        toRead = length - copied - filled;
+      }
+      const int bytesRead = stream.read(buffer + filled, toRead);
+      if (bytesRead > 0) {
+        filled += bytesRead;
+        lastDataTime = millis();
+      }
+      const bool complete = length >= 0 && copied + filled >= static_cast<size_t>(length);
+      if (filled < DOWNLOAD_BUFFER_SIZE && !complete) {
+        continue;
+      }
+    } else if (filled == 0) {
+      if (!stream.connected() || millis() - lastDataTime > IDLE_TIMEOUT_MS) {
+        break;
+      }
+      delay(1);
+      continue;
+    }
+
+    // Buffer full, body complete or the socket ran dry: write out what has arrived so far
+    if (out.write(buffer, filled) != filled) {
+      Serial.printf("[%lu] [HTTP] Write failed after %zu bytes\n", millis(), copied);
+      *writeFailed = true;
+      break;
+    }
+    copied += filled;
+    filled = 0;
+    if (onChunk) {
+      onChunk(copied);
+    }
   }
 
-  outContent = http.getString().c_str();
-  http.end();
+  return copied;
+}
+
+bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent) {
+  outContent.clear();
+  StringPrint out(outContent);
+  if (!fetchUrl(url, out)) {
+    return false;
+  }
 
   Serial.printf("[%lu] [HTTP] Fetched %zu bytes\n", millis(), outContent.size());
   return true;
 }
 
-HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string& url, const std::string& destPath,
-                                                             ProgressCallback progress) {
+bool HttpDownloader::fetchUrl(const std::string& url, Print& out) {
+  return fetch(url, out, nullptr, nullptr) == FetchResult::Ok;
+}
+
+HttpDownloader::FetchResult HttpDownloader::fetchUrlIfModified(const std::string& url, Print& out, std::string& etag,
+                                                               std::string& lastModified) {
+  return fetch(url, out, &etag, &lastModified);
+}
+
+HttpDownloader::FetchResult HttpDownloader::fetch(const std::string& url, Print& out, std::string* etag,
+                                                  std::string* lastModified) {
   const std::unique_ptr<WiFiClientSecure> client(new WiFiClientSecure());
   client->setInsecure();
   HTTPClient http;
 
-  Serial.printf("[%lu] [HTTP] Downloading: %s\n", millis(), url.c_str());
-  Serial.printf("[%lu] [HTTP] Destination: %s\n", millis(), destPath.c_str());
+  Serial.printf("[%lu] [HTTP] Fetching: %s\n", millis(), url.c_str());
 
-  http.begin(*client, url.c_str());
-  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
+  // HTTP/1.0 keeps the server from using chunked encoding, so the raw stream is the body
+  http.useHTTP10(true);
+  beginRequest(http, *client, url);
+  if (etag && !etag->empty()) {
+    http.addHeader("If-None-Match", etag->c_str());
+  }
+  if (lastModified && !lastModified->empty()) {
+    http.addHeader("If-Modified-Since", lastModified->c_str());
+  }
+  const char* headerKeys[] = {"ETag", "Last-Modified"};
+  http.collectHeaders(headerKeys, 2);
 
   const int httpCode = http.GET();
+  if (httpCode == HTTP_CODE_NOT_MODIFIED && ((etag && !etag->empty()) || (lastModified && !lastModified->empty()))) {
+    Serial.printf("[%lu] [HTTP] Not modified\n", millis());
+    http.end();
+    return FetchResult::NotModified;
+  }
   if (httpCode != HTTP_CODE_OK) {
-    Serial.printf("[%lu] [HTTP] Download failed: %d\n", millis(), httpCode);
+    Serial.printf("[%lu] [HTTP] Fetch failed: %d\n", millis(), httpCode);
     http.end();
-    return HTTP_ERROR;
+    return FetchResult::Failed;
   }
 
-  const size_t contentLength = http.getSize();
-  Serial.printf("[%lu] [HTTP] Content-Length: %zu\n", millis(), contentLength);
+  auto* buffer = static_cast<uint8_t*>(malloc(DOWNLOAD_BUFFER_SIZE));
+  if (!buffer) {
+    Serial.printf("[%lu] [HTTP] Failed to allocate download buffer\n", millis());
+    http.end();
+    return FetchResult::Failed;
+  }
 
-  // Remove existing file if present
-  if (SdMan.exists(destPath.c_str())) {
-    SdMan.remove(destPath.c_str());
+  const int contentLength = http.getSize();
+  bool writeFailed;
+  const size_t received = streamBody(*http.getStreamPtr(), out, buffer, contentLength, &writeFailed, nullptr);
+  free(buffer);
+  if (etag) {
+    *etag = http.header("ETag").c_str();
   }
+  if (lastModified) {
+    *lastModified = http.header("Last-Modified").c_str();
+  }
+  http.end();
 
-  // Open file for writing
-  FsFile file;
-  if (!SdMan.openFileForWrite("HTTP", destPath.c_str(), file)) {
-    Serial.printf("[%lu] [HTTP] Failed to open file for writing\n", millis());
-    http.end();
+  if (writeFailed || (contentLength >= 0 && received != static_cast<size_t>(contentLength))) {
+    Serial.printf("[%lu] [HTTP] Fetch incomplete: got %zu of %d bytes\n", millis(), received, contentLength);
+    return FetchResult::Failed;
+  }
+  return FetchResult::Ok;
+}
+
+HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string& url, const std::string& destPath,
+                                                             ProgressCallback progress) {
+  Serial.printf("[%lu] [HTTP] Downloading: %s\n", millis(), url.c_str());
+  Serial.printf("[%lu] [HTTP] Destination: %s\n", millis(), destPath.c_str());
+
+  // One buffer for all attempts, so the socket is drained and the SD card written in large blocks
+  auto* buffer = static_cast<uint8_t*>(malloc(DOWNLOAD_BUFFER_SIZE));
+  if (!buffer) {
+    Serial.printf("[%lu] [HTTP] Failed to allocate download buffer\n", millis());
     return FILE_ERROR;
   }
 
-  // Get the stream for chunked reading
-  WiFiClient* stream = http.getStreamPtr();
-  if (!stream) {
-    Serial.printf("[%lu] [HTTP] Failed to get stream\n", millis());
-    file.close();
-    SdMan.remove(destPath.c_str());
-    http.end();
-    return HTTP_ERROR;
+  DownloadError result = INCOMPLETE;
+  for (int attempt = 1; attempt <= MAX_ATTEMPTS && result == INCOMPLETE; attempt++) {
+    if (attempt > 1) {
+      Serial.printf("[%lu] [HTTP] Retrying download (attempt %d of %d)\n", millis(), attempt, MAX_ATTEMPTS);
+      delay(1000 * (attempt - 1));
+    }
+    result = downloadAttempt(url, destPath, buffer, progress);
   }
 
-  // Download in chunks
-  uint8_t buffer[DOWNLOAD_CHUNK_SIZE];
-  size_t downloaded = 0;
-  const size_t total = contentLength > 0 ? contentLength : 0;
+  free(buffer);
+  return result;
+}
 
-  while (http.connected() && (contentLength == 0 || downloaded < contentLength)) {
-    const size_t available = stream->available();
-    if (available == 0) {
-      delay(1);
-      continue;
-    }
+HttpDownloader::DownloadError HttpDownloader::downloadAttempt(const std::string& url, const std::string& destPath,
+                                                              uint8_t* buffer, const ProgressCallback& progress) {
+  const std::string partPath = destPath + ".part";
+  const std::string metaPath = destPath + ".part.meta";
 
-    const size_t toRead = available < DOWNLOAD_CHUNK_SIZE ? available : DOWNLOAD_CHUNK_SIZE;
-    const size_t bytesRead = stream->readBytes(buffer, toRead);
+  FsFile file = SdMan.open(partPath.c_str(), O_RDWR | O_CREAT);
+  if (!file) {
+    Serial.printf("[%lu] [HTTP] Failed to open file for writing\n", millis());
+    return FILE_ERROR;
+  }
 
-    if (bytesRead == 0) {
-      break;
+  // Only resume a partial file whose total size is known, so the ranged response can be checked against it
+  std::string etag;
+  uint32_t total = 0;
+  size_t offset = file.size();
+  if (offset > 0 && (!readPartMeta(metaPath, etag, total) || total == 0 || offset > total)) {
+    offset = 0;
+  }
+
+  const std::unique_ptr<WiFiClientSecure> client(new WiFiClientSecure());
+  client->setInsecure();
+  HTTPClient http;
+  beginRequest(http, *client, url);
+  if (offset > 0) {
+    Serial.printf("[%lu] [HTTP] Resuming from %zu of %u bytes\n", millis(), offset, total);
+    http.addHeader("Range", ("bytes=" + std::to_string(offset) + "-").c_str());
+    if (!etag.empty()) {
+      http.addHeader("If-Range", etag.c_str());
     }
+  }
+  const char* headerKeys[] = {"ETag", "Content-Range"};
+  http.collectHeaders(headerKeys, 2);
 
-    const size_t written = file.write(buffer, bytesRead);
-    if (written != bytesRead) {
-      Serial.printf("[%lu] [HTTP] Write failed: wrote %zu of %zu bytes\n", millis(), written, bytesRead);
+  const int httpCode = http.GET();
+  if (httpCode == HTTP_CODE_PARTIAL_CONTENT) {
+    size_t rangeStart = 0;
+    size_t rangeTotal = 0;
+    if (!parseContentRange(http.header("Content-Range"), rangeStart, rangeTotal) || rangeStart != offset ||
+        rangeTotal != total) {
+      Serial.printf("[%lu] [HTTP] Unexpected range response, restarting download\n", millis());
+      http.end();
+      file.truncate(0);
       file.close();
-      SdMan.remove(destPath.c_str());
+      SdMan.remove(metaPath.c_str());
+      return INCOMPLETE;
+    }
+  } else if (httpCode == HTTP_CODE_OK) {
+    // Either a fresh download or the file changed on the server (If-Range mismatch): start over
+    offset = 0;
+    const int contentLength = http.getSize();
+    total = contentLength > 0 ? contentLength : 0;
+    etag = http.header("ETag").c_str();
+    if (!file.truncate(0) || !writePartMeta(metaPath, etag, total)) {
+      Serial.printf("[%lu] [HTTP] Failed to prepare partial file\n", millis());
       http.end();
+      file.close();
+      SdMan.remove(partPath.c_str());
+      SdMan.remove(metaPath.c_str());
       return FILE_ERROR;
     }
-
-    downloaded += bytesRead;
-
-    if (progress && total > 0) {
-      progress(downloaded, total);
+  } else if (httpCode == HTTP_CODE_RANGE_NOT_SATISFIABLE && offset > 0 && offset == total) {
+    // An earlier attempt got every byte but did not get to finish the file
+    Serial.printf("[%lu] [HTTP] Partial file already complete\n", millis());
+  } else {
+    Serial.printf("[%lu] [HTTP] Download failed: %d\n", millis(), httpCode);
+    http.end();
+    file.close();
+    // Keep a partial file only while it can still be resumed, the open above may just have created it
+    if (httpCode == HTTP_CODE_RANGE_NOT_SATISFIABLE || offset == 0) {
+      SdMan.remove(partPath.c_str());
+      SdMan.remove(metaPath.c_str());
     }
+    return httpCode == HTTP_CODE_RANGE_NOT_SATISFIABLE ? INCOMPLETE : HTTP_ERROR;
   }
+  Serial.printf("[%lu] [HTTP] Content-Length: %u\n", millis(), total);
 
-  file.close();
+  size_t downloaded = offset;
+  bool writeFailed = false;
+  if (httpCode == HTTP_CODE_RANGE_NOT_SATISFIABLE) {
+    // Nothing left to receive
+  } else if (total == 0) {
+    // Unknown length, most likely chunked encoding: let HTTPClient decode it, without resume
+    const int written = http.writeToStream(&file);
+    if (written < 0) {
+      Serial.printf("[%lu] [HTTP] Download failed: %s\n", millis(), HTTPClient::errorToString(written).c_str());
+      http.end();
+      file.close();
+      SdMan.remove(partPath.c_str());
+      SdMan.remove(metaPath.c_str());
+      return HTTP_ERROR;
+    }
+    downloaded = written;
+  } else {
+    file.seek(offset);
+    downloaded += streamBody(*http.getStreamPtr(), file, buffer, total - offset, &writeFailed,
+                             [&progress, offset, total](const size_t copied) {
+                               if (progress) {
+                                 progress(offset + copied, total);
+                               }
+                             });
+  }
   http.end();
 
+  if (writeFailed) {
+    file.close();
+    SdMan.remove(partPath.c_str());
+    SdMan.remove(metaPath.c_str());
+    return FILE_ERROR;
+  }
+
   Serial.printf("[%lu] [HTTP] Downloaded %zu bytes\n", millis(), downloaded);
 
   // Verify download size if known
-  if (contentLength > 0 && downloaded != contentLength) {
-    Serial.printf("[%lu] [HTTP] Size mismatch: got %zu, expected %zu\n", millis(), downloaded, contentLength);
-    SdMan.remove(destPath.c_str());
-    return HTTP_ERROR;
+  if (total > 0 && downloaded != total) {
+    Serial.printf("[%lu] [HTTP] Connection dropped at %zu of %u bytes\n", millis(), downloaded, total);
+    file.close();
+    return INCOMPLETE;
   }
 
+  // Remove existing file if present
+  if (SdMan.exists(destPath.c_str())) {
+    SdMan.remove(destPath.c_str());
+  }
+  const bool renamed = file.rename(destPath.c_str());
+  file.close();
+  SdMan.remove(metaPath.c_str());
+  if (!renamed) {
+    Serial.printf("[%lu] [HTTP] Failed to move download into place\n", millis());
+    SdMan.remove(partPath.c_str());
+    return FILE_ERROR;
+  }
   return OK;
 }
@@ -1,12 +1,21 @@
 #pragma once
+#include <Print.h>
 #include <SDCardManager.h>
 
 #include <functional>
 #include <string>
 
+class HTTPClient;
+class WiFiClient;
+
 /**
  * HTTP client utility for fetching content and downloading files.
  * Wraps WiFiClientSecure and HTTPClient for HTTPS requests.
+ *
+ * Downloads go to "<dest>.part" first, next to a "<dest>.part.meta" file holding the server's ETag and the total
+ * size. A dropped connection keeps the partial file, and the next attempt (within the same call, or a later call for
+ * the same destination) asks for the remaining bytes with a Range request. If-Range makes the server send the whole
+ * file again instead if it changed in the meantime.
  */
 class HttpDownloader {
  public:
@@ -17,8 +26,11 @@ class HttpDownloader {
     HTTP_ERROR,
     FILE_ERROR,
     ABORTED,
+    INCOMPLETE,  // Connection dropped on every attempt; the partial file is kept for the next call to resume
   };
 
+  enum class FetchResult : uint8_t { Ok, NotModified, Failed };
+
   /**
    * Fetch text content from a URL.
    * @param url The URL to fetch
@@ -28,7 +40,26 @@ class HttpDownloader {
   static bool fetchUrl(const std::string& url, std::string& outContent);
 
   /**
-   * Download a file to the SD card.
+   * Stream the body of a URL into a sink as it arrives, without buffering it whole.
+   * @param url The URL to fetch
+   * @param out Receives the body
+   * @return true if the whole body was received, false on error
+   */
+  static bool fetchUrl(const std::string& url, Print& out);
+
+  /**
+   * Stream the body of a URL into a sink, unless it still matches a copy the caller keeps (conditional GET).
+   * @param url The URL to fetch
+   * @param out Receives the body; not written to if the copy is still current
+   * @param etag ETag of the copy, empty if unknown; replaced with the server's on Ok
+   * @param lastModified Last-Modified of the copy, empty if unknown; replaced with the server's on Ok
+   * @return NotModified if the copy is current, Ok once the whole new body was received
+   */
+  static FetchResult fetchUrlIfModified(const std::string& url, Print& out, std::string& etag,
+                                        std::string& lastModified);
+
+  /**
+   * Download a file to the SD card, resuming a partial download of the same file if there is one.
    * @param url The URL to download
    * @param destPath The destination path on SD card
    * @param progress Optional progress callback
@@ -38,5 +69,16 @@ class HttpDownloader {
                                       ProgressCallback progress = nullptr);
 
  private:
-  static constexpr size_t DOWNLOAD_CHUNK_SIZE = 1024;
+  static constexpr size_t DOWNLOAD_BUFFER_SIZE = 4096;
+  static constexpr int MAX_ATTEMPTS = 3;
+  static constexpr unsigned long IDLE_TIMEOUT_MS = 10000;
+
+  static DownloadError downloadAttempt(const std::string& url, const std::string& destPath, uint8_t* buffer,
+                                       const ProgressCallback& progress);
+  // Copies up to `length` bytes of body (all of it until the connection closes if negative) from `stream` to `out`
+  static size_t streamBody(WiFiClient& stream, Print& out, uint8_t* buffer, int length, bool* writeFailed,
+                           const std::function<void(size_t copied)>& onChunk);
+  static void beginRequest(HTTPClient& http, WiFiClient& client, const std::string& url);
+  // Validators are only sent and updated when given
+  static FetchResult fetch(const std::string& url, Print& out, std::string* etag, std::string* lastModified);
 };
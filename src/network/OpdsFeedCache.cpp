@@ -0,0 +1,194 @@
+#include "OpdsFeedCache.h"
+
+#include <HardwareSerial.h>
+#include <OpdsParser.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+
+#include <algorithm>
+
+namespace {
+constexpr char FEED_DIR[] = "/.crosspoint/opds";
+constexpr uint32_t FEED_MAGIC = 0x44504F43;  // "COPD"
+constexpr uint8_t FEED_FILE_VERSION = 2;
+
+// Like serialization::readString, but a length running past the end of the file fails instead of allocating it
+bool readField(FsFile& file, std::string& value) {
+  uint32_t length = 0;
+  serialization::readPod(file, length);
+  if (length > static_cast<uint32_t>(file.available())) {
+    return false;
+  }
+  value.resize(length);
+  return length == 0 || file.read(&value[0], length) == static_cast<int>(length);
+}
+
+bool readHeader(FsFile& file, uint32_t& entryCount, uint32_t& stamp) {
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  uint8_t padding = 0;
+  uint16_t padding2 = 0;
+  serialization::readPod(file, magic);
+  serialization::readPod(file, version);
+  serialization::readPod(file, padding);
+  serialization::readPod(file, padding2);
+  serialization::readPod(file, entryCount);
+  serialization::readPod(file, stamp);
+  return magic == FEED_MAGIC && version == FEED_FILE_VERSION;
+}
+}  // namespace
+
+std::string OpdsFeedCache::getPagePath(const std::string& url) {
+  return std::string(FEED_DIR) + "/feed_" + std::to_string(std::hash<std::string>{}(url)) + ".bin";
+}
+
+bool OpdsFeedCache::isFresh(const std::string& url) const {
+  return std::find(freshPages.begin(), freshPages.end(), std::hash<std::string>{}(url)) != freshPages.end();
+}
+
+void OpdsFeedCache::markFresh(const std::string& url) {
+  if (!isFresh(url)) {
+    freshPages.push_back(std::hash<std::string>{}(url));
+  }
+}
+
+bool OpdsFeedCache::load(const std::string& url, OpdsParser& feed, Validators& validators) const {
+  const std::string path = getPagePath(url);
+  FsFile file;
+  if (!SdMan.exists(path.c_str()) || !SdMan.openFileForRead("OPDS", path, file)) {
+    return false;
+  }
+
+  uint32_t entryCount = 0;
+  uint32_t stamp = 0;
+  std::string storedUrl;
+  std::string nextHref;
+  bool ok = readHeader(file, entryCount, stamp) && readField(file, storedUrl) && storedUrl == url &&
+            readField(file, validators.etag) && readField(file, validators.lastModified) &&
+            readField(file, nextHref);
+
+  // Read the whole page before handing it over, so a damaged file adds nothing
+  std::vector<OpdsEntry> entries;
+  for (uint32_t i = 0; ok && i < entryCount; i++) {
+    OpdsEntry entry;
+    uint8_t type = 0;
+    serialization::readPod(file, type);
+    entry.type = type == static_cast<uint8_t>(OpdsEntryType::BOOK) ? OpdsEntryType::BOOK : OpdsEntryType::NAVIGATION;
+    ok = readField(file, entry.title) && readField(file, entry.author) && readField(file, entry.href) &&
+         readField(file, entry.id);
+    if (ok) {
+      entries.push_back(std::move(entry));
+    }
+  }
+  file.close();
+
+  if (!ok) {
+    Serial.printf("[%lu] [OPDS] Ignoring invalid cached page for %s\n", millis(), url.c_str());
+    return false;
+  }
+  for (const auto& entry : entries) {
+    feed.addEntry(entry);
+  }
+  feed.setNextHref(nextHref);
+  Serial.printf("[%lu] [OPDS] Loaded %u cached entries for %s\n", millis(), entryCount, url.c_str());
+  return true;
+}
+
+bool OpdsFeedCache::store(const std::string& url, const OpdsParser& feed, const size_t firstEntry,
+                          const Validators& validators) {
+  markFresh(url);
+
+  SdMan.mkdir(FEED_DIR);
+  const std::string path = getPagePath(url);
+  const std::string tmpPath = path + ".tmp";
+  const uint32_t stamp = makeRoom(path);
+  FsFile file;
+  if (!SdMan.openFileForWrite("OPDS", tmpPath, file)) {
+    return false;
+  }
+
+  const size_t entryCount = feed.getEntryCount() > firstEntry ? feed.getEntryCount() - firstEntry : 0;
+  serialization::writePod(file, FEED_MAGIC);
+  serialization::writePod(file, FEED_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(0));
+  serialization::writePod(file, static_cast<uint16_t>(0));
+  serialization::writePod(file, static_cast<uint32_t>(entryCount));
+  serialization::writePod(file, stamp);
+  serialization::writeString(file, url);
+  serialization::writeString(file, validators.etag);
+  serialization::writeString(file, validators.lastModified);
+  serialization::writeString(file, feed.getNextHref());
+  for (size_t i = firstEntry; i < feed.getEntryCount(); i++) {
+    const OpdsEntry entry = feed.getEntry(i);
+    serialization::writePod(file, static_cast<uint8_t>(entry.type));
+    serialization::writeString(file, entry.title);
+    serialization::writeString(file, entry.author);
+    serialization::writeString(file, entry.href);
+    serialization::writeString(file, entry.id);
+  }
+
+  // The writes above do not report errors, the file keeps a flag instead
+  bool ok = !file.getWriteError();
+  if (ok) {
+    SdMan.remove(path.c_str());
+    ok = file.rename(path.c_str());
+  }
+  file.close();
+  if (!ok) {
+    Serial.printf("[%lu] [OPDS] Failed to cache page for %s\n", millis(), url.c_str());
+    SdMan.remove(tmpPath.c_str());
+  }
+  return ok;
+}
+
+uint32_t OpdsFeedCache::makeRoom(const std::string& path) {
+  FsFile dir = SdMan.open(FEED_DIR);
+  if (!dir || !dir.isDirectory()) {
+    return 1;
+  }
+
+  // Files that are not pages of this version (older formats, leftover .tmp files) go as well
+  std::vector<std::string> unusable;
+  std::string oldestPath;
+  uint32_t oldestStamp = 0;
+  uint32_t newestStamp = 0;
+  int pageCount = 0;
+  char name[32];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (file.isDirectory()) {
+      file.close();
+      continue;
+    }
+    file.getName(name, sizeof(name));
+    const std::string filePath = std::string(FEED_DIR) + "/" + name;
+    uint32_t entryCount = 0;
+    uint32_t stamp = 0;
+    const bool isTmp = filePath.size() > 4 && filePath.compare(filePath.size() - 4, 4, ".tmp") == 0;
+    const bool isPage = !isTmp && readHeader(file, entryCount, stamp);
+    file.close();
+    if (!isPage) {
+      unusable.push_back(filePath);
+      continue;
+    }
+    newestStamp = std::max(newestStamp, stamp);
+    // The page being replaced does not take another slot
+    if (filePath == path) {
+      continue;
+    }
+    pageCount++;
+    if (oldestPath.empty() || stamp < oldestStamp) {
+      oldestPath = filePath;
+      oldestStamp = stamp;
+    }
+  }
+  dir.close();
+
+  for (const auto& filePath : unusable) {
+    SdMan.remove(filePath.c_str());
+  }
+  if (pageCount >= MAX_PAGES) {
+    Serial.printf("[%lu] [OPDS] Cache full, removing %s\n", millis(), oldestPath.c_str());
+    SdMan.remove(oldestPath.c_str());
+  }
+  return newestStamp + 1;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class OpdsParser;
+
+/**
+ * Parsed OPDS feed pages, stored in /.crosspoint/opds/feed_<hash>.bin by page URL.
+ *
+ * A page file holds the page's entries as the browser shows them, its link to the next page and the server's ETag
+ * and Last-Modified, so a page can be shown without downloading and parsing it and then revalidated with a
+ * conditional GET. Pages revalidated (or fetched) during the lifetime of the cache object are trusted without asking
+ * the server again, which makes going back through the catalogue instant.
+ * At most MAX_PAGES pages are kept: each file carries a stamp of when it was fetched, and storing a page beyond the
+ * limit removes the one fetched longest ago.
+ */
+class OpdsFeedCache {
+ public:
+  struct Validators {
+    std::string etag;
+    std::string lastModified;
+  };
+
+  // Appends the stored entries of a page to `feed` and sets its next link; false if the page is not stored
+  bool load(const std::string& url, OpdsParser& feed, Validators& validators) const;
+  // Stores the entries of `feed` from `firstEntry` on as the page at `url`, and trusts it for this session
+  bool store(const std::string& url, const OpdsParser& feed, size_t firstEntry, const Validators& validators);
+
+  // Whether the page was fetched or revalidated during this session
+  bool isFresh(const std::string& url) const;
+  void markFresh(const std::string& url);
+
+ private:
+  static constexpr int MAX_PAGES = 64;
+
+  static std::string getPagePath(const std::string& url);
+  // Removes the page fetched longest ago if the cache is full, returns the stamp for the page stored at `path`
+  static uint32_t makeRoom(const std::string& path);
+
+  std::vector<size_t> freshPages;  // URL hashes
+};
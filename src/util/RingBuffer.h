@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Fixed-size byte ring buffer, exposing its free and filled regions as contiguous spans so data can be read into and
+ * written out of it in place.
+ *
+ * head and tail are running byte counts: only the producer advances head and only the consumer advances tail, so one
+ * producer task and one consumer task can share the buffer without a lock.
+ */
+template <size_t CAPACITY>
+class RingBuffer {
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "RingBuffer capacity must be a power of two");
+
+  uint8_t data[CAPACITY];
+  std::atomic<size_t> head{0};
+  std::atomic<size_t> tail{0};
+
+ public:
+  size_t size() const { return head - tail; }
+  size_t freeSpace() const { return CAPACITY - size(); }
+  bool empty() const { return head == tail; }
+  // Only safe while neither side is using the buffer
+  void clear() { head = tail = 0; }
+
+  // Largest contiguous free region at the write position; fill it, then commit() what was written
+  uint8_t* writeSpan(size_t* length) {
+    const size_t offset = head % CAPACITY;
+    const size_t free = freeSpace();
+    *length = CAPACITY - offset < free ? CAPACITY - offset : free;
+    return data + offset;
+  }
+  void commit(const size_t length) { head += length; }
+
+  // Largest contiguous filled region at the read position; process it, then consume() what was used
+  const uint8_t* readSpan(size_t* length) const {
+    const size_t offset = tail % CAPACITY;
+    const size_t filled = size();
+    *length = CAPACITY - offset < filled ? CAPACITY - offset : filled;
+    return data + offset;
+  }
+  void consume(const size_t length) { tail += length; }
+};
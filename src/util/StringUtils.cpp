@@ -49,4 +49,14 @@ bool checkFileExtension(const std::string& fileName, const char* extension) {
   return true;
 }
 
+void copyTruncated(char* dst, const size_t dstSize, const std::string& src) {
+  size_t length = src.size() < dstSize - 1 ? src.size() : dstSize - 1;
+  // Don't cut a multi-byte sequence in half
+  while (length < src.size() && length > 0 && (static_cast<uint8_t>(src[length]) & 0xC0) == 0x80) {
+    length--;
+  }
+  memset(dst, 0, dstSize);
+  memcpy(dst, src.data(), length);
+}
+
 }  // namespace StringUtils
@@ -16,4 +16,9 @@ std::string sanitizeFilename(const std::string& name, size_t maxLength = 100);
  */
 bool checkFileExtension(const std::string& fileName, const char* extension);
 
+/**
+ * Copy a UTF-8 string into a fixed-size, NUL-padded field, cutting it on a character boundary if it does not fit.
+ */
+void copyTruncated(char* dst, size_t dstSize, const std::string& src);
+
 }  // namespace StringUtils
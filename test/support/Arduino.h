@@ -0,0 +1,29 @@
+#pragma once
+
+// Host stand-in for the parts of the Arduino core used by the code under test
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "HardwareSerial.h"
+#include "Print.h"
+
+#define PROGMEM
+
+inline unsigned long micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+inline unsigned long millis() { return micros() / 1000; }
+
+inline void delay(const unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+inline void yield() {}
@@ -0,0 +1,29 @@
+#pragma once
+
+// Host stand-in for the e-ink panel driver of the device SDK: a frame buffer that is never shown
+
+#include <cstdint>
+#include <cstring>
+
+class EInkDisplay {
+ public:
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  uint8_t* getFrameBuffer() const { return frameBuffer; }
+  void clearScreen(const uint8_t color = 0xFF) const { memset(frameBuffer, color, BUFFER_SIZE); }
+  void displayBuffer(RefreshMode = FAST_REFRESH) {}
+  void drawImage(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t) const {}
+  void grayscaleRevert() {}
+  void copyGrayscaleLsbBuffers(const uint8_t*) {}
+  void copyGrayscaleMsbBuffers(const uint8_t*) {}
+  void displayGrayBuffer() {}
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+
+ private:
+  mutable uint8_t frameBuffer[BUFFER_SIZE] = {};
+};
@@ -0,0 +1,111 @@
+#pragma once
+
+// Host stand-in for the ESP32 HTTPClient. Each GET is answered with the next response queued in
+// hosthttp::responses(), and the request (URL and the headers added to it) is recorded in hosthttp::requests().
+// The body is played through the WiFiClient given to begin(), so it arrives in segments and can be cut short.
+
+#include <WString.h>
+#include <WiFiClient.h>
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+typedef enum {
+  HTTP_CODE_OK = 200,
+  HTTP_CODE_PARTIAL_CONTENT = 206,
+  HTTP_CODE_NOT_MODIFIED = 304,
+  HTTP_CODE_NOT_FOUND = 404,
+  HTTP_CODE_RANGE_NOT_SATISFIABLE = 416,
+} t_http_codes;
+
+typedef enum {
+  HTTPC_DISABLE_FOLLOW_REDIRECTS,
+  HTTPC_STRICT_FOLLOW_REDIRECTS,
+  HTTPC_FORCE_FOLLOW_REDIRECTS
+} followRedirects_t;
+
+namespace hosthttp {
+struct Response {
+  int code = HTTP_CODE_OK;
+  std::map<std::string, std::string> headers;
+  std::string body;
+  bool lengthUnknown = false;  // No Content-Length (chunked, or ended by closing), HTTPClient reports a size of -1
+  size_t closeAt = SIZE_MAX;   // The connection drops after this many bytes of body
+  size_t segmentSize = 1460;   // Bytes that become available at a time
+};
+
+struct Request {
+  std::string url;
+  std::map<std::string, std::string> headers;
+};
+
+inline std::deque<Response>& responses() {
+  static std::deque<Response> queue;
+  return queue;
+}
+
+inline std::vector<Request>& requests() {
+  static std::vector<Request> log;
+  return log;
+}
+}  // namespace hosthttp
+
+class HTTPClient {
+ public:
+  bool begin(WiFiClient& wifiClient, const char* url) {
+    client = &wifiClient;
+    request = {url, {}};
+    return true;
+  }
+  void end() {}
+  void useHTTP10(bool) {}
+  void setFollowRedirects(followRedirects_t) {}
+  void addHeader(const String& name, const String& value) { request.headers[name.c_str()] = value.c_str(); }
+  void collectHeaders(const char* [], size_t) {}
+
+  int GET() {
+    hosthttp::requests().push_back(request);
+    if (hosthttp::responses().empty()) {
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    response = hosthttp::responses().front();
+    hosthttp::responses().pop_front();
+    client->receive(response.body, response.closeAt, response.segmentSize);
+    return response.code;
+  }
+
+  int getSize() const { return response.lengthUnknown ? -1 : static_cast<int>(response.body.size()); }
+  String header(const char* name) const {
+    const auto it = response.headers.find(name);
+    return it == response.headers.end() ? String() : String(it->second.c_str());
+  }
+  WiFiClient* getStreamPtr() const { return client; }
+
+  // The decoded body, as HTTPClient writes it after taking the chunk framing apart
+  int writeToStream(Stream* stream) const {
+    uint8_t buffer[512];
+    int written = 0;
+    while (client->connected()) {
+      const int count = client->read(buffer, sizeof(buffer));
+      if (stream->write(buffer, count) != static_cast<size_t>(count)) {
+        return HTTPC_ERROR_CONNECTION_LOST;
+      }
+      written += count;
+    }
+    return static_cast<size_t>(written) == response.body.size() ? written : HTTPC_ERROR_READ_TIMEOUT;
+  }
+
+  static String errorToString(const int error) { return error == HTTPC_ERROR_READ_TIMEOUT ? "read Timeout" : "error"; }
+
+ private:
+  WiFiClient* client = nullptr;
+  hosthttp::Request request;
+  hosthttp::Response response;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+// Log output of the code under test, printed to stderr only when CROSSPOINT_TEST_LOG is set
+class HardwareSerial {
+ public:
+  static bool enabled() {
+    static const bool on = std::getenv("CROSSPOINT_TEST_LOG") != nullptr;
+    return on;
+  }
+
+  int printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    if (!enabled()) {
+      return 0;
+    }
+    va_list args;
+    va_start(args, format);
+    const int written = vfprintf(stderr, format, args);
+    va_end(args);
+    return written;
+  }
+
+  void print(const char* text) {
+    if (enabled()) {
+      fputs(text, stderr);
+    }
+  }
+
+  void println(const char* text = "") {
+    if (enabled()) {
+      fprintf(stderr, "%s\n", text);
+    }
+  }
+};
+
+inline HardwareSerial Serial;
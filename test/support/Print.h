@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Host stand-in for Arduino's Print and Stream
+class Print {
+ public:
+  virtual ~Print() = default;
+
+  virtual size_t write(uint8_t byte) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (written < size && write(buffer[written])) {
+      written++;
+    }
+    return written;
+  }
+  size_t write(const char* buffer, const size_t size) {
+    return write(reinterpret_cast<const uint8_t*>(buffer), size);
+  }
+  size_t write(const char* text) { return text ? write(text, strlen(text)) : 0; }
+  virtual void flush() {}
+
+  int getWriteError() const { return writeError; }
+  void clearWriteError() { writeError = 0; }
+
+ protected:
+  void setWriteError(const int error = 1) { writeError = error; }
+
+ private:
+  int writeError = 0;
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() { return -1; }
+  size_t readBytes(uint8_t* buffer, const size_t length) {
+    size_t count = 0;
+    while (count < length) {
+      const int c = read();
+      if (c < 0) {
+        break;
+      }
+      buffer[count++] = static_cast<uint8_t>(c);
+    }
+    return count;
+  }
+  void setTimeout(unsigned long) {}
+};
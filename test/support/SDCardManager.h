@@ -0,0 +1,91 @@
+#pragma once
+
+// Host stand-in for the SD card manager of the device SDK, working on the directory from hostsd::root()
+
+#include <SdFat.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+
+#include "HardwareSerial.h"
+
+class SDCardManager {
+ public:
+  bool begin() { return true; }
+  bool ready() const { return true; }
+
+  FsFile open(const char* path, const int oflag = O_RDONLY) {
+    FsFile file;
+    file.open(path, oflag);
+    return file;
+  }
+
+  bool openFileForRead(const char* moduleName, const char* path, FsFile& file) {
+    if (!file.open(path, O_RDONLY) || file.isDirectory()) {
+      Serial.printf("[%s] File does not exist: %s\n", moduleName, path);
+      file.close();
+      return false;
+    }
+    return true;
+  }
+  bool openFileForRead(const char* moduleName, const std::string& path, FsFile& file) {
+    return openFileForRead(moduleName, path.c_str(), file);
+  }
+
+  bool openFileForWrite(const char* moduleName, const char* path, FsFile& file) {
+    if (!file.open(path, O_RDWR | O_CREAT | O_TRUNC)) {
+      Serial.printf("[%s] Failed to open file for writing: %s\n", moduleName, path);
+      return false;
+    }
+    return true;
+  }
+  bool openFileForWrite(const char* moduleName, const std::string& path, FsFile& file) {
+    return openFileForWrite(moduleName, path.c_str(), file);
+  }
+
+  bool exists(const char* path) {
+    struct stat st {};
+    return stat(hostsd::hostPath(path).c_str(), &st) == 0;
+  }
+
+  bool mkdir(const char* path, const bool parents = true) {
+    const std::string hostPath = hostsd::hostPath(path);
+    if (parents) {
+      for (size_t slash = hostsd::root().size() + 1; (slash = hostPath.find('/', slash)) != std::string::npos;
+           slash++) {
+        ::mkdir(hostPath.substr(0, slash).c_str(), 0755);
+      }
+    }
+    return ::mkdir(hostPath.c_str(), 0755) == 0 || exists(path);
+  }
+
+  bool remove(const char* path) { return unlink(hostsd::hostPath(path).c_str()) == 0; }
+  bool rmdir(const char* path) { return ::rmdir(hostsd::hostPath(path).c_str()) == 0; }
+  bool rename(const char* from, const char* to) {
+    return ::rename(hostsd::hostPath(from).c_str(), hostsd::hostPath(to).c_str()) == 0;
+  }
+
+  bool removeDir(const char* path) {
+    FsFile dir = open(path);
+    if (!dir || !dir.isDirectory()) {
+      return false;
+    }
+    const std::string base = path;
+    char name[256];
+    for (FsFile entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+      entry.getName(name, sizeof(name));
+      const std::string child = base + "/" + name;
+      const bool isDir = entry.isDirectory();
+      entry.close();
+      if (isDir ? !removeDir(child.c_str()) : !remove(child.c_str())) {
+        return false;
+      }
+    }
+    dir.close();
+    return rmdir(path);
+  }
+};
+
+inline SDCardManager SdMan;
@@ -0,0 +1,201 @@
+#pragma once
+
+// Host stand-in for SdFat's FsFile: the SD card is a directory on the host (see hostsd::root()), files are plain
+// POSIX file descriptors. Open flags are the host's O_* constants, which SdFat mirrors.
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <utility>
+
+#include "Arduino.h"
+
+namespace hostsd {
+// Host directory standing in for the card root, a fresh temporary directory per test run unless set
+inline std::string& root() {
+  static std::string dir;
+  if (dir.empty()) {
+    char pattern[] = "/tmp/crosspoint-sd-XXXXXX";
+    const char* created = mkdtemp(pattern);
+    dir = created ? created : "/tmp";
+  }
+  return dir;
+}
+
+inline std::string hostPath(const std::string& sdPath) {
+  return root() + (sdPath.empty() || sdPath[0] != '/' ? "/" : "") + sdPath;
+}
+}  // namespace hostsd
+
+class FsFile : public Stream {
+ public:
+  FsFile() = default;
+  FsFile(const FsFile&) = delete;
+  FsFile& operator=(const FsFile&) = delete;
+  FsFile(FsFile&& other) noexcept { *this = std::move(other); }
+  FsFile& operator=(FsFile&& other) noexcept {
+    if (this != &other) {
+      close();
+      fd = other.fd;
+      dir = other.dir;
+      path = std::move(other.path);
+      other.fd = -1;
+      other.dir = nullptr;
+    }
+    return *this;
+  }
+  ~FsFile() override { close(); }
+
+  bool open(const char* sdPath, const int oflag = O_RDONLY) {
+    close();
+    path = hostsd::hostPath(sdPath);
+    struct stat st {};
+    if (stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+      dir = opendir(path.c_str());
+      return dir != nullptr;
+    }
+    fd = ::open(path.c_str(), oflag, 0644);
+    return fd >= 0;
+  }
+
+  explicit operator bool() const { return isOpen(); }
+  bool isOpen() const { return fd >= 0 || dir != nullptr; }
+  bool isDirectory() const { return dir != nullptr; }
+
+  bool close() {
+    const bool wasOpen = isOpen();
+    if (fd >= 0) {
+      ::close(fd);
+      fd = -1;
+    }
+    if (dir) {
+      closedir(dir);
+      dir = nullptr;
+    }
+    return wasOpen;
+  }
+
+  int read() override {
+    uint8_t byte;
+    return read(&byte, 1) == 1 ? byte : -1;
+  }
+  int read(void* buffer, const size_t count) {
+    if (fd < 0) {
+      return -1;
+    }
+    return static_cast<int>(::read(fd, buffer, count));
+  }
+  int peek() override {
+    const uint64_t pos = position();
+    const int c = read();
+    seek(pos);
+    return c;
+  }
+
+  size_t write(const uint8_t byte) override { return write(&byte, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    if (fd < 0) {
+      setWriteError();
+      return 0;
+    }
+    const ssize_t written = ::write(fd, buffer, size);
+    if (written != static_cast<ssize_t>(size)) {
+      setWriteError();
+    }
+    return written < 0 ? 0 : static_cast<size_t>(written);
+  }
+  size_t write(const void* buffer, const size_t size) { return write(static_cast<const uint8_t*>(buffer), size); }
+  using Print::write;
+
+  bool seek(const uint64_t pos) { return seekSet(pos); }
+  bool seekSet(const uint64_t pos) { return fd >= 0 && lseek(fd, static_cast<off_t>(pos), SEEK_SET) >= 0; }
+  bool seekCur(const int64_t offset) { return fd >= 0 && lseek(fd, static_cast<off_t>(offset), SEEK_CUR) >= 0; }
+  bool seekEnd(const int64_t offset = 0) { return fd >= 0 && lseek(fd, static_cast<off_t>(offset), SEEK_END) >= 0; }
+  uint64_t position() const { return fd >= 0 ? static_cast<uint64_t>(lseek(fd, 0, SEEK_CUR)) : 0; }
+  uint64_t size() const {
+    struct stat st {};
+    return fd >= 0 && fstat(fd, &st) == 0 ? static_cast<uint64_t>(st.st_size) : 0;
+  }
+  uint64_t fileSize() const { return size(); }
+  int available() override {
+    const uint64_t left = size() > position() ? size() - position() : 0;
+    return left > INT_MAX ? INT_MAX : static_cast<int>(left);
+  }
+
+  bool truncate(const uint64_t length) { return fd >= 0 && ftruncate(fd, static_cast<off_t>(length)) == 0; }
+  bool truncate() { return truncate(position()); }
+  bool preAllocate(uint64_t) { return fd >= 0; }
+  bool sync() { return fd >= 0 && fsync(fd) == 0; }
+  void flush() override { sync(); }
+
+  // Renames the open file, `newPath` is a card path
+  bool rename(const char* newPath) {
+    const std::string target = hostsd::hostPath(newPath);
+    if (!isOpen() || ::rename(path.c_str(), target.c_str()) != 0) {
+      return false;
+    }
+    path = target;
+    return true;
+  }
+
+  // Modification time in FAT encoding
+  bool getModifyDateTime(uint16_t* date, uint16_t* time) const {
+    struct stat st {};
+    if (stat(path.c_str(), &st) != 0) {
+      return false;
+    }
+    struct tm local {};
+    localtime_r(&st.st_mtime, &local);
+    *date = static_cast<uint16_t>(((local.tm_year - 80) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday);
+    *time = static_cast<uint16_t>((local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec / 2));
+    return true;
+  }
+
+  size_t getName(char* name, const size_t size) const {
+    const size_t slash = path.find_last_of('/');
+    const std::string base = slash == std::string::npos ? path : path.substr(slash + 1);
+    snprintf(name, size, "%s", base.c_str());
+    return base.size() < size ? base.size() : size - 1;
+  }
+
+  FsFile openNextFile() {
+    FsFile next;
+    while (dir) {
+      const dirent* entry = readdir(dir);
+      if (!entry) {
+        break;
+      }
+      if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+        continue;
+      }
+      const std::string childPath = path + "/" + entry->d_name;
+      struct stat st {};
+      if (stat(childPath.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        next.dir = opendir(childPath.c_str());
+      } else {
+        next.fd = ::open(childPath.c_str(), O_RDONLY);
+      }
+      next.path = childPath;
+      break;
+    }
+    return next;
+  }
+  void rewindDirectory() {
+    if (dir) {
+      rewinddir(dir);
+    }
+  }
+
+ private:
+  int fd = -1;
+  DIR* dir = nullptr;
+  std::string path;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+// Host stand-in for the Arduino String, with the members the code under test uses
+
+#include <cstring>
+#include <string>
+
+class String {
+ public:
+  String() = default;
+  String(const char* value) : value(value ? value : "") {}  // NOLINT(google-explicit-constructor)
+
+  const char* c_str() const { return value.c_str(); }
+  unsigned int length() const { return value.size(); }
+  bool isEmpty() const { return value.empty(); }
+
+  int indexOf(const char c, const unsigned int from = 0) const { return toIndex(value.find(c, from)); }
+  int indexOf(const char* s, const unsigned int from = 0) const { return toIndex(value.find(s, from)); }
+  int indexOf(const String& s, const unsigned int from = 0) const { return indexOf(s.c_str(), from); }
+  bool startsWith(const char* prefix) const { return value.compare(0, strlen(prefix), prefix) == 0; }
+
+  bool operator==(const char* other) const { return value == other; }
+  bool operator==(const String& other) const { return value == other.value; }
+  String& operator+=(const String& other) {
+    value += other.value;
+    return *this;
+  }
+  friend String operator+(String left, const String& right) { return left += right; }
+
+ private:
+  static int toIndex(const size_t position) { return position == std::string::npos ? -1 : static_cast<int>(position); }
+
+  std::string value;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+// Host stand-in for the ESP32 WiFiClient: a socket whose received bytes are scripted. The bytes become available
+// in segments of `segmentSize`, and the connection closes once `closeAt` of them have been read.
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <string>
+
+class WiFiClient : public Stream {
+ public:
+  virtual ~WiFiClient() = default;
+
+  void receive(std::string bytes, const size_t closeAt, const size_t segmentSize) {
+    data = std::move(bytes);
+    position = 0;
+    end = std::min(closeAt, data.size());
+    segment = segmentSize;
+  }
+
+  int available() override { return static_cast<int>(std::min(end - position, segment)); }
+  int read() override { return position < end ? static_cast<uint8_t>(data[position++]) : -1; }
+  int read(uint8_t* buffer, const size_t size) {
+    const size_t count = std::min(size, static_cast<size_t>(available()));
+    std::copy_n(data.data() + position, count, buffer);
+    position += count;
+    return static_cast<int>(count);
+  }
+  int peek() override { return position < end ? static_cast<uint8_t>(data[position]) : -1; }
+  size_t write(const uint8_t) override { return 1; }
+  size_t write(const uint8_t*, const size_t size) override { return size; }
+  uint8_t connected() { return position < end; }
+  void stop() { position = end; }
+
+ private:
+  std::string data;
+  size_t position = 0;
+  size_t end = 0;
+  size_t segment = 1460;
+};
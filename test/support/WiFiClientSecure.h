@@ -0,0 +1,10 @@
+#pragma once
+
+// Host stand-in for the ESP32 WiFiClientSecure; TLS is left out, the scripted bytes arrive as they are
+
+#include "WiFiClient.h"
+
+class WiFiClientSecure : public WiFiClient {
+ public:
+  void setInsecure() {}
+};
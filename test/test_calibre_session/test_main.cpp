@@ -0,0 +1,323 @@
+// Replays a Calibre wireless session through CalibreMessageReader. A loopback stand-in for the socket moves the
+// session into the receive ring in segments, as CalibreWirelessActivity::fillRecvRing does, and book data after
+// SEND_BOOK is drained from the ring as the SD writer would. The session follows what Calibre 7 sends when a book is
+// sent to the device: the handshake, the book list, metadata updates, a book with a cover thumbnail several times the
+// size of the ring, and the NOOP follow-ups. Every field of every message is checked, for segment sizes from a byte
+// at a time to a full ring, and the decoding throughput and the heap used while decoding are reported.
+
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../../src/network/CalibreMessageReader.cpp"
+
+namespace {
+using Field = CalibreMessageReader::Field;
+constexpr int FIELD_COUNT = static_cast<int>(Field::COUNT);
+constexpr size_t THUMBNAIL_SIZE = 60000;  // Base64 characters, several rings full
+constexpr size_t BOOK_SIZE = 50000;
+constexpr int BENCHMARK_PASSES = 50;
+
+// Heap in use by operator new, and its high-water mark
+size_t heapInUse = 0;
+size_t heapPeak = 0;
+
+struct Message {
+  std::string frame;   // Length prefix and JSON, as on the wire
+  std::string binary;  // Book data following the message
+  int opcode;
+  std::string expected[FIELD_COUNT];
+};
+
+Message makeMessage(const int opcode, const std::string& data,
+                    std::initializer_list<std::pair<Field, std::string>> expected) {
+  Message message;
+  const std::string json = "[" + std::to_string(opcode) + ", " + data + "]";
+  message.frame = std::to_string(json.size()) + json;
+  message.opcode = opcode;
+  for (const auto& [field, value] : expected) {
+    message.expected[static_cast<int>(field)] = value;
+  }
+  return message;
+}
+
+std::string makeBase64(const size_t size) {
+  static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string text(size, '=');
+  for (size_t i = 0; i + 2 < size; i++) {
+    text[i] = ALPHABET[(i * 7 + i / 64) % 64];
+  }
+  return text;
+}
+
+std::vector<Message> makeSession() {
+  std::vector<Message> session;
+  session.push_back(makeMessage(
+      9,
+      R"({"serverProtocolVersion": 1, "validExtensions": ["epub"], "passwordChallenge": "", )"
+      R"("currentLibraryName": "Calibre Library", "currentLibraryUUID": "5b0b1b8e-0d2a-4b5e-9c1e-2f2a3b4c5d6e", )"
+      R"("pubdateFormat": "MMM yyyy", "timestampFormat": "dd MMM yyyy", "lastModifiedFormat": "dd MMM yyyy", )"
+      R"("calibre_version": [7, 4, 0], "canSupportUpdateBooks": true, "canSupportLpathChanges": true})",
+      {}));
+  session.push_back(makeMessage(
+      1,
+      R"({"device_info": {"device_store_uuid": "a1b2", "device_name": "CrossPoint", "location_code": "main", )"
+      R"("last_library_uuid": "5b0b1b8e", "calibre_version": "7.4.0", "date_last_connected": "2026-10-18"}, )"
+      R"("device_version": "1.0", "version": "1.0"})",
+      {}));
+  session.push_back(makeMessage(5, "{}", {}));
+  session.push_back(makeMessage(
+      6, R"({"canStream": true, "canScan": true, "willUseCachedMetadata": true, "supportsSync": false})", {}));
+  session.push_back(makeMessage(
+      7, R"({"count": 2, "collections": {"Classics": ["Austen/Pride.epub"]}, "willStreamMetadata": true})",
+      {{Field::Count, "2"}}));
+
+  // Metadata of a book on the card. Keys that only match at the wrong level are ignored: the nested "title" and
+  // "lpath", and the whole of user_metadata, which goes deeper than the reader tracks. Keys after it still count.
+  session.push_back(makeMessage(
+      16,
+      R"({"index": 0, "count": 2, "data": {"lpath": "Austen/Pride.epub", "uuid": "u-pride", )"
+      R"("user_metadata": {"#genre": {"datatype": "text", "#value#": {"a": {"b": {"c": {"d": {"title": "Deep", )"
+      R"("lpath": "deep.epub"}}}}, "title": "Nested"}}}, "title": "Pride and Prejudice", )"
+      R"("authors": ["Jane Austen", "Unknown"], "identifiers": {"isbn": "9780141439518", "title": "x"}, )"
+      R"("last_modified": "2024-05-01T10:00:00+00:00"}})",
+      {{Field::Count, "2"},
+       {Field::Lpath, "Austen/Pride.epub"},
+       {Field::Uuid, "u-pride"},
+       {Field::Title, "Pride and Prejudice"},
+       {Field::Authors, "Jane Austen"},
+       {Field::LastModified, "2024-05-01T10:00:00+00:00"}}));
+
+  // Escapes: a character beyond the BMP as a surrogate pair, a lone high surrogate and a lone low one (both
+  // dropped), and the single-character escapes
+  session.push_back(makeMessage(
+      16,
+      R"({"index": 1, "count": 2, "data": {"lpath": "Misc/Caf\u00e9.epub", "uuid": "u-cafe", )"
+      R"("title": "Caf\u00e9 \ud83d\udcd6 \"Quotes\" back\\slash\/ tab\tend", )"
+      R"("authors": ["Se\u00f1or \ud800X\udc00Y"], "last_modified": "None"}})",
+      {{Field::Count, "2"},
+       {Field::Lpath, "Misc/Caf\xc3\xa9.epub"},
+       {Field::Uuid, "u-cafe"},
+       {Field::Title, "Caf\xc3\xa9 \xf0\x9f\x93\x96 \"Quotes\" back\\slash/ tab\tend"},
+       {Field::Authors, "Se\xc3\xb1or XY"},
+       {Field::LastModified, "None"}}));
+
+  // The book itself. The metadata carries "length" keys of its own, before and after the book's length at the top
+  // level, and a thumbnail that is much larger than the ring.
+  Message book = makeMessage(
+      8,
+      R"({"metadata": {"length": 999, "user_metadata": {"#pages": {"length": 5}}, "lpath": "Austen/Emma.epub", )"
+      R"("uuid": "u-emma", "title": "Emma", "authors": ["Jane Austen"], "thumbnail": [120, 160, ")" +
+          makeBase64(THUMBNAIL_SIZE) +
+          R"("], "last_modified": "2025-01-02T03:04:05+00:00"}, "lpath": "Austen/Emma.epub", "length": )" +
+          std::to_string(BOOK_SIZE) +
+          R"(, "calibre_id": 7, "totalBooks": 1, "thisBook": 0, "willStreamBooks": true, )"
+          R"("willStreamBinary": true, "wantsSendOkToSendbook": true, "canSupportLpathChanges": true, )"
+          R"("metadata2": {"length": 3}})",
+      {{Field::Lpath, "Austen/Emma.epub"},
+       {Field::Length, std::to_string(BOOK_SIZE)},
+       {Field::Uuid, "u-emma"},
+       {Field::Title, "Emma"},
+       {Field::Authors, "Jane Austen"},
+       {Field::LastModified, "2025-01-02T03:04:05+00:00"}});
+  book.binary.resize(BOOK_SIZE);
+  for (size_t i = 0; i < BOOK_SIZE; i++) {
+    // Starts like a length prefix, so a reader that took book data for messages would go wrong
+    book.binary[i] = static_cast<char>(i < 3 ? '1' : i * 13 + 5);
+  }
+  session.push_back(book);
+
+  session.push_back(makeMessage(12, R"({"priKey": 1})", {{Field::PriKey, "1"}}));
+  session.push_back(makeMessage(12, R"({"count": 2})", {{Field::Count, "2"}}));
+  session.push_back(makeMessage(17, R"({"messageKind": 1, "message": "Wrong password"})", {{Field::MessageKind, "1"}}));
+  session.push_back(makeMessage(12, R"({"ejecting": true})", {{Field::Ejecting, "true"}}));
+  return session;
+}
+
+// The far end of the socket: hands out the recorded session `segment` bytes at a time
+class Loopback {
+  std::string bytes;
+  size_t position = 0;
+  size_t segment;
+
+ public:
+  Loopback(const std::vector<Message>& session, const size_t segment) : segment(segment) {
+    for (const auto& message : session) {
+      bytes += message.frame;
+      bytes += message.binary;
+    }
+  }
+
+  size_t size() const { return bytes.size(); }
+
+  // Moves the next segment into the ring, as far as it has room; false once the session is over
+  bool pump(CalibreMessageReader::Ring& ring) {
+    size_t available = std::min(segment, bytes.size() - position);
+    if (available == 0) {
+      return false;
+    }
+    while (available > 0) {
+      size_t length;
+      uint8_t* span = ring.writeSpan(&length);
+      if (length == 0) {
+        break;
+      }
+      length = std::min(length, available);
+      memcpy(span, bytes.data() + position, length);
+      ring.commit(length);
+      position += length;
+      available -= length;
+    }
+    return true;
+  }
+};
+
+// Takes the book data following SEND_BOOK out of the ring, pumping more in as it is used up
+std::string drainBinary(Loopback& loopback, CalibreMessageReader::Ring& ring, const size_t size) {
+  std::string data;
+  while (data.size() < size) {
+    if (ring.empty() && !loopback.pump(ring)) {
+      break;
+    }
+    size_t length;
+    const uint8_t* span = ring.readSpan(&length);
+    length = std::min(length, size - data.size());
+    data.append(reinterpret_cast<const char*>(span), length);
+    ring.consume(length);
+  }
+  return data;
+}
+
+void replay(const std::vector<Message>& session, const size_t segment) {
+  Loopback loopback(session, segment);
+  CalibreMessageReader::Ring ring;
+  CalibreMessageReader reader;
+  reader.reset();
+  for (size_t m = 0; m < session.size(); m++) {
+    const Message& message = session[m];
+    const std::string context = "segment " + std::to_string(segment) + ", message " + std::to_string(m);
+    bool complete = false;
+    while (!(complete = reader.read(ring)) && loopback.pump(ring)) {
+    }
+    TEST_ASSERT_TRUE_MESSAGE(complete, context.c_str());
+    TEST_ASSERT_EQUAL_INT_MESSAGE(message.opcode, reader.getOpcode(), context.c_str());
+    for (int f = 0; f < FIELD_COUNT; f++) {
+      const std::string fieldContext = context + ", field " + std::to_string(f);
+      TEST_ASSERT_EQUAL_STRING_MESSAGE(message.expected[f].c_str(), reader.get(static_cast<Field>(f)),
+                                       fieldContext.c_str());
+    }
+    if (!message.binary.empty()) {
+      TEST_ASSERT_TRUE_MESSAGE(drainBinary(loopback, ring, message.binary.size()) == message.binary, context.c_str());
+    }
+  }
+  TEST_ASSERT_TRUE(ring.empty());
+  TEST_ASSERT_FALSE(loopback.pump(ring));
+}
+}  // namespace
+
+// Counts the heap in use, so the benchmark can report what decoding allocates
+void* operator new(const size_t size) {
+  auto* block = static_cast<size_t*>(malloc(size + sizeof(max_align_t)));
+  if (!block) {
+    throw std::bad_alloc();
+  }
+  *block = size;
+  heapInUse += size;
+  heapPeak = std::max(heapPeak, heapInUse);
+  return reinterpret_cast<char*>(block) + sizeof(max_align_t);
+}
+
+void operator delete(void* pointer) noexcept {
+  if (pointer) {
+    auto* block = reinterpret_cast<size_t*>(static_cast<char*>(pointer) - sizeof(max_align_t));
+    heapInUse -= *block;
+    free(block);
+  }
+}
+
+void operator delete(void* pointer, size_t) noexcept { operator delete(pointer); }
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_replay_in_segments() {
+  const std::vector<Message> session = makeSession();
+  for (const size_t segment : {size_t{1}, size_t{3}, size_t{61}, size_t{1460}, CalibreMessageReader::RING_SIZE}) {
+    replay(session, segment);
+  }
+}
+
+void test_messages_split_across_ring_wrap() {
+  // Each message is cut at every offset of a 97-byte window by starting it that far into the ring
+  const std::vector<Message> session = makeSession();
+  for (size_t skew = 1; skew < 97; skew++) {
+    std::vector<Message> skewed;
+    skewed.push_back(makeMessage(12, "{\"pad\": \"" + std::string(skew, 'p') + "\"}", {}));
+    skewed.insert(skewed.end(), session.begin(), session.end());
+    replay(skewed, 1460);
+  }
+}
+
+void test_decode_benchmark() {
+  const std::vector<Message> session = makeSession();
+  Loopback sizing(session, 0);
+  size_t messageBytes = 0;
+  for (const auto& message : session) {
+    messageBytes += message.frame.size();
+  }
+
+  auto fastest = std::chrono::nanoseconds::max();
+  size_t heapAdded = 0;
+  for (int pass = 0; pass < BENCHMARK_PASSES; pass++) {
+    Loopback loopback(session, 1460);
+    auto* ring = new CalibreMessageReader::Ring();
+    auto* reader = new CalibreMessageReader();
+    reader->reset();
+    const size_t heapBefore = heapInUse;
+    heapPeak = heapInUse;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& message : session) {
+      while (!reader->read(*ring) && loopback.pump(*ring)) {
+      }
+      for (size_t left = message.binary.size(); left > 0;) {
+        if (ring->empty()) {
+          loopback.pump(*ring);
+        }
+        size_t length;
+        ring->readSpan(&length);
+        length = std::min(length, left);
+        ring->consume(length);
+        left -= length;
+      }
+    }
+    fastest = std::min(fastest, std::chrono::steady_clock::now() - start);
+    heapAdded = std::max(heapAdded, heapPeak - heapBefore);
+    delete reader;
+    delete ring;
+  }
+
+  const double seconds = std::chrono::duration<double>(fastest).count();
+  char message[200];
+  snprintf(message, sizeof(message),
+           "%zu bytes of messages, %zu of session: %.1f MB/s of messages; heap allocated while decoding: %zu bytes "
+           "(reader %zu bytes, ring %zu bytes)",
+           messageBytes, sizing.size(), messageBytes / seconds / 1e6, heapAdded, sizeof(CalibreMessageReader),
+           sizeof(CalibreMessageReader::Ring));
+  TEST_MESSAGE(message);
+  TEST_ASSERT_EQUAL(0, heapAdded);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_in_segments);
+  RUN_TEST(test_messages_split_across_ring_wrap);
+  RUN_TEST(test_decode_benchmark);
+  return UNITY_END();
+}
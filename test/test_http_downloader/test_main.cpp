@@ -0,0 +1,271 @@
+// HttpDownloader against a scripted server: Content-Range parsing, bodies cut short, resumed downloads and the
+// answers a server may give to them (a range that does not fit, the whole file again after an If-Range mismatch,
+// 416 for a .part that is already complete) and bodies of unknown length.
+
+#include <unity.h>
+
+#include <string>
+
+#include "../../src/network/HttpDownloader.cpp"
+
+namespace {
+constexpr char URL[] = "https://books.example/book.epub";
+constexpr char DEST[] = "/Books/book.epub";
+constexpr char PART[] = "/Books/book.epub.part";
+constexpr char META[] = "/Books/book.epub.part.meta";
+constexpr size_t BOOK_SIZE = 20000;
+constexpr size_t DROP_AT = 5000;
+
+std::string makeBody(const size_t size, const char seed) {
+  std::string body(size, '\0');
+  for (size_t i = 0; i < size; i++) {
+    body[i] = static_cast<char>(seed + i * 31 + i / 251);
+  }
+  return body;
+}
+
+hosthttp::Response okResponse(const std::string& body, const char* etag) {
+  hosthttp::Response response;
+  response.headers["ETag"] = etag;
+  response.body = body;
+  return response;
+}
+
+hosthttp::Response rangeResponse(const std::string& body, const size_t start, const size_t total) {
+  hosthttp::Response response;
+  response.code = HTTP_CODE_PARTIAL_CONTENT;
+  response.headers["Content-Range"] =
+      "bytes " + std::to_string(start) + "-" + std::to_string(start + body.size() - 1) + "/" + std::to_string(total);
+  response.body = body;
+  return response;
+}
+
+std::string readFile(const char* path) {
+  std::string bytes;
+  FsFile file;
+  if (SdMan.exists(path) && SdMan.openFileForRead("TEST", path, file)) {
+    bytes.resize(file.size());
+    file.read(reinterpret_cast<uint8_t*>(bytes.data()), bytes.size());
+    file.close();
+  }
+  return bytes;
+}
+
+std::string requestHeader(const size_t request, const char* name) {
+  const auto& headers = hosthttp::requests().at(request).headers;
+  const auto it = headers.find(name);
+  return it == headers.end() ? "" : it->second;
+}
+
+// Leaves the first DROP_AT bytes of `body` in the .part file, as a download interrupted on every attempt would
+void downloadPartially(const std::string& body, const char* etag) {
+  hosthttp::Response response = okResponse(body, etag);
+  response.closeAt = DROP_AT;
+  hosthttp::responses().push_back(response);
+  // No answer to the retry: the server went away
+  TEST_ASSERT_EQUAL(HttpDownloader::HTTP_ERROR, HttpDownloader::downloadToFile(URL, DEST));
+  TEST_ASSERT_EQUAL(DROP_AT, readFile(PART).size());
+  TEST_ASSERT_TRUE(SdMan.exists(META));
+  hosthttp::requests().clear();
+}
+
+void assertDownloaded(const std::string& body) {
+  TEST_ASSERT_TRUE_MESSAGE(readFile(DEST) == body, "downloaded file differs from the body");
+  TEST_ASSERT_FALSE(SdMan.exists(PART));
+  TEST_ASSERT_FALSE(SdMan.exists(META));
+  TEST_ASSERT_TRUE(hosthttp::responses().empty());
+}
+}  // namespace
+
+void setUp() {
+  hosthttp::responses().clear();
+  hosthttp::requests().clear();
+  SdMan.removeDir("/Books");
+  SdMan.mkdir("/Books");
+}
+
+void tearDown() {}
+
+void test_parse_content_range() {
+  size_t start = 0;
+  size_t total = 0;
+  TEST_ASSERT_TRUE(parseContentRange("bytes 5000-19999/20000", start, total));
+  TEST_ASSERT_EQUAL(5000, start);
+  TEST_ASSERT_EQUAL(20000, total);
+  TEST_ASSERT_TRUE(parseContentRange("bytes 0-0/1", start, total));
+  TEST_ASSERT_EQUAL(0, start);
+  TEST_ASSERT_EQUAL(1, total);
+
+  TEST_ASSERT_FALSE(parseContentRange("", start, total));
+  TEST_ASSERT_FALSE(parseContentRange("items 0-9/10", start, total));
+  TEST_ASSERT_FALSE(parseContentRange("bytes 0-9", start, total));
+  TEST_ASSERT_FALSE(parseContentRange("bytes */20000", start, total));
+  TEST_ASSERT_FALSE(parseContentRange("bytes 0-9/*", start, total));
+  TEST_ASSERT_FALSE(parseContentRange("bytes 0-9/0", start, total));
+}
+
+void test_fetch_unknown_length() {
+  // HTTP/1.0 without Content-Length: the body, a few download buffers long, ends when the server closes the connection
+  const std::string body = makeBody(3 * 4096 + 123, 'a');
+  hosthttp::Response response = okResponse(body, "\"f1\"");
+  response.lengthUnknown = true;
+  response.segmentSize = 700;
+  hosthttp::responses().push_back(response);
+
+  std::string fetched;
+  TEST_ASSERT_TRUE(HttpDownloader::fetchUrl(URL, fetched));
+  TEST_ASSERT_TRUE(fetched == body);
+}
+
+void test_fetch_cut_short() {
+  hosthttp::Response response = okResponse(makeBody(10000, 'b'), "\"f1\"");
+  response.closeAt = 6000;
+  hosthttp::responses().push_back(response);
+
+  std::string fetched;
+  TEST_ASSERT_FALSE(HttpDownloader::fetchUrl(URL, fetched));
+}
+
+void test_fetch_not_modified() {
+  hosthttp::Response response;
+  response.code = HTTP_CODE_NOT_MODIFIED;
+  hosthttp::responses().push_back(response);
+
+  std::string etag = "\"f1\"";
+  std::string lastModified;
+  std::string fetched;
+  StringPrint out(fetched);
+  TEST_ASSERT_EQUAL(HttpDownloader::FetchResult::NotModified,
+                    HttpDownloader::fetchUrlIfModified(URL, out, etag, lastModified));
+  TEST_ASSERT_EQUAL_STRING("\"f1\"", requestHeader(0, "If-None-Match").c_str());
+  TEST_ASSERT_TRUE(fetched.empty());
+}
+
+void test_download_resumes_dropped_connection() {
+  const std::string body = makeBody(BOOK_SIZE, 'c');
+  hosthttp::Response first = okResponse(body, "\"v1\"");
+  first.closeAt = DROP_AT;
+  hosthttp::responses().push_back(first);
+  hosthttp::responses().push_back(rangeResponse(body.substr(DROP_AT), DROP_AT, BOOK_SIZE));
+
+  TEST_ASSERT_EQUAL(HttpDownloader::OK, HttpDownloader::downloadToFile(URL, DEST));
+  TEST_ASSERT_EQUAL(2, hosthttp::requests().size());
+  TEST_ASSERT_EQUAL_STRING("", requestHeader(0, "Range").c_str());
+  TEST_ASSERT_EQUAL_STRING("bytes=5000-", requestHeader(1, "Range").c_str());
+  TEST_ASSERT_EQUAL_STRING("\"v1\"", requestHeader(1, "If-Range").c_str());
+  assertDownloaded(body);
+}
+
+void test_download_range_mismatch_restarts() {
+  const std::string body = makeBody(BOOK_SIZE, 'd');
+  // The server ignores the start of the range, then reports a different total
+  const hosthttp::Response mismatches[] = {rangeResponse(body, 0, BOOK_SIZE),
+                                           rangeResponse(body.substr(DROP_AT), DROP_AT, BOOK_SIZE + 1)};
+  for (const auto& mismatch : mismatches) {
+    setUp();
+    downloadPartially(body, "\"v1\"");
+    hosthttp::responses().push_back(mismatch);
+    hosthttp::responses().push_back(okResponse(body, "\"v1\""));
+
+    TEST_ASSERT_EQUAL(HttpDownloader::OK, HttpDownloader::downloadToFile(URL, DEST));
+    TEST_ASSERT_EQUAL(2, hosthttp::requests().size());
+    TEST_ASSERT_EQUAL_STRING("bytes=5000-", requestHeader(0, "Range").c_str());
+    // The partial file was dropped, so the next attempt asks for the whole file
+    TEST_ASSERT_EQUAL_STRING("", requestHeader(1, "Range").c_str());
+    assertDownloaded(body);
+  }
+}
+
+void test_download_if_range_mismatch_starts_over() {
+  // The book changed on the server: it answers the ranged request with the whole new file
+  const std::string oldBody = makeBody(BOOK_SIZE, 'e');
+  const std::string newBody = makeBody(BOOK_SIZE / 2 + 77, 'f');
+  downloadPartially(oldBody, "\"v1\"");
+  hosthttp::responses().push_back(okResponse(newBody, "\"v2\""));
+
+  TEST_ASSERT_EQUAL(HttpDownloader::OK, HttpDownloader::downloadToFile(URL, DEST));
+  TEST_ASSERT_EQUAL(1, hosthttp::requests().size());
+  TEST_ASSERT_EQUAL_STRING("\"v1\"", requestHeader(0, "If-Range").c_str());
+  assertDownloaded(newBody);
+}
+
+void test_download_416_with_complete_part() {
+  // Every byte arrived before the connection dropped, but the file was never moved into place
+  const std::string body = makeBody(BOOK_SIZE, 'g');
+  downloadPartially(body, "\"v1\"");
+  FsFile part = SdMan.open(PART, O_RDWR);
+  part.seekEnd();
+  part.write(reinterpret_cast<const uint8_t*>(body.data()) + DROP_AT, BOOK_SIZE - DROP_AT);
+  part.close();
+  hosthttp::Response response;
+  response.code = HTTP_CODE_RANGE_NOT_SATISFIABLE;
+  hosthttp::responses().push_back(response);
+
+  TEST_ASSERT_EQUAL(HttpDownloader::OK, HttpDownloader::downloadToFile(URL, DEST));
+  TEST_ASSERT_EQUAL_STRING("bytes=20000-", requestHeader(0, "Range").c_str());
+  assertDownloaded(body);
+}
+
+void test_download_416_with_incomplete_part_restarts() {
+  const std::string body = makeBody(BOOK_SIZE, 'h');
+  downloadPartially(body, "\"v1\"");
+  hosthttp::Response response;
+  response.code = HTTP_CODE_RANGE_NOT_SATISFIABLE;
+  hosthttp::responses().push_back(response);
+  hosthttp::responses().push_back(okResponse(body, "\"v1\""));
+
+  TEST_ASSERT_EQUAL(HttpDownloader::OK, HttpDownloader::downloadToFile(URL, DEST));
+  TEST_ASSERT_EQUAL_STRING("", requestHeader(1, "Range").c_str());
+  assertDownloaded(body);
+}
+
+void test_download_unknown_length() {
+  const std::string body = makeBody(BOOK_SIZE + 333, 'i');
+  hosthttp::Response response = okResponse(body, "");
+  response.lengthUnknown = true;
+  response.segmentSize = 517;
+  hosthttp::responses().push_back(response);
+
+  TEST_ASSERT_EQUAL(HttpDownloader::OK, HttpDownloader::downloadToFile(URL, DEST));
+  assertDownloaded(body);
+}
+
+void test_download_unknown_length_cut_short() {
+  // Without a total there is nothing to resume against: the partial file goes and the download fails
+  hosthttp::Response response = okResponse(makeBody(BOOK_SIZE, 'j'), "");
+  response.lengthUnknown = true;
+  response.closeAt = DROP_AT;
+  hosthttp::responses().push_back(response);
+
+  TEST_ASSERT_EQUAL(HttpDownloader::HTTP_ERROR, HttpDownloader::downloadToFile(URL, DEST));
+  TEST_ASSERT_FALSE(SdMan.exists(DEST));
+  TEST_ASSERT_FALSE(SdMan.exists(PART));
+  TEST_ASSERT_FALSE(SdMan.exists(META));
+}
+
+void test_download_http_error_leaves_nothing() {
+  hosthttp::Response response;
+  response.code = HTTP_CODE_NOT_FOUND;
+  hosthttp::responses().push_back(response);
+
+  TEST_ASSERT_EQUAL(HttpDownloader::HTTP_ERROR, HttpDownloader::downloadToFile(URL, DEST));
+  TEST_ASSERT_FALSE(SdMan.exists(PART));
+  TEST_ASSERT_FALSE(SdMan.exists(META));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_parse_content_range);
+  RUN_TEST(test_fetch_unknown_length);
+  RUN_TEST(test_fetch_cut_short);
+  RUN_TEST(test_fetch_not_modified);
+  RUN_TEST(test_download_resumes_dropped_connection);
+  RUN_TEST(test_download_range_mismatch_restarts);
+  RUN_TEST(test_download_if_range_mismatch_starts_over);
+  RUN_TEST(test_download_416_with_complete_part);
+  RUN_TEST(test_download_416_with_incomplete_part_restarts);
+  RUN_TEST(test_download_unknown_length);
+  RUN_TEST(test_download_unknown_length_cut_short);
+  RUN_TEST(test_download_http_error_leaves_nothing);
+  return UNITY_END();
+}
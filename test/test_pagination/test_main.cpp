@@ -0,0 +1,178 @@
+// Pagination cost of the builtin reader fonts with their kerning and ligature tables, against the same fonts with
+// the tables left out (what the fonts were before they carried them). The same chapter text is laid out with
+// ParsedText at the portrait reader width, as Section::createSectionFile does, and the time per pass is reported.
+
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <climits>
+#include <string>
+
+#include "../../lib/EpdFont/EpdFont.cpp"
+#include "../../lib/EpdFont/EpdFontFamily.cpp"
+#include "../../lib/Epub/Epub/ParsedText.cpp"
+#include "../../lib/Epub/Epub/blocks/TextBlock.cpp"
+#include "../../lib/GfxRenderer/Bitmap.cpp"
+#include "../../lib/GfxRenderer/BitmapHelpers.cpp"
+#include "../../lib/GfxRenderer/GfxRenderer.cpp"
+#include "../../lib/Utf8/Utf8.cpp"
+
+namespace {
+constexpr int KERNED_FONT_ID = 1;
+constexpr int PLAIN_FONT_ID = 2;
+// Portrait width less the viewable area and the default screen margin on both sides
+constexpr uint16_t VIEWPORT_WIDTH = 480 - 2 * (GfxRenderer::VIEWABLE_MARGIN_LEFT + 5);
+constexpr int PASSES = 200;
+
+// Public domain (Jane Austen, Pride and Prejudice, chapter 1)
+const char* const PARAGRAPHS[] = {
+    "It is a truth universally acknowledged, that a single man in possession of a good fortune, must be in want of a "
+    "wife.",
+    "However little known the feelings or views of such a man may be on his first entering a neighbourhood, this "
+    "truth is so well fixed in the minds of the surrounding families, that he is considered the rightful property of "
+    "some one or other of their daughters.",
+    "\xe2\x80\x9cMy dear Mr. Bennet,\xe2\x80\x9d said his lady to him one day, \xe2\x80\x9chave you heard that "
+    "Netherfield Park is let at last?\xe2\x80\x9d",
+    "Mr. Bennet replied that he had not.",
+    "\xe2\x80\x9c" "But it is,\xe2\x80\x9d returned she; \xe2\x80\x9c" "for Mrs. Long has just been here, and she "
+    "told me all about it.\xe2\x80\x9d",
+    "Mr. Bennet made no answer.",
+    "\xe2\x80\x9c" "Do you not want to know who has taken it?\xe2\x80\x9d cried his wife impatiently.",
+    "\xe2\x80\x9cYou want to tell me, and I have no objection to hearing it.\xe2\x80\x9d",
+    "This was invitation enough.",
+    "\xe2\x80\x9cWhy, my dear, you must know, Mrs. Long says that Netherfield is taken by a young man of large fortune "
+    "from the north of England; that he came down on Monday in a chaise and four to see the place, and was so much "
+    "delighted with it, that he agreed with Mr. Morris immediately; that he is to take possession before Michaelmas, "
+    "and some of his servants are to be in the house by the end of next week.\xe2\x80\x9d",
+    "\xe2\x80\x9cWhat is his name?\xe2\x80\x9d",
+    "\xe2\x80\x9c" "Bingley.\xe2\x80\x9d",
+    "\xe2\x80\x9cIs he married or single?\xe2\x80\x9d",
+    "\xe2\x80\x9cOh! Single, my dear, to be sure! A single man of large fortune; four or five thousand a year. What a "
+    "fine thing for our girls!\xe2\x80\x9d",
+    "\xe2\x80\x9cHow so? How can it affect them?\xe2\x80\x9d",
+    "\xe2\x80\x9cMy dear Mr. Bennet,\xe2\x80\x9d replied his wife, \xe2\x80\x9chow can you be so tiresome! You must "
+    "know that I am thinking of his marrying one of them.\xe2\x80\x9d",
+    "\xe2\x80\x9cIs that his design in settling here?\xe2\x80\x9d",
+    "\xe2\x80\x9c" "Design! Nonsense, how can you talk so! But it is very likely that he may fall in love with one of "
+    "them, and therefore you must visit him as soon as he comes.\xe2\x80\x9d",
+};
+
+EpdFontData withoutTables(const EpdFontData& font) {
+  EpdFontData plain = font;
+  plain.kernLeftClasses = nullptr;
+  plain.kernLeftCount = 0;
+  plain.kernRightClasses = nullptr;
+  plain.kernRightCount = 0;
+  plain.kernMatrix = nullptr;
+  plain.kernLeftClassCount = 0;
+  plain.kernRightClassCount = 0;
+  plain.ligatures = nullptr;
+  plain.ligatureCount = 0;
+  return plain;
+}
+
+const EpdFontData plainRegularData = withoutTables(bookerly_14_regular);
+const EpdFontData plainBoldData = withoutTables(bookerly_14_bold);
+const EpdFontData plainItalicData = withoutTables(bookerly_14_italic);
+const EpdFont kernedRegular(&bookerly_14_regular);
+const EpdFont kernedBold(&bookerly_14_bold);
+const EpdFont kernedItalic(&bookerly_14_italic);
+const EpdFont plainRegular(&plainRegularData);
+const EpdFont plainBold(&plainBoldData);
+const EpdFont plainItalic(&plainItalicData);
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+
+struct LayoutResult {
+  size_t lines;
+  unsigned long micros;  // Fastest pass, the host is shared with other work
+};
+
+// Lays out every paragraph once per pass, every fifth word in italics as chapter text often has some
+LayoutResult layOut(const int fontId, const int passes) {
+  LayoutResult result = {0, ULONG_MAX};
+  for (int pass = 0; pass < passes; pass++) {
+    size_t lines = 0;
+    const unsigned long start = micros();
+    for (const char* paragraph : PARAGRAPHS) {
+      ParsedText text(TextBlock::JUSTIFIED, false);
+      std::string word;
+      int wordIndex = 0;
+      for (const char* c = paragraph;; c++) {
+        if (*c == ' ' || *c == '\0') {
+          text.addWord(word, wordIndex++ % 5 == 4 ? EpdFontFamily::ITALIC : EpdFontFamily::REGULAR);
+          word.clear();
+          if (*c == '\0') {
+            break;
+          }
+        } else {
+          word += *c;
+        }
+      }
+      text.layoutAndExtractLines(renderer, fontId, VIEWPORT_WIDTH,
+                                 [&lines](const std::shared_ptr<TextBlock>&) { lines++; });
+    }
+    const unsigned long elapsed = micros() - start;
+    result.lines = lines;
+    result.micros = std::min(result.micros, elapsed);
+  }
+  return result;
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_builtin_fonts_carry_tables() {
+  TEST_ASSERT_NOT_NULL(bookerly_14_regular.kernMatrix);
+  TEST_ASSERT_GREATER_THAN(0, bookerly_14_regular.kernLeftCount);
+  TEST_ASSERT_GREATER_THAN(0, bookerly_14_regular.kernRightCount);
+  TEST_ASSERT_NOT_NULL(bookerly_14_regular.ligatures);
+}
+
+void test_kerning_tightens_pairs() {
+  // Classic kerning pairs come out narrower than the sum of their advances
+  for (const char* pair : {"AV", "To", "Wa"}) {
+    TEST_ASSERT_TRUE_MESSAGE(renderer.getTextWidth(KERNED_FONT_ID, pair) < renderer.getTextWidth(PLAIN_FONT_ID, pair),
+                             pair);
+  }
+}
+
+void test_ligatures_replace_pairs() {
+  const char* text = "office";
+  const char* rest = text + 2;
+  TEST_ASSERT_EQUAL_UINT32(0xFB03, kernedRegular.applyLigatures('f', &rest));  // "ffi"
+  TEST_ASSERT_EQUAL_STRING("ce", rest);
+  rest = text + 2;
+  TEST_ASSERT_EQUAL_UINT32('f', plainRegular.applyLigatures('f', &rest));
+}
+
+void test_pagination_benchmark() {
+  const LayoutResult plain = layOut(PLAIN_FONT_ID, PASSES);
+  const LayoutResult kerned = layOut(KERNED_FONT_ID, PASSES);
+  TEST_ASSERT_GREATER_THAN(0, plain.lines);
+  TEST_ASSERT_GREATER_THAN(0, kerned.lines);
+
+  char message[160];
+  snprintf(message, sizeof(message), "without tables: %lu us, %zu lines; with tables: %lu us, %zu lines (%+.1f%%)",
+           plain.micros, plain.lines, kerned.micros, kerned.lines,
+           100.0 * (static_cast<double>(kerned.micros) - plain.micros) / plain.micros);
+  TEST_MESSAGE(message);
+}
+
+int main() {
+  renderer.insertFont(KERNED_FONT_ID, EpdFontFamily(&kernedRegular, &kernedBold, &kernedItalic));
+  renderer.insertFont(PLAIN_FONT_ID, EpdFontFamily(&plainRegular, &plainBold, &plainItalic));
+
+  UNITY_BEGIN();
+  RUN_TEST(test_builtin_fonts_carry_tables);
+  RUN_TEST(test_kerning_tightens_pairs);
+  RUN_TEST(test_ligatures_replace_pairs);
+  RUN_TEST(test_pagination_benchmark);
+  return UNITY_END();
+}
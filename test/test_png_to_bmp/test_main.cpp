@@ -0,0 +1,534 @@
+// Conformance of PngToBmpConverter over the cases PngSuite covers: every color type at every bit depth it allows
+// (basn*), the same interlaced with Adam7 (basi*), each row filter on its own (f0*), Adam7 at sizes where passes are
+// empty (s*i*), tRNS color keys and palette alpha (tb*, tp*), and image data split over many IDAT chunks (oi*).
+// The images are built by the test from known samples: rows are filtered, interlaced and deflated here, so the gray
+// rows the converter hands to the BMP encoder can be checked against the samples pixel for pixel. The conversion
+// throughput for cover-sized images is reported.
+
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../lib/miniz/miniz.c"
+#include "../../lib/PngToBmpConverter/PngToBmpConverter.cpp"
+
+namespace {
+constexpr char PNG_PATH[] = "/image.png";
+constexpr char SCRATCH_DIR[] = "/.crosspoint";
+constexpr char SCRATCH_PATH[] = "/.crosspoint/interlace.tmp";
+constexpr int CYCLE_FILTERS = -1;  // Filter type (row % 5) on each row
+constexpr int BENCHMARK_PASSES = 5;
+
+struct Options {
+  int width = 32;
+  int height = 32;
+  uint8_t colorType = COLOR_GRAY;
+  uint8_t bitDepth = 8;
+  bool interlaced = false;
+  int filter = CYCLE_FILTERS;
+  bool colorKey = false;         // tRNS with a single transparent gray level or color, used by every third pixel
+  int paletteAlphaEntries = 0;   // tRNS alpha for the first entries of the palette
+  size_t idatChunkSize = 65536;  // Largest IDAT chunk the compressed stream is split into
+  bool emptyIdats = false;       // Put a zero-length IDAT chunk in front of each one holding data
+  bool smooth = false;           // Gradients with a little noise rather than noise alone, which the filters predict
+};
+
+struct Image {
+  Options options;
+  int channels = 1;
+  std::vector<uint16_t> samples;  // Row-major, channels per pixel
+  uint8_t palette[256][3] = {};
+  uint8_t paletteAlpha[256] = {};
+  int paletteSize = 0;
+  uint16_t key[3] = {};
+  std::vector<uint8_t> png;
+  std::vector<uint8_t> expectedGray;
+};
+
+// Gray rows handed to the encoder stand-in below
+std::vector<uint8_t> decodedRows;
+int decodedWidth = 0;
+bool encoderFinished = false;
+
+class NullPrint : public Print {
+ public:
+  size_t write(uint8_t) override { return 1; }
+};
+
+int channelsOf(const uint8_t colorType) {
+  switch (colorType) {
+    case COLOR_RGB:
+      return 3;
+    case COLOR_GRAY_ALPHA:
+      return 2;
+    case COLOR_RGBA:
+      return 4;
+    default:
+      return 1;
+  }
+}
+
+void appendBE32(std::vector<uint8_t>& out, const uint32_t value) {
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back(static_cast<uint8_t>(value >> shift));
+  }
+}
+
+void appendChunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& data) {
+  appendBE32(png, static_cast<uint32_t>(data.size()));
+  const size_t typeStart = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), data.begin(), data.end());
+  appendBE32(png, static_cast<uint32_t>(mz_crc32(MZ_CRC32_INIT, png.data() + typeStart, png.size() - typeStart)));
+}
+
+// Packs one row of samples the way PNG stores them: big-endian 16-bit, or sub-byte samples from the high bits down
+std::vector<uint8_t> packRow(const Image& image, const int y, const int startX, const int stepX, const int pixels) {
+  const int depth = image.options.bitDepth;
+  const int rowSamples = pixels * image.channels;
+  std::vector<uint8_t> row((static_cast<size_t>(rowSamples) * depth + 7) / 8);
+  for (int i = 0; i < rowSamples; i++) {
+    const int x = startX + (i / image.channels) * stepX;
+    const uint16_t sample = image.samples[(static_cast<size_t>(y) * image.options.width + x) * image.channels +
+                                          i % image.channels];
+    if (depth == 16) {
+      row[i * 2] = static_cast<uint8_t>(sample >> 8);
+      row[i * 2 + 1] = static_cast<uint8_t>(sample);
+    } else {
+      const int bit = i * depth;
+      row[bit / 8] |= static_cast<uint8_t>(sample << (8 - depth - bit % 8));
+    }
+  }
+  return row;
+}
+
+// Applies the row filter to raw against the previous raw row of the same pass
+std::vector<uint8_t> filterRow(const int type, const std::vector<uint8_t>& raw, const std::vector<uint8_t>& prior,
+                               const size_t bpp) {
+  std::vector<uint8_t> out(raw.size() + 1);
+  out[0] = static_cast<uint8_t>(type);
+  for (size_t i = 0; i < raw.size(); i++) {
+    const int left = i >= bpp ? raw[i - bpp] : 0;
+    const int up = prior[i];
+    const int upLeft = i >= bpp ? prior[i - bpp] : 0;
+    int predicted = 0;
+    switch (type) {
+      case 1:
+        predicted = left;
+        break;
+      case 2:
+        predicted = up;
+        break;
+      case 3:
+        predicted = (left + up) / 2;
+        break;
+      case 4: {
+        const int p = left + up - upLeft;
+        const int pa = std::abs(p - left);
+        const int pb = std::abs(p - up);
+        const int pc = std::abs(p - upLeft);
+        predicted = pa <= pb && pa <= pc ? left : pb <= pc ? up : upLeft;
+        break;
+      }
+      default:
+        break;
+    }
+    out[i + 1] = static_cast<uint8_t>(raw[i] - predicted);
+  }
+  return out;
+}
+
+void encode(Image& image) {
+  const Options& o = image.options;
+  const size_t bpp = std::max(1, image.channels * o.bitDepth / 8);
+
+  // The filtered scanlines of every (non-empty) pass in order, as the inflated IDAT stream holds them
+  std::vector<uint8_t> stream;
+  for (int pass = 0; pass < (o.interlaced ? 7 : 1); pass++) {
+    const int startX = o.interlaced ? ADAM7_START_X[pass] : 0;
+    const int startY = o.interlaced ? ADAM7_START_Y[pass] : 0;
+    const int stepX = o.interlaced ? ADAM7_STEP_X[pass] : 1;
+    const int stepY = o.interlaced ? ADAM7_STEP_Y[pass] : 1;
+    const int passWidth = (o.width - startX + stepX - 1) / stepX;
+    const int passHeight = (o.height - startY + stepY - 1) / stepY;
+    if (passWidth <= 0 || passHeight <= 0) {
+      continue;
+    }
+    std::vector<uint8_t> prior;
+    for (int row = 0; row < passHeight; row++) {
+      const std::vector<uint8_t> raw = packRow(image, startY + row * stepY, startX, stepX, passWidth);
+      prior.resize(raw.size());
+      const int type = o.filter == CYCLE_FILTERS ? row % 5 : o.filter;
+      const std::vector<uint8_t> filtered = filterRow(type, raw, prior, bpp);
+      stream.insert(stream.end(), filtered.begin(), filtered.end());
+      prior = raw;
+    }
+  }
+
+  mz_ulong compressedSize = mz_compressBound(stream.size());
+  std::vector<uint8_t> compressed(compressedSize);
+  TEST_ASSERT_EQUAL(MZ_OK, mz_compress2(compressed.data(), &compressedSize, stream.data(), stream.size(), 6));
+  compressed.resize(compressedSize);
+
+  std::vector<uint8_t>& png = image.png;
+  png.assign(PNG_SIGNATURE, PNG_SIGNATURE + sizeof(PNG_SIGNATURE));
+  std::vector<uint8_t> header;
+  appendBE32(header, o.width);
+  appendBE32(header, o.height);
+  header.insert(header.end(), {o.bitDepth, o.colorType, 0, 0, static_cast<uint8_t>(o.interlaced ? 1 : 0)});
+  appendChunk(png, "IHDR", header);
+  const std::string comment = "Comment";
+  appendChunk(png, "tEXt", std::vector<uint8_t>(comment.begin(), comment.end()));
+
+  if (o.colorType == COLOR_PALETTE) {
+    std::vector<uint8_t> entries;
+    for (int i = 0; i < image.paletteSize; i++) {
+      entries.insert(entries.end(), image.palette[i], image.palette[i] + 3);
+    }
+    appendChunk(png, "PLTE", entries);
+    if (o.paletteAlphaEntries > 0) {
+      appendChunk(png, "tRNS", std::vector<uint8_t>(image.paletteAlpha, image.paletteAlpha + o.paletteAlphaEntries));
+    }
+  }
+  if (o.colorKey) {
+    std::vector<uint8_t> key;
+    for (int c = 0; c < image.channels; c++) {
+      key.push_back(static_cast<uint8_t>(image.key[c] >> 8));
+      key.push_back(static_cast<uint8_t>(image.key[c]));
+    }
+    appendChunk(png, "tRNS", key);
+  }
+
+  for (size_t offset = 0; offset < compressed.size(); offset += o.idatChunkSize) {
+    if (o.emptyIdats) {
+      appendChunk(png, "IDAT", {});
+    }
+    const size_t length = std::min(o.idatChunkSize, compressed.size() - offset);
+    appendChunk(png, "IDAT", std::vector<uint8_t>(compressed.begin() + offset, compressed.begin() + offset + length));
+  }
+  appendChunk(png, "IEND", {});
+}
+
+// The gray level of every pixel as the converter defines it: samples reduced to 8 bits, RGB weighted 25/50/25,
+// alpha composited onto white, color-keyed pixels white
+void computeExpected(Image& image) {
+  const Options& o = image.options;
+  const int shift = o.bitDepth == 16 ? 8 : 0;
+  const int scale = o.bitDepth < 8 ? 255 / ((1 << o.bitDepth) - 1) : 1;
+  const auto gray = [](const int r, const int g, const int b) { return (r * 25 + g * 50 + b * 25) / 100; };
+  const auto onWhite = [](const int value, const int alpha) { return (value * alpha + 255 * (255 - alpha)) / 255; };
+
+  image.expectedGray.resize(static_cast<size_t>(o.width) * o.height);
+  for (size_t p = 0; p < image.expectedGray.size(); p++) {
+    const uint16_t* s = &image.samples[p * image.channels];
+    bool keyed = o.colorKey;
+    for (int c = 0; c < image.channels; c++) {
+      keyed = keyed && s[c] == image.key[c];
+    }
+    int value;
+    switch (o.colorType) {
+      case COLOR_GRAY:
+        value = keyed ? 255 : (s[0] >> shift) * scale;
+        break;
+      case COLOR_RGB:
+        value = keyed ? 255 : gray(s[0] >> shift, s[1] >> shift, s[2] >> shift);
+        break;
+      case COLOR_PALETTE: {
+        const uint8_t* entry = image.palette[s[0]];
+        value = gray(entry[0], entry[1], entry[2]);
+        if (s[0] < o.paletteAlphaEntries) {
+          value = onWhite(value, image.paletteAlpha[s[0]]);
+        }
+        break;
+      }
+      case COLOR_GRAY_ALPHA:
+        value = onWhite(s[0] >> shift, s[1] >> shift);
+        break;
+      default:
+        value = onWhite(gray(s[0] >> shift, s[1] >> shift, s[2] >> shift), s[3] >> shift);
+        break;
+    }
+    image.expectedGray[p] = static_cast<uint8_t>(value);
+  }
+}
+
+Image makeImage(const Options& options, const uint32_t seed) {
+  Image image;
+  image.options = options;
+  image.channels = channelsOf(options.colorType);
+  const int maxSample = (1 << options.bitDepth) - 1;
+  std::mt19937 random(seed);
+
+  if (options.colorType == COLOR_PALETTE) {
+    image.paletteSize = std::min(256, 1 << options.bitDepth);
+    for (int i = 0; i < image.paletteSize; i++) {
+      for (int c = 0; c < 3; c++) {
+        image.palette[i][c] = static_cast<uint8_t>(random());
+      }
+      image.paletteAlpha[i] = static_cast<uint8_t>(random());
+    }
+    image.paletteAlpha[0] = 0;
+    image.paletteAlpha[1 % image.paletteSize] = 255;
+  }
+
+  image.samples.resize(static_cast<size_t>(options.width) * options.height * image.channels);
+  for (int y = 0; y < options.height; y++) {
+    for (int x = 0; x < options.width; x++) {
+      for (int c = 0; c < image.channels; c++) {
+        uint32_t sample = random();
+        if (options.smooth) {
+          // Gradients with a little noise, which the filters predict well
+          sample = (static_cast<uint32_t>(x * 7 + y * 3 + c * 50) & 0xFF) * 257 + sample % 512;
+          sample = std::min<uint32_t>(sample, 0xFFFF) >> (16 - options.bitDepth);
+        }
+        const int limit = options.colorType == COLOR_PALETTE ? image.paletteSize - 1 : maxSample;
+        image.samples[(static_cast<size_t>(y) * options.width + x) * image.channels + c] =
+            static_cast<uint16_t>(sample % (limit + 1));
+      }
+      // Alpha at its extremes too, where compositing must give the color itself and white
+      if (options.colorType == COLOR_GRAY_ALPHA || options.colorType == COLOR_RGBA) {
+        uint16_t& alpha = image.samples[(static_cast<size_t>(y) * options.width + x + 1) * image.channels - 1];
+        if (x % 5 == 0) alpha = 0;
+        if (x % 5 == 1) alpha = static_cast<uint16_t>(maxSample);
+      }
+    }
+  }
+
+  if (options.colorKey) {
+    for (int c = 0; c < image.channels; c++) {
+      image.key[c] = static_cast<uint16_t>(random() % (maxSample + 1));
+    }
+    for (size_t p = 0; p < image.samples.size() / image.channels; p += 3) {
+      std::copy(image.key, image.key + image.channels, &image.samples[p * image.channels]);
+    }
+  }
+
+  encode(image);
+  computeExpected(image);
+  return image;
+}
+
+std::string describe(const Options& o) {
+  char text[160];
+  snprintf(text, sizeof(text), "%dx%d color type %d, %d bit, %s, filter %d, color key %d, palette alpha %d, IDAT %zu",
+           o.width, o.height, o.colorType, o.bitDepth, o.interlaced ? "Adam7" : "non-interlaced", o.filter,
+           o.colorKey, o.paletteAlphaEntries, o.idatChunkSize);
+  return text;
+}
+
+bool convert(const Image& image) {
+  FsFile out;
+  if (!SdMan.openFileForWrite("TEST", PNG_PATH, out) || out.write(image.png.data(), image.png.size()) !=
+                                                            image.png.size()) {
+    return false;
+  }
+  out.close();
+
+  FsFile file;
+  if (!SdMan.openFileForRead("TEST", PNG_PATH, file)) {
+    return false;
+  }
+  decodedRows.clear();
+  encoderFinished = false;
+  NullPrint bmp;
+  uint16_t width = 0;
+  uint16_t height = 0;
+  const bool converted = PngToBmpConverter::pngFileToBmpStreamScaled(file, bmp, 4096, 4096, &width, &height,
+                                                                     SCRATCH_PATH);
+  file.close();
+  return converted && width == image.options.width && height == image.options.height;
+}
+
+void assertConverts(const Options& options, const uint32_t seed = 1) {
+  const Image image = makeImage(options, seed);
+  const std::string context = describe(options);
+  TEST_ASSERT_TRUE_MESSAGE(convert(image), context.c_str());
+  TEST_ASSERT_TRUE_MESSAGE(encoderFinished, context.c_str());
+  TEST_ASSERT_FALSE_MESSAGE(SdMan.exists(SCRATCH_PATH), context.c_str());
+  TEST_ASSERT_EQUAL_MESSAGE(image.expectedGray.size(), decodedRows.size(), context.c_str());
+  for (size_t p = 0; p < decodedRows.size(); p++) {
+    if (decodedRows[p] != image.expectedGray[p]) {
+      const std::string pixel = context + ", pixel (" + std::to_string(p % options.width) + ", " +
+                                std::to_string(p / options.width) + ")";
+      TEST_ASSERT_EQUAL_UINT8_MESSAGE(image.expectedGray[p], decodedRows[p], pixel.c_str());
+    }
+  }
+}
+
+// Valid bit depths of each color type
+struct Format {
+  uint8_t colorType;
+  std::vector<uint8_t> depths;
+};
+
+const std::vector<Format>& formats() {
+  static const std::vector<Format> all = {
+      {COLOR_GRAY, {1, 2, 4, 8, 16}}, {COLOR_RGB, {8, 16}},      {COLOR_PALETTE, {1, 2, 4, 8}},
+      {COLOR_GRAY_ALPHA, {8, 16}},    {COLOR_RGBA, {8, 16}},
+  };
+  return all;
+}
+}  // namespace
+
+// Stands in for the BMP encoder and keeps the gray rows the converter hands over
+BmpWriter::BmpWriter(Print& out) : out(out), buffer(nullptr) {}
+BmpWriter::~BmpWriter() = default;
+ScaledBmpEncoder::ScaledBmpEncoder(Print& out, const int srcWidth, const int srcHeight, const int, const int)
+    : bmpWriter(out), srcWidth(srcWidth), bmpWidth(srcWidth), bmpHeight(srcHeight) {}
+ScaledBmpEncoder::~ScaledBmpEncoder() = default;
+bool ScaledBmpEncoder::begin() {
+  decodedWidth = srcWidth;
+  return true;
+}
+void ScaledBmpEncoder::writeSourceRow(const uint8_t* gray) {
+  decodedRows.insert(decodedRows.end(), gray, gray + decodedWidth);
+}
+bool ScaledBmpEncoder::finish() {
+  encoderFinished = decodedRows.size() == static_cast<size_t>(bmpWidth) * bmpHeight;
+  return true;
+}
+
+void setUp() { SdMan.mkdir(SCRATCH_DIR); }
+
+void tearDown() {}
+
+void test_every_color_type_and_bit_depth() {
+  for (const bool interlaced : {false, true}) {
+    for (const Format& format : formats()) {
+      for (const uint8_t depth : format.depths) {
+        Options options;
+        options.colorType = format.colorType;
+        options.bitDepth = depth;
+        options.interlaced = interlaced;
+        assertConverts(options);
+      }
+    }
+  }
+}
+
+void test_each_filter_type() {
+  // Sub-byte, byte and multi-byte pixels, where the filters' left neighbour is 1, 1, 3 and 8 bytes back
+  const Options shapes[] = {
+      {.width = 33, .height = 17, .colorType = COLOR_GRAY, .bitDepth = 2},
+      {.width = 33, .height = 17, .colorType = COLOR_GRAY, .bitDepth = 8},
+      {.width = 33, .height = 17, .colorType = COLOR_RGB, .bitDepth = 8},
+      {.width = 33, .height = 17, .colorType = COLOR_RGBA, .bitDepth = 16},
+  };
+  for (Options options : shapes) {
+    for (const bool interlaced : {false, true}) {
+      for (int filter = 0; filter <= 4; filter++) {
+        options.interlaced = interlaced;
+        options.filter = filter;
+        assertConverts(options);
+        options.smooth = true;
+        assertConverts(options);
+        options.smooth = false;
+      }
+    }
+  }
+}
+
+void test_adam7_sizes() {
+  // Small sizes leave some of the seven passes empty, odd ones cut passes short at the right and bottom edges
+  for (int size = 1; size <= 10; size++) {
+    for (const Options& format : {Options{.colorType = COLOR_PALETTE, .bitDepth = 1},
+                                  Options{.colorType = COLOR_PALETTE, .bitDepth = 4},
+                                  Options{.colorType = COLOR_RGB, .bitDepth = 8}}) {
+      Options options = format;
+      options.interlaced = true;
+      options.width = size;
+      options.height = size;
+      assertConverts(options);
+      options.width = size + 3;
+      options.height = 1;
+      assertConverts(options);
+      options.width = 1;
+      options.height = size + 3;
+      assertConverts(options);
+    }
+  }
+  for (const int size : {31, 32, 33, 39, 40}) {
+    assertConverts({.width = size, .height = size, .colorType = COLOR_GRAY, .bitDepth = 4, .interlaced = true});
+  }
+}
+
+void test_transparency() {
+  for (const bool interlaced : {false, true}) {
+    for (const uint8_t depth : {1, 2, 4, 8, 16}) {
+      assertConverts({.colorType = COLOR_GRAY, .bitDepth = depth, .interlaced = interlaced, .colorKey = true});
+    }
+    for (const uint8_t depth : {8, 16}) {
+      assertConverts({.colorType = COLOR_RGB, .bitDepth = depth, .interlaced = interlaced, .colorKey = true});
+    }
+    // tRNS shorter than the palette leaves the remaining entries opaque
+    for (const uint8_t depth : {1, 2, 4, 8}) {
+      const int entries = 1 << depth;
+      for (const int alphaEntries : {entries, std::max(1, entries / 2 - 1)}) {
+        assertConverts({.colorType = COLOR_PALETTE,
+                        .bitDepth = depth,
+                        .interlaced = interlaced,
+                        .paletteAlphaEntries = std::min(alphaEntries, 256)});
+      }
+    }
+  }
+}
+
+void test_split_idat() {
+  for (const size_t chunkSize : {size_t{1}, size_t{7}, size_t{1000}}) {
+    for (const bool interlaced : {false, true}) {
+      assertConverts({.width = 41,
+                      .height = 23,
+                      .colorType = COLOR_RGB,
+                      .bitDepth = 8,
+                      .interlaced = interlaced,
+                      .idatChunkSize = chunkSize,
+                      .emptyIdats = true});
+    }
+  }
+}
+
+void test_conversion_throughput() {
+  const Options benchmarks[] = {
+      {.width = 480, .height = 800, .colorType = COLOR_GRAY, .bitDepth = 8, .smooth = true},
+      {.width = 480, .height = 800, .colorType = COLOR_PALETTE, .bitDepth = 4, .smooth = true},
+      {.width = 480, .height = 800, .colorType = COLOR_RGB, .bitDepth = 8, .smooth = true},
+      {.width = 480, .height = 800, .colorType = COLOR_RGBA, .bitDepth = 8, .smooth = true},
+      {.width = 480, .height = 800, .colorType = COLOR_RGB, .bitDepth = 16, .smooth = true},
+      {.width = 480, .height = 800, .colorType = COLOR_RGB, .bitDepth = 8, .interlaced = true, .smooth = true},
+  };
+  for (const Options& options : benchmarks) {
+    const Image image = makeImage(options, 7);
+    auto fastest = std::chrono::steady_clock::duration::max();
+    for (int pass = 0; pass < BENCHMARK_PASSES; pass++) {
+      const auto start = std::chrono::steady_clock::now();
+      TEST_ASSERT_TRUE(convert(image));
+      fastest = std::min(fastest, std::chrono::steady_clock::now() - start);
+    }
+    TEST_ASSERT_TRUE(decodedRows == image.expectedGray);
+
+    const double seconds = std::chrono::duration<double>(fastest).count();
+    const double pixels = static_cast<double>(options.width) * options.height;
+    char message[200];
+    snprintf(message, sizeof(message), "%s: %zu byte PNG, %.1f ms, %.1f Mpixel/s, %.1f MB/s of PNG",
+             describe(options).c_str(), image.png.size(), seconds * 1e3, pixels / seconds / 1e6,
+             image.png.size() / seconds / 1e6);
+    TEST_MESSAGE(message);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_color_type_and_bit_depth);
+  RUN_TEST(test_each_filter_type);
+  RUN_TEST(test_adam7_sizes);
+  RUN_TEST(test_transparency);
+  RUN_TEST(test_split_idat);
+  RUN_TEST(test_conversion_throughput);
+  return UNITY_END();
+}
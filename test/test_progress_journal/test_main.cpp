@@ -0,0 +1,185 @@
+// Fault injection for ProgressJournal: the log is cut short and corrupted at every byte offset, and a compaction is
+// interrupted at each of its steps, as power loss would leave it. open() has to come back with the newest record
+// that was written completely, and the next flush has to leave a log that reads back correctly.
+
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#include "../../lib/miniz/miniz.c"
+#include "../../src/ProgressJournal.cpp"
+
+namespace {
+constexpr char BOOK_DIR[] = "/.crosspoint/epub_1";
+constexpr char LOG_PATH[] = "/.crosspoint/epub_1/progress.log";
+constexpr char TMP_PATH[] = "/.crosspoint/epub_1/progress.log.tmp";
+constexpr size_t RECORD_SIZE = 16;
+constexpr int LOG_RECORDS = 6;
+
+// Position written as the n-th record (from 0), distinct in both fields
+uint16_t spineOf(const int n) { return static_cast<uint16_t>(3 + n); }
+uint32_t pageOf(const int n) { return static_cast<uint32_t>(100 + 7 * n); }
+
+std::vector<uint8_t> readFile(const char* path) {
+  std::vector<uint8_t> bytes;
+  FsFile file;
+  if (SdMan.openFileForRead("TEST", path, file)) {
+    bytes.resize(file.size());
+    file.read(bytes.data(), bytes.size());
+    file.close();
+  }
+  return bytes;
+}
+
+void writeFile(const char* path, const std::vector<uint8_t>& bytes, const size_t length) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", path, file));
+  TEST_ASSERT_EQUAL(length, file.write(bytes.data(), length));
+  file.close();
+}
+
+// Writes `count` records through the journal itself and returns the log's bytes
+std::vector<uint8_t> writeLog(const int count) {
+  SdMan.removeDir(BOOK_DIR);
+  SdMan.mkdir(BOOK_DIR);
+  ProgressJournal journal;
+  uint16_t spine;
+  uint32_t page;
+  journal.open(LOG_PATH, &spine, &page);
+  for (int n = 0; n < count; n++) {
+    journal.update(spineOf(n), pageOf(n));
+    TEST_ASSERT_TRUE(journal.flush());
+  }
+  return readFile(LOG_PATH);
+}
+
+// open() returns the n-th record, or nothing for n < 0
+void assertOpens(const int n, const std::string& context) {
+  ProgressJournal journal;
+  uint16_t spine = 0;
+  uint32_t page = 0;
+  const bool found = journal.open(LOG_PATH, &spine, &page);
+  if (n < 0) {
+    TEST_ASSERT_FALSE_MESSAGE(found, context.c_str());
+    return;
+  }
+  TEST_ASSERT_TRUE_MESSAGE(found, context.c_str());
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(spineOf(n), spine, context.c_str());
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(pageOf(n), page, context.c_str());
+}
+
+// A journal opened on the damaged log takes one more position, which has to be what the log reads back
+void assertRecovers(const std::string& context) {
+  constexpr int NEXT = 50;
+  ProgressJournal journal;
+  uint16_t spine;
+  uint32_t page;
+  journal.open(LOG_PATH, &spine, &page);
+  journal.update(spineOf(NEXT), pageOf(NEXT));
+  TEST_ASSERT_TRUE_MESSAGE(journal.flush(), context.c_str());
+  assertOpens(NEXT, context + ", after the next flush");
+  TEST_ASSERT_EQUAL_MESSAGE(0, readFile(LOG_PATH).size() % RECORD_SIZE, context.c_str());
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_reads_newest_record() {
+  const std::vector<uint8_t> log = writeLog(LOG_RECORDS);
+  TEST_ASSERT_EQUAL(LOG_RECORDS * RECORD_SIZE, log.size());
+  assertOpens(LOG_RECORDS - 1, "intact log");
+}
+
+void test_no_log() {
+  SdMan.removeDir(BOOK_DIR);
+  SdMan.mkdir(BOOK_DIR);
+  assertOpens(-1, "no log");
+}
+
+void test_truncated_at_every_offset() {
+  const std::vector<uint8_t> log = writeLog(LOG_RECORDS);
+  for (size_t length = 0; length <= log.size(); length++) {
+    const std::string context = "log cut to " + std::to_string(length) + " bytes";
+    writeFile(LOG_PATH, log, length);
+    assertOpens(static_cast<int>(length / RECORD_SIZE) - 1, context);
+
+    writeFile(LOG_PATH, log, length);
+    assertRecovers(context);
+  }
+}
+
+void test_corrupted_at_every_offset() {
+  const std::vector<uint8_t> log = writeLog(LOG_RECORDS);
+  for (size_t offset = 0; offset < log.size(); offset++) {
+    const std::string context = "byte " + std::to_string(offset) + " flipped";
+    std::vector<uint8_t> damaged = log;
+    damaged[offset] ^= 0xFF;
+    writeFile(LOG_PATH, damaged, damaged.size());
+    // Only the record holding the flipped byte is lost
+    const int damagedRecord = static_cast<int>(offset / RECORD_SIZE);
+    assertOpens(damagedRecord == LOG_RECORDS - 1 ? LOG_RECORDS - 2 : LOG_RECORDS - 1, context);
+
+    writeFile(LOG_PATH, damaged, damaged.size());
+    assertRecovers(context);
+  }
+}
+
+void test_torn_record_after_corrupt_tail() {
+  // A flipped byte in the last record and a torn one behind it: the record before both wins
+  const std::vector<uint8_t> log = writeLog(LOG_RECORDS);
+  std::vector<uint8_t> damaged = log;
+  damaged[(LOG_RECORDS - 1) * RECORD_SIZE + 5] ^= 0x01;
+  damaged.insert(damaged.end(), log.begin(), log.begin() + RECORD_SIZE / 2);
+  writeFile(LOG_PATH, damaged, damaged.size());
+  assertOpens(LOG_RECORDS - 2, "corrupt last record and a torn one after it");
+  writeFile(LOG_PATH, damaged, damaged.size());
+  assertRecovers("corrupt last record and a torn one after it");
+}
+
+void test_compaction_interrupted_while_writing_copy() {
+  // Power lost while the copy was written: the log is untouched and a .tmp of any length is next to it
+  const std::vector<uint8_t> log = writeLog(LOG_RECORDS);
+  const std::vector<uint8_t> copy(log.end() - RECORD_SIZE, log.end());
+  for (size_t length = 0; length <= RECORD_SIZE; length++) {
+    const std::string context = ".tmp of " + std::to_string(length) + " bytes next to the log";
+    writeFile(LOG_PATH, log, log.size());
+    writeFile(TMP_PATH, copy, length);
+    assertOpens(LOG_RECORDS - 1, context);
+    assertRecovers(context);
+  }
+}
+
+void test_compaction_interrupted_before_rename() {
+  // Power lost after the log was removed: only the complete copy is left, and open() moves it into place
+  const std::vector<uint8_t> log = writeLog(LOG_RECORDS);
+  const std::vector<uint8_t> copy(log.end() - RECORD_SIZE, log.end());
+  SdMan.remove(LOG_PATH);
+  writeFile(TMP_PATH, copy, copy.size());
+  assertOpens(LOG_RECORDS - 1, "only the .tmp left");
+  TEST_ASSERT_TRUE(SdMan.exists(LOG_PATH));
+  TEST_ASSERT_FALSE(SdMan.exists(TMP_PATH));
+  assertRecovers("only the .tmp left");
+}
+
+void test_compacts_full_log() {
+  const std::vector<uint8_t> log = writeLog(ProgressJournal::COMPACT_RECORDS + 1);
+  TEST_ASSERT_EQUAL(RECORD_SIZE, log.size());
+  TEST_ASSERT_FALSE(SdMan.exists(TMP_PATH));
+  assertOpens(ProgressJournal::COMPACT_RECORDS, "compacted log");
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_reads_newest_record);
+  RUN_TEST(test_no_log);
+  RUN_TEST(test_truncated_at_every_offset);
+  RUN_TEST(test_corrupted_at_every_offset);
+  RUN_TEST(test_torn_record_after_corrupt_tail);
+  RUN_TEST(test_compaction_interrupted_while_writing_copy);
+  RUN_TEST(test_compaction_interrupted_before_rename);
+  RUN_TEST(test_compacts_full_log);
+  return UNITY_END();
+}
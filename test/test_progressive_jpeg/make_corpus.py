@@ -0,0 +1,131 @@
+"""Writes the progressive JPEGs for test_progressive_jpeg and libjpeg's decode of each as the reference.
+
+The JPEGs use libjpeg's standard progressive script, whose scans split the coefficients into spectral bands and
+send them over successive approximation passes. Some of the files carry restart markers. The references are the
+luma channel at 1/8, 1/4, 1/2 and full scale, written as binary PGMs.
+
+At full and 1/8 scale the reference is libjpeg's own decode. At 1/4 and 1/2 libjpeg's reduced IDCTs also fold in
+frequencies above the output resolution, which the decoder drops, so there the reference is libjpeg's full-scale
+decode taken back to DCT coefficients and run through the decoder's reduced IDCT, the top-left scale x scale
+coefficients of each block with the 8-point normalisation. That covers the blocks inside the image, so those two
+references stop at the last whole block. The images keep clear of black and white, so libjpeg's full-scale output
+is not clamped and transforms back to the coefficients it was decoded from.
+
+Run from the repository root: python3 test/test_progressive_jpeg/make_corpus.py (needs Pillow and numpy)
+"""
+
+import os
+import struct
+
+import numpy as np
+from PIL import Image
+
+OUT_DIR = os.path.join(os.path.dirname(__file__), "corpus")
+SCALES = (1, 2, 4, 8)
+
+# name, width, height, mode, save options
+IMAGES = [
+    ("color_420", 96, 72, "RGB", {"subsampling": "4:2:0", "quality": 90}),
+    ("color_444_odd_size", 61, 45, "RGB", {"subsampling": "4:4:4", "quality": 85}),
+    ("color_422_restart", 88, 60, "RGB", {"subsampling": "4:2:2", "quality": 80, "optimize": True,
+                                          "restart_marker_blocks": 3}),
+    ("gray_restart_rows", 70, 50, "L", {"quality": 92, "restart_marker_rows": 1}),
+    # 475 luma blocks, over the decoder's RAM budget at full scale, so its coefficients spill to the card
+    ("spill_420_restart", 200, 152, "RGB", {"subsampling": "4:2:0", "quality": 75, "restart_marker_blocks": 7}),
+]
+
+
+def synthetic(width, height, mode, seed):
+    """Gradients, a sine grating, hard edges and noise, so every frequency band carries coefficients."""
+    rng = np.random.default_rng(seed)
+    y, x = np.mgrid[0:height, 0:width].astype(np.float64)
+    base = 80 + 80 * x / width + 15 * np.sin(x * 0.9 + y * 0.35)
+    base += np.where((x // 11 + y // 7) % 2 == 0, 12, -12)
+    base[height // 3:height // 3 + 3, :] = 190
+    base[:, width // 2:width // 2 + 2] = 60
+    channels = [base + rng.normal(0, 8, base.shape)]
+    if mode == "RGB":
+        channels.append(255 - base * 0.8 + rng.normal(0, 8, base.shape))
+        channels.append(128 + 50 * np.cos(y * 0.3) + rng.normal(0, 8, base.shape))
+    pixels = np.clip(np.stack(channels, axis=-1), 50, 205).astype(np.uint8)
+    return Image.fromarray(pixels[:, :, 0] if mode == "L" else pixels, mode)
+
+
+def idct_matrix(points):
+    """[x, u] basis of the points-point IDCT with the 8-point normalisation, as the decoder builds it."""
+    x, u = np.mgrid[0:points, 0:points].astype(np.float64)
+    return 0.5 * np.where(u == 0, np.sqrt(0.5), 1.0) * np.cos((2 * x + 1) * u * np.pi / (2 * points))
+
+
+def reduced(full, scale):
+    """The decoder's reduced IDCT over the whole 8x8 blocks of a full-scale decode."""
+    forward = idct_matrix(8).T
+    inverse = idct_matrix(scale)
+    rows, columns = full.shape[0] // 8, full.shape[1] // 8
+    out = np.zeros((rows * scale, columns * scale))
+    for row in range(rows):
+        for column in range(columns):
+            block = full[row * 8:row * 8 + 8, column * 8:column * 8 + 8].astype(np.float64) - 128
+            coefficients = forward @ block @ forward.T
+            pixels = inverse @ coefficients[:scale, :scale] @ inverse.T + 128
+            out[row * scale:row * scale + scale, column * scale:column * scale + scale] = pixels
+    return Image.fromarray(np.clip(np.rint(out), 0, 255).astype(np.uint8), "L")
+
+
+def scans(data):
+    """(Ss, Se, Ah, Al) of every scan, and whether a restart interval is defined."""
+    result = []
+    restart = False
+    pos = 2
+    while pos < len(data):
+        marker = data[pos + 1]
+        if marker == 0xD9:
+            break
+        length = struct.unpack(">H", data[pos + 2:pos + 4])[0]
+        if marker == 0xDD:
+            restart = struct.unpack(">H", data[pos + 4:pos + 6])[0] > 0
+        if marker == 0xDA:
+            count = data[pos + 4]
+            ss, se, a = data[pos + 5 + 2 * count:pos + 8 + 2 * count]
+            result.append((ss, se, a >> 4, a & 15))
+            # Skip the entropy-coded data up to the next marker that is not a stuffed byte or a restart
+            pos += 2 + length
+            while not (data[pos] == 0xFF and data[pos + 1] != 0 and not 0xD0 <= data[pos + 1] <= 0xD7):
+                pos += 1
+            continue
+        pos += 2 + length
+    return result, restart
+
+
+def main():
+    os.makedirs(OUT_DIR, exist_ok=True)
+    for seed, (name, width, height, mode, options) in enumerate(IMAGES):
+        path = os.path.join(OUT_DIR, name + ".jpg")
+        synthetic(width, height, mode, seed).save(path, "JPEG", progressive=True, **options)
+
+        with open(path, "rb") as f:
+            script, restart = scans(f.read())
+        assert any(ss > 0 and se < 63 for ss, se, _, _ in script), "no spectral selection"
+        assert any(ah > 0 for _, _, ah, _ in script), "no successive approximation"
+        assert restart == ("restart_marker_blocks" in options or "restart_marker_rows" in options)
+
+        decodes = {}
+        for scale in (1, 8):
+            size = ((width * scale + 7) // 8, (height * scale + 7) // 8)
+            with Image.open(path) as image:
+                # draft() picks the smallest libjpeg scale that still covers the requested size
+                image.draft("L", (width * scale // 8, height * scale // 8))
+                decodes[scale] = image.convert("L")
+            assert decodes[scale].size == size, (name, scale, decodes[scale].size)
+        full = np.asarray(decodes[8])
+        assert full.min() > 0 and full.max() < 255, f"{name} is clamped, the coefficients cannot be recovered"
+        for scale in (2, 4):
+            decodes[scale] = reduced(full, scale)
+        for scale in SCALES:
+            decodes[scale].save(os.path.join(OUT_DIR, f"{name}.{scale}.pgm"))
+
+        print(f"{name}: {os.path.getsize(path)} bytes, {len(script)} scans, restart markers: {restart}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,253 @@
+// Decodes progressive JPEGs with ProgressiveJpegDecoder at every scale and compares the gray rows with a reference
+// decode by libjpeg. The files in corpus/ follow libjpeg's progressive script, whose DC and AC scans are split into
+// spectral bands and sent over successive approximation passes. They come in 4:2:0, 4:2:2, 4:4:4 and grayscale,
+// with and without restart markers, and one is large enough for the coefficient store to spill to the card at full
+// scale. make_corpus.py writes the files and the references, and explains how the 2/8 and 4/8 ones are derived.
+// The heap high-water mark of every decode is reported and held to the decoder's RAM budget.
+
+#include <unity.h>
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ScaledBmpEncoder.h"
+
+namespace {
+// Heap in use by the decoder (its own object included), and its high-water mark
+size_t heapInUse = 0;
+size_t heapPeak = 0;
+
+void* trackedAlloc(const size_t size, const bool zero) {
+  auto* block = static_cast<size_t*>(zero ? calloc(size + sizeof(max_align_t), 1) : malloc(size + sizeof(max_align_t)));
+  if (!block) {
+    return nullptr;
+  }
+  *block = size;
+  heapInUse += size;
+  heapPeak = std::max(heapPeak, heapInUse);
+  return reinterpret_cast<char*>(block) + sizeof(max_align_t);
+}
+
+void trackedFree(void* pointer) {
+  if (pointer) {
+    auto* block = reinterpret_cast<size_t*>(static_cast<char*>(pointer) - sizeof(max_align_t));
+    heapInUse -= *block;
+    free(block);
+  }
+}
+
+void* trackedMalloc(const size_t size) { return trackedAlloc(size, false); }
+void* trackedCalloc(const size_t count, const size_t size) { return trackedAlloc(count * size, true); }
+}  // namespace
+
+// The decoder's buffers come from malloc and calloc, route them through the counters
+#define malloc trackedMalloc
+#define calloc trackedCalloc
+#define free trackedFree
+#include "../../lib/JpegToBmpConverter/ProgressiveJpegDecoder.cpp"
+#undef malloc
+#undef calloc
+#undef free
+
+namespace {
+constexpr char SCRATCH_DIR[] = "/.crosspoint";
+constexpr char SCRATCH_PATH[] = "/.crosspoint/progressive.tmp";
+constexpr char JPEG_PATH[] = "/progressive.jpg";
+constexpr int SCALES[] = {1, 2, 4, 8};
+
+struct CorpusFile {
+  const char* name;
+  bool spillsAtFullScale;
+};
+
+constexpr CorpusFile CORPUS[] = {
+    {"color_420", false},         {"color_444_odd_size", false}, {"color_422_restart", false},
+    {"gray_restart_rows", false}, {"spill_420_restart", true},
+};
+
+// Largest mean and maximum difference from the reference, which only rounding in the fixed-point IDCT accounts for
+constexpr double MAX_MEAN_ERROR = 0.5;
+constexpr int MAX_ERROR = 2;
+
+class NullPrint : public Print {
+ public:
+  size_t write(uint8_t) override { return 1; }
+};
+
+// Rows handed to the encoder stand-in below
+std::vector<uint8_t> decodedRows;
+int decodedWidth = 0;
+
+struct Image {
+  int width = 0;
+  int height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+std::string corpusPath(const std::string& file) {
+  const std::string source = __FILE__;
+  return source.substr(0, source.find_last_of('/') + 1) + "corpus/" + file;
+}
+
+std::vector<uint8_t> readHostFile(const std::string& path) {
+  std::vector<uint8_t> bytes;
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file) {
+    uint8_t chunk[4096];
+    size_t length;
+    while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+      bytes.insert(bytes.end(), chunk, chunk + length);
+    }
+    fclose(file);
+  }
+  return bytes;
+}
+
+// Binary PGM as Pillow writes it: "P5\n<width> <height>\n255\n" and the pixels
+Image readReference(const std::string& name, const int scale) {
+  const std::string path = corpusPath(name + "." + std::to_string(scale) + ".pgm");
+  const std::vector<uint8_t> bytes = readHostFile(path);
+  Image image;
+  int maxValue = 0;
+  int headerLength = 0;
+  const std::string header(bytes.begin(), bytes.begin() + std::min<size_t>(bytes.size(), 32));
+  const bool parsed =
+      sscanf(header.c_str(), "P5 %d %d %d%n", &image.width, &image.height, &maxValue, &headerLength) == 3;
+  TEST_ASSERT_TRUE_MESSAGE(parsed && maxValue == 255, path.c_str());
+  image.pixels.assign(bytes.begin() + headerLength + 1, bytes.end());
+  TEST_ASSERT_EQUAL_MESSAGE(image.width * image.height, image.pixels.size(), path.c_str());
+  return image;
+}
+
+void copyToCard(const std::string& name) {
+  const std::vector<uint8_t> bytes = readHostFile(corpusPath(name + ".jpg"));
+  TEST_ASSERT_FALSE_MESSAGE(bytes.empty(), name.c_str());
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", JPEG_PATH, file));
+  TEST_ASSERT_EQUAL(bytes.size(), file.write(bytes.data(), bytes.size()));
+  file.close();
+}
+
+struct DecodeResult {
+  int sourceWidth;
+  int sourceHeight;
+  int width;
+  int height;
+  size_t heapPeak;
+  bool spilled;
+};
+
+DecodeResult decode(const int scale, const std::string& context) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", JPEG_PATH, file));
+
+  heapInUse = 0;
+  heapPeak = 0;
+  auto* decoder = new (trackedMalloc(sizeof(ProgressiveJpegDecoder))) ProgressiveJpegDecoder(file, SCRATCH_PATH);
+  TEST_ASSERT_TRUE_MESSAGE(decoder->readFrameHeader(), context.c_str());
+  TEST_ASSERT_TRUE_MESSAGE(decoder->decodeScans(scale), context.c_str());
+  const bool spilled = SdMan.exists(SCRATCH_PATH);
+
+  DecodeResult result{decoder->getWidth(), decoder->getHeight(), decoder->getScaledWidth(),
+                      decoder->getScaledHeight(), 0, spilled};
+  decodedRows.clear();
+  decodedRows.reserve(static_cast<size_t>(result.width) * result.height);
+  decodedWidth = result.width;
+  const size_t heapBeforeRows = heapInUse;
+  {
+    NullPrint out;
+    ScaledBmpEncoder encoder(out, result.width, result.height, result.width, result.height);
+    TEST_ASSERT_TRUE_MESSAGE(decoder->writeRows(encoder), context.c_str());
+  }
+  TEST_ASSERT_EQUAL_MESSAGE(heapBeforeRows, heapInUse, context.c_str());
+
+  decoder->~ProgressiveJpegDecoder();
+  trackedFree(decoder);
+  result.heapPeak = heapPeak;
+  TEST_ASSERT_EQUAL_MESSAGE(0, heapInUse, context.c_str());
+  TEST_ASSERT_FALSE_MESSAGE(SdMan.exists(SCRATCH_PATH), context.c_str());
+  file.close();
+  return result;
+}
+}  // namespace
+
+// Stands in for the BMP encoder and keeps the gray rows the decoder hands over
+BmpWriter::BmpWriter(Print& out) : out(out), buffer(nullptr) {}
+BmpWriter::~BmpWriter() = default;
+ScaledBmpEncoder::ScaledBmpEncoder(Print& out, const int srcWidth, const int srcHeight, const int, const int)
+    : bmpWriter(out), srcWidth(srcWidth), bmpWidth(srcWidth), bmpHeight(srcHeight) {}
+ScaledBmpEncoder::~ScaledBmpEncoder() = default;
+void ScaledBmpEncoder::writeSourceRow(const uint8_t* gray) {
+  decodedRows.insert(decodedRows.end(), gray, gray + decodedWidth);
+}
+
+void setUp() { SdMan.mkdir(SCRATCH_DIR); }
+
+void tearDown() {}
+
+void test_matches_reference_at_every_scale() {
+  for (const CorpusFile& entry : CORPUS) {
+    copyToCard(entry.name);
+    for (const int scale : SCALES) {
+      const std::string context = std::string(entry.name) + " at scale " + std::to_string(scale) + "/8";
+      const Image reference = readReference(entry.name, scale);
+      const DecodeResult result = decode(scale, context);
+
+      TEST_ASSERT_EQUAL_INT_MESSAGE((result.sourceWidth * scale + 7) / 8, result.width, context.c_str());
+      TEST_ASSERT_EQUAL_INT_MESSAGE((result.sourceHeight * scale + 7) / 8, result.height, context.c_str());
+      TEST_ASSERT_EQUAL_MESSAGE(static_cast<size_t>(result.width) * result.height, decodedRows.size(),
+                                context.c_str());
+      TEST_ASSERT_EQUAL_MESSAGE(entry.spillsAtFullScale && scale == 8, result.spilled, context.c_str());
+
+      // The references at 2/8 and 4/8 stop at the last whole block
+      const bool wholeBlocks = scale == 2 || scale == 4;
+      TEST_ASSERT_EQUAL_INT_MESSAGE(wholeBlocks ? result.sourceWidth / 8 * scale : result.width, reference.width,
+                                    context.c_str());
+      TEST_ASSERT_EQUAL_INT_MESSAGE(wholeBlocks ? result.sourceHeight / 8 * scale : result.height, reference.height,
+                                    context.c_str());
+
+      int maxError = 0;
+      double errorSum = 0;
+      for (int y = 0; y < reference.height; y++) {
+        for (int x = 0; x < reference.width; x++) {
+          const int decoded = decodedRows[static_cast<size_t>(y) * result.width + x];
+          const int error = std::abs(decoded - reference.pixels[static_cast<size_t>(y) * reference.width + x]);
+          maxError = std::max(maxError, error);
+          errorSum += error;
+        }
+      }
+      const double meanError = errorSum / reference.pixels.size();
+
+      char message[256];
+      snprintf(message, sizeof(message), "%s: %dx%d, mean error %.2f, max error %d, heap peak %zu bytes%s",
+               context.c_str(), result.width, result.height, meanError, maxError, result.heapPeak,
+               result.spilled ? " (coefficients spilled to the card)" : "");
+      TEST_MESSAGE(message);
+
+      TEST_ASSERT_TRUE_MESSAGE(meanError <= MAX_MEAN_ERROR, message);
+      TEST_ASSERT_TRUE_MESSAGE(maxError <= MAX_ERROR, message);
+      // The coefficient store (or its window), one band of IDCT output and the decoder itself
+      TEST_ASSERT_TRUE_MESSAGE(result.heapPeak <= sizeof(ProgressiveJpegDecoder) +
+                                                      ProgressiveJpegDecoder::COEFFICIENT_RAM_BUDGET +
+                                                      static_cast<size_t>(result.width + 8) * scale,
+                               message);
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_reference_at_every_scale);
+  return UNITY_END();
+}